@@ -39,7 +39,27 @@ public:
     using VisualEffectImplPtr = std::shared_ptr<Rosen::Drawing::GEVisualEffectImpl>;
     using EffectCreator = std::function<std::shared_ptr<Rosen::Drawing::IGEFilterType>(VisualEffectImplPtr)>;
 
+    // Cheaper alternatives GERender may use instead of the full effect when a deadline cannot be met, bitmask
+    enum DegradeOption : uint32_t {
+        DEGRADE_NONE = 0,               // The effect always runs
+        DEGRADE_REUSE_OUTPUT = 1 << 0,  // Reuse the output of the last full execution while src is unchanged
+        DEGRADE_SKIP = 1 << 1,          // Pass the input image through unchanged
+    };
+
+    // Whether GEOutputMemo may return the output of an identical earlier invocation instead of running the effect,
+    // bitmask. Only effects whose output depends on nothing but their params, the input image and the rects opt in,
+    // so effects keeping state in their cache between frames (e.g. motion blur) must not be registered
+    enum MemoOption : uint32_t {
+        MEMO_NONE = 0,                  // The effect always runs
+        MEMO_OUTPUT = 1 << 0,           // The output may be memoized
+        MEMO_CANVAS_MATRIX = 1 << 1,    // The output also depends on the total matrix of the canvas
+    };
+
     static void Register(Rosen::Drawing::GEFilterType type, EffectCreator&& creator);
+    static void RegisterDegradeOptions(Rosen::Drawing::GEFilterType type, uint32_t options);
+    static uint32_t GetDegradeOptions(Rosen::Drawing::GEFilterType type);
+    static void RegisterMemoOptions(Rosen::Drawing::GEFilterType type, uint32_t options);
+    static uint32_t GetMemoOptions(Rosen::Drawing::GEFilterType type);
 
     static std::shared_ptr<Rosen::Drawing::IGEFilterType> Create(VisualEffectImplPtr impl);
     static std::shared_ptr<Rosen::GEShader> CreateShader(VisualEffectImplPtr impl);
@@ -50,6 +70,8 @@ public:
 private:
     static constexpr size_t MAX_EFFECTS = static_cast<size_t>(Rosen::Drawing::GEFilterType::MAX);
     static std::array<std::optional<EffectCreator>, MAX_EFFECTS> creators_;
+    static std::array<uint32_t, MAX_EFFECTS> degradeOptions_;
+    static std::array<uint32_t, MAX_EFFECTS> memoOptions_;
 
     GEEffectFactory() = delete;
     ~GEEffectFactory() = delete;
@@ -108,12 +130,11 @@ void RegisterExternalEffect(const char* logTag)
             if (FactoryCheckNullptr(params.get(), tagGetParams.c_str(),
                 static_cast<int32_t>(ve->GetFilterType()))) return nullptr;
             uint32_t type = static_cast<uint32_t>(EffectType);
-            void* impl = ::OHOS::Rosen::GEExternalDynamicLoader::GetInstance().CreateGEXObjectByType(
-                type, sizeof(ParamType), static_cast<void*>(params.get()));
+            auto impl = ::OHOS::Rosen::GEExternalDynamicLoader::GetInstance()
+                .CreateGEXObject<::OHOS::Rosen::Drawing::IGEFilterType>(type, *params);
             std::string tagExternalLoader = tag + "ExternalLoader";
-            if (FactoryCheckNullptr(impl, tagExternalLoader.c_str())) return nullptr;
-            return std::shared_ptr<::OHOS::Rosen::Drawing::IGEFilterType>(
-                static_cast<::OHOS::Rosen::Drawing::IGEFilterType*>(impl));
+            if (FactoryCheckNullptr(impl.get(), tagExternalLoader.c_str())) return nullptr;
+            return impl;
         });
 }
 
@@ -131,12 +152,11 @@ void RegisterExternalFallbackEffect(const char* logTag)
             if (FactoryCheckNullptr(params.get(), tagGetParams.c_str(),
                 static_cast<int32_t>(ve->GetFilterType()))) return nullptr;
             uint32_t type = static_cast<uint32_t>(EffectType);
-            void* impl = ::OHOS::Rosen::GEExternalDynamicLoader::GetInstance().CreateGEXObjectByType(
-                type, sizeof(ParamType), static_cast<void*>(params.get()));
+            auto impl = ::OHOS::Rosen::GEExternalDynamicLoader::GetInstance()
+                .CreateGEXObject<::OHOS::Rosen::Drawing::IGEFilterType>(type, *params);
             if (impl) {
                 GE_LOGD("[GEEffectFactory] %{public}s: Using external loader", logTag);
-                return std::shared_ptr<::OHOS::Rosen::Drawing::IGEFilterType>(
-                    static_cast<::OHOS::Rosen::Drawing::IGEFilterType*>(impl));
+                return impl;
             }
             GE_LOGW("[GEEffectFactory] %{public}s: External failed, using fallback", logTag);
             return std::make_shared<FallbackClass>(*params);
@@ -188,6 +208,26 @@ void RegisterExternalFallbackEffect(const char* logTag)
         static GEEffectRegistrar_##EffectType g_effectRegistrar_##EffectType; \
     }
 
+#define GE_FACTORY_DEGRADE_OPTIONS(EffectType, Options) \
+    namespace { \
+        struct GEDegradeRegistrar_##EffectType { \
+            GEDegradeRegistrar_##EffectType() \
+            { ::OHOS::GraphicsEffectEngine::GEEffectFactory::RegisterDegradeOptions( \
+                ::OHOS::Rosen::Drawing::GEFilterType::EffectType, (Options)); } \
+        }; \
+        static GEDegradeRegistrar_##EffectType g_degradeRegistrar_##EffectType; \
+    }
+
+#define GE_FACTORY_MEMO_OPTIONS(EffectType, Options) \
+    namespace { \
+        struct GEMemoRegistrar_##EffectType { \
+            GEMemoRegistrar_##EffectType() \
+            { ::OHOS::GraphicsEffectEngine::GEEffectFactory::RegisterMemoOptions( \
+                ::OHOS::Rosen::Drawing::GEFilterType::EffectType, (Options)); } \
+        }; \
+        static GEMemoRegistrar_##EffectType g_memoRegistrar_##EffectType; \
+    }
+
 } // namespace GraphicsEffectEngine
 } // namespace OHOS
 
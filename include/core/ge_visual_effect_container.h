@@ -40,6 +40,17 @@ public:
 
     void SetDisplayHeadroom(float headroom);
 
+    // Headroom GERender tone-maps the output of the chain to in its final draw, 0 disables. See GEToneMappingLut
+    void SetOutputToneMappingHeadroom(float headroom)
+    {
+        outputToneMappingHeadroom_ = headroom;
+    }
+
+    float GetOutputToneMappingHeadroom() const
+    {
+        return outputToneMappingHeadroom_;
+    }
+
     void SetDisableFilterCache(bool disableFilterCache);
 
     void RemoveFilterWithType(int32_t typeToRemove);
@@ -61,6 +72,7 @@ public:
 
 private:
     std::vector<std::shared_ptr<GEVisualEffect>> filterVec_;
+    float outputToneMappingHeadroom_ = 0.0f;
 };
 
 } // namespace Drawing
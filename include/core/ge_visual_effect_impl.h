@@ -52,7 +52,7 @@ namespace Drawing {
  * 2. SetParam uses reflection metadata (GEParamsMemberTag) for type-safe field access
  * 3. String-based SetParam uses generated GEParamsMemberTagFromString mapping
  */
-class GE_EXPORT GEVisualEffectImpl {
+class GE_EXPORT GEVisualEffectImpl : public GEFramePoolObject {
 public:
     // Type alias for compatiblilty. Many old call sites use GEVisualEffectImpl::FilterType
     using FilterType = GEFilterType;
@@ -73,14 +73,7 @@ public:
             return;
         }
 
-        // Check if tag is valid for current params type
-        if (!IsTagValidForCurrentType(*params_, tag)) {
-            GE_LOGE(
-                "GEVisualEffectImpl::SetParam: tag %u not valid for current params type", static_cast<uint32_t>(tag));
-            return;
-        }
-
-        // Use generated helper to set parameter by tag
+        // Use generated helper to set parameter by tag, its table checks the tag against the params type
         SetParamInternal(*params_, tag, value);
     }
 
@@ -120,7 +113,7 @@ public:
     template<typename ParamsType>
     void MakeParams()
     {
-        params_ = GEFilterParams::Box(std::make_shared<ParamsType>());
+        params_ = GEFilterParams::Make<ParamsType>();
     }
 
     template<typename ParamsType>
@@ -132,6 +125,21 @@ public:
         return GEFilterParams::Unbox<ParamsType>(*params_);
     }
 
+    // Cost predicted by the [[ge::cost(...)]] model of the params, nullopt when the type has none
+    std::optional<GEEffectCost> EstimateCost() const
+    {
+        if (!params_) {
+            return std::nullopt;
+        }
+        return GEParamsBuilder::EstimateCost(*params_);
+    }
+
+    // Content hash of the params, false when the type has no params or a member is unhashable
+    bool HashParams(uint64_t& hash) const
+    {
+        return params_ != nullptr && GEParamsBuilder::Hash(*params_, hash);
+    }
+
     // ========================================================================
     // CanvasInfo management - Screen canvas geometry info
     // ========================================================================
@@ -160,6 +168,19 @@ public:
         return cacheAnyPtr_;
     }
 
+    // Output of the last full execution, kept by GERender for GEEffectFactory::DEGRADE_REUSE_OUTPUT effects
+    void SetLastOutput(const std::shared_ptr<Drawing::Image>& image, const Drawing::Rect& src)
+    {
+        lastOutput_ = image;
+        lastOutputSrc_ = src;
+    }
+
+    // Returns nullptr unless the last output was produced for the same src
+    std::shared_ptr<Drawing::Image> GetLastOutput(const Drawing::Rect& src) const
+    {
+        return lastOutputSrc_ == src ? lastOutput_ : nullptr;
+    }
+
     // ========================================================================
     // Backward-compatible convenience methods
     // Warning: New types should use MakeParams<T> / GetParams<T> directly
@@ -275,13 +296,6 @@ public:
     }
 
 private:
-    /// Check if tag belongs to current params type's tag range
-    static bool IsTagValidForCurrentType(const GEFilterParams& params, GEParamsMemberTag tag)
-    {
-        auto tagType = GEParamsMemberHelper::GetFilterTypeFromTag(tag);
-        return tagType == params.GetType();
-    }
-
     /// Internal set param implementation - uses reflection metadata to set field value
     /// Non-template overloads for each type, generated from FOR_EACH_PARAM_TYPE
     /// Implementations in ge_visual_effect_impl.cpp
@@ -301,6 +315,8 @@ private:
     FilterType filterType_ = FilterType::NONE;
     Drawing::CanvasInfo canvasInfo_;
     std::shared_ptr<std::any> cacheAnyPtr_ = nullptr;
+    std::shared_ptr<Drawing::Image> lastOutput_ = nullptr;
+    Drawing::Rect lastOutputSrc_ {};
     std::unique_ptr<GEFilterParams> params_ = nullptr;
 };
 
@@ -38,6 +38,9 @@ public:
     std::shared_ptr<Drawing::Image> OnProcessImage(Drawing::Canvas& canvas,
         const std::shared_ptr<Drawing::Image> image, const Drawing::Rect& src, const Drawing::Rect& dst) override;
 
+    std::shared_ptr<Drawing::ShaderEffect> MakeComposableShader(
+        const std::shared_ptr<Drawing::ShaderEffect>& input, const Drawing::ImageInfo& info) override;
+
     void Preprocess(Drawing::Canvas& canvas, const Drawing::Rect& src, const Drawing::Rect& dst) override;
 
     bool CheckInParams(float* color, float* position, float* strength, int tupleSize);
@@ -47,6 +50,9 @@ public:
 
 private:
     std::shared_ptr<Drawing::RuntimeShaderBuilder> PreProcessColorGradientBuilder(float geoWidth, float geoHeight);
+    std::shared_ptr<Drawing::RuntimeShaderBuilder> PrepareColorGradientBuilder(
+        const std::shared_ptr<Drawing::ShaderEffect>& srcImageShader, float* color, float* position,
+        float* strength);
 
     std::vector<float> colors_;
     std::vector<float> positions_;
@@ -35,11 +35,17 @@ public:
     std::shared_ptr<Drawing::Image> OnProcessImage(Drawing::Canvas &canvas,
         const std::shared_ptr<Drawing::Image> image, const Drawing::Rect &src, const Drawing::Rect &dst) override;
 
+    std::shared_ptr<Drawing::ShaderEffect> MakeComposableShader(
+        const std::shared_ptr<Drawing::ShaderEffect>& input, const Drawing::ImageInfo& info) override;
+
 protected:
     virtual std::shared_ptr<Drawing::RuntimeEffect> GetDispersionEffect();
     Drawing::GEDispersionShaderFilterParams params_;
 
 private:
+    std::shared_ptr<Drawing::RuntimeShaderBuilder> MakeDispersionBuilder(
+        const std::shared_ptr<Drawing::ShaderEffect>& imageShader);
+
     inline static const std::string g_shaderStringDispersion = R"(
         uniform shader image;
         uniform shader mask;
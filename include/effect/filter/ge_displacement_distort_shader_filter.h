@@ -35,10 +35,15 @@ public:
 
     std::shared_ptr<Drawing::Image> OnProcessImage(Drawing::Canvas& canvas, const std::shared_ptr<Drawing::Image> image,
         const Drawing::Rect& src, const Drawing::Rect& dst) override;
+
+    std::shared_ptr<Drawing::ShaderEffect> MakeComposableShader(
+        const std::shared_ptr<Drawing::ShaderEffect>& input, const Drawing::ImageInfo& info) override;
  
     const std::string GetDescription() const;
 
 private:
+    std::shared_ptr<Drawing::RuntimeShaderBuilder> MakeDisplacementDistortBuilder(
+        const std::shared_ptr<Drawing::ShaderEffect>& imageShader);
     std::shared_ptr<Drawing::RuntimeEffect> GetDisplacementDistortEffect();
     Drawing::GEDisplacementDistortFilterParams params_;
 
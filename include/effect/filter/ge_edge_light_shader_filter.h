@@ -15,6 +15,7 @@
 #ifndef GRAPHICS_EFFECT_EDGE_LIGHT_SHADER_FILTER_H
 #define GRAPHICS_EFFECT_EDGE_LIGHT_SHADER_FILTER_H
 
+#include <list>
 #include <memory>
 #include <optional>
 
@@ -27,6 +28,60 @@
 namespace OHOS {
 namespace Rosen {
 
+// Everything the convert, detect and blur passes depend on
+struct EdgeLightCacheKey {
+    uint32_t imageId = 0;
+    int width = 0;
+    int height = 0;
+    Vector4f color;
+    bool useRawColor = false;
+    bool bloom = true;
+    std::shared_ptr<Drawing::ColorSpace> colorSpace = nullptr;
+
+    bool Matches(const EdgeLightCacheKey& other) const;
+};
+
+/**
+ * @class GEEdgeLightImageCache
+ * @brief Thread local LRU of blurred edge images shared by the edge light filters rendering on a thread.
+ *
+ * Several edge lit surfaces in one frame each keep their entry, so only the merge pass runs for unchanged content.
+ */
+class GE_EXPORT GEEdgeLightImageCache {
+public:
+    struct Stats {
+        uint64_t hits = 0;
+        uint64_t misses = 0;
+        uint64_t evictions = 0;
+    };
+
+    static GEEdgeLightImageCache& GetInstance();
+
+    // Returns the cached image and marks it most recently used, nullptr on a miss
+    std::shared_ptr<Drawing::Image> Find(const EdgeLightCacheKey& key);
+    void Insert(const EdgeLightCacheKey& key, const std::shared_ptr<Drawing::Image>& image);
+    // Drops all entries and resets the statistics
+    void Clear();
+
+    size_t Size() const
+    {
+        return entries_.size();
+    }
+
+    Stats GetStats() const
+    {
+        return stats_;
+    }
+
+    static constexpr size_t MAX_ENTRIES = 8;
+
+private:
+    GEEdgeLightImageCache() = default;
+
+    std::list<std::pair<EdgeLightCacheKey, std::shared_ptr<Drawing::Image>>> entries_;
+    Stats stats_;
+};
+
 class GE_EXPORT GEEdgeLightShaderFilter : public GEShaderFilter {
 public:
     GEEdgeLightShaderFilter(const Drawing::GEEdgeLightShaderFilterParams& params);
@@ -55,6 +110,7 @@ private:
     bool InitMergeImageShaderEffect();
     bool IsShaderEffectInitValid();
     bool IsInputImageValid(const std::shared_ptr<Drawing::Image> image);
+    EdgeLightCacheKey MakeCacheKey(const std::shared_ptr<Drawing::Image>& image) const;
 
     std::shared_ptr<Drawing::Image> ConvertColorSpace(Drawing::Canvas& canvas,
         const std::shared_ptr<Drawing::Image> image, std::shared_ptr<Drawing::ColorSpace> dstColorSpace);
@@ -19,6 +19,8 @@
 #include "ge_shader_filter.h"
 #include "ge_visual_effect.h"
 
+#include "effect/runtime_shader_builder.h"
+
 namespace OHOS {
 namespace Rosen {
 
@@ -31,8 +33,13 @@ public:
     GE_EXPORT std::shared_ptr<Drawing::Image> OnProcessImage(Drawing::Canvas &canvas,
         const std::shared_ptr<Drawing::Image> image, const Drawing::Rect &src, const Drawing::Rect &dst) override;
 
+    std::shared_ptr<Drawing::ShaderEffect> MakeComposableShader(
+        const std::shared_ptr<Drawing::ShaderEffect>& input, const Drawing::ImageInfo& info) override;
+
 private:
     bool InitGreyAdjustmentEffect();
+    std::shared_ptr<Drawing::RuntimeShaderBuilder> MakeGreyAdjustmentBuilder(
+        const std::shared_ptr<Drawing::ShaderEffect>& imageShader);
 
     float greyCoef1_;
     float greyCoef2_;
@@ -41,7 +41,12 @@ public:
     std::shared_ptr<Drawing::Image> OnProcessImage(Drawing::Canvas& canvas, const std::shared_ptr<Drawing::Image> image,
         const Drawing::Rect& src, const Drawing::Rect& dst) override;
 
+    std::shared_ptr<Drawing::ShaderEffect> MakeComposableShader(
+        const std::shared_ptr<Drawing::ShaderEffect>& input, const Drawing::ImageInfo& info) override;
+
 private:
+    std::shared_ptr<Drawing::RuntimeShaderBuilder> MakeHeatDistortionBuilder(
+        const std::shared_ptr<Drawing::ShaderEffect>& imageShader, float width, float height);
     void CheckHeatDistortionParams();
     std::shared_ptr<Drawing::RuntimeEffect> GetHeatDistortionEffect();
 
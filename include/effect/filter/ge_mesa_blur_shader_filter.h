@@ -159,6 +159,8 @@ private:
         const Drawing::Rect& dst);
 
     bool SetBlurParamsFivePassLarge(NewBlurParams& bParam);
+    // Coarser down-sampling when GEQualityGovernor reports the effect budget is exceeded
+    void ApplyQualityLevel(NewBlurParams& bParam);
 
     Drawing::Matrix BuildMatrix(const Drawing::Rect& src, const Drawing::ImageInfo& scaledInfo,
         const std::shared_ptr<Drawing::Image>& input) const;
@@ -35,10 +35,19 @@ struct MotionBlurCacheData {
     float radius = 0.0f;
     Vector2f anchor = Vector2f(0.5f, 0.5f);
     int32_t sampleCount = 8;
+    int32_t mode = 0;
+    // Down-sampled source of the multi-resolution mode, reused while the transition keeps the same source image
+    std::shared_ptr<Drawing::Image> lowResImage = nullptr;
+    uint32_t lowResImageId = 0;
 };
 
 class GE_EXPORT GEMotionBlurShaderFilter : public GEShaderFilter {
 public:
+    enum class Mode : int32_t {
+        SINGLE_PASS = 0,      // One pass at half resolution with the configured sample count
+        MULTI_RESOLUTION = 1, // Blur a smaller copy chosen by motion length, then upscale guided by the source
+    };
+
     GEMotionBlurShaderFilter(const Drawing::GEMotionBlurShaderFilterParams& params);
     GEMotionBlurShaderFilter(const GEMotionBlurShaderFilter&) = delete;
     GEMotionBlurShaderFilter operator=(const GEMotionBlurShaderFilter&) = delete;
@@ -48,6 +57,14 @@ public:
 
     DECLARE_GEFILTER_TYPEFUNC(GEMotionBlurShaderFilter, Drawing::GEMotionBlurShaderFilterParams);
 
+    // Largest on-screen distance covered by the blur trail, in the coordinate space of the inputs
+    static float GetMotionLength(const Vector2f& rectOffset, const Vector2f& scaleSize,
+        const Vector2f& scaleAnchorCoord, float width, float height, float radius);
+    // Down-sampling scale of the multi-resolution mode for a motion length in full resolution pixels
+    static float GetMultiResScale(float motionLength);
+    // Samples needed to cover a motion length in low resolution pixels, at most maxSampleCount
+    static int32_t GetAdaptiveSampleCount(float lowResMotionLength, int32_t maxSampleCount);
+
     GE_EXPORT std::shared_ptr<Drawing::Image> OnProcessImage(Drawing::Canvas& canvas,
         const std::shared_ptr<Drawing::Image> image, const Drawing::Rect& src, const Drawing::Rect& dst) override;
 
@@ -55,9 +72,11 @@ public:
 
 private:
     static std::shared_ptr<Drawing::RuntimeEffect> GetMotionBlurEffect();
+    static std::shared_ptr<Drawing::RuntimeEffect> GetDownSampleEffect();
+    static std::shared_ptr<Drawing::RuntimeEffect> GetEdgeAwareUpscaleEffect();
     std::shared_ptr<Drawing::RuntimeShaderBuilder> MakeMotionBlurShader(
-        std::shared_ptr<Drawing::ShaderEffect> srcImageShader,
-        const Vector2f& scaleAnchor, const Vector2f& scaleSize, const Vector2f& rectOffset) const;
+        std::shared_ptr<Drawing::ShaderEffect> srcImageShader, const Vector2f& scaleAnchor,
+        const Vector2f& scaleSize, const Vector2f& rectOffset, int32_t sampleCount) const;
     void CalculateRect(const Drawing::Rect& lastRect, const Drawing::Rect& curRect,
         Vector2f& rectOffset, Vector2f& scaleSize, Vector2f& scaleAnchorCoord) const;
     bool RectValid(const Drawing::Rect& rect1, const Drawing::Rect& rect2) const;
@@ -71,17 +90,38 @@ private:
         const Vector2f& scaleSize, const Vector2f& scaleAnchorCoord) const;
     std::shared_ptr<Drawing::Image> CreateUpscaledImage(Drawing::Canvas& canvas,
         const std::shared_ptr<Drawing::Image>& blurImage) const;
+    std::shared_ptr<Drawing::Image> ProcessMultiResolution(Drawing::Canvas& canvas,
+        const std::shared_ptr<Drawing::Image>& image, const Drawing::Rect& curRect,
+        const Vector2f& rectOffset, const Vector2f& scaleSize, const Vector2f& scaleAnchorCoord);
+    std::shared_ptr<Drawing::Image> GetLowResImage(Drawing::Canvas& canvas,
+        const std::shared_ptr<Drawing::Image>& image, float scale);
+    std::shared_ptr<Drawing::Image> CreateLowResBlurImage(Drawing::Canvas& canvas,
+        const std::shared_ptr<Drawing::Image>& lowResImage, const Vector2f& rectOffset,
+        const Vector2f& scaleSize, const Vector2f& scaleAnchorCoord, int32_t sampleCount) const;
+    std::shared_ptr<Drawing::Image> CreateEdgeAwareUpscaledImage(Drawing::Canvas& canvas,
+        const std::shared_ptr<Drawing::Image>& image, const std::shared_ptr<Drawing::Image>& lowResImage,
+        const std::shared_ptr<Drawing::Image>& blurImage, float scale) const;
     void UpdateCache(const Drawing::Rect& rect);
     Drawing::Rect GetLastRectFromCache();
 
     float radius_ = 0.0f;
     Vector2f anchor_ = Vector2f(0.5f, 0.5f);
     int32_t sampleCount_ = 6;
+    Mode mode_ = Mode::SINGLE_PASS;
+
+    // Low resolution intermediate carried between frames through the cache
+    std::shared_ptr<Drawing::Image> lowResImage_ = nullptr;
+    uint32_t lowResImageId_ = 0;
 
     bool disableMotionBlur_ = false;
 
     static constexpr float FLOAT_SCALE_THRESHOLD = 1.1f;
     static constexpr float FLOAT_IMAGE_SCALE = 0.5f;
+    static constexpr float MIN_MULTI_RES_SCALE = 0.125f;
+    // Motion lengths below twice this value stay at FLOAT_IMAGE_SCALE, every further doubling halves the scale
+    static constexpr float MULTI_RES_MOTION_PER_LEVEL = 32.0f;
+    // Spacing between samples in low resolution pixels, bilinear taps cover the gaps
+    static constexpr float MULTI_RES_SAMPLE_SPACING = 2.0f;
 };
 
 } // namespace Rosen
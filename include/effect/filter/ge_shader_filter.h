@@ -22,6 +22,7 @@
 
 #include "ge_cache_provider.h"
 #include "draw/canvas.h"
+#include "effect/shader_effect.h"
 #include "ge_filter_type.h"
 #include "ge_shader_filter_params.h"
 #include "image/image.h"
@@ -53,6 +54,27 @@ public:
         return false; // Placeholder default implementation (Does not support directly draw on canvas)
     }
 
+    /**
+     * @brief Shader form of OnProcessImage, composed with the adjacent filters into a single pass
+     * @param input Evaluates the input image at image coordinates, takes the place of the image shader
+     * @param info Info of the input image, the output keeps its size
+     * @return Shader evaluating the output at image coordinates, nullptr when the filter cannot be composed.
+     *         The default implementation returns nullptr.
+     * @note Filters whose output pixel only depends on input samples and their params can override this function
+     *       and be listed in GEShaderCompositionPass. GERender then draws the shaders of adjacent filters nested
+     *       into each other once, instead of materialising an image per filter. When returning nullptr GERender
+     *       automatically falls back to OnProcessImage for every filter of the run.
+     */
+    virtual std::shared_ptr<Drawing::ShaderEffect> MakeComposableShader(
+        const std::shared_ptr<Drawing::ShaderEffect>& input, const Drawing::ImageInfo& info)
+    {
+        return nullptr; // Placeholder default implementation (Does not support composition)
+    }
+
+    // Draws a shader of MakeComposableShader into an image of info, nullptr on failure
+    GE_EXPORT static std::shared_ptr<Drawing::Image> MakeComposedImage(Drawing::Canvas& canvas,
+        const std::shared_ptr<Drawing::ShaderEffect>& shader, const Drawing::ImageInfo& info);
+
     GE_EXPORT std::shared_ptr<Drawing::Image> ProcessImage(Drawing::Canvas& canvas,
         const std::shared_ptr<Drawing::Image> image, const Drawing::Rect& src, const Drawing::Rect& dst);
 
@@ -74,6 +96,22 @@ public:
         supportHeadroom_ = supportHeadroom;
     }
 
+    /**
+     * @brief Headroom the output drawn by OnDrawImage is tone-mapped to, 0 disables.
+     * @note Filters supporting it pass their final shader through ToneMapOutput, IsOutputToneMapped then tells GERender
+     *       that no separate tone mapping pass is needed.
+     */
+    void SetOutputToneMappingHeadroom(float headroom)
+    {
+        outputToneMappingHeadroom_ = headroom;
+        outputToneMapped_ = false;
+    }
+
+    bool IsOutputToneMapped() const
+    {
+        return outputToneMapped_;
+    }
+
     virtual void Preprocess(Drawing::Canvas& canvas, const Drawing::Rect& src, const Drawing::Rect& dst) {}
 
     void SetCache(std::shared_ptr<std::any> cacheData)
@@ -102,9 +140,31 @@ protected:
         return translateMatrix;
     }
 
+    /**
+     * @brief Matrix of canvasInfo_ relative to its translation, mapping the geometry coordinates the canvas-aware
+     *        filters are evaluated in to image coordinates.
+     * @return False when the matrix is not invertible
+     */
+    bool GetCanvasGeometryMatrix(Drawing::Matrix& matrix, Drawing::Matrix& invertMatrix) const;
+
+    /**
+     * @brief Evaluates shader through a local matrix, like the local matrix of an image shader.
+     *        Used in MakeComposableShader to map the input into the coordinates of the filter.
+     */
+    static std::shared_ptr<Drawing::ShaderEffect> MakeLocalMatrixShader(
+        const std::shared_ptr<Drawing::ShaderEffect>& shader, const Drawing::Matrix& matrix);
+
+    /**
+     * @brief Fuses the output tone mapping into the final shader of OnDrawImage.
+     * @return The tone-mapped shader, or shader itself when tone mapping is disabled or fails.
+     */
+    std::shared_ptr<Drawing::ShaderEffect> ToneMapOutput(const std::shared_ptr<Drawing::ShaderEffect>& shader);
+
 protected:
     Drawing::CanvasInfo canvasInfo_;
     float supportHeadroom_ = 0.0f;
+    float outputToneMappingHeadroom_ = 0.0f;
+    bool outputToneMapped_ = false;
     uint32_t hash_ = 0;
     std::shared_ptr<std::any> cacheAnyPtr_ = nullptr;
 };
@@ -29,6 +29,12 @@ namespace Rosen {
 
 class GE_EXPORT GEVariableRadiusBlurShaderFilter : public GEShaderFilter {
 public:
+    // Values of GEVariableRadiusBlurShaderFilterParams::mode
+    enum class Mode : int32_t {
+        BOX = 0,     // Alternating box passes at full resolution, O(radius) per pixel
+        PYRAMID = 1, // Down-sampled blur pyramid interpolated by the mask alpha, O(1) per pixel
+    };
+
     GEVariableRadiusBlurShaderFilter(const Drawing::GEVariableRadiusBlurShaderFilterParams& params);
     GEVariableRadiusBlurShaderFilter(const GEVariableRadiusBlurShaderFilter&) = delete;
     GEVariableRadiusBlurShaderFilter operator=(const GEVariableRadiusBlurShaderFilter&) = delete;
@@ -40,6 +46,9 @@ public:
     std::string GetDescription();
     std::string GetDetailedDescription();
 
+    // Number of down-sampled levels needed for the given half radius, level i is blurred by about 2^(i-1) pixels
+    static int GetPyramidLevelCount(float radius);
+
 protected:
     Drawing::GEVariableRadiusBlurShaderFilterParams params_;
 
@@ -47,12 +56,16 @@ private:
     static void MakeHorizontalBoxBlurEffect(bool applyInsideMask = false);
     static void MakeVerticalBoxBlurEffect(bool applyInsideMask = false);
     static void MakeTextureShaderEffect();
+    static void MakePyramidEffects();
     static std::shared_ptr<Drawing::Image> DrawBoxLinearGradientBlur(const std::shared_ptr<Drawing::Image>& image,
         Drawing::Canvas& canvas, float radius, std::shared_ptr<Drawing::ShaderEffect> alphaGradientShader,
         const Drawing::Rect& dst);
     static std::shared_ptr<Drawing::Image> BuildBoxLinearGradientBlur(const std::shared_ptr<Drawing::Image>& image,
         Drawing::Canvas& canvas, float radius, std::shared_ptr<Drawing::ShaderEffect> alphaGradientShader,
         Drawing::Matrix blurMatrix);
+    static std::shared_ptr<Drawing::Image> DrawPyramidGradientBlur(const std::shared_ptr<Drawing::Image>& image,
+        Drawing::Canvas& canvas, float radius, std::shared_ptr<Drawing::ShaderEffect> alphaGradientShader,
+        const Drawing::Rect& dst);
 };
 
 } // namespace Rosen
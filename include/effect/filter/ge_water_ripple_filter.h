@@ -40,8 +40,13 @@ public:
 
     GE_EXPORT std::shared_ptr<Drawing::Image> OnProcessImage(Drawing::Canvas &canvas,
         const std::shared_ptr<Drawing::Image> image, const Drawing::Rect &src, const Drawing::Rect &dst) override;
+
+    std::shared_ptr<Drawing::ShaderEffect> MakeComposableShader(
+        const std::shared_ptr<Drawing::ShaderEffect>& input, const Drawing::ImageInfo& info) override;
  
 private:
+    std::shared_ptr<Drawing::RuntimeShaderBuilder> MakeWaterRippleBuilder(
+        const std::shared_ptr<Drawing::ShaderEffect>& imageShader);
     std::shared_ptr<Drawing::RuntimeEffect> GetWaterRippleEffect();
     std::shared_ptr<Drawing::RuntimeEffect> GetWaterRippleEffectSM(const int rippleMode);
     std::shared_ptr<Drawing::RuntimeEffect> GetWaterRippleEffectSS();
@@ -0,0 +1,75 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef GRAPHICS_EFFECT_GE_EFFECT_COST_H
+#define GRAPHICS_EFFECT_GE_EFFECT_COST_H
+
+#include <cstdint>
+
+namespace OHOS {
+namespace Rosen {
+namespace Drawing {
+/**
+ * @struct GEEffectCost
+ * @brief Predicted GPU cost of one effect, produced from the [[ge::cost(...)]] attribute of its params struct.
+ *
+ * passes:          render passes at the intermediate resolution
+ * readRadius:      distance in source pixels the effect reads beyond the output rect
+ * resolutionScale: intermediate resolution relative to the output, per axis
+ * readsPerPixel:   texture reads per intermediate pixel and pass
+ */
+struct GEEffectCost {
+    float passes = 1.0f;
+    float readRadius = 0.0f;
+    float resolutionScale = 1.0f;
+    float readsPerPixel = 1.0f;
+
+    // Texture reads needed to render an output of width x height
+    constexpr float EstimateTexelReads(float width, float height) const
+    {
+        const float scaledWidth = (width + readRadius + readRadius) * resolutionScale;
+        const float scaledHeight = (height + readRadius + readRadius) * resolutionScale;
+        return passes * readsPerPixel * scaledWidth * scaledHeight;
+    }
+};
+
+// Helpers usable in the expressions of [[ge::cost(...)]], the generated estimators are constexpr
+namespace GEEffectCostMath {
+constexpr float Min(float a, float b)
+{
+    return a < b ? a : b;
+}
+
+constexpr float Max(float a, float b)
+{
+    return a < b ? b : a;
+}
+
+constexpr float Clamp(float v, float lo, float hi)
+{
+    return Min(Max(v, lo), hi);
+}
+
+constexpr float Ceil(float v)
+{
+    const float truncated = static_cast<float>(static_cast<int64_t>(v));
+    return truncated < v ? truncated + 1.0f : truncated;
+}
+} // namespace GEEffectCostMath
+} // namespace Drawing
+} // namespace Rosen
+} // namespace OHOS
+
+#endif // GRAPHICS_EFFECT_GE_EFFECT_COST_H
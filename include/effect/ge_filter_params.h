@@ -19,13 +19,14 @@
 
 #include "ge_filter_type.h"
 #include "ge_filter_type_info.h"
+#include "ge_frame_pool.h"
 
 namespace OHOS {
 namespace Rosen {
 namespace Drawing {
 
-// Type-erased params class
-class GEFilterParams {
+// Type-erased params class, boxes come from GEFramePool
+class GEFilterParams : public GEFramePoolObject {
 public:
     template<typename T>
     struct OptionalTypeTrait {
@@ -47,6 +48,9 @@ public:
     static std::shared_ptr<T> Unbox(const GEFilterParams& params);
     template<typename T>
     static std::unique_ptr<GEFilterParams> Box(const std::shared_ptr<T>& params);
+    // Default params of type T boxed, the params and their control block share one GEFramePool block
+    template<typename T>
+    static std::unique_ptr<GEFilterParams> Make();
 
     virtual ~GEFilterParams() = default;
 
@@ -100,6 +104,12 @@ std::unique_ptr<GEFilterParams> GEFilterParams::Box(const std::shared_ptr<T>& pa
     }
     return std::make_unique<GEFilterParamsWrapper<TValue>>(params);
 }
+
+template<typename T>
+std::unique_ptr<GEFilterParams> GEFilterParams::Make()
+{
+    return Box(std::allocate_shared<T>(GEFramePoolAllocator<T>()));
+}
 } // namespace Drawing
 } // namespace Rosen
 } // namespace OHOS
@@ -0,0 +1,236 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef GRAPHICS_EFFECT_GE_PARAMS_HASH_H
+#define GRAPHICS_EFFECT_GE_PARAMS_HASH_H
+
+#include <array>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "image/image.h"
+
+#include "ge_effects_params.h"
+#include "ge_params_associate_types.h"
+#include "ge_shader_shape.h"
+
+namespace OHOS {
+namespace Rosen {
+namespace Drawing {
+/**
+ * @class GEParamsHasher
+ * @brief Content hash of effect params, used to recognize invocations whose output is already known.
+ *
+ * Values are hashed by content, images by GetUniqueID and shapes by the hash their owner set on them. Types without
+ * a stable content identity (masks, paths, shapes without hash, unknown structs) make the hasher unhashable, callers
+ * must then assume the params changed.
+ */
+class GEParamsHasher {
+public:
+    // Arithmetic values and enums, anything else is unhashable unless it has an overload below
+    template<typename T>
+    void Add(const T& value)
+    {
+        if constexpr (std::is_floating_point_v<T>) {
+            AddFloat(static_cast<float>(value));
+        } else if constexpr (std::is_arithmetic_v<T> || std::is_enum_v<T>) {
+            AddBits(static_cast<uint64_t>(value));
+        } else {
+            hashable_ = false;
+        }
+    }
+
+    template<typename T>
+    void Add(const std::shared_ptr<T>& value)
+    {
+        // Absent objects are common and hash like a null image, present ones need a content identity
+        if (value == nullptr) {
+            AddBits(0);
+            return;
+        }
+        if constexpr (std::is_base_of_v<GEShaderShape, T>) {
+            // 0 means the owner never described the content of the shape
+            if (value->GetHash() != 0) {
+                AddBits(value->GetHash());
+                return;
+            }
+        }
+        hashable_ = false;
+    }
+
+    void Add(const std::shared_ptr<Image>& value)
+    {
+        AddBits(value == nullptr ? 0 : value->GetUniqueID());
+    }
+
+    void Add(const std::weak_ptr<Image>& value)
+    {
+        Add(value.lock());
+    }
+
+    template<typename T>
+    void Add(const std::vector<T>& values)
+    {
+        AddBits(values.size());
+        for (const auto& value : values) {
+            Add(value);
+        }
+    }
+
+    template<typename T, size_t N>
+    void Add(const std::array<T, N>& values)
+    {
+        for (const auto& value : values) {
+            Add(value);
+        }
+    }
+
+    template<typename First, typename Second>
+    void Add(const std::pair<First, Second>& value)
+    {
+        Add(value.first);
+        Add(value.second);
+    }
+
+    void Add(const Vector2f& value)
+    {
+        AddFloat(value.x_);
+        AddFloat(value.y_);
+    }
+
+    void Add(const Vector3f& value)
+    {
+        AddFloat(value.x_);
+        AddFloat(value.y_);
+        AddFloat(value.z_);
+    }
+
+    void Add(const Vector4f& value)
+    {
+        AddFloat(value.x_);
+        AddFloat(value.y_);
+        AddFloat(value.z_);
+        AddFloat(value.w_);
+    }
+
+    void Add(const Point& value)
+    {
+        AddFloat(value.GetX());
+        AddFloat(value.GetY());
+    }
+
+    void Add(const RectF& value)
+    {
+        AddFloat(value.GetLeft());
+        AddFloat(value.GetTop());
+        AddFloat(value.GetRight());
+        AddFloat(value.GetBottom());
+    }
+
+    void Add(const Color& value)
+    {
+        AddBits(value.CastToColorQuad());
+    }
+
+    void Add(const Color4f& value)
+    {
+        AddFloat(value.redF_);
+        AddFloat(value.greenF_);
+        AddFloat(value.blueF_);
+        AddFloat(value.alphaF_);
+    }
+
+    void Add(const Matrix& value)
+    {
+        for (int index = 0; index < MATRIX_VALUE_COUNT; ++index) {
+            AddFloat(value.Get(index));
+        }
+    }
+
+    void Add(const GERRect& value)
+    {
+        AddFloat(value.left_);
+        AddFloat(value.top_);
+        AddFloat(value.width_);
+        AddFloat(value.height_);
+        for (const auto& radius : value.radius_) {
+            Add(radius);
+        }
+    }
+
+    void Add(const GESDFBorderParams& value)
+    {
+        Add(value.color);
+        AddFloat(value.width);
+        Add(value.isOutline);
+    }
+
+    void Add(const CanvasInfo& value)
+    {
+        AddFloat(value.geoWidth);
+        AddFloat(value.geoHeight);
+        AddFloat(value.tranX);
+        AddFloat(value.tranY);
+        Add(value.mat);
+        Add(value.materialDst);
+        Add(value.disableFilterCache);
+    }
+
+    bool IsHashable() const
+    {
+        return hashable_;
+    }
+
+    uint64_t GetHash() const
+    {
+        return hash_;
+    }
+
+private:
+    static constexpr int MATRIX_VALUE_COUNT = 9; // 9: 3x3 matrix
+    static constexpr uint64_t FNV_OFFSET_BASIS = 14695981039346656037ULL;
+    static constexpr uint64_t FNV_PRIME = 1099511628211ULL;
+    static constexpr uint32_t BYTE_BITS = 8;
+    static constexpr uint64_t BYTE_MASK = 0xFF;
+
+    // FNV-1a over the 8 bytes of bits
+    void AddBits(uint64_t bits)
+    {
+        for (size_t i = 0; i < sizeof(bits); ++i) {
+            hash_ = (hash_ ^ ((bits >> (i * BYTE_BITS)) & BYTE_MASK)) * FNV_PRIME;
+        }
+    }
+
+    void AddFloat(float value)
+    {
+        // -0 and 0 produce the same output
+        value = value == 0.0f ? 0.0f : value;
+        uint32_t bits = 0;
+        std::memcpy(&bits, &value, sizeof(bits));
+        AddBits(bits);
+    }
+
+    uint64_t hash_ = FNV_OFFSET_BASIS;
+    bool hashable_ = true;
+};
+} // namespace Drawing
+} // namespace Rosen
+} // namespace OHOS
+
+#endif // GRAPHICS_EFFECT_GE_PARAMS_HASH_H
@@ -28,6 +28,7 @@
 #include <type_traits>
 #include <utility>
 
+#include "ge_effect_cost.h"
 #include "ge_effects_params.h"
 #include "ge_value_transformer.h"
 #include "ge_value_transformer_traits.h"
@@ -426,6 +427,7 @@ enum class GEParamsMemberTag : uint32_t {
     MOTION_BLUR_RADIUS,
     MOTION_BLUR_ANCHOR,
     MOTION_BLUR_SAMPLE_COUNT,
+    MOTION_BLUR_MODE,
     PARTICLE_ABLATION_PROGRESS,
     PARTICLE_ABLATION_ABLATION_RATE,
     PARTICLE_ABLATION_CENTERS0,
@@ -578,6 +580,7 @@ enum class GEParamsMemberTag : uint32_t {
     VARIABLE_RADIUS_BLUR_MASK,
     VARIABLE_RADIUS_BLUR_BLUR_RADIUS,
     VARIABLE_RADIUS_BLUR_APPLY_INSIDE_MASK,
+    VARIABLE_RADIUS_BLUR_MODE,
     WATER_DROPLET_TRANSITION_TOP_LAYER,
     WATER_DROPLET_TRANSITION_INVERSE,
     WATER_DROPLET_TRANSITION_PROGRESS,
@@ -1586,8 +1589,83 @@ public:
     // Convert filter name string to GEFilterType
     // Note: Strings are sourced from GEFilterParamsTypeInfo<Struct>::FilterName
     static GEFilterType GetFilterTypeFromString(const std::string& str);
+
+    // Cost predicted by the [[ge::cost(...)]] model of the params, nullopt when the type has none
+    static std::optional<GEEffectCost> EstimateCost(const GEFilterParams& params);
+
+    // Content hash of every member of the params, see GEParamsHasher. False when a member is unhashable.
+    static bool Hash(const GEFilterParams& params, uint64_t& hash);
+};
+
+// GEEffectCostEstimator template specializations
+// Generated from the [[ge::cost(...)]] attributes, Estimate predicts the cost of the effect for params
+template<typename T>
+struct GEEffectCostEstimator {
+    static constexpr bool HAS_MODEL = false;
 };
 
+template<>
+struct GEEffectCostEstimator<GEGreyShaderFilterParams> {
+    static constexpr bool HAS_MODEL = true;
+    static constexpr GEEffectCost Estimate([[maybe_unused]] const GEGreyShaderFilterParams& params)
+    {
+        using namespace GEEffectCostMath;
+        GEEffectCost cost;
+        cost.passes = static_cast<float>(1);
+        cost.readsPerPixel = static_cast<float>(1);
+        return cost;
+    }
+};
+
+template<>
+struct GEEffectCostEstimator<GEKawaseBlurShaderFilterParams> {
+    static constexpr bool HAS_MODEL = true;
+    static constexpr GEEffectCost Estimate([[maybe_unused]] const GEKawaseBlurShaderFilterParams& params)
+    {
+        using namespace GEEffectCostMath;
+        const float radius = static_cast<float>(params.radius);
+        GEEffectCost cost;
+        cost.passes = static_cast<float>(Clamp(Ceil(radius * 4 / 4.6f), 1, 7));
+        cost.readRadius = static_cast<float>(radius);
+        cost.resolutionScale = static_cast<float>(
+            radius * 4 > 400 ? 0.0625f : (radius * 4 > 150 ? 0.125f : (radius * 4 > 50 ? 0.25f : 0.5f)));
+        cost.readsPerPixel = static_cast<float>(5);
+        return cost;
+    }
+};
+
+template<>
+struct GEEffectCostEstimator<GEMESABlurShaderFilterParams> {
+    static constexpr bool HAS_MODEL = true;
+    static constexpr GEEffectCost Estimate([[maybe_unused]] const GEMESABlurShaderFilterParams& params)
+    {
+        using namespace GEEffectCostMath;
+        const float radius = static_cast<float>(params.radius);
+        const float isDirection = static_cast<float>(params.isDirection);
+        GEEffectCost cost;
+        cost.passes =
+            static_cast<float>(radius < 8 ? Clamp(radius, 2, 4) + (radius >= 6 ? 1 : 0) : (radius < 17 ? 4 : 5));
+        cost.readRadius = static_cast<float>(radius);
+        cost.resolutionScale = static_cast<float>(
+            radius < 8 ? 0.5 : (radius < 20 ? 0.25 : (radius < 100 ? 0.125 : (radius < 200 ? 0.0625 : 0.03125))));
+        cost.readsPerPixel = static_cast<float>(isDirection ? 2 : 4);
+        return cost;
+    }
+};
+
+// Whether the params of filterType carry a cost model
+constexpr bool HasEffectCostModel(GEFilterType filterType)
+{
+    switch (filterType) {
+        case GEFilterType::GREY:
+        case GEFilterType::KAWASE_BLUR:
+        case GEFilterType::MESA_BLUR:
+            return true;
+        default:
+            return false;
+    }
+}
+
 // Type traits for accessing struct fields
 template<GEParamsMemberTag Tag>
 struct GEParamsFieldAccessor;
@@ -2188,6 +2266,7 @@ GE_PARAMS_FIELD_ACCESSOR(GEMESABlurShaderFilterParams, angle, MESA_BLUR_ANGLE, M
 GE_PARAMS_FIELD_ACCESSOR(GEMotionBlurShaderFilterParams, radius, MOTION_BLUR_RADIUS, MotionBlur_Radius);
 GE_PARAMS_FIELD_ACCESSOR(GEMotionBlurShaderFilterParams, anchor, MOTION_BLUR_ANCHOR, MotionBlur_Anchor);
 GE_PARAMS_FIELD_ACCESSOR(GEMotionBlurShaderFilterParams, sampleCount, MOTION_BLUR_SAMPLE_COUNT, MotionBlur_SampleCount);
+GE_PARAMS_FIELD_ACCESSOR(GEMotionBlurShaderFilterParams, mode, MOTION_BLUR_MODE, MotionBlur_Mode);
 GE_PARAMS_FIELD_ACCESSOR(
     GEParticleAblationFilterParams, progress_, PARTICLE_ABLATION_PROGRESS, ParticleAblation_Progress);
 GE_PARAMS_FIELD_ACCESSOR(
@@ -2434,6 +2513,8 @@ GE_PARAMS_FIELD_ACCESSOR(
     GEVariableRadiusBlurShaderFilterParams, blurRadius, VARIABLE_RADIUS_BLUR_BLUR_RADIUS, VariableRadiusBlur_Radius);
 GE_PARAMS_FIELD_ACCESSOR(GEVariableRadiusBlurShaderFilterParams, applyInsideMask,
     VARIABLE_RADIUS_BLUR_APPLY_INSIDE_MASK, VariableRadiusBlur_ApplyInsideMask);
+GE_PARAMS_FIELD_ACCESSOR(
+    GEVariableRadiusBlurShaderFilterParams, mode, VARIABLE_RADIUS_BLUR_MODE, VariableRadiusBlur_Mode);
 GE_PARAMS_FIELD_ACCESSOR(GEWaterDropletTransitionFilterParams, topLayer, WATER_DROPLET_TRANSITION_TOP_LAYER,
     WaterDropletTransition_TopLayer);
 GE_PARAMS_FIELD_ACCESSOR(
@@ -2696,7 +2777,7 @@ GE_PARAMS_FIELD_ACCESSOR(
 // Static helper class for params member tag operations
 class GEParamsMemberHelper {
 public:
-    // Convert GEParamsMemberTag to corresponding GEFilterType
+    // Convert GEParamsMemberTag to corresponding GEFilterType, one load from the generated member table
     static GEFilterType GetFilterTypeFromTag(GEParamsMemberTag tag);
 
     // Convert string to GEParamsMemberTag
@@ -2705,7 +2786,8 @@ public:
     static GEParamsMemberTag GEParamsMemberTagFromString(const std::string& str);
 
     // Set params member by tag using overloaded functions (reduces binary bloat)
-    // All implementations are in the .cpp file
+    // All implementations are in the .cpp file, the tag indexes a constexpr table holding the filter type,
+    // the accepted value kinds and their setters
     // Overloaded SetParamsMemberByTag for each unique parameter type
     static void SetParamsMemberByTag(GEFilterParams& params, GEParamsMemberTag tag, const DotMatrixDirection& value);
     static void SetParamsMemberByTag(GEFilterParams& params, GEParamsMemberTag tag, const DotMatrixEffectType& value);
@@ -310,6 +310,7 @@ constexpr char GE_FILTER_VARIABLE_RADIUS_BLUR[] = "VariableRadiusBlur";
 constexpr char GE_FILTER_VARIABLE_RADIUS_BLUR_RADIUS[] = "VariableRadiusBlur_Radius";
 constexpr char GE_FILTER_VARIABLE_RADIUS_BLUR_MASK[] = "VariableRadiusBlur_Mask";
 constexpr char GE_FILTER_VARIABLE_RADIUS_BLUR_APPLYINSIDEMASK[] = "VariableRadiusBlur_ApplyInsideMask";
+constexpr char GE_FILTER_VARIABLE_RADIUS_BLUR_MODE[] = "VariableRadiusBlur_Mode";
 constexpr char GE_MASK_LINEAR_GRADIENT[] = "MaskLinearGradient";
 constexpr char GE_MASK_LINEAR_GRADIENT_FRACTION_STOPS[] = "MaskLinearGradient_FractionStops";
 constexpr char GE_MASK_LINEAR_GRADIENT_START_POSITION[] = "MaskLinearGradient_StartPosition";
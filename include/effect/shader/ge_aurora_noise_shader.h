@@ -59,6 +59,7 @@ private:
     GEAuroraNoiseShader(const GEAuroraNoiseShader&&) = delete;
     GEAuroraNoiseShader& operator=(const GEAuroraNoiseShader&) = delete;
     GEAuroraNoiseShader& operator=(const GEAuroraNoiseShader&&) = delete;
+    bool IsNoiseImgReusable(const Drawing::ImageInfo& imageInfo) const;
 
     Drawing::GEAuroraNoiseShaderParams auroraNoiseParams_;
     std::shared_ptr<Drawing::RuntimeShaderBuilder> builder_;
@@ -15,12 +15,12 @@
 #ifndef GRAPHICS_EFFECT_CONTOUR_DIAGONAL_FLOW_LIGHT_SHADER_H
 #define GRAPHICS_EFFECT_CONTOUR_DIAGONAL_FLOW_LIGHT_SHADER_H
 
-#include <queue>
 #include "common/rs_vector4.h"
 #include "effect/runtime_shader_builder.h"
 #include "ge_filter_type_info.h"
 #include "ge_shader.h"
 #include "ge_shader_filter_params.h"
+#include "ge_spatial_binning.h"
 #include "utils/matrix.h"
 #include "ge_shader_filter_params.h"
 
@@ -32,7 +32,6 @@ using Box4f = std::array<float, box4fSize>;
 
 struct Grid {
     Box4f bbox;
-    std::vector<int> curveIndices;
 };
 
 class GEKawaseBlurShaderFilter;
@@ -71,17 +70,15 @@ private:
     std::shared_ptr<Drawing::RuntimeShaderBuilder> SdfMaskBuilder();
     Box4f ComputeCurveBoundingBox(size_t curveIndex, float maxThickness, int width, int height, float& approxLenPixels);
     void CreateSurfaceAndCanvas(Drawing::Canvas& canvas, const Drawing::Rect& rect);
+    bool IsCacheReusable(const Drawing::Rect& rect, uint32_t hash, float blurRadius,
+        const std::shared_ptr<Drawing::ColorSpace>& colorSpace) const;
     void PreCalculateRegion(Drawing::Canvas& mainCanvas, Drawing::Canvas& canvas, int gridIndex,
         const Drawing::Rect& wholeRect, const Drawing::Rect& rect);
     void AutoPartitionCal(Drawing::Canvas& canvas, const Drawing::Rect& rect);
     void AutoGridPartition(int width, int height, float maxThickness);
     void ComputeAllCurveBoundingBoxes(int width, int height, float maxThickness,
         Box4f& canvasBBox, std::vector<Box4f>& curveBBoxes);
-    void InitializeWorkQueue(const Box4f& canvasBBox, const std::vector<Box4f>& curveBBoxes,
-        std::queue<Grid>& workQueue);
-    void SplitGrid(const Grid& current, const std::vector<Box4f>& curveBBoxes,
-        std::queue<Grid>& workQueue, float minGridSize);
-    void ProcessFinalGrid(Grid& current, const std::vector<Box4f>& curveBBoxes, int height);
+    void ProcessFinalGrid(const Box4f& bbox, const uint32_t* curveIndices, uint32_t count, int height);
     std::shared_ptr<Drawing::Image> CreateImg(Drawing::Canvas& canvas, const Drawing::Rect& rect);
     std::shared_ptr<Drawing::Image> CreateDrawImg(Drawing::Canvas& canvas, const Drawing::Rect& rect,
         const Drawing::Brush& brush);
@@ -101,6 +98,7 @@ private:
     std::vector<float> controlPoints_{};
     size_t pointCnt_ = 0; // real input Point Cnt
 
+    GESpatialBinning binning_;
     // grid : curves, boundingbox(xmin, xmax, ymin, ymax)
     std::vector<std::pair<std::vector<float>, Grid>> curvesInGrid_{};
     std::vector<std::vector<float>> segmentIndex_{};
@@ -54,6 +54,7 @@ private:
         const Drawing::Rect& dst, Drawing::Matrix& outMatrix,
         std::shared_ptr<Drawing::RuntimeShaderBuilder>& outBuilder);
     std::shared_ptr<Drawing::ShaderEffect> MakeSDFNormalShader(Drawing::Canvas& canvas, float width, float height);
+    void SetFrostedGlassUniforms(Drawing::RuntimeShaderBuilder& builder, const Drawing::Rect& rect);
 
     bool IsValidParam(float width, float height);
     bool InitFrostedGlassEffect();
@@ -19,6 +19,7 @@
 #include <any>
 #include "draw/canvas.h"
 #include "utils/rect.h"
+#include "effect/runtime_shader_builder.h"
 #include "effect/shader_effect.h"
 #include "ge_common.h"
 #include "ge_shader_filter_params.h"
@@ -64,6 +65,12 @@ public:
         supportHeadroom_ = supportHeadroom;
     }
 
+    // Encoding of the SDF image cached by MakeSDFShaderWithCache, defaults to persist.sys.graphic.ge.sdfEncoding
+    void SetSDFImageEncoding(Drawing::GESDFImageEncoding encoding)
+    {
+        sdfImageEncoding_ = encoding;
+    }
+
 protected:
     virtual void Preprocess(Drawing::Canvas& canvas, const Drawing::Rect& rect) {}
 
@@ -84,13 +91,26 @@ protected:
     virtual std::shared_ptr<Drawing::ShaderEffect> MakeSDFShaderWithCache(
         std::shared_ptr<Drawing::GESDFShaderShape> sdfShape, Drawing::Canvas& canvas, const Drawing::Rect& rect,
         bool hasNormal = true) const;
+
+    /**
+     * @brief Get the shader builder stored by SetCachedShaderBuilder.
+     * @details The builder keeps the child shaders made from the input image and the SDF shape, so only the uniforms
+     *          need to be set again. It is returned when the image ID, shape hash and size all match; a shape hash of
+     *          0 means the shape is unknown and never matches.
+     */
+    std::shared_ptr<Drawing::RuntimeShaderBuilder> GetCachedShaderBuilder(uint32_t imageId, uint32_t shapeHash,
+        const Drawing::Rect& rect) const;
+    void SetCachedShaderBuilder(uint32_t imageId, uint32_t shapeHash, const Drawing::Rect& rect,
+        const std::shared_ptr<Drawing::RuntimeShaderBuilder>& builder) const;
     uint32_t hash_ = 0;
     Drawing::CanvasInfo canvasInfo_;
     float supportHeadroom_ = 0.0f;
+    Drawing::GESDFImageEncoding sdfImageEncoding_ = GetDefaultSDFImageEncoding();
     std::shared_ptr<Drawing::ShaderEffect> drShader_ = nullptr;
     mutable std::shared_ptr<std::any> cacheAnyPtr_ = nullptr;
 
 private:
+    static Drawing::GESDFImageEncoding GetDefaultSDFImageEncoding();
     bool TryDrawShaderWithPen(Drawing::Canvas& canvas, const Drawing::Rect& rect);
 };
 } // namespace Rosen
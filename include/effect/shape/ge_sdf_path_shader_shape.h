@@ -15,11 +15,11 @@
 #ifndef GRAPHICS_EFFECT_GE_SDF_PATH_SHADER_SHAPE_H
 #define GRAPHICS_EFFECT_GE_SDF_PATH_SHADER_SHAPE_H
 
-#include <queue>
 
 #include "ge_filter_type_info.h"
 #include "ge_sdf_shader_shape.h"
 #include "ge_shader_filter_params.h"
+#include "ge_spatial_binning.h"
 
 namespace OHOS {
 namespace Rosen {
@@ -32,7 +32,6 @@ using Box4f = std::array<float, BOX_4F_SIZE>;
 
 struct Grid {
     Box4f bbox;
-    std::vector<uint32_t> curveIndices;
 };
 } // namespace
 
@@ -89,7 +88,9 @@ private:
     std::shared_ptr<Image> RunJFAIterates(Canvas& canvas, std::shared_ptr<Image> seedTex, int width, int height);
     std::shared_ptr<Image> RunSDFPropagation(
         Canvas& canvas, std::shared_ptr<Image> sdfTex, std::shared_ptr<Image> maskTex, int width, int height);
-    std::shared_ptr<Image> ComputeDistanceField(Canvas& canvas, std::shared_ptr<Image> jfaTex, int width, int height);
+    // Last propagation step and normals in one pass, fieldTex may have a lower resolution than sdfTex
+    std::shared_ptr<Image> ComputeDistanceField(Canvas& canvas, std::shared_ptr<Image> sdfTex,
+        std::shared_ptr<Image> fieldTex, std::shared_ptr<Image> maskTex, int width, int height);
 
     std::shared_ptr<Image> GenerateSeedTexture(Canvas& canvas, int width, int height,
         const std::vector<std::vector<Vector2f>>& paramsCoef, std::shared_ptr<Image>& pathImage);
@@ -102,18 +103,15 @@ private:
     void ProcessSingleBatch(Drawing::RuntimeShaderBuilder& builder, size_t gridIndex, size_t batch,
     size_t start, size_t end, float vStart, float vEnd, std::shared_ptr<Drawing::Image>& prevSdf,
     std::shared_ptr<Drawing::ShaderEffect>& prevShader);
+    void ProcessPackedGrids(Drawing::RuntimeShaderBuilder& builder, const std::vector<size_t>& gridIndices);
 
     // ========== Quadtree grid partition ==========
     void AutoGridPartition(float width, float height, const std::vector<Vector2f>& pixelControlPoints);
-    void SplitGrid(
-        const Grid& current, const std::vector<Box4f>& curveBBoxes, std::queue<Grid>& workQueue, float minGridSize);
     void ComputeAllCurveBoundingBoxes(float width, float height, const std::vector<Vector2f>& pixelControlPoints,
         Box4f& canvasBBox, std::vector<Box4f>& curveBBoxes);
     std::array<float, 4> ComputeCurveBoundingBox(size_t curveIndex, float maxThickness,
         const std::vector<Vector2f>& pixelControlPoints, float width, float height);
-    void InitializeWorkQueue(
-        const Box4f& canvasBBox, const std::vector<Box4f>& curveBBoxes, std::queue<Grid>& workQueue);
-    void ProcessFinalGrid(Grid& current, const std::vector<Box4f>& curveBBoxes);
+    void ProcessFinalGrid(const Box4f& bbox, const uint32_t* curveIndices, uint32_t count);
     void UpdateNumPasses();
 
     // ========== Quadtree grid partition ==========
@@ -122,7 +120,7 @@ private:
     std::shared_ptr<Image> DrawPathToImage(Drawing::Canvas& canvas, int width, int height, const Drawing::Path& path);
 
     std::shared_ptr<Drawing::RuntimeShaderBuilder> MakePrecalcShaderBuilder();
-    std::shared_ptr<Drawing::RuntimeShaderBuilder> MakeNormalShaderBuilder();
+    std::shared_ptr<Drawing::RuntimeShaderBuilder> MakeFinalPassShaderBuilder();
     std::shared_ptr<Drawing::RuntimeShaderBuilder> MakeSdfPropShaderBuilder();
 
     void ClearTemp();
@@ -134,6 +132,7 @@ private:
     bool distanceCalc_ = true;
 
     // Grid partition data storage
+    GESpatialBinning binning_;
     std::vector<std::pair<std::vector<float>, Grid>> curvesInGrid_;
     std::vector<std::vector<float>> segmentIndex_;
     std::vector<float> controlPoints_;
@@ -16,6 +16,8 @@
 #ifndef GRAPHICS_EFFECT_GE_SDF_SHAPE_H
 #define GRAPHICS_EFFECT_GE_SDF_SHAPE_H
 
+#include <array>
+
 #include "ge_shader_shape.h"
 #include "common/rs_vector2.h"
 
@@ -38,6 +40,21 @@ enum class GESDFShapeType : uint8_t {
     MAX = SMOOTH_SUB_OP,
 };
 
+/**
+ * Storage of SDF images made by MakeSDFImage and kept in caches.
+ * FLOAT is RGBA F16 with the gradient in rg, the packed direction in b and the distance in a, 8 bytes per pixel.
+ * QUANTIZED is RGBA8, 4 bytes per pixel: the distance as 16-bit fixed point over [-SDF_QUANTIZED_RANGE,
+ * SDF_QUANTIZED_RANGE] in rg (high byte first) and the gradient angle in b. Its decode shader gives back the FLOAT
+ * layout with the packed direction set to 0. Distances in range are off by at most SDF_QUANTIZED_RANGE / 65535
+ * (0.004 px), farther ones are clamped, and the gradient angle is off by at most PI / 255 (0.71 degrees).
+ * QUANTIZED images must be sampled with nearest filtering at the size they were made, the bytes of the distance
+ * cannot be interpolated.
+ */
+enum class GESDFImageEncoding : uint8_t {
+    FLOAT = 0,
+    QUANTIZED,
+};
+
 class GE_EXPORT GESDFShaderShape : public GEShaderShape {
 public:
     GESDFShaderShape() = default;
@@ -56,7 +73,17 @@ public:
     void CopyState(const GESDFShaderShape& shape);
     virtual bool GetInscribedRect(Rect& rect) override {return false;}
     virtual std::shared_ptr<Drawing::Image> MakeSDFImage(Canvas& canvas, float width, float height,
-        bool hasNormal = true);
+        bool hasNormal = true, GESDFImageEncoding encoding = GESDFImageEncoding::FLOAT);
+
+    // Shader reading an image made by MakeSDFImage, in the FLOAT layout whatever the encoding
+    static std::shared_ptr<ShaderEffect> MakeSDFImageShader(const std::shared_ptr<Drawing::Image>& sdfImage,
+        GESDFImageEncoding encoding);
+
+    // CPU versions of the QUANTIZED encode and decode shaders, the texel holds r, g, b, a bytes
+    static std::array<uint8_t, 4> EncodeQuantizedSDF(float distance, float gradX, float gradY);
+    static void DecodeQuantizedSDF(const std::array<uint8_t, 4>& texel, float& distance, float& gradX, float& gradY);
+
+    static constexpr float SDF_QUANTIZED_RANGE = 256.0f; // Largest distance in pixels kept by QUANTIZED images
 };
 } // Drawing
 } // namespace Rosen
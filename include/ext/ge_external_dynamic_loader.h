@@ -17,10 +17,21 @@
 
 #include "ge_common.h"
 
+#include <atomic>
 #include <cstdint>
+#include <memory>
+#include <mutex>
 
 namespace OHOS {
 namespace Rosen {
+/**
+ * Loader of the graphics effect extension library.
+ *
+ * The library is opened on first use, or ahead of time by Preload / PreloadAsync during service startup so that the
+ * first external effect does not pay for dlopen inside a frame.
+ *
+ * CreateGEXObject wraps CreateGEXObjectByType with typed params and result.
+ */
 class GEExternalDynamicLoader {
 public:
     GEExternalDynamicLoader(const GEExternalDynamicLoader&) = delete;
@@ -29,20 +40,43 @@ public:
 
     static GE_EXPORT GEExternalDynamicLoader& GetInstance();
 
+    // Opens the library and resolves its entry points now, once per process
+    GE_EXPORT void Preload();
+    // Same as Preload on a background thread, creations issued meanwhile wait for it
+    GE_EXPORT void PreloadAsync();
+    GE_EXPORT bool IsLoaded() const;
+
     GE_EXPORT void* CreateGEXObjectByType(uint32_t type, uint32_t len, void* param);
 
     GE_EXPORT bool DestroyGEXObject(void* obj);
 
+    template<typename T, typename ParamType>
+    std::shared_ptr<T> CreateGEXObject(uint32_t type, const ParamType& params);
+
 private:
     using CreateGEXObjectByTypeFunc = void* (*)(uint32_t, uint32_t, void*);
     using DestroyGEXObjectFunc = void (*)(void*);
 
     GEExternalDynamicLoader();
 
+    void Load();
+
+    std::once_flag loadOnce_;
+    std::atomic<bool> loaded_ { false };
     void* libHandle_ = nullptr;
     CreateGEXObjectByTypeFunc createObjectFunc_ = nullptr;
     DestroyGEXObjectFunc destroyObjectFunc_ = nullptr;
 };
+
+template<typename T, typename ParamType>
+std::shared_ptr<T> GEExternalDynamicLoader::CreateGEXObject(uint32_t type, const ParamType& params)
+{
+    void* object = CreateGEXObjectByType(type, sizeof(ParamType), const_cast<ParamType*>(&params));
+    if (object == nullptr) {
+        return nullptr;
+    }
+    return std::shared_ptr<T>(static_cast<T*>(object));
+}
 } // namespace Rosen
 } // namespace OHOS
 
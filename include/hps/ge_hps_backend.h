@@ -0,0 +1,81 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef GRAPHICS_EFFECT_GE_HPS_BACKEND_H
+#define GRAPHICS_EFFECT_GE_HPS_BACKEND_H
+
+#include <array>
+#include <memory>
+#include <vector>
+
+#include "draw/canvas.h"
+#include "image/image.h"
+
+#include "ge_common.h"
+
+namespace OHOS {
+namespace Rosen {
+/**
+ * @class IGEHpsBackend
+ * @brief Executor of the HpsEffectParameter lists built by HpsEffectFilter.
+ *
+ * HpsEffectFilter only decides which effects are composed and on which offscreen surface they are rendered. The
+ * backend reports the supported HPS extensions and renders the parameters. GEHpsDeviceBackend forwards to the vendor
+ * extension of the GPU context, GEHpsCpuBackend is a CPU reference used to run the HPS pipeline on hosts without it.
+ */
+class GE_EXPORT IGEHpsBackend {
+public:
+    virtual ~IGEHpsBackend() = default;
+
+    virtual const char* GetName() const = 0;
+
+    // Whether HPS composition is enabled at all, checked before querying any extension
+    virtual bool IsEnabled() const = 0;
+
+    /**
+     * @brief Fill extensions with the supported extension names, e.g. "hps_gaussian_blur_effect".
+     * @return False if the extensions cannot be queried yet and the query should be retried later.
+     */
+    virtual bool QueryExtensions(Drawing::Canvas& canvas, std::vector<const char*>& extensions) = 0;
+
+    // Size of the offscreen surface a downscaled blur is rendered to
+    virtual std::array<int, 2> CalcBlurredImageDimension(Drawing::Canvas& canvas,
+        const Drawing::HpsBlurParameter& params) = 0;
+
+    // Render image with effects on offscreenCanvas, the dst of the parameters is the target rect
+    virtual bool DrawImageEffect(Drawing::Canvas& offscreenCanvas, const Drawing::Image& image,
+        std::vector<std::shared_ptr<Drawing::HpsEffectParameter>>& effects) = 0;
+};
+
+class GE_EXPORT GEHpsDeviceBackend : public IGEHpsBackend {
+public:
+    GEHpsDeviceBackend() = default;
+    ~GEHpsDeviceBackend() override = default;
+
+    const char* GetName() const override
+    {
+        return "GEHpsDeviceBackend";
+    }
+
+    bool IsEnabled() const override;
+    bool QueryExtensions(Drawing::Canvas& canvas, std::vector<const char*>& extensions) override;
+    std::array<int, 2> CalcBlurredImageDimension(Drawing::Canvas& canvas,
+        const Drawing::HpsBlurParameter& params) override;
+    bool DrawImageEffect(Drawing::Canvas& offscreenCanvas, const Drawing::Image& image,
+        std::vector<std::shared_ptr<Drawing::HpsEffectParameter>>& effects) override;
+};
+} // namespace Rosen
+} // namespace OHOS
+#endif // GRAPHICS_EFFECT_GE_HPS_BACKEND_H
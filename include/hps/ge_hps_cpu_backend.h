@@ -0,0 +1,86 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef GRAPHICS_EFFECT_GE_HPS_CPU_BACKEND_H
+#define GRAPHICS_EFFECT_GE_HPS_CPU_BACKEND_H
+
+#include <vector>
+
+#include "ge_hps_backend.h"
+
+namespace OHOS {
+namespace Rosen {
+/**
+ * @class GEHpsCpuBackend
+ * @brief CPU reference implementation of the HPS effects, for hosts without the vendor extension.
+ *
+ * Supports BLUR, MESA, GREY and AIBAR parameters, the other effect types are not reported as supported so
+ * HpsEffectFilter keeps them on the GE path. Pixels are processed in premultiplied RGBA like the GE shaders, blur is
+ * a separable gaussian evaluated at the resolution of the parameter dst. The output is a reference for tests and for
+ * benchmarking composition decisions, it is not tuned for production use.
+ *
+ * Install with `HpsEffectFilter::SetBackend(std::make_shared<GEHpsCpuBackend>())`.
+ */
+class GE_EXPORT GEHpsCpuBackend : public IGEHpsBackend {
+public:
+    // Premultiplied RGBA in [0, 1], row-major
+    struct PixelBuffer {
+        int width = 0;
+        int height = 0;
+        std::vector<float> rgba;
+
+        float* At(int x, int y)
+        {
+            return &rgba[(static_cast<size_t>(y) * width + x) * CHANNELS];
+        }
+    };
+    static constexpr int CHANNELS = 4;
+
+    GEHpsCpuBackend() = default;
+    ~GEHpsCpuBackend() override = default;
+
+    const char* GetName() const override
+    {
+        return "GEHpsCpuBackend";
+    }
+
+    bool IsEnabled() const override
+    {
+        return true;
+    }
+
+    bool QueryExtensions(Drawing::Canvas& canvas, std::vector<const char*>& extensions) override;
+    std::array<int, 2> CalcBlurredImageDimension(Drawing::Canvas& canvas,
+        const Drawing::HpsBlurParameter& params) override;
+    bool DrawImageEffect(Drawing::Canvas& offscreenCanvas, const Drawing::Image& image,
+        std::vector<std::shared_ptr<Drawing::HpsEffectParameter>>& effects) override;
+
+    // Reference kernels, exposed for tests
+    static void GaussianBlur(PixelBuffer& buffer, float sigma);
+    static void AdjustSaturationBrightness(PixelBuffer& buffer, float saturation, float brightness);
+    static void GreyAdjust(PixelBuffer& buffer, float coef1, float coef2);
+    static void AIBar(PixelBuffer& buffer, float low, float high, float threshold, float opacity, float saturation);
+
+    // Downscale ratio of a blur with the given sigma, matching the surface size of CalcBlurredImageDimension
+    static float GetBlurScale(float sigma);
+
+private:
+    static bool ApplyEffect(const Drawing::HpsEffectParameter& effect, float scale, PixelBuffer& buffer);
+    static bool ReadRegion(const Drawing::Image& image, const Drawing::Rect& src, PixelBuffer& buffer);
+    static std::shared_ptr<Drawing::Image> MakeImage(const PixelBuffer& buffer);
+};
+} // namespace Rosen
+} // namespace OHOS
+#endif // GRAPHICS_EFFECT_GE_HPS_CPU_BACKEND_H
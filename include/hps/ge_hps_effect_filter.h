@@ -25,6 +25,7 @@
 #include "utils/matrix.h"
 #include "utils/rect.h"
 
+#include "ge_hps_backend.h"
 #include "ge_shader_filter.h"
 #include "ge_shader_filter_params.h"
 #include "ge_visual_effect.h"
@@ -67,6 +68,10 @@ public:
     static bool IsMaskParameterChanged(
         const std::shared_ptr<Drawing::HpsMaskParameter>& pL, const std::shared_ptr<Drawing::HpsMaskParameter>& pR);
 
+    // Install the backend used by filters created afterwards, nullptr restores GEHpsDeviceBackend
+    static void SetBackend(const std::shared_ptr<IGEHpsBackend>& backend);
+    static std::shared_ptr<IGEHpsBackend> GetBackend();
+
 private:
     constexpr static size_t ARRAY_SIZE_DIMENSION = 2;
 
@@ -74,6 +79,7 @@ private:
     bool needClampFilter_ {true};
     bool needUpscale_ { false };
     Drawing::Rect originDst_ {};
+    std::shared_ptr<IGEHpsBackend> backend_ = GetBackend();
 
     std::shared_ptr<Drawing::HpsEffectParameter> GenerateMesaBlurEffect(
         const Drawing::GEMESABlurShaderFilterParams& params, const Drawing::Rect& src, const Drawing::Rect& dst,
@@ -0,0 +1,68 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef GRAPHICS_EFFECT_GE_EFFECT_COST_MODEL_H
+#define GRAPHICS_EFFECT_GE_EFFECT_COST_MODEL_H
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+
+#include "ge_common.h"
+#include "ge_filter_type.h"
+
+namespace OHOS {
+namespace Rosen {
+/**
+ * @class GEEffectCostModel
+ * @brief Per effect type cost estimates learned from previous executions, used by GERender deadline scheduling.
+ *
+ * Every filter executed by GERender reports its measured cost; the estimate is a moving average weighted 1/4 on the
+ * latest sample. Estimates are process-wide since GERender instances are usually short-lived. Updates from several
+ * threads may race and drop a sample, which only delays convergence.
+ *
+ * Types whose params carry a [[ge::cost(...)]] model also learn a cost per texel read, so the estimate of an
+ * invocation follows its params and size instead of the average of all previous invocations.
+ */
+class GE_EXPORT GEEffectCostModel {
+public:
+    static GEEffectCostModel& GetInstance();
+
+    // Monotonic clock used for costs and deadlines, in nanoseconds
+    static uint64_t NowNs();
+
+    // 0 while the type has never been measured
+    uint64_t GetEstimateNs(Drawing::GEFilterType type) const;
+    void Report(Drawing::GEFilterType type, uint64_t costNs);
+    void Reset();
+
+    // Estimate for an invocation predicted to read texelReads texels, the per type estimate while the type has no
+    // learned cost per texel read or texelReads is 0
+    uint64_t GetEstimateNs(Drawing::GEFilterType type, float texelReads) const;
+    // Report with the texel reads predicted for the measured invocation, 0 when unknown
+    void Report(Drawing::GEFilterType type, uint64_t costNs, float texelReads);
+
+private:
+    GEEffectCostModel() = default;
+    ~GEEffectCostModel() = default;
+
+    static constexpr size_t MAX_TYPES = static_cast<size_t>(Drawing::GEFilterType::MAX);
+    std::array<std::atomic<uint64_t>, MAX_TYPES> estimatesNs_ {};
+    std::array<std::atomic<uint64_t>, MAX_TYPES> picosPerTexelRead_ {};
+};
+} // namespace Rosen
+} // namespace OHOS
+
+#endif // GRAPHICS_EFFECT_GE_EFFECT_COST_MODEL_H
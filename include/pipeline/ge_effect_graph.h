@@ -0,0 +1,152 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef GRAPHICS_EFFECT_GE_EFFECT_GRAPH_H
+#define GRAPHICS_EFFECT_GE_EFFECT_GRAPH_H
+
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "ge_common.h"
+#include "ge_params_reflection.h"
+#include "ge_visual_effect.h"
+
+namespace OHOS {
+namespace Rosen {
+/**
+ * @class GEEffectGraph
+ * @brief Directed acyclic graph of visual effects with shared intermediate results.
+ *
+ * Unlike the linear chain of @ref Drawing::GEVisualEffectContainer, every node of the graph takes one primary input
+ * (the image passed to GEShaderFilter::ProcessImage) and any number of named inputs. A named input is bound to an
+ * image-typed param of the node's effect, e.g. `FROSTED_GLASS_EFFECT_BLUR_IMAGE`, so the output of one node can fan
+ * out to several consumers and is computed only once per evaluation.
+ *
+ * Node outputs may also be exported to effects that are not part of the graph (typically GEShader effects drawn
+ * afterwards with GERender::DrawShaderEffect), which replaces precomputing those images outside GE.
+ *
+ * The graph itself only describes topology. @ref BuildSchedule computes the execution order and the point after which
+ * each intermediate image can be released; GERender::ApplyEffectGraph executes it.
+ *
+ * Usage typically involves:
+ * 1. `auto blur = graph.AddNode(kawaseBlur);` consumes the source image.
+ * 2. `auto glass = graph.AddNode(glassFilter, blur);` and `graph.AddInput(glass, GEEffectGraph::SOURCE, tag);`
+ * 3. `graph.SetOutput(glass);`
+ * 4. `geRender->ApplyEffectGraph(canvas, graph, context);`
+ */
+class GE_EXPORT GEEffectGraph {
+public:
+    using NodeId = uint32_t;
+    // The image the graph is evaluated on, e.g. the background snapshot. Always present, never executed.
+    static constexpr NodeId SOURCE = 0;
+    static constexpr NodeId INVALID_NODE = std::numeric_limits<NodeId>::max();
+
+    struct NamedInput {
+        NodeId from = INVALID_NODE;
+        Drawing::GEParamsMemberTag tag = Drawing::GEParamsMemberTag::INVALID;
+    };
+
+    struct Export {
+        std::shared_ptr<Drawing::GEVisualEffect> consumer = nullptr;
+        Drawing::GEParamsMemberTag tag = Drawing::GEParamsMemberTag::INVALID;
+    };
+
+    struct Node {
+        std::shared_ptr<Drawing::GEVisualEffect> effect = nullptr;
+        NodeId primaryInput = SOURCE;
+        std::vector<NamedInput> namedInputs;
+        std::vector<Export> exports;
+    };
+
+    struct Schedule {
+        // Execution order of the nodes contributing to the output or to an export, SOURCE excluded.
+        std::vector<NodeId> order;
+        // releaseAfter[i] lists the nodes whose result is no longer needed once order[i] has been executed.
+        std::vector<std::vector<NodeId>> releaseAfter;
+        // Maximum number of intermediate images alive at the same time while executing the schedule.
+        size_t peakLiveIntermediates = 0;
+    };
+
+    GEEffectGraph();
+    ~GEEffectGraph() = default;
+
+    /**
+     * @brief Add an effect node consuming the result of primaryInput.
+     * @return Id of the new node, or INVALID_NODE if the effect is null or primaryInput does not exist.
+     */
+    NodeId AddNode(const std::shared_ptr<Drawing::GEVisualEffect>& effect, NodeId primaryInput = SOURCE);
+
+    /**
+     * @brief Bind the result of node `from` to the image param `tag` of node `node`.
+     * @return False if either node does not exist or the tag does not belong to the effect type of `node`.
+     */
+    bool AddInput(NodeId node, NodeId from, Drawing::GEParamsMemberTag tag);
+    bool AddInput(NodeId node, NodeId from, const std::string& tagName);
+
+    /**
+     * @brief Bind the result of node `from` to the image param `tag` of an effect outside the graph.
+     * @note Effect params only keep weak references to images, the caller must retain
+     *       ApplyEffectGraphResult::exportedImages until the consumer has been drawn.
+     */
+    bool ExportTo(NodeId from, const std::shared_ptr<Drawing::GEVisualEffect>& consumer,
+        Drawing::GEParamsMemberTag tag);
+
+    bool SetOutput(NodeId node);
+
+    NodeId GetOutput() const
+    {
+        return output_;
+    }
+
+    const Node* GetNode(NodeId node) const;
+
+    // Number of effect nodes, SOURCE excluded
+    size_t GetNodeCount() const
+    {
+        return nodes_.size() - 1;
+    }
+
+    /**
+     * @brief Compute the execution order and release points of the graph.
+     *
+     * Nodes that neither reach the output nor any export are pruned. Ties are broken by insertion order so that a
+     * graph built from a linear chain executes exactly like GERender::ApplyImageEffect.
+     * @return std::nullopt if the graph contains a cycle or has neither output nor exports.
+     */
+    std::optional<Schedule> BuildSchedule() const;
+
+    // Build a graph equivalent to a linear filter chain, the last effect being the output.
+    static GEEffectGraph FromChain(const std::vector<std::shared_ptr<Drawing::GEVisualEffect>>& effects);
+
+private:
+    bool IsValidNode(NodeId node) const
+    {
+        return node < nodes_.size();
+    }
+
+    static bool IsTagOfEffect(const std::shared_ptr<Drawing::GEVisualEffect>& effect, Drawing::GEParamsMemberTag tag);
+    std::vector<bool> CollectLiveNodes() const;
+
+    std::vector<Node> nodes_;
+    NodeId output_ = INVALID_NODE;
+};
+} // namespace Rosen
+} // namespace OHOS
+
+#endif // GRAPHICS_EFFECT_GE_EFFECT_GRAPH_H
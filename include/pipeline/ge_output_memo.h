@@ -0,0 +1,107 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef GRAPHICS_EFFECT_GE_OUTPUT_MEMO_H
+#define GRAPHICS_EFFECT_GE_OUTPUT_MEMO_H
+
+#include <cstddef>
+#include <cstdint>
+#include <list>
+#include <memory>
+#include <unordered_map>
+
+#include "image/image.h"
+#include "utils/rect.h"
+
+#include "ge_common.h"
+
+namespace OHOS {
+namespace Rosen {
+/**
+ * @class GEOutputMemo
+ * @brief Outputs of previous GERender filter invocations, returned again when an invocation repeats exactly.
+ *
+ * An invocation is identified by its position in the chain, the unique id of its input image, the content hash of
+ * the effect (type, params, canvas info and quality level), the src/dst rects and the headroom. Static backgrounds
+ * under a blur then cost one lookup per frame instead of the whole filter.
+ *
+ * Only effect types registered with GE_FACTORY_MEMO_OPTIONS are memoized, and never when their canvas info disables
+ * filter caching. Types whose output depends on the canvas matrix add it to the content hash.
+ *
+ * Outputs are kept in LRU order within a byte budget, estimated from their size and bytes per pixel. GPU outputs
+ * belong to the context of the rendering thread, so each thread keeps its own memo, like GEEdgeLightImageCache. The
+ * render service calls Clear on the rendering thread before its GPU context is torn down and on memory trim.
+ * GERender bypasses the memo while GEFeatureFlag::OUTPUT_MEMO is disabled, the default.
+ */
+class GE_EXPORT GEOutputMemo {
+public:
+    static constexpr size_t DEFAULT_BUDGET_BYTES = 32 * 1024 * 1024; // 32 MiB, a few full screen layers
+
+    struct Key {
+        uint32_t position = 0;
+        uint32_t inputImageId = 0;
+        uint64_t contentHash = 0;
+        Drawing::Rect src {};
+        Drawing::Rect dst {};
+        float headroom = 0.0f;
+        bool isRaster = false; // Raster and GPU outputs never substitute for each other
+
+        bool operator==(const Key& other) const;
+    };
+
+    // Memo of the calling thread
+    static GEOutputMemo& GetInstance();
+
+    // nullptr when key has not been stored or was evicted
+    std::shared_ptr<Drawing::Image> Find(const Key& key);
+    // Outputs larger than the budget are not stored
+    void Store(const Key& key, const std::shared_ptr<Drawing::Image>& output);
+
+    void SetBudget(size_t budgetBytes);
+    size_t GetBudget() const;
+    size_t GetUsedBytes() const;
+    size_t GetEntryCount() const;
+    // Releases every output, required before the GPU context of the thread goes away
+    void Clear();
+
+    // Size of the pixels of image, 0 for nullptr
+    static size_t EstimateBytes(const std::shared_ptr<Drawing::Image>& image);
+
+private:
+    GEOutputMemo() = default;
+    ~GEOutputMemo() = default;
+
+    struct KeyHash {
+        size_t operator()(const Key& key) const;
+    };
+
+    struct Entry {
+        Key key;
+        std::shared_ptr<Drawing::Image> output;
+        size_t bytes = 0;
+    };
+
+    void Evict(size_t budgetBytes);
+
+    size_t budgetBytes_ = DEFAULT_BUDGET_BYTES;
+    size_t usedBytes_ = 0;
+    // Most recently used first
+    std::list<Entry> entries_;
+    std::unordered_map<Key, std::list<Entry>::iterator, KeyHash> index_;
+};
+} // namespace Rosen
+} // namespace OHOS
+
+#endif // GRAPHICS_EFFECT_GE_OUTPUT_MEMO_H
@@ -18,6 +18,10 @@
 
 #include <atomic>
 #include <memory>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+#include <vector>
 
 #include "ge_cache_provider.h"
 #include "draw/brush.h"
@@ -26,6 +30,7 @@
 #include "effect/color_filter.h"
 #include "effect/runtime_effect.h"
 #include "effect/runtime_shader_builder.h"
+#include "ge_effect_graph.h"
 #include "ge_filter_composer_pass.h"
 #include "ge_hps_effect_filter.h"
 #include "ge_shader.h"
@@ -39,6 +44,23 @@ namespace GraphicsEffectEngine {
 
 using namespace Rosen;
 
+/**
+ * @class GERender
+ * @brief Entry point applying GEVisualEffectContainer / GEEffectGraph to images and canvases.
+ *
+ * Concurrency contract:
+ * - A GERender instance holds no per-invocation state besides the legacy outputs below, so one instance may be
+ *   shared by several render threads as long as each thread works on its own canvas. Outputs of an invocation (see
+ *   InvocationOutputs) are returned in the result structs instead of being kept in members.
+ * - The visual effects, containers and graphs passed in are NOT synchronized: the caches of GEVisualEffectImpl are
+ *   read and written back during an invocation, so an effect must not be applied by two threads at the same time.
+ * - Static configuration (IsMesablurAllEnabled) is initialized from system properties once. It may only be latched
+ *   from false to true by SetMesablurAllEnabledByCCM, so concurrent readers observe a monotonic value.
+ * - IsNeedExpansionFilter / GetExpansionRect are kept for legacy callers and only report the invocations issued by
+ *   the calling thread on this instance.
+ * - Outputs of ApplyImageEffect / ApplyEffectGraph filters are memoized by the GEOutputMemo of the calling thread,
+ *   so no output is shared between threads.
+ */
 class GE_EXPORT GERender {
 public:
     GERender();
@@ -54,7 +76,37 @@ public:
         Drawing::Rect src {};
         Drawing::Rect dst {};
         IGECacheProvider* geCacheProvider {};
+        // GEEffectCostModel::NowNs() time by which the effects should be done, 0 disables deadline scheduling
+        uint64_t deadlineNs {};
+        // Headroom the effect tone-maps its output to when it draws on canvas, only set for the last effect
+        float outputToneMappingHeadroom {};
+    };
+
+    // Deadline scheduling decision for one effect, see GEEffectFactory::DegradeOption
+    enum class EffectDecision : uint8_t {
+        EXECUTED,       // Full effect, also used when the effect declares no degradation option
+        REUSED_OUTPUT,  // Output of the last full execution on the same src
+        SKIPPED,        // Input passed through unchanged
+        MEMOIZED,       // Output of an identical earlier invocation, see GEOutputMemo
+    };
+
+    struct EffectScheduleRecord {
+        Drawing::GEFilterType type = Drawing::GEFilterType::NONE;
+        EffectDecision decision = EffectDecision::EXECUTED;
+        uint64_t estimatedCostNs = 0; // 0 if the type had never been measured or the output was memoized
+    };
+
+    // Outputs of a single invocation, consumed by the caller after applying the effects
+    struct InvocationOutputs {
+        // GASIFY or PARTICLE_ABLATION has been applied, the result must be drawn in expansionRect
+        bool needExpansionFilter = false;
+        Drawing::Rect expansionRect {};
+        // One record per GE filter in execution order, only filled when the context has a deadline
+        std::vector<EffectScheduleRecord> scheduleRecords {};
+        // The output drawn on canvas is already tone-mapped to GEVisualEffectContainer::GetOutputToneMappingHeadroom
+        bool outputToneMapped = false;
     };
+
     /**
      * @brief Applies a sequence of visual effects to an image using the GE (Graphics Effect) pipeline.
      *
@@ -62,7 +114,8 @@ public:
      * and applies them sequentially to an input image. Each effect is applied via GEShaderFilter,
      * with the output of one effect serving as the input to the next. It leverages
      * the GEShaderFilter mechanism to handle rendering, with proper cache management and
-     * compatibility handling for legacy use cases.
+     * compatibility handling for legacy use cases. Runs of adjacent filters merged by GEShaderCompositionPass
+     * are drawn in a single pass, without an intermediate image per filter.
      *
      * @note The function assumes the input image is valid and non-null. If any effect fails
      *       to generate a valid shader or filter, the process continues but may result in
@@ -84,6 +137,41 @@ public:
         Drawing::GEVisualEffectContainer& veContainer, const ShaderFilterEffectContext& context,
         const Drawing::SamplingOptions& sampling);
 
+    struct ApplyImageEffectResult {
+        std::shared_ptr<Drawing::Image> image {};
+        InvocationOutputs outputs {};
+    };
+
+    // Same as ApplyImageEffect, also returning the outputs of this invocation. Preferred when sharing the instance.
+    ApplyImageEffectResult ApplyImageEffectWithResult(Drawing::Canvas& canvas,
+        Drawing::GEVisualEffectContainer& veContainer, const ShaderFilterEffectContext& context,
+        const Drawing::SamplingOptions& sampling);
+
+    struct ApplyEffectGraphResult {
+        std::shared_ptr<Drawing::Image> image {}; // Result of the output node, nullptr if the graph has no output
+        // Images bound to effects outside the graph by GEEffectGraph::ExportTo. Effect params only keep weak
+        // references, so keep this alive until the consumers have been drawn.
+        std::vector<std::shared_ptr<Drawing::Image>> exportedImages {};
+        size_t executedNodes = 0;
+        InvocationOutputs outputs {};
+    };
+
+    /**
+     * @brief Evaluates a GEEffectGraph on an image.
+     *
+     * Each live node is executed once through GEShaderFilter, in the order computed by GEEffectGraph::BuildSchedule.
+     * Named inputs are bound to the image params of the consuming effect right before it runs, and every
+     * intermediate image is released as soon as its last consumer has been executed.
+     *
+     * @param canvas Reference to the Drawing::Canvas used for rendering context.
+     * @param graph The effect graph to evaluate.
+     * @param context Rendering context, `context.image` is the SOURCE node of the graph.
+     * @return ApplyEffectGraphResult with the output image and the exported images.
+     *         `image` is nullptr if the input image is null or the graph is invalid.
+     */
+    ApplyEffectGraphResult ApplyEffectGraph(Drawing::Canvas& canvas, const GEEffectGraph& graph,
+        const ShaderFilterEffectContext& context);
+
     struct HpsGEImageEffectContext {
         std::shared_ptr<Drawing::Image> image {};
         Drawing::Rect src {};
@@ -95,6 +183,7 @@ public:
         float saturationForHPS {};
         float brightnessForHPS {};
         IGECacheProvider* geCacheProvider {};
+        uint64_t deadlineNs {}; // Applies to the GE effects, see ShaderFilterEffectContext
     };
 
     /**
@@ -119,6 +208,7 @@ public:
     struct ApplyHpsGEResult {
         bool hasDrawnOnCanvas;
         bool isHpsBlurApplied;
+        InvocationOutputs outputs {};
         static ApplyHpsGEResult CanvasNotDrawnAndHpsNotApplied()
         {
             return { false, false };
@@ -133,12 +223,15 @@ public:
      * input image, leveraging a specialized rendering pipeline that includes HPS-specific passes for optimized
      * performance. It supports:
      * - HPS effects via GEHpsBuildPass.
+     * - Single-pass runs of adjacent per-pixel filters via GEShaderCompositionPass, once another pass has changed the
+     *   chain. Chains only composition would change are not applied, the caller falls back to ApplyImageEffect.
      * - Direct drawing on canvas when allowed.
      * - Compatibility fallbacks for legacy behavior.
      *
      * The function processes each visual effect in sequence, using a filter composer to manage the rendering pipeline.
      * It returns whether the final output was drawn directly on the canvas and whether an HPS blur was successfully
-     * applied.
+     * applied. When the container sets an output tone mapping headroom, the last effect drawing on canvas fuses the
+     * tone mapping into its shader and reports it in `outputs.outputToneMapped`.
      *
      * @see GEFilterComposer for the underlying pipeline composition mechanism.
      * @see GEHpsBuildPass for the HPS composition mechanism
@@ -158,16 +251,15 @@ public:
     ApplyHpsGEResult ApplyHpsGEImageEffect(Drawing::Canvas& canvas, Drawing::GEVisualEffectContainer& veContainer,
         const HpsGEImageEffectContext& context, std::shared_ptr<Drawing::Image>& outImage, Drawing::Brush& brush);
 
+    // Legacy accessors of InvocationOutputs, see the concurrency contract above. Read-and-reset per thread.
     bool IsNeedExpansionFilter();
     bool IsFrostedGlassFilter(Drawing::GEVisualEffectContainer& veContainer);
 
-    Drawing::Rect GetExpansionRect()
-    {
-        return expansionRect_;
-    }
+    Drawing::Rect GetExpansionRect() const;
 
+    // Only latches the config from false to true, false is ignored
     static void SetMesablurAllEnabledByCCM(bool flag);
-    static bool IsMesablurAllEnabled() { return isMesablurAllEnable_.load(); }
+    static bool IsMesablurAllEnabled() { return isMesablurAllEnable_.load(std::memory_order_acquire); }
 
 private:
     // Return type of ProcessShaderFilter() and DrawShaderFilter() indicates the applied target for visualEffect.
@@ -192,13 +284,52 @@ private:
      * @return True if the process is successful
      */
     bool AfterApplyShaderFilter(Drawing::Canvas& canvas, const Drawing::GEVisualEffect& visualEffect,
-        const ShaderFilterEffectContext& context, const GEShaderFilter& geShaderFilter);
+        const ShaderFilterEffectContext& context, const GEShaderFilter& geShaderFilter, InvocationOutputs& outputs);
+
+    /**
+     * @brief Deadline scheduling of one filter before it runs.
+     * Compares the learned cost of the effect type with the time left before `context.deadlineNs` and falls back to
+     * the degradation options declared at factory registration when it does not fit. Types never measured run.
+     * @return True if the effect must be executed, otherwise `image` holds the degraded result.
+     */
+    bool ScheduleShaderFilter(const std::shared_ptr<Drawing::GEVisualEffect>& visualEffect,
+        std::shared_ptr<Drawing::Image>& image, const ShaderFilterEffectContext& context, InvocationOutputs& outputs);
 
     // Internal helper for dispatching between ProcessShaderFilter and DrawShaderFilter.
     // Used in ApplyHpsGEImageEffect only.
     ApplyShaderFilterTarget DispatchGEShaderFilter(Drawing::Canvas& canvas, Drawing::Brush& brush,
         GEFilterComposable& composable, std::shared_ptr<Drawing::GEVisualEffect>& visualEffect,
-        ShaderFilterEffectContext& geContext);
+        ShaderFilterEffectContext& geContext, InvocationOutputs& outputs);
+
+    /**
+     * @brief ProcessShaderFilter behind GEOutputMemo, for the filter at `position` of a chain or graph.
+     * When an identical invocation has been memoized its output replaces `image` without running the filter,
+     * otherwise the filter is scheduled and processed as usual and its output memoized.
+     */
+    void ProcessMemoizedShaderFilter(Drawing::Canvas& canvas,
+        const std::shared_ptr<Drawing::GEVisualEffect>& visualEffect, uint32_t position,
+        std::shared_ptr<Drawing::Image>& image, const ShaderFilterEffectContext& context, InvocationOutputs& outputs);
+
+    /**
+     * @brief Apply a run of GEShaderCompositionPass on `image` in a single pass.
+     * The shaders of GEShaderFilter::MakeComposableShader are nested into each other and drawn into one image.
+     * Runs are not composed under a deadline, which schedules every filter on its own.
+     * @return False when a filter of the run cannot be composed, `image` is then unchanged.
+     */
+    bool ProcessComposedShaderFilters(Drawing::Canvas& canvas,
+        const std::vector<std::shared_ptr<Drawing::GEVisualEffect>>& visualEffects,
+        std::shared_ptr<Drawing::Image>& image, const ShaderFilterEffectContext& context, InvocationOutputs& outputs);
+
+    // ProcessMemoizedShaderFilter for a run of GEShaderCompositionPass starting at `position`, memoized as one output.
+    // Falls back to the filters of the run one by one when it cannot be composed.
+    void ProcessMemoizedComposedShaderFilters(Drawing::Canvas& canvas,
+        const std::vector<std::shared_ptr<Drawing::GEVisualEffect>>& visualEffects, uint32_t position,
+        std::shared_ptr<Drawing::Image>& image, const ShaderFilterEffectContext& context, InvocationOutputs& outputs);
+
+    // DispatchGEShaderFilter for a run of GEShaderCompositionPass. Used in ApplyHpsGEImageEffect only.
+    ApplyShaderFilterTarget DispatchComposedShaderFilters(Drawing::Canvas& canvas, Drawing::Brush& brush,
+        GEFilterComposable& composable, const std::vector<std::shared_ptr<Drawing::GEVisualEffect>>& visualEffects,
+        ShaderFilterEffectContext& geContext, InvocationOutputs& outputs);
 
     /**
      * @brief Apply a GEVisualEffect on outImage through GEShaderFilter::ProcessImage
@@ -208,7 +339,7 @@ private:
      */
     ApplyShaderFilterTarget ProcessShaderFilter(Drawing::Canvas& canvas,
         std::shared_ptr<Drawing::GEVisualEffect> visualEffect, std::shared_ptr<Drawing::Image>& outImage,
-        const ShaderFilterEffectContext& context);
+        const ShaderFilterEffectContext& context, InvocationOutputs& outputs);
 
     /**
      * @brief Apply a GEVisualEffect on canvas through GEShaderFilter::DrawImage
@@ -219,7 +350,7 @@ private:
      */
     ApplyShaderFilterTarget DrawShaderFilter(Drawing::Canvas& canvas,
         std::shared_ptr<Drawing::GEVisualEffect> visualEffect, Drawing::Brush& brush,
-        const ShaderFilterEffectContext& context);
+        const ShaderFilterEffectContext& context, InvocationOutputs& outputs);
 
     std::shared_ptr<GEShader> GenerateShaderEffect(const std::shared_ptr<Drawing::GEVisualEffectImpl>& ve);
 
@@ -227,10 +358,14 @@ private:
     std::vector<std::shared_ptr<GEShaderFilter>> GenerateShaderFilters(
         const Drawing::GEVisualEffectContainer& veContainer);
 
+    // Mirror the outputs to the calling thread for IsNeedExpansionFilter / GetExpansionRect
+    void PublishLegacyOutputs(const InvocationOutputs& outputs) const;
+
     static std::atomic<bool> isMesablurAllEnable_;
 
-    bool isNeedExpansionFilter_ = false;
-    Drawing::Rect expansionRect_ {};
+    // Last legacy outputs of this instance per issuing thread, released along with the instance
+    mutable std::mutex legacyOutputsMutex_;
+    mutable std::unordered_map<std::thread::id, InvocationOutputs> legacyOutputs_;
 };
 
 } // namespace GraphicsEffectEngine
@@ -0,0 +1,59 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef GRAPHICS_EFFECT_GE_SHADER_COMPOSITION_PASS_H
+#define GRAPHICS_EFFECT_GE_SHADER_COMPOSITION_PASS_H
+#include <memory>
+#include <vector>
+
+#include "ge_filter_composer_pass.h"
+#include "ge_visual_effect.h"
+
+namespace OHOS {
+namespace Rosen {
+
+struct ShaderCompositionFlag : GEFilterComposableFlags<ShaderCompositionFlag> {
+    // Effects of the run in order, starting with the effect of the flagged composable
+    std::vector<std::shared_ptr<Drawing::GEVisualEffect>> effects;
+
+    explicit ShaderCompositionFlag(std::vector<std::shared_ptr<Drawing::GEVisualEffect>> runEffects)
+        : effects(std::move(runEffects)) {}
+
+    // Effects composed into composable, nullptr when it does not start a run
+    static const std::vector<std::shared_ptr<Drawing::GEVisualEffect>>* GetComposedEffects(
+        const GEFilterComposable& composable);
+};
+
+/**
+ * @class GEShaderCompositionPass
+ * @brief Merges runs of adjacent filters supporting GEShaderFilter::MakeComposableShader into one composable.
+ *
+ * The first composable of every run of 2 to MAX_RUN_LENGTH composable GEVisualEffects gets a ShaderCompositionFlag
+ * holding the effects of the run, the other composables of the run are erased. GERender then draws the shaders of
+ * the run nested into each other in a single pass. Filters sampling their input several times per pixel only start
+ * a run, as a child nested under them would be evaluated once per sample.
+ */
+class GEShaderCompositionPass : public GEFilterComposerPass {
+public:
+    // Every distinct run is compiled into its own program, longer runs would grow the programs without bound
+    static constexpr size_t MAX_RUN_LENGTH = 4;
+
+    std::string_view GetLogName() const override;
+    GEFilterComposerPassResult Run(std::vector<GEFilterComposable>& composables) override;
+};
+} // namespace Rosen
+} // namespace OHOS
+
+#endif // GRAPHICS_EFFECT_GE_SHADER_COMPOSITION_PASS_H
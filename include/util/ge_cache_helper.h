@@ -17,6 +17,7 @@
 #define GRAPHICS_EFFECT_SHADER_CACHE_HELPER_H
 #include <any>
 #include "ge_common.h"
+#include "ge_frame_pool.h"
 #include "ge_log.h"
 namespace OHOS::Rosen {
 class GE_EXPORT GECacheHelper {
@@ -27,7 +28,7 @@ public:
     template<class T>
     static std::shared_ptr<std::any> PackCacheAny(T&& datas)
     {
-        return std::make_shared<std::any>(std::forward<T>(datas));
+        return std::allocate_shared<std::any>(GEFramePoolAllocator<std::any>(), std::forward<T>(datas));
     }
 
     template<class T>
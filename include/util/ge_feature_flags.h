@@ -0,0 +1,114 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef GRAPHICS_EFFECT_GE_FEATURE_FLAGS_H
+#define GRAPHICS_EFFECT_GE_FEATURE_FLAGS_H
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include "ge_common.h"
+
+namespace OHOS {
+namespace Rosen {
+enum class GEFeatureFlag : uint32_t {
+    DEBUG_TRACE = 0,       // persist.sys.graphic.openDebugTrace
+    SDF_CACHE,             // persist.sys.graphic.effect.enablesdfcache, -1 keeps the caller default
+    EXTERNAL_EFFECT,       // rosen.graphic.gex.enable
+    KAWASE_ORIGINAL_IMAGE, // persist.sys.graphic.kawaseOriginalEnable
+    BLUR_EXTRA_FILTER,     // persist.sys.graphic.blurExtraFilter
+    SIMPLIFIED_MESA,       // persist.sys.graphic.simplifiedMesaEnable
+    CONTOUR_DIAGONAL_MESA, // persist.graphic.contourdiagnalmesa.enabled
+    SUPPORTS_AF,           // persist.sys.graphic.supports_af
+    OUTPUT_MEMO,           // persist.sys.graphic.ge.outputMemo
+    SHADER_COMPOSITION,    // persist.sys.graphic.ge.shaderComposition
+    COUNT,
+};
+
+/**
+ * @class GEFeatureFlags
+ * @brief Process-wide registry of the runtime switches read on effect hot paths.
+ *
+ * All flags are held in one immutable snapshot published through an atomic pointer, so a read is an acquire load and
+ * an array index, and flags read from the same snapshot are consistent with each other. The snapshot is rebuilt by
+ * Refresh, which the system parameter watcher calls whenever one of the flag properties changes, so flag changes
+ * apply without restarting the service. Hot paths never call the parameter service.
+ *
+ * A snapshot is only published when a value changed. Replaced snapshots are kept until the process exits because
+ * readers may still hold them; flags change at human speed, so they stay few and small.
+ */
+class GE_EXPORT GEFeatureFlags {
+public:
+    static constexpr size_t FLAG_COUNT = static_cast<size_t>(GEFeatureFlag::COUNT);
+
+    struct Snapshot {
+        std::array<int32_t, FLAG_COUNT> values {};
+        uint64_t version = 0;
+
+        int32_t Get(GEFeatureFlag flag) const
+        {
+            return values[static_cast<size_t>(flag)];
+        }
+    };
+
+    static GEFeatureFlags& GetInstance();
+
+    const Snapshot& GetSnapshot() const
+    {
+        return *current_.load(std::memory_order_acquire);
+    }
+
+    int32_t GetInt(GEFeatureFlag flag) const
+    {
+        return GetSnapshot().Get(flag);
+    }
+
+    bool IsEnabled(GEFeatureFlag flag) const
+    {
+        return GetInt(flag) != 0;
+    }
+
+    // Re-reads every flag property, returns true when a new snapshot was published
+    bool Refresh();
+
+    // Pins flag to value regardless of its property, until ClearOverrides
+    void SetOverride(GEFeatureFlag flag, int32_t value);
+    void ClearOverrides();
+
+    static const char* GetPropertyName(GEFeatureFlag flag);
+    static int32_t GetDefaultValue(GEFeatureFlag flag);
+
+private:
+    GEFeatureFlags();
+    ~GEFeatureFlags() = default;
+
+    // Callers hold mutex_
+    bool PublishLocked(const std::array<int32_t, FLAG_COUNT>& propertyValues);
+
+    std::atomic<const Snapshot*> current_ { nullptr };
+    std::mutex mutex_;
+    std::vector<std::unique_ptr<Snapshot>> snapshots_;
+    std::array<int32_t, FLAG_COUNT> propertyValues_ {};
+    std::array<int32_t, FLAG_COUNT> overrideValues_ {};
+    std::array<bool, FLAG_COUNT> hasOverride_ {};
+};
+} // namespace Rosen
+} // namespace OHOS
+
+#endif // GRAPHICS_EFFECT_GE_FEATURE_FLAGS_H
@@ -0,0 +1,145 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef GRAPHICS_EFFECT_GE_FRAME_POOL_H
+#define GRAPHICS_EFFECT_GE_FRAME_POOL_H
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <new>
+
+#include "ge_common.h"
+
+namespace OHOS {
+namespace Rosen {
+/**
+ * @class GEFramePool
+ * @brief Size class pool for the small objects rebuilt with every effect container: effect impls, params boxes,
+ * params structs and cache anys.
+ *
+ * Freed blocks go to a free list of the freeing thread and serve the next allocation of the same size class on that
+ * thread, so a container rebuilt every frame reuses the blocks of the previous one without touching the heap or its
+ * lock. Blocks are independent heap blocks, they can be freed on any thread and outlive any frame.
+ * EndFrame trims the free lists of the calling thread to a few blocks per class and starts new frame counters.
+ * GERender calls it at the first invocation of a thread once a frame period has elapsed since the previous one.
+ *
+ * Blocks larger than MAX_BLOCK_SIZE and all blocks while the pool is disabled go to the heap directly.
+ * The pool is enabled by default unless persist.sys.graphic.ge.framePool is 0.
+ */
+class GE_EXPORT GEFramePool {
+public:
+    struct Stats {
+        uint64_t allocations = 0;      // Blocks handed out
+        uint64_t reuses = 0;           // Allocations served from a free list
+        uint64_t heapAllocations = 0;  // Allocations that reached the heap
+        uint64_t bytesInUse = 0;       // Size class bytes handed out and not freed yet
+        uint64_t peakBytesInUse = 0;
+        uint64_t frameAllocations = 0; // Allocations since the last EndFrame
+    };
+
+    static constexpr size_t MIN_BLOCK_SIZE = 32;
+    static constexpr size_t MAX_BLOCK_SIZE = 1024;
+    static constexpr size_t SIZE_CLASS_COUNT = 6; // 32, 64, 128, 256, 512 and 1024 bytes
+    static constexpr uint32_t MAX_FREE_BLOCKS = 256;   // Per thread and size class
+    static constexpr uint32_t RETAINED_FREE_BLOCKS = 32; // Per thread and size class after EndFrame
+
+    static GEFramePool& GetInstance();
+
+    void* Allocate(size_t size);
+    // size must be the size passed to Allocate
+    void Deallocate(void* ptr, size_t size);
+
+    void EndFrame();
+
+    void SetEnabled(bool enabled);
+    bool IsEnabled() const
+    {
+        return enabled_.load(std::memory_order_relaxed);
+    }
+
+    Stats GetStats() const;
+    // Free blocks held by the calling thread
+    uint32_t GetFreeBlockCount() const;
+
+    // Index of the size class serving size, SIZE_CLASS_COUNT when it is too large for the pool
+    static size_t GetSizeClass(size_t size);
+
+private:
+    GEFramePool();
+    ~GEFramePool() = default;
+
+    void AddInUse(int64_t bytes);
+
+    std::atomic<bool> enabled_ { true };
+    std::atomic<uint64_t> allocations_ { 0 };
+    std::atomic<uint64_t> reuses_ { 0 };
+    std::atomic<uint64_t> heapAllocations_ { 0 };
+    std::atomic<int64_t> bytesInUse_ { 0 };
+    std::atomic<int64_t> peakBytesInUse_ { 0 };
+    std::atomic<uint64_t> frameStartAllocations_ { 0 };
+};
+
+// Base of classes whose instances come from GEFramePool when created with new, make_unique included
+class GE_EXPORT GEFramePoolObject {
+public:
+    static void* operator new(size_t size)
+    {
+        return GEFramePool::GetInstance().Allocate(size);
+    }
+
+    static void operator delete(void* ptr, size_t size)
+    {
+        GEFramePool::GetInstance().Deallocate(ptr, size);
+    }
+};
+
+// Standard allocator on GEFramePool, for std::allocate_shared
+template<typename T>
+class GEFramePoolAllocator {
+public:
+    using value_type = T;
+    static_assert(alignof(T) <= __STDCPP_DEFAULT_NEW_ALIGNMENT__, "GEFramePool blocks use the default alignment");
+
+    GEFramePoolAllocator() noexcept = default;
+    template<typename U>
+    GEFramePoolAllocator(const GEFramePoolAllocator<U>&) noexcept {}
+
+    T* allocate(size_t n)
+    {
+        return static_cast<T*>(GEFramePool::GetInstance().Allocate(n * sizeof(T)));
+    }
+
+    void deallocate(T* ptr, size_t n)
+    {
+        GEFramePool::GetInstance().Deallocate(ptr, n * sizeof(T));
+    }
+
+    template<typename U>
+    bool operator==(const GEFramePoolAllocator<U>&) const noexcept
+    {
+        return true;
+    }
+
+    template<typename U>
+    bool operator!=(const GEFramePoolAllocator<U>&) const noexcept
+    {
+        return false;
+    }
+};
+} // namespace Rosen
+} // namespace OHOS
+
+#endif // GRAPHICS_EFFECT_GE_FRAME_POOL_H
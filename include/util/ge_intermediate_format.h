@@ -0,0 +1,64 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef GRAPHICS_EFFECT_GE_INTERMEDIATE_FORMAT_H
+#define GRAPHICS_EFFECT_GE_INTERMEDIATE_FORMAT_H
+
+#include <atomic>
+#include <cstdint>
+
+#include "draw/color.h"
+#include "image/image_info.h"
+
+#include "ge_common.h"
+
+namespace OHOS {
+namespace Rosen {
+/**
+ * @class GEIntermediateFormat
+ * @brief Picks the colour type of the images effects render between their passes.
+ *
+ * Effects used to copy the colour type of their input, so an F16 input made every blur pass F16 even on displays
+ * without HDR headroom. Effects now describe what an intermediate holds and the policy picks the format:
+ * colour passes drop to RGBA8 when the headroom cannot show values above 1, masks always use RGBA8 and distance or
+ * JFA seed images keep half floats for their precision.
+ *
+ * Automatic selection is on unless persist.sys.graphic.ge.intermediateFormat is 0, which restores the previous
+ * formats: input colour type for colour passes, RGBA8 for masks and F16 for distances.
+ */
+class GE_EXPORT GEIntermediateFormat {
+public:
+    enum class Usage : uint8_t {
+        COLOR,    // Blurred or filtered colour, same range as the input
+        MASK,     // Values in [0, 1] such as halos and alpha masks
+        DISTANCE, // Signed distances and JFA seed coordinates
+    };
+
+    static void SetAutoSelectEnabled(bool enabled);
+    static bool IsAutoSelectEnabled();
+
+    static Drawing::ColorType SelectColorType(Usage usage, const Drawing::ImageInfo& input, float supportHeadroom);
+
+    // width x height with the selected colour type, the alpha type and colour space of the input
+    static Drawing::ImageInfo MakeImageInfo(int width, int height, const Drawing::ImageInfo& input, Usage usage,
+        float supportHeadroom);
+
+private:
+    static std::atomic<int> autoSelect_;
+};
+} // namespace Rosen
+} // namespace OHOS
+
+#endif // GRAPHICS_EFFECT_GE_INTERMEDIATE_FORMAT_H
@@ -0,0 +1,80 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef GRAPHICS_EFFECT_GE_NOISE_ATLAS_H
+#define GRAPHICS_EFFECT_GE_NOISE_ATLAS_H
+
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include "effect/shader_effect.h"
+#include "image/image.h"
+
+#include "ge_common.h"
+
+namespace OHOS {
+namespace Rosen {
+/**
+ * @class GENoiseAtlas
+ * @brief Process-wide cache of tileable procedural noise baked once on the CPU, sampled by shaders instead of
+ * evaluating hash noise per pixel.
+ *
+ * An atlas of size N x N covers N / TEXELS_PER_CELL noise lattice cells per side and wraps seamlessly. Channels:
+ *   r: 2D gradient noise, the value n in [-1, 1] stored as n * 0.5 + 0.5
+ *   g: 1D value noise in [0, 1] along x, the same on every row
+ *   b: 2D gradient noise with other lattice gradients, stored as r
+ * Shaders sample it through GetShader with p * TEXELS_PER_CELL, where p is the noise coordinate in lattice cells.
+ *
+ * The images are raster images, so one atlas serves every thread and GPU context.
+ */
+class GE_EXPORT GENoiseAtlas {
+public:
+    static constexpr uint32_t TEXELS_PER_CELL = 8;
+    static constexpr uint32_t MIN_SIZE = 32;
+    static constexpr uint32_t MAX_SIZE = 512;
+    static constexpr uint32_t CHANNELS = 4;
+
+    static GENoiseAtlas& GetInstance();
+
+    // Baked on first use, nullptr if size is not a power of two in [MIN_SIZE, MAX_SIZE]
+    std::shared_ptr<Drawing::Image> GetImage(uint32_t size);
+    // Repeat tiled, linearly filtered image shader of GetImage
+    std::shared_ptr<Drawing::ShaderEffect> GetShader(uint32_t size);
+
+    size_t GetCachedCount() const;
+    void Clear();
+
+    // CPU bake of an RGBA8 atlas, row after row
+    static bool Bake(uint32_t size, std::vector<uint8_t>& rgba);
+
+    static bool IsValidSize(uint32_t size)
+    {
+        return size >= MIN_SIZE && size <= MAX_SIZE && (size & (size - 1)) == 0;
+    }
+
+private:
+    GENoiseAtlas() = default;
+    ~GENoiseAtlas() = default;
+
+    mutable std::mutex mutex_;
+    std::map<uint32_t, std::shared_ptr<Drawing::Image>> images_;
+};
+} // namespace Rosen
+} // namespace OHOS
+
+#endif // GRAPHICS_EFFECT_GE_NOISE_ATLAS_H
@@ -0,0 +1,121 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef GRAPHICS_EFFECT_GE_QUALITY_GOVERNOR_H
+#define GRAPHICS_EFFECT_GE_QUALITY_GOVERNOR_H
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <mutex>
+
+#include "ge_common.h"
+
+namespace OHOS {
+namespace Rosen {
+/**
+ * @class GEQualityGovernor
+ * @brief Process-wide effect quality level driven by the measured per-frame effect cost.
+ *
+ * GERender reports the cost of every invocation. Costs are accumulated over windows of one frame period; at the end of
+ * each window the smoothed frame cost is compared with the budget. The level degrades after a few frames over budget
+ * and recovers one step after a longer run of frames with headroom, so it does not oscillate between frames.
+ *
+ * Filters consult the level when picking their parameters, e.g. a lower blur down-sampling scale or fewer SDF passes.
+ * Reading the level is a relaxed atomic load and can be done on any thread.
+ */
+class GE_EXPORT GEQualityGovernor {
+public:
+    enum class QualityLevel : uint8_t {
+        HIGH = 0,    // Default quality, filters behave as without the governor
+        MEDIUM = 1,  // One step of extra down-sampling / one pass less
+        LOW = 2,     // Two steps of extra down-sampling / two passes less
+    };
+
+    struct Config {
+        uint64_t framePeriodNs = 8333333;     // 120 Hz frame
+        uint64_t effectBudgetNs = 4000000;    // Share of the frame allotted to GE effects
+        float smoothing = 0.25f;              // Weight of the latest frame in the moving average
+        float recoverRatio = 0.6f;            // Headroom needed to recover, as a ratio of the budget
+        uint32_t degradeFrames = 3;           // Consecutive frames over budget before degrading
+        uint32_t recoverFrames = 30;          // Consecutive frames with headroom before recovering
+    };
+
+    static GEQualityGovernor& GetInstance();
+
+    // Disabled governors always report HIGH, disabled by default unless persist.sys.graphic.ge.qualityGovernor is 1
+    void SetEnabled(bool enabled);
+    bool IsEnabled() const
+    {
+        return enabled_.load(std::memory_order_relaxed);
+    }
+
+    void SetConfig(const Config& config);
+    Config GetConfig() const;
+
+    // Add the cost of one effect invocation to the frame window containing nowNs
+    void ReportCost(uint64_t costNs, uint64_t nowNs);
+    void ReportCost(uint64_t costNs);
+
+    QualityLevel GetQualityLevel() const
+    {
+        return IsEnabled() ? static_cast<QualityLevel>(level_.load(std::memory_order_relaxed)) : QualityLevel::HIGH;
+    }
+
+    // Number of quality steps below HIGH, 0 when disabled
+    int GetDegradeSteps() const
+    {
+        return static_cast<int>(GetQualityLevel());
+    }
+
+    // Smoothed cost of the last closed frame windows, for diagnostics
+    uint64_t GetSmoothedFrameCostNs() const;
+
+    // Back to HIGH with empty history, keeps the config
+    void Reset();
+
+    // Measures the lifetime of the scope and reports it to the governor
+    class CostScope {
+    public:
+        CostScope() : start_(std::chrono::steady_clock::now()) {}
+        ~CostScope();
+        CostScope(const CostScope&) = delete;
+        CostScope& operator=(const CostScope&) = delete;
+
+    private:
+        std::chrono::steady_clock::time_point start_;
+    };
+
+private:
+    GEQualityGovernor();
+    ~GEQualityGovernor() = default;
+
+    void CloseWindowLocked(uint64_t nowNs);
+
+    std::atomic<bool> enabled_ { false };
+    std::atomic<uint8_t> level_ { static_cast<uint8_t>(QualityLevel::HIGH) };
+
+    mutable std::mutex mutex_;
+    Config config_ {};
+    uint64_t windowStartNs_ = 0;
+    uint64_t windowCostNs_ = 0;
+    float smoothedCostNs_ = 0.0f;
+    uint32_t overBudgetFrames_ = 0;
+    uint32_t headroomFrames_ = 0;
+};
+} // namespace Rosen
+} // namespace OHOS
+
+#endif // GRAPHICS_EFFECT_GE_QUALITY_GOVERNOR_H
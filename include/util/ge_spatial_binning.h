@@ -0,0 +1,111 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef GRAPHICS_EFFECT_GE_SPATIAL_BINNING_H
+#define GRAPHICS_EFFECT_GE_SPATIAL_BINNING_H
+
+#include <array>
+#include <cstdint>
+#include <vector>
+
+#include "ge_common.h"
+
+namespace OHOS {
+namespace Rosen {
+/**
+ * @class GESpatialBinning
+ * @brief Quadtree binning of item bounding boxes into leaf cells, shared by the path SDF and contour flow light.
+ *
+ * Cells are split breadth first until they hold at most maxItemsPerCell items or reach minCellSize. The result is
+ * flat: every leaf cell refers to a range of one item index array, so no per-cell vectors are allocated. The item
+ * boxes are copied into one array per coordinate so the box tests of a cell run over contiguous floats, and the
+ * children of a cell holding many items are binned on worker threads.
+ *
+ * All storage is kept between builds, an instance owned by an effect reuses its buffers frame after frame.
+ */
+class GE_EXPORT GESpatialBinning {
+public:
+    static constexpr uint32_t BOX_SIZE = 4;
+    using Box = std::array<float, BOX_SIZE>; // xmin, xmax, ymin, ymax
+
+    enum class SplitMode : uint8_t {
+        QUAD,         // Split cells wider and taller than minCellSize into four quadrants
+        QUAD_OR_HALF, // Split cells wider or taller than minCellSize, in halves along the side still above it
+    };
+
+    struct Config {
+        uint32_t maxItemsPerCell = 4;
+        float minCellSize = 64.0f;
+        SplitMode mode = SplitMode::QUAD;
+    };
+
+    struct Cell {
+        Box bbox {};
+        uint32_t first = 0; // Offset of the cell items in the item index array
+        uint32_t count = 0;
+    };
+
+    // Items whose box does not touch root are left out. Cells come out in breadth first order.
+    void Build(const Box& root, const std::vector<Box>& itemBoxes, const Config& config);
+
+    const std::vector<Cell>& GetCells() const
+    {
+        return cells_;
+    }
+
+    const uint32_t* GetCellItems(const Cell& cell) const
+    {
+        return items_.data() + cell.first;
+    }
+
+    // Quadrants dropped during the build because no item touches them
+    const std::vector<Box>& GetEmptyCells() const
+    {
+        return emptyCells_;
+    }
+
+    // Boxes touching on an edge intersect
+    static bool Intersect(const Box& a, const Box& b);
+
+    // Cells holding at least this many items bin their children in parallel
+    static constexpr uint32_t PARALLEL_MIN_ITEMS = 4096;
+
+private:
+    struct Node {
+        Box bbox {};
+        uint32_t first = 0; // Offset in pool_
+        uint32_t count = 0;
+    };
+
+    bool NeedsSplit(const Node& node) const;
+    uint32_t SplitBox(const Box& box, Box* children) const;
+    void SplitNode(const Node& node);
+    uint32_t BinItems(const Box& box, const uint32_t* src, uint32_t count, uint32_t* dst) const;
+
+    Config config_ {};
+    std::vector<float> minX_;
+    std::vector<float> maxX_;
+    std::vector<float> minY_;
+    std::vector<float> maxY_;
+    std::vector<Node> nodes_;
+    std::vector<uint32_t> pool_;
+    std::vector<uint32_t> items_;
+    std::vector<Cell> cells_;
+    std::vector<Box> emptyCells_;
+};
+} // namespace Rosen
+} // namespace OHOS
+
+#endif // GRAPHICS_EFFECT_GE_SPATIAL_BINNING_H
@@ -0,0 +1,90 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef GRAPHICS_EFFECT_GE_TONE_MAPPING_LUT_H
+#define GRAPHICS_EFFECT_GE_TONE_MAPPING_LUT_H
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+
+#include "effect/shader_effect.h"
+#include "image/image.h"
+
+#include "ge_common.h"
+
+namespace OHOS {
+namespace Rosen {
+/**
+ * @class GEToneMappingLut
+ * @brief Per-pixel version of GEToneMappingHelper::GetBrightnessMapping, with the Bezier curve baked into a LUT.
+ *
+ * The mapping of a colour scales rgb by mapping(high) / high, high being the largest unpremultiplied channel and at
+ * least 1. Between 1 and EFFECT_MAX_LUMINANCE the mapping at headroom h is (2 - h) * curve(high) + (h - 1) * high
+ * clamped to [0, h], above it is h. The mapping is linear in the headroom, so one baked curve serves every headroom
+ * and display brightness animations do not rebake anything.
+ *
+ * The curve is sampled at SIZE points over [1, EFFECT_MAX_LUMINANCE]. GetImage stores it in a SIZE x 1 raster
+ * image, the value v as 16 bit fixed point round(v * 65535) with the high byte in r and the low byte in g, so one
+ * image serves every thread and GPU context.
+ */
+class GE_EXPORT GEToneMappingLut {
+public:
+    static constexpr uint32_t SIZE = 256;
+    static constexpr uint32_t CHANNELS = 4;
+
+    using Curve = std::array<float, SIZE>;
+
+    static GEToneMappingLut& GetInstance();
+
+    // Baked on first use
+    const Curve& GetCurve();
+    std::shared_ptr<Drawing::Image> GetImage();
+
+    /**
+     * @brief Fuses the tone mapping into the shader producing the output, so it costs no extra pass.
+     * @param content Premultiplied colours to tone map.
+     * @param headroom Target headroom, see GEToneMappingHelper::NeedToneMapping.
+     * @return Shader evaluating content and tone mapping it, nullptr on failure.
+     */
+    std::shared_ptr<Drawing::ShaderEffect> MakeToneMappedShader(
+        const std::shared_ptr<Drawing::ShaderEffect>& content, float headroom);
+
+    // CPU path for raster canvases, nullptr on failure
+    std::shared_ptr<Drawing::Image> ToneMapImage(const Drawing::Image& image, float headroom);
+
+    // Scale of rgb for a colour whose largest unpremultiplied channel is high
+    static float GetCompressRatio(const Curve& curve, float headroom, float high);
+
+    // Tone maps premultiplied RGBA in place, pixelCount pixels of CHANNELS floats. Vectorized by 4 pixels.
+    static void ApplyRgba(const Curve& curve, float headroom, float* rgba, size_t pixelCount);
+
+    static void Bake(Curve& curve);
+
+private:
+    GEToneMappingLut() = default;
+    ~GEToneMappingLut() = default;
+
+    std::once_flag curveOnce_;
+    Curve curve_ {};
+    std::mutex imageMutex_;
+    std::shared_ptr<Drawing::Image> image_ = nullptr;
+};
+} // namespace Rosen
+} // namespace OHOS
+
+#endif // GRAPHICS_EFFECT_GE_TONE_MAPPING_LUT_H
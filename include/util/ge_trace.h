@@ -17,7 +17,7 @@
 #define GE_TRACE_H
 
 #ifdef NOT_BUILD_FOR_OHOS_SDK
-#include "ge_system_properties.h"
+#include "ge_feature_flags.h"
 #include "hitrace_meter.h"
 #include "securec.h"
 
@@ -25,21 +25,22 @@ namespace OHOS::Rosen {
 
 #define LIKELY(exp) (__builtin_expect((exp) != 0, true))
 #define UNLIKELY(exp) (__builtin_expect((exp) != 0, false))
+// One acquire load of the feature flag snapshot, persist.sys.graphic.openDebugTrace applies without a restart
+#define GE_DEBUG_TRACE_ENABLED()                                                                                      \
+    (UNLIKELY(OHOS::Rosen::GEFeatureFlags::GetInstance().IsEnabled(OHOS::Rosen::GEFeatureFlag::DEBUG_TRACE)))
+
 #define GE_TRACE(name)                                                                                                \
-    static bool debugTraceEnable = (OHOS::system::GetIntParameter("persist.sys.graphic.openDebugTrace", 0) != 0);     \
-    auto geNameTrace = (UNLIKELY(debugTraceEnable)) ?                                                                 \
+    auto geNameTrace = GE_DEBUG_TRACE_ENABLED() ?                                                                     \
                         std::make_unique<GEOptionalTrace>(name) :                                                     \
                         nullptr
 
 #define GE_TRACE_FUNC()                                                                                               \
-    static bool debugTraceEnable = (OHOS::system::GetIntParameter("persist.sys.graphic.openDebugTrace", 0) != 0);     \
-    auto geNameTrace = (UNLIKELY(debugTraceEnable)) ?                                                                 \
+    auto geNameTrace = GE_DEBUG_TRACE_ENABLED() ?                                                                     \
                         std::make_unique<GEOptionalTrace>(__func__) :                                                 \
                         nullptr
 
 #define GE_TRACE_NAME_FMT(fmt, ...)                                                                                   \
-    static bool debugFmtTraceEnable = (OHOS::system::GetIntParameter("persist.sys.graphic.openDebugTrace", 0) != 0);  \
-    auto optionalFmtTrace = (UNLIKELY(debugFmtTraceEnable)) ?                                                         \
+    auto optionalFmtTrace = GE_DEBUG_TRACE_ENABLED() ?                                                                \
         std::make_unique<RSOptionalFmtTrace>(fmt, ##__VA_ARGS__) :  nullptr
 
 class GEOptionalTrace {
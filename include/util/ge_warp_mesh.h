@@ -0,0 +1,115 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef GRAPHICS_EFFECT_GE_WARP_MESH_H
+#define GRAPHICS_EFFECT_GE_WARP_MESH_H
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "draw/canvas.h"
+#include "image/image.h"
+#include "utils/point.h"
+
+#include "ge_common.h"
+
+namespace OHOS {
+namespace Rosen {
+/**
+ * @class GEWarpMesh
+ * @brief Coons patches of the warp filters tessellated into a triangle mesh, with a CPU rasterizer for it.
+ *
+ * Each patch is evaluated like Canvas::DrawPatch on a fixed LOD x LOD grid of quads. Positions and texture coordinates
+ * are normalized to the image size, so one mesh serves every image and only changes with the control points. Get
+ * keeps the meshes of the last CACHE_CAPACITY patch sets, animations re-tessellate only the frames that move points.
+ *
+ * Rasterize maps every output pixel centre back into the image through the triangle covering it, samples the image
+ * bilinearly with clamped edges and blends SRC_OVER like the patches drawn on a canvas. Rows are split into bands of
+ * TILE_ROWS drawn in parallel by workers kept for the process, and the pixels of a span are shaded 4 at a time.
+ * The rasterizer works on 8 bit channels, sources of other color types are left to Canvas::DrawPatch.
+ */
+class GE_EXPORT GEWarpMesh {
+public:
+    static constexpr size_t PATCH_POINT_NUM = 12;
+    static constexpr size_t PATCH_CORNER_NUM = 4;
+    static constexpr uint32_t LOD = 16; // 16: quads per patch side, smooth for the warps of a 3 x 3 grid
+    static constexpr size_t CACHE_CAPACITY = 8;
+    static constexpr int32_t TILE_ROWS = 64;
+
+    struct Patch {
+        // Clockwise from the top-left corner, the order of Canvas::DrawPatch
+        std::array<Drawing::Point, PATCH_POINT_NUM> cubics {};
+        // Top-left, top-right, bottom-right, bottom-left
+        std::array<Drawing::Point, PATCH_CORNER_NUM> texCoords {};
+
+        bool operator==(const Patch& other) const;
+    };
+
+    struct Vertex {
+        float x = 0.0f;
+        float y = 0.0f;
+        float u = 0.0f;
+        float v = 0.0f;
+    };
+
+    explicit GEWarpMesh(const std::vector<Patch>& patches);
+    ~GEWarpMesh() = default;
+
+    // Cached mesh of patches, tessellated on a miss
+    static std::shared_ptr<const GEWarpMesh> Get(const std::vector<Patch>& patches);
+    static void ClearCache();
+
+    // Raster canvases take Rasterize instead of drawing the patches
+    static bool IsRasterCanvas(Drawing::Canvas& canvas);
+    // 8 bit sources only, Rasterize would quantize F16 / HDR content
+    static bool IsRasterizable(const Drawing::Image& image);
+
+    const std::vector<Patch>& GetPatches() const
+    {
+        return patches_;
+    }
+
+    const std::vector<Vertex>& GetVertices() const
+    {
+        return vertices_;
+    }
+
+    // Three per triangle
+    const std::vector<uint32_t>& GetIndices() const
+    {
+        return indices_;
+    }
+
+    /**
+     * @brief Draws image warped by the mesh into a transparent width x height image.
+     * @param image Source, also the unit of the normalized positions and texture coordinates.
+     * @return Premultiplied RGBA_8888 image, nullptr on failure or when image is not rasterizable.
+     */
+    std::shared_ptr<Drawing::Image> Rasterize(const Drawing::Image& image, int32_t width, int32_t height) const;
+
+private:
+    void Tessellate(const Patch& patch);
+
+    std::vector<Patch> patches_;
+    std::vector<Vertex> vertices_;
+    std::vector<uint32_t> indices_;
+};
+} // namespace Rosen
+} // namespace OHOS
+
+#endif // GRAPHICS_EFFECT_GE_WARP_MESH_H
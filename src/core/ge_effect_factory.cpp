@@ -21,6 +21,8 @@ namespace OHOS {
 namespace GraphicsEffectEngine {
 
 std::array<std::optional<GEEffectFactory::EffectCreator>, GEEffectFactory::MAX_EFFECTS> GEEffectFactory::creators_;
+std::array<uint32_t, GEEffectFactory::MAX_EFFECTS> GEEffectFactory::degradeOptions_ {};
+std::array<uint32_t, GEEffectFactory::MAX_EFFECTS> GEEffectFactory::memoOptions_ {};
 
 void GEEffectFactory::Register(Rosen::Drawing::GEFilterType type, EffectCreator&& creator)
 {
@@ -40,6 +42,42 @@ void GEEffectFactory::Register(Rosen::Drawing::GEFilterType type, EffectCreator&
     creators_[index] = std::forward<EffectCreator>(creator);
 }
 
+void GEEffectFactory::RegisterDegradeOptions(Rosen::Drawing::GEFilterType type, uint32_t options)
+{
+    const size_t index = static_cast<size_t>(type);
+    if (type == Rosen::Drawing::GEFilterType::NONE || index >= MAX_EFFECTS) {
+        return;
+    }
+    degradeOptions_[index] = options;
+}
+
+uint32_t GEEffectFactory::GetDegradeOptions(Rosen::Drawing::GEFilterType type)
+{
+    const size_t index = static_cast<size_t>(type);
+    if (index >= MAX_EFFECTS) {
+        return DEGRADE_NONE;
+    }
+    return degradeOptions_[index];
+}
+
+void GEEffectFactory::RegisterMemoOptions(Rosen::Drawing::GEFilterType type, uint32_t options)
+{
+    const size_t index = static_cast<size_t>(type);
+    if (type == Rosen::Drawing::GEFilterType::NONE || index >= MAX_EFFECTS) {
+        return;
+    }
+    memoOptions_[index] = options;
+}
+
+uint32_t GEEffectFactory::GetMemoOptions(Rosen::Drawing::GEFilterType type)
+{
+    const size_t index = static_cast<size_t>(type);
+    if (index >= MAX_EFFECTS) {
+        return MEMO_NONE;
+    }
+    return memoOptions_[index];
+}
+
 std::shared_ptr<Rosen::Drawing::IGEFilterType> GEEffectFactory::Create(
     std::shared_ptr<Rosen::Drawing::GEVisualEffectImpl> impl)
 {
@@ -166,12 +166,11 @@ GE_FACTORY_REGISTER_CUSTOM(KAWASE_BLUR,
         auto mesaParams = std::make_shared<::OHOS::Rosen::Drawing::GEMESABlurShaderFilterParams>();
         mesaParams->radius = params->radius;
         uint32_t type = static_cast<uint32_t>(::OHOS::Rosen::Drawing::GEFilterType::MESA_BLUR);
-        void* impl = ::OHOS::Rosen::GEExternalDynamicLoader::GetInstance().CreateGEXObjectByType(
-            type, sizeof(::OHOS::Rosen::Drawing::GEMESABlurShaderFilterParams), mesaParams.get());
+        auto impl = ::OHOS::Rosen::GEExternalDynamicLoader::GetInstance()
+            .CreateGEXObject<::OHOS::Rosen::Drawing::IGEFilterType>(type, *mesaParams);
         if (impl) {
             GE_LOGD("[GEEffectFactory] KAWASE_BLUR: Using MESA blur via external loader");
-            return std::shared_ptr<::OHOS::Rosen::Drawing::IGEFilterType>(
-                static_cast<::OHOS::Rosen::Drawing::IGEFilterType*>(impl));
+            return impl;
         }
         GE_LOGW("[GEEffectFactory] KAWASE_BLUR: External loader failed, using built-in MESA blur");
         return std::make_shared<::OHOS::Rosen::GEMESABlurShaderFilter>(*mesaParams);
@@ -188,13 +187,11 @@ GE_FACTORY_REGISTER_CUSTOM(LINEAR_GRADIENT_BLUR,
         }
         if (params->isRadiusGradient) {
             uint32_t type = static_cast<uint32_t>(::OHOS::Rosen::Drawing::GEFilterType::LINEAR_GRADIENT_BLUR);
-            void* impl = ::OHOS::Rosen::GEExternalDynamicLoader::GetInstance().CreateGEXObjectByType(
-                type, sizeof(::OHOS::Rosen::Drawing::GELinearGradientBlurShaderFilterParams),
-                static_cast<void*>(params.get()));
+            auto impl = ::OHOS::Rosen::GEExternalDynamicLoader::GetInstance()
+                .CreateGEXObject<::OHOS::Rosen::Drawing::IGEFilterType>(type, *params);
             if (impl) {
                 GE_LOGD("[GEEffectFactory] LINEAR_GRADIENT_BLUR: Using external loader (isRadiusGradient=true)");
-                return std::shared_ptr<::OHOS::Rosen::Drawing::IGEFilterType>(
-                    static_cast<::OHOS::Rosen::Drawing::IGEFilterType*>(impl));
+                return impl;
             }
             GE_LOGW("[GEEffectFactory] LINEAR_GRADIENT_BLUR: External loader failed, using built-in");
         }
@@ -300,17 +297,43 @@ GE_FACTORY_REGISTER_CUSTOM(SDF_RRECT_SHAPE,
         if (!::OHOS::Rosen::Drawing::GEVisualEffect::CanBeContinuous(params)) {
             return std::make_shared<::OHOS::Rosen::Drawing::GESDFRRectShaderShape>(*params);
         }
-        auto object = ::OHOS::Rosen::GEExternalDynamicLoader::GetInstance().CreateGEXObjectByType(
-            static_cast<uint32_t>(::OHOS::Rosen::Drawing::GEFilterType::SDF_RRECT_SHAPE),
-            sizeof(::OHOS::Rosen::Drawing::GESDFRRectShapeParams),
-            static_cast<void*>(params.get()));
+        auto object = ::OHOS::Rosen::GEExternalDynamicLoader::GetInstance()
+            .CreateGEXObject<::OHOS::Rosen::Drawing::IGEFilterType>(
+                static_cast<uint32_t>(::OHOS::Rosen::Drawing::GEFilterType::SDF_RRECT_SHAPE), *params);
         if (!object) {
             return std::make_shared<::OHOS::Rosen::Drawing::GESDFRRectShaderShape>(*params);
         }
-        return std::shared_ptr<::OHOS::Rosen::Drawing::IGEFilterType>(
-            static_cast<::OHOS::Rosen::Drawing::IGEFilterType*>(object));
+        return object;
     })
 
+/*
+ * 5. Degradation options, used by GERender when the deadline of an invocation cannot be met.
+ *    Effects not listed always run.
+ */
+GE_FACTORY_DEGRADE_OPTIONS(KAWASE_BLUR, GEEffectFactory::DEGRADE_REUSE_OUTPUT)
+GE_FACTORY_DEGRADE_OPTIONS(MESA_BLUR, GEEffectFactory::DEGRADE_REUSE_OUTPUT)
+GE_FACTORY_DEGRADE_OPTIONS(LINEAR_GRADIENT_BLUR, GEEffectFactory::DEGRADE_REUSE_OUTPUT)
+GE_FACTORY_DEGRADE_OPTIONS(VARIABLE_RADIUS_BLUR, GEEffectFactory::DEGRADE_REUSE_OUTPUT)
+GE_FACTORY_DEGRADE_OPTIONS(CONTENT_LIGHT, GEEffectFactory::DEGRADE_REUSE_OUTPUT | GEEffectFactory::DEGRADE_SKIP)
+GE_FACTORY_DEGRADE_OPTIONS(DIRECTION_LIGHT, GEEffectFactory::DEGRADE_REUSE_OUTPUT | GEEffectFactory::DEGRADE_SKIP)
+GE_FACTORY_DEGRADE_OPTIONS(EDGE_LIGHT, GEEffectFactory::DEGRADE_REUSE_OUTPUT | GEEffectFactory::DEGRADE_SKIP)
+GE_FACTORY_DEGRADE_OPTIONS(SOUND_WAVE, GEEffectFactory::DEGRADE_SKIP)
+
+/*
+ * 6. Output memoization, used by GERender to skip invocations repeating an earlier one exactly.
+ *    Only stateless filters are listed: their output depends on the params, the canvas info, the input and the rects.
+ *    Effects not listed always run.
+ */
+GE_FACTORY_MEMO_OPTIONS(KAWASE_BLUR, GEEffectFactory::MEMO_OUTPUT)
+GE_FACTORY_MEMO_OPTIONS(MESA_BLUR, GEEffectFactory::MEMO_OUTPUT)
+GE_FACTORY_MEMO_OPTIONS(GREY, GEEffectFactory::MEMO_OUTPUT)
+GE_FACTORY_MEMO_OPTIONS(AIBAR, GEEffectFactory::MEMO_OUTPUT)
+GE_FACTORY_MEMO_OPTIONS(LINEAR_GRADIENT_BLUR, GEEffectFactory::MEMO_OUTPUT)
+GE_FACTORY_MEMO_OPTIONS(VARIABLE_RADIUS_BLUR, GEEffectFactory::MEMO_OUTPUT)
+GE_FACTORY_MEMO_OPTIONS(WATER_RIPPLE, GEEffectFactory::MEMO_OUTPUT)
+GE_FACTORY_MEMO_OPTIONS(COLOR_GRADIENT, GEEffectFactory::MEMO_OUTPUT)
+GE_FACTORY_MEMO_OPTIONS(HEAT_DISTORTION, GEEffectFactory::MEMO_OUTPUT)
+
 } // anonymous namespace
 } // namespace GraphicsEffectEngine
 } // namespace OHOS
@@ -73,6 +73,13 @@ std::shared_ptr<Drawing::Image> GEAIBarShaderFilter::OnProcessImage(Drawing::Can
     return invertedImage;
 }
 
+std::shared_ptr<Drawing::ShaderEffect> GEAIBarShaderFilter::MakeComposableShader(
+    const std::shared_ptr<Drawing::ShaderEffect>& input, const Drawing::ImageInfo& info)
+{
+    auto builder = MakeBinarizationShader(info.GetWidth(), info.GetHeight(), input);
+    return builder != nullptr ? builder->MakeShader(nullptr, false) : nullptr;
+}
+
 std::shared_ptr<Drawing::RuntimeShaderBuilder> GEAIBarShaderFilter::MakeBinarizationShader(
     float imageWidth, float imageHeight, std::shared_ptr<Drawing::ShaderEffect> imageShader)
 {
@@ -15,6 +15,7 @@
 #include "ge_log.h"
 #include "draw/surface.h"
 #include "ge_bezier_warp_shader_filter.h"
+#include "ge_warp_mesh.h"
 
 namespace OHOS {
 namespace Rosen {
@@ -50,6 +51,13 @@ std::shared_ptr<Drawing::Image> GEBezierWarpShaderFilter::OnProcessImage(Drawing
         LOGE("GEBezierWarpShaderFilter::OnProcessImage imageinfo is invalid");
         return nullptr;
     }
+    if (GEWarpMesh::IsRasterCanvas(canvas) && GEWarpMesh::IsRasterizable(*image)) {
+        // Raster canvases reuse the tessellated patch instead of tessellating it on every draw
+        GEWarpMesh::Patch patch { destinationPatch_, { Drawing::Point { 0.f, 0.f }, Drawing::Point { 1.f, 0.f },
+            Drawing::Point { 1.f, 1.f }, Drawing::Point { 0.f, 1.f } } };
+        return GEWarpMesh::Get({ patch })->Rasterize(*image, static_cast<int32_t>(dst.GetWidth()),
+            static_cast<int32_t>(dst.GetHeight()));
+    }
 
     std::array<Drawing::Point, BEZIER_WARP_POINT_NUM> bezierPatch = destinationPatch_;
     auto brush = GetBrush(image);
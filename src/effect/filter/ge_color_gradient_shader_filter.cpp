@@ -69,18 +69,10 @@ std::shared_ptr<Drawing::Image> GEColorGradientShaderFilter::OnProcessImage(Draw
         return image;
     }
 
-    std::shared_ptr<Drawing::RuntimeShaderBuilder> builder =
-        PreProcessColorGradientBuilder(canvasInfo_.geoWidth, canvasInfo_.geoHeight);
+    auto builder = PrepareColorGradientBuilder(srcImageShader, color, position, strength);
     if (!builder) {
-        LOGE("GEColorGradientShaderFilter::OnProcessImage mask builder error\n");
         return image;
     }
-    
-    builder->SetChild("srcImageShader", srcImageShader);
-    builder->SetUniform("iResolution", canvasInfo_.geoWidth, canvasInfo_.geoHeight);
-    builder->SetUniform("color", color, ARRAY_SIZE * COLOR_CHANNEL);
-    builder->SetUniform("position", position, ARRAY_SIZE * POSITION_CHANNEL);
-    builder->SetUniform("strength", strength, ARRAY_SIZE);
     auto resultImage = builder->MakeImage(canvas.GetGPUContext().get(), &(matrix), image->GetImageInfo(), false);
     if (resultImage == nullptr) {
         LOGE("GEColorGradientShaderFilter::OnProcessImage resultImage is null");
@@ -90,6 +82,44 @@ std::shared_ptr<Drawing::Image> GEColorGradientShaderFilter::OnProcessImage(Draw
     return resultImage;
 }
 
+std::shared_ptr<Drawing::ShaderEffect> GEColorGradientShaderFilter::MakeComposableShader(
+    const std::shared_ptr<Drawing::ShaderEffect>& input, const Drawing::ImageInfo& info)
+{
+    Drawing::Matrix matrix;
+    Drawing::Matrix invertMatrix;
+    if (input == nullptr || info.GetWidth() < 1 || info.GetHeight() < 1 ||
+        !GetCanvasGeometryMatrix(matrix, invertMatrix)) {
+        return nullptr;
+    }
+    float color[ARRAY_SIZE * COLOR_CHANNEL] = {0.0}; // 0.0 default
+    float position[ARRAY_SIZE * POSITION_CHANNEL] = {0.0}; // 0.0 default
+    float strength[ARRAY_SIZE] = {0.0}; // 0.0 default
+    if (!CheckInParams(color, position, strength, ARRAY_SIZE)) {
+        return input;
+    }
+    auto builder = PrepareColorGradientBuilder(MakeLocalMatrixShader(input, invertMatrix), color, position, strength);
+    return builder ? builder->MakeShader(&matrix, false) : nullptr;
+}
+
+std::shared_ptr<Drawing::RuntimeShaderBuilder> GEColorGradientShaderFilter::PrepareColorGradientBuilder(
+    const std::shared_ptr<Drawing::ShaderEffect>& srcImageShader, float* color, float* position,
+    float* strength)
+{
+    std::shared_ptr<Drawing::RuntimeShaderBuilder> builder =
+        PreProcessColorGradientBuilder(canvasInfo_.geoWidth, canvasInfo_.geoHeight);
+    if (!builder) {
+        LOGE("GEColorGradientShaderFilter::PrepareColorGradientBuilder mask builder error\n");
+        return nullptr;
+    }
+
+    builder->SetChild("srcImageShader", srcImageShader);
+    builder->SetUniform("iResolution", canvasInfo_.geoWidth, canvasInfo_.geoHeight);
+    builder->SetUniform("color", color, ARRAY_SIZE * COLOR_CHANNEL);
+    builder->SetUniform("position", position, ARRAY_SIZE * POSITION_CHANNEL);
+    builder->SetUniform("strength", strength, ARRAY_SIZE);
+    return builder;
+}
+
 void GEColorGradientShaderFilter::Preprocess(
     Drawing::Canvas& canvas, const Drawing::Rect& src, const Drawing::Rect& dst)
 {
@@ -37,13 +37,6 @@ std::shared_ptr<Drawing::Image> GEDispersionShaderFilter::OnProcessImage(Drawing
         return nullptr;
     }
 
-    auto dispersionShader = GetDispersionEffect();
-    if (dispersionShader == nullptr) {
-        LOGE("GEDispersionShaderFilter::OnProcessImage dispersionShader init failed.");
-        return image;
-    }
-    Drawing::RuntimeShaderBuilder builder(dispersionShader);
-
     Drawing::Matrix matrix = canvasInfo_.mat;
     matrix.PostTranslate(-canvasInfo_.tranX, -canvasInfo_.tranY);
     Drawing::Matrix invertMatrix;
@@ -52,34 +45,21 @@ std::shared_ptr<Drawing::Image> GEDispersionShaderFilter::OnProcessImage(Drawing
         return image;
     }
 
-    float lowValue = std::min(canvasInfo_.geoWidth, canvasInfo_.geoHeight);
-    float aspectX = (std::abs(lowValue) > 1e-6f) ? (canvasInfo_.geoWidth / lowValue) : 1.0f;
-    float aspectY = (std::abs(lowValue) > 1e-6f) ? (-canvasInfo_.geoHeight / lowValue) : 1.0f;
-
     auto imageShader = Drawing::ShaderEffect::CreateImageShader(*image, Drawing::TileMode::CLAMP,
         Drawing::TileMode::CLAMP, Drawing::SamplingOptions(Drawing::FilterMode::LINEAR), invertMatrix);
     if (imageShader == nullptr) {
         LOGE("GEDispersionShaderFilter::OnProcessImage create imageShader failed.");
         return image;
     }
-    builder.SetChild("image", imageShader);
-
-    auto maskShader = params_.mask->GenerateDrawingShader(canvasInfo_.geoWidth, canvasInfo_.geoHeight);
-    if (maskShader == nullptr) {
-        LOGE("GEDispersionShaderFilter::OnProcessImage mask generate failed.");
+    auto builder = MakeDispersionBuilder(imageShader);
+    if (builder == nullptr) {
         return image;
     }
-    builder.SetChild("mask", maskShader);
-    builder.SetUniform("iResolution", canvasInfo_.geoWidth, canvasInfo_.geoHeight);
-    builder.SetUniform("opacity", params_.opacity);
-    builder.SetUniform("redOffset", params_.redOffset.first / aspectX, params_.redOffset.second / aspectY);
-    builder.SetUniform("greenOffset", params_.greenOffset.first / aspectX, params_.greenOffset.second / aspectY);
-    builder.SetUniform("blueOffset", params_.blueOffset.first / aspectX, params_.blueOffset.second / aspectY);
 
 #ifdef RS_ENABLE_GPU
-    auto resultImage = builder.MakeImage(canvas.GetGPUContext().get(), &(matrix), imageInfo, false);
+    auto resultImage = builder->MakeImage(canvas.GetGPUContext().get(), &(matrix), imageInfo, false);
 #else
-    auto resultImage = builder.MakeImage(nullptr, &(matrix), imageInfo, false);
+    auto resultImage = builder->MakeImage(nullptr, &(matrix), imageInfo, false);
 #endif
     if (resultImage == nullptr) {
         LOGE("GEDispersionShaderFilter::OnProcessImage make image failed.");
@@ -88,6 +68,51 @@ std::shared_ptr<Drawing::Image> GEDispersionShaderFilter::OnProcessImage(Drawing
     return resultImage;
 }
 
+std::shared_ptr<Drawing::ShaderEffect> GEDispersionShaderFilter::MakeComposableShader(
+    const std::shared_ptr<Drawing::ShaderEffect>& input, const Drawing::ImageInfo& info)
+{
+    Drawing::Matrix matrix;
+    Drawing::Matrix invertMatrix;
+    if (input == nullptr || info.GetWidth() < 1 || info.GetHeight() < 1 ||
+        !GetCanvasGeometryMatrix(matrix, invertMatrix)) {
+        return nullptr;
+    }
+    if (params_.mask == nullptr) {
+        return input;
+    }
+    auto builder = MakeDispersionBuilder(MakeLocalMatrixShader(input, invertMatrix));
+    return builder != nullptr ? builder->MakeShader(&matrix, false) : nullptr;
+}
+
+std::shared_ptr<Drawing::RuntimeShaderBuilder> GEDispersionShaderFilter::MakeDispersionBuilder(
+    const std::shared_ptr<Drawing::ShaderEffect>& imageShader)
+{
+    auto dispersionShader = GetDispersionEffect();
+    if (dispersionShader == nullptr) {
+        LOGE("GEDispersionShaderFilter::MakeDispersionBuilder dispersionShader init failed.");
+        return nullptr;
+    }
+    auto maskShader = params_.mask->GenerateDrawingShader(canvasInfo_.geoWidth, canvasInfo_.geoHeight);
+    if (maskShader == nullptr) {
+        LOGE("GEDispersionShaderFilter::MakeDispersionBuilder mask generate failed.");
+        return nullptr;
+    }
+
+    float lowValue = std::min(canvasInfo_.geoWidth, canvasInfo_.geoHeight);
+    float aspectX = (std::abs(lowValue) > 1e-6f) ? (canvasInfo_.geoWidth / lowValue) : 1.0f;
+    float aspectY = (std::abs(lowValue) > 1e-6f) ? (-canvasInfo_.geoHeight / lowValue) : 1.0f;
+
+    auto builder = std::make_shared<Drawing::RuntimeShaderBuilder>(dispersionShader);
+    builder->SetChild("image", imageShader);
+    builder->SetChild("mask", maskShader);
+    builder->SetUniform("iResolution", canvasInfo_.geoWidth, canvasInfo_.geoHeight);
+    builder->SetUniform("opacity", params_.opacity);
+    builder->SetUniform("redOffset", params_.redOffset.first / aspectX, params_.redOffset.second / aspectY);
+    builder->SetUniform("greenOffset", params_.greenOffset.first / aspectX, params_.greenOffset.second / aspectY);
+    builder->SetUniform("blueOffset", params_.blueOffset.first / aspectX, params_.blueOffset.second / aspectY);
+    return builder;
+}
+
 std::shared_ptr<Drawing::RuntimeEffect> GEDispersionShaderFilter::GetDispersionEffect()
 {
     thread_local static std::shared_ptr<Drawing::RuntimeEffect> g_dispersionShader = nullptr;
@@ -52,31 +52,56 @@ std::shared_ptr<Drawing::Image> GEDisplacementDistortFilter::OnProcessImage(Draw
         return image;
     }
 
+    auto builder = MakeDisplacementDistortBuilder(shader);
+    if (!builder) {
+        return image;
+    }
+
+    auto invertedImage = builder->MakeImage(canvas.GetGPUContext().get(), &(matrix), imageInfo, false);
+    if (!invertedImage) {
+        LOGE("GEDisplacementDistortFilter::OnProcessImage make image failed");
+        return image;
+    }
+    return invertedImage;
+}
+
+std::shared_ptr<Drawing::ShaderEffect> GEDisplacementDistortFilter::MakeComposableShader(
+    const std::shared_ptr<Drawing::ShaderEffect>& input, const Drawing::ImageInfo& info)
+{
+    Drawing::Matrix matrix;
+    Drawing::Matrix invertMatrix;
+    if (!input || !GetCanvasGeometryMatrix(matrix, invertMatrix)) {
+        return nullptr;
+    }
+    if (info.GetWidth() < 1 || info.GetHeight() < 1 || params_.mask_ == nullptr) {
+        return input;
+    }
+    auto builder = MakeDisplacementDistortBuilder(MakeLocalMatrixShader(input, invertMatrix));
+    return builder ? builder->MakeShader(&matrix, false) : nullptr;
+}
+
+std::shared_ptr<Drawing::RuntimeShaderBuilder> GEDisplacementDistortFilter::MakeDisplacementDistortBuilder(
+    const std::shared_ptr<Drawing::ShaderEffect>& imageShader)
+{
     auto maskEffectShader =
         params_.mask_->GenerateDrawingShaderHasNormal(canvasInfo_.geoWidth, canvasInfo_.geoHeight);
     if (!maskEffectShader) {
-        LOGE("GEDisplacementDistortFilter::OnProcessImage maskEffectShader generate failed");
-        return image;
+        LOGE("GEDisplacementDistortFilter::MakeDisplacementDistortBuilder maskEffectShader generate failed");
+        return nullptr;
     }
 
     auto displacementDistortShader = GetDisplacementDistortEffect();
     if (!displacementDistortShader) {
-        LOGE("GEDisplacementDistortFilter::OnProcessImage g_displacementdistortShader init failed");
-        return image;
+        LOGE("GEDisplacementDistortFilter::MakeDisplacementDistortBuilder g_displacementdistortShader init failed");
+        return nullptr;
     }
 
-    Drawing::RuntimeShaderBuilder builder(displacementDistortShader);
-    builder.SetChild("image", shader);
-    builder.SetChild("maskEffect", maskEffectShader);
-    builder.SetUniform("iResolution", canvasInfo_.geoWidth, canvasInfo_.geoHeight);
-    builder.SetUniform("factor", params_.factor_.first, params_.factor_.second);
-
-    auto invertedImage = builder.MakeImage(canvas.GetGPUContext().get(), &(matrix), imageInfo, false);
-    if (!invertedImage) {
-        LOGE("GEDisplacementDistortFilter::OnProcessImage make image failed");
-        return image;
-    }
-    return invertedImage;
+    auto builder = std::make_shared<Drawing::RuntimeShaderBuilder>(displacementDistortShader);
+    builder->SetChild("image", imageShader);
+    builder->SetChild("maskEffect", maskEffectShader);
+    builder->SetUniform("iResolution", canvasInfo_.geoWidth, canvasInfo_.geoHeight);
+    builder->SetUniform("factor", params_.factor_.first, params_.factor_.second);
+    return builder;
 }
 
 std::shared_ptr<Drawing::RuntimeEffect> GEDisplacementDistortFilter::GetDisplacementDistortEffect()
@@ -182,11 +182,64 @@ static thread_local std::shared_ptr<Drawing::RuntimeEffect> g_gaussShaderEffect
 static thread_local std::shared_ptr<Drawing::RuntimeEffect> g_compShaderEffect = nullptr;
 static thread_local std::shared_ptr<Drawing::RuntimeEffect> g_addMaskEffect = nullptr;
 static thread_local std::shared_ptr<Drawing::RuntimeEffect> g_alphaShaderEffect = nullptr;
-static thread_local uint32_t g_originalImageID = 0; // When the ID is the same as the last one, the cached image is used
-static thread_local std::shared_ptr<Drawing::Image> g_afterCompositeImage = nullptr; // cache calculated image
-static thread_local Vector4f g_color; // support Hdr, maybe > 1
 } // namespace
 
+bool EdgeLightCacheKey::Matches(const EdgeLightCacheKey& other) const
+{
+    if (imageId != other.imageId || width != other.width || height != other.height ||
+        useRawColor != other.useRawColor || bloom != other.bloom || color != other.color) {
+        return false;
+    }
+    if (colorSpace == nullptr || other.colorSpace == nullptr) {
+        return colorSpace == other.colorSpace;
+    }
+    return colorSpace->Equals(other.colorSpace);
+}
+
+GEEdgeLightImageCache& GEEdgeLightImageCache::GetInstance()
+{
+    // Images belong to the GPU context of the rendering thread, so each thread keeps its own cache
+    static thread_local GEEdgeLightImageCache instance;
+    return instance;
+}
+
+std::shared_ptr<Drawing::Image> GEEdgeLightImageCache::Find(const EdgeLightCacheKey& key)
+{
+    for (auto it = entries_.begin(); it != entries_.end(); ++it) {
+        if (it->first.Matches(key)) {
+            entries_.splice(entries_.begin(), entries_, it);
+            ++stats_.hits;
+            return entries_.front().second;
+        }
+    }
+    ++stats_.misses;
+    return nullptr;
+}
+
+void GEEdgeLightImageCache::Insert(const EdgeLightCacheKey& key, const std::shared_ptr<Drawing::Image>& image)
+{
+    if (image == nullptr) {
+        return;
+    }
+    for (auto it = entries_.begin(); it != entries_.end(); ++it) {
+        if (it->first.Matches(key)) {
+            entries_.erase(it);
+            break;
+        }
+    }
+    entries_.emplace_front(key, image);
+    if (entries_.size() > MAX_ENTRIES) {
+        entries_.pop_back();
+        ++stats_.evictions;
+    }
+}
+
+void GEEdgeLightImageCache::Clear()
+{
+    entries_.clear();
+    stats_ = {};
+}
+
 bool GEEdgeLightShaderFilter::InitConvertFragShaderEffect()
 {
     if (g_convertShaderEffect != nullptr) {
@@ -569,7 +622,19 @@ GEEdgeLightShaderFilter::GEEdgeLightShaderFilter(const Drawing::GEEdgeLightShade
         LOGE("GEEdgeLightShaderFilter::GEEdgeLightShaderFilter failed when initializing Effect.");
         return;
     }
-    g_color = params.color;
+}
+
+EdgeLightCacheKey GEEdgeLightShaderFilter::MakeCacheKey(const std::shared_ptr<Drawing::Image>& image) const
+{
+    EdgeLightCacheKey key;
+    key.imageId = image->GetUniqueID();
+    key.width = image->GetWidth();
+    key.height = image->GetHeight();
+    key.color = color_;
+    key.useRawColor = useRawColor_;
+    key.bloom = bloom_;
+    key.colorSpace = image->GetImageInfo().GetColorSpace();
+    return key;
 }
 
 std::shared_ptr<Drawing::Image> GEEdgeLightShaderFilter::OnProcessImage(Drawing::Canvas &canvas,
@@ -582,10 +647,10 @@ std::shared_ptr<Drawing::Image> GEEdgeLightShaderFilter::OnProcessImage(Drawing:
         return image;
     }
 
-    LOGD("GEEdgeLightShaderFilter::OnProcessImage input imageID:%{public}d cache imageID:%{public}d.",
-        image->GetUniqueID(), g_originalImageID);
-
-    if ((g_color != color_) || (g_originalImageID != image->GetUniqueID())) {
+    auto& cache = GEEdgeLightImageCache::GetInstance();
+    auto cacheKey = MakeCacheKey(image);
+    auto blurImage = cache.Find(cacheKey);
+    if (blurImage == nullptr) {
         auto linearImage = ConvertColorSpace(canvas, image, Drawing::ColorSpace::CreateSRGBLinear());
         if (linearImage == nullptr) {
             LOGE("GEEdgeLightShaderFilter::OnProcessImage Linearize make image failed.");
@@ -596,19 +661,20 @@ std::shared_ptr<Drawing::Image> GEEdgeLightShaderFilter::OnProcessImage(Drawing:
             LOGE("GEEdgeLightShaderFilter::OnProcessImage DetectEdge make image failed.");
             return image;
         }
-        auto blurImage = GaussianBlur(canvas, detectImage);
+        blurImage = GaussianBlur(canvas, detectImage);
         if (blurImage == nullptr) {
             LOGE("GEEdgeLightShaderFilter::OnProcessImage GaussianBlur make image failed.");
             return image;
         }
-        g_color = color_;
-        g_originalImageID = image->GetUniqueID();
-        g_afterCompositeImage = blurImage;
+        cache.Insert(cacheKey, blurImage);
     } else {
-        LOGD("GEEdgeLightShaderFilter::OnProcessImage Blooming use cache image.");
+        auto stats = cache.GetStats();
+        LOGD("GEEdgeLightShaderFilter::OnProcessImage use cache image, imageID:%{public}u hits:%{public}llu "
+            "misses:%{public}llu.", cacheKey.imageId, static_cast<unsigned long long>(stats.hits),
+            static_cast<unsigned long long>(stats.misses));
     }
 
-    auto mergeImage = MergeImage(canvas, image, g_afterCompositeImage);
+    auto mergeImage = MergeImage(canvas, image, blurImage);
     if (mergeImage == nullptr) {
         LOGE("GEEdgeLightShaderFilter::OnProcessImage MergeImage make image failed.");
         return image;
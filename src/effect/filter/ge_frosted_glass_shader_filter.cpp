@@ -180,7 +180,7 @@ bool GEFrostedGlassShaderFilter::OnDrawImage(Drawing::Canvas& canvas, const std:
     canvasMatrix.PostTranslate(-canvasInfo_.materialDst.GetLeft(), -canvasInfo_.materialDst.GetTop());
     canvasMatrix.PostConcat(CreateDestinationTranslateMatrix(dst));
     auto shader = builder->MakeShader(&canvasMatrix, image->IsOpaque());
-    brush.SetShaderEffect(shader);
+    brush.SetShaderEffect(ToneMapOutput(shader));
     canvas.AttachBrush(brush);
     canvas.DrawRect(dst);
     canvas.DetachBrush();
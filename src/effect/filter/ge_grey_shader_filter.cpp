@@ -42,22 +42,17 @@ std::shared_ptr<Drawing::Image> GEGreyShaderFilter::OnProcessImage(Drawing::Canv
         return image;
     }
 
-    if (!g_greyAdjustEffect) {
-        LOGE("GEGreyShaderFilter::DrawGreyAdjustment greyAdjustEffect is null");
-        return nullptr;
-    }
-    Drawing::RuntimeShaderBuilder builder(g_greyAdjustEffect);
     Drawing::Matrix matrix;
     auto imageShader = Drawing::ShaderEffect::CreateImageShader(*image, Drawing::TileMode::CLAMP,
         Drawing::TileMode::CLAMP, Drawing::SamplingOptions(Drawing::FilterMode::LINEAR), matrix);
-
-    builder.SetChild("imageShader", imageShader);
-    builder.SetUniform("coefficient1", greyCoef1_);
-    builder.SetUniform("coefficient2", greyCoef2_);
+    auto builder = MakeGreyAdjustmentBuilder(imageShader);
+    if (builder == nullptr) {
+        return nullptr;
+    }
 #ifdef RS_ENABLE_GPU
-    auto greyImage = builder.MakeImage(canvas.GetGPUContext().get(), nullptr, image->GetImageInfo(), false);
+    auto greyImage = builder->MakeImage(canvas.GetGPUContext().get(), nullptr, image->GetImageInfo(), false);
 #else
-    auto greyImage = builder.MakeImage(nullptr, nullptr, image->GetImageInfo(), false);
+    auto greyImage = builder->MakeImage(nullptr, nullptr, image->GetImageInfo(), false);
 #endif
     if (greyImage == nullptr) {
         LOGE("DrawGreyAdjustment successful");
@@ -66,6 +61,30 @@ std::shared_ptr<Drawing::Image> GEGreyShaderFilter::OnProcessImage(Drawing::Canv
     return greyImage;
 };
 
+std::shared_ptr<Drawing::ShaderEffect> GEGreyShaderFilter::MakeComposableShader(
+    const std::shared_ptr<Drawing::ShaderEffect>& input, const Drawing::ImageInfo& info)
+{
+    if (input == nullptr) {
+        return nullptr;
+    }
+    auto builder = MakeGreyAdjustmentBuilder(input);
+    return builder != nullptr ? builder->MakeShader(nullptr, false) : nullptr;
+}
+
+std::shared_ptr<Drawing::RuntimeShaderBuilder> GEGreyShaderFilter::MakeGreyAdjustmentBuilder(
+    const std::shared_ptr<Drawing::ShaderEffect>& imageShader)
+{
+    if (!g_greyAdjustEffect) {
+        LOGE("GEGreyShaderFilter::MakeGreyAdjustmentBuilder greyAdjustEffect is null");
+        return nullptr;
+    }
+    auto builder = std::make_shared<Drawing::RuntimeShaderBuilder>(g_greyAdjustEffect);
+    builder->SetChild("imageShader", imageShader);
+    builder->SetUniform("coefficient1", greyCoef1_);
+    builder->SetUniform("coefficient2", greyCoef2_);
+    return builder;
+}
+
 bool GEGreyShaderFilter::InitGreyAdjustmentEffect()
 {
     if (g_greyAdjustEffect != nullptr) {
@@ -104,7 +123,7 @@ bool GEGreyShaderFilter::InitGreyAdjustmentEffect()
         }
 
         half4 main(float2 coord) {
-            vec3 color = vec3(imageShader.eval(coord).r, imageShader.eval(coord).g, imageShader.eval(coord).b);
+            vec3 color = imageShader.eval(coord).rgb;
             float Y = (0.299 * color.r + 0.587 * color.g + 0.114 * color.b) * 255;
             float U = (-0.147 * color.r - 0.289 * color.g + 0.436 * color.b) * 255;
             float V = (0.615 * color.r - 0.515 * color.g - 0.100 * color.b) * 255;
@@ -17,6 +17,7 @@
 
 #include "draw/surface.h"
 #include "ge_log.h"
+#include "ge_warp_mesh.h"
 
 namespace OHOS {
 namespace Rosen {
@@ -134,6 +135,16 @@ std::shared_ptr<Drawing::Image> GEGridWarpShaderFilter::OnProcessImage(Drawing::
         LOGE("GEGridWarpShaderFilter::OnProcessImage imageinfo is invalid");
         return nullptr;
     }
+    if (GEWarpMesh::IsRasterCanvas(canvas) && GEWarpMesh::IsRasterizable(*image)) {
+        // Raster canvases reuse the tessellated patches instead of tessellating them on every draw
+        std::vector<GEWarpMesh::Patch> patches(GRID_NUM);
+        const auto unitTexCoords = CalcTexCoords(1, 1);
+        for (size_t i = 0; i < GRID_NUM; i++) {
+            patches[i] = { bezierPatch_[i], unitTexCoords[i] };
+        }
+        return GEWarpMesh::Get(patches)->Rasterize(*image, static_cast<int32_t>(dst.GetWidth()),
+            static_cast<int32_t>(dst.GetHeight()));
+    }
     auto brush = GetBrush(image);
 
     std::array<std::array<Drawing::Point, GRID_TEXTURE_COORDS_NUM>, GRID_NUM> texCoords =
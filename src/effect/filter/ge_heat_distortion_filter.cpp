@@ -53,24 +53,12 @@ std::shared_ptr<Drawing::Image> GEHeatDistortionFilter::OnProcessImage(Drawing::
         return image;
     }
 
-    auto heatDistortionShader = GetHeatDistortionEffect();
-    if (heatDistortionShader == nullptr) {
-        LOGE("GEHeatDistortionFilter::OnProcessImage heatDistortion shader init failed");
+    auto builder = MakeHeatDistortionBuilder(shader, width, height);
+    if (builder == nullptr) {
         return image;
     }
 
-    CheckHeatDistortionParams();
-
-    Drawing::RuntimeShaderBuilder builder(heatDistortionShader);
-    builder.SetChild("image", shader);
-    builder.SetUniform("iResolution", width, height);
-    builder.SetUniform("progress", progress_ * timeScale_);
-
-    builder.SetUniform("intensity", intensity_ * intensityScale_);
-    builder.SetUniform("noiseScale", noiseScale_);
-    builder.SetUniform("riseWeight", riseWeight_);
-
-    auto distortedImage = builder.MakeImage(canvas.GetGPUContext().get(), &(matrix), imageInfo, false);
+    auto distortedImage = builder->MakeImage(canvas.GetGPUContext().get(), &(matrix), imageInfo, false);
     if (distortedImage == nullptr) {
         LOGE("GEHeatDistortionFilter::OnProcessImage make image failed");
         return image;
@@ -78,6 +66,44 @@ std::shared_ptr<Drawing::Image> GEHeatDistortionFilter::OnProcessImage(Drawing::
     return distortedImage;
 }
 
+std::shared_ptr<Drawing::ShaderEffect> GEHeatDistortionFilter::MakeComposableShader(
+    const std::shared_ptr<Drawing::ShaderEffect>& input, const Drawing::ImageInfo& info)
+{
+    Drawing::Matrix matrix;
+    Drawing::Matrix invertMatrix;
+    if (input == nullptr || !GetCanvasGeometryMatrix(matrix, invertMatrix)) {
+        return nullptr;
+    }
+    if (info.GetWidth() < 1 || info.GetHeight() < 1) {
+        return input;
+    }
+    auto builder = MakeHeatDistortionBuilder(MakeLocalMatrixShader(input, invertMatrix), info.GetWidth(),
+        info.GetHeight());
+    return builder != nullptr ? builder->MakeShader(&matrix, false) : nullptr;
+}
+
+std::shared_ptr<Drawing::RuntimeShaderBuilder> GEHeatDistortionFilter::MakeHeatDistortionBuilder(
+    const std::shared_ptr<Drawing::ShaderEffect>& imageShader, float width, float height)
+{
+    auto heatDistortionShader = GetHeatDistortionEffect();
+    if (heatDistortionShader == nullptr) {
+        LOGE("GEHeatDistortionFilter::MakeHeatDistortionBuilder heatDistortion shader init failed");
+        return nullptr;
+    }
+
+    CheckHeatDistortionParams();
+
+    auto builder = std::make_shared<Drawing::RuntimeShaderBuilder>(heatDistortionShader);
+    builder->SetChild("image", imageShader);
+    builder->SetUniform("iResolution", width, height);
+    builder->SetUniform("progress", progress_ * timeScale_);
+
+    builder->SetUniform("intensity", intensity_ * intensityScale_);
+    builder->SetUniform("noiseScale", noiseScale_);
+    builder->SetUniform("riseWeight", riseWeight_);
+    return builder;
+}
+
 void GEHeatDistortionFilter::CheckHeatDistortionParams()
 {
     intensity_ = std::clamp(intensity_, 0.0f, 1.0f);
@@ -15,7 +15,10 @@
 
 #include "ge_kawase_blur_shader_filter.h"
 
+#include "ge_feature_flags.h"
+#include "ge_intermediate_format.h"
 #include "ge_log.h"
+#include "ge_quality_governor.h"
 #include "ge_shader_diagnostics.h"
 #include "ge_system_properties.h"
 #include "src/core/SkOpts.h"
@@ -26,9 +29,6 @@ namespace OHOS {
 namespace Rosen {
 // Advanced Filter
 #define PROPERTY_HIGPU_VERSION "const.gpu.vendor"
-#define PROPERTY_DEBUG_SUPPORT_AF "persist.sys.graphic.supports_af"
-#define PROPERTY_BLUR_EXTRA_FILTER "persist.sys.graphic.blurExtraFilter"
-#define PROPERTY_KAWASE_ORIGINAL_IMAGE "persist.sys.graphic.kawaseOriginalEnable"
 
 namespace {
 constexpr uint32_t BLUR_SAMPLE_COUNT = 5;
@@ -62,25 +62,17 @@ static bool IsAdvancedFilterUsable()
     }
     // If persist.sys.graphic.supports_af=0
     // we will not use it
-    return GESystemProperties::GetBoolSystemProperty(PROPERTY_DEBUG_SUPPORT_AF, false);
+    return GEFeatureFlags::GetInstance().IsEnabled(GEFeatureFlag::SUPPORTS_AF);
 }
 
 static bool GetBlurExtraFilterEnabled()
 {
-    static bool blurExtraFilterEnabled =
-        (std::atoi(GESystemProperties::GetEventProperty(PROPERTY_BLUR_EXTRA_FILTER).c_str()) != 0);
-    return blurExtraFilterEnabled;
+    return GEFeatureFlags::GetInstance().IsEnabled(GEFeatureFlag::BLUR_EXTRA_FILTER);
 }
 
 static bool GetKawaseOriginalEnabled()
 {
-#ifdef GE_OHOS
-    static bool kawaseOriginalEnabled =
-        (std::atoi(GESystemProperties::GetEventProperty(PROPERTY_KAWASE_ORIGINAL_IMAGE).c_str()) != 0);
-    return kawaseOriginalEnabled;
-#else
-    return false;
-#endif
+    return GEFeatureFlags::GetInstance().IsEnabled(GEFeatureFlag::KAWASE_ORIGINAL_IMAGE);
 }
 
 void GEKawaseBlurShaderFilter::GetNormalizedOffset(
@@ -192,8 +184,8 @@ std::shared_ptr<Drawing::Image> GEKawaseBlurShaderFilter::OnProcessImage(Drawing
     auto width = std::max(static_cast<int>(std::ceil(dst.GetWidth())), input->GetWidth());
     auto height = std::max(static_cast<int>(std::ceil(dst.GetHeight())), input->GetHeight());
     auto originImageInfo = input->GetImageInfo();
-    auto scaledInfo = Drawing::ImageInfo(std::ceil(width * blurScale_), std::ceil(height * blurScale_),
-        originImageInfo.GetColorType(), originImageInfo.GetAlphaType(), originImageInfo.GetColorSpace());
+    auto scaledInfo = GEIntermediateFormat::MakeImageInfo(std::ceil(width * blurScale_), std::ceil(height * blurScale_),
+        originImageInfo, GEIntermediateFormat::Usage::COLOR, supportHeadroom_);
     Drawing::Matrix blurMatrix = BuildMatrix(src, scaledInfo, input);
     Drawing::SamplingOptions linear(Drawing::FilterMode::LINEAR, Drawing::MipmapMode::NONE);
 
@@ -546,6 +538,11 @@ void GEKawaseBlurShaderFilter::AdjustRadiusAndScale()
     } else {
         blurScale_ = BASE_BLUR_SCALE;
     }
+    // Extra down-sampling while the effect budget is exceeded, offsets are derived from blurScale_
+    const int degradeSteps = GEQualityGovernor::GetInstance().GetDegradeSteps();
+    for (int step = 0; step < degradeSteps && blurScale_ > scaleFactor3; ++step) {
+        blurScale_ *= 0.5f; // 0.5 : one down-sampling step
+    }
 }
 
 std::string GEKawaseBlurShaderFilter::GetDescription() const
@@ -15,9 +15,11 @@
 
 #include "ge_mesa_blur_shader_filter.h"
 
+#include "ge_feature_flags.h"
+#include "ge_intermediate_format.h"
 #include "ge_log.h"
+#include "ge_quality_governor.h"
 #include "ge_shader_diagnostics.h"
-#include "ge_system_properties.h"
 #include "src/core/SkOpts.h"
 
 #include "effect/color_matrix.h"
@@ -26,14 +28,7 @@
 
 namespace OHOS {
 namespace Rosen {
-#define PROPERTY_KAWASE_ORIGINAL_IMAGE "persist.sys.graphic.kawaseOriginalEnable"
-#define PROPERTY_SIMPLIFIED_MESA_ENABLED "persist.sys.graphic.simplifiedMesaEnable"
-#ifdef GE_OHOS
-int GEMESABlurShaderFilter::g_isSimpleX = (std::atoi(
-    GESystemProperties::GetEventProperty(PROPERTY_SIMPLIFIED_MESA_ENABLED).c_str()));
-#else
-int GEMESABlurShaderFilter::g_isSimpleX = 0;
-#endif
+int GEMESABlurShaderFilter::g_isSimpleX = GEFeatureFlags::GetInstance().GetInt(GEFeatureFlag::SIMPLIFIED_MESA);
 
 namespace {
 static constexpr float BASE_BLUR_SCALE = 0.5f; // 0.5: base downSample radio
@@ -94,13 +89,7 @@ static const std::vector<std::vector<float>> offsetTableFivePasses = {
 
 static bool GetKawaseOriginalEnabled()
 {
-#ifdef GE_OHOS
-    static bool kawaseOriginalEnabled =
-        (std::atoi(GESystemProperties::GetEventProperty(PROPERTY_KAWASE_ORIGINAL_IMAGE).c_str()) != 0);
-    return kawaseOriginalEnabled;
-#else
-    return false;
-#endif
+    return GEFeatureFlags::GetInstance().IsEnabled(GEFeatureFlag::KAWASE_ORIGINAL_IMAGE);
 }
 
 GEMESABlurShaderFilter::GEMESABlurShaderFilter(const Drawing::GEMESABlurShaderFilterParams& params)
@@ -144,12 +133,33 @@ void GEMESABlurShaderFilter::SetMesaModeByCCM(int mode)
 bool GEMESABlurShaderFilter::SetBlurParams(NewBlurParams& bParam)
 {
     bool isSuccess = SetGeneralBlurParams(bParam);
+    if (isSuccess) {
+        ApplyQualityLevel(bParam);
+    }
     if ((blurRadius_ >= BLUR_RADIUS[1]) && (tileMode_ == Drawing::TileMode::MIRROR)) {
         isStretchX_ = PixelStretchFuzedMode::BEFORE_BLUR;
     }
     return isSuccess;
 }
 
+void GEMESABlurShaderFilter::ApplyQualityLevel(NewBlurParams& bParam)
+{
+    // Frosted glass aligns its blur image on the scale steps, keep its quality
+    if (isFrostedGlassBlur_) {
+        return;
+    }
+    // Each degrade step halves the down-sampling scale, offsets are in scaled pixels so they are halved as well
+    const int degradeSteps = GEQualityGovernor::GetInstance().GetDegradeSteps();
+    int stride = 2;     // 2: stride
+    for (int step = 0; step < degradeSteps && blurScale_ > BLUR_SCALE_4; ++step) {
+        blurScale_ *= 0.5f;     // 0.5: one down-sampling step
+        for (int i = 0; i < bParam.numberOfPasses; i++) {
+            bParam.offsets[stride * i] *= 0.5f;     // 0.5: one down-sampling step
+            bParam.offsets[stride * i + 1] *= 0.5f; // 0.5: one down-sampling step
+        }
+    }
+}
+
 bool GEMESABlurShaderFilter::SetBlurParamsHelper(NewBlurParams& bParam,
     const std::vector<std::vector<float>>& offsetTable, float st, float ed)
 {
@@ -462,8 +472,8 @@ std::shared_ptr<Drawing::Image> GEMESABlurShaderFilter::DownSamplingFuzedBlur(Dr
     }
     std::shared_ptr<Drawing::ShaderEffect> tmpShader;
     auto originImageInfo = input->GetImageInfo();
-    auto middleInfo = Drawing::ImageInfo(std::ceil(width * BLUR_SCALE_1), std::ceil(height * BLUR_SCALE_1),
-        originImageInfo.GetColorType(), originImageInfo.GetAlphaType(), originImageInfo.GetColorSpace());
+    auto middleInfo = GEIntermediateFormat::MakeImageInfo(std::ceil(width * BLUR_SCALE_1),
+        std::ceil(height * BLUR_SCALE_1), originImageInfo, GEIntermediateFormat::Usage::COLOR, supportHeadroom_);
     if (GE_GNE(blurScale_, BLUR_SCALE_1)) {
         tmpShader = DownSampling2X(canvas, blurBuilder, input, src, scaledInfo, linear);
     } else if (GE_GNE(blurScale_, BLUR_SCALE_2)) {
@@ -471,8 +481,8 @@ std::shared_ptr<Drawing::Image> GEMESABlurShaderFilter::DownSamplingFuzedBlur(Dr
     } else if (GE_GNE(blurScale_, BLUR_SCALE_3)) {
         tmpShader = DownSampling8X(canvas, blurBuilder, input, src, scaledInfo, middleInfo, linear);
     } else {
-        auto middleInfo2 = Drawing::ImageInfo(std::ceil(width * BLUR_SCALE_3), std::ceil(height * BLUR_SCALE_3),
-            originImageInfo.GetColorType(), originImageInfo.GetAlphaType(), originImageInfo.GetColorSpace());
+        auto middleInfo2 = GEIntermediateFormat::MakeImageInfo(std::ceil(width * BLUR_SCALE_3),
+            std::ceil(height * BLUR_SCALE_3), originImageInfo, GEIntermediateFormat::Usage::COLOR, supportHeadroom_);
         tmpShader = DownSamplingMoreX(canvas, blurBuilder, input, src, scaledInfo, middleInfo, middleInfo2, linear);
     }
     if (!tmpShader) {
@@ -527,8 +537,8 @@ Drawing::ImageInfo GEMESABlurShaderFilter::ComputeImageInfo(const Drawing::Image
             height = height % 4 ? height - height % 4 + 4 : height;
         }
     }
-    return Drawing::ImageInfo(std::ceil(width * blurScale_), std::ceil(height * blurScale_),
-        originImageInfo.GetColorType(), originImageInfo.GetAlphaType(), originImageInfo.GetColorSpace());
+    return GEIntermediateFormat::MakeImageInfo(std::ceil(width * blurScale_), std::ceil(height * blurScale_),
+        originImageInfo, GEIntermediateFormat::Usage::COLOR, supportHeadroom_);
 }
 
 std::pair<float, float> GEMESABlurShaderFilter::AngleToDirection(float angle)
@@ -603,8 +613,8 @@ std::shared_ptr<Drawing::Image> GEMESABlurShaderFilter::DownSamplingForEdge(Draw
     auto width = input->GetWidth();
     auto height = input->GetHeight();
     auto originImageInfo = input->GetImageInfo();
-    auto scaledInfo = Drawing::ImageInfo(std::ceil(width * factor), std::ceil(height * factor),
-        originImageInfo.GetColorType(), originImageInfo.GetAlphaType(), originImageInfo.GetColorSpace());
+    auto scaledInfo = GEIntermediateFormat::MakeImageInfo(std::ceil(width * factor), std::ceil(height * factor),
+        originImageInfo, GEIntermediateFormat::Usage::COLOR, supportHeadroom_);
     if (scaledInfo.GetWidth() <= 0 || scaledInfo.GetHeight() <= 0) {
         LOGE("GEMESABlurShaderFilter::DownSamplingForEdge invalid scaledInfo dimensions");
         return nullptr;
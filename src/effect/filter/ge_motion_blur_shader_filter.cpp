@@ -19,6 +19,7 @@
 #include <cmath>
 
 #include "draw/surface.h"
+#include "ge_intermediate_format.h"
 #include "ge_log.h"
 #include "ge_shader_diagnostics.h"
 
@@ -28,9 +29,13 @@ namespace Rosen {
 namespace {
 constexpr int32_t MAX_SAMPLE_COUNT = 50;
 constexpr int32_t MIN_SAMPLE_COUNT = 1;
+constexpr int MAX_MULTI_RES_LEVEL = 2; // 0.5, 0.25 and 0.125 scales
+constexpr float EDGE_SHARPNESS = 32.0f;
 }
 
 thread_local static std::shared_ptr<Drawing::RuntimeEffect> g_motionBlurEffect = nullptr;
+thread_local static std::shared_ptr<Drawing::RuntimeEffect> g_downSampleEffect = nullptr;
+thread_local static std::shared_ptr<Drawing::RuntimeEffect> g_edgeAwareUpscaleEffect = nullptr;
 
 GEMotionBlurShaderFilter::GEMotionBlurShaderFilter(const Drawing::GEMotionBlurShaderFilterParams& params)
     : radius_(params.radius), anchor_(params.anchor), sampleCount_(params.sampleCount)
@@ -42,6 +47,10 @@ GEMotionBlurShaderFilter::GEMotionBlurShaderFilter(const Drawing::GEMotionBlurSh
 
     anchor_[0] = std::clamp(anchor_[0], 0.0f, 1.0f);
     anchor_[1] = std::clamp(anchor_[1], 0.0f, 1.0f);
+
+    if (params.mode == static_cast<int32_t>(Mode::MULTI_RESOLUTION)) {
+        mode_ = Mode::MULTI_RESOLUTION;
+    }
 }
 
 std::shared_ptr<Drawing::RuntimeEffect> GEMotionBlurShaderFilter::GetMotionBlurEffect()
@@ -89,9 +98,82 @@ std::shared_ptr<Drawing::RuntimeEffect> GEMotionBlurShaderFilter::GetMotionBlurE
     return g_motionBlurEffect;
 }
 
+std::shared_ptr<Drawing::RuntimeEffect> GEMotionBlurShaderFilter::GetDownSampleEffect()
+{
+    if (g_downSampleEffect == nullptr) {
+        // Four bilinear taps spread over the footprint of one low resolution pixel
+        static const char* downSampleProg = R"(
+            uniform shader srcImageShader;
+
+            half4 main(float2 coord)
+            {
+                half4 color = srcImageShader.eval(coord + float2(-0.25, -0.25));
+                color += srcImageShader.eval(coord + float2(0.25, -0.25));
+                color += srcImageShader.eval(coord + float2(-0.25, 0.25));
+                color += srcImageShader.eval(coord + float2(0.25, 0.25));
+                return color * 0.25;
+            }
+        )";
+        g_downSampleEffect = GECreateRuntimeEffectForShader(downSampleProg);
+        if (g_downSampleEffect == nullptr) {
+            LOGE("GEMotionBlurShaderFilter::GetDownSampleEffect create failed");
+            return nullptr;
+        }
+    }
+    return g_downSampleEffect;
+}
+
+std::shared_ptr<Drawing::RuntimeEffect> GEMotionBlurShaderFilter::GetEdgeAwareUpscaleEffect()
+{
+    if (g_edgeAwareUpscaleEffect == nullptr) {
+        // Joint bilateral upsampling: the four low resolution neighbours are weighted by their bilinear weight and by
+        // how closely the down-sampled source matches the full resolution source at the output pixel
+        static const char* upscaleProg = R"(
+            uniform shader blurImage;
+            uniform shader lowResImage;
+            uniform shader srcImage;
+            uniform float scale;
+            uniform float sharpness;
+
+            float RangeWeight(half4 guide, float2 tap)
+            {
+                half4 diff = lowResImage.eval(tap) - guide;
+                return max(exp(-dot(diff, diff) * sharpness), 0.001);
+            }
+
+            half4 main(float2 coord)
+            {
+                half4 guide = srcImage.eval(coord);
+                float2 lowResCoord = coord * scale - 0.5;
+                float2 base = floor(lowResCoord) + 0.5;
+                float2 f = fract(lowResCoord);
+
+                float2 tap00 = base;
+                float2 tap10 = base + float2(1.0, 0.0);
+                float2 tap01 = base + float2(0.0, 1.0);
+                float2 tap11 = base + float2(1.0, 1.0);
+                float w00 = (1.0 - f.x) * (1.0 - f.y) * RangeWeight(guide, tap00);
+                float w10 = f.x * (1.0 - f.y) * RangeWeight(guide, tap10);
+                float w01 = (1.0 - f.x) * f.y * RangeWeight(guide, tap01);
+                float w11 = f.x * f.y * RangeWeight(guide, tap11);
+
+                half4 color = blurImage.eval(tap00) * w00 + blurImage.eval(tap10) * w10 +
+                    blurImage.eval(tap01) * w01 + blurImage.eval(tap11) * w11;
+                return color / max(w00 + w10 + w01 + w11, 0.0001);
+            }
+        )";
+        g_edgeAwareUpscaleEffect = GECreateRuntimeEffectForShader(upscaleProg);
+        if (g_edgeAwareUpscaleEffect == nullptr) {
+            LOGE("GEMotionBlurShaderFilter::GetEdgeAwareUpscaleEffect create failed");
+            return nullptr;
+        }
+    }
+    return g_edgeAwareUpscaleEffect;
+}
+
 std::shared_ptr<Drawing::RuntimeShaderBuilder> GEMotionBlurShaderFilter::MakeMotionBlurShader(
-    std::shared_ptr<Drawing::ShaderEffect> srcImageShader,
-    const Vector2f& scaleAnchor, const Vector2f& scaleSize, const Vector2f& rectOffset) const
+    std::shared_ptr<Drawing::ShaderEffect> srcImageShader, const Vector2f& scaleAnchor,
+    const Vector2f& scaleSize, const Vector2f& rectOffset, int32_t sampleCount) const
 {
     auto effect = GetMotionBlurEffect();
     if (effect == nullptr) {
@@ -104,7 +186,7 @@ std::shared_ptr<Drawing::RuntimeShaderBuilder> GEMotionBlurShaderFilter::MakeMot
     builder->SetUniform("scaleSize", scaleSize[0], scaleSize[1]);
     builder->SetUniform("rectOffset", rectOffset[0], rectOffset[1]);
     builder->SetUniform("radius", radius_);
-    builder->SetUniform("sampleCount", sampleCount_);
+    builder->SetUniform("sampleCount", static_cast<float>(sampleCount));
     return builder;
 }
 
@@ -157,6 +239,37 @@ bool GEMotionBlurShaderFilter::RectValid(const Drawing::Rect& rect1, const Drawi
     return true;
 }
 
+float GEMotionBlurShaderFilter::GetMotionLength(const Vector2f& rectOffset, const Vector2f& scaleSize,
+    const Vector2f& scaleAnchorCoord, float width, float height, float radius)
+{
+    // The trail of a pixel is (coord - anchor) * (scaleSize - 1) * radius + rectOffset * radius, longest at a corner
+    float maxLength = 0.0f;
+    for (float x : { 0.0f, width }) {
+        for (float y : { 0.0f, height }) {
+            float dx = ((x - scaleAnchorCoord[0]) * (scaleSize[0] - 1.0f) + rectOffset[0]) * radius;
+            float dy = ((y - scaleAnchorCoord[1]) * (scaleSize[1] - 1.0f) + rectOffset[1]) * radius;
+            maxLength = std::max(maxLength, std::sqrt(dx * dx + dy * dy));
+        }
+    }
+    return maxLength;
+}
+
+float GEMotionBlurShaderFilter::GetMultiResScale(float motionLength)
+{
+    if (motionLength < MULTI_RES_MOTION_PER_LEVEL) {
+        return FLOAT_IMAGE_SCALE;
+    }
+    int level = std::min(static_cast<int>(std::floor(std::log2(motionLength / MULTI_RES_MOTION_PER_LEVEL))),
+        MAX_MULTI_RES_LEVEL);
+    return std::max(FLOAT_IMAGE_SCALE / static_cast<float>(1 << level), MIN_MULTI_RES_SCALE);
+}
+
+int32_t GEMotionBlurShaderFilter::GetAdaptiveSampleCount(float lowResMotionLength, int32_t maxSampleCount)
+{
+    int32_t count = static_cast<int32_t>(std::ceil(lowResMotionLength / MULTI_RES_SAMPLE_SPACING));
+    return std::clamp(count, MIN_SAMPLE_COUNT, std::clamp(maxSampleCount, MIN_SAMPLE_COUNT, MAX_SAMPLE_COUNT));
+}
+
 bool GEMotionBlurShaderFilter::ValidateInput(const std::shared_ptr<Drawing::Image>& image) const
 {
     if (!image || image->GetWidth() == 0 || image->GetHeight() == 0) {
@@ -192,18 +305,17 @@ std::shared_ptr<Drawing::Image> GEMotionBlurShaderFilter::CreateBlurImage(Drawin
         Drawing::TileMode::DECAL, Drawing::TileMode::DECAL,
         Drawing::SamplingOptions(Drawing::FilterMode::LINEAR), inputMatrix);
 
-    auto builder = MakeMotionBlurShader(imageShader, scaleAnchorCoord, scaleSize, rectOffset);
+    auto builder = MakeMotionBlurShader(imageShader, scaleAnchorCoord, scaleSize, rectOffset, sampleCount_);
     if (builder == nullptr) {
         LOGE("GEMotionBlurShaderFilter::OnProcessImage shader builder is nullptr");
         return nullptr;
     }
 
     auto originImageInfo = image->GetImageInfo();
-    auto scaledInfo = Drawing::ImageInfo(
+    auto scaledInfo = GEIntermediateFormat::MakeImageInfo(
         static_cast<int>(std::ceil(image->GetWidth() * FLOAT_IMAGE_SCALE)),
         static_cast<int>(std::ceil(image->GetHeight() * FLOAT_IMAGE_SCALE)),
-        originImageInfo.GetColorType(), originImageInfo.GetAlphaType(),
-        originImageInfo.GetColorSpace());
+        originImageInfo, GEIntermediateFormat::Usage::COLOR, supportHeadroom_);
 
 #ifdef RS_ENABLE_GPU
     auto tmpBlur = builder->MakeImage(canvas.GetGPUContext().get(), nullptr, scaledInfo, false);
@@ -262,6 +374,132 @@ std::shared_ptr<Drawing::Image> GEMotionBlurShaderFilter::CreateUpscaledImage(Dr
     return offscreenSurface->GetImageSnapshot();
 }
 
+std::shared_ptr<Drawing::Image> GEMotionBlurShaderFilter::GetLowResImage(Drawing::Canvas& canvas,
+    const std::shared_ptr<Drawing::Image>& image, float scale)
+{
+    int width = std::max(static_cast<int>(std::ceil(image->GetWidth() * scale)), 1);
+    int height = std::max(static_cast<int>(std::ceil(image->GetHeight() * scale)), 1);
+    auto originImageInfo = image->GetImageInfo();
+    auto lowResInfo = GEIntermediateFormat::MakeImageInfo(width, height, originImageInfo,
+        GEIntermediateFormat::Usage::COLOR, supportHeadroom_);
+    // Transitions usually move a snapshot that does not change between frames, the down-sampled copy is reused
+    if (lowResImage_ != nullptr && lowResImageId_ == image->GetUniqueID() &&
+        lowResImage_->GetWidth() == width && lowResImage_->GetHeight() == height &&
+        lowResImage_->GetImageInfo().GetColorType() == lowResInfo.GetColorType()) {
+        return lowResImage_;
+    }
+
+    auto effect = GetDownSampleEffect();
+    if (effect == nullptr) {
+        return nullptr;
+    }
+    Drawing::Matrix matrix;
+    matrix.PostScale(scale, scale);
+    auto imageShader = Drawing::ShaderEffect::CreateImageShader(*image,
+        Drawing::TileMode::CLAMP, Drawing::TileMode::CLAMP,
+        Drawing::SamplingOptions(Drawing::FilterMode::LINEAR), matrix);
+    auto builder = std::make_shared<Drawing::RuntimeShaderBuilder>(effect);
+    builder->SetChild("srcImageShader", imageShader);
+
+#ifdef RS_ENABLE_GPU
+    auto lowResImage = builder->MakeImage(canvas.GetGPUContext().get(), nullptr, lowResInfo, false);
+#else
+    auto lowResImage = builder->MakeImage(nullptr, nullptr, lowResInfo, false);
+#endif
+    if (lowResImage == nullptr) {
+        LOGE("GEMotionBlurShaderFilter::GetLowResImage low resolution image is nullptr");
+        return nullptr;
+    }
+    lowResImage_ = lowResImage;
+    lowResImageId_ = image->GetUniqueID();
+    return lowResImage_;
+}
+
+std::shared_ptr<Drawing::Image> GEMotionBlurShaderFilter::CreateLowResBlurImage(Drawing::Canvas& canvas,
+    const std::shared_ptr<Drawing::Image>& lowResImage, const Vector2f& rectOffset,
+    const Vector2f& scaleSize, const Vector2f& scaleAnchorCoord, int32_t sampleCount) const
+{
+    Drawing::Matrix matrix;
+    auto imageShader = Drawing::ShaderEffect::CreateImageShader(*lowResImage,
+        Drawing::TileMode::DECAL, Drawing::TileMode::DECAL,
+        Drawing::SamplingOptions(Drawing::FilterMode::LINEAR), matrix);
+    auto builder = MakeMotionBlurShader(imageShader, scaleAnchorCoord, scaleSize, rectOffset, sampleCount);
+    if (builder == nullptr) {
+        LOGE("GEMotionBlurShaderFilter::CreateLowResBlurImage shader builder is nullptr");
+        return nullptr;
+    }
+#ifdef RS_ENABLE_GPU
+    auto blurImage = builder->MakeImage(canvas.GetGPUContext().get(), nullptr, lowResImage->GetImageInfo(), false);
+#else
+    auto blurImage = builder->MakeImage(nullptr, nullptr, lowResImage->GetImageInfo(), false);
+#endif
+    if (blurImage == nullptr) {
+        LOGE("GEMotionBlurShaderFilter::CreateLowResBlurImage blur image is nullptr");
+    }
+    return blurImage;
+}
+
+std::shared_ptr<Drawing::Image> GEMotionBlurShaderFilter::CreateEdgeAwareUpscaledImage(Drawing::Canvas& canvas,
+    const std::shared_ptr<Drawing::Image>& image, const std::shared_ptr<Drawing::Image>& lowResImage,
+    const std::shared_ptr<Drawing::Image>& blurImage, float scale) const
+{
+    auto effect = GetEdgeAwareUpscaleEffect();
+    if (effect == nullptr) {
+        return nullptr;
+    }
+    // Taps are placed on texel centers, nearest sampling reads them without extra filtering
+    Drawing::SamplingOptions nearest(Drawing::FilterMode::NEAREST, Drawing::MipmapMode::NONE);
+    Drawing::Matrix matrix;
+    auto blurShader = Drawing::ShaderEffect::CreateImageShader(*blurImage,
+        Drawing::TileMode::CLAMP, Drawing::TileMode::CLAMP, nearest, matrix);
+    auto lowResShader = Drawing::ShaderEffect::CreateImageShader(*lowResImage,
+        Drawing::TileMode::CLAMP, Drawing::TileMode::CLAMP, nearest, matrix);
+    auto srcShader = Drawing::ShaderEffect::CreateImageShader(*image,
+        Drawing::TileMode::CLAMP, Drawing::TileMode::CLAMP, nearest, matrix);
+
+    auto builder = std::make_shared<Drawing::RuntimeShaderBuilder>(effect);
+    builder->SetChild("blurImage", blurShader);
+    builder->SetChild("lowResImage", lowResShader);
+    builder->SetChild("srcImage", srcShader);
+    builder->SetUniform("scale", scale);
+    builder->SetUniform("sharpness", EDGE_SHARPNESS);
+#ifdef RS_ENABLE_GPU
+    auto upscaledImage = builder->MakeImage(canvas.GetGPUContext().get(), nullptr, image->GetImageInfo(), false);
+#else
+    auto upscaledImage = builder->MakeImage(nullptr, nullptr, image->GetImageInfo(), false);
+#endif
+    if (upscaledImage == nullptr) {
+        LOGE("GEMotionBlurShaderFilter::CreateEdgeAwareUpscaledImage upscaled image is nullptr");
+    }
+    return upscaledImage;
+}
+
+std::shared_ptr<Drawing::Image> GEMotionBlurShaderFilter::ProcessMultiResolution(Drawing::Canvas& canvas,
+    const std::shared_ptr<Drawing::Image>& image, const Drawing::Rect& curRect,
+    const Vector2f& rectOffset, const Vector2f& scaleSize, const Vector2f& scaleAnchorCoord)
+{
+    // CalculateRect works at FLOAT_IMAGE_SCALE, the motion length is measured in full resolution pixels
+    float motionLength = GetMotionLength(rectOffset, scaleSize, scaleAnchorCoord,
+        curRect.GetWidth() * FLOAT_IMAGE_SCALE, curRect.GetHeight() * FLOAT_IMAGE_SCALE, radius_) / FLOAT_IMAGE_SCALE;
+    float scale = GetMultiResScale(motionLength);
+    float toLowRes = scale / FLOAT_IMAGE_SCALE;
+    Vector2f lowResOffset(rectOffset[0] * toLowRes, rectOffset[1] * toLowRes);
+    Vector2f lowResAnchor(scaleAnchorCoord[0] * toLowRes, scaleAnchorCoord[1] * toLowRes);
+    int32_t sampleCount = GetAdaptiveSampleCount(motionLength * scale, sampleCount_);
+
+    auto lowResImage = GetLowResImage(canvas, image, scale);
+    if (lowResImage == nullptr) {
+        return nullptr;
+    }
+    auto blurImage = CreateLowResBlurImage(canvas, lowResImage, lowResOffset, scaleSize, lowResAnchor, sampleCount);
+    if (blurImage == nullptr) {
+        return nullptr;
+    }
+    LOGD("GEMotionBlurShaderFilter::ProcessMultiResolution motion %{public}f scale %{public}f samples %{public}d",
+        motionLength, scale, sampleCount);
+    return CreateEdgeAwareUpscaledImage(canvas, image, lowResImage, blurImage, scale);
+}
+
 void GEMotionBlurShaderFilter::UpdateCache(const Drawing::Rect& rect)
 {
     MotionBlurCacheData newCacheData;
@@ -269,6 +507,9 @@ void GEMotionBlurShaderFilter::UpdateCache(const Drawing::Rect& rect)
     newCacheData.radius = radius_;
     newCacheData.anchor = anchor_;
     newCacheData.sampleCount = sampleCount_;
+    newCacheData.mode = static_cast<int32_t>(mode_);
+    newCacheData.lowResImage = lowResImage_;
+    newCacheData.lowResImageId = lowResImageId_;
     SetCache(std::make_shared<std::any>(newCacheData));
 }
 
@@ -284,9 +525,12 @@ Drawing::Rect GEMotionBlurShaderFilter::GetLastRectFromCache()
         cachedData->radius != radius_ ||
         cachedData->anchor[0] != anchor_[0] ||
         cachedData->anchor[1] != anchor_[1] ||
-        cachedData->sampleCount != sampleCount_) {
+        cachedData->sampleCount != sampleCount_ ||
+        cachedData->mode != static_cast<int32_t>(mode_)) {
         return Drawing::Rect(0.f, 0.f, 0.f, 0.f);
     }
+    lowResImage_ = cachedData->lowResImage;
+    lowResImageId_ = cachedData->lowResImageId;
     return cachedData->lastRect;
 }
 
@@ -319,6 +563,14 @@ std::shared_ptr<Drawing::Image> GEMotionBlurShaderFilter::OnProcessImage(Drawing
     Vector2f scaleAnchorCoord;
     CalculateRect(lastRect, curRect, rectOffset, scaleSize, scaleAnchorCoord);
 
+    if (mode_ == Mode::MULTI_RESOLUTION) {
+        auto multiResImage = ProcessMultiResolution(canvas, image, curRect, rectOffset, scaleSize, scaleAnchorCoord);
+        if (multiResImage != nullptr) {
+            UpdateCache(curRect);
+            return multiResImage;
+        }
+    }
+
     auto tmpBlur = CreateBlurImage(canvas, image, src, src, rectOffset, scaleSize, scaleAnchorCoord);
     if (tmpBlur == nullptr) {
         return image;
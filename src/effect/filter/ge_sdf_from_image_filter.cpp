@@ -15,6 +15,7 @@
 
 #include "ge_sdf_from_image_filter.h"
 
+#include "ge_intermediate_format.h"
 #include "ge_log.h"
 #include "ge_shader_diagnostics.h"
 #include "ge_system_properties.h"
@@ -92,7 +93,8 @@ std::shared_ptr<Drawing::Image> GESDFFromImageFilter::FakeBlur(Drawing::Canvas &
  
     // check image width and height in IsInputImageValid;
     auto imageInfo = edgeImage->GetImageInfo();
-    imageInfo.SetColorType(Drawing::ColorType::COLORTYPE_RGBA_F16);
+    imageInfo.SetColorType(GEIntermediateFormat::SelectColorType(GEIntermediateFormat::Usage::DISTANCE, imageInfo,
+        supportHeadroom_));
     float imageWidth = imageInfo.GetWidth();
     float imageHeight = imageInfo.GetHeight();
     if (imageWidth < MIN_IMAGE_BLOOM_SIZE || imageHeight < MIN_IMAGE_BLOOM_SIZE) {
@@ -135,15 +137,18 @@ std::shared_ptr<Drawing::Image> GESDFFromImageFilter::OnProcessImage(Drawing::Ca
     static const Drawing::SamplingOptions linear(Drawing::FilterMode::LINEAR, Drawing::MipmapMode::NONE);
     static const Drawing::SamplingOptions nearest(Drawing::FilterMode::NEAREST, Drawing::MipmapMode::NONE);
 
+    // JFA seeds store pixel coordinates, they need at least half floats
+    const auto distanceType = GEIntermediateFormat::SelectColorType(GEIntermediateFormat::Usage::DISTANCE,
+        image->GetImageInfo(), supportHeadroom_);
     std::shared_ptr<Drawing::Image> initOutput = nullptr;
-    initOutput = RunJFAPrepareEffect(canvas, image, linear, src, dst, Drawing::ColorType::COLORTYPE_RGBA_F16);
+    initOutput = RunJFAPrepareEffect(canvas, image, linear, src, dst, distanceType);
     if (!initOutput) {
         GE_LOGE("GESDFFromImageFilter::OnProcessImage Init make image error");
         return image;
     }
 
     std::shared_ptr<Drawing::Image> iterationsOutput = nullptr;
-    iterationsOutput = RunJfaIterationsEffect(canvas, initOutput, nearest, Drawing::ColorType::COLORTYPE_RGBA_F16);
+    iterationsOutput = RunJfaIterationsEffect(canvas, initOutput, nearest, distanceType);
     if (!iterationsOutput) {
         GE_LOGE("GESDFFromImageFilter::OnProcessImage Iterations make image error");
         return image;
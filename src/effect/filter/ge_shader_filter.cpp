@@ -13,10 +13,42 @@
  * limitations under the License.
  */
 #include "ge_shader_filter.h"
+
+#include "effect/runtime_effect.h"
+#include "effect/runtime_shader_builder.h"
+#include "ge_log.h"
+#include "ge_shader_diagnostics.h"
+#include "ge_tone_mapping_lut.h"
 #include "ge_trace.h"
 
 namespace OHOS {
 namespace Rosen {
+namespace {
+// Pass-through of the content child, evaluated through the local matrix of the builder
+const std::string PASS_THROUGH_PROG = R"(
+    uniform shader content;
+
+    half4 main(float2 coord) {
+        return content.eval(coord);
+    }
+)";
+
+std::shared_ptr<Drawing::RuntimeShaderBuilder> MakePassThroughBuilder(
+    const std::shared_ptr<Drawing::ShaderEffect>& shader)
+{
+    thread_local static std::shared_ptr<Drawing::RuntimeEffect> g_passThroughEffect = nullptr;
+    if (g_passThroughEffect == nullptr) {
+        g_passThroughEffect = GECreateRuntimeEffectForShader(PASS_THROUGH_PROG);
+        if (g_passThroughEffect == nullptr) {
+            LOGE("GEShaderFilter::MakePassThroughBuilder create runtime effect failed");
+            return nullptr;
+        }
+    }
+    auto builder = std::make_shared<Drawing::RuntimeShaderBuilder>(g_passThroughEffect);
+    builder->SetChild("content", shader);
+    return builder;
+}
+} // namespace
 
 std::shared_ptr<Drawing::Image> GEShaderFilter::ProcessImage(Drawing::Canvas& canvas,
     const std::shared_ptr<Drawing::Image> image, const Drawing::Rect& src, const Drawing::Rect& dst)
@@ -34,5 +66,53 @@ bool GEShaderFilter::DrawImage(Drawing::Canvas& canvas, const std::shared_ptr<Dr
     return OnDrawImage(canvas, image, src, dst, brush);
 }
 
+std::shared_ptr<Drawing::Image> GEShaderFilter::MakeComposedImage(Drawing::Canvas& canvas,
+    const std::shared_ptr<Drawing::ShaderEffect>& shader, const Drawing::ImageInfo& info)
+{
+    if (shader == nullptr || info.GetWidth() <= 0 || info.GetHeight() <= 0) {
+        return nullptr;
+    }
+    auto builder = MakePassThroughBuilder(shader);
+    if (builder == nullptr) {
+        return nullptr;
+    }
+#ifdef RS_ENABLE_GPU
+    return builder->MakeImage(canvas.GetGPUContext().get(), nullptr, info, false);
+#else
+    return builder->MakeImage(nullptr, nullptr, info, false);
+#endif
+}
+
+bool GEShaderFilter::GetCanvasGeometryMatrix(Drawing::Matrix& matrix, Drawing::Matrix& invertMatrix) const
+{
+    matrix = canvasInfo_.mat;
+    matrix.PostTranslate(-canvasInfo_.tranX, -canvasInfo_.tranY);
+    return matrix.Invert(invertMatrix);
+}
+
+std::shared_ptr<Drawing::ShaderEffect> GEShaderFilter::MakeLocalMatrixShader(
+    const std::shared_ptr<Drawing::ShaderEffect>& shader, const Drawing::Matrix& matrix)
+{
+    if (shader == nullptr) {
+        return nullptr;
+    }
+    auto builder = MakePassThroughBuilder(shader);
+    return builder != nullptr ? builder->MakeShader(&matrix, false) : nullptr;
+}
+
+std::shared_ptr<Drawing::ShaderEffect> GEShaderFilter::ToneMapOutput(
+    const std::shared_ptr<Drawing::ShaderEffect>& shader)
+{
+    if (shader == nullptr || outputToneMappingHeadroom_ <= 0.0f) {
+        return shader;
+    }
+    auto toneMapped = GEToneMappingLut::GetInstance().MakeToneMappedShader(shader, outputToneMappingHeadroom_);
+    if (toneMapped == nullptr) {
+        return shader;
+    }
+    outputToneMapped_ = true;
+    return toneMapped;
+}
+
 } // namespace Rosen
 } // namespace OHOS
@@ -14,6 +14,12 @@
  */
 #include "ge_variable_radius_blur_shader_filter.h"
 
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <vector>
+
+#include "ge_intermediate_format.h"
 #include "ge_log.h"
 #include "ge_shader_diagnostics.h"
 #include "ge_system_properties.h"
@@ -26,6 +32,9 @@ namespace {
 thread_local static std::shared_ptr<Drawing::RuntimeEffect> horizontalBoxBlurShaderEffect_ = nullptr;
 thread_local static std::shared_ptr<Drawing::RuntimeEffect> verticalBoxBlurShaderEffect_ = nullptr;
 thread_local static std::shared_ptr<Drawing::RuntimeEffect> textureShaderEffect_ = nullptr;
+thread_local static std::shared_ptr<Drawing::RuntimeEffect> pyramidDownEffect_ = nullptr;
+thread_local static std::shared_ptr<Drawing::RuntimeEffect> pyramidCompositeEffect_ = nullptr;
+constexpr int MAX_PYRAMID_LEVELS = 5; // 2^5 covers the largest half radius of 30
 } // namespace
 
 GEVariableRadiusBlurShaderFilter::GEVariableRadiusBlurShaderFilter(
@@ -48,6 +57,11 @@ std::shared_ptr<Drawing::Image> GEVariableRadiusBlurShaderFilter::OnProcessImage
     }
     float radius = std::clamp(params_.blurRadius, 0.0f, 60.0f); // 60.0 represents largest blur radius
     radius = radius / 2; // 2 half blur radius
+    // The pyramid averages every pixel of a level, so masked averaging keeps the box passes
+    if (params_.mode == static_cast<int>(Mode::PYRAMID) && !params_.applyInsideMask) {
+        MakePyramidEffects();
+        return DrawPyramidGradientBlur(image, canvas, radius, maskShader, dst);
+    }
     MakeHorizontalBoxBlurEffect(params_.applyInsideMask);
     MakeVerticalBoxBlurEffect(params_.applyInsideMask);
     MakeTextureShaderEffect();
@@ -302,6 +316,156 @@ std::shared_ptr<Drawing::Image> GEVariableRadiusBlurShaderFilter::BuildBoxLinear
     return localImage;
 }
 
+int GEVariableRadiusBlurShaderFilter::GetPyramidLevelCount(float radius)
+{
+    if (radius < 1.0f) {
+        return 0;
+    }
+    // Level i is blurred by about 2^(i-1) pixels, the top level must reach the radius
+    return std::clamp(static_cast<int>(std::ceil(std::log2(radius))) + 1, 1, MAX_PYRAMID_LEVELS);
+}
+
+void GEVariableRadiusBlurShaderFilter::MakePyramidEffects()
+{
+    if (pyramidDownEffect_ == nullptr) {
+        // Dual filter down-sampling: halves the size, four bilinear taps around the center cover a 4x4 footprint
+        static const std::string downString(R"(
+            uniform shader imageShader;
+            half4 main(float2 xy)
+            {
+                float2 coord = xy * 2.0;
+                half4 sum = imageShader.eval(coord) * 4.0;
+                sum += imageShader.eval(coord + float2(-1.0, -1.0));
+                sum += imageShader.eval(coord + float2(1.0, -1.0));
+                sum += imageShader.eval(coord + float2(-1.0, 1.0));
+                sum += imageShader.eval(coord + float2(1.0, 1.0));
+                return sum * 0.125;
+            }
+        )");
+        pyramidDownEffect_ = GECreateRuntimeEffectForShader(downString);
+    }
+    if (pyramidCompositeEffect_ == nullptr) {
+        // Picks the two levels around the local radius, so the cost per pixel does not depend on the radius
+        static const std::string compositeString(R"(
+            uniform half r;
+            uniform half maxLevel;
+            uniform shader imageShader;
+            uniform shader gradientShader;
+            uniform shader level1;
+            uniform shader level2;
+            uniform shader level3;
+            uniform shader level4;
+            uniform shader level5;
+            half4 sampleLevel(float2 coord, half level)
+            {
+                if (level < 0.5) {
+                    return imageShader.eval(coord);
+                } else if (level < 1.5) {
+                    return level1.eval(coord);
+                } else if (level < 2.5) {
+                    return level2.eval(coord);
+                } else if (level < 3.5) {
+                    return level3.eval(coord);
+                } else if (level < 4.5) {
+                    return level4.eval(coord);
+                }
+                return level5.eval(coord);
+            }
+            half4 main(float2 coord)
+            {
+                float radius = r * gradientShader.eval(coord).a;
+                if (radius < 1.0) {
+                    return imageShader.eval(coord);
+                }
+                float lod = clamp(log2(radius) + 1.0, 0.0, maxLevel);
+                float lower = floor(lod);
+                half4 color = sampleLevel(coord, lower);
+                if (lod > lower) {
+                    color = mix(color, sampleLevel(coord, min(lower + 1.0, maxLevel)), lod - lower);
+                }
+                return half4(color.rgb, 1.0);
+            }
+        )");
+        pyramidCompositeEffect_ = GECreateRuntimeEffectForShader(compositeString);
+    }
+    if (pyramidDownEffect_ == nullptr || pyramidCompositeEffect_ == nullptr) {
+        LOGE("GEVariableRadiusBlurShaderFilter::MakePyramidEffects create failed");
+    }
+}
+
+std::shared_ptr<Drawing::Image> GEVariableRadiusBlurShaderFilter::DrawPyramidGradientBlur(
+    const std::shared_ptr<Drawing::Image>& image, Drawing::Canvas& canvas, float radius,
+    std::shared_ptr<Drawing::ShaderEffect> alphaGradientShader, const Drawing::Rect& dst)
+{
+    GE_TRACE_NAME_FMT("GEVariableRadiusBlurShaderFilter::DrawPyramidGradientBlur, Type: %s, radius: %g "\
+        "Width: %g, Height: %g", Drawing::GE_FILTER_VARIABLE_RADIUS_BLUR, radius, dst.GetWidth(), dst.GetHeight());
+    const int levelCount = GetPyramidLevelCount(radius);
+    if (!pyramidDownEffect_ || !pyramidCompositeEffect_ || !image || levelCount == 0) {
+        return image;
+    }
+    Drawing::SamplingOptions linear(Drawing::FilterMode::LINEAR, Drawing::MipmapMode::NONE);
+    Drawing::Matrix blurMatrix;
+    blurMatrix.PostTranslate(dst.GetLeft(), dst.GetTop());
+    auto imageShader = Drawing::ShaderEffect::CreateImageShader(
+        *image, Drawing::TileMode::CLAMP, Drawing::TileMode::CLAMP, linear, blurMatrix);
+    const auto& originInfo = image->GetImageInfo();
+
+    // Each level halves the previous one, the whole pyramid costs less than a third of a full resolution pass
+    std::vector<std::shared_ptr<Drawing::ShaderEffect>> levelShaders;
+    auto inputShader = imageShader;
+    float width = image->GetWidth();
+    float height = image->GetHeight();
+    for (int level = 1; level <= levelCount; level++) {
+        width = std::max(1.0f, std::ceil(width * 0.5f));   // 0.5: half size per level
+        height = std::max(1.0f, std::ceil(height * 0.5f)); // 0.5: half size per level
+        auto levelInfo = GEIntermediateFormat::MakeImageInfo(width, height, originInfo,
+            GEIntermediateFormat::Usage::COLOR, supportHeadroom_);
+        Drawing::RuntimeShaderBuilder downBuilder(pyramidDownEffect_);
+        downBuilder.SetChild("imageShader", inputShader);
+#ifdef RS_ENABLE_GPU
+        auto levelImage = downBuilder.MakeImage(canvas.GetGPUContext().get(), nullptr, levelInfo, false);
+#else
+        auto levelImage = downBuilder.MakeImage(nullptr, nullptr, levelInfo, false);
+#endif
+        if (!levelImage) {
+            LOGE("GEVariableRadiusBlurShaderFilter::DrawPyramidGradientBlur fail to make level %{public}d", level);
+            return image;
+        }
+        inputShader = Drawing::ShaderEffect::CreateImageShader(
+            *levelImage, Drawing::TileMode::CLAMP, Drawing::TileMode::CLAMP, linear, Drawing::Matrix());
+        // Sampled in the coordinates of the full resolution image. The down shader reads coord * 2, so a texel of
+        // level k spans exactly 2^k pixels; rounding the level size up only pads the right and bottom edges
+        Drawing::Matrix levelMatrix;
+        levelMatrix.SetScale(static_cast<float>(1 << level), static_cast<float>(1 << level));
+        levelShaders.push_back(Drawing::ShaderEffect::CreateImageShader(
+            *levelImage, Drawing::TileMode::CLAMP, Drawing::TileMode::CLAMP, linear, levelMatrix));
+    }
+
+    Drawing::RuntimeShaderBuilder builder(pyramidCompositeEffect_);
+    builder.SetUniform("r", radius);
+    builder.SetUniform("maxLevel", static_cast<float>(levelCount));
+    builder.SetChild("imageShader", imageShader);
+    builder.SetChild("gradientShader", alphaGradientShader);
+    static const std::array<const char*, MAX_PYRAMID_LEVELS> levelNames = {
+        "level1", "level2", "level3", "level4", "level5" };
+    for (int level = 0; level < MAX_PYRAMID_LEVELS; level++) {
+        // Unused levels are never sampled, bound to the top level since every child must be set
+        builder.SetChild(levelNames[level], levelShaders[std::min(level, levelCount - 1)]);
+    }
+    auto imageInfo = Drawing::ImageInfo(dst.GetWidth(), dst.GetHeight(), originInfo.GetColorType(),
+        originInfo.GetAlphaType(), originInfo.GetColorSpace());
+#ifdef RS_ENABLE_GPU
+    auto blurImage = builder.MakeImage(canvas.GetGPUContext().get(), nullptr, imageInfo, false);
+#else
+    auto blurImage = builder.MakeImage(nullptr, nullptr, imageInfo, false);
+#endif
+    if (!blurImage) {
+        LOGE("GEVariableRadiusBlurShaderFilter::DrawPyramidGradientBlur fail to make final image");
+        return image;
+    }
+    return blurImage;
+}
+
 std::string GEVariableRadiusBlurShaderFilter::GetDescription()
 {
     return "GEVariableRadiusBlurShaderFilter";
@@ -309,7 +473,8 @@ std::string GEVariableRadiusBlurShaderFilter::GetDescription()
 
 std::string GEVariableRadiusBlurShaderFilter::GetDetailedDescription()
 {
-    return "GEVariableRadiusBlurShaderFilterBlur, radius: " + std::to_string(params_.blurRadius);
+    return "GEVariableRadiusBlurShaderFilterBlur, radius: " + std::to_string(params_.blurRadius) +
+        ", mode: " + std::to_string(params_.mode);
 }
 } // namespace Rosen
 } // namespace OHOS
\ No newline at end of file
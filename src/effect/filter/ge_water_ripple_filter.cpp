@@ -62,21 +62,14 @@ std::shared_ptr<Drawing::Image> GEWaterRippleFilter::OnProcessImage(Drawing::Can
     if (height < 1e-6 || width < 1e-6) {
         return nullptr;
     }
-    auto waterRipple = GetWaterRippleEffect();
-    if (waterRipple == nullptr) {
-        LOGE("GEWaterRippleFilter::OnProcessImage g_waterRippleEffect init failed");
+    auto builder = MakeWaterRippleBuilder(shader);
+    if (builder == nullptr) {
         return nullptr;
     }
-    Drawing::RuntimeShaderBuilder builder(waterRipple);
-    builder.SetChild("image", shader);
-    builder.SetUniform("iResolution", canvasInfo_.geoWidth, canvasInfo_.geoHeight);
-    builder.SetUniform("progress", progress_);
-    builder.SetUniform("waveCount", static_cast<float>(waveCount_));
-    builder.SetUniform("rippleCenter", rippleCenterX_, rippleCenterY_);
 #ifdef RS_ENABLE_GPU
-    auto invertedImage = builder.MakeImage(canvas.GetGPUContext().get(), &(matrix), imageInfo, false);
+    auto invertedImage = builder->MakeImage(canvas.GetGPUContext().get(), &(matrix), imageInfo, false);
 #else
-    auto invertedImage = builder.MakeImage(nullptr, &(matrix), imageInfo, false);
+    auto invertedImage = builder->MakeImage(nullptr, &(matrix), imageInfo, false);
 #endif
     if (invertedImage == nullptr) {
         LOGE("GEWaterRippleFilter::OnProcessImage make image failed");
@@ -85,6 +78,36 @@ std::shared_ptr<Drawing::Image> GEWaterRippleFilter::OnProcessImage(Drawing::Can
     return invertedImage;
 }
 
+std::shared_ptr<Drawing::ShaderEffect> GEWaterRippleFilter::MakeComposableShader(
+    const std::shared_ptr<Drawing::ShaderEffect>& input, const Drawing::ImageInfo& info)
+{
+    Drawing::Matrix matrix;
+    Drawing::Matrix invertMatrix;
+    if (input == nullptr || info.GetWidth() < 1 || info.GetHeight() < 1 ||
+        !GetCanvasGeometryMatrix(matrix, invertMatrix)) {
+        return nullptr;
+    }
+    auto builder = MakeWaterRippleBuilder(MakeLocalMatrixShader(input, invertMatrix));
+    return builder != nullptr ? builder->MakeShader(&matrix, false) : nullptr;
+}
+
+std::shared_ptr<Drawing::RuntimeShaderBuilder> GEWaterRippleFilter::MakeWaterRippleBuilder(
+    const std::shared_ptr<Drawing::ShaderEffect>& imageShader)
+{
+    auto waterRipple = GetWaterRippleEffect();
+    if (waterRipple == nullptr) {
+        LOGE("GEWaterRippleFilter::MakeWaterRippleBuilder g_waterRippleEffect init failed");
+        return nullptr;
+    }
+    auto builder = std::make_shared<Drawing::RuntimeShaderBuilder>(waterRipple);
+    builder->SetChild("image", imageShader);
+    builder->SetUniform("iResolution", canvasInfo_.geoWidth, canvasInfo_.geoHeight);
+    builder->SetUniform("progress", progress_);
+    builder->SetUniform("waveCount", static_cast<float>(waveCount_));
+    builder->SetUniform("rippleCenter", rippleCenterX_, rippleCenterY_);
+    return builder;
+}
+
 std::shared_ptr<Drawing::RuntimeEffect> GEWaterRippleFilter::GetWaterRippleEffect()
 {
     switch (rippleMode_) {
@@ -18,10 +18,12 @@
 
 #include "ge_params_reflection.h"
 
+#include <iterator>
 #include <unordered_map>
 
 #include "ge_filter_params.h"
 #include "ge_log.h"
+#include "ge_params_hash.h"
 
 namespace OHOS {
 namespace Rosen {
@@ -30,9 +32,9 @@ namespace Drawing {
 std::unique_ptr<GEFilterParams> GEParamsBuilder::Build(GEFilterType filterType)
 {
     switch (filterType) {
-#define GE_BUILD_PARAMS_CASE(EnumType, Struct)                  \
-    case GEFilterType::EnumType: {                              \
-        return GEFilterParams::Box(std::make_shared<Struct>()); \
+#define GE_BUILD_PARAMS_CASE(EnumType, Struct) \
+    case GEFilterType::EnumType: {             \
+        return GEFilterParams::Make<Struct>(); \
     }
 
         GE_BUILD_PARAMS_CASE(AIBAR, GEAIBarShaderFilterParams)
@@ -227,667 +229,1060 @@ GEFilterType GEParamsBuilder::GetFilterTypeFromString(const std::string& str)
     return GEFilterType::NONE;
 }
 
-GEFilterType GEParamsMemberHelper::GetFilterTypeFromTag(GEParamsMemberTag tag)
+std::optional<GEEffectCost> GEParamsBuilder::EstimateCost(const GEFilterParams& params)
 {
-    switch (tag) {
-#define GE_GET_FILTER_TYPE_CASE(Tag, FilterTypeEnum) \
-    case GEParamsMemberTag::Tag: {                   \
-        return GEFilterType::FilterTypeEnum;         \
+    switch (params.GetType()) {
+#define GE_ESTIMATE_COST_CASE(EnumType, Struct)                       \
+    case GEFilterType::EnumType: {                                    \
+        auto typedParams = GEFilterParams::Unbox<Struct>(params);     \
+        if (typedParams == nullptr) {                                 \
+            return std::nullopt;                                      \
+        }                                                             \
+        return GEEffectCostEstimator<Struct>::Estimate(*typedParams); \
+    }
+
+        GE_ESTIMATE_COST_CASE(GREY, GEGreyShaderFilterParams)
+        GE_ESTIMATE_COST_CASE(KAWASE_BLUR, GEKawaseBlurShaderFilterParams)
+        GE_ESTIMATE_COST_CASE(MESA_BLUR, GEMESABlurShaderFilterParams)
+        default:
+            return std::nullopt;
     }
+}
 
-        GE_GET_FILTER_TYPE_CASE(AIBAR_AI_BAR_LOW, AIBAR)
-        GE_GET_FILTER_TYPE_CASE(AIBAR_AI_BAR_HIGH, AIBAR)
-        GE_GET_FILTER_TYPE_CASE(AIBAR_AI_BAR_THRESHOLD, AIBAR)
-        GE_GET_FILTER_TYPE_CASE(AIBAR_AI_BAR_OPACITY, AIBAR)
-        GE_GET_FILTER_TYPE_CASE(AIBAR_AI_BAR_SATURATION, AIBAR)
-        GE_GET_FILTER_TYPE_CASE(AURORA_NOISE_NOISE, AURORA_NOISE)
-        GE_GET_FILTER_TYPE_CASE(AURORA_NOISE_FREQ_X, AURORA_NOISE)
-        GE_GET_FILTER_TYPE_CASE(AURORA_NOISE_FREQ_Y, AURORA_NOISE)
-        GE_GET_FILTER_TYPE_CASE(BEZIER_WARP_DESTINATION_PATCH, BEZIER_WARP)
-        GE_GET_FILTER_TYPE_CASE(BEZIER_WARP_DESTINATION_PATCH0, BEZIER_WARP)
-        GE_GET_FILTER_TYPE_CASE(BEZIER_WARP_DESTINATION_PATCH1, BEZIER_WARP)
-        GE_GET_FILTER_TYPE_CASE(BEZIER_WARP_DESTINATION_PATCH2, BEZIER_WARP)
-        GE_GET_FILTER_TYPE_CASE(BEZIER_WARP_DESTINATION_PATCH3, BEZIER_WARP)
-        GE_GET_FILTER_TYPE_CASE(BEZIER_WARP_DESTINATION_PATCH4, BEZIER_WARP)
-        GE_GET_FILTER_TYPE_CASE(BEZIER_WARP_DESTINATION_PATCH5, BEZIER_WARP)
-        GE_GET_FILTER_TYPE_CASE(BEZIER_WARP_DESTINATION_PATCH6, BEZIER_WARP)
-        GE_GET_FILTER_TYPE_CASE(BEZIER_WARP_DESTINATION_PATCH7, BEZIER_WARP)
-        GE_GET_FILTER_TYPE_CASE(BEZIER_WARP_DESTINATION_PATCH8, BEZIER_WARP)
-        GE_GET_FILTER_TYPE_CASE(BEZIER_WARP_DESTINATION_PATCH9, BEZIER_WARP)
-        GE_GET_FILTER_TYPE_CASE(BEZIER_WARP_DESTINATION_PATCH10, BEZIER_WARP)
-        GE_GET_FILTER_TYPE_CASE(BEZIER_WARP_DESTINATION_PATCH11, BEZIER_WARP)
-        GE_GET_FILTER_TYPE_CASE(BLUR_BUBBLES_RISE_BLUR_INTENSITY, BLUR_BUBBLES_RISE)
-        GE_GET_FILTER_TYPE_CASE(BLUR_BUBBLES_RISE_MIX_STRENGTH, BLUR_BUBBLES_RISE)
-        GE_GET_FILTER_TYPE_CASE(BLUR_BUBBLES_RISE_PROGRESS, BLUR_BUBBLES_RISE)
-        GE_GET_FILTER_TYPE_CASE(BLUR_BUBBLES_RISE_MASK_IMAGE, BLUR_BUBBLES_RISE)
-        GE_GET_FILTER_TYPE_CASE(BLUR_RADIUS_X, BLUR)
-        GE_GET_FILTER_TYPE_CASE(BLUR_RADIUS_Y, BLUR)
-        GE_GET_FILTER_TYPE_CASE(BLUR_DISABLE_SYSTEM_ADAPTATION, BLUR)
-        GE_GET_FILTER_TYPE_CASE(BLUR_EXPAND_DRAW_REGION, BLUR)
-        GE_GET_FILTER_TYPE_CASE(BORDER_LIGHT_POSITION, BORDER_LIGHT)
-        GE_GET_FILTER_TYPE_CASE(BORDER_LIGHT_COLOR, BORDER_LIGHT)
-        GE_GET_FILTER_TYPE_CASE(BORDER_LIGHT_INTENSITY, BORDER_LIGHT)
-        GE_GET_FILTER_TYPE_CASE(BORDER_LIGHT_WIDTH, BORDER_LIGHT)
-        GE_GET_FILTER_TYPE_CASE(BORDER_LIGHT_ROTATION_ANGLE, BORDER_LIGHT)
-        GE_GET_FILTER_TYPE_CASE(BORDER_LIGHT_CORNER_RADIUS, BORDER_LIGHT)
-        GE_GET_FILTER_TYPE_CASE(BORDER_SDF_LG_COLOR_ANGLE, BORDER_SDF_LG_COLOR)
-        GE_GET_FILTER_TYPE_CASE(BORDER_SDF_LG_COLOR_WIDTH, BORDER_SDF_LG_COLOR)
-        GE_GET_FILTER_TYPE_CASE(BORDER_SDF_LG_COLOR_IS_OUTLINE, BORDER_SDF_LG_COLOR)
-        GE_GET_FILTER_TYPE_CASE(BORDER_SDF_LG_COLOR_COLOR_NUMBER, BORDER_SDF_LG_COLOR)
-        GE_GET_FILTER_TYPE_CASE(BORDER_SDF_LG_COLOR_COLOR0, BORDER_SDF_LG_COLOR)
-        GE_GET_FILTER_TYPE_CASE(BORDER_SDF_LG_COLOR_COLOR1, BORDER_SDF_LG_COLOR)
-        GE_GET_FILTER_TYPE_CASE(BORDER_SDF_LG_COLOR_COLOR2, BORDER_SDF_LG_COLOR)
-        GE_GET_FILTER_TYPE_CASE(BORDER_SDF_LG_COLOR_COLOR3, BORDER_SDF_LG_COLOR)
-        GE_GET_FILTER_TYPE_CASE(BORDER_SDF_LG_COLOR_COLOR4, BORDER_SDF_LG_COLOR)
-        GE_GET_FILTER_TYPE_CASE(BORDER_SDF_LG_COLOR_POSITION0, BORDER_SDF_LG_COLOR)
-        GE_GET_FILTER_TYPE_CASE(BORDER_SDF_LG_COLOR_POSITION1, BORDER_SDF_LG_COLOR)
-        GE_GET_FILTER_TYPE_CASE(BORDER_SDF_LG_COLOR_POSITION2, BORDER_SDF_LG_COLOR)
-        GE_GET_FILTER_TYPE_CASE(BORDER_SDF_LG_COLOR_POSITION3, BORDER_SDF_LG_COLOR)
-        GE_GET_FILTER_TYPE_CASE(BORDER_SDF_LG_COLOR_POSITION4, BORDER_SDF_LG_COLOR)
-        GE_GET_FILTER_TYPE_CASE(BORDER_SDF_LG_COLOR_SHAPE, BORDER_SDF_LG_COLOR)
-        GE_GET_FILTER_TYPE_CASE(BORDER_SDF_SHADER_COLOR, BORDER_SDF_SHADER)
-        GE_GET_FILTER_TYPE_CASE(BORDER_SDF_SHADER_WIDTH, BORDER_SDF_SHADER)
-        GE_GET_FILTER_TYPE_CASE(BORDER_SDF_SHADER_IS_OUTLINE, BORDER_SDF_SHADER)
-        GE_GET_FILTER_TYPE_CASE(BORDER_SDF_SHADER_STYLE, BORDER_SDF_SHADER)
-        GE_GET_FILTER_TYPE_CASE(BORDER_SDF_SHADER_DASH_WIDTH, BORDER_SDF_SHADER)
-        GE_GET_FILTER_TYPE_CASE(BORDER_SDF_SHADER_DASH_GAP, BORDER_SDF_SHADER)
-        GE_GET_FILTER_TYPE_CASE(BORDER_SDF_SHADER_SHAPE, BORDER_SDF_SHADER)
-        GE_GET_FILTER_TYPE_CASE(CIRCLE_FLOWLIGHT_COLORS0, CIRCLE_FLOWLIGHT)
-        GE_GET_FILTER_TYPE_CASE(CIRCLE_FLOWLIGHT_COLORS1, CIRCLE_FLOWLIGHT)
-        GE_GET_FILTER_TYPE_CASE(CIRCLE_FLOWLIGHT_COLORS2, CIRCLE_FLOWLIGHT)
-        GE_GET_FILTER_TYPE_CASE(CIRCLE_FLOWLIGHT_COLORS3, CIRCLE_FLOWLIGHT)
-        GE_GET_FILTER_TYPE_CASE(CIRCLE_FLOWLIGHT_ROTATION_FREQUENCY, CIRCLE_FLOWLIGHT)
-        GE_GET_FILTER_TYPE_CASE(CIRCLE_FLOWLIGHT_ROTATION_AMPLITUDE, CIRCLE_FLOWLIGHT)
-        GE_GET_FILTER_TYPE_CASE(CIRCLE_FLOWLIGHT_ROTATION_SEED, CIRCLE_FLOWLIGHT)
-        GE_GET_FILTER_TYPE_CASE(CIRCLE_FLOWLIGHT_GRADIENT_X, CIRCLE_FLOWLIGHT)
-        GE_GET_FILTER_TYPE_CASE(CIRCLE_FLOWLIGHT_GRADIENT_Y, CIRCLE_FLOWLIGHT)
-        GE_GET_FILTER_TYPE_CASE(CIRCLE_FLOWLIGHT_PROGRESS, CIRCLE_FLOWLIGHT)
-        GE_GET_FILTER_TYPE_CASE(CIRCLE_FLOWLIGHT_STRENGTH, CIRCLE_FLOWLIGHT)
-        GE_GET_FILTER_TYPE_CASE(CIRCLE_FLOWLIGHT_DISTORT_STRENGTH, CIRCLE_FLOWLIGHT)
-        GE_GET_FILTER_TYPE_CASE(CIRCLE_FLOWLIGHT_BLEND_GRADIENT, CIRCLE_FLOWLIGHT)
-        GE_GET_FILTER_TYPE_CASE(CIRCLE_FLOWLIGHT_MASK, CIRCLE_FLOWLIGHT)
-        GE_GET_FILTER_TYPE_CASE(COLOR_GRADIENT_COLORS, COLOR_GRADIENT)
-        GE_GET_FILTER_TYPE_CASE(COLOR_GRADIENT_POSITIONS, COLOR_GRADIENT)
-        GE_GET_FILTER_TYPE_CASE(COLOR_GRADIENT_STRENGTHS, COLOR_GRADIENT)
-        GE_GET_FILTER_TYPE_CASE(COLOR_GRADIENT_MASK, COLOR_GRADIENT)
-        GE_GET_FILTER_TYPE_CASE(CONTENT_LIGHT_POSITION, CONTENT_LIGHT)
-        GE_GET_FILTER_TYPE_CASE(CONTENT_LIGHT_COLOR, CONTENT_LIGHT)
-        GE_GET_FILTER_TYPE_CASE(CONTENT_LIGHT_INTENSITY, CONTENT_LIGHT)
-        GE_GET_FILTER_TYPE_CASE(CONTENT_LIGHT_ROTATION_ANGLE, CONTENT_LIGHT)
-        GE_GET_FILTER_TYPE_CASE(CONTOUR_DIAGONAL_FLOW_LIGHT_CONTOUR, CONTOUR_DIAGONAL_FLOW_LIGHT)
-        GE_GET_FILTER_TYPE_CASE(CONTOUR_DIAGONAL_FLOW_LIGHT_LINE1_START, CONTOUR_DIAGONAL_FLOW_LIGHT)
-        GE_GET_FILTER_TYPE_CASE(CONTOUR_DIAGONAL_FLOW_LIGHT_LINE1_LENGTH, CONTOUR_DIAGONAL_FLOW_LIGHT)
-        GE_GET_FILTER_TYPE_CASE(CONTOUR_DIAGONAL_FLOW_LIGHT_LINE1_COLOR, CONTOUR_DIAGONAL_FLOW_LIGHT)
-        GE_GET_FILTER_TYPE_CASE(CONTOUR_DIAGONAL_FLOW_LIGHT_LINE2_START, CONTOUR_DIAGONAL_FLOW_LIGHT)
-        GE_GET_FILTER_TYPE_CASE(CONTOUR_DIAGONAL_FLOW_LIGHT_LINE2_LENGTH, CONTOUR_DIAGONAL_FLOW_LIGHT)
-        GE_GET_FILTER_TYPE_CASE(CONTOUR_DIAGONAL_FLOW_LIGHT_LINE2_COLOR, CONTOUR_DIAGONAL_FLOW_LIGHT)
-        GE_GET_FILTER_TYPE_CASE(CONTOUR_DIAGONAL_FLOW_LIGHT_THICKNESS, CONTOUR_DIAGONAL_FLOW_LIGHT)
-        GE_GET_FILTER_TYPE_CASE(CONTOUR_DIAGONAL_FLOW_LIGHT_HALO_RADIUS, CONTOUR_DIAGONAL_FLOW_LIGHT)
-        GE_GET_FILTER_TYPE_CASE(CONTOUR_DIAGONAL_FLOW_LIGHT_LIGHT_WEIGHT, CONTOUR_DIAGONAL_FLOW_LIGHT)
-        GE_GET_FILTER_TYPE_CASE(CONTOUR_DIAGONAL_FLOW_LIGHT_HALO_WEIGHT, CONTOUR_DIAGONAL_FLOW_LIGHT)
-        GE_GET_FILTER_TYPE_CASE(DEPTH_OCCLUSION_DEPTH_PLANE, DEPTH_OCCLUSION)
-        GE_GET_FILTER_TYPE_CASE(DEPTH_OCCLUSION_MATRIX, DEPTH_OCCLUSION)
-        GE_GET_FILTER_TYPE_CASE(DEPTH_OCCLUSION_DEPTH_MAP, DEPTH_OCCLUSION)
-        GE_GET_FILTER_TYPE_CASE(DEPTH_OCCLUSION_WEIGHT, DEPTH_OCCLUSION)
-        GE_GET_FILTER_TYPE_CASE(DEPTH_OCCLUSION_NEAR, DEPTH_OCCLUSION)
-        GE_GET_FILTER_TYPE_CASE(DEPTH_OCCLUSION_FAR, DEPTH_OCCLUSION)
-        GE_GET_FILTER_TYPE_CASE(DEPTH_OCCLUSION_IS_REVERSE, DEPTH_OCCLUSION)
-        GE_GET_FILTER_TYPE_CASE(DIRECTION_LIGHT_MASK, DIRECTION_LIGHT)
-        GE_GET_FILTER_TYPE_CASE(DIRECTION_LIGHT_MASK_FACTOR, DIRECTION_LIGHT)
-        GE_GET_FILTER_TYPE_CASE(DIRECTION_LIGHT_LIGHT_DIRECTION, DIRECTION_LIGHT)
-        GE_GET_FILTER_TYPE_CASE(DIRECTION_LIGHT_LIGHT_COLOR, DIRECTION_LIGHT)
-        GE_GET_FILTER_TYPE_CASE(DIRECTION_LIGHT_LIGHT_INTENSITY, DIRECTION_LIGHT)
-        GE_GET_FILTER_TYPE_CASE(DISPERSION_MASK, DISPERSION)
-        GE_GET_FILTER_TYPE_CASE(DISPERSION_OPACITY, DISPERSION)
-        GE_GET_FILTER_TYPE_CASE(DISPERSION_RED_OFFSET, DISPERSION)
-        GE_GET_FILTER_TYPE_CASE(DISPERSION_GREEN_OFFSET, DISPERSION)
-        GE_GET_FILTER_TYPE_CASE(DISPERSION_BLUE_OFFSET, DISPERSION)
-        GE_GET_FILTER_TYPE_CASE(DISPLACEMENT_DISTORT_FILTER_FACTOR, DISPLACEMENT_DISTORT_FILTER)
-        GE_GET_FILTER_TYPE_CASE(DISPLACEMENT_DISTORT_FILTER_MASK, DISPLACEMENT_DISTORT_FILTER)
-        GE_GET_FILTER_TYPE_CASE(DISTORTION_COLLAPSE_L_U_CORNER, DISTORTION_COLLAPSE)
-        GE_GET_FILTER_TYPE_CASE(DISTORTION_COLLAPSE_R_U_CORNER, DISTORTION_COLLAPSE)
-        GE_GET_FILTER_TYPE_CASE(DISTORTION_COLLAPSE_R_B_CORNER, DISTORTION_COLLAPSE)
-        GE_GET_FILTER_TYPE_CASE(DISTORTION_COLLAPSE_L_B_CORNER, DISTORTION_COLLAPSE)
-        GE_GET_FILTER_TYPE_CASE(DISTORTION_COLLAPSE_BARREL_DISTORTION, DISTORTION_COLLAPSE)
-        GE_GET_FILTER_TYPE_CASE(DOT_MATRIX_PATH_DIRECTION, DOT_MATRIX)
-        GE_GET_FILTER_TYPE_CASE(DOT_MATRIX_EFFECT_COLORS, DOT_MATRIX)
-        GE_GET_FILTER_TYPE_CASE(DOT_MATRIX_COLOR_FRACTIONS, DOT_MATRIX)
-        GE_GET_FILTER_TYPE_CASE(DOT_MATRIX_START_POINTS, DOT_MATRIX)
-        GE_GET_FILTER_TYPE_CASE(DOT_MATRIX_PATH_WIDTH, DOT_MATRIX)
-        GE_GET_FILTER_TYPE_CASE(DOT_MATRIX_INVERSE_EFFECT, DOT_MATRIX)
-        GE_GET_FILTER_TYPE_CASE(DOT_MATRIX_DOT_COLOR, DOT_MATRIX)
-        GE_GET_FILTER_TYPE_CASE(DOT_MATRIX_DOT_SPACING, DOT_MATRIX)
-        GE_GET_FILTER_TYPE_CASE(DOT_MATRIX_DOT_RADIUS, DOT_MATRIX)
-        GE_GET_FILTER_TYPE_CASE(DOT_MATRIX_BG_COLOR, DOT_MATRIX)
-        GE_GET_FILTER_TYPE_CASE(DOT_MATRIX_EFFECT_TYPE, DOT_MATRIX)
-        GE_GET_FILTER_TYPE_CASE(DOT_MATRIX_PROGRESS, DOT_MATRIX)
-        GE_GET_FILTER_TYPE_CASE(DOUBLE_RIPPLE_MASK_CENTER1, DOUBLE_RIPPLE_MASK)
-        GE_GET_FILTER_TYPE_CASE(DOUBLE_RIPPLE_MASK_CENTER2, DOUBLE_RIPPLE_MASK)
-        GE_GET_FILTER_TYPE_CASE(DOUBLE_RIPPLE_MASK_RADIUS, DOUBLE_RIPPLE_MASK)
-        GE_GET_FILTER_TYPE_CASE(DOUBLE_RIPPLE_MASK_WIDTH, DOUBLE_RIPPLE_MASK)
-        GE_GET_FILTER_TYPE_CASE(DOUBLE_RIPPLE_MASK_TURBULENCE, DOUBLE_RIPPLE_MASK)
-        GE_GET_FILTER_TYPE_CASE(DOUBLE_RIPPLE_MASK_HALO_THICKNESS, DOUBLE_RIPPLE_MASK)
-        GE_GET_FILTER_TYPE_CASE(EDGE_LIGHT_ALPHA, EDGE_LIGHT)
-        GE_GET_FILTER_TYPE_CASE(EDGE_LIGHT_BLOOM, EDGE_LIGHT)
-        GE_GET_FILTER_TYPE_CASE(EDGE_LIGHT_COLOR, EDGE_LIGHT)
-        GE_GET_FILTER_TYPE_CASE(EDGE_LIGHT_MASK, EDGE_LIGHT)
-        GE_GET_FILTER_TYPE_CASE(EDGE_LIGHT_USE_RAW_COLOR, EDGE_LIGHT)
-        GE_GET_FILTER_TYPE_CASE(FRAME_GRADIENT_MASK_INNER_BEZIER, FRAME_GRADIENT_MASK)
-        GE_GET_FILTER_TYPE_CASE(FRAME_GRADIENT_MASK_OUTER_BEZIER, FRAME_GRADIENT_MASK)
-        GE_GET_FILTER_TYPE_CASE(FRAME_GRADIENT_MASK_CORNER_RADIUS, FRAME_GRADIENT_MASK)
-        GE_GET_FILTER_TYPE_CASE(FRAME_GRADIENT_MASK_INNER_FRAME_WIDTH, FRAME_GRADIENT_MASK)
-        GE_GET_FILTER_TYPE_CASE(FRAME_GRADIENT_MASK_OUTER_FRAME_WIDTH, FRAME_GRADIENT_MASK)
-        GE_GET_FILTER_TYPE_CASE(FRAME_GRADIENT_MASK_RECT_W_H, FRAME_GRADIENT_MASK)
-        GE_GET_FILTER_TYPE_CASE(FRAME_GRADIENT_MASK_RECT_POS, FRAME_GRADIENT_MASK)
-        GE_GET_FILTER_TYPE_CASE(FRAME_GRADIENT_MASK_AXIAL_FEATHER_STRENGTH, FRAME_GRADIENT_MASK)
-        GE_GET_FILTER_TYPE_CASE(FRAME_GRADIENT_MASK_AXIAL_CENTER, FRAME_GRADIENT_MASK)
-        GE_GET_FILTER_TYPE_CASE(FRAME_GRADIENT_MASK_AXIAL_CORE_WIDTH, FRAME_GRADIENT_MASK)
-        GE_GET_FILTER_TYPE_CASE(FRAME_GRADIENT_MASK_AXIAL_DIRECTION, FRAME_GRADIENT_MASK)
-        GE_GET_FILTER_TYPE_CASE(FRAME_GRADIENT_MASK_BOX_ANGLE_DEG, FRAME_GRADIENT_MASK)
-        GE_GET_FILTER_TYPE_CASE(FROSTED_GLASS_BLUR_RADIUS, FROSTED_GLASS_BLUR)
-        GE_GET_FILTER_TYPE_CASE(FROSTED_GLASS_BLUR_RADIUS_SCALE, FROSTED_GLASS_BLUR)
-        GE_GET_FILTER_TYPE_CASE(FROSTED_GLASS_BLUR_REFRACT_OUT_PX, FROSTED_GLASS_BLUR)
-        GE_GET_FILTER_TYPE_CASE(FROSTED_GLASS_EFFECT_WEIGHTS_EMBOSS, FROSTED_GLASS_EFFECT)
-        GE_GET_FILTER_TYPE_CASE(FROSTED_GLASS_EFFECT_WEIGHTS_EDL, FROSTED_GLASS_EFFECT)
-        GE_GET_FILTER_TYPE_CASE(FROSTED_GLASS_EFFECT_ANTI_ALIAS, FROSTED_GLASS_EFFECT)
-        GE_GET_FILTER_TYPE_CASE(FROSTED_GLASS_EFFECT_MAX_COLOR, FROSTED_GLASS_EFFECT)
-        GE_GET_FILTER_TYPE_CASE(FROSTED_GLASS_EFFECT_BG_RATES, FROSTED_GLASS_EFFECT)
-        GE_GET_FILTER_TYPE_CASE(FROSTED_GLASS_EFFECT_BG_K_B_S, FROSTED_GLASS_EFFECT)
-        GE_GET_FILTER_TYPE_CASE(FROSTED_GLASS_EFFECT_BG_POS, FROSTED_GLASS_EFFECT)
-        GE_GET_FILTER_TYPE_CASE(FROSTED_GLASS_EFFECT_BG_NEG, FROSTED_GLASS_EFFECT)
-        GE_GET_FILTER_TYPE_CASE(FROSTED_GLASS_EFFECT_BG_ALPHA, FROSTED_GLASS_EFFECT)
-        GE_GET_FILTER_TYPE_CASE(FROSTED_GLASS_EFFECT_REFRACT_PARAMS, FROSTED_GLASS_EFFECT)
-        GE_GET_FILTER_TYPE_CASE(FROSTED_GLASS_EFFECT_SD_PARAMS, FROSTED_GLASS_EFFECT)
-        GE_GET_FILTER_TYPE_CASE(FROSTED_GLASS_EFFECT_SD_RATES, FROSTED_GLASS_EFFECT)
-        GE_GET_FILTER_TYPE_CASE(FROSTED_GLASS_EFFECT_SD_K_B_S, FROSTED_GLASS_EFFECT)
-        GE_GET_FILTER_TYPE_CASE(FROSTED_GLASS_EFFECT_SD_POS, FROSTED_GLASS_EFFECT)
-        GE_GET_FILTER_TYPE_CASE(FROSTED_GLASS_EFFECT_SD_NEG, FROSTED_GLASS_EFFECT)
-        GE_GET_FILTER_TYPE_CASE(FROSTED_GLASS_EFFECT_ENV_LIGHT_PARAMS, FROSTED_GLASS_EFFECT)
-        GE_GET_FILTER_TYPE_CASE(FROSTED_GLASS_EFFECT_ENV_LIGHT_RATES, FROSTED_GLASS_EFFECT)
-        GE_GET_FILTER_TYPE_CASE(FROSTED_GLASS_EFFECT_ENV_LIGHT_K_B_S, FROSTED_GLASS_EFFECT)
-        GE_GET_FILTER_TYPE_CASE(FROSTED_GLASS_EFFECT_ENV_LIGHT_POS, FROSTED_GLASS_EFFECT)
-        GE_GET_FILTER_TYPE_CASE(FROSTED_GLASS_EFFECT_ENV_LIGHT_NEG, FROSTED_GLASS_EFFECT)
-        GE_GET_FILTER_TYPE_CASE(FROSTED_GLASS_EFFECT_ED_LIGHT_PARAMS, FROSTED_GLASS_EFFECT)
-        GE_GET_FILTER_TYPE_CASE(FROSTED_GLASS_EFFECT_ED_LIGHT_ANGLES, FROSTED_GLASS_EFFECT)
-        GE_GET_FILTER_TYPE_CASE(FROSTED_GLASS_EFFECT_ED_LIGHT_DIR, FROSTED_GLASS_EFFECT)
-        GE_GET_FILTER_TYPE_CASE(FROSTED_GLASS_EFFECT_ED_LIGHT_RATES, FROSTED_GLASS_EFFECT)
-        GE_GET_FILTER_TYPE_CASE(FROSTED_GLASS_EFFECT_ED_LIGHT_K_B_S, FROSTED_GLASS_EFFECT)
-        GE_GET_FILTER_TYPE_CASE(FROSTED_GLASS_EFFECT_ED_LIGHT_POS, FROSTED_GLASS_EFFECT)
-        GE_GET_FILTER_TYPE_CASE(FROSTED_GLASS_EFFECT_ED_LIGHT_NEG, FROSTED_GLASS_EFFECT)
-        GE_GET_FILTER_TYPE_CASE(FROSTED_GLASS_EFFECT_SDF_SHAPE, FROSTED_GLASS_EFFECT)
-        GE_GET_FILTER_TYPE_CASE(FROSTED_GLASS_EFFECT_WAVE_DISTURBANCE, FROSTED_GLASS_EFFECT)
-        GE_GET_FILTER_TYPE_CASE(FROSTED_GLASS_EFFECT_BLUR_IMAGE, FROSTED_GLASS_EFFECT)
-        GE_GET_FILTER_TYPE_CASE(FROSTED_GLASS_EFFECT_BLUR_IMAGE_FOR_EDGE, FROSTED_GLASS_EFFECT)
-        GE_GET_FILTER_TYPE_CASE(FROSTED_GLASS_EFFECT_SNAPSHOT_RECT, FROSTED_GLASS_EFFECT)
-        GE_GET_FILTER_TYPE_CASE(FROSTED_GLASS_EFFECT_SNAPSHOT_MATRIX, FROSTED_GLASS_EFFECT)
-        GE_GET_FILTER_TYPE_CASE(FROSTED_GLASS_EFFECT_REFRACT_OUT_PX, FROSTED_GLASS_EFFECT)
-        GE_GET_FILTER_TYPE_CASE(FROSTED_GLASS_EFFECT_MATERIAL_COLOR, FROSTED_GLASS_EFFECT)
-        GE_GET_FILTER_TYPE_CASE(FROSTED_GLASS_EFFECT_DARK_MODE_WEIGHTS_EMBOSS, FROSTED_GLASS_EFFECT)
-        GE_GET_FILTER_TYPE_CASE(FROSTED_GLASS_EFFECT_DARK_MODE_BG_RATES, FROSTED_GLASS_EFFECT)
-        GE_GET_FILTER_TYPE_CASE(FROSTED_GLASS_EFFECT_DARK_MODE_BG_K_B_S, FROSTED_GLASS_EFFECT)
-        GE_GET_FILTER_TYPE_CASE(FROSTED_GLASS_EFFECT_DARK_MODE_BG_POS, FROSTED_GLASS_EFFECT)
-        GE_GET_FILTER_TYPE_CASE(FROSTED_GLASS_EFFECT_DARK_MODE_BG_NEG, FROSTED_GLASS_EFFECT)
-        GE_GET_FILTER_TYPE_CASE(FROSTED_GLASS_EFFECT_DARK_MODE_ED_LIGHT_K_B_S, FROSTED_GLASS_EFFECT)
-        GE_GET_FILTER_TYPE_CASE(FROSTED_GLASS_EFFECT_DARK_MODE_ED_LIGHT_ANGLES, FROSTED_GLASS_EFFECT)
-        GE_GET_FILTER_TYPE_CASE(FROSTED_GLASS_EFFECT_DARK_SCALE, FROSTED_GLASS_EFFECT)
-        GE_GET_FILTER_TYPE_CASE(FROSTED_GLASS_EFFECT_ENABLE_S_D_F_CACHE, FROSTED_GLASS_EFFECT)
-        GE_GET_FILTER_TYPE_CASE(FROSTED_GLASS_BLUR_PARAMS, FROSTED_GLASS)
-        GE_GET_FILTER_TYPE_CASE(FROSTED_GLASS_WEIGHTS_EMBOSS, FROSTED_GLASS)
-        GE_GET_FILTER_TYPE_CASE(FROSTED_GLASS_WEIGHTS_EDL, FROSTED_GLASS)
-        GE_GET_FILTER_TYPE_CASE(FROSTED_GLASS_SDF_SHAPE, FROSTED_GLASS)
-        GE_GET_FILTER_TYPE_CASE(FROSTED_GLASS_WAVE_DISTURBANCE, FROSTED_GLASS)
-        GE_GET_FILTER_TYPE_CASE(FROSTED_GLASS_MAX_COLOR, FROSTED_GLASS)
-        GE_GET_FILTER_TYPE_CASE(FROSTED_GLASS_BG_RATES, FROSTED_GLASS)
-        GE_GET_FILTER_TYPE_CASE(FROSTED_GLASS_BG_K_B_S, FROSTED_GLASS)
-        GE_GET_FILTER_TYPE_CASE(FROSTED_GLASS_BG_POS, FROSTED_GLASS)
-        GE_GET_FILTER_TYPE_CASE(FROSTED_GLASS_BG_NEG, FROSTED_GLASS)
-        GE_GET_FILTER_TYPE_CASE(FROSTED_GLASS_BG_ALPHA, FROSTED_GLASS)
-        GE_GET_FILTER_TYPE_CASE(FROSTED_GLASS_REFRACT_PARAMS, FROSTED_GLASS)
-        GE_GET_FILTER_TYPE_CASE(FROSTED_GLASS_SD_PARAMS, FROSTED_GLASS)
-        GE_GET_FILTER_TYPE_CASE(FROSTED_GLASS_SD_RATES, FROSTED_GLASS)
-        GE_GET_FILTER_TYPE_CASE(FROSTED_GLASS_SD_K_B_S, FROSTED_GLASS)
-        GE_GET_FILTER_TYPE_CASE(FROSTED_GLASS_SD_POS, FROSTED_GLASS)
-        GE_GET_FILTER_TYPE_CASE(FROSTED_GLASS_SD_NEG, FROSTED_GLASS)
-        GE_GET_FILTER_TYPE_CASE(FROSTED_GLASS_ENV_LIGHT_PARAMS, FROSTED_GLASS)
-        GE_GET_FILTER_TYPE_CASE(FROSTED_GLASS_ENV_LIGHT_RATES, FROSTED_GLASS)
-        GE_GET_FILTER_TYPE_CASE(FROSTED_GLASS_ENV_LIGHT_K_B_S, FROSTED_GLASS)
-        GE_GET_FILTER_TYPE_CASE(FROSTED_GLASS_ENV_LIGHT_POS, FROSTED_GLASS)
-        GE_GET_FILTER_TYPE_CASE(FROSTED_GLASS_ENV_LIGHT_NEG, FROSTED_GLASS)
-        GE_GET_FILTER_TYPE_CASE(FROSTED_GLASS_ED_LIGHT_PARAMS, FROSTED_GLASS)
-        GE_GET_FILTER_TYPE_CASE(FROSTED_GLASS_ED_LIGHT_ANGLES, FROSTED_GLASS)
-        GE_GET_FILTER_TYPE_CASE(FROSTED_GLASS_ED_LIGHT_DIR, FROSTED_GLASS)
-        GE_GET_FILTER_TYPE_CASE(FROSTED_GLASS_ED_LIGHT_RATES, FROSTED_GLASS)
-        GE_GET_FILTER_TYPE_CASE(FROSTED_GLASS_ED_LIGHT_K_B_S, FROSTED_GLASS)
-        GE_GET_FILTER_TYPE_CASE(FROSTED_GLASS_ED_LIGHT_POS, FROSTED_GLASS)
-        GE_GET_FILTER_TYPE_CASE(FROSTED_GLASS_ED_LIGHT_NEG, FROSTED_GLASS)
-        GE_GET_FILTER_TYPE_CASE(FROSTED_GLASS_DARK_MODE_BLUR_PARAM, FROSTED_GLASS)
-        GE_GET_FILTER_TYPE_CASE(FROSTED_GLASS_DARK_MODE_WEIGHTS_EMBOSS, FROSTED_GLASS)
-        GE_GET_FILTER_TYPE_CASE(FROSTED_GLASS_DARK_MODE_BG_RATES, FROSTED_GLASS)
-        GE_GET_FILTER_TYPE_CASE(FROSTED_GLASS_DARK_MODE_BG_K_B_S, FROSTED_GLASS)
-        GE_GET_FILTER_TYPE_CASE(FROSTED_GLASS_DARK_MODE_BG_POS, FROSTED_GLASS)
-        GE_GET_FILTER_TYPE_CASE(FROSTED_GLASS_DARK_MODE_BG_NEG, FROSTED_GLASS)
-        GE_GET_FILTER_TYPE_CASE(FROSTED_GLASS_DARK_MODE_ED_LIGHT_K_B_S, FROSTED_GLASS)
-        GE_GET_FILTER_TYPE_CASE(FROSTED_GLASS_DARK_MODE_ED_LIGHT_ANGLES, FROSTED_GLASS)
-        GE_GET_FILTER_TYPE_CASE(FROSTED_GLASS_DARK_SCALE, FROSTED_GLASS)
-        GE_GET_FILTER_TYPE_CASE(FROSTED_GLASS_BASE_VIBRANCY_ENABLED, FROSTED_GLASS)
-        GE_GET_FILTER_TYPE_CASE(FROSTED_GLASS_BASE_MATERIAL_TYPE, FROSTED_GLASS)
-        GE_GET_FILTER_TYPE_CASE(FROSTED_GLASS_MATERIAL_COLOR, FROSTED_GLASS)
-        GE_GET_FILTER_TYPE_CASE(GASIFY_BLUR_SOURCE_IMAGE, GASIFY_BLUR)
-        GE_GET_FILTER_TYPE_CASE(GASIFY_BLUR_MASK_IMAGE, GASIFY_BLUR)
-        GE_GET_FILTER_TYPE_CASE(GASIFY_BLUR_PROGRESS, GASIFY_BLUR)
-        GE_GET_FILTER_TYPE_CASE(GASIFY_SOURCE_IMAGE, GASIFY)
-        GE_GET_FILTER_TYPE_CASE(GASIFY_MASK_IMAGE, GASIFY)
-        GE_GET_FILTER_TYPE_CASE(GASIFY_PROGRESS, GASIFY)
-        GE_GET_FILTER_TYPE_CASE(GASIFY_SCALE_TWIST_SCALE, GASIFY_SCALE_TWIST)
-        GE_GET_FILTER_TYPE_CASE(GASIFY_SCALE_TWIST_SOURCE_IMAGE, GASIFY_SCALE_TWIST)
-        GE_GET_FILTER_TYPE_CASE(GASIFY_SCALE_TWIST_MASK_IMAGE, GASIFY_SCALE_TWIST)
-        GE_GET_FILTER_TYPE_CASE(GASIFY_SCALE_TWIST_PROGRESS, GASIFY_SCALE_TWIST)
-        GE_GET_FILTER_TYPE_CASE(GREY_GREY_COEF1, GREY)
-        GE_GET_FILTER_TYPE_CASE(GREY_GREY_COEF2, GREY)
-        GE_GET_FILTER_TYPE_CASE(GRID_WARP_GRID_POINTS0, GRID_WARP)
-        GE_GET_FILTER_TYPE_CASE(GRID_WARP_GRID_POINTS1, GRID_WARP)
-        GE_GET_FILTER_TYPE_CASE(GRID_WARP_GRID_POINTS2, GRID_WARP)
-        GE_GET_FILTER_TYPE_CASE(GRID_WARP_GRID_POINTS3, GRID_WARP)
-        GE_GET_FILTER_TYPE_CASE(GRID_WARP_GRID_POINTS4, GRID_WARP)
-        GE_GET_FILTER_TYPE_CASE(GRID_WARP_GRID_POINTS5, GRID_WARP)
-        GE_GET_FILTER_TYPE_CASE(GRID_WARP_GRID_POINTS6, GRID_WARP)
-        GE_GET_FILTER_TYPE_CASE(GRID_WARP_GRID_POINTS7, GRID_WARP)
-        GE_GET_FILTER_TYPE_CASE(GRID_WARP_GRID_POINTS8, GRID_WARP)
-        GE_GET_FILTER_TYPE_CASE(GRID_WARP_ROTATION_ANGLES0, GRID_WARP)
-        GE_GET_FILTER_TYPE_CASE(GRID_WARP_ROTATION_ANGLES1, GRID_WARP)
-        GE_GET_FILTER_TYPE_CASE(GRID_WARP_ROTATION_ANGLES2, GRID_WARP)
-        GE_GET_FILTER_TYPE_CASE(GRID_WARP_ROTATION_ANGLES3, GRID_WARP)
-        GE_GET_FILTER_TYPE_CASE(GRID_WARP_ROTATION_ANGLES4, GRID_WARP)
-        GE_GET_FILTER_TYPE_CASE(GRID_WARP_ROTATION_ANGLES5, GRID_WARP)
-        GE_GET_FILTER_TYPE_CASE(GRID_WARP_ROTATION_ANGLES6, GRID_WARP)
-        GE_GET_FILTER_TYPE_CASE(GRID_WARP_ROTATION_ANGLES7, GRID_WARP)
-        GE_GET_FILTER_TYPE_CASE(GRID_WARP_ROTATION_ANGLES8, GRID_WARP)
-        GE_GET_FILTER_TYPE_CASE(HARMONIUM_EFFECT_MASK, HARMONIUM_EFFECT)
-        GE_GET_FILTER_TYPE_CASE(HARMONIUM_EFFECT_MASK_CLOCK, HARMONIUM_EFFECT)
-        GE_GET_FILTER_TYPE_CASE(HARMONIUM_EFFECT_MASK_PROGRESS, HARMONIUM_EFFECT)
-        GE_GET_FILTER_TYPE_CASE(HARMONIUM_EFFECT_USE_EFFECT_MASK, HARMONIUM_EFFECT)
-        GE_GET_FILTER_TYPE_CASE(HARMONIUM_EFFECT_TINT_COLOR, HARMONIUM_EFFECT)
-        GE_GET_FILTER_TYPE_CASE(HARMONIUM_EFFECT_RIPPLE_POSITION, HARMONIUM_EFFECT)
-        GE_GET_FILTER_TYPE_CASE(HARMONIUM_EFFECT_RIPPLE_PROGRESS, HARMONIUM_EFFECT)
-        GE_GET_FILTER_TYPE_CASE(HARMONIUM_EFFECT_DISTORT_PROGRESS, HARMONIUM_EFFECT)
-        GE_GET_FILTER_TYPE_CASE(HARMONIUM_EFFECT_DISTORT_FACTOR, HARMONIUM_EFFECT)
-        GE_GET_FILTER_TYPE_CASE(HARMONIUM_EFFECT_REFLECTION_FACTOR, HARMONIUM_EFFECT)
-        GE_GET_FILTER_TYPE_CASE(HARMONIUM_EFFECT_REFRACTION_FACTOR, HARMONIUM_EFFECT)
-        GE_GET_FILTER_TYPE_CASE(HARMONIUM_EFFECT_BLUR_LEFT, HARMONIUM_EFFECT)
-        GE_GET_FILTER_TYPE_CASE(HARMONIUM_EFFECT_BLUR_TOP, HARMONIUM_EFFECT)
-        GE_GET_FILTER_TYPE_CASE(HARMONIUM_EFFECT_MATERIAL_FACTOR, HARMONIUM_EFFECT)
-        GE_GET_FILTER_TYPE_CASE(HARMONIUM_EFFECT_CORNER_RADIUS, HARMONIUM_EFFECT)
-        GE_GET_FILTER_TYPE_CASE(HARMONIUM_EFFECT_RATE, HARMONIUM_EFFECT)
-        GE_GET_FILTER_TYPE_CASE(HARMONIUM_EFFECT_LIGHT_UP_DEGREE, HARMONIUM_EFFECT)
-        GE_GET_FILTER_TYPE_CASE(HARMONIUM_EFFECT_CUBIC_COEFF, HARMONIUM_EFFECT)
-        GE_GET_FILTER_TYPE_CASE(HARMONIUM_EFFECT_QUAD_COEFF, HARMONIUM_EFFECT)
-        GE_GET_FILTER_TYPE_CASE(HARMONIUM_EFFECT_SATURATION, HARMONIUM_EFFECT)
-        GE_GET_FILTER_TYPE_CASE(HARMONIUM_EFFECT_POS_R_G_B, HARMONIUM_EFFECT)
-        GE_GET_FILTER_TYPE_CASE(HARMONIUM_EFFECT_NEG_R_G_B, HARMONIUM_EFFECT)
-        GE_GET_FILTER_TYPE_CASE(HARMONIUM_EFFECT_FRACTION, HARMONIUM_EFFECT)
-        GE_GET_FILTER_TYPE_CASE(HARMONIUM_EFFECT_TOTAL_MATRIX, HARMONIUM_EFFECT)
-        GE_GET_FILTER_TYPE_CASE(HEAT_DISTORTION_INTENSITY, HEAT_DISTORTION)
-        GE_GET_FILTER_TYPE_CASE(HEAT_DISTORTION_NOISE_SCALE, HEAT_DISTORTION)
-        GE_GET_FILTER_TYPE_CASE(HEAT_DISTORTION_RISE_WEIGHT, HEAT_DISTORTION)
-        GE_GET_FILTER_TYPE_CASE(HEAT_DISTORTION_PROGRESS, HEAT_DISTORTION)
-        GE_GET_FILTER_TYPE_CASE(IMAGE_MASK_IMAGE, IMAGE_MASK)
-        GE_GET_FILTER_TYPE_CASE(KAWASE_BLUR_RADIUS, KAWASE_BLUR)
-        GE_GET_FILTER_TYPE_CASE(LINEAR_GRADIENT_BLUR_BLUR_RADIUS, LINEAR_GRADIENT_BLUR)
-        GE_GET_FILTER_TYPE_CASE(LINEAR_GRADIENT_BLUR_FRACTION_STOPS, LINEAR_GRADIENT_BLUR)
-        GE_GET_FILTER_TYPE_CASE(LINEAR_GRADIENT_BLUR_DIRECTION, LINEAR_GRADIENT_BLUR)
-        GE_GET_FILTER_TYPE_CASE(LINEAR_GRADIENT_BLUR_GEO_WIDTH, LINEAR_GRADIENT_BLUR)
-        GE_GET_FILTER_TYPE_CASE(LINEAR_GRADIENT_BLUR_GEO_HEIGHT, LINEAR_GRADIENT_BLUR)
-        GE_GET_FILTER_TYPE_CASE(LINEAR_GRADIENT_BLUR_MAT, LINEAR_GRADIENT_BLUR)
-        GE_GET_FILTER_TYPE_CASE(LINEAR_GRADIENT_BLUR_TRAN_X, LINEAR_GRADIENT_BLUR)
-        GE_GET_FILTER_TYPE_CASE(LINEAR_GRADIENT_BLUR_TRAN_Y, LINEAR_GRADIENT_BLUR)
-        GE_GET_FILTER_TYPE_CASE(LINEAR_GRADIENT_BLUR_IS_OFFSCREEN_CANVAS, LINEAR_GRADIENT_BLUR)
-        GE_GET_FILTER_TYPE_CASE(LINEAR_GRADIENT_BLUR_IS_RADIUS_GRADIENT, LINEAR_GRADIENT_BLUR)
-        GE_GET_FILTER_TYPE_CASE(LINEAR_GRADIENT_MASK_FRACTION_STOPS, LINEAR_GRADIENT_MASK)
-        GE_GET_FILTER_TYPE_CASE(LINEAR_GRADIENT_MASK_START_POSITION, LINEAR_GRADIENT_MASK)
-        GE_GET_FILTER_TYPE_CASE(LINEAR_GRADIENT_MASK_END_POSITION, LINEAR_GRADIENT_MASK)
-        GE_GET_FILTER_TYPE_CASE(MAGNIFIER_FACTOR, MAGNIFIER)
-        GE_GET_FILTER_TYPE_CASE(MAGNIFIER_WIDTH, MAGNIFIER)
-        GE_GET_FILTER_TYPE_CASE(MAGNIFIER_HEIGHT, MAGNIFIER)
-        GE_GET_FILTER_TYPE_CASE(MAGNIFIER_CORNER_RADIUS, MAGNIFIER)
-        GE_GET_FILTER_TYPE_CASE(MAGNIFIER_BORDER_WIDTH, MAGNIFIER)
-        GE_GET_FILTER_TYPE_CASE(MAGNIFIER_ZOOM_OFFSET_X, MAGNIFIER)
-        GE_GET_FILTER_TYPE_CASE(MAGNIFIER_ZOOM_OFFSET_Y, MAGNIFIER)
-        GE_GET_FILTER_TYPE_CASE(MAGNIFIER_SHADOW_OFFSET_X, MAGNIFIER)
-        GE_GET_FILTER_TYPE_CASE(MAGNIFIER_SHADOW_OFFSET_Y, MAGNIFIER)
-        GE_GET_FILTER_TYPE_CASE(MAGNIFIER_SHADOW_SIZE, MAGNIFIER)
-        GE_GET_FILTER_TYPE_CASE(MAGNIFIER_SHADOW_STRENGTH, MAGNIFIER)
-        GE_GET_FILTER_TYPE_CASE(MAGNIFIER_GRADIENT_MASK_COLOR1, MAGNIFIER)
-        GE_GET_FILTER_TYPE_CASE(MAGNIFIER_GRADIENT_MASK_COLOR2, MAGNIFIER)
-        GE_GET_FILTER_TYPE_CASE(MAGNIFIER_OUTER_CONTOUR_COLOR1, MAGNIFIER)
-        GE_GET_FILTER_TYPE_CASE(MAGNIFIER_OUTER_CONTOUR_COLOR2, MAGNIFIER)
-        GE_GET_FILTER_TYPE_CASE(MAGNIFIER_ROTATE_DEGREE, MAGNIFIER)
-        GE_GET_FILTER_TYPE_CASE(MAGNIFIER_SDF_SHAPE, MAGNIFIER)
-        GE_GET_FILTER_TYPE_CASE(MAP_COLOR_BY_BRIGHTNESS_COLORS, MAP_COLOR_BY_BRIGHTNESS)
-        GE_GET_FILTER_TYPE_CASE(MAP_COLOR_BY_BRIGHTNESS_POSITIONS, MAP_COLOR_BY_BRIGHTNESS)
-        GE_GET_FILTER_TYPE_CASE(MASK_TRANSITION_MASK, MASK_TRANSITION)
-        GE_GET_FILTER_TYPE_CASE(MASK_TRANSITION_FACTOR, MASK_TRANSITION)
-        GE_GET_FILTER_TYPE_CASE(MASK_TRANSITION_INVERSE, MASK_TRANSITION)
-        GE_GET_FILTER_TYPE_CASE(MESA_BLUR_RADIUS, MESA_BLUR)
-        GE_GET_FILTER_TYPE_CASE(MESA_BLUR_GREY_COEF1, MESA_BLUR)
-        GE_GET_FILTER_TYPE_CASE(MESA_BLUR_GREY_COEF2, MESA_BLUR)
-        GE_GET_FILTER_TYPE_CASE(MESA_BLUR_OFFSET_X, MESA_BLUR)
-        GE_GET_FILTER_TYPE_CASE(MESA_BLUR_OFFSET_Y, MESA_BLUR)
-        GE_GET_FILTER_TYPE_CASE(MESA_BLUR_OFFSET_Z, MESA_BLUR)
-        GE_GET_FILTER_TYPE_CASE(MESA_BLUR_OFFSET_W, MESA_BLUR)
-        GE_GET_FILTER_TYPE_CASE(MESA_BLUR_TILE_MODE, MESA_BLUR)
-        GE_GET_FILTER_TYPE_CASE(MESA_BLUR_WIDTH, MESA_BLUR)
-        GE_GET_FILTER_TYPE_CASE(MESA_BLUR_HEIGHT, MESA_BLUR)
-        GE_GET_FILTER_TYPE_CASE(MESA_BLUR_IS_DIRECTION, MESA_BLUR)
-        GE_GET_FILTER_TYPE_CASE(MESA_BLUR_ANGLE, MESA_BLUR)
-        GE_GET_FILTER_TYPE_CASE(MOTION_BLUR_RADIUS, MOTION_BLUR)
-        GE_GET_FILTER_TYPE_CASE(MOTION_BLUR_ANCHOR, MOTION_BLUR)
-        GE_GET_FILTER_TYPE_CASE(MOTION_BLUR_SAMPLE_COUNT, MOTION_BLUR)
-        GE_GET_FILTER_TYPE_CASE(PARTICLE_ABLATION_PROGRESS, PARTICLE_ABLATION)
-        GE_GET_FILTER_TYPE_CASE(PARTICLE_ABLATION_ABLATION_RATE, PARTICLE_ABLATION)
-        GE_GET_FILTER_TYPE_CASE(PARTICLE_ABLATION_CENTERS0, PARTICLE_ABLATION)
-        GE_GET_FILTER_TYPE_CASE(PARTICLE_ABLATION_CENTERS1, PARTICLE_ABLATION)
-        GE_GET_FILTER_TYPE_CASE(PARTICLE_ABLATION_CENTERS2, PARTICLE_ABLATION)
-        GE_GET_FILTER_TYPE_CASE(PARTICLE_ABLATION_CENTERS3, PARTICLE_ABLATION)
-        GE_GET_FILTER_TYPE_CASE(PARTICLE_ABLATION_GLOW_LEVEL, PARTICLE_ABLATION)
-        GE_GET_FILTER_TYPE_CASE(PARTICLE_ABLATION_GLOW_BRIGHTNESS, PARTICLE_ABLATION)
-        GE_GET_FILTER_TYPE_CASE(PARTICLE_ABLATION_MAX_PARTICLE_COUNT, PARTICLE_ABLATION)
-        GE_GET_FILTER_TYPE_CASE(PARTICLE_ABLATION_WIND, PARTICLE_ABLATION)
-        GE_GET_FILTER_TYPE_CASE(PARTICLE_ABLATION_TURB_SCALE, PARTICLE_ABLATION)
-        GE_GET_FILTER_TYPE_CASE(PARTICLE_ABLATION_TURB_EVO, PARTICLE_ABLATION)
-        GE_GET_FILTER_TYPE_CASE(PARTICLE_ABLATION_TURB_AMP, PARTICLE_ABLATION)
-        GE_GET_FILTER_TYPE_CASE(PARTICLE_ABLATION_EXPANSION_SIZE, PARTICLE_ABLATION)
-        GE_GET_FILTER_TYPE_CASE(PARTICLE_CIRCULAR_HALO_CENTER, PARTICLE_CIRCULAR_HALO)
-        GE_GET_FILTER_TYPE_CASE(PARTICLE_CIRCULAR_HALO_RADIUS, PARTICLE_CIRCULAR_HALO)
-        GE_GET_FILTER_TYPE_CASE(PARTICLE_CIRCULAR_HALO_NOISE, PARTICLE_CIRCULAR_HALO)
-        GE_GET_FILTER_TYPE_CASE(PIXEL_MAP_MASK_IMAGE, PIXEL_MAP_MASK)
-        GE_GET_FILTER_TYPE_CASE(PIXEL_MAP_MASK_SRC, PIXEL_MAP_MASK)
-        GE_GET_FILTER_TYPE_CASE(PIXEL_MAP_MASK_DST, PIXEL_MAP_MASK)
-        GE_GET_FILTER_TYPE_CASE(PIXEL_MAP_MASK_FILL_COLOR, PIXEL_MAP_MASK)
-        GE_GET_FILTER_TYPE_CASE(RADIAL_GRADIENT_MASK_CENTER, RADIAL_GRADIENT_MASK)
-        GE_GET_FILTER_TYPE_CASE(RADIAL_GRADIENT_MASK_RADIUS_X, RADIAL_GRADIENT_MASK)
-        GE_GET_FILTER_TYPE_CASE(RADIAL_GRADIENT_MASK_RADIUS_Y, RADIAL_GRADIENT_MASK)
-        GE_GET_FILTER_TYPE_CASE(RADIAL_GRADIENT_MASK_COLORS, RADIAL_GRADIENT_MASK)
-        GE_GET_FILTER_TYPE_CASE(RADIAL_GRADIENT_MASK_POSITIONS, RADIAL_GRADIENT_MASK)
-        GE_GET_FILTER_TYPE_CASE(RIPPLE_MASK_CENTER, RIPPLE_MASK)
-        GE_GET_FILTER_TYPE_CASE(RIPPLE_MASK_RADIUS, RIPPLE_MASK)
-        GE_GET_FILTER_TYPE_CASE(RIPPLE_MASK_WIDTH, RIPPLE_MASK)
-        GE_GET_FILTER_TYPE_CASE(RIPPLE_MASK_WIDTH_CENTER_OFFSET, RIPPLE_MASK)
-        GE_GET_FILTER_TYPE_CASE(SDF_BORDER_SHAPE, SDF_BORDER)
-        GE_GET_FILTER_TYPE_CASE(SDF_BORDER_BORDER, SDF_BORDER)
-        GE_GET_FILTER_TYPE_CASE(SDF_CLIP_SHAPE, SDF_CLIP)
-        GE_GET_FILTER_TYPE_CASE(SDF_COLOR_SHAPE, SDF_COLOR)
-        GE_GET_FILTER_TYPE_CASE(SDF_COLOR_COLOR, SDF_COLOR)
-        GE_GET_FILTER_TYPE_CASE(SDF_DISTORT_OP_SHAPE_SHAPE, SDF_DISTORT_OP_SHAPE)
-        GE_GET_FILTER_TYPE_CASE(SDF_DISTORT_OP_SHAPE_L_U_CORNER, SDF_DISTORT_OP_SHAPE)
-        GE_GET_FILTER_TYPE_CASE(SDF_DISTORT_OP_SHAPE_R_U_CORNER, SDF_DISTORT_OP_SHAPE)
-        GE_GET_FILTER_TYPE_CASE(SDF_DISTORT_OP_SHAPE_R_B_CORNER, SDF_DISTORT_OP_SHAPE)
-        GE_GET_FILTER_TYPE_CASE(SDF_DISTORT_OP_SHAPE_L_B_CORNER, SDF_DISTORT_OP_SHAPE)
-        GE_GET_FILTER_TYPE_CASE(SDF_DISTORT_OP_SHAPE_BARREL_DISTORTION, SDF_DISTORT_OP_SHAPE)
-        GE_GET_FILTER_TYPE_CASE(SDF_EDGE_LIGHT_EFFECT_SDF_SPREAD_FACTOR, SDF_EDGE_LIGHT_EFFECT)
-        GE_GET_FILTER_TYPE_CASE(SDF_EDGE_LIGHT_EFFECT_BLOOM_INTENSITY_CUTOFF, SDF_EDGE_LIGHT_EFFECT)
-        GE_GET_FILTER_TYPE_CASE(SDF_EDGE_LIGHT_EFFECT_MAX_INTENSITY, SDF_EDGE_LIGHT_EFFECT)
-        GE_GET_FILTER_TYPE_CASE(SDF_EDGE_LIGHT_EFFECT_MAX_BLOOM_INTENSITY, SDF_EDGE_LIGHT_EFFECT)
-        GE_GET_FILTER_TYPE_CASE(SDF_EDGE_LIGHT_EFFECT_BLOOM_FALLOFF_POW, SDF_EDGE_LIGHT_EFFECT)
-        GE_GET_FILTER_TYPE_CASE(SDF_EDGE_LIGHT_EFFECT_MIN_BORDER_WIDTH, SDF_EDGE_LIGHT_EFFECT)
-        GE_GET_FILTER_TYPE_CASE(SDF_EDGE_LIGHT_EFFECT_MAX_BORDER_WIDTH, SDF_EDGE_LIGHT_EFFECT)
-        GE_GET_FILTER_TYPE_CASE(SDF_EDGE_LIGHT_EFFECT_INNER_BORDER_BLOOM_WIDTH, SDF_EDGE_LIGHT_EFFECT)
-        GE_GET_FILTER_TYPE_CASE(SDF_EDGE_LIGHT_EFFECT_OUTER_BORDER_BLOOM_WIDTH, SDF_EDGE_LIGHT_EFFECT)
-        GE_GET_FILTER_TYPE_CASE(SDF_EDGE_LIGHT_EFFECT_COLOR, SDF_EDGE_LIGHT_EFFECT)
-        GE_GET_FILTER_TYPE_CASE(SDF_EDGE_LIGHT_EFFECT_SDF_IMAGE, SDF_EDGE_LIGHT_EFFECT)
-        GE_GET_FILTER_TYPE_CASE(SDF_EDGE_LIGHT_EFFECT_LIGHT_MASK, SDF_EDGE_LIGHT_EFFECT)
-        GE_GET_FILTER_TYPE_CASE(SDF_EDGE_LIGHT_EFFECT_SDF_SHAPE, SDF_EDGE_LIGHT_EFFECT)
-        GE_GET_FILTER_TYPE_CASE(SDF_EDGE_LIGHT_SDF_SPREAD_FACTOR, SDF_EDGE_LIGHT)
-        GE_GET_FILTER_TYPE_CASE(SDF_EDGE_LIGHT_BLOOM_INTENSITY_CUTOFF, SDF_EDGE_LIGHT)
-        GE_GET_FILTER_TYPE_CASE(SDF_EDGE_LIGHT_MAX_INTENSITY, SDF_EDGE_LIGHT)
-        GE_GET_FILTER_TYPE_CASE(SDF_EDGE_LIGHT_MAX_BLOOM_INTENSITY, SDF_EDGE_LIGHT)
-        GE_GET_FILTER_TYPE_CASE(SDF_EDGE_LIGHT_BLOOM_FALLOFF_POW, SDF_EDGE_LIGHT)
-        GE_GET_FILTER_TYPE_CASE(SDF_EDGE_LIGHT_MIN_BORDER_WIDTH, SDF_EDGE_LIGHT)
-        GE_GET_FILTER_TYPE_CASE(SDF_EDGE_LIGHT_MAX_BORDER_WIDTH, SDF_EDGE_LIGHT)
-        GE_GET_FILTER_TYPE_CASE(SDF_EDGE_LIGHT_INNER_BORDER_BLOOM_WIDTH, SDF_EDGE_LIGHT)
-        GE_GET_FILTER_TYPE_CASE(SDF_EDGE_LIGHT_OUTER_BORDER_BLOOM_WIDTH, SDF_EDGE_LIGHT)
-        GE_GET_FILTER_TYPE_CASE(SDF_EDGE_LIGHT_SDF_IMAGE, SDF_EDGE_LIGHT)
-        GE_GET_FILTER_TYPE_CASE(SDF_EDGE_LIGHT_LIGHT_MASK, SDF_EDGE_LIGHT)
-        GE_GET_FILTER_TYPE_CASE(SDF_EDGE_LIGHT_SDF_SHAPE, SDF_EDGE_LIGHT)
-        GE_GET_FILTER_TYPE_CASE(SDF_ELLIPSE_SHAPE_CENTER, SDF_ELLIPSE_SHAPE)
-        GE_GET_FILTER_TYPE_CASE(SDF_ELLIPSE_SHAPE_WIDTH, SDF_ELLIPSE_SHAPE)
-        GE_GET_FILTER_TYPE_CASE(SDF_ELLIPSE_SHAPE_HEIGHT, SDF_ELLIPSE_SHAPE)
-        GE_GET_FILTER_TYPE_CASE(SDF_FROM_IMAGE_SPREAD_FACTOR, SDF_FROM_IMAGE)
-        GE_GET_FILTER_TYPE_CASE(SDF_FROM_IMAGE_GENERATE_DERIVS, SDF_FROM_IMAGE)
-        GE_GET_FILTER_TYPE_CASE(SDF_PATH_SHAPE_PATH, SDF_PATH_SHAPE)
-        GE_GET_FILTER_TYPE_CASE(SDF_PATH_SHAPE_OFFSET, SDF_PATH_SHAPE)
-        GE_GET_FILTER_TYPE_CASE(SDF_PATH_SHAPE_SCALE, SDF_PATH_SHAPE)
-        GE_GET_FILTER_TYPE_CASE(SDF_PIXELMAP_SHAPE_IMAGE, SDF_PIXELMAP_SHAPE)
-        GE_GET_FILTER_TYPE_CASE(SDF_RRECT_SHAPE_RRECT, SDF_RRECT_SHAPE)
-        GE_GET_FILTER_TYPE_CASE(SDF_SHADOW_SHAPE, SDF_SHADOW)
-        GE_GET_FILTER_TYPE_CASE(SDF_SHADOW_SHADOW, SDF_SHADOW)
-        GE_GET_FILTER_TYPE_CASE(SDF_SMOOTH_SUB_OP_SHAPE_SPACING, SDF_SMOOTH_SUB_OP_SHAPE)
-        GE_GET_FILTER_TYPE_CASE(SDF_SMOOTH_SUB_OP_SHAPE_LEFT, SDF_SMOOTH_SUB_OP_SHAPE)
-        GE_GET_FILTER_TYPE_CASE(SDF_SMOOTH_SUB_OP_SHAPE_RIGHT, SDF_SMOOTH_SUB_OP_SHAPE)
-        GE_GET_FILTER_TYPE_CASE(SDF_SUB_OP_SHAPE_LEFT, SDF_SUB_OP_SHAPE)
-        GE_GET_FILTER_TYPE_CASE(SDF_SUB_OP_SHAPE_RIGHT, SDF_SUB_OP_SHAPE)
-        GE_GET_FILTER_TYPE_CASE(SDF_TRANSFORM_SHAPE_SHAPE, SDF_TRANSFORM_SHAPE)
-        GE_GET_FILTER_TYPE_CASE(SDF_TRANSFORM_SHAPE_MATRIX, SDF_TRANSFORM_SHAPE)
-        GE_GET_FILTER_TYPE_CASE(SDF_TRANSFORM_SHAPE_WARP_STRENGTH, SDF_TRANSFORM_SHAPE)
-        GE_GET_FILTER_TYPE_CASE(SDF_TRANSFORM_SHAPE_UNION_MODE, SDF_TRANSFORM_SHAPE)
-        GE_GET_FILTER_TYPE_CASE(SDF_TRANSFORM_SHAPE_SPACING, SDF_TRANSFORM_SHAPE)
-        GE_GET_FILTER_TYPE_CASE(SDF_TRANSFORM_SHAPE_HOT_ZONE, SDF_TRANSFORM_SHAPE)
-        GE_GET_FILTER_TYPE_CASE(SDF_TRANSFORM_SHAPE_CENTER_POSITION, SDF_TRANSFORM_SHAPE)
-        GE_GET_FILTER_TYPE_CASE(SDF_TRIANGLE_SHAPE_VERTEX0, SDF_TRIANGLE_SHAPE)
-        GE_GET_FILTER_TYPE_CASE(SDF_TRIANGLE_SHAPE_VERTEX1, SDF_TRIANGLE_SHAPE)
-        GE_GET_FILTER_TYPE_CASE(SDF_TRIANGLE_SHAPE_VERTEX2, SDF_TRIANGLE_SHAPE)
-        GE_GET_FILTER_TYPE_CASE(SDF_TRIANGLE_SHAPE_RADIUS, SDF_TRIANGLE_SHAPE)
-        GE_GET_FILTER_TYPE_CASE(SDF_UNION_OP_SPACING, SDF_UNION_OP)
-        GE_GET_FILTER_TYPE_CASE(SDF_UNION_OP_LEFT, SDF_UNION_OP)
-        GE_GET_FILTER_TYPE_CASE(SDF_UNION_OP_RIGHT, SDF_UNION_OP)
-        GE_GET_FILTER_TYPE_CASE(SDF_UNION_OP_OP, SDF_UNION_OP)
-        GE_GET_FILTER_TYPE_CASE(SOUND_WAVE_COLOR_A, SOUND_WAVE)
-        GE_GET_FILTER_TYPE_CASE(SOUND_WAVE_COLOR_B, SOUND_WAVE)
-        GE_GET_FILTER_TYPE_CASE(SOUND_WAVE_COLOR_C, SOUND_WAVE)
-        GE_GET_FILTER_TYPE_CASE(SOUND_WAVE_COLOR_PROGRESS, SOUND_WAVE)
-        GE_GET_FILTER_TYPE_CASE(SOUND_WAVE_SOUND_INTENSITY, SOUND_WAVE)
-        GE_GET_FILTER_TYPE_CASE(SOUND_WAVE_SHOCK_WAVE_ALPHA_A, SOUND_WAVE)
-        GE_GET_FILTER_TYPE_CASE(SOUND_WAVE_SHOCK_WAVE_ALPHA_B, SOUND_WAVE)
-        GE_GET_FILTER_TYPE_CASE(SOUND_WAVE_SHOCK_WAVE_PROGRESS_A, SOUND_WAVE)
-        GE_GET_FILTER_TYPE_CASE(SOUND_WAVE_SHOCK_WAVE_PROGRESS_B, SOUND_WAVE)
-        GE_GET_FILTER_TYPE_CASE(SOUND_WAVE_SHOCK_WAVE_TOTAL_ALPHA, SOUND_WAVE)
-        GE_GET_FILTER_TYPE_CASE(SPATIAL_GLASS_EFFECT_LEFT_TOP, SPATIAL_GLASS_EFFECT)
-        GE_GET_FILTER_TYPE_CASE(SPATIAL_GLASS_EFFECT_LEFT_BOT, SPATIAL_GLASS_EFFECT)
-        GE_GET_FILTER_TYPE_CASE(SPATIAL_GLASS_EFFECT_RIGHT_TOP, SPATIAL_GLASS_EFFECT)
-        GE_GET_FILTER_TYPE_CASE(SPATIAL_GLASS_EFFECT_RIGHT_BOT, SPATIAL_GLASS_EFFECT)
-        GE_GET_FILTER_TYPE_CASE(SPATIAL_GLASS_EFFECT_CAMERA_POSITION, SPATIAL_GLASS_EFFECT)
-        GE_GET_FILTER_TYPE_CASE(SPATIAL_GLASS_EFFECT_CAMERA_INTRINSICS, SPATIAL_GLASS_EFFECT)
-        GE_GET_FILTER_TYPE_CASE(SPATIAL_GLASS_EFFECT_LIGHT_DIR, SPATIAL_GLASS_EFFECT)
-        GE_GET_FILTER_TYPE_CASE(SPATIAL_GLASS_EFFECT_THICK_PARAMS, SPATIAL_GLASS_EFFECT)
-        GE_GET_FILTER_TYPE_CASE(SPATIAL_GLASS_EFFECT_GLASS_BASE_COLOR, SPATIAL_GLASS_EFFECT)
-        GE_GET_FILTER_TYPE_CASE(SPATIAL_GLASS_EFFECT_FRESNEL_ENV_COLOR, SPATIAL_GLASS_EFFECT)
-        GE_GET_FILTER_TYPE_CASE(SPATIAL_GLASS_EFFECT_FRESNEL_ENV_PARAMS, SPATIAL_GLASS_EFFECT)
-        GE_GET_FILTER_TYPE_CASE(SPATIAL_GLASS_EFFECT_BG_RATES, SPATIAL_GLASS_EFFECT)
-        GE_GET_FILTER_TYPE_CASE(SPATIAL_GLASS_EFFECT_BG_K_B_S, SPATIAL_GLASS_EFFECT)
-        GE_GET_FILTER_TYPE_CASE(SPATIAL_GLASS_EFFECT_BG_POS, SPATIAL_GLASS_EFFECT)
-        GE_GET_FILTER_TYPE_CASE(SPATIAL_GLASS_EFFECT_BG_NEG, SPATIAL_GLASS_EFFECT)
-        GE_GET_FILTER_TYPE_CASE(SPATIAL_GLASS_EFFECT_REFRACT_PARAMS, SPATIAL_GLASS_EFFECT)
-        GE_GET_FILTER_TYPE_CASE(SPATIAL_GLASS_EFFECT_WEIGHTS_EDL, SPATIAL_GLASS_EFFECT)
-        GE_GET_FILTER_TYPE_CASE(SPATIAL_GLASS_EFFECT_ENV_LIGHT_PARAMS, SPATIAL_GLASS_EFFECT)
-        GE_GET_FILTER_TYPE_CASE(SPATIAL_GLASS_EFFECT_ENV_LIGHT_RATES, SPATIAL_GLASS_EFFECT)
-        GE_GET_FILTER_TYPE_CASE(SPATIAL_GLASS_EFFECT_ENV_LIGHT_K_B_S, SPATIAL_GLASS_EFFECT)
-        GE_GET_FILTER_TYPE_CASE(SPATIAL_GLASS_EFFECT_ENV_LIGHT_POS, SPATIAL_GLASS_EFFECT)
-        GE_GET_FILTER_TYPE_CASE(SPATIAL_GLASS_EFFECT_ENV_LIGHT_NEG, SPATIAL_GLASS_EFFECT)
-        GE_GET_FILTER_TYPE_CASE(SPATIAL_GLASS_EFFECT_SD_PARAMS, SPATIAL_GLASS_EFFECT)
-        GE_GET_FILTER_TYPE_CASE(SPATIAL_GLASS_EFFECT_SD_RATES, SPATIAL_GLASS_EFFECT)
-        GE_GET_FILTER_TYPE_CASE(SPATIAL_GLASS_EFFECT_SD_K_B_S, SPATIAL_GLASS_EFFECT)
-        GE_GET_FILTER_TYPE_CASE(SPATIAL_GLASS_EFFECT_SD_POS, SPATIAL_GLASS_EFFECT)
-        GE_GET_FILTER_TYPE_CASE(SPATIAL_GLASS_EFFECT_SD_NEG, SPATIAL_GLASS_EFFECT)
-        GE_GET_FILTER_TYPE_CASE(SPATIAL_GLASS_EFFECT_SDF_SHAPE, SPATIAL_GLASS_EFFECT)
-        GE_GET_FILTER_TYPE_CASE(SPATIAL_GLASS_EFFECT_BLUR_IMAGE, SPATIAL_GLASS_EFFECT)
-        GE_GET_FILTER_TYPE_CASE(SPATIAL_GLASS_EFFECT_DEPTH_IMAGE, SPATIAL_GLASS_EFFECT)
-        GE_GET_FILTER_TYPE_CASE(SPATIAL_GLASS_EFFECT_SNAPSHOT_RECT, SPATIAL_GLASS_EFFECT)
-        GE_GET_FILTER_TYPE_CASE(SPATIAL_GLASS_EFFECT_SNAPSHOT_MATRIX, SPATIAL_GLASS_EFFECT)
-        GE_GET_FILTER_TYPE_CASE(SPATIAL_GLASS_EFFECT_REFRACT_OUT_PX, SPATIAL_GLASS_EFFECT)
-        GE_GET_FILTER_TYPE_CASE(SPATIAL_GLASS_EFFECT_ENABLE_S_D_F_CACHE, SPATIAL_GLASS_EFFECT)
-        GE_GET_FILTER_TYPE_CASE(SPATIAL_POINT_LIGHT_LIGHT_INTENSITY, SPATIAL_POINT_LIGHT)
-        GE_GET_FILTER_TYPE_CASE(SPATIAL_POINT_LIGHT_LIGHT_POSITION, SPATIAL_POINT_LIGHT)
-        GE_GET_FILTER_TYPE_CASE(SPATIAL_POINT_LIGHT_ATTENUATION, SPATIAL_POINT_LIGHT)
-        GE_GET_FILTER_TYPE_CASE(SPATIAL_POINT_LIGHT_LIGHT_COLOR, SPATIAL_POINT_LIGHT)
-        GE_GET_FILTER_TYPE_CASE(SPATIAL_POINT_LIGHT_MASK, SPATIAL_POINT_LIGHT)
-        GE_GET_FILTER_TYPE_CASE(USE_EFFECT_MASK_IMAGE, USE_EFFECT_MASK)
-        GE_GET_FILTER_TYPE_CASE(USE_EFFECT_MASK_USE_EFFECT, USE_EFFECT_MASK)
-        GE_GET_FILTER_TYPE_CASE(VARIABLE_RADIUS_BLUR_MASK, VARIABLE_RADIUS_BLUR)
-        GE_GET_FILTER_TYPE_CASE(VARIABLE_RADIUS_BLUR_BLUR_RADIUS, VARIABLE_RADIUS_BLUR)
-        GE_GET_FILTER_TYPE_CASE(VARIABLE_RADIUS_BLUR_APPLY_INSIDE_MASK, VARIABLE_RADIUS_BLUR)
-        GE_GET_FILTER_TYPE_CASE(WATER_DROPLET_TRANSITION_TOP_LAYER, WATER_DROPLET_TRANSITION)
-        GE_GET_FILTER_TYPE_CASE(WATER_DROPLET_TRANSITION_INVERSE, WATER_DROPLET_TRANSITION)
-        GE_GET_FILTER_TYPE_CASE(WATER_DROPLET_TRANSITION_PROGRESS, WATER_DROPLET_TRANSITION)
-        GE_GET_FILTER_TYPE_CASE(WATER_DROPLET_TRANSITION_RADIUS, WATER_DROPLET_TRANSITION)
-        GE_GET_FILTER_TYPE_CASE(WATER_DROPLET_TRANSITION_TRANSITION_FADE_WIDTH, WATER_DROPLET_TRANSITION)
-        GE_GET_FILTER_TYPE_CASE(WATER_DROPLET_TRANSITION_DISTORTION_INTENSITY, WATER_DROPLET_TRANSITION)
-        GE_GET_FILTER_TYPE_CASE(WATER_DROPLET_TRANSITION_DISTORTION_THICKNESS, WATER_DROPLET_TRANSITION)
-        GE_GET_FILTER_TYPE_CASE(WATER_DROPLET_TRANSITION_LIGHT_STRENGTH, WATER_DROPLET_TRANSITION)
-        GE_GET_FILTER_TYPE_CASE(WATER_DROPLET_TRANSITION_LIGHT_SOFTNESS, WATER_DROPLET_TRANSITION)
-        GE_GET_FILTER_TYPE_CASE(WATER_DROPLET_TRANSITION_NOISE_SCALE_X, WATER_DROPLET_TRANSITION)
-        GE_GET_FILTER_TYPE_CASE(WATER_DROPLET_TRANSITION_NOISE_SCALE_Y, WATER_DROPLET_TRANSITION)
-        GE_GET_FILTER_TYPE_CASE(WATER_DROPLET_TRANSITION_NOISE_STRENGTH_X, WATER_DROPLET_TRANSITION)
-        GE_GET_FILTER_TYPE_CASE(WATER_DROPLET_TRANSITION_NOISE_STRENGTH_Y, WATER_DROPLET_TRANSITION)
-        GE_GET_FILTER_TYPE_CASE(WATER_DROPLET_TRANSITION_POSITION, WATER_DROPLET_TRANSITION)
-        GE_GET_FILTER_TYPE_CASE(WATER_RIPPLE_PROGRESS, WATER_RIPPLE)
-        GE_GET_FILTER_TYPE_CASE(WATER_RIPPLE_WAVE_COUNT, WATER_RIPPLE)
-        GE_GET_FILTER_TYPE_CASE(WATER_RIPPLE_RIPPLE_CENTER_X, WATER_RIPPLE)
-        GE_GET_FILTER_TYPE_CASE(WATER_RIPPLE_RIPPLE_CENTER_Y, WATER_RIPPLE)
-        GE_GET_FILTER_TYPE_CASE(WATER_RIPPLE_RIPPLE_MODE, WATER_RIPPLE)
-        GE_GET_FILTER_TYPE_CASE(WAVE_DISTURBANCE_MASK_CLICK_POS, WAVE_DISTURBANCE_MASK)
-        GE_GET_FILTER_TYPE_CASE(WAVE_DISTURBANCE_MASK_PROGRESS, WAVE_DISTURBANCE_MASK)
-        GE_GET_FILTER_TYPE_CASE(WAVE_DISTURBANCE_MASK_WAVE_R_D, WAVE_DISTURBANCE_MASK)
-        GE_GET_FILTER_TYPE_CASE(WAVE_DISTURBANCE_MASK_WAVE_L_W_H, WAVE_DISTURBANCE_MASK)
-        GE_GET_FILTER_TYPE_CASE(WAVE_GRADIENT_MASK_CENTER, WAVE_GRADIENT_MASK)
-        GE_GET_FILTER_TYPE_CASE(WAVE_GRADIENT_MASK_WIDTH, WAVE_GRADIENT_MASK)
-        GE_GET_FILTER_TYPE_CASE(WAVE_GRADIENT_MASK_PROPAGATION_RADIUS, WAVE_GRADIENT_MASK)
-        GE_GET_FILTER_TYPE_CASE(WAVE_GRADIENT_MASK_BLUR_RADIUS, WAVE_GRADIENT_MASK)
-        GE_GET_FILTER_TYPE_CASE(WAVE_GRADIENT_MASK_TURBULENCE_STRENGTH, WAVE_GRADIENT_MASK)
-        GE_GET_FILTER_TYPE_CASE(WAVY_RIPPLE_LIGHT_CENTER, WAVY_RIPPLE_LIGHT)
-        GE_GET_FILTER_TYPE_CASE(WAVY_RIPPLE_LIGHT_RADIUS, WAVY_RIPPLE_LIGHT)
-        GE_GET_FILTER_TYPE_CASE(WAVY_RIPPLE_LIGHT_THICKNESS, WAVY_RIPPLE_LIGHT)
-        GE_GET_FILTER_TYPE_CASE(AIBAR_GLOW_L_T_W_H, AIBAR_GLOW)
-        GE_GET_FILTER_TYPE_CASE(AIBAR_GLOW_STRETCH_FACTOR, AIBAR_GLOW)
-        GE_GET_FILTER_TYPE_CASE(AIBAR_GLOW_BAR_ANGLE, AIBAR_GLOW)
-        GE_GET_FILTER_TYPE_CASE(AIBAR_GLOW_COLORS0, AIBAR_GLOW)
-        GE_GET_FILTER_TYPE_CASE(AIBAR_GLOW_COLORS1, AIBAR_GLOW)
-        GE_GET_FILTER_TYPE_CASE(AIBAR_GLOW_COLORS2, AIBAR_GLOW)
-        GE_GET_FILTER_TYPE_CASE(AIBAR_GLOW_COLORS3, AIBAR_GLOW)
-        GE_GET_FILTER_TYPE_CASE(AIBAR_GLOW_POSITIONS0, AIBAR_GLOW)
-        GE_GET_FILTER_TYPE_CASE(AIBAR_GLOW_POSITIONS1, AIBAR_GLOW)
-        GE_GET_FILTER_TYPE_CASE(AIBAR_GLOW_POSITIONS2, AIBAR_GLOW)
-        GE_GET_FILTER_TYPE_CASE(AIBAR_GLOW_POSITIONS3, AIBAR_GLOW)
-        GE_GET_FILTER_TYPE_CASE(AIBAR_GLOW_STRENGTHS, AIBAR_GLOW)
-        GE_GET_FILTER_TYPE_CASE(AIBAR_GLOW_BRIGHTNESS, AIBAR_GLOW)
-        GE_GET_FILTER_TYPE_CASE(AIBAR_GLOW_PROGRESS, AIBAR_GLOW)
-        GE_GET_FILTER_TYPE_CASE(AIBAR_RECT_HALO_L_T_W_H, AIBAR_RECT_HALO)
-        GE_GET_FILTER_TYPE_CASE(AIBAR_RECT_HALO_COLORS0, AIBAR_RECT_HALO)
-        GE_GET_FILTER_TYPE_CASE(AIBAR_RECT_HALO_COLORS1, AIBAR_RECT_HALO)
-        GE_GET_FILTER_TYPE_CASE(AIBAR_RECT_HALO_COLORS2, AIBAR_RECT_HALO)
-        GE_GET_FILTER_TYPE_CASE(AIBAR_RECT_HALO_COLORS3, AIBAR_RECT_HALO)
-        GE_GET_FILTER_TYPE_CASE(AIBAR_RECT_HALO_POSITIONS0, AIBAR_RECT_HALO)
-        GE_GET_FILTER_TYPE_CASE(AIBAR_RECT_HALO_POSITIONS1, AIBAR_RECT_HALO)
-        GE_GET_FILTER_TYPE_CASE(AIBAR_RECT_HALO_POSITIONS2, AIBAR_RECT_HALO)
-        GE_GET_FILTER_TYPE_CASE(AIBAR_RECT_HALO_POSITIONS3, AIBAR_RECT_HALO)
-        GE_GET_FILTER_TYPE_CASE(AIBAR_RECT_HALO_STRENGTHS, AIBAR_RECT_HALO)
-        GE_GET_FILTER_TYPE_CASE(AIBAR_RECT_HALO_BRIGHTNESS, AIBAR_RECT_HALO)
-        GE_GET_FILTER_TYPE_CASE(AIBAR_RECT_HALO_PROGRESS, AIBAR_RECT_HALO)
-        GE_GET_FILTER_TYPE_CASE(COLOR_GRADIENT_EFFECT_COLORS0, COLOR_GRADIENT_EFFECT)
-        GE_GET_FILTER_TYPE_CASE(COLOR_GRADIENT_EFFECT_COLORS1, COLOR_GRADIENT_EFFECT)
-        GE_GET_FILTER_TYPE_CASE(COLOR_GRADIENT_EFFECT_COLORS2, COLOR_GRADIENT_EFFECT)
-        GE_GET_FILTER_TYPE_CASE(COLOR_GRADIENT_EFFECT_COLORS3, COLOR_GRADIENT_EFFECT)
-        GE_GET_FILTER_TYPE_CASE(COLOR_GRADIENT_EFFECT_COLORS4, COLOR_GRADIENT_EFFECT)
-        GE_GET_FILTER_TYPE_CASE(COLOR_GRADIENT_EFFECT_COLORS5, COLOR_GRADIENT_EFFECT)
-        GE_GET_FILTER_TYPE_CASE(COLOR_GRADIENT_EFFECT_COLORS6, COLOR_GRADIENT_EFFECT)
-        GE_GET_FILTER_TYPE_CASE(COLOR_GRADIENT_EFFECT_COLORS7, COLOR_GRADIENT_EFFECT)
-        GE_GET_FILTER_TYPE_CASE(COLOR_GRADIENT_EFFECT_COLORS8, COLOR_GRADIENT_EFFECT)
-        GE_GET_FILTER_TYPE_CASE(COLOR_GRADIENT_EFFECT_COLORS9, COLOR_GRADIENT_EFFECT)
-        GE_GET_FILTER_TYPE_CASE(COLOR_GRADIENT_EFFECT_COLORS10, COLOR_GRADIENT_EFFECT)
-        GE_GET_FILTER_TYPE_CASE(COLOR_GRADIENT_EFFECT_COLORS11, COLOR_GRADIENT_EFFECT)
-        GE_GET_FILTER_TYPE_CASE(COLOR_GRADIENT_EFFECT_POSITIONS0, COLOR_GRADIENT_EFFECT)
-        GE_GET_FILTER_TYPE_CASE(COLOR_GRADIENT_EFFECT_POSITIONS1, COLOR_GRADIENT_EFFECT)
-        GE_GET_FILTER_TYPE_CASE(COLOR_GRADIENT_EFFECT_POSITIONS2, COLOR_GRADIENT_EFFECT)
-        GE_GET_FILTER_TYPE_CASE(COLOR_GRADIENT_EFFECT_POSITIONS3, COLOR_GRADIENT_EFFECT)
-        GE_GET_FILTER_TYPE_CASE(COLOR_GRADIENT_EFFECT_POSITIONS4, COLOR_GRADIENT_EFFECT)
-        GE_GET_FILTER_TYPE_CASE(COLOR_GRADIENT_EFFECT_POSITIONS5, COLOR_GRADIENT_EFFECT)
-        GE_GET_FILTER_TYPE_CASE(COLOR_GRADIENT_EFFECT_POSITIONS6, COLOR_GRADIENT_EFFECT)
-        GE_GET_FILTER_TYPE_CASE(COLOR_GRADIENT_EFFECT_POSITIONS7, COLOR_GRADIENT_EFFECT)
-        GE_GET_FILTER_TYPE_CASE(COLOR_GRADIENT_EFFECT_POSITIONS8, COLOR_GRADIENT_EFFECT)
-        GE_GET_FILTER_TYPE_CASE(COLOR_GRADIENT_EFFECT_POSITIONS9, COLOR_GRADIENT_EFFECT)
-        GE_GET_FILTER_TYPE_CASE(COLOR_GRADIENT_EFFECT_POSITIONS10, COLOR_GRADIENT_EFFECT)
-        GE_GET_FILTER_TYPE_CASE(COLOR_GRADIENT_EFFECT_POSITIONS11, COLOR_GRADIENT_EFFECT)
-        GE_GET_FILTER_TYPE_CASE(COLOR_GRADIENT_EFFECT_STRENGTHS0, COLOR_GRADIENT_EFFECT)
-        GE_GET_FILTER_TYPE_CASE(COLOR_GRADIENT_EFFECT_STRENGTHS1, COLOR_GRADIENT_EFFECT)
-        GE_GET_FILTER_TYPE_CASE(COLOR_GRADIENT_EFFECT_STRENGTHS2, COLOR_GRADIENT_EFFECT)
-        GE_GET_FILTER_TYPE_CASE(COLOR_GRADIENT_EFFECT_STRENGTHS3, COLOR_GRADIENT_EFFECT)
-        GE_GET_FILTER_TYPE_CASE(COLOR_GRADIENT_EFFECT_STRENGTHS4, COLOR_GRADIENT_EFFECT)
-        GE_GET_FILTER_TYPE_CASE(COLOR_GRADIENT_EFFECT_STRENGTHS5, COLOR_GRADIENT_EFFECT)
-        GE_GET_FILTER_TYPE_CASE(COLOR_GRADIENT_EFFECT_STRENGTHS6, COLOR_GRADIENT_EFFECT)
-        GE_GET_FILTER_TYPE_CASE(COLOR_GRADIENT_EFFECT_STRENGTHS7, COLOR_GRADIENT_EFFECT)
-        GE_GET_FILTER_TYPE_CASE(COLOR_GRADIENT_EFFECT_STRENGTHS8, COLOR_GRADIENT_EFFECT)
-        GE_GET_FILTER_TYPE_CASE(COLOR_GRADIENT_EFFECT_STRENGTHS9, COLOR_GRADIENT_EFFECT)
-        GE_GET_FILTER_TYPE_CASE(COLOR_GRADIENT_EFFECT_STRENGTHS10, COLOR_GRADIENT_EFFECT)
-        GE_GET_FILTER_TYPE_CASE(COLOR_GRADIENT_EFFECT_STRENGTHS11, COLOR_GRADIENT_EFFECT)
-        GE_GET_FILTER_TYPE_CASE(COLOR_GRADIENT_EFFECT_COLOR_NUM, COLOR_GRADIENT_EFFECT)
-        GE_GET_FILTER_TYPE_CASE(COLOR_GRADIENT_EFFECT_BLEND, COLOR_GRADIENT_EFFECT)
-        GE_GET_FILTER_TYPE_CASE(COLOR_GRADIENT_EFFECT_BLENDK, COLOR_GRADIENT_EFFECT)
-        GE_GET_FILTER_TYPE_CASE(COLOR_GRADIENT_EFFECT_MASK, COLOR_GRADIENT_EFFECT)
-        GE_GET_FILTER_TYPE_CASE(COLOR_GRADIENT_EFFECT_BRIGHTNESS, COLOR_GRADIENT_EFFECT)
-        GE_GET_FILTER_TYPE_CASE(DISTORT_CHROMA_PROGRESS, DISTORT_CHROMA)
-        GE_GET_FILTER_TYPE_CASE(DISTORT_CHROMA_TURBULENT_MASK, DISTORT_CHROMA)
-        GE_GET_FILTER_TYPE_CASE(DISTORT_CHROMA_FREQUENCY, DISTORT_CHROMA)
-        GE_GET_FILTER_TYPE_CASE(DISTORT_CHROMA_SHARPNESS, DISTORT_CHROMA)
-        GE_GET_FILTER_TYPE_CASE(DISTORT_CHROMA_BRIGHTNESS, DISTORT_CHROMA)
-        GE_GET_FILTER_TYPE_CASE(DISTORT_CHROMA_DISPERSION, DISTORT_CHROMA)
-        GE_GET_FILTER_TYPE_CASE(DISTORT_CHROMA_SATURATION, DISTORT_CHROMA)
-        GE_GET_FILTER_TYPE_CASE(DISTORT_CHROMA_VERTICAL_MOVE_DISTANCE, DISTORT_CHROMA)
-        GE_GET_FILTER_TYPE_CASE(DISTORT_CHROMA_GRANULARITY, DISTORT_CHROMA)
-        GE_GET_FILTER_TYPE_CASE(DISTORT_CHROMA_DISTORT_FACTOR, DISTORT_CHROMA)
-        GE_GET_FILTER_TYPE_CASE(DISTORT_CHROMA_COLOR_STRENGTH, DISTORT_CHROMA)
-        GE_GET_FILTER_TYPE_CASE(DISTORT_CHROMA_MASK, DISTORT_CHROMA)
-        GE_GET_FILTER_TYPE_CASE(DUPOLI_NOISE_MASK_PROGRESS, DUPOLI_NOISE_MASK)
-        GE_GET_FILTER_TYPE_CASE(DUPOLI_NOISE_MASK_GRANULARITY, DUPOLI_NOISE_MASK)
-        GE_GET_FILTER_TYPE_CASE(DUPOLI_NOISE_MASK_VERTICAL_MOVE_DISTANCE, DUPOLI_NOISE_MASK)
-        GE_GET_FILTER_TYPE_CASE(GRADIENT_FLOW_COLORS_COLORS0, GRADIENT_FLOW_COLORS)
-        GE_GET_FILTER_TYPE_CASE(GRADIENT_FLOW_COLORS_COLORS1, GRADIENT_FLOW_COLORS)
-        GE_GET_FILTER_TYPE_CASE(GRADIENT_FLOW_COLORS_COLORS2, GRADIENT_FLOW_COLORS)
-        GE_GET_FILTER_TYPE_CASE(GRADIENT_FLOW_COLORS_COLORS3, GRADIENT_FLOW_COLORS)
-        GE_GET_FILTER_TYPE_CASE(GRADIENT_FLOW_COLORS_GRADIENT_BEGIN, GRADIENT_FLOW_COLORS)
-        GE_GET_FILTER_TYPE_CASE(GRADIENT_FLOW_COLORS_GRADIENT_END, GRADIENT_FLOW_COLORS)
-        GE_GET_FILTER_TYPE_CASE(GRADIENT_FLOW_COLORS_EFFECT_ALPHA, GRADIENT_FLOW_COLORS)
-        GE_GET_FILTER_TYPE_CASE(GRADIENT_FLOW_COLORS_PROGRESS, GRADIENT_FLOW_COLORS)
-        GE_GET_FILTER_TYPE_CASE(LIGHT_CAVE_COLOR_A, LIGHT_CAVE)
-        GE_GET_FILTER_TYPE_CASE(LIGHT_CAVE_COLOR_B, LIGHT_CAVE)
-        GE_GET_FILTER_TYPE_CASE(LIGHT_CAVE_COLOR_C, LIGHT_CAVE)
-        GE_GET_FILTER_TYPE_CASE(LIGHT_CAVE_POSITION, LIGHT_CAVE)
-        GE_GET_FILTER_TYPE_CASE(LIGHT_CAVE_RADIUS_X_Y, LIGHT_CAVE)
-        GE_GET_FILTER_TYPE_CASE(LIGHT_CAVE_PROGRESS, LIGHT_CAVE)
-        GE_GET_FILTER_TYPE_CASE(NOISY_FRAME_GRADIENT_MASK_GRADIENT_BEZIER_CONTROL_POINTS, NOISY_FRAME_GRADIENT_MASK)
-        GE_GET_FILTER_TYPE_CASE(NOISY_FRAME_GRADIENT_MASK_CORNER_RADIUS, NOISY_FRAME_GRADIENT_MASK)
-        GE_GET_FILTER_TYPE_CASE(NOISY_FRAME_GRADIENT_MASK_INNER_FRAME_WIDTH, NOISY_FRAME_GRADIENT_MASK)
-        GE_GET_FILTER_TYPE_CASE(NOISY_FRAME_GRADIENT_MASK_MIDDLE_FRAME_WIDTH, NOISY_FRAME_GRADIENT_MASK)
-        GE_GET_FILTER_TYPE_CASE(NOISY_FRAME_GRADIENT_MASK_OUTSIDE_FRAME_WIDTH, NOISY_FRAME_GRADIENT_MASK)
-        GE_GET_FILTER_TYPE_CASE(NOISY_FRAME_GRADIENT_MASK_R_RECT_W_H, NOISY_FRAME_GRADIENT_MASK)
-        GE_GET_FILTER_TYPE_CASE(NOISY_FRAME_GRADIENT_MASK_R_RECT_POS, NOISY_FRAME_GRADIENT_MASK)
-        GE_GET_FILTER_TYPE_CASE(NOISY_FRAME_GRADIENT_MASK_SLOPE, NOISY_FRAME_GRADIENT_MASK)
-        GE_GET_FILTER_TYPE_CASE(NOISY_FRAME_GRADIENT_MASK_PROGRESS, NOISY_FRAME_GRADIENT_MASK)
-        GE_GET_FILTER_TYPE_CASE(ROUNDED_RECT_FLOWLIGHT_START_END_POSITION, ROUNDED_RECT_FLOWLIGHT)
-        GE_GET_FILTER_TYPE_CASE(ROUNDED_RECT_FLOWLIGHT_WAVE_LENGTH, ROUNDED_RECT_FLOWLIGHT)
-        GE_GET_FILTER_TYPE_CASE(ROUNDED_RECT_FLOWLIGHT_WAVE_TOP, ROUNDED_RECT_FLOWLIGHT)
-        GE_GET_FILTER_TYPE_CASE(ROUNDED_RECT_FLOWLIGHT_CORNER_RADIUS, ROUNDED_RECT_FLOWLIGHT)
-        GE_GET_FILTER_TYPE_CASE(ROUNDED_RECT_FLOWLIGHT_BRIGHTNESS, ROUNDED_RECT_FLOWLIGHT)
-        GE_GET_FILTER_TYPE_CASE(ROUNDED_RECT_FLOWLIGHT_SCALE, ROUNDED_RECT_FLOWLIGHT)
-        GE_GET_FILTER_TYPE_CASE(ROUNDED_RECT_FLOWLIGHT_SHARPING, ROUNDED_RECT_FLOWLIGHT)
-        GE_GET_FILTER_TYPE_CASE(ROUNDED_RECT_FLOWLIGHT_FEATHERING, ROUNDED_RECT_FLOWLIGHT)
-        GE_GET_FILTER_TYPE_CASE(ROUNDED_RECT_FLOWLIGHT_FEATHERING_BEZIER_CONTROL_POINTS, ROUNDED_RECT_FLOWLIGHT)
-        GE_GET_FILTER_TYPE_CASE(ROUNDED_RECT_FLOWLIGHT_GRADIENT_BEZIER_CONTROL_POINTS, ROUNDED_RECT_FLOWLIGHT)
-        GE_GET_FILTER_TYPE_CASE(ROUNDED_RECT_FLOWLIGHT_COLOR, ROUNDED_RECT_FLOWLIGHT)
-        GE_GET_FILTER_TYPE_CASE(ROUNDED_RECT_FLOWLIGHT_PROGRESS, ROUNDED_RECT_FLOWLIGHT)
-        default:
-            return GEFilterType::NONE;
+#undef GE_ESTIMATE_COST_CASE
+
+namespace {
+// Kind of a SetParamsMemberByTag value, the position of its type in FOR_EACH_PARAM_TYPE plus one
+template<typename T>
+struct GEParamsValueKind;
+
+#define GE_PARAMS_VALUE_KIND(Type, Kind)       \
+    template<>                                 \
+    struct GEParamsValueKind<Type> {           \
+        static constexpr uint8_t VALUE = Kind; \
+    }
+
+GE_PARAMS_VALUE_KIND(ESCAPE(DotMatrixDirection), 1);
+GE_PARAMS_VALUE_KIND(ESCAPE(DotMatrixEffectType), 2);
+GE_PARAMS_VALUE_KIND(ESCAPE(Drawing::Color4f), 3);
+GE_PARAMS_VALUE_KIND(ESCAPE(Drawing::Matrix), 4);
+GE_PARAMS_VALUE_KIND(ESCAPE(Drawing::Path), 5);
+GE_PARAMS_VALUE_KIND(ESCAPE(Drawing::Point), 6);
+GE_PARAMS_VALUE_KIND(ESCAPE(GEBezierWarpShaderFilterControlPointArray), 7);
+GE_PARAMS_VALUE_KIND(ESCAPE(GERRect), 8);
+GE_PARAMS_VALUE_KIND(ESCAPE(GESDFBorderParams), 9);
+GE_PARAMS_VALUE_KIND(ESCAPE(GESDFShadowParams), 10);
+GE_PARAMS_VALUE_KIND(ESCAPE(GESDFUnionOp), 11);
+GE_PARAMS_VALUE_KIND(ESCAPE(RectF), 12);
+GE_PARAMS_VALUE_KIND(ESCAPE(Vector2f), 13);
+GE_PARAMS_VALUE_KIND(ESCAPE(Vector3f), 14);
+GE_PARAMS_VALUE_KIND(ESCAPE(Vector4f), 15);
+GE_PARAMS_VALUE_KIND(ESCAPE(bool), 16);
+GE_PARAMS_VALUE_KIND(ESCAPE(float), 17);
+GE_PARAMS_VALUE_KIND(ESCAPE(int32_t), 18);
+GE_PARAMS_VALUE_KIND(ESCAPE(std::pair<float, float>), 19);
+GE_PARAMS_VALUE_KIND(ESCAPE(std::shared_ptr<Drawing::GEShaderShape>), 20);
+GE_PARAMS_VALUE_KIND(ESCAPE(std::shared_ptr<Drawing::Image>), 21);
+GE_PARAMS_VALUE_KIND(ESCAPE(std::shared_ptr<GEShaderMask>), 22);
+GE_PARAMS_VALUE_KIND(ESCAPE(std::vector<Vector2f>), 23);
+GE_PARAMS_VALUE_KIND(ESCAPE(std::vector<Vector4f>), 24);
+GE_PARAMS_VALUE_KIND(ESCAPE(std::vector<float>), 25);
+GE_PARAMS_VALUE_KIND(ESCAPE(std::vector<std::pair<float, float>>), 26);
+GE_PARAMS_VALUE_KIND(ESCAPE(std::weak_ptr<Drawing::Image>), 27);
+GE_PARAMS_VALUE_KIND(ESCAPE(uint32_t), 28);
+
+#undef GE_PARAMS_VALUE_KIND
+
+using GEParamsMemberSetter = void (*)(GEFilterParams& params, const void* value);
+using GEParamsMemberHasher = void (*)(const GEFilterParams& params, GEParamsHasher& hasher);
+
+// Member of one tag: the filter type owning it, up to two accepted value kinds with their setters and the
+// hasher of the field. The second kind is the field type of cast_from members, kind 0 accepts nothing.
+struct GEParamsMemberEntry {
+    GEFilterType filterType;
+    uint8_t valueKind;
+    uint8_t fieldKind;
+    GEParamsMemberSetter valueSetter;
+    GEParamsMemberSetter fieldSetter;
+    GEParamsMemberHasher hasher;
+};
+
+// Transforms the value with the constraints of Tag and stores it, the caller checked the filter type
+template<GEParamsMemberTag Tag, typename SetterType>
+void SetMember(GEFilterParams& params, const void* value)
+{
+    using Accessor = GEParamsFieldAccessor<Tag>;
+    using FieldType = typename Accessor::FieldType;
+    auto* actualParams = static_cast<GEFilterParamsWrapper<typename Accessor::ParamsType>&>(params).data.get();
+    if (actualParams == nullptr) {
+        return;
+    }
+    FieldType transformed;
+    if (GEParamsValueTransformer<Tag, SetterType, FieldType>::Transform(
+        *static_cast<const SetterType*>(value), transformed)) {
+        Accessor::Set(*actualParams, transformed);
+    }
+}
+
+// Adds the field of Tag to the content hash, the caller checked the filter type
+template<GEParamsMemberTag Tag>
+void HashMember(const GEFilterParams& params, GEParamsHasher& hasher)
+{
+    using Accessor = GEParamsFieldAccessor<Tag>;
+    const auto* actualParams =
+        static_cast<const GEFilterParamsWrapper<typename Accessor::ParamsType>&>(params).data.get();
+    if (actualParams != nullptr) {
+        hasher.Add(Accessor::Get(*actualParams));
+    }
+}
+
+#define GE_PARAMS_MEMBER_ENTRY(Tag, FilterTypeEnum, Type)                                                          \
+    {                                                                                                              \
+        GEFilterType::FilterTypeEnum, GEParamsValueKind<Type>::VALUE, 0, &SetMember<GEParamsMemberTag::Tag, Type>, \
+            nullptr, &HashMember<GEParamsMemberTag::Tag>                                                           \
+    }
+#define GE_PARAMS_MEMBER_CAST_ENTRY(Tag, FilterTypeEnum, Type, FieldType)                                  \
+    {                                                                                                      \
+        GEFilterType::FilterTypeEnum, GEParamsValueKind<Type>::VALUE, GEParamsValueKind<FieldType>::VALUE, \
+            &SetMember<GEParamsMemberTag::Tag, Type>, &SetMember<GEParamsMemberTag::Tag, FieldType>,       \
+            &HashMember<GEParamsMemberTag::Tag>                                                            \
+    }
+#define GE_PARAMS_MEMBER_BLOCKED_ENTRY(Tag, FilterTypeEnum) \
+    { GEFilterType::FilterTypeEnum, 0, 0, nullptr, nullptr, nullptr }
+
+// Indexed by GEParamsMemberTag
+constexpr GEParamsMemberEntry MEMBER_TABLE[] = {
+    GE_PARAMS_MEMBER_BLOCKED_ENTRY(INVALID, NONE),
+    GE_PARAMS_MEMBER_ENTRY(AIBAR_AI_BAR_LOW, AIBAR, ESCAPE(float)),
+    GE_PARAMS_MEMBER_ENTRY(AIBAR_AI_BAR_HIGH, AIBAR, ESCAPE(float)),
+    GE_PARAMS_MEMBER_ENTRY(AIBAR_AI_BAR_THRESHOLD, AIBAR, ESCAPE(float)),
+    GE_PARAMS_MEMBER_ENTRY(AIBAR_AI_BAR_OPACITY, AIBAR, ESCAPE(float)),
+    GE_PARAMS_MEMBER_ENTRY(AIBAR_AI_BAR_SATURATION, AIBAR, ESCAPE(float)),
+    GE_PARAMS_MEMBER_ENTRY(AURORA_NOISE_NOISE, AURORA_NOISE, ESCAPE(float)),
+    GE_PARAMS_MEMBER_ENTRY(AURORA_NOISE_FREQ_X, AURORA_NOISE, ESCAPE(float)),
+    GE_PARAMS_MEMBER_ENTRY(AURORA_NOISE_FREQ_Y, AURORA_NOISE, ESCAPE(float)),
+    GE_PARAMS_MEMBER_ENTRY(BEZIER_WARP_DESTINATION_PATCH, BEZIER_WARP,
+        ESCAPE(GEBezierWarpShaderFilterControlPointArray)),
+    GE_PARAMS_MEMBER_CAST_ENTRY(BEZIER_WARP_DESTINATION_PATCH0, BEZIER_WARP, ESCAPE(std::pair<float, float>),
+        ESCAPE(Drawing::Point)),
+    GE_PARAMS_MEMBER_CAST_ENTRY(BEZIER_WARP_DESTINATION_PATCH1, BEZIER_WARP, ESCAPE(std::pair<float, float>),
+        ESCAPE(Drawing::Point)),
+    GE_PARAMS_MEMBER_CAST_ENTRY(BEZIER_WARP_DESTINATION_PATCH2, BEZIER_WARP, ESCAPE(std::pair<float, float>),
+        ESCAPE(Drawing::Point)),
+    GE_PARAMS_MEMBER_CAST_ENTRY(BEZIER_WARP_DESTINATION_PATCH3, BEZIER_WARP, ESCAPE(std::pair<float, float>),
+        ESCAPE(Drawing::Point)),
+    GE_PARAMS_MEMBER_CAST_ENTRY(BEZIER_WARP_DESTINATION_PATCH4, BEZIER_WARP, ESCAPE(std::pair<float, float>),
+        ESCAPE(Drawing::Point)),
+    GE_PARAMS_MEMBER_CAST_ENTRY(BEZIER_WARP_DESTINATION_PATCH5, BEZIER_WARP, ESCAPE(std::pair<float, float>),
+        ESCAPE(Drawing::Point)),
+    GE_PARAMS_MEMBER_CAST_ENTRY(BEZIER_WARP_DESTINATION_PATCH6, BEZIER_WARP, ESCAPE(std::pair<float, float>),
+        ESCAPE(Drawing::Point)),
+    GE_PARAMS_MEMBER_CAST_ENTRY(BEZIER_WARP_DESTINATION_PATCH7, BEZIER_WARP, ESCAPE(std::pair<float, float>),
+        ESCAPE(Drawing::Point)),
+    GE_PARAMS_MEMBER_CAST_ENTRY(BEZIER_WARP_DESTINATION_PATCH8, BEZIER_WARP, ESCAPE(std::pair<float, float>),
+        ESCAPE(Drawing::Point)),
+    GE_PARAMS_MEMBER_CAST_ENTRY(BEZIER_WARP_DESTINATION_PATCH9, BEZIER_WARP, ESCAPE(std::pair<float, float>),
+        ESCAPE(Drawing::Point)),
+    GE_PARAMS_MEMBER_CAST_ENTRY(BEZIER_WARP_DESTINATION_PATCH10, BEZIER_WARP, ESCAPE(std::pair<float, float>),
+        ESCAPE(Drawing::Point)),
+    GE_PARAMS_MEMBER_CAST_ENTRY(BEZIER_WARP_DESTINATION_PATCH11, BEZIER_WARP, ESCAPE(std::pair<float, float>),
+        ESCAPE(Drawing::Point)),
+    GE_PARAMS_MEMBER_ENTRY(BLUR_BUBBLES_RISE_BLUR_INTENSITY, BLUR_BUBBLES_RISE, ESCAPE(float)),
+    GE_PARAMS_MEMBER_ENTRY(BLUR_BUBBLES_RISE_MIX_STRENGTH, BLUR_BUBBLES_RISE, ESCAPE(float)),
+    GE_PARAMS_MEMBER_ENTRY(BLUR_BUBBLES_RISE_PROGRESS, BLUR_BUBBLES_RISE, ESCAPE(float)),
+    GE_PARAMS_MEMBER_ENTRY(BLUR_BUBBLES_RISE_MASK_IMAGE, BLUR_BUBBLES_RISE, ESCAPE(std::shared_ptr<Drawing::Image>)),
+    GE_PARAMS_MEMBER_ENTRY(BLUR_RADIUS_X, BLUR, ESCAPE(float)),
+    GE_PARAMS_MEMBER_ENTRY(BLUR_RADIUS_Y, BLUR, ESCAPE(float)),
+    GE_PARAMS_MEMBER_ENTRY(BLUR_DISABLE_SYSTEM_ADAPTATION, BLUR, ESCAPE(bool)),
+    GE_PARAMS_MEMBER_ENTRY(BLUR_EXPAND_DRAW_REGION, BLUR, ESCAPE(bool)),
+    GE_PARAMS_MEMBER_ENTRY(BORDER_LIGHT_POSITION, BORDER_LIGHT, ESCAPE(Vector3f)),
+    GE_PARAMS_MEMBER_ENTRY(BORDER_LIGHT_COLOR, BORDER_LIGHT, ESCAPE(Vector4f)),
+    GE_PARAMS_MEMBER_ENTRY(BORDER_LIGHT_INTENSITY, BORDER_LIGHT, ESCAPE(float)),
+    GE_PARAMS_MEMBER_ENTRY(BORDER_LIGHT_WIDTH, BORDER_LIGHT, ESCAPE(float)),
+    GE_PARAMS_MEMBER_ENTRY(BORDER_LIGHT_ROTATION_ANGLE, BORDER_LIGHT, ESCAPE(Vector3f)),
+    GE_PARAMS_MEMBER_ENTRY(BORDER_LIGHT_CORNER_RADIUS, BORDER_LIGHT, ESCAPE(float)),
+    GE_PARAMS_MEMBER_ENTRY(BORDER_SDF_LG_COLOR_ANGLE, BORDER_SDF_LG_COLOR, ESCAPE(float)),
+    GE_PARAMS_MEMBER_ENTRY(BORDER_SDF_LG_COLOR_WIDTH, BORDER_SDF_LG_COLOR, ESCAPE(float)),
+    GE_PARAMS_MEMBER_ENTRY(BORDER_SDF_LG_COLOR_IS_OUTLINE, BORDER_SDF_LG_COLOR, ESCAPE(bool)),
+    GE_PARAMS_MEMBER_ENTRY(BORDER_SDF_LG_COLOR_COLOR_NUMBER, BORDER_SDF_LG_COLOR, ESCAPE(int32_t)),
+    GE_PARAMS_MEMBER_ENTRY(BORDER_SDF_LG_COLOR_COLOR0, BORDER_SDF_LG_COLOR, ESCAPE(Vector4f)),
+    GE_PARAMS_MEMBER_ENTRY(BORDER_SDF_LG_COLOR_COLOR1, BORDER_SDF_LG_COLOR, ESCAPE(Vector4f)),
+    GE_PARAMS_MEMBER_ENTRY(BORDER_SDF_LG_COLOR_COLOR2, BORDER_SDF_LG_COLOR, ESCAPE(Vector4f)),
+    GE_PARAMS_MEMBER_ENTRY(BORDER_SDF_LG_COLOR_COLOR3, BORDER_SDF_LG_COLOR, ESCAPE(Vector4f)),
+    GE_PARAMS_MEMBER_ENTRY(BORDER_SDF_LG_COLOR_COLOR4, BORDER_SDF_LG_COLOR, ESCAPE(Vector4f)),
+    GE_PARAMS_MEMBER_ENTRY(BORDER_SDF_LG_COLOR_POSITION0, BORDER_SDF_LG_COLOR, ESCAPE(float)),
+    GE_PARAMS_MEMBER_ENTRY(BORDER_SDF_LG_COLOR_POSITION1, BORDER_SDF_LG_COLOR, ESCAPE(float)),
+    GE_PARAMS_MEMBER_ENTRY(BORDER_SDF_LG_COLOR_POSITION2, BORDER_SDF_LG_COLOR, ESCAPE(float)),
+    GE_PARAMS_MEMBER_ENTRY(BORDER_SDF_LG_COLOR_POSITION3, BORDER_SDF_LG_COLOR, ESCAPE(float)),
+    GE_PARAMS_MEMBER_ENTRY(BORDER_SDF_LG_COLOR_POSITION4, BORDER_SDF_LG_COLOR, ESCAPE(float)),
+    GE_PARAMS_MEMBER_ENTRY(BORDER_SDF_LG_COLOR_SHAPE, BORDER_SDF_LG_COLOR,
+        ESCAPE(std::shared_ptr<Drawing::GEShaderShape>)),
+    GE_PARAMS_MEMBER_ENTRY(BORDER_SDF_SHADER_COLOR, BORDER_SDF_SHADER, ESCAPE(Vector4f)),
+    GE_PARAMS_MEMBER_ENTRY(BORDER_SDF_SHADER_WIDTH, BORDER_SDF_SHADER, ESCAPE(float)),
+    GE_PARAMS_MEMBER_ENTRY(BORDER_SDF_SHADER_IS_OUTLINE, BORDER_SDF_SHADER, ESCAPE(bool)),
+    GE_PARAMS_MEMBER_ENTRY(BORDER_SDF_SHADER_STYLE, BORDER_SDF_SHADER, ESCAPE(int32_t)),
+    GE_PARAMS_MEMBER_ENTRY(BORDER_SDF_SHADER_DASH_WIDTH, BORDER_SDF_SHADER, ESCAPE(float)),
+    GE_PARAMS_MEMBER_ENTRY(BORDER_SDF_SHADER_DASH_GAP, BORDER_SDF_SHADER, ESCAPE(float)),
+    GE_PARAMS_MEMBER_ENTRY(BORDER_SDF_SHADER_SHAPE, BORDER_SDF_SHADER, ESCAPE(std::shared_ptr<Drawing::GEShaderShape>)),
+    GE_PARAMS_MEMBER_ENTRY(CIRCLE_FLOWLIGHT_COLORS0, CIRCLE_FLOWLIGHT, ESCAPE(Vector4f)),
+    GE_PARAMS_MEMBER_ENTRY(CIRCLE_FLOWLIGHT_COLORS1, CIRCLE_FLOWLIGHT, ESCAPE(Vector4f)),
+    GE_PARAMS_MEMBER_ENTRY(CIRCLE_FLOWLIGHT_COLORS2, CIRCLE_FLOWLIGHT, ESCAPE(Vector4f)),
+    GE_PARAMS_MEMBER_ENTRY(CIRCLE_FLOWLIGHT_COLORS3, CIRCLE_FLOWLIGHT, ESCAPE(Vector4f)),
+    GE_PARAMS_MEMBER_ENTRY(CIRCLE_FLOWLIGHT_ROTATION_FREQUENCY, CIRCLE_FLOWLIGHT, ESCAPE(Vector4f)),
+    GE_PARAMS_MEMBER_ENTRY(CIRCLE_FLOWLIGHT_ROTATION_AMPLITUDE, CIRCLE_FLOWLIGHT, ESCAPE(Vector4f)),
+    GE_PARAMS_MEMBER_ENTRY(CIRCLE_FLOWLIGHT_ROTATION_SEED, CIRCLE_FLOWLIGHT, ESCAPE(Vector4f)),
+    GE_PARAMS_MEMBER_ENTRY(CIRCLE_FLOWLIGHT_GRADIENT_X, CIRCLE_FLOWLIGHT, ESCAPE(Vector4f)),
+    GE_PARAMS_MEMBER_ENTRY(CIRCLE_FLOWLIGHT_GRADIENT_Y, CIRCLE_FLOWLIGHT, ESCAPE(Vector4f)),
+    GE_PARAMS_MEMBER_ENTRY(CIRCLE_FLOWLIGHT_PROGRESS, CIRCLE_FLOWLIGHT, ESCAPE(float)),
+    GE_PARAMS_MEMBER_ENTRY(CIRCLE_FLOWLIGHT_STRENGTH, CIRCLE_FLOWLIGHT, ESCAPE(Vector4f)),
+    GE_PARAMS_MEMBER_ENTRY(CIRCLE_FLOWLIGHT_DISTORT_STRENGTH, CIRCLE_FLOWLIGHT, ESCAPE(float)),
+    GE_PARAMS_MEMBER_ENTRY(CIRCLE_FLOWLIGHT_BLEND_GRADIENT, CIRCLE_FLOWLIGHT, ESCAPE(float)),
+    GE_PARAMS_MEMBER_ENTRY(CIRCLE_FLOWLIGHT_MASK, CIRCLE_FLOWLIGHT, ESCAPE(std::shared_ptr<GEShaderMask>)),
+    GE_PARAMS_MEMBER_ENTRY(COLOR_GRADIENT_COLORS, COLOR_GRADIENT, ESCAPE(std::vector<float>)),
+    GE_PARAMS_MEMBER_ENTRY(COLOR_GRADIENT_POSITIONS, COLOR_GRADIENT, ESCAPE(std::vector<float>)),
+    GE_PARAMS_MEMBER_ENTRY(COLOR_GRADIENT_STRENGTHS, COLOR_GRADIENT, ESCAPE(std::vector<float>)),
+    GE_PARAMS_MEMBER_ENTRY(COLOR_GRADIENT_MASK, COLOR_GRADIENT, ESCAPE(std::shared_ptr<GEShaderMask>)),
+    GE_PARAMS_MEMBER_ENTRY(CONTENT_LIGHT_POSITION, CONTENT_LIGHT, ESCAPE(Vector3f)),
+    GE_PARAMS_MEMBER_ENTRY(CONTENT_LIGHT_COLOR, CONTENT_LIGHT, ESCAPE(Vector4f)),
+    GE_PARAMS_MEMBER_ENTRY(CONTENT_LIGHT_INTENSITY, CONTENT_LIGHT, ESCAPE(float)),
+    GE_PARAMS_MEMBER_ENTRY(CONTENT_LIGHT_ROTATION_ANGLE, CONTENT_LIGHT, ESCAPE(Vector3f)),
+    GE_PARAMS_MEMBER_ENTRY(CONTOUR_DIAGONAL_FLOW_LIGHT_CONTOUR, CONTOUR_DIAGONAL_FLOW_LIGHT,
+        ESCAPE(std::vector<Vector2f>)),
+    GE_PARAMS_MEMBER_ENTRY(CONTOUR_DIAGONAL_FLOW_LIGHT_LINE1_START, CONTOUR_DIAGONAL_FLOW_LIGHT, ESCAPE(float)),
+    GE_PARAMS_MEMBER_ENTRY(CONTOUR_DIAGONAL_FLOW_LIGHT_LINE1_LENGTH, CONTOUR_DIAGONAL_FLOW_LIGHT, ESCAPE(float)),
+    GE_PARAMS_MEMBER_ENTRY(CONTOUR_DIAGONAL_FLOW_LIGHT_LINE1_COLOR, CONTOUR_DIAGONAL_FLOW_LIGHT, ESCAPE(Vector4f)),
+    GE_PARAMS_MEMBER_ENTRY(CONTOUR_DIAGONAL_FLOW_LIGHT_LINE2_START, CONTOUR_DIAGONAL_FLOW_LIGHT, ESCAPE(float)),
+    GE_PARAMS_MEMBER_ENTRY(CONTOUR_DIAGONAL_FLOW_LIGHT_LINE2_LENGTH, CONTOUR_DIAGONAL_FLOW_LIGHT, ESCAPE(float)),
+    GE_PARAMS_MEMBER_ENTRY(CONTOUR_DIAGONAL_FLOW_LIGHT_LINE2_COLOR, CONTOUR_DIAGONAL_FLOW_LIGHT, ESCAPE(Vector4f)),
+    GE_PARAMS_MEMBER_ENTRY(CONTOUR_DIAGONAL_FLOW_LIGHT_THICKNESS, CONTOUR_DIAGONAL_FLOW_LIGHT, ESCAPE(float)),
+    GE_PARAMS_MEMBER_ENTRY(CONTOUR_DIAGONAL_FLOW_LIGHT_HALO_RADIUS, CONTOUR_DIAGONAL_FLOW_LIGHT, ESCAPE(float)),
+    GE_PARAMS_MEMBER_ENTRY(CONTOUR_DIAGONAL_FLOW_LIGHT_LIGHT_WEIGHT, CONTOUR_DIAGONAL_FLOW_LIGHT, ESCAPE(float)),
+    GE_PARAMS_MEMBER_ENTRY(CONTOUR_DIAGONAL_FLOW_LIGHT_HALO_WEIGHT, CONTOUR_DIAGONAL_FLOW_LIGHT, ESCAPE(float)),
+    GE_PARAMS_MEMBER_ENTRY(DEPTH_OCCLUSION_DEPTH_PLANE, DEPTH_OCCLUSION, ESCAPE(Vector4f)),
+    GE_PARAMS_MEMBER_ENTRY(DEPTH_OCCLUSION_MATRIX, DEPTH_OCCLUSION, ESCAPE(Drawing::Matrix)),
+    GE_PARAMS_MEMBER_ENTRY(DEPTH_OCCLUSION_DEPTH_MAP, DEPTH_OCCLUSION, ESCAPE(std::shared_ptr<Drawing::Image>)),
+    GE_PARAMS_MEMBER_ENTRY(DEPTH_OCCLUSION_WEIGHT, DEPTH_OCCLUSION, ESCAPE(float)),
+    GE_PARAMS_MEMBER_ENTRY(DEPTH_OCCLUSION_NEAR, DEPTH_OCCLUSION, ESCAPE(float)),
+    GE_PARAMS_MEMBER_ENTRY(DEPTH_OCCLUSION_FAR, DEPTH_OCCLUSION, ESCAPE(float)),
+    GE_PARAMS_MEMBER_ENTRY(DEPTH_OCCLUSION_IS_REVERSE, DEPTH_OCCLUSION, ESCAPE(bool)),
+    GE_PARAMS_MEMBER_ENTRY(DIRECTION_LIGHT_MASK, DIRECTION_LIGHT, ESCAPE(std::shared_ptr<GEShaderMask>)),
+    GE_PARAMS_MEMBER_ENTRY(DIRECTION_LIGHT_MASK_FACTOR, DIRECTION_LIGHT, ESCAPE(float)),
+    GE_PARAMS_MEMBER_ENTRY(DIRECTION_LIGHT_LIGHT_DIRECTION, DIRECTION_LIGHT, ESCAPE(Vector3f)),
+    GE_PARAMS_MEMBER_ENTRY(DIRECTION_LIGHT_LIGHT_COLOR, DIRECTION_LIGHT, ESCAPE(Vector4f)),
+    GE_PARAMS_MEMBER_ENTRY(DIRECTION_LIGHT_LIGHT_INTENSITY, DIRECTION_LIGHT, ESCAPE(float)),
+    GE_PARAMS_MEMBER_ENTRY(DISPERSION_MASK, DISPERSION, ESCAPE(std::shared_ptr<GEShaderMask>)),
+    GE_PARAMS_MEMBER_ENTRY(DISPERSION_OPACITY, DISPERSION, ESCAPE(float)),
+    GE_PARAMS_MEMBER_ENTRY(DISPERSION_RED_OFFSET, DISPERSION, ESCAPE(std::pair<float, float>)),
+    GE_PARAMS_MEMBER_ENTRY(DISPERSION_GREEN_OFFSET, DISPERSION, ESCAPE(std::pair<float, float>)),
+    GE_PARAMS_MEMBER_ENTRY(DISPERSION_BLUE_OFFSET, DISPERSION, ESCAPE(std::pair<float, float>)),
+    GE_PARAMS_MEMBER_ENTRY(DISPLACEMENT_DISTORT_FILTER_FACTOR, DISPLACEMENT_DISTORT_FILTER,
+        ESCAPE(std::pair<float, float>)),
+    GE_PARAMS_MEMBER_ENTRY(DISPLACEMENT_DISTORT_FILTER_MASK, DISPLACEMENT_DISTORT_FILTER,
+        ESCAPE(std::shared_ptr<GEShaderMask>)),
+    GE_PARAMS_MEMBER_CAST_ENTRY(DISTORTION_COLLAPSE_L_U_CORNER, DISTORTION_COLLAPSE, ESCAPE(std::pair<float, float>),
+        ESCAPE(Drawing::Point)),
+    GE_PARAMS_MEMBER_CAST_ENTRY(DISTORTION_COLLAPSE_R_U_CORNER, DISTORTION_COLLAPSE, ESCAPE(std::pair<float, float>),
+        ESCAPE(Drawing::Point)),
+    GE_PARAMS_MEMBER_CAST_ENTRY(DISTORTION_COLLAPSE_R_B_CORNER, DISTORTION_COLLAPSE, ESCAPE(std::pair<float, float>),
+        ESCAPE(Drawing::Point)),
+    GE_PARAMS_MEMBER_CAST_ENTRY(DISTORTION_COLLAPSE_L_B_CORNER, DISTORTION_COLLAPSE, ESCAPE(std::pair<float, float>),
+        ESCAPE(Drawing::Point)),
+    GE_PARAMS_MEMBER_ENTRY(DISTORTION_COLLAPSE_BARREL_DISTORTION, DISTORTION_COLLAPSE, ESCAPE(Vector4f)),
+    GE_PARAMS_MEMBER_CAST_ENTRY(DOT_MATRIX_PATH_DIRECTION, DOT_MATRIX, ESCAPE(int32_t), ESCAPE(DotMatrixDirection)),
+    GE_PARAMS_MEMBER_ENTRY(DOT_MATRIX_EFFECT_COLORS, DOT_MATRIX, ESCAPE(std::vector<Vector4f>)),
+    GE_PARAMS_MEMBER_CAST_ENTRY(DOT_MATRIX_COLOR_FRACTIONS, DOT_MATRIX, ESCAPE(std::pair<float, float>),
+        ESCAPE(Vector2f)),
+    GE_PARAMS_MEMBER_ENTRY(DOT_MATRIX_START_POINTS, DOT_MATRIX, ESCAPE(std::vector<Vector2f>)),
+    GE_PARAMS_MEMBER_ENTRY(DOT_MATRIX_PATH_WIDTH, DOT_MATRIX, ESCAPE(float)),
+    GE_PARAMS_MEMBER_ENTRY(DOT_MATRIX_INVERSE_EFFECT, DOT_MATRIX, ESCAPE(bool)),
+    GE_PARAMS_MEMBER_ENTRY(DOT_MATRIX_DOT_COLOR, DOT_MATRIX, ESCAPE(Vector4f)),
+    GE_PARAMS_MEMBER_ENTRY(DOT_MATRIX_DOT_SPACING, DOT_MATRIX, ESCAPE(float)),
+    GE_PARAMS_MEMBER_ENTRY(DOT_MATRIX_DOT_RADIUS, DOT_MATRIX, ESCAPE(float)),
+    GE_PARAMS_MEMBER_ENTRY(DOT_MATRIX_BG_COLOR, DOT_MATRIX, ESCAPE(Vector4f)),
+    GE_PARAMS_MEMBER_CAST_ENTRY(DOT_MATRIX_EFFECT_TYPE, DOT_MATRIX, ESCAPE(int32_t), ESCAPE(DotMatrixEffectType)),
+    GE_PARAMS_MEMBER_ENTRY(DOT_MATRIX_PROGRESS, DOT_MATRIX, ESCAPE(float)),
+    GE_PARAMS_MEMBER_ENTRY(DOUBLE_RIPPLE_MASK_CENTER1, DOUBLE_RIPPLE_MASK, ESCAPE(std::pair<float, float>)),
+    GE_PARAMS_MEMBER_ENTRY(DOUBLE_RIPPLE_MASK_CENTER2, DOUBLE_RIPPLE_MASK, ESCAPE(std::pair<float, float>)),
+    GE_PARAMS_MEMBER_ENTRY(DOUBLE_RIPPLE_MASK_RADIUS, DOUBLE_RIPPLE_MASK, ESCAPE(float)),
+    GE_PARAMS_MEMBER_ENTRY(DOUBLE_RIPPLE_MASK_WIDTH, DOUBLE_RIPPLE_MASK, ESCAPE(float)),
+    GE_PARAMS_MEMBER_ENTRY(DOUBLE_RIPPLE_MASK_TURBULENCE, DOUBLE_RIPPLE_MASK, ESCAPE(float)),
+    GE_PARAMS_MEMBER_ENTRY(DOUBLE_RIPPLE_MASK_HALO_THICKNESS, DOUBLE_RIPPLE_MASK, ESCAPE(float)),
+    GE_PARAMS_MEMBER_ENTRY(EDGE_LIGHT_ALPHA, EDGE_LIGHT, ESCAPE(float)),
+    GE_PARAMS_MEMBER_ENTRY(EDGE_LIGHT_BLOOM, EDGE_LIGHT, ESCAPE(bool)),
+    GE_PARAMS_MEMBER_ENTRY(EDGE_LIGHT_COLOR, EDGE_LIGHT, ESCAPE(Vector4f)),
+    GE_PARAMS_MEMBER_ENTRY(EDGE_LIGHT_MASK, EDGE_LIGHT, ESCAPE(std::shared_ptr<GEShaderMask>)),
+    GE_PARAMS_MEMBER_ENTRY(EDGE_LIGHT_USE_RAW_COLOR, EDGE_LIGHT, ESCAPE(bool)),
+    GE_PARAMS_MEMBER_ENTRY(FRAME_GRADIENT_MASK_INNER_BEZIER, FRAME_GRADIENT_MASK, ESCAPE(Vector4f)),
+    GE_PARAMS_MEMBER_ENTRY(FRAME_GRADIENT_MASK_OUTER_BEZIER, FRAME_GRADIENT_MASK, ESCAPE(Vector4f)),
+    GE_PARAMS_MEMBER_ENTRY(FRAME_GRADIENT_MASK_CORNER_RADIUS, FRAME_GRADIENT_MASK, ESCAPE(float)),
+    GE_PARAMS_MEMBER_ENTRY(FRAME_GRADIENT_MASK_INNER_FRAME_WIDTH, FRAME_GRADIENT_MASK, ESCAPE(float)),
+    GE_PARAMS_MEMBER_ENTRY(FRAME_GRADIENT_MASK_OUTER_FRAME_WIDTH, FRAME_GRADIENT_MASK, ESCAPE(float)),
+    GE_PARAMS_MEMBER_ENTRY(FRAME_GRADIENT_MASK_RECT_W_H, FRAME_GRADIENT_MASK, ESCAPE(std::pair<float, float>)),
+    GE_PARAMS_MEMBER_ENTRY(FRAME_GRADIENT_MASK_RECT_POS, FRAME_GRADIENT_MASK, ESCAPE(std::pair<float, float>)),
+    GE_PARAMS_MEMBER_ENTRY(FRAME_GRADIENT_MASK_AXIAL_FEATHER_STRENGTH, FRAME_GRADIENT_MASK, ESCAPE(float)),
+    GE_PARAMS_MEMBER_ENTRY(FRAME_GRADIENT_MASK_AXIAL_CENTER, FRAME_GRADIENT_MASK, ESCAPE(float)),
+    GE_PARAMS_MEMBER_ENTRY(FRAME_GRADIENT_MASK_AXIAL_CORE_WIDTH, FRAME_GRADIENT_MASK, ESCAPE(float)),
+    GE_PARAMS_MEMBER_ENTRY(FRAME_GRADIENT_MASK_AXIAL_DIRECTION, FRAME_GRADIENT_MASK, ESCAPE(std::pair<float, float>)),
+    GE_PARAMS_MEMBER_ENTRY(FRAME_GRADIENT_MASK_BOX_ANGLE_DEG, FRAME_GRADIENT_MASK, ESCAPE(float)),
+    GE_PARAMS_MEMBER_ENTRY(FROSTED_GLASS_BLUR_RADIUS, FROSTED_GLASS_BLUR, ESCAPE(float)),
+    GE_PARAMS_MEMBER_ENTRY(FROSTED_GLASS_BLUR_RADIUS_SCALE, FROSTED_GLASS_BLUR, ESCAPE(float)),
+    GE_PARAMS_MEMBER_ENTRY(FROSTED_GLASS_BLUR_REFRACT_OUT_PX, FROSTED_GLASS_BLUR, ESCAPE(float)),
+    GE_PARAMS_MEMBER_CAST_ENTRY(FROSTED_GLASS_EFFECT_WEIGHTS_EMBOSS, FROSTED_GLASS_EFFECT,
+        ESCAPE(std::pair<float, float>), ESCAPE(Vector2f)),
+    GE_PARAMS_MEMBER_CAST_ENTRY(FROSTED_GLASS_EFFECT_WEIGHTS_EDL, FROSTED_GLASS_EFFECT,
+        ESCAPE(std::pair<float, float>), ESCAPE(Vector2f)),
+    GE_PARAMS_MEMBER_CAST_ENTRY(FROSTED_GLASS_EFFECT_ANTI_ALIAS, FROSTED_GLASS_EFFECT, ESCAPE(std::pair<float, float>),
+        ESCAPE(Vector2f)),
+    GE_PARAMS_MEMBER_ENTRY(FROSTED_GLASS_EFFECT_MAX_COLOR, FROSTED_GLASS_EFFECT, ESCAPE(float)),
+    GE_PARAMS_MEMBER_CAST_ENTRY(FROSTED_GLASS_EFFECT_BG_RATES, FROSTED_GLASS_EFFECT, ESCAPE(std::pair<float, float>),
+        ESCAPE(Vector2f)),
+    GE_PARAMS_MEMBER_ENTRY(FROSTED_GLASS_EFFECT_BG_K_B_S, FROSTED_GLASS_EFFECT, ESCAPE(Vector3f)),
+    GE_PARAMS_MEMBER_ENTRY(FROSTED_GLASS_EFFECT_BG_POS, FROSTED_GLASS_EFFECT, ESCAPE(Vector3f)),
+    GE_PARAMS_MEMBER_ENTRY(FROSTED_GLASS_EFFECT_BG_NEG, FROSTED_GLASS_EFFECT, ESCAPE(Vector3f)),
+    GE_PARAMS_MEMBER_ENTRY(FROSTED_GLASS_EFFECT_BG_ALPHA, FROSTED_GLASS_EFFECT, ESCAPE(float)),
+    GE_PARAMS_MEMBER_ENTRY(FROSTED_GLASS_EFFECT_REFRACT_PARAMS, FROSTED_GLASS_EFFECT, ESCAPE(Vector3f)),
+    GE_PARAMS_MEMBER_ENTRY(FROSTED_GLASS_EFFECT_SD_PARAMS, FROSTED_GLASS_EFFECT, ESCAPE(Vector3f)),
+    GE_PARAMS_MEMBER_CAST_ENTRY(FROSTED_GLASS_EFFECT_SD_RATES, FROSTED_GLASS_EFFECT, ESCAPE(std::pair<float, float>),
+        ESCAPE(Vector2f)),
+    GE_PARAMS_MEMBER_ENTRY(FROSTED_GLASS_EFFECT_SD_K_B_S, FROSTED_GLASS_EFFECT, ESCAPE(Vector3f)),
+    GE_PARAMS_MEMBER_ENTRY(FROSTED_GLASS_EFFECT_SD_POS, FROSTED_GLASS_EFFECT, ESCAPE(Vector3f)),
+    GE_PARAMS_MEMBER_ENTRY(FROSTED_GLASS_EFFECT_SD_NEG, FROSTED_GLASS_EFFECT, ESCAPE(Vector3f)),
+    GE_PARAMS_MEMBER_CAST_ENTRY(FROSTED_GLASS_EFFECT_ENV_LIGHT_PARAMS, FROSTED_GLASS_EFFECT,
+        ESCAPE(std::pair<float, float>), ESCAPE(Vector2f)),
+    GE_PARAMS_MEMBER_CAST_ENTRY(FROSTED_GLASS_EFFECT_ENV_LIGHT_RATES, FROSTED_GLASS_EFFECT,
+        ESCAPE(std::pair<float, float>), ESCAPE(Vector2f)),
+    GE_PARAMS_MEMBER_ENTRY(FROSTED_GLASS_EFFECT_ENV_LIGHT_K_B_S, FROSTED_GLASS_EFFECT, ESCAPE(Vector3f)),
+    GE_PARAMS_MEMBER_ENTRY(FROSTED_GLASS_EFFECT_ENV_LIGHT_POS, FROSTED_GLASS_EFFECT, ESCAPE(Vector3f)),
+    GE_PARAMS_MEMBER_ENTRY(FROSTED_GLASS_EFFECT_ENV_LIGHT_NEG, FROSTED_GLASS_EFFECT, ESCAPE(Vector3f)),
+    GE_PARAMS_MEMBER_CAST_ENTRY(FROSTED_GLASS_EFFECT_ED_LIGHT_PARAMS, FROSTED_GLASS_EFFECT,
+        ESCAPE(std::pair<float, float>), ESCAPE(Vector2f)),
+    GE_PARAMS_MEMBER_CAST_ENTRY(FROSTED_GLASS_EFFECT_ED_LIGHT_ANGLES, FROSTED_GLASS_EFFECT,
+        ESCAPE(std::pair<float, float>), ESCAPE(Vector2f)),
+    GE_PARAMS_MEMBER_CAST_ENTRY(FROSTED_GLASS_EFFECT_ED_LIGHT_DIR, FROSTED_GLASS_EFFECT,
+        ESCAPE(std::pair<float, float>), ESCAPE(Vector2f)),
+    GE_PARAMS_MEMBER_CAST_ENTRY(FROSTED_GLASS_EFFECT_ED_LIGHT_RATES, FROSTED_GLASS_EFFECT,
+        ESCAPE(std::pair<float, float>), ESCAPE(Vector2f)),
+    GE_PARAMS_MEMBER_ENTRY(FROSTED_GLASS_EFFECT_ED_LIGHT_K_B_S, FROSTED_GLASS_EFFECT, ESCAPE(Vector3f)),
+    GE_PARAMS_MEMBER_ENTRY(FROSTED_GLASS_EFFECT_ED_LIGHT_POS, FROSTED_GLASS_EFFECT, ESCAPE(Vector3f)),
+    GE_PARAMS_MEMBER_ENTRY(FROSTED_GLASS_EFFECT_ED_LIGHT_NEG, FROSTED_GLASS_EFFECT, ESCAPE(Vector3f)),
+    GE_PARAMS_MEMBER_ENTRY(FROSTED_GLASS_EFFECT_SDF_SHAPE, FROSTED_GLASS_EFFECT,
+        ESCAPE(std::shared_ptr<Drawing::GEShaderShape>)),
+    GE_PARAMS_MEMBER_ENTRY(FROSTED_GLASS_EFFECT_WAVE_DISTURBANCE, FROSTED_GLASS_EFFECT,
+        ESCAPE(std::shared_ptr<GEShaderMask>)),
+    GE_PARAMS_MEMBER_CAST_ENTRY(FROSTED_GLASS_EFFECT_BLUR_IMAGE, FROSTED_GLASS_EFFECT,
+        ESCAPE(std::shared_ptr<Drawing::Image>), ESCAPE(std::weak_ptr<Drawing::Image>)),
+    GE_PARAMS_MEMBER_CAST_ENTRY(FROSTED_GLASS_EFFECT_BLUR_IMAGE_FOR_EDGE, FROSTED_GLASS_EFFECT,
+        ESCAPE(std::shared_ptr<Drawing::Image>), ESCAPE(std::weak_ptr<Drawing::Image>)),
+    GE_PARAMS_MEMBER_ENTRY(FROSTED_GLASS_EFFECT_SNAPSHOT_RECT, FROSTED_GLASS_EFFECT, ESCAPE(RectF)),
+    GE_PARAMS_MEMBER_ENTRY(FROSTED_GLASS_EFFECT_SNAPSHOT_MATRIX, FROSTED_GLASS_EFFECT, ESCAPE(Drawing::Matrix)),
+    GE_PARAMS_MEMBER_ENTRY(FROSTED_GLASS_EFFECT_REFRACT_OUT_PX, FROSTED_GLASS_EFFECT, ESCAPE(float)),
+    GE_PARAMS_MEMBER_ENTRY(FROSTED_GLASS_EFFECT_MATERIAL_COLOR, FROSTED_GLASS_EFFECT, ESCAPE(Vector4f)),
+    GE_PARAMS_MEMBER_CAST_ENTRY(FROSTED_GLASS_EFFECT_DARK_MODE_WEIGHTS_EMBOSS, FROSTED_GLASS_EFFECT,
+        ESCAPE(std::pair<float, float>), ESCAPE(Vector2f)),
+    GE_PARAMS_MEMBER_CAST_ENTRY(FROSTED_GLASS_EFFECT_DARK_MODE_BG_RATES, FROSTED_GLASS_EFFECT,
+        ESCAPE(std::pair<float, float>), ESCAPE(Vector2f)),
+    GE_PARAMS_MEMBER_ENTRY(FROSTED_GLASS_EFFECT_DARK_MODE_BG_K_B_S, FROSTED_GLASS_EFFECT, ESCAPE(Vector3f)),
+    GE_PARAMS_MEMBER_ENTRY(FROSTED_GLASS_EFFECT_DARK_MODE_BG_POS, FROSTED_GLASS_EFFECT, ESCAPE(Vector3f)),
+    GE_PARAMS_MEMBER_ENTRY(FROSTED_GLASS_EFFECT_DARK_MODE_BG_NEG, FROSTED_GLASS_EFFECT, ESCAPE(Vector3f)),
+    GE_PARAMS_MEMBER_ENTRY(FROSTED_GLASS_EFFECT_DARK_MODE_ED_LIGHT_K_B_S, FROSTED_GLASS_EFFECT, ESCAPE(Vector3f)),
+    GE_PARAMS_MEMBER_CAST_ENTRY(FROSTED_GLASS_EFFECT_DARK_MODE_ED_LIGHT_ANGLES, FROSTED_GLASS_EFFECT,
+        ESCAPE(std::pair<float, float>), ESCAPE(Vector2f)),
+    GE_PARAMS_MEMBER_ENTRY(FROSTED_GLASS_EFFECT_DARK_SCALE, FROSTED_GLASS_EFFECT, ESCAPE(float)),
+    GE_PARAMS_MEMBER_ENTRY(FROSTED_GLASS_EFFECT_ENABLE_S_D_F_CACHE, FROSTED_GLASS_EFFECT, ESCAPE(bool)),
+    GE_PARAMS_MEMBER_CAST_ENTRY(FROSTED_GLASS_BLUR_PARAMS, FROSTED_GLASS, ESCAPE(std::pair<float, float>),
+        ESCAPE(Vector2f)),
+    GE_PARAMS_MEMBER_CAST_ENTRY(FROSTED_GLASS_WEIGHTS_EMBOSS, FROSTED_GLASS, ESCAPE(std::pair<float, float>),
+        ESCAPE(Vector2f)),
+    GE_PARAMS_MEMBER_CAST_ENTRY(FROSTED_GLASS_WEIGHTS_EDL, FROSTED_GLASS, ESCAPE(std::pair<float, float>),
+        ESCAPE(Vector2f)),
+    GE_PARAMS_MEMBER_ENTRY(FROSTED_GLASS_SDF_SHAPE, FROSTED_GLASS, ESCAPE(std::shared_ptr<Drawing::GEShaderShape>)),
+    GE_PARAMS_MEMBER_ENTRY(FROSTED_GLASS_WAVE_DISTURBANCE, FROSTED_GLASS, ESCAPE(std::shared_ptr<GEShaderMask>)),
+    GE_PARAMS_MEMBER_ENTRY(FROSTED_GLASS_MAX_COLOR, FROSTED_GLASS, ESCAPE(float)),
+    GE_PARAMS_MEMBER_CAST_ENTRY(FROSTED_GLASS_BG_RATES, FROSTED_GLASS, ESCAPE(std::pair<float, float>),
+        ESCAPE(Vector2f)),
+    GE_PARAMS_MEMBER_ENTRY(FROSTED_GLASS_BG_K_B_S, FROSTED_GLASS, ESCAPE(Vector3f)),
+    GE_PARAMS_MEMBER_ENTRY(FROSTED_GLASS_BG_POS, FROSTED_GLASS, ESCAPE(Vector3f)),
+    GE_PARAMS_MEMBER_ENTRY(FROSTED_GLASS_BG_NEG, FROSTED_GLASS, ESCAPE(Vector3f)),
+    GE_PARAMS_MEMBER_ENTRY(FROSTED_GLASS_BG_ALPHA, FROSTED_GLASS, ESCAPE(float)),
+    GE_PARAMS_MEMBER_ENTRY(FROSTED_GLASS_REFRACT_PARAMS, FROSTED_GLASS, ESCAPE(Vector3f)),
+    GE_PARAMS_MEMBER_ENTRY(FROSTED_GLASS_SD_PARAMS, FROSTED_GLASS, ESCAPE(Vector3f)),
+    GE_PARAMS_MEMBER_CAST_ENTRY(FROSTED_GLASS_SD_RATES, FROSTED_GLASS, ESCAPE(std::pair<float, float>),
+        ESCAPE(Vector2f)),
+    GE_PARAMS_MEMBER_ENTRY(FROSTED_GLASS_SD_K_B_S, FROSTED_GLASS, ESCAPE(Vector3f)),
+    GE_PARAMS_MEMBER_ENTRY(FROSTED_GLASS_SD_POS, FROSTED_GLASS, ESCAPE(Vector3f)),
+    GE_PARAMS_MEMBER_ENTRY(FROSTED_GLASS_SD_NEG, FROSTED_GLASS, ESCAPE(Vector3f)),
+    GE_PARAMS_MEMBER_ENTRY(FROSTED_GLASS_ENV_LIGHT_PARAMS, FROSTED_GLASS, ESCAPE(Vector3f)),
+    GE_PARAMS_MEMBER_CAST_ENTRY(FROSTED_GLASS_ENV_LIGHT_RATES, FROSTED_GLASS, ESCAPE(std::pair<float, float>),
+        ESCAPE(Vector2f)),
+    GE_PARAMS_MEMBER_ENTRY(FROSTED_GLASS_ENV_LIGHT_K_B_S, FROSTED_GLASS, ESCAPE(Vector3f)),
+    GE_PARAMS_MEMBER_ENTRY(FROSTED_GLASS_ENV_LIGHT_POS, FROSTED_GLASS, ESCAPE(Vector3f)),
+    GE_PARAMS_MEMBER_ENTRY(FROSTED_GLASS_ENV_LIGHT_NEG, FROSTED_GLASS, ESCAPE(Vector3f)),
+    GE_PARAMS_MEMBER_CAST_ENTRY(FROSTED_GLASS_ED_LIGHT_PARAMS, FROSTED_GLASS, ESCAPE(std::pair<float, float>),
+        ESCAPE(Vector2f)),
+    GE_PARAMS_MEMBER_CAST_ENTRY(FROSTED_GLASS_ED_LIGHT_ANGLES, FROSTED_GLASS, ESCAPE(std::pair<float, float>),
+        ESCAPE(Vector2f)),
+    GE_PARAMS_MEMBER_CAST_ENTRY(FROSTED_GLASS_ED_LIGHT_DIR, FROSTED_GLASS, ESCAPE(std::pair<float, float>),
+        ESCAPE(Vector2f)),
+    GE_PARAMS_MEMBER_CAST_ENTRY(FROSTED_GLASS_ED_LIGHT_RATES, FROSTED_GLASS, ESCAPE(std::pair<float, float>),
+        ESCAPE(Vector2f)),
+    GE_PARAMS_MEMBER_ENTRY(FROSTED_GLASS_ED_LIGHT_K_B_S, FROSTED_GLASS, ESCAPE(Vector3f)),
+    GE_PARAMS_MEMBER_ENTRY(FROSTED_GLASS_ED_LIGHT_POS, FROSTED_GLASS, ESCAPE(Vector3f)),
+    GE_PARAMS_MEMBER_ENTRY(FROSTED_GLASS_ED_LIGHT_NEG, FROSTED_GLASS, ESCAPE(Vector3f)),
+    GE_PARAMS_MEMBER_CAST_ENTRY(FROSTED_GLASS_DARK_MODE_BLUR_PARAM, FROSTED_GLASS, ESCAPE(std::pair<float, float>),
+        ESCAPE(Vector2f)),
+    GE_PARAMS_MEMBER_CAST_ENTRY(FROSTED_GLASS_DARK_MODE_WEIGHTS_EMBOSS, FROSTED_GLASS, ESCAPE(std::pair<float, float>),
+        ESCAPE(Vector2f)),
+    GE_PARAMS_MEMBER_CAST_ENTRY(FROSTED_GLASS_DARK_MODE_BG_RATES, FROSTED_GLASS, ESCAPE(std::pair<float, float>),
+        ESCAPE(Vector2f)),
+    GE_PARAMS_MEMBER_ENTRY(FROSTED_GLASS_DARK_MODE_BG_K_B_S, FROSTED_GLASS, ESCAPE(Vector3f)),
+    GE_PARAMS_MEMBER_ENTRY(FROSTED_GLASS_DARK_MODE_BG_POS, FROSTED_GLASS, ESCAPE(Vector3f)),
+    GE_PARAMS_MEMBER_ENTRY(FROSTED_GLASS_DARK_MODE_BG_NEG, FROSTED_GLASS, ESCAPE(Vector3f)),
+    GE_PARAMS_MEMBER_ENTRY(FROSTED_GLASS_DARK_MODE_ED_LIGHT_K_B_S, FROSTED_GLASS, ESCAPE(Vector3f)),
+    GE_PARAMS_MEMBER_CAST_ENTRY(FROSTED_GLASS_DARK_MODE_ED_LIGHT_ANGLES, FROSTED_GLASS,
+        ESCAPE(std::pair<float, float>), ESCAPE(Vector2f)),
+    GE_PARAMS_MEMBER_ENTRY(FROSTED_GLASS_DARK_SCALE, FROSTED_GLASS, ESCAPE(float)),
+    GE_PARAMS_MEMBER_ENTRY(FROSTED_GLASS_BASE_VIBRANCY_ENABLED, FROSTED_GLASS, ESCAPE(bool)),
+    GE_PARAMS_MEMBER_ENTRY(FROSTED_GLASS_BASE_MATERIAL_TYPE, FROSTED_GLASS, ESCAPE(float)),
+    GE_PARAMS_MEMBER_ENTRY(FROSTED_GLASS_MATERIAL_COLOR, FROSTED_GLASS, ESCAPE(Vector4f)),
+    GE_PARAMS_MEMBER_ENTRY(GASIFY_BLUR_SOURCE_IMAGE, GASIFY_BLUR, ESCAPE(std::shared_ptr<Drawing::Image>)),
+    GE_PARAMS_MEMBER_ENTRY(GASIFY_BLUR_MASK_IMAGE, GASIFY_BLUR, ESCAPE(std::shared_ptr<Drawing::Image>)),
+    GE_PARAMS_MEMBER_ENTRY(GASIFY_BLUR_PROGRESS, GASIFY_BLUR, ESCAPE(float)),
+    GE_PARAMS_MEMBER_ENTRY(GASIFY_SOURCE_IMAGE, GASIFY, ESCAPE(std::shared_ptr<Drawing::Image>)),
+    GE_PARAMS_MEMBER_ENTRY(GASIFY_MASK_IMAGE, GASIFY, ESCAPE(std::shared_ptr<Drawing::Image>)),
+    GE_PARAMS_MEMBER_ENTRY(GASIFY_PROGRESS, GASIFY, ESCAPE(float)),
+    GE_PARAMS_MEMBER_ENTRY(GASIFY_SCALE_TWIST_SCALE, GASIFY_SCALE_TWIST, ESCAPE(std::pair<float, float>)),
+    GE_PARAMS_MEMBER_ENTRY(GASIFY_SCALE_TWIST_SOURCE_IMAGE, GASIFY_SCALE_TWIST,
+        ESCAPE(std::shared_ptr<Drawing::Image>)),
+    GE_PARAMS_MEMBER_ENTRY(GASIFY_SCALE_TWIST_MASK_IMAGE, GASIFY_SCALE_TWIST, ESCAPE(std::shared_ptr<Drawing::Image>)),
+    GE_PARAMS_MEMBER_ENTRY(GASIFY_SCALE_TWIST_PROGRESS, GASIFY_SCALE_TWIST, ESCAPE(float)),
+    GE_PARAMS_MEMBER_ENTRY(GREY_GREY_COEF1, GREY, ESCAPE(float)),
+    GE_PARAMS_MEMBER_ENTRY(GREY_GREY_COEF2, GREY, ESCAPE(float)),
+    GE_PARAMS_MEMBER_ENTRY(GRID_WARP_GRID_POINTS0, GRID_WARP, ESCAPE(std::pair<float, float>)),
+    GE_PARAMS_MEMBER_ENTRY(GRID_WARP_GRID_POINTS1, GRID_WARP, ESCAPE(std::pair<float, float>)),
+    GE_PARAMS_MEMBER_ENTRY(GRID_WARP_GRID_POINTS2, GRID_WARP, ESCAPE(std::pair<float, float>)),
+    GE_PARAMS_MEMBER_ENTRY(GRID_WARP_GRID_POINTS3, GRID_WARP, ESCAPE(std::pair<float, float>)),
+    GE_PARAMS_MEMBER_ENTRY(GRID_WARP_GRID_POINTS4, GRID_WARP, ESCAPE(std::pair<float, float>)),
+    GE_PARAMS_MEMBER_ENTRY(GRID_WARP_GRID_POINTS5, GRID_WARP, ESCAPE(std::pair<float, float>)),
+    GE_PARAMS_MEMBER_ENTRY(GRID_WARP_GRID_POINTS6, GRID_WARP, ESCAPE(std::pair<float, float>)),
+    GE_PARAMS_MEMBER_ENTRY(GRID_WARP_GRID_POINTS7, GRID_WARP, ESCAPE(std::pair<float, float>)),
+    GE_PARAMS_MEMBER_ENTRY(GRID_WARP_GRID_POINTS8, GRID_WARP, ESCAPE(std::pair<float, float>)),
+    GE_PARAMS_MEMBER_ENTRY(GRID_WARP_ROTATION_ANGLES0, GRID_WARP, ESCAPE(std::pair<float, float>)),
+    GE_PARAMS_MEMBER_ENTRY(GRID_WARP_ROTATION_ANGLES1, GRID_WARP, ESCAPE(std::pair<float, float>)),
+    GE_PARAMS_MEMBER_ENTRY(GRID_WARP_ROTATION_ANGLES2, GRID_WARP, ESCAPE(std::pair<float, float>)),
+    GE_PARAMS_MEMBER_ENTRY(GRID_WARP_ROTATION_ANGLES3, GRID_WARP, ESCAPE(std::pair<float, float>)),
+    GE_PARAMS_MEMBER_ENTRY(GRID_WARP_ROTATION_ANGLES4, GRID_WARP, ESCAPE(std::pair<float, float>)),
+    GE_PARAMS_MEMBER_ENTRY(GRID_WARP_ROTATION_ANGLES5, GRID_WARP, ESCAPE(std::pair<float, float>)),
+    GE_PARAMS_MEMBER_ENTRY(GRID_WARP_ROTATION_ANGLES6, GRID_WARP, ESCAPE(std::pair<float, float>)),
+    GE_PARAMS_MEMBER_ENTRY(GRID_WARP_ROTATION_ANGLES7, GRID_WARP, ESCAPE(std::pair<float, float>)),
+    GE_PARAMS_MEMBER_ENTRY(GRID_WARP_ROTATION_ANGLES8, GRID_WARP, ESCAPE(std::pair<float, float>)),
+    GE_PARAMS_MEMBER_ENTRY(HARMONIUM_EFFECT_MASK, HARMONIUM_EFFECT, ESCAPE(std::shared_ptr<GEShaderMask>)),
+    GE_PARAMS_MEMBER_ENTRY(HARMONIUM_EFFECT_MASK_CLOCK, HARMONIUM_EFFECT, ESCAPE(std::shared_ptr<GEShaderMask>)),
+    GE_PARAMS_MEMBER_ENTRY(HARMONIUM_EFFECT_MASK_PROGRESS, HARMONIUM_EFFECT, ESCAPE(float)),
+    GE_PARAMS_MEMBER_ENTRY(HARMONIUM_EFFECT_USE_EFFECT_MASK, HARMONIUM_EFFECT, ESCAPE(std::shared_ptr<GEShaderMask>)),
+    GE_PARAMS_MEMBER_ENTRY(HARMONIUM_EFFECT_TINT_COLOR, HARMONIUM_EFFECT, ESCAPE(Vector4f)),
+    GE_PARAMS_MEMBER_ENTRY(HARMONIUM_EFFECT_RIPPLE_POSITION, HARMONIUM_EFFECT, ESCAPE(std::vector<Vector2f>)),
+    GE_PARAMS_MEMBER_ENTRY(HARMONIUM_EFFECT_RIPPLE_PROGRESS, HARMONIUM_EFFECT, ESCAPE(float)),
+    GE_PARAMS_MEMBER_ENTRY(HARMONIUM_EFFECT_DISTORT_PROGRESS, HARMONIUM_EFFECT, ESCAPE(float)),
+    GE_PARAMS_MEMBER_ENTRY(HARMONIUM_EFFECT_DISTORT_FACTOR, HARMONIUM_EFFECT, ESCAPE(float)),
+    GE_PARAMS_MEMBER_ENTRY(HARMONIUM_EFFECT_REFLECTION_FACTOR, HARMONIUM_EFFECT, ESCAPE(float)),
+    GE_PARAMS_MEMBER_ENTRY(HARMONIUM_EFFECT_REFRACTION_FACTOR, HARMONIUM_EFFECT, ESCAPE(float)),
+    GE_PARAMS_MEMBER_ENTRY(HARMONIUM_EFFECT_BLUR_LEFT, HARMONIUM_EFFECT, ESCAPE(float)),
+    GE_PARAMS_MEMBER_ENTRY(HARMONIUM_EFFECT_BLUR_TOP, HARMONIUM_EFFECT, ESCAPE(float)),
+    GE_PARAMS_MEMBER_ENTRY(HARMONIUM_EFFECT_MATERIAL_FACTOR, HARMONIUM_EFFECT, ESCAPE(float)),
+    GE_PARAMS_MEMBER_ENTRY(HARMONIUM_EFFECT_CORNER_RADIUS, HARMONIUM_EFFECT, ESCAPE(float)),
+    GE_PARAMS_MEMBER_ENTRY(HARMONIUM_EFFECT_RATE, HARMONIUM_EFFECT, ESCAPE(float)),
+    GE_PARAMS_MEMBER_ENTRY(HARMONIUM_EFFECT_LIGHT_UP_DEGREE, HARMONIUM_EFFECT, ESCAPE(float)),
+    GE_PARAMS_MEMBER_ENTRY(HARMONIUM_EFFECT_CUBIC_COEFF, HARMONIUM_EFFECT, ESCAPE(float)),
+    GE_PARAMS_MEMBER_ENTRY(HARMONIUM_EFFECT_QUAD_COEFF, HARMONIUM_EFFECT, ESCAPE(float)),
+    GE_PARAMS_MEMBER_ENTRY(HARMONIUM_EFFECT_SATURATION, HARMONIUM_EFFECT, ESCAPE(float)),
+    GE_PARAMS_MEMBER_ENTRY(HARMONIUM_EFFECT_POS_R_G_B, HARMONIUM_EFFECT, ESCAPE(Vector3f)),
+    GE_PARAMS_MEMBER_ENTRY(HARMONIUM_EFFECT_NEG_R_G_B, HARMONIUM_EFFECT, ESCAPE(Vector3f)),
+    GE_PARAMS_MEMBER_ENTRY(HARMONIUM_EFFECT_FRACTION, HARMONIUM_EFFECT, ESCAPE(float)),
+    GE_PARAMS_MEMBER_ENTRY(HARMONIUM_EFFECT_TOTAL_MATRIX, HARMONIUM_EFFECT, ESCAPE(Drawing::Matrix)),
+    GE_PARAMS_MEMBER_ENTRY(HEAT_DISTORTION_INTENSITY, HEAT_DISTORTION, ESCAPE(float)),
+    GE_PARAMS_MEMBER_ENTRY(HEAT_DISTORTION_NOISE_SCALE, HEAT_DISTORTION, ESCAPE(float)),
+    GE_PARAMS_MEMBER_ENTRY(HEAT_DISTORTION_RISE_WEIGHT, HEAT_DISTORTION, ESCAPE(float)),
+    GE_PARAMS_MEMBER_ENTRY(HEAT_DISTORTION_PROGRESS, HEAT_DISTORTION, ESCAPE(float)),
+    GE_PARAMS_MEMBER_ENTRY(IMAGE_MASK_IMAGE, IMAGE_MASK, ESCAPE(std::shared_ptr<Drawing::Image>)),
+    GE_PARAMS_MEMBER_ENTRY(KAWASE_BLUR_RADIUS, KAWASE_BLUR, ESCAPE(int32_t)),
+    GE_PARAMS_MEMBER_ENTRY(LINEAR_GRADIENT_BLUR_BLUR_RADIUS, LINEAR_GRADIENT_BLUR, ESCAPE(float)),
+    GE_PARAMS_MEMBER_ENTRY(LINEAR_GRADIENT_BLUR_FRACTION_STOPS, LINEAR_GRADIENT_BLUR,
+        ESCAPE(std::vector<std::pair<float, float>>)),
+    GE_PARAMS_MEMBER_ENTRY(LINEAR_GRADIENT_BLUR_DIRECTION, LINEAR_GRADIENT_BLUR, ESCAPE(int32_t)),
+    GE_PARAMS_MEMBER_ENTRY(LINEAR_GRADIENT_BLUR_GEO_WIDTH, LINEAR_GRADIENT_BLUR, ESCAPE(float)),
+    GE_PARAMS_MEMBER_ENTRY(LINEAR_GRADIENT_BLUR_GEO_HEIGHT, LINEAR_GRADIENT_BLUR, ESCAPE(float)),
+    GE_PARAMS_MEMBER_ENTRY(LINEAR_GRADIENT_BLUR_MAT, LINEAR_GRADIENT_BLUR, ESCAPE(Drawing::Matrix)),
+    GE_PARAMS_MEMBER_ENTRY(LINEAR_GRADIENT_BLUR_TRAN_X, LINEAR_GRADIENT_BLUR, ESCAPE(float)),
+    GE_PARAMS_MEMBER_ENTRY(LINEAR_GRADIENT_BLUR_TRAN_Y, LINEAR_GRADIENT_BLUR, ESCAPE(float)),
+    GE_PARAMS_MEMBER_ENTRY(LINEAR_GRADIENT_BLUR_IS_OFFSCREEN_CANVAS, LINEAR_GRADIENT_BLUR, ESCAPE(bool)),
+    GE_PARAMS_MEMBER_ENTRY(LINEAR_GRADIENT_BLUR_IS_RADIUS_GRADIENT, LINEAR_GRADIENT_BLUR, ESCAPE(bool)),
+    GE_PARAMS_MEMBER_ENTRY(LINEAR_GRADIENT_MASK_FRACTION_STOPS, LINEAR_GRADIENT_MASK,
+        ESCAPE(std::vector<std::pair<float, float>>)),
+    GE_PARAMS_MEMBER_ENTRY(LINEAR_GRADIENT_MASK_START_POSITION, LINEAR_GRADIENT_MASK, ESCAPE(Drawing::Point)),
+    GE_PARAMS_MEMBER_ENTRY(LINEAR_GRADIENT_MASK_END_POSITION, LINEAR_GRADIENT_MASK, ESCAPE(Drawing::Point)),
+    GE_PARAMS_MEMBER_ENTRY(MAGNIFIER_FACTOR, MAGNIFIER, ESCAPE(float)),
+    GE_PARAMS_MEMBER_ENTRY(MAGNIFIER_WIDTH, MAGNIFIER, ESCAPE(float)),
+    GE_PARAMS_MEMBER_ENTRY(MAGNIFIER_HEIGHT, MAGNIFIER, ESCAPE(float)),
+    GE_PARAMS_MEMBER_ENTRY(MAGNIFIER_CORNER_RADIUS, MAGNIFIER, ESCAPE(float)),
+    GE_PARAMS_MEMBER_ENTRY(MAGNIFIER_BORDER_WIDTH, MAGNIFIER, ESCAPE(float)),
+    GE_PARAMS_MEMBER_ENTRY(MAGNIFIER_ZOOM_OFFSET_X, MAGNIFIER, ESCAPE(float)),
+    GE_PARAMS_MEMBER_ENTRY(MAGNIFIER_ZOOM_OFFSET_Y, MAGNIFIER, ESCAPE(float)),
+    GE_PARAMS_MEMBER_ENTRY(MAGNIFIER_SHADOW_OFFSET_X, MAGNIFIER, ESCAPE(float)),
+    GE_PARAMS_MEMBER_ENTRY(MAGNIFIER_SHADOW_OFFSET_Y, MAGNIFIER, ESCAPE(float)),
+    GE_PARAMS_MEMBER_ENTRY(MAGNIFIER_SHADOW_SIZE, MAGNIFIER, ESCAPE(float)),
+    GE_PARAMS_MEMBER_ENTRY(MAGNIFIER_SHADOW_STRENGTH, MAGNIFIER, ESCAPE(float)),
+    GE_PARAMS_MEMBER_ENTRY(MAGNIFIER_GRADIENT_MASK_COLOR1, MAGNIFIER, ESCAPE(uint32_t)),
+    GE_PARAMS_MEMBER_ENTRY(MAGNIFIER_GRADIENT_MASK_COLOR2, MAGNIFIER, ESCAPE(uint32_t)),
+    GE_PARAMS_MEMBER_ENTRY(MAGNIFIER_OUTER_CONTOUR_COLOR1, MAGNIFIER, ESCAPE(uint32_t)),
+    GE_PARAMS_MEMBER_ENTRY(MAGNIFIER_OUTER_CONTOUR_COLOR2, MAGNIFIER, ESCAPE(uint32_t)),
+    GE_PARAMS_MEMBER_ENTRY(MAGNIFIER_ROTATE_DEGREE, MAGNIFIER, ESCAPE(int32_t)),
+    GE_PARAMS_MEMBER_ENTRY(MAGNIFIER_SDF_SHAPE, MAGNIFIER, ESCAPE(std::shared_ptr<Drawing::GEShaderShape>)),
+    GE_PARAMS_MEMBER_ENTRY(MAP_COLOR_BY_BRIGHTNESS_COLORS, MAP_COLOR_BY_BRIGHTNESS, ESCAPE(std::vector<Vector4f>)),
+    GE_PARAMS_MEMBER_ENTRY(MAP_COLOR_BY_BRIGHTNESS_POSITIONS, MAP_COLOR_BY_BRIGHTNESS, ESCAPE(std::vector<float>)),
+    GE_PARAMS_MEMBER_ENTRY(MASK_TRANSITION_MASK, MASK_TRANSITION, ESCAPE(std::shared_ptr<GEShaderMask>)),
+    GE_PARAMS_MEMBER_ENTRY(MASK_TRANSITION_FACTOR, MASK_TRANSITION, ESCAPE(float)),
+    GE_PARAMS_MEMBER_ENTRY(MASK_TRANSITION_INVERSE, MASK_TRANSITION, ESCAPE(bool)),
+    GE_PARAMS_MEMBER_ENTRY(MESA_BLUR_RADIUS, MESA_BLUR, ESCAPE(int32_t)),
+    GE_PARAMS_MEMBER_ENTRY(MESA_BLUR_GREY_COEF1, MESA_BLUR, ESCAPE(float)),
+    GE_PARAMS_MEMBER_ENTRY(MESA_BLUR_GREY_COEF2, MESA_BLUR, ESCAPE(float)),
+    GE_PARAMS_MEMBER_ENTRY(MESA_BLUR_OFFSET_X, MESA_BLUR, ESCAPE(float)),
+    GE_PARAMS_MEMBER_ENTRY(MESA_BLUR_OFFSET_Y, MESA_BLUR, ESCAPE(float)),
+    GE_PARAMS_MEMBER_ENTRY(MESA_BLUR_OFFSET_Z, MESA_BLUR, ESCAPE(float)),
+    GE_PARAMS_MEMBER_ENTRY(MESA_BLUR_OFFSET_W, MESA_BLUR, ESCAPE(float)),
+    GE_PARAMS_MEMBER_ENTRY(MESA_BLUR_TILE_MODE, MESA_BLUR, ESCAPE(int32_t)),
+    GE_PARAMS_MEMBER_ENTRY(MESA_BLUR_WIDTH, MESA_BLUR, ESCAPE(float)),
+    GE_PARAMS_MEMBER_ENTRY(MESA_BLUR_HEIGHT, MESA_BLUR, ESCAPE(float)),
+    GE_PARAMS_MEMBER_ENTRY(MESA_BLUR_IS_DIRECTION, MESA_BLUR, ESCAPE(bool)),
+    GE_PARAMS_MEMBER_ENTRY(MESA_BLUR_ANGLE, MESA_BLUR, ESCAPE(float)),
+    GE_PARAMS_MEMBER_ENTRY(MOTION_BLUR_RADIUS, MOTION_BLUR, ESCAPE(float)),
+    GE_PARAMS_MEMBER_ENTRY(MOTION_BLUR_ANCHOR, MOTION_BLUR, ESCAPE(Vector2f)),
+    GE_PARAMS_MEMBER_ENTRY(MOTION_BLUR_SAMPLE_COUNT, MOTION_BLUR, ESCAPE(int32_t)),
+    GE_PARAMS_MEMBER_ENTRY(MOTION_BLUR_MODE, MOTION_BLUR, ESCAPE(int32_t)),
+    GE_PARAMS_MEMBER_ENTRY(PARTICLE_ABLATION_PROGRESS, PARTICLE_ABLATION, ESCAPE(float)),
+    GE_PARAMS_MEMBER_ENTRY(PARTICLE_ABLATION_ABLATION_RATE, PARTICLE_ABLATION, ESCAPE(float)),
+    GE_PARAMS_MEMBER_ENTRY(PARTICLE_ABLATION_CENTERS0, PARTICLE_ABLATION, ESCAPE(std::pair<float, float>)),
+    GE_PARAMS_MEMBER_ENTRY(PARTICLE_ABLATION_CENTERS1, PARTICLE_ABLATION, ESCAPE(std::pair<float, float>)),
+    GE_PARAMS_MEMBER_ENTRY(PARTICLE_ABLATION_CENTERS2, PARTICLE_ABLATION, ESCAPE(std::pair<float, float>)),
+    GE_PARAMS_MEMBER_ENTRY(PARTICLE_ABLATION_CENTERS3, PARTICLE_ABLATION, ESCAPE(std::pair<float, float>)),
+    GE_PARAMS_MEMBER_ENTRY(PARTICLE_ABLATION_GLOW_LEVEL, PARTICLE_ABLATION, ESCAPE(float)),
+    GE_PARAMS_MEMBER_ENTRY(PARTICLE_ABLATION_GLOW_BRIGHTNESS, PARTICLE_ABLATION, ESCAPE(float)),
+    GE_PARAMS_MEMBER_ENTRY(PARTICLE_ABLATION_MAX_PARTICLE_COUNT, PARTICLE_ABLATION, ESCAPE(int32_t)),
+    GE_PARAMS_MEMBER_ENTRY(PARTICLE_ABLATION_WIND, PARTICLE_ABLATION, ESCAPE(std::pair<float, float>)),
+    GE_PARAMS_MEMBER_ENTRY(PARTICLE_ABLATION_TURB_SCALE, PARTICLE_ABLATION, ESCAPE(int32_t)),
+    GE_PARAMS_MEMBER_ENTRY(PARTICLE_ABLATION_TURB_EVO, PARTICLE_ABLATION, ESCAPE(int32_t)),
+    GE_PARAMS_MEMBER_ENTRY(PARTICLE_ABLATION_TURB_AMP, PARTICLE_ABLATION, ESCAPE(int32_t)),
+    GE_PARAMS_MEMBER_ENTRY(PARTICLE_ABLATION_EXPANSION_SIZE, PARTICLE_ABLATION, ESCAPE(std::pair<float, float>)),
+    GE_PARAMS_MEMBER_ENTRY(PARTICLE_CIRCULAR_HALO_CENTER, PARTICLE_CIRCULAR_HALO, ESCAPE(std::pair<float, float>)),
+    GE_PARAMS_MEMBER_ENTRY(PARTICLE_CIRCULAR_HALO_RADIUS, PARTICLE_CIRCULAR_HALO, ESCAPE(float)),
+    GE_PARAMS_MEMBER_ENTRY(PARTICLE_CIRCULAR_HALO_NOISE, PARTICLE_CIRCULAR_HALO, ESCAPE(float)),
+    GE_PARAMS_MEMBER_ENTRY(PIXEL_MAP_MASK_IMAGE, PIXEL_MAP_MASK, ESCAPE(std::shared_ptr<Drawing::Image>)),
+    GE_PARAMS_MEMBER_CAST_ENTRY(PIXEL_MAP_MASK_SRC, PIXEL_MAP_MASK, ESCAPE(Vector4f), ESCAPE(RectF)),
+    GE_PARAMS_MEMBER_CAST_ENTRY(PIXEL_MAP_MASK_DST, PIXEL_MAP_MASK, ESCAPE(Vector4f), ESCAPE(RectF)),
+    GE_PARAMS_MEMBER_ENTRY(PIXEL_MAP_MASK_FILL_COLOR, PIXEL_MAP_MASK, ESCAPE(Vector4f)),
+    GE_PARAMS_MEMBER_ENTRY(RADIAL_GRADIENT_MASK_CENTER, RADIAL_GRADIENT_MASK, ESCAPE(std::pair<float, float>)),
+    GE_PARAMS_MEMBER_ENTRY(RADIAL_GRADIENT_MASK_RADIUS_X, RADIAL_GRADIENT_MASK, ESCAPE(float)),
+    GE_PARAMS_MEMBER_ENTRY(RADIAL_GRADIENT_MASK_RADIUS_Y, RADIAL_GRADIENT_MASK, ESCAPE(float)),
+    GE_PARAMS_MEMBER_ENTRY(RADIAL_GRADIENT_MASK_COLORS, RADIAL_GRADIENT_MASK, ESCAPE(std::vector<float>)),
+    GE_PARAMS_MEMBER_ENTRY(RADIAL_GRADIENT_MASK_POSITIONS, RADIAL_GRADIENT_MASK, ESCAPE(std::vector<float>)),
+    GE_PARAMS_MEMBER_ENTRY(RIPPLE_MASK_CENTER, RIPPLE_MASK, ESCAPE(std::pair<float, float>)),
+    GE_PARAMS_MEMBER_ENTRY(RIPPLE_MASK_RADIUS, RIPPLE_MASK, ESCAPE(float)),
+    GE_PARAMS_MEMBER_ENTRY(RIPPLE_MASK_WIDTH, RIPPLE_MASK, ESCAPE(float)),
+    GE_PARAMS_MEMBER_ENTRY(RIPPLE_MASK_WIDTH_CENTER_OFFSET, RIPPLE_MASK, ESCAPE(float)),
+    GE_PARAMS_MEMBER_ENTRY(SDF_BORDER_SHAPE, SDF_BORDER, ESCAPE(std::shared_ptr<Drawing::GEShaderShape>)),
+    GE_PARAMS_MEMBER_ENTRY(SDF_BORDER_BORDER, SDF_BORDER, ESCAPE(GESDFBorderParams)),
+    GE_PARAMS_MEMBER_ENTRY(SDF_CLIP_SHAPE, SDF_CLIP, ESCAPE(std::shared_ptr<Drawing::GEShaderShape>)),
+    GE_PARAMS_MEMBER_ENTRY(SDF_COLOR_SHAPE, SDF_COLOR, ESCAPE(std::shared_ptr<Drawing::GEShaderShape>)),
+    GE_PARAMS_MEMBER_ENTRY(SDF_COLOR_COLOR, SDF_COLOR, ESCAPE(Vector4f)),
+    GE_PARAMS_MEMBER_ENTRY(SDF_DISTORT_OP_SHAPE_SHAPE, SDF_DISTORT_OP_SHAPE,
+        ESCAPE(std::shared_ptr<Drawing::GEShaderShape>)),
+    GE_PARAMS_MEMBER_CAST_ENTRY(SDF_DISTORT_OP_SHAPE_L_U_CORNER, SDF_DISTORT_OP_SHAPE, ESCAPE(std::pair<float, float>),
+        ESCAPE(Drawing::Point)),
+    GE_PARAMS_MEMBER_CAST_ENTRY(SDF_DISTORT_OP_SHAPE_R_U_CORNER, SDF_DISTORT_OP_SHAPE, ESCAPE(std::pair<float, float>),
+        ESCAPE(Drawing::Point)),
+    GE_PARAMS_MEMBER_CAST_ENTRY(SDF_DISTORT_OP_SHAPE_R_B_CORNER, SDF_DISTORT_OP_SHAPE, ESCAPE(std::pair<float, float>),
+        ESCAPE(Drawing::Point)),
+    GE_PARAMS_MEMBER_CAST_ENTRY(SDF_DISTORT_OP_SHAPE_L_B_CORNER, SDF_DISTORT_OP_SHAPE, ESCAPE(std::pair<float, float>),
+        ESCAPE(Drawing::Point)),
+    GE_PARAMS_MEMBER_ENTRY(SDF_DISTORT_OP_SHAPE_BARREL_DISTORTION, SDF_DISTORT_OP_SHAPE, ESCAPE(Vector4f)),
+    GE_PARAMS_MEMBER_ENTRY(SDF_EDGE_LIGHT_EFFECT_SDF_SPREAD_FACTOR, SDF_EDGE_LIGHT_EFFECT, ESCAPE(float)),
+    GE_PARAMS_MEMBER_ENTRY(SDF_EDGE_LIGHT_EFFECT_BLOOM_INTENSITY_CUTOFF, SDF_EDGE_LIGHT_EFFECT, ESCAPE(float)),
+    GE_PARAMS_MEMBER_ENTRY(SDF_EDGE_LIGHT_EFFECT_MAX_INTENSITY, SDF_EDGE_LIGHT_EFFECT, ESCAPE(float)),
+    GE_PARAMS_MEMBER_ENTRY(SDF_EDGE_LIGHT_EFFECT_MAX_BLOOM_INTENSITY, SDF_EDGE_LIGHT_EFFECT, ESCAPE(float)),
+    GE_PARAMS_MEMBER_ENTRY(SDF_EDGE_LIGHT_EFFECT_BLOOM_FALLOFF_POW, SDF_EDGE_LIGHT_EFFECT, ESCAPE(float)),
+    GE_PARAMS_MEMBER_ENTRY(SDF_EDGE_LIGHT_EFFECT_MIN_BORDER_WIDTH, SDF_EDGE_LIGHT_EFFECT, ESCAPE(float)),
+    GE_PARAMS_MEMBER_ENTRY(SDF_EDGE_LIGHT_EFFECT_MAX_BORDER_WIDTH, SDF_EDGE_LIGHT_EFFECT, ESCAPE(float)),
+    GE_PARAMS_MEMBER_ENTRY(SDF_EDGE_LIGHT_EFFECT_INNER_BORDER_BLOOM_WIDTH, SDF_EDGE_LIGHT_EFFECT, ESCAPE(float)),
+    GE_PARAMS_MEMBER_ENTRY(SDF_EDGE_LIGHT_EFFECT_OUTER_BORDER_BLOOM_WIDTH, SDF_EDGE_LIGHT_EFFECT, ESCAPE(float)),
+    GE_PARAMS_MEMBER_ENTRY(SDF_EDGE_LIGHT_EFFECT_COLOR, SDF_EDGE_LIGHT_EFFECT, ESCAPE(Vector3f)),
+    GE_PARAMS_MEMBER_ENTRY(SDF_EDGE_LIGHT_EFFECT_SDF_IMAGE, SDF_EDGE_LIGHT_EFFECT,
+        ESCAPE(std::shared_ptr<Drawing::Image>)),
+    GE_PARAMS_MEMBER_ENTRY(SDF_EDGE_LIGHT_EFFECT_LIGHT_MASK, SDF_EDGE_LIGHT_EFFECT,
+        ESCAPE(std::shared_ptr<GEShaderMask>)),
+    GE_PARAMS_MEMBER_ENTRY(SDF_EDGE_LIGHT_EFFECT_SDF_SHAPE, SDF_EDGE_LIGHT_EFFECT,
+        ESCAPE(std::shared_ptr<Drawing::GEShaderShape>)),
+    GE_PARAMS_MEMBER_ENTRY(SDF_EDGE_LIGHT_SDF_SPREAD_FACTOR, SDF_EDGE_LIGHT, ESCAPE(float)),
+    GE_PARAMS_MEMBER_ENTRY(SDF_EDGE_LIGHT_BLOOM_INTENSITY_CUTOFF, SDF_EDGE_LIGHT, ESCAPE(float)),
+    GE_PARAMS_MEMBER_ENTRY(SDF_EDGE_LIGHT_MAX_INTENSITY, SDF_EDGE_LIGHT, ESCAPE(float)),
+    GE_PARAMS_MEMBER_ENTRY(SDF_EDGE_LIGHT_MAX_BLOOM_INTENSITY, SDF_EDGE_LIGHT, ESCAPE(float)),
+    GE_PARAMS_MEMBER_ENTRY(SDF_EDGE_LIGHT_BLOOM_FALLOFF_POW, SDF_EDGE_LIGHT, ESCAPE(float)),
+    GE_PARAMS_MEMBER_ENTRY(SDF_EDGE_LIGHT_MIN_BORDER_WIDTH, SDF_EDGE_LIGHT, ESCAPE(float)),
+    GE_PARAMS_MEMBER_ENTRY(SDF_EDGE_LIGHT_MAX_BORDER_WIDTH, SDF_EDGE_LIGHT, ESCAPE(float)),
+    GE_PARAMS_MEMBER_ENTRY(SDF_EDGE_LIGHT_INNER_BORDER_BLOOM_WIDTH, SDF_EDGE_LIGHT, ESCAPE(float)),
+    GE_PARAMS_MEMBER_ENTRY(SDF_EDGE_LIGHT_OUTER_BORDER_BLOOM_WIDTH, SDF_EDGE_LIGHT, ESCAPE(float)),
+    GE_PARAMS_MEMBER_ENTRY(SDF_EDGE_LIGHT_SDF_IMAGE, SDF_EDGE_LIGHT, ESCAPE(std::shared_ptr<Drawing::Image>)),
+    GE_PARAMS_MEMBER_ENTRY(SDF_EDGE_LIGHT_LIGHT_MASK, SDF_EDGE_LIGHT, ESCAPE(std::shared_ptr<GEShaderMask>)),
+    GE_PARAMS_MEMBER_ENTRY(SDF_EDGE_LIGHT_SDF_SHAPE, SDF_EDGE_LIGHT, ESCAPE(std::shared_ptr<Drawing::GEShaderShape>)),
+    GE_PARAMS_MEMBER_CAST_ENTRY(SDF_ELLIPSE_SHAPE_CENTER, SDF_ELLIPSE_SHAPE, ESCAPE(std::pair<float, float>),
+        ESCAPE(Vector2f)),
+    GE_PARAMS_MEMBER_ENTRY(SDF_ELLIPSE_SHAPE_WIDTH, SDF_ELLIPSE_SHAPE, ESCAPE(float)),
+    GE_PARAMS_MEMBER_ENTRY(SDF_ELLIPSE_SHAPE_HEIGHT, SDF_ELLIPSE_SHAPE, ESCAPE(float)),
+    GE_PARAMS_MEMBER_ENTRY(SDF_FROM_IMAGE_SPREAD_FACTOR, SDF_FROM_IMAGE, ESCAPE(int32_t)),
+    GE_PARAMS_MEMBER_ENTRY(SDF_FROM_IMAGE_GENERATE_DERIVS, SDF_FROM_IMAGE, ESCAPE(bool)),
+    GE_PARAMS_MEMBER_ENTRY(SDF_PATH_SHAPE_PATH, SDF_PATH_SHAPE, ESCAPE(Drawing::Path)),
+    GE_PARAMS_MEMBER_CAST_ENTRY(SDF_PATH_SHAPE_OFFSET, SDF_PATH_SHAPE, ESCAPE(std::pair<float, float>),
+        ESCAPE(Vector2f)),
+    GE_PARAMS_MEMBER_CAST_ENTRY(SDF_PATH_SHAPE_SCALE, SDF_PATH_SHAPE, ESCAPE(std::pair<float, float>),
+        ESCAPE(Vector2f)),
+    GE_PARAMS_MEMBER_ENTRY(SDF_PIXELMAP_SHAPE_IMAGE, SDF_PIXELMAP_SHAPE, ESCAPE(std::shared_ptr<Drawing::Image>)),
+    GE_PARAMS_MEMBER_ENTRY(SDF_RRECT_SHAPE_RRECT, SDF_RRECT_SHAPE, ESCAPE(GERRect)),
+    GE_PARAMS_MEMBER_ENTRY(SDF_SHADOW_SHAPE, SDF_SHADOW, ESCAPE(std::shared_ptr<Drawing::GEShaderShape>)),
+    GE_PARAMS_MEMBER_ENTRY(SDF_SHADOW_SHADOW, SDF_SHADOW, ESCAPE(GESDFShadowParams)),
+    GE_PARAMS_MEMBER_ENTRY(SDF_SMOOTH_SUB_OP_SHAPE_SPACING, SDF_SMOOTH_SUB_OP_SHAPE, ESCAPE(float)),
+    GE_PARAMS_MEMBER_ENTRY(SDF_SMOOTH_SUB_OP_SHAPE_LEFT, SDF_SMOOTH_SUB_OP_SHAPE,
+        ESCAPE(std::shared_ptr<Drawing::GEShaderShape>)),
+    GE_PARAMS_MEMBER_ENTRY(SDF_SMOOTH_SUB_OP_SHAPE_RIGHT, SDF_SMOOTH_SUB_OP_SHAPE,
+        ESCAPE(std::shared_ptr<Drawing::GEShaderShape>)),
+    GE_PARAMS_MEMBER_ENTRY(SDF_SUB_OP_SHAPE_LEFT, SDF_SUB_OP_SHAPE, ESCAPE(std::shared_ptr<Drawing::GEShaderShape>)),
+    GE_PARAMS_MEMBER_ENTRY(SDF_SUB_OP_SHAPE_RIGHT, SDF_SUB_OP_SHAPE, ESCAPE(std::shared_ptr<Drawing::GEShaderShape>)),
+    GE_PARAMS_MEMBER_ENTRY(SDF_TRANSFORM_SHAPE_SHAPE, SDF_TRANSFORM_SHAPE,
+        ESCAPE(std::shared_ptr<Drawing::GEShaderShape>)),
+    GE_PARAMS_MEMBER_ENTRY(SDF_TRANSFORM_SHAPE_MATRIX, SDF_TRANSFORM_SHAPE, ESCAPE(Drawing::Matrix)),
+    GE_PARAMS_MEMBER_ENTRY(SDF_TRANSFORM_SHAPE_WARP_STRENGTH, SDF_TRANSFORM_SHAPE, ESCAPE(float)),
+    GE_PARAMS_MEMBER_ENTRY(SDF_TRANSFORM_SHAPE_UNION_MODE, SDF_TRANSFORM_SHAPE, ESCAPE(int32_t)),
+    GE_PARAMS_MEMBER_ENTRY(SDF_TRANSFORM_SHAPE_SPACING, SDF_TRANSFORM_SHAPE, ESCAPE(float)),
+    GE_PARAMS_MEMBER_ENTRY(SDF_TRANSFORM_SHAPE_HOT_ZONE, SDF_TRANSFORM_SHAPE, ESCAPE(float)),
+    GE_PARAMS_MEMBER_CAST_ENTRY(SDF_TRANSFORM_SHAPE_CENTER_POSITION, SDF_TRANSFORM_SHAPE,
+        ESCAPE(std::pair<float, float>), ESCAPE(Vector2f)),
+    GE_PARAMS_MEMBER_CAST_ENTRY(SDF_TRIANGLE_SHAPE_VERTEX0, SDF_TRIANGLE_SHAPE, ESCAPE(std::pair<float, float>),
+        ESCAPE(Vector2f)),
+    GE_PARAMS_MEMBER_CAST_ENTRY(SDF_TRIANGLE_SHAPE_VERTEX1, SDF_TRIANGLE_SHAPE, ESCAPE(std::pair<float, float>),
+        ESCAPE(Vector2f)),
+    GE_PARAMS_MEMBER_CAST_ENTRY(SDF_TRIANGLE_SHAPE_VERTEX2, SDF_TRIANGLE_SHAPE, ESCAPE(std::pair<float, float>),
+        ESCAPE(Vector2f)),
+    GE_PARAMS_MEMBER_ENTRY(SDF_TRIANGLE_SHAPE_RADIUS, SDF_TRIANGLE_SHAPE, ESCAPE(float)),
+    GE_PARAMS_MEMBER_ENTRY(SDF_UNION_OP_SPACING, SDF_UNION_OP, ESCAPE(float)),
+    GE_PARAMS_MEMBER_ENTRY(SDF_UNION_OP_LEFT, SDF_UNION_OP, ESCAPE(std::shared_ptr<Drawing::GEShaderShape>)),
+    GE_PARAMS_MEMBER_ENTRY(SDF_UNION_OP_RIGHT, SDF_UNION_OP, ESCAPE(std::shared_ptr<Drawing::GEShaderShape>)),
+    GE_PARAMS_MEMBER_CAST_ENTRY(SDF_UNION_OP_OP, SDF_UNION_OP, ESCAPE(uint32_t), ESCAPE(GESDFUnionOp)),
+    GE_PARAMS_MEMBER_CAST_ENTRY(SOUND_WAVE_COLOR_A, SOUND_WAVE, ESCAPE(Vector4f), ESCAPE(Drawing::Color4f)),
+    GE_PARAMS_MEMBER_CAST_ENTRY(SOUND_WAVE_COLOR_B, SOUND_WAVE, ESCAPE(Vector4f), ESCAPE(Drawing::Color4f)),
+    GE_PARAMS_MEMBER_CAST_ENTRY(SOUND_WAVE_COLOR_C, SOUND_WAVE, ESCAPE(Vector4f), ESCAPE(Drawing::Color4f)),
+    GE_PARAMS_MEMBER_ENTRY(SOUND_WAVE_COLOR_PROGRESS, SOUND_WAVE, ESCAPE(float)),
+    GE_PARAMS_MEMBER_ENTRY(SOUND_WAVE_SOUND_INTENSITY, SOUND_WAVE, ESCAPE(float)),
+    GE_PARAMS_MEMBER_ENTRY(SOUND_WAVE_SHOCK_WAVE_ALPHA_A, SOUND_WAVE, ESCAPE(float)),
+    GE_PARAMS_MEMBER_ENTRY(SOUND_WAVE_SHOCK_WAVE_ALPHA_B, SOUND_WAVE, ESCAPE(float)),
+    GE_PARAMS_MEMBER_ENTRY(SOUND_WAVE_SHOCK_WAVE_PROGRESS_A, SOUND_WAVE, ESCAPE(float)),
+    GE_PARAMS_MEMBER_ENTRY(SOUND_WAVE_SHOCK_WAVE_PROGRESS_B, SOUND_WAVE, ESCAPE(float)),
+    GE_PARAMS_MEMBER_ENTRY(SOUND_WAVE_SHOCK_WAVE_TOTAL_ALPHA, SOUND_WAVE, ESCAPE(float)),
+    GE_PARAMS_MEMBER_ENTRY(SPATIAL_GLASS_EFFECT_LEFT_TOP, SPATIAL_GLASS_EFFECT, ESCAPE(Vector3f)),
+    GE_PARAMS_MEMBER_ENTRY(SPATIAL_GLASS_EFFECT_LEFT_BOT, SPATIAL_GLASS_EFFECT, ESCAPE(Vector3f)),
+    GE_PARAMS_MEMBER_ENTRY(SPATIAL_GLASS_EFFECT_RIGHT_TOP, SPATIAL_GLASS_EFFECT, ESCAPE(Vector3f)),
+    GE_PARAMS_MEMBER_ENTRY(SPATIAL_GLASS_EFFECT_RIGHT_BOT, SPATIAL_GLASS_EFFECT, ESCAPE(Vector3f)),
+    GE_PARAMS_MEMBER_ENTRY(SPATIAL_GLASS_EFFECT_CAMERA_POSITION, SPATIAL_GLASS_EFFECT, ESCAPE(Vector3f)),
+    GE_PARAMS_MEMBER_ENTRY(SPATIAL_GLASS_EFFECT_CAMERA_INTRINSICS, SPATIAL_GLASS_EFFECT, ESCAPE(Vector2f)),
+    GE_PARAMS_MEMBER_ENTRY(SPATIAL_GLASS_EFFECT_LIGHT_DIR, SPATIAL_GLASS_EFFECT, ESCAPE(Vector3f)),
+    GE_PARAMS_MEMBER_CAST_ENTRY(SPATIAL_GLASS_EFFECT_THICK_PARAMS, SPATIAL_GLASS_EFFECT,
+        ESCAPE(std::pair<float, float>), ESCAPE(Vector2f)),
+    GE_PARAMS_MEMBER_ENTRY(SPATIAL_GLASS_EFFECT_GLASS_BASE_COLOR, SPATIAL_GLASS_EFFECT, ESCAPE(Vector4f)),
+    GE_PARAMS_MEMBER_ENTRY(SPATIAL_GLASS_EFFECT_FRESNEL_ENV_COLOR, SPATIAL_GLASS_EFFECT, ESCAPE(Vector4f)),
+    GE_PARAMS_MEMBER_CAST_ENTRY(SPATIAL_GLASS_EFFECT_FRESNEL_ENV_PARAMS, SPATIAL_GLASS_EFFECT,
+        ESCAPE(std::pair<float, float>), ESCAPE(Vector2f)),
+    GE_PARAMS_MEMBER_CAST_ENTRY(SPATIAL_GLASS_EFFECT_BG_RATES, SPATIAL_GLASS_EFFECT, ESCAPE(std::pair<float, float>),
+        ESCAPE(Vector2f)),
+    GE_PARAMS_MEMBER_ENTRY(SPATIAL_GLASS_EFFECT_BG_K_B_S, SPATIAL_GLASS_EFFECT, ESCAPE(Vector3f)),
+    GE_PARAMS_MEMBER_ENTRY(SPATIAL_GLASS_EFFECT_BG_POS, SPATIAL_GLASS_EFFECT, ESCAPE(Vector3f)),
+    GE_PARAMS_MEMBER_ENTRY(SPATIAL_GLASS_EFFECT_BG_NEG, SPATIAL_GLASS_EFFECT, ESCAPE(Vector3f)),
+    GE_PARAMS_MEMBER_ENTRY(SPATIAL_GLASS_EFFECT_REFRACT_PARAMS, SPATIAL_GLASS_EFFECT, ESCAPE(Vector3f)),
+    GE_PARAMS_MEMBER_CAST_ENTRY(SPATIAL_GLASS_EFFECT_WEIGHTS_EDL, SPATIAL_GLASS_EFFECT,
+        ESCAPE(std::pair<float, float>), ESCAPE(Vector2f)),
+    GE_PARAMS_MEMBER_ENTRY(SPATIAL_GLASS_EFFECT_ENV_LIGHT_PARAMS, SPATIAL_GLASS_EFFECT, ESCAPE(Vector3f)),
+    GE_PARAMS_MEMBER_CAST_ENTRY(SPATIAL_GLASS_EFFECT_ENV_LIGHT_RATES, SPATIAL_GLASS_EFFECT,
+        ESCAPE(std::pair<float, float>), ESCAPE(Vector2f)),
+    GE_PARAMS_MEMBER_ENTRY(SPATIAL_GLASS_EFFECT_ENV_LIGHT_K_B_S, SPATIAL_GLASS_EFFECT, ESCAPE(Vector3f)),
+    GE_PARAMS_MEMBER_ENTRY(SPATIAL_GLASS_EFFECT_ENV_LIGHT_POS, SPATIAL_GLASS_EFFECT, ESCAPE(Vector3f)),
+    GE_PARAMS_MEMBER_ENTRY(SPATIAL_GLASS_EFFECT_ENV_LIGHT_NEG, SPATIAL_GLASS_EFFECT, ESCAPE(Vector3f)),
+    GE_PARAMS_MEMBER_ENTRY(SPATIAL_GLASS_EFFECT_SD_PARAMS, SPATIAL_GLASS_EFFECT, ESCAPE(Vector3f)),
+    GE_PARAMS_MEMBER_CAST_ENTRY(SPATIAL_GLASS_EFFECT_SD_RATES, SPATIAL_GLASS_EFFECT, ESCAPE(std::pair<float, float>),
+        ESCAPE(Vector2f)),
+    GE_PARAMS_MEMBER_ENTRY(SPATIAL_GLASS_EFFECT_SD_K_B_S, SPATIAL_GLASS_EFFECT, ESCAPE(Vector3f)),
+    GE_PARAMS_MEMBER_ENTRY(SPATIAL_GLASS_EFFECT_SD_POS, SPATIAL_GLASS_EFFECT, ESCAPE(Vector3f)),
+    GE_PARAMS_MEMBER_ENTRY(SPATIAL_GLASS_EFFECT_SD_NEG, SPATIAL_GLASS_EFFECT, ESCAPE(Vector3f)),
+    GE_PARAMS_MEMBER_ENTRY(SPATIAL_GLASS_EFFECT_SDF_SHAPE, SPATIAL_GLASS_EFFECT,
+        ESCAPE(std::shared_ptr<Drawing::GEShaderShape>)),
+    GE_PARAMS_MEMBER_CAST_ENTRY(SPATIAL_GLASS_EFFECT_BLUR_IMAGE, SPATIAL_GLASS_EFFECT,
+        ESCAPE(std::shared_ptr<Drawing::Image>), ESCAPE(std::weak_ptr<Drawing::Image>)),
+    GE_PARAMS_MEMBER_CAST_ENTRY(SPATIAL_GLASS_EFFECT_DEPTH_IMAGE, SPATIAL_GLASS_EFFECT,
+        ESCAPE(std::shared_ptr<Drawing::Image>), ESCAPE(std::weak_ptr<Drawing::Image>)),
+    GE_PARAMS_MEMBER_ENTRY(SPATIAL_GLASS_EFFECT_SNAPSHOT_RECT, SPATIAL_GLASS_EFFECT, ESCAPE(RectF)),
+    GE_PARAMS_MEMBER_ENTRY(SPATIAL_GLASS_EFFECT_SNAPSHOT_MATRIX, SPATIAL_GLASS_EFFECT, ESCAPE(Drawing::Matrix)),
+    GE_PARAMS_MEMBER_ENTRY(SPATIAL_GLASS_EFFECT_REFRACT_OUT_PX, SPATIAL_GLASS_EFFECT, ESCAPE(float)),
+    GE_PARAMS_MEMBER_ENTRY(SPATIAL_GLASS_EFFECT_ENABLE_S_D_F_CACHE, SPATIAL_GLASS_EFFECT, ESCAPE(bool)),
+    GE_PARAMS_MEMBER_ENTRY(SPATIAL_POINT_LIGHT_LIGHT_INTENSITY, SPATIAL_POINT_LIGHT, ESCAPE(float)),
+    GE_PARAMS_MEMBER_ENTRY(SPATIAL_POINT_LIGHT_LIGHT_POSITION, SPATIAL_POINT_LIGHT, ESCAPE(Vector3f)),
+    GE_PARAMS_MEMBER_ENTRY(SPATIAL_POINT_LIGHT_ATTENUATION, SPATIAL_POINT_LIGHT, ESCAPE(float)),
+    GE_PARAMS_MEMBER_ENTRY(SPATIAL_POINT_LIGHT_LIGHT_COLOR, SPATIAL_POINT_LIGHT, ESCAPE(Vector4f)),
+    GE_PARAMS_MEMBER_ENTRY(SPATIAL_POINT_LIGHT_MASK, SPATIAL_POINT_LIGHT, ESCAPE(std::shared_ptr<GEShaderMask>)),
+    GE_PARAMS_MEMBER_CAST_ENTRY(USE_EFFECT_MASK_IMAGE, USE_EFFECT_MASK, ESCAPE(std::shared_ptr<Drawing::Image>),
+        ESCAPE(std::weak_ptr<Drawing::Image>)),
+    GE_PARAMS_MEMBER_ENTRY(USE_EFFECT_MASK_USE_EFFECT, USE_EFFECT_MASK, ESCAPE(bool)),
+    GE_PARAMS_MEMBER_ENTRY(VARIABLE_RADIUS_BLUR_MASK, VARIABLE_RADIUS_BLUR, ESCAPE(std::shared_ptr<GEShaderMask>)),
+    GE_PARAMS_MEMBER_ENTRY(VARIABLE_RADIUS_BLUR_BLUR_RADIUS, VARIABLE_RADIUS_BLUR, ESCAPE(float)),
+    GE_PARAMS_MEMBER_ENTRY(VARIABLE_RADIUS_BLUR_APPLY_INSIDE_MASK, VARIABLE_RADIUS_BLUR, ESCAPE(bool)),
+    GE_PARAMS_MEMBER_ENTRY(VARIABLE_RADIUS_BLUR_MODE, VARIABLE_RADIUS_BLUR, ESCAPE(int32_t)),
+    GE_PARAMS_MEMBER_ENTRY(WATER_DROPLET_TRANSITION_TOP_LAYER, WATER_DROPLET_TRANSITION,
+        ESCAPE(std::shared_ptr<Drawing::Image>)),
+    GE_PARAMS_MEMBER_ENTRY(WATER_DROPLET_TRANSITION_INVERSE, WATER_DROPLET_TRANSITION, ESCAPE(bool)),
+    GE_PARAMS_MEMBER_ENTRY(WATER_DROPLET_TRANSITION_PROGRESS, WATER_DROPLET_TRANSITION, ESCAPE(float)),
+    GE_PARAMS_MEMBER_ENTRY(WATER_DROPLET_TRANSITION_RADIUS, WATER_DROPLET_TRANSITION, ESCAPE(float)),
+    GE_PARAMS_MEMBER_ENTRY(WATER_DROPLET_TRANSITION_TRANSITION_FADE_WIDTH, WATER_DROPLET_TRANSITION, ESCAPE(float)),
+    GE_PARAMS_MEMBER_ENTRY(WATER_DROPLET_TRANSITION_DISTORTION_INTENSITY, WATER_DROPLET_TRANSITION, ESCAPE(float)),
+    GE_PARAMS_MEMBER_ENTRY(WATER_DROPLET_TRANSITION_DISTORTION_THICKNESS, WATER_DROPLET_TRANSITION, ESCAPE(float)),
+    GE_PARAMS_MEMBER_ENTRY(WATER_DROPLET_TRANSITION_LIGHT_STRENGTH, WATER_DROPLET_TRANSITION, ESCAPE(float)),
+    GE_PARAMS_MEMBER_ENTRY(WATER_DROPLET_TRANSITION_LIGHT_SOFTNESS, WATER_DROPLET_TRANSITION, ESCAPE(float)),
+    GE_PARAMS_MEMBER_ENTRY(WATER_DROPLET_TRANSITION_NOISE_SCALE_X, WATER_DROPLET_TRANSITION, ESCAPE(float)),
+    GE_PARAMS_MEMBER_ENTRY(WATER_DROPLET_TRANSITION_NOISE_SCALE_Y, WATER_DROPLET_TRANSITION, ESCAPE(float)),
+    GE_PARAMS_MEMBER_ENTRY(WATER_DROPLET_TRANSITION_NOISE_STRENGTH_X, WATER_DROPLET_TRANSITION, ESCAPE(float)),
+    GE_PARAMS_MEMBER_ENTRY(WATER_DROPLET_TRANSITION_NOISE_STRENGTH_Y, WATER_DROPLET_TRANSITION, ESCAPE(float)),
+    GE_PARAMS_MEMBER_CAST_ENTRY(WATER_DROPLET_TRANSITION_POSITION, WATER_DROPLET_TRANSITION,
+        ESCAPE(std::pair<float, float>), ESCAPE(Vector2f)),
+    GE_PARAMS_MEMBER_ENTRY(WATER_RIPPLE_PROGRESS, WATER_RIPPLE, ESCAPE(float)),
+    GE_PARAMS_MEMBER_ENTRY(WATER_RIPPLE_WAVE_COUNT, WATER_RIPPLE, ESCAPE(uint32_t)),
+    GE_PARAMS_MEMBER_ENTRY(WATER_RIPPLE_RIPPLE_CENTER_X, WATER_RIPPLE, ESCAPE(float)),
+    GE_PARAMS_MEMBER_ENTRY(WATER_RIPPLE_RIPPLE_CENTER_Y, WATER_RIPPLE, ESCAPE(float)),
+    GE_PARAMS_MEMBER_ENTRY(WATER_RIPPLE_RIPPLE_MODE, WATER_RIPPLE, ESCAPE(uint32_t)),
+    GE_PARAMS_MEMBER_CAST_ENTRY(WAVE_DISTURBANCE_MASK_CLICK_POS, WAVE_DISTURBANCE_MASK,
+        ESCAPE(std::pair<float, float>), ESCAPE(Vector2f)),
+    GE_PARAMS_MEMBER_ENTRY(WAVE_DISTURBANCE_MASK_PROGRESS, WAVE_DISTURBANCE_MASK, ESCAPE(float)),
+    GE_PARAMS_MEMBER_CAST_ENTRY(WAVE_DISTURBANCE_MASK_WAVE_R_D, WAVE_DISTURBANCE_MASK, ESCAPE(std::pair<float, float>),
+        ESCAPE(Vector2f)),
+    GE_PARAMS_MEMBER_ENTRY(WAVE_DISTURBANCE_MASK_WAVE_L_W_H, WAVE_DISTURBANCE_MASK, ESCAPE(Vector3f)),
+    GE_PARAMS_MEMBER_ENTRY(WAVE_GRADIENT_MASK_CENTER, WAVE_GRADIENT_MASK, ESCAPE(std::pair<float, float>)),
+    GE_PARAMS_MEMBER_ENTRY(WAVE_GRADIENT_MASK_WIDTH, WAVE_GRADIENT_MASK, ESCAPE(float)),
+    GE_PARAMS_MEMBER_ENTRY(WAVE_GRADIENT_MASK_PROPAGATION_RADIUS, WAVE_GRADIENT_MASK, ESCAPE(float)),
+    GE_PARAMS_MEMBER_ENTRY(WAVE_GRADIENT_MASK_BLUR_RADIUS, WAVE_GRADIENT_MASK, ESCAPE(float)),
+    GE_PARAMS_MEMBER_ENTRY(WAVE_GRADIENT_MASK_TURBULENCE_STRENGTH, WAVE_GRADIENT_MASK, ESCAPE(float)),
+    GE_PARAMS_MEMBER_ENTRY(WAVY_RIPPLE_LIGHT_CENTER, WAVY_RIPPLE_LIGHT, ESCAPE(std::pair<float, float>)),
+    GE_PARAMS_MEMBER_ENTRY(WAVY_RIPPLE_LIGHT_RADIUS, WAVY_RIPPLE_LIGHT, ESCAPE(float)),
+    GE_PARAMS_MEMBER_ENTRY(WAVY_RIPPLE_LIGHT_THICKNESS, WAVY_RIPPLE_LIGHT, ESCAPE(float)),
+    GE_PARAMS_MEMBER_ENTRY(AIBAR_GLOW_L_T_W_H, AIBAR_GLOW, ESCAPE(Vector4f)),
+    GE_PARAMS_MEMBER_ENTRY(AIBAR_GLOW_STRETCH_FACTOR, AIBAR_GLOW, ESCAPE(float)),
+    GE_PARAMS_MEMBER_ENTRY(AIBAR_GLOW_BAR_ANGLE, AIBAR_GLOW, ESCAPE(float)),
+    GE_PARAMS_MEMBER_ENTRY(AIBAR_GLOW_COLORS0, AIBAR_GLOW, ESCAPE(Vector4f)),
+    GE_PARAMS_MEMBER_ENTRY(AIBAR_GLOW_COLORS1, AIBAR_GLOW, ESCAPE(Vector4f)),
+    GE_PARAMS_MEMBER_ENTRY(AIBAR_GLOW_COLORS2, AIBAR_GLOW, ESCAPE(Vector4f)),
+    GE_PARAMS_MEMBER_ENTRY(AIBAR_GLOW_COLORS3, AIBAR_GLOW, ESCAPE(Vector4f)),
+    GE_PARAMS_MEMBER_ENTRY(AIBAR_GLOW_POSITIONS0, AIBAR_GLOW, ESCAPE(std::pair<float, float>)),
+    GE_PARAMS_MEMBER_ENTRY(AIBAR_GLOW_POSITIONS1, AIBAR_GLOW, ESCAPE(std::pair<float, float>)),
+    GE_PARAMS_MEMBER_ENTRY(AIBAR_GLOW_POSITIONS2, AIBAR_GLOW, ESCAPE(std::pair<float, float>)),
+    GE_PARAMS_MEMBER_ENTRY(AIBAR_GLOW_POSITIONS3, AIBAR_GLOW, ESCAPE(std::pair<float, float>)),
+    GE_PARAMS_MEMBER_ENTRY(AIBAR_GLOW_STRENGTHS, AIBAR_GLOW, ESCAPE(Vector4f)),
+    GE_PARAMS_MEMBER_ENTRY(AIBAR_GLOW_BRIGHTNESS, AIBAR_GLOW, ESCAPE(float)),
+    GE_PARAMS_MEMBER_ENTRY(AIBAR_GLOW_PROGRESS, AIBAR_GLOW, ESCAPE(float)),
+    GE_PARAMS_MEMBER_ENTRY(AIBAR_RECT_HALO_L_T_W_H, AIBAR_RECT_HALO, ESCAPE(Vector4f)),
+    GE_PARAMS_MEMBER_ENTRY(AIBAR_RECT_HALO_COLORS0, AIBAR_RECT_HALO, ESCAPE(Vector4f)),
+    GE_PARAMS_MEMBER_ENTRY(AIBAR_RECT_HALO_COLORS1, AIBAR_RECT_HALO, ESCAPE(Vector4f)),
+    GE_PARAMS_MEMBER_ENTRY(AIBAR_RECT_HALO_COLORS2, AIBAR_RECT_HALO, ESCAPE(Vector4f)),
+    GE_PARAMS_MEMBER_ENTRY(AIBAR_RECT_HALO_COLORS3, AIBAR_RECT_HALO, ESCAPE(Vector4f)),
+    GE_PARAMS_MEMBER_ENTRY(AIBAR_RECT_HALO_POSITIONS0, AIBAR_RECT_HALO, ESCAPE(std::pair<float, float>)),
+    GE_PARAMS_MEMBER_ENTRY(AIBAR_RECT_HALO_POSITIONS1, AIBAR_RECT_HALO, ESCAPE(std::pair<float, float>)),
+    GE_PARAMS_MEMBER_ENTRY(AIBAR_RECT_HALO_POSITIONS2, AIBAR_RECT_HALO, ESCAPE(std::pair<float, float>)),
+    GE_PARAMS_MEMBER_ENTRY(AIBAR_RECT_HALO_POSITIONS3, AIBAR_RECT_HALO, ESCAPE(std::pair<float, float>)),
+    GE_PARAMS_MEMBER_ENTRY(AIBAR_RECT_HALO_STRENGTHS, AIBAR_RECT_HALO, ESCAPE(Vector4f)),
+    GE_PARAMS_MEMBER_ENTRY(AIBAR_RECT_HALO_BRIGHTNESS, AIBAR_RECT_HALO, ESCAPE(float)),
+    GE_PARAMS_MEMBER_ENTRY(AIBAR_RECT_HALO_PROGRESS, AIBAR_RECT_HALO, ESCAPE(float)),
+    GE_PARAMS_MEMBER_CAST_ENTRY(COLOR_GRADIENT_EFFECT_COLORS0, COLOR_GRADIENT_EFFECT, ESCAPE(Vector4f),
+        ESCAPE(Drawing::Color4f)),
+    GE_PARAMS_MEMBER_CAST_ENTRY(COLOR_GRADIENT_EFFECT_COLORS1, COLOR_GRADIENT_EFFECT, ESCAPE(Vector4f),
+        ESCAPE(Drawing::Color4f)),
+    GE_PARAMS_MEMBER_CAST_ENTRY(COLOR_GRADIENT_EFFECT_COLORS2, COLOR_GRADIENT_EFFECT, ESCAPE(Vector4f),
+        ESCAPE(Drawing::Color4f)),
+    GE_PARAMS_MEMBER_CAST_ENTRY(COLOR_GRADIENT_EFFECT_COLORS3, COLOR_GRADIENT_EFFECT, ESCAPE(Vector4f),
+        ESCAPE(Drawing::Color4f)),
+    GE_PARAMS_MEMBER_CAST_ENTRY(COLOR_GRADIENT_EFFECT_COLORS4, COLOR_GRADIENT_EFFECT, ESCAPE(Vector4f),
+        ESCAPE(Drawing::Color4f)),
+    GE_PARAMS_MEMBER_CAST_ENTRY(COLOR_GRADIENT_EFFECT_COLORS5, COLOR_GRADIENT_EFFECT, ESCAPE(Vector4f),
+        ESCAPE(Drawing::Color4f)),
+    GE_PARAMS_MEMBER_CAST_ENTRY(COLOR_GRADIENT_EFFECT_COLORS6, COLOR_GRADIENT_EFFECT, ESCAPE(Vector4f),
+        ESCAPE(Drawing::Color4f)),
+    GE_PARAMS_MEMBER_CAST_ENTRY(COLOR_GRADIENT_EFFECT_COLORS7, COLOR_GRADIENT_EFFECT, ESCAPE(Vector4f),
+        ESCAPE(Drawing::Color4f)),
+    GE_PARAMS_MEMBER_CAST_ENTRY(COLOR_GRADIENT_EFFECT_COLORS8, COLOR_GRADIENT_EFFECT, ESCAPE(Vector4f),
+        ESCAPE(Drawing::Color4f)),
+    GE_PARAMS_MEMBER_CAST_ENTRY(COLOR_GRADIENT_EFFECT_COLORS9, COLOR_GRADIENT_EFFECT, ESCAPE(Vector4f),
+        ESCAPE(Drawing::Color4f)),
+    GE_PARAMS_MEMBER_CAST_ENTRY(COLOR_GRADIENT_EFFECT_COLORS10, COLOR_GRADIENT_EFFECT, ESCAPE(Vector4f),
+        ESCAPE(Drawing::Color4f)),
+    GE_PARAMS_MEMBER_CAST_ENTRY(COLOR_GRADIENT_EFFECT_COLORS11, COLOR_GRADIENT_EFFECT, ESCAPE(Vector4f),
+        ESCAPE(Drawing::Color4f)),
+    GE_PARAMS_MEMBER_CAST_ENTRY(COLOR_GRADIENT_EFFECT_POSITIONS0, COLOR_GRADIENT_EFFECT,
+        ESCAPE(std::pair<float, float>), ESCAPE(Drawing::Point)),
+    GE_PARAMS_MEMBER_CAST_ENTRY(COLOR_GRADIENT_EFFECT_POSITIONS1, COLOR_GRADIENT_EFFECT,
+        ESCAPE(std::pair<float, float>), ESCAPE(Drawing::Point)),
+    GE_PARAMS_MEMBER_CAST_ENTRY(COLOR_GRADIENT_EFFECT_POSITIONS2, COLOR_GRADIENT_EFFECT,
+        ESCAPE(std::pair<float, float>), ESCAPE(Drawing::Point)),
+    GE_PARAMS_MEMBER_CAST_ENTRY(COLOR_GRADIENT_EFFECT_POSITIONS3, COLOR_GRADIENT_EFFECT,
+        ESCAPE(std::pair<float, float>), ESCAPE(Drawing::Point)),
+    GE_PARAMS_MEMBER_CAST_ENTRY(COLOR_GRADIENT_EFFECT_POSITIONS4, COLOR_GRADIENT_EFFECT,
+        ESCAPE(std::pair<float, float>), ESCAPE(Drawing::Point)),
+    GE_PARAMS_MEMBER_CAST_ENTRY(COLOR_GRADIENT_EFFECT_POSITIONS5, COLOR_GRADIENT_EFFECT,
+        ESCAPE(std::pair<float, float>), ESCAPE(Drawing::Point)),
+    GE_PARAMS_MEMBER_CAST_ENTRY(COLOR_GRADIENT_EFFECT_POSITIONS6, COLOR_GRADIENT_EFFECT,
+        ESCAPE(std::pair<float, float>), ESCAPE(Drawing::Point)),
+    GE_PARAMS_MEMBER_CAST_ENTRY(COLOR_GRADIENT_EFFECT_POSITIONS7, COLOR_GRADIENT_EFFECT,
+        ESCAPE(std::pair<float, float>), ESCAPE(Drawing::Point)),
+    GE_PARAMS_MEMBER_CAST_ENTRY(COLOR_GRADIENT_EFFECT_POSITIONS8, COLOR_GRADIENT_EFFECT,
+        ESCAPE(std::pair<float, float>), ESCAPE(Drawing::Point)),
+    GE_PARAMS_MEMBER_CAST_ENTRY(COLOR_GRADIENT_EFFECT_POSITIONS9, COLOR_GRADIENT_EFFECT,
+        ESCAPE(std::pair<float, float>), ESCAPE(Drawing::Point)),
+    GE_PARAMS_MEMBER_CAST_ENTRY(COLOR_GRADIENT_EFFECT_POSITIONS10, COLOR_GRADIENT_EFFECT,
+        ESCAPE(std::pair<float, float>), ESCAPE(Drawing::Point)),
+    GE_PARAMS_MEMBER_CAST_ENTRY(COLOR_GRADIENT_EFFECT_POSITIONS11, COLOR_GRADIENT_EFFECT,
+        ESCAPE(std::pair<float, float>), ESCAPE(Drawing::Point)),
+    GE_PARAMS_MEMBER_ENTRY(COLOR_GRADIENT_EFFECT_STRENGTHS0, COLOR_GRADIENT_EFFECT, ESCAPE(float)),
+    GE_PARAMS_MEMBER_ENTRY(COLOR_GRADIENT_EFFECT_STRENGTHS1, COLOR_GRADIENT_EFFECT, ESCAPE(float)),
+    GE_PARAMS_MEMBER_ENTRY(COLOR_GRADIENT_EFFECT_STRENGTHS2, COLOR_GRADIENT_EFFECT, ESCAPE(float)),
+    GE_PARAMS_MEMBER_ENTRY(COLOR_GRADIENT_EFFECT_STRENGTHS3, COLOR_GRADIENT_EFFECT, ESCAPE(float)),
+    GE_PARAMS_MEMBER_ENTRY(COLOR_GRADIENT_EFFECT_STRENGTHS4, COLOR_GRADIENT_EFFECT, ESCAPE(float)),
+    GE_PARAMS_MEMBER_ENTRY(COLOR_GRADIENT_EFFECT_STRENGTHS5, COLOR_GRADIENT_EFFECT, ESCAPE(float)),
+    GE_PARAMS_MEMBER_ENTRY(COLOR_GRADIENT_EFFECT_STRENGTHS6, COLOR_GRADIENT_EFFECT, ESCAPE(float)),
+    GE_PARAMS_MEMBER_ENTRY(COLOR_GRADIENT_EFFECT_STRENGTHS7, COLOR_GRADIENT_EFFECT, ESCAPE(float)),
+    GE_PARAMS_MEMBER_ENTRY(COLOR_GRADIENT_EFFECT_STRENGTHS8, COLOR_GRADIENT_EFFECT, ESCAPE(float)),
+    GE_PARAMS_MEMBER_ENTRY(COLOR_GRADIENT_EFFECT_STRENGTHS9, COLOR_GRADIENT_EFFECT, ESCAPE(float)),
+    GE_PARAMS_MEMBER_ENTRY(COLOR_GRADIENT_EFFECT_STRENGTHS10, COLOR_GRADIENT_EFFECT, ESCAPE(float)),
+    GE_PARAMS_MEMBER_ENTRY(COLOR_GRADIENT_EFFECT_STRENGTHS11, COLOR_GRADIENT_EFFECT, ESCAPE(float)),
+    GE_PARAMS_MEMBER_ENTRY(COLOR_GRADIENT_EFFECT_COLOR_NUM, COLOR_GRADIENT_EFFECT, ESCAPE(float)),
+    GE_PARAMS_MEMBER_ENTRY(COLOR_GRADIENT_EFFECT_BLEND, COLOR_GRADIENT_EFFECT, ESCAPE(float)),
+    GE_PARAMS_MEMBER_ENTRY(COLOR_GRADIENT_EFFECT_BLENDK, COLOR_GRADIENT_EFFECT, ESCAPE(float)),
+    GE_PARAMS_MEMBER_ENTRY(COLOR_GRADIENT_EFFECT_MASK, COLOR_GRADIENT_EFFECT, ESCAPE(std::shared_ptr<GEShaderMask>)),
+    GE_PARAMS_MEMBER_ENTRY(COLOR_GRADIENT_EFFECT_BRIGHTNESS, COLOR_GRADIENT_EFFECT, ESCAPE(float)),
+    GE_PARAMS_MEMBER_ENTRY(DISTORT_CHROMA_PROGRESS, DISTORT_CHROMA, ESCAPE(float)),
+    GE_PARAMS_MEMBER_ENTRY(DISTORT_CHROMA_TURBULENT_MASK, DISTORT_CHROMA, ESCAPE(std::shared_ptr<GEShaderMask>)),
+    GE_PARAMS_MEMBER_ENTRY(DISTORT_CHROMA_FREQUENCY, DISTORT_CHROMA, ESCAPE(float)),
+    GE_PARAMS_MEMBER_ENTRY(DISTORT_CHROMA_SHARPNESS, DISTORT_CHROMA, ESCAPE(float)),
+    GE_PARAMS_MEMBER_ENTRY(DISTORT_CHROMA_BRIGHTNESS, DISTORT_CHROMA, ESCAPE(float)),
+    GE_PARAMS_MEMBER_ENTRY(DISTORT_CHROMA_DISPERSION, DISTORT_CHROMA, ESCAPE(float)),
+    GE_PARAMS_MEMBER_ENTRY(DISTORT_CHROMA_SATURATION, DISTORT_CHROMA, ESCAPE(float)),
+    GE_PARAMS_MEMBER_ENTRY(DISTORT_CHROMA_VERTICAL_MOVE_DISTANCE, DISTORT_CHROMA, ESCAPE(float)),
+    GE_PARAMS_MEMBER_CAST_ENTRY(DISTORT_CHROMA_GRANULARITY, DISTORT_CHROMA, ESCAPE(std::pair<float, float>),
+        ESCAPE(Vector2f)),
+    GE_PARAMS_MEMBER_CAST_ENTRY(DISTORT_CHROMA_DISTORT_FACTOR, DISTORT_CHROMA, ESCAPE(std::pair<float, float>),
+        ESCAPE(Vector2f)),
+    GE_PARAMS_MEMBER_ENTRY(DISTORT_CHROMA_COLOR_STRENGTH, DISTORT_CHROMA, ESCAPE(Vector3f)),
+    GE_PARAMS_MEMBER_ENTRY(DISTORT_CHROMA_MASK, DISTORT_CHROMA, ESCAPE(std::shared_ptr<GEShaderMask>)),
+    GE_PARAMS_MEMBER_ENTRY(DUPOLI_NOISE_MASK_PROGRESS, DUPOLI_NOISE_MASK, ESCAPE(float)),
+    GE_PARAMS_MEMBER_ENTRY(DUPOLI_NOISE_MASK_GRANULARITY, DUPOLI_NOISE_MASK, ESCAPE(float)),
+    GE_PARAMS_MEMBER_ENTRY(DUPOLI_NOISE_MASK_VERTICAL_MOVE_DISTANCE, DUPOLI_NOISE_MASK, ESCAPE(float)),
+    GE_PARAMS_MEMBER_ENTRY(GRADIENT_FLOW_COLORS_COLORS0, GRADIENT_FLOW_COLORS, ESCAPE(Vector4f)),
+    GE_PARAMS_MEMBER_ENTRY(GRADIENT_FLOW_COLORS_COLORS1, GRADIENT_FLOW_COLORS, ESCAPE(Vector4f)),
+    GE_PARAMS_MEMBER_ENTRY(GRADIENT_FLOW_COLORS_COLORS2, GRADIENT_FLOW_COLORS, ESCAPE(Vector4f)),
+    GE_PARAMS_MEMBER_ENTRY(GRADIENT_FLOW_COLORS_COLORS3, GRADIENT_FLOW_COLORS, ESCAPE(Vector4f)),
+    GE_PARAMS_MEMBER_ENTRY(GRADIENT_FLOW_COLORS_GRADIENT_BEGIN, GRADIENT_FLOW_COLORS, ESCAPE(float)),
+    GE_PARAMS_MEMBER_ENTRY(GRADIENT_FLOW_COLORS_GRADIENT_END, GRADIENT_FLOW_COLORS, ESCAPE(float)),
+    GE_PARAMS_MEMBER_ENTRY(GRADIENT_FLOW_COLORS_EFFECT_ALPHA, GRADIENT_FLOW_COLORS, ESCAPE(float)),
+    GE_PARAMS_MEMBER_ENTRY(GRADIENT_FLOW_COLORS_PROGRESS, GRADIENT_FLOW_COLORS, ESCAPE(float)),
+    GE_PARAMS_MEMBER_ENTRY(LIGHT_CAVE_COLOR_A, LIGHT_CAVE, ESCAPE(Vector4f)),
+    GE_PARAMS_MEMBER_ENTRY(LIGHT_CAVE_COLOR_B, LIGHT_CAVE, ESCAPE(Vector4f)),
+    GE_PARAMS_MEMBER_ENTRY(LIGHT_CAVE_COLOR_C, LIGHT_CAVE, ESCAPE(Vector4f)),
+    GE_PARAMS_MEMBER_CAST_ENTRY(LIGHT_CAVE_POSITION, LIGHT_CAVE, ESCAPE(std::pair<float, float>), ESCAPE(Vector2f)),
+    GE_PARAMS_MEMBER_CAST_ENTRY(LIGHT_CAVE_RADIUS_X_Y, LIGHT_CAVE, ESCAPE(std::pair<float, float>), ESCAPE(Vector2f)),
+    GE_PARAMS_MEMBER_ENTRY(LIGHT_CAVE_PROGRESS, LIGHT_CAVE, ESCAPE(float)),
+    GE_PARAMS_MEMBER_ENTRY(NOISY_FRAME_GRADIENT_MASK_GRADIENT_BEZIER_CONTROL_POINTS, NOISY_FRAME_GRADIENT_MASK,
+        ESCAPE(Vector4f)),
+    GE_PARAMS_MEMBER_ENTRY(NOISY_FRAME_GRADIENT_MASK_CORNER_RADIUS, NOISY_FRAME_GRADIENT_MASK, ESCAPE(float)),
+    GE_PARAMS_MEMBER_ENTRY(NOISY_FRAME_GRADIENT_MASK_INNER_FRAME_WIDTH, NOISY_FRAME_GRADIENT_MASK,
+        ESCAPE(std::pair<float, float>)),
+    GE_PARAMS_MEMBER_ENTRY(NOISY_FRAME_GRADIENT_MASK_MIDDLE_FRAME_WIDTH, NOISY_FRAME_GRADIENT_MASK,
+        ESCAPE(std::pair<float, float>)),
+    GE_PARAMS_MEMBER_ENTRY(NOISY_FRAME_GRADIENT_MASK_OUTSIDE_FRAME_WIDTH, NOISY_FRAME_GRADIENT_MASK,
+        ESCAPE(std::pair<float, float>)),
+    GE_PARAMS_MEMBER_ENTRY(NOISY_FRAME_GRADIENT_MASK_R_RECT_W_H, NOISY_FRAME_GRADIENT_MASK,
+        ESCAPE(std::pair<float, float>)),
+    GE_PARAMS_MEMBER_ENTRY(NOISY_FRAME_GRADIENT_MASK_R_RECT_POS, NOISY_FRAME_GRADIENT_MASK,
+        ESCAPE(std::pair<float, float>)),
+    GE_PARAMS_MEMBER_ENTRY(NOISY_FRAME_GRADIENT_MASK_SLOPE, NOISY_FRAME_GRADIENT_MASK, ESCAPE(float)),
+    GE_PARAMS_MEMBER_ENTRY(NOISY_FRAME_GRADIENT_MASK_PROGRESS, NOISY_FRAME_GRADIENT_MASK, ESCAPE(float)),
+    GE_PARAMS_MEMBER_ENTRY(ROUNDED_RECT_FLOWLIGHT_START_END_POSITION, ROUNDED_RECT_FLOWLIGHT,
+        ESCAPE(std::pair<float, float>)),
+    GE_PARAMS_MEMBER_ENTRY(ROUNDED_RECT_FLOWLIGHT_WAVE_LENGTH, ROUNDED_RECT_FLOWLIGHT, ESCAPE(float)),
+    GE_PARAMS_MEMBER_ENTRY(ROUNDED_RECT_FLOWLIGHT_WAVE_TOP, ROUNDED_RECT_FLOWLIGHT, ESCAPE(float)),
+    GE_PARAMS_MEMBER_ENTRY(ROUNDED_RECT_FLOWLIGHT_CORNER_RADIUS, ROUNDED_RECT_FLOWLIGHT, ESCAPE(float)),
+    GE_PARAMS_MEMBER_ENTRY(ROUNDED_RECT_FLOWLIGHT_BRIGHTNESS, ROUNDED_RECT_FLOWLIGHT, ESCAPE(float)),
+    GE_PARAMS_MEMBER_ENTRY(ROUNDED_RECT_FLOWLIGHT_SCALE, ROUNDED_RECT_FLOWLIGHT, ESCAPE(float)),
+    GE_PARAMS_MEMBER_ENTRY(ROUNDED_RECT_FLOWLIGHT_SHARPING, ROUNDED_RECT_FLOWLIGHT, ESCAPE(float)),
+    GE_PARAMS_MEMBER_ENTRY(ROUNDED_RECT_FLOWLIGHT_FEATHERING, ROUNDED_RECT_FLOWLIGHT, ESCAPE(float)),
+    GE_PARAMS_MEMBER_ENTRY(ROUNDED_RECT_FLOWLIGHT_FEATHERING_BEZIER_CONTROL_POINTS, ROUNDED_RECT_FLOWLIGHT,
+        ESCAPE(Vector4f)),
+    GE_PARAMS_MEMBER_ENTRY(ROUNDED_RECT_FLOWLIGHT_GRADIENT_BEZIER_CONTROL_POINTS, ROUNDED_RECT_FLOWLIGHT,
+        ESCAPE(Vector4f)),
+    GE_PARAMS_MEMBER_ENTRY(ROUNDED_RECT_FLOWLIGHT_COLOR, ROUNDED_RECT_FLOWLIGHT, ESCAPE(Vector4f)),
+    GE_PARAMS_MEMBER_ENTRY(ROUNDED_RECT_FLOWLIGHT_PROGRESS, ROUNDED_RECT_FLOWLIGHT, ESCAPE(float)),
+};
+
+#undef GE_PARAMS_MEMBER_ENTRY
+#undef GE_PARAMS_MEMBER_CAST_ENTRY
+#undef GE_PARAMS_MEMBER_BLOCKED_ENTRY
+
+static_assert(std::size(MEMBER_TABLE) == static_cast<size_t>(GEParamsMemberTag::ROUNDED_RECT_FLOWLIGHT_PROGRESS) + 1,
+    "MEMBER_TABLE must have one entry per GEParamsMemberTag");
+
+void SetMemberByKind(GEFilterParams& params, GEParamsMemberTag tag, uint8_t kind, const void* value)
+{
+    const auto index = static_cast<size_t>(tag);
+    if (index >= std::size(MEMBER_TABLE) || MEMBER_TABLE[index].filterType != params.GetType()) {
+        GE_LOGE("SetParamsMemberByTag: tag %{public}u not valid for params type %{public}u",
+            static_cast<uint32_t>(tag), static_cast<uint32_t>(params.GetType()));
+        return;
     }
+    const auto& entry = MEMBER_TABLE[index];
+    if (entry.valueKind == kind) {
+        entry.valueSetter(params, value);
+    } else if (entry.fieldKind == kind) {
+        entry.fieldSetter(params, value);
+    } else {
+        GE_LOGE("SetParamsMemberByTag: tag %{public}u does not take value kind %{public}u",
+            static_cast<uint32_t>(tag), static_cast<uint32_t>(kind));
+    }
+}
+} // namespace
+
+GEFilterType GEParamsMemberHelper::GetFilterTypeFromTag(GEParamsMemberTag tag)
+{
+    const auto index = static_cast<size_t>(tag);
+    return index < std::size(MEMBER_TABLE) ? MEMBER_TABLE[index].filterType : GEFilterType::NONE;
 }
 
-#undef GE_GET_FILTER_TYPE_CASE
+bool GEParamsBuilder::Hash(const GEFilterParams& params, uint64_t& hash)
+{
+    // The tags of one params type are contiguous, in declaration order
+    size_t first = 0;
+    size_t last = 0;
+    switch (params.GetType()) {
+#define GE_HASH_PARAMS_CASE(EnumType, FirstTag, LastTag)          \
+    case GEFilterType::EnumType:                                  \
+        first = static_cast<size_t>(GEParamsMemberTag::FirstTag); \
+        last = static_cast<size_t>(GEParamsMemberTag::LastTag);   \
+        break;
+
+        GE_HASH_PARAMS_CASE(AIBAR, AIBAR_AI_BAR_LOW, AIBAR_AI_BAR_SATURATION)
+        GE_HASH_PARAMS_CASE(AURORA_NOISE, AURORA_NOISE_NOISE, AURORA_NOISE_FREQ_Y)
+        GE_HASH_PARAMS_CASE(BEZIER_WARP, BEZIER_WARP_DESTINATION_PATCH, BEZIER_WARP_DESTINATION_PATCH11)
+        GE_HASH_PARAMS_CASE(BLUR_BUBBLES_RISE, BLUR_BUBBLES_RISE_BLUR_INTENSITY, BLUR_BUBBLES_RISE_MASK_IMAGE)
+        GE_HASH_PARAMS_CASE(BLUR, BLUR_RADIUS_X, BLUR_EXPAND_DRAW_REGION)
+        GE_HASH_PARAMS_CASE(BORDER_LIGHT, BORDER_LIGHT_POSITION, BORDER_LIGHT_CORNER_RADIUS)
+        GE_HASH_PARAMS_CASE(BORDER_SDF_LG_COLOR, BORDER_SDF_LG_COLOR_ANGLE, BORDER_SDF_LG_COLOR_SHAPE)
+        GE_HASH_PARAMS_CASE(BORDER_SDF_SHADER, BORDER_SDF_SHADER_COLOR, BORDER_SDF_SHADER_SHAPE)
+        GE_HASH_PARAMS_CASE(CIRCLE_FLOWLIGHT, CIRCLE_FLOWLIGHT_COLORS0, CIRCLE_FLOWLIGHT_MASK)
+        GE_HASH_PARAMS_CASE(COLOR_GRADIENT, COLOR_GRADIENT_COLORS, COLOR_GRADIENT_MASK)
+        GE_HASH_PARAMS_CASE(CONTENT_LIGHT, CONTENT_LIGHT_POSITION, CONTENT_LIGHT_ROTATION_ANGLE)
+        GE_HASH_PARAMS_CASE(CONTOUR_DIAGONAL_FLOW_LIGHT, CONTOUR_DIAGONAL_FLOW_LIGHT_CONTOUR,
+            CONTOUR_DIAGONAL_FLOW_LIGHT_HALO_WEIGHT)
+        GE_HASH_PARAMS_CASE(DEPTH_OCCLUSION, DEPTH_OCCLUSION_DEPTH_PLANE, DEPTH_OCCLUSION_IS_REVERSE)
+        GE_HASH_PARAMS_CASE(DIRECTION_LIGHT, DIRECTION_LIGHT_MASK, DIRECTION_LIGHT_LIGHT_INTENSITY)
+        GE_HASH_PARAMS_CASE(DISPERSION, DISPERSION_MASK, DISPERSION_BLUE_OFFSET)
+        GE_HASH_PARAMS_CASE(DISPLACEMENT_DISTORT_FILTER, DISPLACEMENT_DISTORT_FILTER_FACTOR,
+            DISPLACEMENT_DISTORT_FILTER_MASK)
+        GE_HASH_PARAMS_CASE(DISTORTION_COLLAPSE, DISTORTION_COLLAPSE_L_U_CORNER, DISTORTION_COLLAPSE_BARREL_DISTORTION)
+        GE_HASH_PARAMS_CASE(DOT_MATRIX, DOT_MATRIX_PATH_DIRECTION, DOT_MATRIX_PROGRESS)
+        GE_HASH_PARAMS_CASE(DOUBLE_RIPPLE_MASK, DOUBLE_RIPPLE_MASK_CENTER1, DOUBLE_RIPPLE_MASK_HALO_THICKNESS)
+        GE_HASH_PARAMS_CASE(EDGE_LIGHT, EDGE_LIGHT_ALPHA, EDGE_LIGHT_USE_RAW_COLOR)
+        GE_HASH_PARAMS_CASE(FRAME_GRADIENT_MASK, FRAME_GRADIENT_MASK_INNER_BEZIER, FRAME_GRADIENT_MASK_BOX_ANGLE_DEG)
+        GE_HASH_PARAMS_CASE(FROSTED_GLASS_BLUR, FROSTED_GLASS_BLUR_RADIUS, FROSTED_GLASS_BLUR_REFRACT_OUT_PX)
+        GE_HASH_PARAMS_CASE(FROSTED_GLASS_EFFECT, FROSTED_GLASS_EFFECT_WEIGHTS_EMBOSS,
+            FROSTED_GLASS_EFFECT_ENABLE_S_D_F_CACHE)
+        GE_HASH_PARAMS_CASE(FROSTED_GLASS, FROSTED_GLASS_BLUR_PARAMS, FROSTED_GLASS_MATERIAL_COLOR)
+        GE_HASH_PARAMS_CASE(GASIFY_BLUR, GASIFY_BLUR_SOURCE_IMAGE, GASIFY_BLUR_PROGRESS)
+        GE_HASH_PARAMS_CASE(GASIFY, GASIFY_SOURCE_IMAGE, GASIFY_PROGRESS)
+        GE_HASH_PARAMS_CASE(GASIFY_SCALE_TWIST, GASIFY_SCALE_TWIST_SCALE, GASIFY_SCALE_TWIST_PROGRESS)
+        GE_HASH_PARAMS_CASE(GREY, GREY_GREY_COEF1, GREY_GREY_COEF2)
+        GE_HASH_PARAMS_CASE(GRID_WARP, GRID_WARP_GRID_POINTS0, GRID_WARP_ROTATION_ANGLES8)
+        GE_HASH_PARAMS_CASE(HARMONIUM_EFFECT, HARMONIUM_EFFECT_MASK, HARMONIUM_EFFECT_TOTAL_MATRIX)
+        GE_HASH_PARAMS_CASE(HEAT_DISTORTION, HEAT_DISTORTION_INTENSITY, HEAT_DISTORTION_PROGRESS)
+        GE_HASH_PARAMS_CASE(IMAGE_MASK, IMAGE_MASK_IMAGE, IMAGE_MASK_IMAGE)
+        GE_HASH_PARAMS_CASE(KAWASE_BLUR, KAWASE_BLUR_RADIUS, KAWASE_BLUR_RADIUS)
+        GE_HASH_PARAMS_CASE(LINEAR_GRADIENT_BLUR, LINEAR_GRADIENT_BLUR_BLUR_RADIUS,
+            LINEAR_GRADIENT_BLUR_IS_RADIUS_GRADIENT)
+        GE_HASH_PARAMS_CASE(LINEAR_GRADIENT_MASK, LINEAR_GRADIENT_MASK_FRACTION_STOPS,
+            LINEAR_GRADIENT_MASK_END_POSITION)
+        GE_HASH_PARAMS_CASE(MAGNIFIER, MAGNIFIER_FACTOR, MAGNIFIER_SDF_SHAPE)
+        GE_HASH_PARAMS_CASE(MAP_COLOR_BY_BRIGHTNESS, MAP_COLOR_BY_BRIGHTNESS_COLORS, MAP_COLOR_BY_BRIGHTNESS_POSITIONS)
+        GE_HASH_PARAMS_CASE(MASK_TRANSITION, MASK_TRANSITION_MASK, MASK_TRANSITION_INVERSE)
+        GE_HASH_PARAMS_CASE(MESA_BLUR, MESA_BLUR_RADIUS, MESA_BLUR_ANGLE)
+        GE_HASH_PARAMS_CASE(MOTION_BLUR, MOTION_BLUR_RADIUS, MOTION_BLUR_MODE)
+        GE_HASH_PARAMS_CASE(PARTICLE_ABLATION, PARTICLE_ABLATION_PROGRESS, PARTICLE_ABLATION_EXPANSION_SIZE)
+        GE_HASH_PARAMS_CASE(PARTICLE_CIRCULAR_HALO, PARTICLE_CIRCULAR_HALO_CENTER, PARTICLE_CIRCULAR_HALO_NOISE)
+        GE_HASH_PARAMS_CASE(PIXEL_MAP_MASK, PIXEL_MAP_MASK_IMAGE, PIXEL_MAP_MASK_FILL_COLOR)
+        GE_HASH_PARAMS_CASE(RADIAL_GRADIENT_MASK, RADIAL_GRADIENT_MASK_CENTER, RADIAL_GRADIENT_MASK_POSITIONS)
+        GE_HASH_PARAMS_CASE(RIPPLE_MASK, RIPPLE_MASK_CENTER, RIPPLE_MASK_WIDTH_CENTER_OFFSET)
+        GE_HASH_PARAMS_CASE(SDF_BORDER, SDF_BORDER_SHAPE, SDF_BORDER_BORDER)
+        GE_HASH_PARAMS_CASE(SDF_CLIP, SDF_CLIP_SHAPE, SDF_CLIP_SHAPE)
+        GE_HASH_PARAMS_CASE(SDF_COLOR, SDF_COLOR_SHAPE, SDF_COLOR_COLOR)
+        GE_HASH_PARAMS_CASE(SDF_DISTORT_OP_SHAPE, SDF_DISTORT_OP_SHAPE_SHAPE, SDF_DISTORT_OP_SHAPE_BARREL_DISTORTION)
+        GE_HASH_PARAMS_CASE(SDF_EDGE_LIGHT_EFFECT, SDF_EDGE_LIGHT_EFFECT_SDF_SPREAD_FACTOR,
+            SDF_EDGE_LIGHT_EFFECT_SDF_SHAPE)
+        GE_HASH_PARAMS_CASE(SDF_EDGE_LIGHT, SDF_EDGE_LIGHT_SDF_SPREAD_FACTOR, SDF_EDGE_LIGHT_SDF_SHAPE)
+        GE_HASH_PARAMS_CASE(SDF_ELLIPSE_SHAPE, SDF_ELLIPSE_SHAPE_CENTER, SDF_ELLIPSE_SHAPE_HEIGHT)
+        GE_HASH_PARAMS_CASE(SDF_FROM_IMAGE, SDF_FROM_IMAGE_SPREAD_FACTOR, SDF_FROM_IMAGE_GENERATE_DERIVS)
+        GE_HASH_PARAMS_CASE(SDF_PATH_SHAPE, SDF_PATH_SHAPE_PATH, SDF_PATH_SHAPE_SCALE)
+        GE_HASH_PARAMS_CASE(SDF_PIXELMAP_SHAPE, SDF_PIXELMAP_SHAPE_IMAGE, SDF_PIXELMAP_SHAPE_IMAGE)
+        GE_HASH_PARAMS_CASE(SDF_RRECT_SHAPE, SDF_RRECT_SHAPE_RRECT, SDF_RRECT_SHAPE_RRECT)
+        GE_HASH_PARAMS_CASE(SDF_SHADOW, SDF_SHADOW_SHAPE, SDF_SHADOW_SHADOW)
+        GE_HASH_PARAMS_CASE(SDF_SMOOTH_SUB_OP_SHAPE, SDF_SMOOTH_SUB_OP_SHAPE_SPACING, SDF_SMOOTH_SUB_OP_SHAPE_RIGHT)
+        GE_HASH_PARAMS_CASE(SDF_SUB_OP_SHAPE, SDF_SUB_OP_SHAPE_LEFT, SDF_SUB_OP_SHAPE_RIGHT)
+        GE_HASH_PARAMS_CASE(SDF_TRANSFORM_SHAPE, SDF_TRANSFORM_SHAPE_SHAPE, SDF_TRANSFORM_SHAPE_CENTER_POSITION)
+        GE_HASH_PARAMS_CASE(SDF_TRIANGLE_SHAPE, SDF_TRIANGLE_SHAPE_VERTEX0, SDF_TRIANGLE_SHAPE_RADIUS)
+        GE_HASH_PARAMS_CASE(SDF_UNION_OP, SDF_UNION_OP_SPACING, SDF_UNION_OP_OP)
+        GE_HASH_PARAMS_CASE(SOUND_WAVE, SOUND_WAVE_COLOR_A, SOUND_WAVE_SHOCK_WAVE_TOTAL_ALPHA)
+        GE_HASH_PARAMS_CASE(SPATIAL_GLASS_EFFECT, SPATIAL_GLASS_EFFECT_LEFT_TOP,
+            SPATIAL_GLASS_EFFECT_ENABLE_S_D_F_CACHE)
+        GE_HASH_PARAMS_CASE(SPATIAL_POINT_LIGHT, SPATIAL_POINT_LIGHT_LIGHT_INTENSITY, SPATIAL_POINT_LIGHT_MASK)
+        GE_HASH_PARAMS_CASE(USE_EFFECT_MASK, USE_EFFECT_MASK_IMAGE, USE_EFFECT_MASK_USE_EFFECT)
+        GE_HASH_PARAMS_CASE(VARIABLE_RADIUS_BLUR, VARIABLE_RADIUS_BLUR_MASK, VARIABLE_RADIUS_BLUR_MODE)
+        GE_HASH_PARAMS_CASE(WATER_DROPLET_TRANSITION, WATER_DROPLET_TRANSITION_TOP_LAYER,
+            WATER_DROPLET_TRANSITION_POSITION)
+        GE_HASH_PARAMS_CASE(WATER_RIPPLE, WATER_RIPPLE_PROGRESS, WATER_RIPPLE_RIPPLE_MODE)
+        GE_HASH_PARAMS_CASE(WAVE_DISTURBANCE_MASK, WAVE_DISTURBANCE_MASK_CLICK_POS, WAVE_DISTURBANCE_MASK_WAVE_L_W_H)
+        GE_HASH_PARAMS_CASE(WAVE_GRADIENT_MASK, WAVE_GRADIENT_MASK_CENTER, WAVE_GRADIENT_MASK_TURBULENCE_STRENGTH)
+        GE_HASH_PARAMS_CASE(WAVY_RIPPLE_LIGHT, WAVY_RIPPLE_LIGHT_CENTER, WAVY_RIPPLE_LIGHT_THICKNESS)
+        GE_HASH_PARAMS_CASE(AIBAR_GLOW, AIBAR_GLOW_L_T_W_H, AIBAR_GLOW_PROGRESS)
+        GE_HASH_PARAMS_CASE(AIBAR_RECT_HALO, AIBAR_RECT_HALO_L_T_W_H, AIBAR_RECT_HALO_PROGRESS)
+        GE_HASH_PARAMS_CASE(COLOR_GRADIENT_EFFECT, COLOR_GRADIENT_EFFECT_COLORS0, COLOR_GRADIENT_EFFECT_BRIGHTNESS)
+        GE_HASH_PARAMS_CASE(DISTORT_CHROMA, DISTORT_CHROMA_PROGRESS, DISTORT_CHROMA_MASK)
+        GE_HASH_PARAMS_CASE(DUPOLI_NOISE_MASK, DUPOLI_NOISE_MASK_PROGRESS, DUPOLI_NOISE_MASK_VERTICAL_MOVE_DISTANCE)
+        GE_HASH_PARAMS_CASE(GRADIENT_FLOW_COLORS, GRADIENT_FLOW_COLORS_COLORS0, GRADIENT_FLOW_COLORS_PROGRESS)
+        GE_HASH_PARAMS_CASE(LIGHT_CAVE, LIGHT_CAVE_COLOR_A, LIGHT_CAVE_PROGRESS)
+        GE_HASH_PARAMS_CASE(NOISY_FRAME_GRADIENT_MASK, NOISY_FRAME_GRADIENT_MASK_GRADIENT_BEZIER_CONTROL_POINTS,
+            NOISY_FRAME_GRADIENT_MASK_PROGRESS)
+        GE_HASH_PARAMS_CASE(ROUNDED_RECT_FLOWLIGHT, ROUNDED_RECT_FLOWLIGHT_START_END_POSITION,
+            ROUNDED_RECT_FLOWLIGHT_PROGRESS)
+        default:
+            return false;
+    }
+#undef GE_HASH_PARAMS_CASE
+
+    GEParamsHasher hasher;
+    hasher.Add(params.GetType());
+    for (size_t index = first; index <= last; ++index) {
+        if (MEMBER_TABLE[index].hasher == nullptr) {
+            return false;
+        }
+        MEMBER_TABLE[index].hasher(params, hasher);
+    }
+    if (!hasher.IsHashable()) {
+        return false;
+    }
+    hash = hasher.GetHash();
+    return true;
+}
 
 GEParamsMemberTag GEParamsMemberHelper::GEParamsMemberTagFromString(const std::string& str)
 {
@@ -1246,6 +1641,7 @@ GEParamsMemberTag GEParamsMemberHelper::GEParamsMemberTagFromString(const std::s
         GE_STRING_TO_TAG_ENTRY(MOTION_BLUR_RADIUS),
         GE_STRING_TO_TAG_ENTRY(MOTION_BLUR_ANCHOR),
         GE_STRING_TO_TAG_ENTRY(MOTION_BLUR_SAMPLE_COUNT),
+        GE_STRING_TO_TAG_ENTRY(MOTION_BLUR_MODE),
         GE_STRING_TO_TAG_ENTRY(PARTICLE_ABLATION_PROGRESS),
         GE_STRING_TO_TAG_ENTRY(PARTICLE_ABLATION_ABLATION_RATE),
         GE_STRING_TO_TAG_ENTRY(PARTICLE_ABLATION_CENTERS0),
@@ -1400,6 +1796,7 @@ GEParamsMemberTag GEParamsMemberHelper::GEParamsMemberTagFromString(const std::s
         GE_STRING_TO_TAG_ENTRY(VARIABLE_RADIUS_BLUR_MASK),
         GE_STRING_TO_TAG_ENTRY(VARIABLE_RADIUS_BLUR_BLUR_RADIUS),
         GE_STRING_TO_TAG_ENTRY(VARIABLE_RADIUS_BLUR_APPLY_INSIDE_MASK),
+        GE_STRING_TO_TAG_ENTRY(VARIABLE_RADIUS_BLUR_MODE),
         GE_STRING_TO_TAG_ENTRY(WATER_DROPLET_TRANSITION_TOP_LAYER),
         GE_STRING_TO_TAG_ENTRY(WATER_DROPLET_TRANSITION_INVERSE),
         GE_STRING_TO_TAG_ENTRY(WATER_DROPLET_TRANSITION_PROGRESS),
@@ -1560,1273 +1957,15 @@ GEParamsMemberTag GEParamsMemberHelper::GEParamsMemberTagFromString(const std::s
     return GEParamsMemberTag::INVALID;
 }
 
-// Helper macro to validate and set parameter
-#define GE_VALIDATE_AND_SET(Tag)                                                                                      \
-    case GEParamsMemberTag::Tag: {                                                                                    \
-        using ParamsType = GEParamsFieldAccessor<GEParamsMemberTag::Tag>::ParamsType;                                 \
-        using FieldType = GEParamsFieldAccessor<GEParamsMemberTag::Tag>::FieldType;                                   \
-        using SetterType = std::remove_cv_t<std::remove_reference_t<decltype(value)>>;                                \
-        auto unboxed = GEFilterParams::Unbox<ParamsType>(params);                                                     \
-        if (unboxed == nullptr) {                                                                                     \
-            return;                                                                                                   \
-        }                                                                                                             \
-        auto& actualParams = *unboxed;                                                                                \
-        FieldType transformed;                                                                                        \
-        if (GEParamsValueTransformer<GEParamsMemberTag::Tag, SetterType, FieldType>::Transform(value, transformed)) { \
-            GEParamsFieldAccessor<GEParamsMemberTag::Tag>::Set(actualParams, transformed);                            \
-        }                                                                                                             \
-        break;                                                                                                        \
-    }
-
-void GEParamsMemberHelper::SetParamsMemberByTag(
-    GEFilterParams& params, GEParamsMemberTag tag, const DotMatrixDirection& value)
-{
-    auto expectedFilterType = GetFilterTypeFromTag(tag);
-    if (params.GetType() != expectedFilterType) {
-        return;
-    }
-
-    switch (tag) {
-        GE_VALIDATE_AND_SET(DOT_MATRIX_PATH_DIRECTION)
-        default:
-            GE_LOGE("SetParamsMemberByTag<DotMatrixDirection>: No matching case for tag %{public}u (filter type "
-                    "%{public}u, params type %{public}u)",
-                static_cast<uint32_t>(tag), static_cast<uint32_t>(expectedFilterType),
-                static_cast<uint32_t>(params.GetType()));
-            break;
-    }
-}
-
-void GEParamsMemberHelper::SetParamsMemberByTag(
-    GEFilterParams& params, GEParamsMemberTag tag, const DotMatrixEffectType& value)
-{
-    auto expectedFilterType = GetFilterTypeFromTag(tag);
-    if (params.GetType() != expectedFilterType) {
-        return;
-    }
-
-    switch (tag) {
-        GE_VALIDATE_AND_SET(DOT_MATRIX_EFFECT_TYPE)
-        default:
-            GE_LOGE("SetParamsMemberByTag<DotMatrixEffectType>: No matching case for tag %{public}u (filter type "
-                    "%{public}u, params type %{public}u)",
-                static_cast<uint32_t>(tag), static_cast<uint32_t>(expectedFilterType),
-                static_cast<uint32_t>(params.GetType()));
-            break;
-    }
-}
-
-void GEParamsMemberHelper::SetParamsMemberByTag(
-    GEFilterParams& params, GEParamsMemberTag tag, const Drawing::Color4f& value)
-{
-    auto expectedFilterType = GetFilterTypeFromTag(tag);
-    if (params.GetType() != expectedFilterType) {
-        return;
-    }
-
-    switch (tag) {
-        GE_VALIDATE_AND_SET(SOUND_WAVE_COLOR_A)
-        GE_VALIDATE_AND_SET(SOUND_WAVE_COLOR_B)
-        GE_VALIDATE_AND_SET(SOUND_WAVE_COLOR_C)
-        GE_VALIDATE_AND_SET(COLOR_GRADIENT_EFFECT_COLORS0)
-        GE_VALIDATE_AND_SET(COLOR_GRADIENT_EFFECT_COLORS1)
-        GE_VALIDATE_AND_SET(COLOR_GRADIENT_EFFECT_COLORS2)
-        GE_VALIDATE_AND_SET(COLOR_GRADIENT_EFFECT_COLORS3)
-        GE_VALIDATE_AND_SET(COLOR_GRADIENT_EFFECT_COLORS4)
-        GE_VALIDATE_AND_SET(COLOR_GRADIENT_EFFECT_COLORS5)
-        GE_VALIDATE_AND_SET(COLOR_GRADIENT_EFFECT_COLORS6)
-        GE_VALIDATE_AND_SET(COLOR_GRADIENT_EFFECT_COLORS7)
-        GE_VALIDATE_AND_SET(COLOR_GRADIENT_EFFECT_COLORS8)
-        GE_VALIDATE_AND_SET(COLOR_GRADIENT_EFFECT_COLORS9)
-        GE_VALIDATE_AND_SET(COLOR_GRADIENT_EFFECT_COLORS10)
-        GE_VALIDATE_AND_SET(COLOR_GRADIENT_EFFECT_COLORS11)
-        default:
-            GE_LOGE("SetParamsMemberByTag<Drawing::Color4f>: No matching case for tag %{public}u (filter type "
-                    "%{public}u, params type %{public}u)",
-                static_cast<uint32_t>(tag), static_cast<uint32_t>(expectedFilterType),
-                static_cast<uint32_t>(params.GetType()));
-            break;
-    }
-}
-
-void GEParamsMemberHelper::SetParamsMemberByTag(
-    GEFilterParams& params, GEParamsMemberTag tag, const Drawing::Matrix& value)
-{
-    auto expectedFilterType = GetFilterTypeFromTag(tag);
-    if (params.GetType() != expectedFilterType) {
-        return;
-    }
-
-    switch (tag) {
-        GE_VALIDATE_AND_SET(DEPTH_OCCLUSION_MATRIX)
-        GE_VALIDATE_AND_SET(FROSTED_GLASS_EFFECT_SNAPSHOT_MATRIX)
-        GE_VALIDATE_AND_SET(HARMONIUM_EFFECT_TOTAL_MATRIX)
-        GE_VALIDATE_AND_SET(LINEAR_GRADIENT_BLUR_MAT)
-        GE_VALIDATE_AND_SET(SDF_TRANSFORM_SHAPE_MATRIX)
-        GE_VALIDATE_AND_SET(SPATIAL_GLASS_EFFECT_SNAPSHOT_MATRIX)
-        default:
-            GE_LOGE("SetParamsMemberByTag<Drawing::Matrix>: No matching case for tag %{public}u (filter type "
-                    "%{public}u, params type %{public}u)",
-                static_cast<uint32_t>(tag), static_cast<uint32_t>(expectedFilterType),
-                static_cast<uint32_t>(params.GetType()));
-            break;
-    }
-}
-
-void GEParamsMemberHelper::SetParamsMemberByTag(
-    GEFilterParams& params, GEParamsMemberTag tag, const Drawing::Path& value)
-{
-    auto expectedFilterType = GetFilterTypeFromTag(tag);
-    if (params.GetType() != expectedFilterType) {
-        return;
-    }
-
-    switch (tag) {
-        GE_VALIDATE_AND_SET(SDF_PATH_SHAPE_PATH)
-        default:
-            GE_LOGE("SetParamsMemberByTag<Drawing::Path>: No matching case for tag %{public}u (filter type %{public}u, "
-                    "params type %{public}u)",
-                static_cast<uint32_t>(tag), static_cast<uint32_t>(expectedFilterType),
-                static_cast<uint32_t>(params.GetType()));
-            break;
-    }
-}
-
-void GEParamsMemberHelper::SetParamsMemberByTag(
-    GEFilterParams& params, GEParamsMemberTag tag, const Drawing::Point& value)
-{
-    auto expectedFilterType = GetFilterTypeFromTag(tag);
-    if (params.GetType() != expectedFilterType) {
-        return;
-    }
-
-    switch (tag) {
-        GE_VALIDATE_AND_SET(BEZIER_WARP_DESTINATION_PATCH0)
-        GE_VALIDATE_AND_SET(BEZIER_WARP_DESTINATION_PATCH1)
-        GE_VALIDATE_AND_SET(BEZIER_WARP_DESTINATION_PATCH2)
-        GE_VALIDATE_AND_SET(BEZIER_WARP_DESTINATION_PATCH3)
-        GE_VALIDATE_AND_SET(BEZIER_WARP_DESTINATION_PATCH4)
-        GE_VALIDATE_AND_SET(BEZIER_WARP_DESTINATION_PATCH5)
-        GE_VALIDATE_AND_SET(BEZIER_WARP_DESTINATION_PATCH6)
-        GE_VALIDATE_AND_SET(BEZIER_WARP_DESTINATION_PATCH7)
-        GE_VALIDATE_AND_SET(BEZIER_WARP_DESTINATION_PATCH8)
-        GE_VALIDATE_AND_SET(BEZIER_WARP_DESTINATION_PATCH9)
-        GE_VALIDATE_AND_SET(BEZIER_WARP_DESTINATION_PATCH10)
-        GE_VALIDATE_AND_SET(BEZIER_WARP_DESTINATION_PATCH11)
-        GE_VALIDATE_AND_SET(DISTORTION_COLLAPSE_L_U_CORNER)
-        GE_VALIDATE_AND_SET(DISTORTION_COLLAPSE_R_U_CORNER)
-        GE_VALIDATE_AND_SET(DISTORTION_COLLAPSE_R_B_CORNER)
-        GE_VALIDATE_AND_SET(DISTORTION_COLLAPSE_L_B_CORNER)
-        GE_VALIDATE_AND_SET(LINEAR_GRADIENT_MASK_START_POSITION)
-        GE_VALIDATE_AND_SET(LINEAR_GRADIENT_MASK_END_POSITION)
-        GE_VALIDATE_AND_SET(SDF_DISTORT_OP_SHAPE_L_U_CORNER)
-        GE_VALIDATE_AND_SET(SDF_DISTORT_OP_SHAPE_R_U_CORNER)
-        GE_VALIDATE_AND_SET(SDF_DISTORT_OP_SHAPE_R_B_CORNER)
-        GE_VALIDATE_AND_SET(SDF_DISTORT_OP_SHAPE_L_B_CORNER)
-        GE_VALIDATE_AND_SET(COLOR_GRADIENT_EFFECT_POSITIONS0)
-        GE_VALIDATE_AND_SET(COLOR_GRADIENT_EFFECT_POSITIONS1)
-        GE_VALIDATE_AND_SET(COLOR_GRADIENT_EFFECT_POSITIONS2)
-        GE_VALIDATE_AND_SET(COLOR_GRADIENT_EFFECT_POSITIONS3)
-        GE_VALIDATE_AND_SET(COLOR_GRADIENT_EFFECT_POSITIONS4)
-        GE_VALIDATE_AND_SET(COLOR_GRADIENT_EFFECT_POSITIONS5)
-        GE_VALIDATE_AND_SET(COLOR_GRADIENT_EFFECT_POSITIONS6)
-        GE_VALIDATE_AND_SET(COLOR_GRADIENT_EFFECT_POSITIONS7)
-        GE_VALIDATE_AND_SET(COLOR_GRADIENT_EFFECT_POSITIONS8)
-        GE_VALIDATE_AND_SET(COLOR_GRADIENT_EFFECT_POSITIONS9)
-        GE_VALIDATE_AND_SET(COLOR_GRADIENT_EFFECT_POSITIONS10)
-        GE_VALIDATE_AND_SET(COLOR_GRADIENT_EFFECT_POSITIONS11)
-        default:
-            GE_LOGE("SetParamsMemberByTag<Drawing::Point>: No matching case for tag %{public}u (filter type "
-                    "%{public}u, params type %{public}u)",
-                static_cast<uint32_t>(tag), static_cast<uint32_t>(expectedFilterType),
-                static_cast<uint32_t>(params.GetType()));
-            break;
-    }
-}
-
-void GEParamsMemberHelper::SetParamsMemberByTag(
-    GEFilterParams& params, GEParamsMemberTag tag, const GEBezierWarpShaderFilterControlPointArray& value)
-{
-    auto expectedFilterType = GetFilterTypeFromTag(tag);
-    if (params.GetType() != expectedFilterType) {
-        return;
-    }
-
-    switch (tag) {
-        GE_VALIDATE_AND_SET(BEZIER_WARP_DESTINATION_PATCH)
-        default:
-            GE_LOGE("SetParamsMemberByTag<GEBezierWarpShaderFilterControlPointArray>: No matching case for tag "
-                    "%{public}u (filter type %{public}u, params type %{public}u)",
-                static_cast<uint32_t>(tag), static_cast<uint32_t>(expectedFilterType),
-                static_cast<uint32_t>(params.GetType()));
-            break;
-    }
-}
-
-void GEParamsMemberHelper::SetParamsMemberByTag(GEFilterParams& params, GEParamsMemberTag tag, const GERRect& value)
-{
-    auto expectedFilterType = GetFilterTypeFromTag(tag);
-    if (params.GetType() != expectedFilterType) {
-        return;
-    }
-
-    switch (tag) {
-        GE_VALIDATE_AND_SET(SDF_RRECT_SHAPE_RRECT)
-        default:
-            GE_LOGE("SetParamsMemberByTag<GERRect>: No matching case for tag %{public}u (filter type %{public}u, "
-                    "params type %{public}u)",
-                static_cast<uint32_t>(tag), static_cast<uint32_t>(expectedFilterType),
-                static_cast<uint32_t>(params.GetType()));
-            break;
-    }
-}
-
-void GEParamsMemberHelper::SetParamsMemberByTag(
-    GEFilterParams& params, GEParamsMemberTag tag, const GESDFBorderParams& value)
-{
-    auto expectedFilterType = GetFilterTypeFromTag(tag);
-    if (params.GetType() != expectedFilterType) {
-        return;
-    }
-
-    switch (tag) {
-        GE_VALIDATE_AND_SET(SDF_BORDER_BORDER)
-        default:
-            GE_LOGE("SetParamsMemberByTag<GESDFBorderParams>: No matching case for tag %{public}u (filter type "
-                    "%{public}u, params type %{public}u)",
-                static_cast<uint32_t>(tag), static_cast<uint32_t>(expectedFilterType),
-                static_cast<uint32_t>(params.GetType()));
-            break;
-    }
-}
-
-void GEParamsMemberHelper::SetParamsMemberByTag(
-    GEFilterParams& params, GEParamsMemberTag tag, const GESDFShadowParams& value)
-{
-    auto expectedFilterType = GetFilterTypeFromTag(tag);
-    if (params.GetType() != expectedFilterType) {
-        return;
-    }
-
-    switch (tag) {
-        GE_VALIDATE_AND_SET(SDF_SHADOW_SHADOW)
-        default:
-            GE_LOGE("SetParamsMemberByTag<GESDFShadowParams>: No matching case for tag %{public}u (filter type "
-                    "%{public}u, params type %{public}u)",
-                static_cast<uint32_t>(tag), static_cast<uint32_t>(expectedFilterType),
-                static_cast<uint32_t>(params.GetType()));
-            break;
-    }
-}
-
-void GEParamsMemberHelper::SetParamsMemberByTag(
-    GEFilterParams& params, GEParamsMemberTag tag, const GESDFUnionOp& value)
-{
-    auto expectedFilterType = GetFilterTypeFromTag(tag);
-    if (params.GetType() != expectedFilterType) {
-        return;
-    }
-
-    switch (tag) {
-        GE_VALIDATE_AND_SET(SDF_UNION_OP_OP)
-        default:
-            GE_LOGE("SetParamsMemberByTag<GESDFUnionOp>: No matching case for tag %{public}u (filter type %{public}u, "
-                    "params type %{public}u)",
-                static_cast<uint32_t>(tag), static_cast<uint32_t>(expectedFilterType),
-                static_cast<uint32_t>(params.GetType()));
-            break;
-    }
-}
-
-void GEParamsMemberHelper::SetParamsMemberByTag(GEFilterParams& params, GEParamsMemberTag tag, const RectF& value)
-{
-    auto expectedFilterType = GetFilterTypeFromTag(tag);
-    if (params.GetType() != expectedFilterType) {
-        return;
-    }
-
-    switch (tag) {
-        GE_VALIDATE_AND_SET(FROSTED_GLASS_EFFECT_SNAPSHOT_RECT)
-        GE_VALIDATE_AND_SET(PIXEL_MAP_MASK_SRC)
-        GE_VALIDATE_AND_SET(PIXEL_MAP_MASK_DST)
-        GE_VALIDATE_AND_SET(SPATIAL_GLASS_EFFECT_SNAPSHOT_RECT)
-        default:
-            GE_LOGE("SetParamsMemberByTag<RectF>: No matching case for tag %{public}u (filter type %{public}u, params "
-                    "type %{public}u)",
-                static_cast<uint32_t>(tag), static_cast<uint32_t>(expectedFilterType),
-                static_cast<uint32_t>(params.GetType()));
-            break;
-    }
-}
-
-void GEParamsMemberHelper::SetParamsMemberByTag(GEFilterParams& params, GEParamsMemberTag tag, const Vector2f& value)
-{
-    auto expectedFilterType = GetFilterTypeFromTag(tag);
-    if (params.GetType() != expectedFilterType) {
-        return;
-    }
-
-    switch (tag) {
-        GE_VALIDATE_AND_SET(DOT_MATRIX_COLOR_FRACTIONS)
-        GE_VALIDATE_AND_SET(FROSTED_GLASS_EFFECT_WEIGHTS_EMBOSS)
-        GE_VALIDATE_AND_SET(FROSTED_GLASS_EFFECT_WEIGHTS_EDL)
-        GE_VALIDATE_AND_SET(FROSTED_GLASS_EFFECT_ANTI_ALIAS)
-        GE_VALIDATE_AND_SET(FROSTED_GLASS_EFFECT_BG_RATES)
-        GE_VALIDATE_AND_SET(FROSTED_GLASS_EFFECT_SD_RATES)
-        GE_VALIDATE_AND_SET(FROSTED_GLASS_EFFECT_ENV_LIGHT_PARAMS)
-        GE_VALIDATE_AND_SET(FROSTED_GLASS_EFFECT_ENV_LIGHT_RATES)
-        GE_VALIDATE_AND_SET(FROSTED_GLASS_EFFECT_ED_LIGHT_PARAMS)
-        GE_VALIDATE_AND_SET(FROSTED_GLASS_EFFECT_ED_LIGHT_ANGLES)
-        GE_VALIDATE_AND_SET(FROSTED_GLASS_EFFECT_ED_LIGHT_DIR)
-        GE_VALIDATE_AND_SET(FROSTED_GLASS_EFFECT_ED_LIGHT_RATES)
-        GE_VALIDATE_AND_SET(FROSTED_GLASS_EFFECT_DARK_MODE_WEIGHTS_EMBOSS)
-        GE_VALIDATE_AND_SET(FROSTED_GLASS_EFFECT_DARK_MODE_BG_RATES)
-        GE_VALIDATE_AND_SET(FROSTED_GLASS_EFFECT_DARK_MODE_ED_LIGHT_ANGLES)
-        GE_VALIDATE_AND_SET(FROSTED_GLASS_BLUR_PARAMS)
-        GE_VALIDATE_AND_SET(FROSTED_GLASS_WEIGHTS_EMBOSS)
-        GE_VALIDATE_AND_SET(FROSTED_GLASS_WEIGHTS_EDL)
-        GE_VALIDATE_AND_SET(FROSTED_GLASS_BG_RATES)
-        GE_VALIDATE_AND_SET(FROSTED_GLASS_SD_RATES)
-        GE_VALIDATE_AND_SET(FROSTED_GLASS_ENV_LIGHT_RATES)
-        GE_VALIDATE_AND_SET(FROSTED_GLASS_ED_LIGHT_PARAMS)
-        GE_VALIDATE_AND_SET(FROSTED_GLASS_ED_LIGHT_ANGLES)
-        GE_VALIDATE_AND_SET(FROSTED_GLASS_ED_LIGHT_DIR)
-        GE_VALIDATE_AND_SET(FROSTED_GLASS_ED_LIGHT_RATES)
-        GE_VALIDATE_AND_SET(FROSTED_GLASS_DARK_MODE_BLUR_PARAM)
-        GE_VALIDATE_AND_SET(FROSTED_GLASS_DARK_MODE_WEIGHTS_EMBOSS)
-        GE_VALIDATE_AND_SET(FROSTED_GLASS_DARK_MODE_BG_RATES)
-        GE_VALIDATE_AND_SET(FROSTED_GLASS_DARK_MODE_ED_LIGHT_ANGLES)
-        GE_VALIDATE_AND_SET(MOTION_BLUR_ANCHOR)
-        GE_VALIDATE_AND_SET(SDF_ELLIPSE_SHAPE_CENTER)
-        GE_VALIDATE_AND_SET(SDF_PATH_SHAPE_OFFSET)
-        GE_VALIDATE_AND_SET(SDF_PATH_SHAPE_SCALE)
-        GE_VALIDATE_AND_SET(SDF_TRANSFORM_SHAPE_CENTER_POSITION)
-        GE_VALIDATE_AND_SET(SDF_TRIANGLE_SHAPE_VERTEX0)
-        GE_VALIDATE_AND_SET(SDF_TRIANGLE_SHAPE_VERTEX1)
-        GE_VALIDATE_AND_SET(SDF_TRIANGLE_SHAPE_VERTEX2)
-        GE_VALIDATE_AND_SET(SPATIAL_GLASS_EFFECT_CAMERA_INTRINSICS)
-        GE_VALIDATE_AND_SET(SPATIAL_GLASS_EFFECT_THICK_PARAMS)
-        GE_VALIDATE_AND_SET(SPATIAL_GLASS_EFFECT_FRESNEL_ENV_PARAMS)
-        GE_VALIDATE_AND_SET(SPATIAL_GLASS_EFFECT_BG_RATES)
-        GE_VALIDATE_AND_SET(SPATIAL_GLASS_EFFECT_WEIGHTS_EDL)
-        GE_VALIDATE_AND_SET(SPATIAL_GLASS_EFFECT_ENV_LIGHT_RATES)
-        GE_VALIDATE_AND_SET(SPATIAL_GLASS_EFFECT_SD_RATES)
-        GE_VALIDATE_AND_SET(WATER_DROPLET_TRANSITION_POSITION)
-        GE_VALIDATE_AND_SET(WAVE_DISTURBANCE_MASK_CLICK_POS)
-        GE_VALIDATE_AND_SET(WAVE_DISTURBANCE_MASK_WAVE_R_D)
-        GE_VALIDATE_AND_SET(DISTORT_CHROMA_GRANULARITY)
-        GE_VALIDATE_AND_SET(DISTORT_CHROMA_DISTORT_FACTOR)
-        GE_VALIDATE_AND_SET(LIGHT_CAVE_POSITION)
-        GE_VALIDATE_AND_SET(LIGHT_CAVE_RADIUS_X_Y)
-        default:
-            GE_LOGE("SetParamsMemberByTag<Vector2f>: No matching case for tag %{public}u (filter type %{public}u, "
-                    "params type %{public}u)",
-                static_cast<uint32_t>(tag), static_cast<uint32_t>(expectedFilterType),
-                static_cast<uint32_t>(params.GetType()));
-            break;
-    }
-}
-
-void GEParamsMemberHelper::SetParamsMemberByTag(GEFilterParams& params, GEParamsMemberTag tag, const Vector3f& value)
-{
-    auto expectedFilterType = GetFilterTypeFromTag(tag);
-    if (params.GetType() != expectedFilterType) {
-        return;
-    }
-
-    switch (tag) {
-        GE_VALIDATE_AND_SET(BORDER_LIGHT_POSITION)
-        GE_VALIDATE_AND_SET(BORDER_LIGHT_ROTATION_ANGLE)
-        GE_VALIDATE_AND_SET(CONTENT_LIGHT_POSITION)
-        GE_VALIDATE_AND_SET(CONTENT_LIGHT_ROTATION_ANGLE)
-        GE_VALIDATE_AND_SET(DIRECTION_LIGHT_LIGHT_DIRECTION)
-        GE_VALIDATE_AND_SET(FROSTED_GLASS_EFFECT_BG_K_B_S)
-        GE_VALIDATE_AND_SET(FROSTED_GLASS_EFFECT_BG_POS)
-        GE_VALIDATE_AND_SET(FROSTED_GLASS_EFFECT_BG_NEG)
-        GE_VALIDATE_AND_SET(FROSTED_GLASS_EFFECT_REFRACT_PARAMS)
-        GE_VALIDATE_AND_SET(FROSTED_GLASS_EFFECT_SD_PARAMS)
-        GE_VALIDATE_AND_SET(FROSTED_GLASS_EFFECT_SD_K_B_S)
-        GE_VALIDATE_AND_SET(FROSTED_GLASS_EFFECT_SD_POS)
-        GE_VALIDATE_AND_SET(FROSTED_GLASS_EFFECT_SD_NEG)
-        GE_VALIDATE_AND_SET(FROSTED_GLASS_EFFECT_ENV_LIGHT_K_B_S)
-        GE_VALIDATE_AND_SET(FROSTED_GLASS_EFFECT_ENV_LIGHT_POS)
-        GE_VALIDATE_AND_SET(FROSTED_GLASS_EFFECT_ENV_LIGHT_NEG)
-        GE_VALIDATE_AND_SET(FROSTED_GLASS_EFFECT_ED_LIGHT_K_B_S)
-        GE_VALIDATE_AND_SET(FROSTED_GLASS_EFFECT_ED_LIGHT_POS)
-        GE_VALIDATE_AND_SET(FROSTED_GLASS_EFFECT_ED_LIGHT_NEG)
-        GE_VALIDATE_AND_SET(FROSTED_GLASS_EFFECT_DARK_MODE_BG_K_B_S)
-        GE_VALIDATE_AND_SET(FROSTED_GLASS_EFFECT_DARK_MODE_BG_POS)
-        GE_VALIDATE_AND_SET(FROSTED_GLASS_EFFECT_DARK_MODE_BG_NEG)
-        GE_VALIDATE_AND_SET(FROSTED_GLASS_EFFECT_DARK_MODE_ED_LIGHT_K_B_S)
-        GE_VALIDATE_AND_SET(FROSTED_GLASS_BG_K_B_S)
-        GE_VALIDATE_AND_SET(FROSTED_GLASS_BG_POS)
-        GE_VALIDATE_AND_SET(FROSTED_GLASS_BG_NEG)
-        GE_VALIDATE_AND_SET(FROSTED_GLASS_REFRACT_PARAMS)
-        GE_VALIDATE_AND_SET(FROSTED_GLASS_SD_PARAMS)
-        GE_VALIDATE_AND_SET(FROSTED_GLASS_SD_K_B_S)
-        GE_VALIDATE_AND_SET(FROSTED_GLASS_SD_POS)
-        GE_VALIDATE_AND_SET(FROSTED_GLASS_SD_NEG)
-        GE_VALIDATE_AND_SET(FROSTED_GLASS_ENV_LIGHT_PARAMS)
-        GE_VALIDATE_AND_SET(FROSTED_GLASS_ENV_LIGHT_K_B_S)
-        GE_VALIDATE_AND_SET(FROSTED_GLASS_ENV_LIGHT_POS)
-        GE_VALIDATE_AND_SET(FROSTED_GLASS_ENV_LIGHT_NEG)
-        GE_VALIDATE_AND_SET(FROSTED_GLASS_ED_LIGHT_K_B_S)
-        GE_VALIDATE_AND_SET(FROSTED_GLASS_ED_LIGHT_POS)
-        GE_VALIDATE_AND_SET(FROSTED_GLASS_ED_LIGHT_NEG)
-        GE_VALIDATE_AND_SET(FROSTED_GLASS_DARK_MODE_BG_K_B_S)
-        GE_VALIDATE_AND_SET(FROSTED_GLASS_DARK_MODE_BG_POS)
-        GE_VALIDATE_AND_SET(FROSTED_GLASS_DARK_MODE_BG_NEG)
-        GE_VALIDATE_AND_SET(FROSTED_GLASS_DARK_MODE_ED_LIGHT_K_B_S)
-        GE_VALIDATE_AND_SET(HARMONIUM_EFFECT_POS_R_G_B)
-        GE_VALIDATE_AND_SET(HARMONIUM_EFFECT_NEG_R_G_B)
-        GE_VALIDATE_AND_SET(SDF_EDGE_LIGHT_EFFECT_COLOR)
-        GE_VALIDATE_AND_SET(SPATIAL_GLASS_EFFECT_LEFT_TOP)
-        GE_VALIDATE_AND_SET(SPATIAL_GLASS_EFFECT_LEFT_BOT)
-        GE_VALIDATE_AND_SET(SPATIAL_GLASS_EFFECT_RIGHT_TOP)
-        GE_VALIDATE_AND_SET(SPATIAL_GLASS_EFFECT_RIGHT_BOT)
-        GE_VALIDATE_AND_SET(SPATIAL_GLASS_EFFECT_CAMERA_POSITION)
-        GE_VALIDATE_AND_SET(SPATIAL_GLASS_EFFECT_LIGHT_DIR)
-        GE_VALIDATE_AND_SET(SPATIAL_GLASS_EFFECT_BG_K_B_S)
-        GE_VALIDATE_AND_SET(SPATIAL_GLASS_EFFECT_BG_POS)
-        GE_VALIDATE_AND_SET(SPATIAL_GLASS_EFFECT_BG_NEG)
-        GE_VALIDATE_AND_SET(SPATIAL_GLASS_EFFECT_REFRACT_PARAMS)
-        GE_VALIDATE_AND_SET(SPATIAL_GLASS_EFFECT_ENV_LIGHT_PARAMS)
-        GE_VALIDATE_AND_SET(SPATIAL_GLASS_EFFECT_ENV_LIGHT_K_B_S)
-        GE_VALIDATE_AND_SET(SPATIAL_GLASS_EFFECT_ENV_LIGHT_POS)
-        GE_VALIDATE_AND_SET(SPATIAL_GLASS_EFFECT_ENV_LIGHT_NEG)
-        GE_VALIDATE_AND_SET(SPATIAL_GLASS_EFFECT_SD_PARAMS)
-        GE_VALIDATE_AND_SET(SPATIAL_GLASS_EFFECT_SD_K_B_S)
-        GE_VALIDATE_AND_SET(SPATIAL_GLASS_EFFECT_SD_POS)
-        GE_VALIDATE_AND_SET(SPATIAL_GLASS_EFFECT_SD_NEG)
-        GE_VALIDATE_AND_SET(SPATIAL_POINT_LIGHT_LIGHT_POSITION)
-        GE_VALIDATE_AND_SET(WAVE_DISTURBANCE_MASK_WAVE_L_W_H)
-        GE_VALIDATE_AND_SET(DISTORT_CHROMA_COLOR_STRENGTH)
-        default:
-            GE_LOGE("SetParamsMemberByTag<Vector3f>: No matching case for tag %{public}u (filter type %{public}u, "
-                    "params type %{public}u)",
-                static_cast<uint32_t>(tag), static_cast<uint32_t>(expectedFilterType),
-                static_cast<uint32_t>(params.GetType()));
-            break;
-    }
-}
-
-void GEParamsMemberHelper::SetParamsMemberByTag(GEFilterParams& params, GEParamsMemberTag tag, const Vector4f& value)
-{
-    auto expectedFilterType = GetFilterTypeFromTag(tag);
-    if (params.GetType() != expectedFilterType) {
-        return;
-    }
-
-    switch (tag) {
-        GE_VALIDATE_AND_SET(BORDER_LIGHT_COLOR)
-        GE_VALIDATE_AND_SET(BORDER_SDF_LG_COLOR_COLOR0)
-        GE_VALIDATE_AND_SET(BORDER_SDF_LG_COLOR_COLOR1)
-        GE_VALIDATE_AND_SET(BORDER_SDF_LG_COLOR_COLOR2)
-        GE_VALIDATE_AND_SET(BORDER_SDF_LG_COLOR_COLOR3)
-        GE_VALIDATE_AND_SET(BORDER_SDF_LG_COLOR_COLOR4)
-        GE_VALIDATE_AND_SET(BORDER_SDF_SHADER_COLOR)
-        GE_VALIDATE_AND_SET(CIRCLE_FLOWLIGHT_COLORS0)
-        GE_VALIDATE_AND_SET(CIRCLE_FLOWLIGHT_COLORS1)
-        GE_VALIDATE_AND_SET(CIRCLE_FLOWLIGHT_COLORS2)
-        GE_VALIDATE_AND_SET(CIRCLE_FLOWLIGHT_COLORS3)
-        GE_VALIDATE_AND_SET(CIRCLE_FLOWLIGHT_ROTATION_FREQUENCY)
-        GE_VALIDATE_AND_SET(CIRCLE_FLOWLIGHT_ROTATION_AMPLITUDE)
-        GE_VALIDATE_AND_SET(CIRCLE_FLOWLIGHT_ROTATION_SEED)
-        GE_VALIDATE_AND_SET(CIRCLE_FLOWLIGHT_GRADIENT_X)
-        GE_VALIDATE_AND_SET(CIRCLE_FLOWLIGHT_GRADIENT_Y)
-        GE_VALIDATE_AND_SET(CIRCLE_FLOWLIGHT_STRENGTH)
-        GE_VALIDATE_AND_SET(CONTENT_LIGHT_COLOR)
-        GE_VALIDATE_AND_SET(CONTOUR_DIAGONAL_FLOW_LIGHT_LINE1_COLOR)
-        GE_VALIDATE_AND_SET(CONTOUR_DIAGONAL_FLOW_LIGHT_LINE2_COLOR)
-        GE_VALIDATE_AND_SET(DEPTH_OCCLUSION_DEPTH_PLANE)
-        GE_VALIDATE_AND_SET(DIRECTION_LIGHT_LIGHT_COLOR)
-        GE_VALIDATE_AND_SET(DISTORTION_COLLAPSE_BARREL_DISTORTION)
-        GE_VALIDATE_AND_SET(DOT_MATRIX_DOT_COLOR)
-        GE_VALIDATE_AND_SET(DOT_MATRIX_BG_COLOR)
-        GE_VALIDATE_AND_SET(EDGE_LIGHT_COLOR)
-        GE_VALIDATE_AND_SET(FRAME_GRADIENT_MASK_INNER_BEZIER)
-        GE_VALIDATE_AND_SET(FRAME_GRADIENT_MASK_OUTER_BEZIER)
-        GE_VALIDATE_AND_SET(FROSTED_GLASS_EFFECT_MATERIAL_COLOR)
-        GE_VALIDATE_AND_SET(FROSTED_GLASS_MATERIAL_COLOR)
-        GE_VALIDATE_AND_SET(HARMONIUM_EFFECT_TINT_COLOR)
-        GE_VALIDATE_AND_SET(PIXEL_MAP_MASK_SRC)
-        GE_VALIDATE_AND_SET(PIXEL_MAP_MASK_DST)
-        GE_VALIDATE_AND_SET(PIXEL_MAP_MASK_FILL_COLOR)
-        GE_VALIDATE_AND_SET(SDF_COLOR_COLOR)
-        GE_VALIDATE_AND_SET(SDF_DISTORT_OP_SHAPE_BARREL_DISTORTION)
-        GE_VALIDATE_AND_SET(SOUND_WAVE_COLOR_A)
-        GE_VALIDATE_AND_SET(SOUND_WAVE_COLOR_B)
-        GE_VALIDATE_AND_SET(SOUND_WAVE_COLOR_C)
-        GE_VALIDATE_AND_SET(SPATIAL_GLASS_EFFECT_GLASS_BASE_COLOR)
-        GE_VALIDATE_AND_SET(SPATIAL_GLASS_EFFECT_FRESNEL_ENV_COLOR)
-        GE_VALIDATE_AND_SET(SPATIAL_POINT_LIGHT_LIGHT_COLOR)
-        GE_VALIDATE_AND_SET(AIBAR_GLOW_L_T_W_H)
-        GE_VALIDATE_AND_SET(AIBAR_GLOW_COLORS0)
-        GE_VALIDATE_AND_SET(AIBAR_GLOW_COLORS1)
-        GE_VALIDATE_AND_SET(AIBAR_GLOW_COLORS2)
-        GE_VALIDATE_AND_SET(AIBAR_GLOW_COLORS3)
-        GE_VALIDATE_AND_SET(AIBAR_GLOW_STRENGTHS)
-        GE_VALIDATE_AND_SET(AIBAR_RECT_HALO_L_T_W_H)
-        GE_VALIDATE_AND_SET(AIBAR_RECT_HALO_COLORS0)
-        GE_VALIDATE_AND_SET(AIBAR_RECT_HALO_COLORS1)
-        GE_VALIDATE_AND_SET(AIBAR_RECT_HALO_COLORS2)
-        GE_VALIDATE_AND_SET(AIBAR_RECT_HALO_COLORS3)
-        GE_VALIDATE_AND_SET(AIBAR_RECT_HALO_STRENGTHS)
-        GE_VALIDATE_AND_SET(COLOR_GRADIENT_EFFECT_COLORS0)
-        GE_VALIDATE_AND_SET(COLOR_GRADIENT_EFFECT_COLORS1)
-        GE_VALIDATE_AND_SET(COLOR_GRADIENT_EFFECT_COLORS2)
-        GE_VALIDATE_AND_SET(COLOR_GRADIENT_EFFECT_COLORS3)
-        GE_VALIDATE_AND_SET(COLOR_GRADIENT_EFFECT_COLORS4)
-        GE_VALIDATE_AND_SET(COLOR_GRADIENT_EFFECT_COLORS5)
-        GE_VALIDATE_AND_SET(COLOR_GRADIENT_EFFECT_COLORS6)
-        GE_VALIDATE_AND_SET(COLOR_GRADIENT_EFFECT_COLORS7)
-        GE_VALIDATE_AND_SET(COLOR_GRADIENT_EFFECT_COLORS8)
-        GE_VALIDATE_AND_SET(COLOR_GRADIENT_EFFECT_COLORS9)
-        GE_VALIDATE_AND_SET(COLOR_GRADIENT_EFFECT_COLORS10)
-        GE_VALIDATE_AND_SET(COLOR_GRADIENT_EFFECT_COLORS11)
-        GE_VALIDATE_AND_SET(GRADIENT_FLOW_COLORS_COLORS0)
-        GE_VALIDATE_AND_SET(GRADIENT_FLOW_COLORS_COLORS1)
-        GE_VALIDATE_AND_SET(GRADIENT_FLOW_COLORS_COLORS2)
-        GE_VALIDATE_AND_SET(GRADIENT_FLOW_COLORS_COLORS3)
-        GE_VALIDATE_AND_SET(LIGHT_CAVE_COLOR_A)
-        GE_VALIDATE_AND_SET(LIGHT_CAVE_COLOR_B)
-        GE_VALIDATE_AND_SET(LIGHT_CAVE_COLOR_C)
-        GE_VALIDATE_AND_SET(NOISY_FRAME_GRADIENT_MASK_GRADIENT_BEZIER_CONTROL_POINTS)
-        GE_VALIDATE_AND_SET(ROUNDED_RECT_FLOWLIGHT_FEATHERING_BEZIER_CONTROL_POINTS)
-        GE_VALIDATE_AND_SET(ROUNDED_RECT_FLOWLIGHT_GRADIENT_BEZIER_CONTROL_POINTS)
-        GE_VALIDATE_AND_SET(ROUNDED_RECT_FLOWLIGHT_COLOR)
-        default:
-            GE_LOGE("SetParamsMemberByTag<Vector4f>: No matching case for tag %{public}u (filter type %{public}u, "
-                    "params type %{public}u)",
-                static_cast<uint32_t>(tag), static_cast<uint32_t>(expectedFilterType),
-                static_cast<uint32_t>(params.GetType()));
-            break;
-    }
-}
-
-void GEParamsMemberHelper::SetParamsMemberByTag(GEFilterParams& params, GEParamsMemberTag tag, const bool& value)
-{
-    auto expectedFilterType = GetFilterTypeFromTag(tag);
-    if (params.GetType() != expectedFilterType) {
-        return;
-    }
-
-    switch (tag) {
-        GE_VALIDATE_AND_SET(BLUR_DISABLE_SYSTEM_ADAPTATION)
-        GE_VALIDATE_AND_SET(BLUR_EXPAND_DRAW_REGION)
-        GE_VALIDATE_AND_SET(BORDER_SDF_LG_COLOR_IS_OUTLINE)
-        GE_VALIDATE_AND_SET(BORDER_SDF_SHADER_IS_OUTLINE)
-        GE_VALIDATE_AND_SET(DEPTH_OCCLUSION_IS_REVERSE)
-        GE_VALIDATE_AND_SET(DOT_MATRIX_INVERSE_EFFECT)
-        GE_VALIDATE_AND_SET(EDGE_LIGHT_BLOOM)
-        GE_VALIDATE_AND_SET(EDGE_LIGHT_USE_RAW_COLOR)
-        GE_VALIDATE_AND_SET(FROSTED_GLASS_EFFECT_ENABLE_S_D_F_CACHE)
-        GE_VALIDATE_AND_SET(FROSTED_GLASS_BASE_VIBRANCY_ENABLED)
-        GE_VALIDATE_AND_SET(LINEAR_GRADIENT_BLUR_IS_OFFSCREEN_CANVAS)
-        GE_VALIDATE_AND_SET(LINEAR_GRADIENT_BLUR_IS_RADIUS_GRADIENT)
-        GE_VALIDATE_AND_SET(MASK_TRANSITION_INVERSE)
-        GE_VALIDATE_AND_SET(MESA_BLUR_IS_DIRECTION)
-        GE_VALIDATE_AND_SET(SDF_FROM_IMAGE_GENERATE_DERIVS)
-        GE_VALIDATE_AND_SET(SPATIAL_GLASS_EFFECT_ENABLE_S_D_F_CACHE)
-        GE_VALIDATE_AND_SET(USE_EFFECT_MASK_USE_EFFECT)
-        GE_VALIDATE_AND_SET(VARIABLE_RADIUS_BLUR_APPLY_INSIDE_MASK)
-        GE_VALIDATE_AND_SET(WATER_DROPLET_TRANSITION_INVERSE)
-        default:
-            GE_LOGE("SetParamsMemberByTag<bool>: No matching case for tag %{public}u (filter type %{public}u, params "
-                    "type %{public}u)",
-                static_cast<uint32_t>(tag), static_cast<uint32_t>(expectedFilterType),
-                static_cast<uint32_t>(params.GetType()));
-            break;
-    }
-}
-
-void GEParamsMemberHelper::SetParamsMemberByTag(GEFilterParams& params, GEParamsMemberTag tag, const float& value)
-{
-    auto expectedFilterType = GetFilterTypeFromTag(tag);
-    if (params.GetType() != expectedFilterType) {
-        return;
-    }
-
-    switch (tag) {
-        GE_VALIDATE_AND_SET(AIBAR_AI_BAR_LOW)
-        GE_VALIDATE_AND_SET(AIBAR_AI_BAR_HIGH)
-        GE_VALIDATE_AND_SET(AIBAR_AI_BAR_THRESHOLD)
-        GE_VALIDATE_AND_SET(AIBAR_AI_BAR_OPACITY)
-        GE_VALIDATE_AND_SET(AIBAR_AI_BAR_SATURATION)
-        GE_VALIDATE_AND_SET(AURORA_NOISE_NOISE)
-        GE_VALIDATE_AND_SET(AURORA_NOISE_FREQ_X)
-        GE_VALIDATE_AND_SET(AURORA_NOISE_FREQ_Y)
-        GE_VALIDATE_AND_SET(BLUR_BUBBLES_RISE_BLUR_INTENSITY)
-        GE_VALIDATE_AND_SET(BLUR_BUBBLES_RISE_MIX_STRENGTH)
-        GE_VALIDATE_AND_SET(BLUR_BUBBLES_RISE_PROGRESS)
-        GE_VALIDATE_AND_SET(BLUR_RADIUS_X)
-        GE_VALIDATE_AND_SET(BLUR_RADIUS_Y)
-        GE_VALIDATE_AND_SET(BORDER_LIGHT_INTENSITY)
-        GE_VALIDATE_AND_SET(BORDER_LIGHT_WIDTH)
-        GE_VALIDATE_AND_SET(BORDER_LIGHT_CORNER_RADIUS)
-        GE_VALIDATE_AND_SET(BORDER_SDF_LG_COLOR_ANGLE)
-        GE_VALIDATE_AND_SET(BORDER_SDF_LG_COLOR_WIDTH)
-        GE_VALIDATE_AND_SET(BORDER_SDF_LG_COLOR_POSITION0)
-        GE_VALIDATE_AND_SET(BORDER_SDF_LG_COLOR_POSITION1)
-        GE_VALIDATE_AND_SET(BORDER_SDF_LG_COLOR_POSITION2)
-        GE_VALIDATE_AND_SET(BORDER_SDF_LG_COLOR_POSITION3)
-        GE_VALIDATE_AND_SET(BORDER_SDF_LG_COLOR_POSITION4)
-        GE_VALIDATE_AND_SET(BORDER_SDF_SHADER_WIDTH)
-        GE_VALIDATE_AND_SET(BORDER_SDF_SHADER_DASH_WIDTH)
-        GE_VALIDATE_AND_SET(BORDER_SDF_SHADER_DASH_GAP)
-        GE_VALIDATE_AND_SET(CIRCLE_FLOWLIGHT_PROGRESS)
-        GE_VALIDATE_AND_SET(CIRCLE_FLOWLIGHT_DISTORT_STRENGTH)
-        GE_VALIDATE_AND_SET(CIRCLE_FLOWLIGHT_BLEND_GRADIENT)
-        GE_VALIDATE_AND_SET(CONTENT_LIGHT_INTENSITY)
-        GE_VALIDATE_AND_SET(CONTOUR_DIAGONAL_FLOW_LIGHT_LINE1_START)
-        GE_VALIDATE_AND_SET(CONTOUR_DIAGONAL_FLOW_LIGHT_LINE1_LENGTH)
-        GE_VALIDATE_AND_SET(CONTOUR_DIAGONAL_FLOW_LIGHT_LINE2_START)
-        GE_VALIDATE_AND_SET(CONTOUR_DIAGONAL_FLOW_LIGHT_LINE2_LENGTH)
-        GE_VALIDATE_AND_SET(CONTOUR_DIAGONAL_FLOW_LIGHT_THICKNESS)
-        GE_VALIDATE_AND_SET(CONTOUR_DIAGONAL_FLOW_LIGHT_HALO_RADIUS)
-        GE_VALIDATE_AND_SET(CONTOUR_DIAGONAL_FLOW_LIGHT_LIGHT_WEIGHT)
-        GE_VALIDATE_AND_SET(CONTOUR_DIAGONAL_FLOW_LIGHT_HALO_WEIGHT)
-        GE_VALIDATE_AND_SET(DEPTH_OCCLUSION_WEIGHT)
-        GE_VALIDATE_AND_SET(DEPTH_OCCLUSION_NEAR)
-        GE_VALIDATE_AND_SET(DEPTH_OCCLUSION_FAR)
-        GE_VALIDATE_AND_SET(DIRECTION_LIGHT_MASK_FACTOR)
-        GE_VALIDATE_AND_SET(DIRECTION_LIGHT_LIGHT_INTENSITY)
-        GE_VALIDATE_AND_SET(DISPERSION_OPACITY)
-        GE_VALIDATE_AND_SET(DOT_MATRIX_PATH_WIDTH)
-        GE_VALIDATE_AND_SET(DOT_MATRIX_DOT_SPACING)
-        GE_VALIDATE_AND_SET(DOT_MATRIX_DOT_RADIUS)
-        GE_VALIDATE_AND_SET(DOT_MATRIX_PROGRESS)
-        GE_VALIDATE_AND_SET(DOUBLE_RIPPLE_MASK_RADIUS)
-        GE_VALIDATE_AND_SET(DOUBLE_RIPPLE_MASK_WIDTH)
-        GE_VALIDATE_AND_SET(DOUBLE_RIPPLE_MASK_TURBULENCE)
-        GE_VALIDATE_AND_SET(DOUBLE_RIPPLE_MASK_HALO_THICKNESS)
-        GE_VALIDATE_AND_SET(EDGE_LIGHT_ALPHA)
-        GE_VALIDATE_AND_SET(FRAME_GRADIENT_MASK_CORNER_RADIUS)
-        GE_VALIDATE_AND_SET(FRAME_GRADIENT_MASK_INNER_FRAME_WIDTH)
-        GE_VALIDATE_AND_SET(FRAME_GRADIENT_MASK_OUTER_FRAME_WIDTH)
-        GE_VALIDATE_AND_SET(FRAME_GRADIENT_MASK_AXIAL_FEATHER_STRENGTH)
-        GE_VALIDATE_AND_SET(FRAME_GRADIENT_MASK_AXIAL_CENTER)
-        GE_VALIDATE_AND_SET(FRAME_GRADIENT_MASK_AXIAL_CORE_WIDTH)
-        GE_VALIDATE_AND_SET(FRAME_GRADIENT_MASK_BOX_ANGLE_DEG)
-        GE_VALIDATE_AND_SET(FROSTED_GLASS_BLUR_RADIUS)
-        GE_VALIDATE_AND_SET(FROSTED_GLASS_BLUR_RADIUS_SCALE)
-        GE_VALIDATE_AND_SET(FROSTED_GLASS_BLUR_REFRACT_OUT_PX)
-        GE_VALIDATE_AND_SET(FROSTED_GLASS_EFFECT_MAX_COLOR)
-        GE_VALIDATE_AND_SET(FROSTED_GLASS_EFFECT_BG_ALPHA)
-        GE_VALIDATE_AND_SET(FROSTED_GLASS_EFFECT_REFRACT_OUT_PX)
-        GE_VALIDATE_AND_SET(FROSTED_GLASS_EFFECT_DARK_SCALE)
-        GE_VALIDATE_AND_SET(FROSTED_GLASS_MAX_COLOR)
-        GE_VALIDATE_AND_SET(FROSTED_GLASS_BG_ALPHA)
-        GE_VALIDATE_AND_SET(FROSTED_GLASS_DARK_SCALE)
-        GE_VALIDATE_AND_SET(FROSTED_GLASS_BASE_MATERIAL_TYPE)
-        GE_VALIDATE_AND_SET(GASIFY_BLUR_PROGRESS)
-        GE_VALIDATE_AND_SET(GASIFY_PROGRESS)
-        GE_VALIDATE_AND_SET(GASIFY_SCALE_TWIST_PROGRESS)
-        GE_VALIDATE_AND_SET(GREY_GREY_COEF1)
-        GE_VALIDATE_AND_SET(GREY_GREY_COEF2)
-        GE_VALIDATE_AND_SET(HARMONIUM_EFFECT_MASK_PROGRESS)
-        GE_VALIDATE_AND_SET(HARMONIUM_EFFECT_RIPPLE_PROGRESS)
-        GE_VALIDATE_AND_SET(HARMONIUM_EFFECT_DISTORT_PROGRESS)
-        GE_VALIDATE_AND_SET(HARMONIUM_EFFECT_DISTORT_FACTOR)
-        GE_VALIDATE_AND_SET(HARMONIUM_EFFECT_REFLECTION_FACTOR)
-        GE_VALIDATE_AND_SET(HARMONIUM_EFFECT_REFRACTION_FACTOR)
-        GE_VALIDATE_AND_SET(HARMONIUM_EFFECT_BLUR_LEFT)
-        GE_VALIDATE_AND_SET(HARMONIUM_EFFECT_BLUR_TOP)
-        GE_VALIDATE_AND_SET(HARMONIUM_EFFECT_MATERIAL_FACTOR)
-        GE_VALIDATE_AND_SET(HARMONIUM_EFFECT_CORNER_RADIUS)
-        GE_VALIDATE_AND_SET(HARMONIUM_EFFECT_RATE)
-        GE_VALIDATE_AND_SET(HARMONIUM_EFFECT_LIGHT_UP_DEGREE)
-        GE_VALIDATE_AND_SET(HARMONIUM_EFFECT_CUBIC_COEFF)
-        GE_VALIDATE_AND_SET(HARMONIUM_EFFECT_QUAD_COEFF)
-        GE_VALIDATE_AND_SET(HARMONIUM_EFFECT_SATURATION)
-        GE_VALIDATE_AND_SET(HARMONIUM_EFFECT_FRACTION)
-        GE_VALIDATE_AND_SET(HEAT_DISTORTION_INTENSITY)
-        GE_VALIDATE_AND_SET(HEAT_DISTORTION_NOISE_SCALE)
-        GE_VALIDATE_AND_SET(HEAT_DISTORTION_RISE_WEIGHT)
-        GE_VALIDATE_AND_SET(HEAT_DISTORTION_PROGRESS)
-        GE_VALIDATE_AND_SET(LINEAR_GRADIENT_BLUR_BLUR_RADIUS)
-        GE_VALIDATE_AND_SET(LINEAR_GRADIENT_BLUR_GEO_WIDTH)
-        GE_VALIDATE_AND_SET(LINEAR_GRADIENT_BLUR_GEO_HEIGHT)
-        GE_VALIDATE_AND_SET(LINEAR_GRADIENT_BLUR_TRAN_X)
-        GE_VALIDATE_AND_SET(LINEAR_GRADIENT_BLUR_TRAN_Y)
-        GE_VALIDATE_AND_SET(MAGNIFIER_FACTOR)
-        GE_VALIDATE_AND_SET(MAGNIFIER_WIDTH)
-        GE_VALIDATE_AND_SET(MAGNIFIER_HEIGHT)
-        GE_VALIDATE_AND_SET(MAGNIFIER_CORNER_RADIUS)
-        GE_VALIDATE_AND_SET(MAGNIFIER_BORDER_WIDTH)
-        GE_VALIDATE_AND_SET(MAGNIFIER_ZOOM_OFFSET_X)
-        GE_VALIDATE_AND_SET(MAGNIFIER_ZOOM_OFFSET_Y)
-        GE_VALIDATE_AND_SET(MAGNIFIER_SHADOW_OFFSET_X)
-        GE_VALIDATE_AND_SET(MAGNIFIER_SHADOW_OFFSET_Y)
-        GE_VALIDATE_AND_SET(MAGNIFIER_SHADOW_SIZE)
-        GE_VALIDATE_AND_SET(MAGNIFIER_SHADOW_STRENGTH)
-        GE_VALIDATE_AND_SET(MASK_TRANSITION_FACTOR)
-        GE_VALIDATE_AND_SET(MESA_BLUR_GREY_COEF1)
-        GE_VALIDATE_AND_SET(MESA_BLUR_GREY_COEF2)
-        GE_VALIDATE_AND_SET(MESA_BLUR_OFFSET_X)
-        GE_VALIDATE_AND_SET(MESA_BLUR_OFFSET_Y)
-        GE_VALIDATE_AND_SET(MESA_BLUR_OFFSET_Z)
-        GE_VALIDATE_AND_SET(MESA_BLUR_OFFSET_W)
-        GE_VALIDATE_AND_SET(MESA_BLUR_WIDTH)
-        GE_VALIDATE_AND_SET(MESA_BLUR_HEIGHT)
-        GE_VALIDATE_AND_SET(MESA_BLUR_ANGLE)
-        GE_VALIDATE_AND_SET(MOTION_BLUR_RADIUS)
-        GE_VALIDATE_AND_SET(PARTICLE_ABLATION_PROGRESS)
-        GE_VALIDATE_AND_SET(PARTICLE_ABLATION_ABLATION_RATE)
-        GE_VALIDATE_AND_SET(PARTICLE_ABLATION_GLOW_LEVEL)
-        GE_VALIDATE_AND_SET(PARTICLE_ABLATION_GLOW_BRIGHTNESS)
-        GE_VALIDATE_AND_SET(PARTICLE_CIRCULAR_HALO_RADIUS)
-        GE_VALIDATE_AND_SET(PARTICLE_CIRCULAR_HALO_NOISE)
-        GE_VALIDATE_AND_SET(RADIAL_GRADIENT_MASK_RADIUS_X)
-        GE_VALIDATE_AND_SET(RADIAL_GRADIENT_MASK_RADIUS_Y)
-        GE_VALIDATE_AND_SET(RIPPLE_MASK_RADIUS)
-        GE_VALIDATE_AND_SET(RIPPLE_MASK_WIDTH)
-        GE_VALIDATE_AND_SET(RIPPLE_MASK_WIDTH_CENTER_OFFSET)
-        GE_VALIDATE_AND_SET(SDF_EDGE_LIGHT_EFFECT_SDF_SPREAD_FACTOR)
-        GE_VALIDATE_AND_SET(SDF_EDGE_LIGHT_EFFECT_BLOOM_INTENSITY_CUTOFF)
-        GE_VALIDATE_AND_SET(SDF_EDGE_LIGHT_EFFECT_MAX_INTENSITY)
-        GE_VALIDATE_AND_SET(SDF_EDGE_LIGHT_EFFECT_MAX_BLOOM_INTENSITY)
-        GE_VALIDATE_AND_SET(SDF_EDGE_LIGHT_EFFECT_BLOOM_FALLOFF_POW)
-        GE_VALIDATE_AND_SET(SDF_EDGE_LIGHT_EFFECT_MIN_BORDER_WIDTH)
-        GE_VALIDATE_AND_SET(SDF_EDGE_LIGHT_EFFECT_MAX_BORDER_WIDTH)
-        GE_VALIDATE_AND_SET(SDF_EDGE_LIGHT_EFFECT_INNER_BORDER_BLOOM_WIDTH)
-        GE_VALIDATE_AND_SET(SDF_EDGE_LIGHT_EFFECT_OUTER_BORDER_BLOOM_WIDTH)
-        GE_VALIDATE_AND_SET(SDF_EDGE_LIGHT_SDF_SPREAD_FACTOR)
-        GE_VALIDATE_AND_SET(SDF_EDGE_LIGHT_BLOOM_INTENSITY_CUTOFF)
-        GE_VALIDATE_AND_SET(SDF_EDGE_LIGHT_MAX_INTENSITY)
-        GE_VALIDATE_AND_SET(SDF_EDGE_LIGHT_MAX_BLOOM_INTENSITY)
-        GE_VALIDATE_AND_SET(SDF_EDGE_LIGHT_BLOOM_FALLOFF_POW)
-        GE_VALIDATE_AND_SET(SDF_EDGE_LIGHT_MIN_BORDER_WIDTH)
-        GE_VALIDATE_AND_SET(SDF_EDGE_LIGHT_MAX_BORDER_WIDTH)
-        GE_VALIDATE_AND_SET(SDF_EDGE_LIGHT_INNER_BORDER_BLOOM_WIDTH)
-        GE_VALIDATE_AND_SET(SDF_EDGE_LIGHT_OUTER_BORDER_BLOOM_WIDTH)
-        GE_VALIDATE_AND_SET(SDF_ELLIPSE_SHAPE_WIDTH)
-        GE_VALIDATE_AND_SET(SDF_ELLIPSE_SHAPE_HEIGHT)
-        GE_VALIDATE_AND_SET(SDF_SMOOTH_SUB_OP_SHAPE_SPACING)
-        GE_VALIDATE_AND_SET(SDF_TRANSFORM_SHAPE_WARP_STRENGTH)
-        GE_VALIDATE_AND_SET(SDF_TRANSFORM_SHAPE_SPACING)
-        GE_VALIDATE_AND_SET(SDF_TRANSFORM_SHAPE_HOT_ZONE)
-        GE_VALIDATE_AND_SET(SDF_TRIANGLE_SHAPE_RADIUS)
-        GE_VALIDATE_AND_SET(SDF_UNION_OP_SPACING)
-        GE_VALIDATE_AND_SET(SOUND_WAVE_COLOR_PROGRESS)
-        GE_VALIDATE_AND_SET(SOUND_WAVE_SOUND_INTENSITY)
-        GE_VALIDATE_AND_SET(SOUND_WAVE_SHOCK_WAVE_ALPHA_A)
-        GE_VALIDATE_AND_SET(SOUND_WAVE_SHOCK_WAVE_ALPHA_B)
-        GE_VALIDATE_AND_SET(SOUND_WAVE_SHOCK_WAVE_PROGRESS_A)
-        GE_VALIDATE_AND_SET(SOUND_WAVE_SHOCK_WAVE_PROGRESS_B)
-        GE_VALIDATE_AND_SET(SOUND_WAVE_SHOCK_WAVE_TOTAL_ALPHA)
-        GE_VALIDATE_AND_SET(SPATIAL_GLASS_EFFECT_REFRACT_OUT_PX)
-        GE_VALIDATE_AND_SET(SPATIAL_POINT_LIGHT_LIGHT_INTENSITY)
-        GE_VALIDATE_AND_SET(SPATIAL_POINT_LIGHT_ATTENUATION)
-        GE_VALIDATE_AND_SET(VARIABLE_RADIUS_BLUR_BLUR_RADIUS)
-        GE_VALIDATE_AND_SET(WATER_DROPLET_TRANSITION_PROGRESS)
-        GE_VALIDATE_AND_SET(WATER_DROPLET_TRANSITION_RADIUS)
-        GE_VALIDATE_AND_SET(WATER_DROPLET_TRANSITION_TRANSITION_FADE_WIDTH)
-        GE_VALIDATE_AND_SET(WATER_DROPLET_TRANSITION_DISTORTION_INTENSITY)
-        GE_VALIDATE_AND_SET(WATER_DROPLET_TRANSITION_DISTORTION_THICKNESS)
-        GE_VALIDATE_AND_SET(WATER_DROPLET_TRANSITION_LIGHT_STRENGTH)
-        GE_VALIDATE_AND_SET(WATER_DROPLET_TRANSITION_LIGHT_SOFTNESS)
-        GE_VALIDATE_AND_SET(WATER_DROPLET_TRANSITION_NOISE_SCALE_X)
-        GE_VALIDATE_AND_SET(WATER_DROPLET_TRANSITION_NOISE_SCALE_Y)
-        GE_VALIDATE_AND_SET(WATER_DROPLET_TRANSITION_NOISE_STRENGTH_X)
-        GE_VALIDATE_AND_SET(WATER_DROPLET_TRANSITION_NOISE_STRENGTH_Y)
-        GE_VALIDATE_AND_SET(WATER_RIPPLE_PROGRESS)
-        GE_VALIDATE_AND_SET(WATER_RIPPLE_RIPPLE_CENTER_X)
-        GE_VALIDATE_AND_SET(WATER_RIPPLE_RIPPLE_CENTER_Y)
-        GE_VALIDATE_AND_SET(WAVE_DISTURBANCE_MASK_PROGRESS)
-        GE_VALIDATE_AND_SET(WAVE_GRADIENT_MASK_WIDTH)
-        GE_VALIDATE_AND_SET(WAVE_GRADIENT_MASK_PROPAGATION_RADIUS)
-        GE_VALIDATE_AND_SET(WAVE_GRADIENT_MASK_BLUR_RADIUS)
-        GE_VALIDATE_AND_SET(WAVE_GRADIENT_MASK_TURBULENCE_STRENGTH)
-        GE_VALIDATE_AND_SET(WAVY_RIPPLE_LIGHT_RADIUS)
-        GE_VALIDATE_AND_SET(WAVY_RIPPLE_LIGHT_THICKNESS)
-        GE_VALIDATE_AND_SET(AIBAR_GLOW_STRETCH_FACTOR)
-        GE_VALIDATE_AND_SET(AIBAR_GLOW_BAR_ANGLE)
-        GE_VALIDATE_AND_SET(AIBAR_GLOW_BRIGHTNESS)
-        GE_VALIDATE_AND_SET(AIBAR_GLOW_PROGRESS)
-        GE_VALIDATE_AND_SET(AIBAR_RECT_HALO_BRIGHTNESS)
-        GE_VALIDATE_AND_SET(AIBAR_RECT_HALO_PROGRESS)
-        GE_VALIDATE_AND_SET(COLOR_GRADIENT_EFFECT_STRENGTHS0)
-        GE_VALIDATE_AND_SET(COLOR_GRADIENT_EFFECT_STRENGTHS1)
-        GE_VALIDATE_AND_SET(COLOR_GRADIENT_EFFECT_STRENGTHS2)
-        GE_VALIDATE_AND_SET(COLOR_GRADIENT_EFFECT_STRENGTHS3)
-        GE_VALIDATE_AND_SET(COLOR_GRADIENT_EFFECT_STRENGTHS4)
-        GE_VALIDATE_AND_SET(COLOR_GRADIENT_EFFECT_STRENGTHS5)
-        GE_VALIDATE_AND_SET(COLOR_GRADIENT_EFFECT_STRENGTHS6)
-        GE_VALIDATE_AND_SET(COLOR_GRADIENT_EFFECT_STRENGTHS7)
-        GE_VALIDATE_AND_SET(COLOR_GRADIENT_EFFECT_STRENGTHS8)
-        GE_VALIDATE_AND_SET(COLOR_GRADIENT_EFFECT_STRENGTHS9)
-        GE_VALIDATE_AND_SET(COLOR_GRADIENT_EFFECT_STRENGTHS10)
-        GE_VALIDATE_AND_SET(COLOR_GRADIENT_EFFECT_STRENGTHS11)
-        GE_VALIDATE_AND_SET(COLOR_GRADIENT_EFFECT_COLOR_NUM)
-        GE_VALIDATE_AND_SET(COLOR_GRADIENT_EFFECT_BLEND)
-        GE_VALIDATE_AND_SET(COLOR_GRADIENT_EFFECT_BLENDK)
-        GE_VALIDATE_AND_SET(COLOR_GRADIENT_EFFECT_BRIGHTNESS)
-        GE_VALIDATE_AND_SET(DISTORT_CHROMA_PROGRESS)
-        GE_VALIDATE_AND_SET(DISTORT_CHROMA_FREQUENCY)
-        GE_VALIDATE_AND_SET(DISTORT_CHROMA_SHARPNESS)
-        GE_VALIDATE_AND_SET(DISTORT_CHROMA_BRIGHTNESS)
-        GE_VALIDATE_AND_SET(DISTORT_CHROMA_DISPERSION)
-        GE_VALIDATE_AND_SET(DISTORT_CHROMA_SATURATION)
-        GE_VALIDATE_AND_SET(DISTORT_CHROMA_VERTICAL_MOVE_DISTANCE)
-        GE_VALIDATE_AND_SET(DUPOLI_NOISE_MASK_PROGRESS)
-        GE_VALIDATE_AND_SET(DUPOLI_NOISE_MASK_GRANULARITY)
-        GE_VALIDATE_AND_SET(DUPOLI_NOISE_MASK_VERTICAL_MOVE_DISTANCE)
-        GE_VALIDATE_AND_SET(GRADIENT_FLOW_COLORS_GRADIENT_BEGIN)
-        GE_VALIDATE_AND_SET(GRADIENT_FLOW_COLORS_GRADIENT_END)
-        GE_VALIDATE_AND_SET(GRADIENT_FLOW_COLORS_EFFECT_ALPHA)
-        GE_VALIDATE_AND_SET(GRADIENT_FLOW_COLORS_PROGRESS)
-        GE_VALIDATE_AND_SET(LIGHT_CAVE_PROGRESS)
-        GE_VALIDATE_AND_SET(NOISY_FRAME_GRADIENT_MASK_CORNER_RADIUS)
-        GE_VALIDATE_AND_SET(NOISY_FRAME_GRADIENT_MASK_SLOPE)
-        GE_VALIDATE_AND_SET(NOISY_FRAME_GRADIENT_MASK_PROGRESS)
-        GE_VALIDATE_AND_SET(ROUNDED_RECT_FLOWLIGHT_WAVE_LENGTH)
-        GE_VALIDATE_AND_SET(ROUNDED_RECT_FLOWLIGHT_WAVE_TOP)
-        GE_VALIDATE_AND_SET(ROUNDED_RECT_FLOWLIGHT_CORNER_RADIUS)
-        GE_VALIDATE_AND_SET(ROUNDED_RECT_FLOWLIGHT_BRIGHTNESS)
-        GE_VALIDATE_AND_SET(ROUNDED_RECT_FLOWLIGHT_SCALE)
-        GE_VALIDATE_AND_SET(ROUNDED_RECT_FLOWLIGHT_SHARPING)
-        GE_VALIDATE_AND_SET(ROUNDED_RECT_FLOWLIGHT_FEATHERING)
-        GE_VALIDATE_AND_SET(ROUNDED_RECT_FLOWLIGHT_PROGRESS)
-        default:
-            GE_LOGE("SetParamsMemberByTag<float>: No matching case for tag %{public}u (filter type %{public}u, params "
-                    "type %{public}u)",
-                static_cast<uint32_t>(tag), static_cast<uint32_t>(expectedFilterType),
-                static_cast<uint32_t>(params.GetType()));
-            break;
-    }
-}
-
-void GEParamsMemberHelper::SetParamsMemberByTag(GEFilterParams& params, GEParamsMemberTag tag, const int32_t& value)
-{
-    auto expectedFilterType = GetFilterTypeFromTag(tag);
-    if (params.GetType() != expectedFilterType) {
-        return;
-    }
-
-    switch (tag) {
-        GE_VALIDATE_AND_SET(BORDER_SDF_LG_COLOR_COLOR_NUMBER)
-        GE_VALIDATE_AND_SET(BORDER_SDF_SHADER_STYLE)
-        GE_VALIDATE_AND_SET(DOT_MATRIX_PATH_DIRECTION)
-        GE_VALIDATE_AND_SET(DOT_MATRIX_EFFECT_TYPE)
-        GE_VALIDATE_AND_SET(KAWASE_BLUR_RADIUS)
-        GE_VALIDATE_AND_SET(LINEAR_GRADIENT_BLUR_DIRECTION)
-        GE_VALIDATE_AND_SET(MAGNIFIER_ROTATE_DEGREE)
-        GE_VALIDATE_AND_SET(MESA_BLUR_RADIUS)
-        GE_VALIDATE_AND_SET(MESA_BLUR_TILE_MODE)
-        GE_VALIDATE_AND_SET(MOTION_BLUR_SAMPLE_COUNT)
-        GE_VALIDATE_AND_SET(PARTICLE_ABLATION_MAX_PARTICLE_COUNT)
-        GE_VALIDATE_AND_SET(PARTICLE_ABLATION_TURB_SCALE)
-        GE_VALIDATE_AND_SET(PARTICLE_ABLATION_TURB_EVO)
-        GE_VALIDATE_AND_SET(PARTICLE_ABLATION_TURB_AMP)
-        GE_VALIDATE_AND_SET(SDF_FROM_IMAGE_SPREAD_FACTOR)
-        GE_VALIDATE_AND_SET(SDF_TRANSFORM_SHAPE_UNION_MODE)
-        default:
-            GE_LOGE("SetParamsMemberByTag<int32_t>: No matching case for tag %{public}u (filter type %{public}u, "
-                    "params type %{public}u)",
-                static_cast<uint32_t>(tag), static_cast<uint32_t>(expectedFilterType),
-                static_cast<uint32_t>(params.GetType()));
-            break;
-    }
-}
-
-void GEParamsMemberHelper::SetParamsMemberByTag(
-    GEFilterParams& params, GEParamsMemberTag tag, const std::pair<float, float>& value)
-{
-    auto expectedFilterType = GetFilterTypeFromTag(tag);
-    if (params.GetType() != expectedFilterType) {
-        return;
-    }
-
-    switch (tag) {
-        GE_VALIDATE_AND_SET(BEZIER_WARP_DESTINATION_PATCH0)
-        GE_VALIDATE_AND_SET(BEZIER_WARP_DESTINATION_PATCH1)
-        GE_VALIDATE_AND_SET(BEZIER_WARP_DESTINATION_PATCH2)
-        GE_VALIDATE_AND_SET(BEZIER_WARP_DESTINATION_PATCH3)
-        GE_VALIDATE_AND_SET(BEZIER_WARP_DESTINATION_PATCH4)
-        GE_VALIDATE_AND_SET(BEZIER_WARP_DESTINATION_PATCH5)
-        GE_VALIDATE_AND_SET(BEZIER_WARP_DESTINATION_PATCH6)
-        GE_VALIDATE_AND_SET(BEZIER_WARP_DESTINATION_PATCH7)
-        GE_VALIDATE_AND_SET(BEZIER_WARP_DESTINATION_PATCH8)
-        GE_VALIDATE_AND_SET(BEZIER_WARP_DESTINATION_PATCH9)
-        GE_VALIDATE_AND_SET(BEZIER_WARP_DESTINATION_PATCH10)
-        GE_VALIDATE_AND_SET(BEZIER_WARP_DESTINATION_PATCH11)
-        GE_VALIDATE_AND_SET(DISPERSION_RED_OFFSET)
-        GE_VALIDATE_AND_SET(DISPERSION_GREEN_OFFSET)
-        GE_VALIDATE_AND_SET(DISPERSION_BLUE_OFFSET)
-        GE_VALIDATE_AND_SET(DISPLACEMENT_DISTORT_FILTER_FACTOR)
-        GE_VALIDATE_AND_SET(DISTORTION_COLLAPSE_L_U_CORNER)
-        GE_VALIDATE_AND_SET(DISTORTION_COLLAPSE_R_U_CORNER)
-        GE_VALIDATE_AND_SET(DISTORTION_COLLAPSE_R_B_CORNER)
-        GE_VALIDATE_AND_SET(DISTORTION_COLLAPSE_L_B_CORNER)
-        GE_VALIDATE_AND_SET(DOT_MATRIX_COLOR_FRACTIONS)
-        GE_VALIDATE_AND_SET(DOUBLE_RIPPLE_MASK_CENTER1)
-        GE_VALIDATE_AND_SET(DOUBLE_RIPPLE_MASK_CENTER2)
-        GE_VALIDATE_AND_SET(FRAME_GRADIENT_MASK_RECT_W_H)
-        GE_VALIDATE_AND_SET(FRAME_GRADIENT_MASK_RECT_POS)
-        GE_VALIDATE_AND_SET(FRAME_GRADIENT_MASK_AXIAL_DIRECTION)
-        GE_VALIDATE_AND_SET(FROSTED_GLASS_EFFECT_WEIGHTS_EMBOSS)
-        GE_VALIDATE_AND_SET(FROSTED_GLASS_EFFECT_WEIGHTS_EDL)
-        GE_VALIDATE_AND_SET(FROSTED_GLASS_EFFECT_ANTI_ALIAS)
-        GE_VALIDATE_AND_SET(FROSTED_GLASS_EFFECT_BG_RATES)
-        GE_VALIDATE_AND_SET(FROSTED_GLASS_EFFECT_SD_RATES)
-        GE_VALIDATE_AND_SET(FROSTED_GLASS_EFFECT_ENV_LIGHT_PARAMS)
-        GE_VALIDATE_AND_SET(FROSTED_GLASS_EFFECT_ENV_LIGHT_RATES)
-        GE_VALIDATE_AND_SET(FROSTED_GLASS_EFFECT_ED_LIGHT_PARAMS)
-        GE_VALIDATE_AND_SET(FROSTED_GLASS_EFFECT_ED_LIGHT_ANGLES)
-        GE_VALIDATE_AND_SET(FROSTED_GLASS_EFFECT_ED_LIGHT_DIR)
-        GE_VALIDATE_AND_SET(FROSTED_GLASS_EFFECT_ED_LIGHT_RATES)
-        GE_VALIDATE_AND_SET(FROSTED_GLASS_EFFECT_DARK_MODE_WEIGHTS_EMBOSS)
-        GE_VALIDATE_AND_SET(FROSTED_GLASS_EFFECT_DARK_MODE_BG_RATES)
-        GE_VALIDATE_AND_SET(FROSTED_GLASS_EFFECT_DARK_MODE_ED_LIGHT_ANGLES)
-        GE_VALIDATE_AND_SET(FROSTED_GLASS_BLUR_PARAMS)
-        GE_VALIDATE_AND_SET(FROSTED_GLASS_WEIGHTS_EMBOSS)
-        GE_VALIDATE_AND_SET(FROSTED_GLASS_WEIGHTS_EDL)
-        GE_VALIDATE_AND_SET(FROSTED_GLASS_BG_RATES)
-        GE_VALIDATE_AND_SET(FROSTED_GLASS_SD_RATES)
-        GE_VALIDATE_AND_SET(FROSTED_GLASS_ENV_LIGHT_RATES)
-        GE_VALIDATE_AND_SET(FROSTED_GLASS_ED_LIGHT_PARAMS)
-        GE_VALIDATE_AND_SET(FROSTED_GLASS_ED_LIGHT_ANGLES)
-        GE_VALIDATE_AND_SET(FROSTED_GLASS_ED_LIGHT_DIR)
-        GE_VALIDATE_AND_SET(FROSTED_GLASS_ED_LIGHT_RATES)
-        GE_VALIDATE_AND_SET(FROSTED_GLASS_DARK_MODE_BLUR_PARAM)
-        GE_VALIDATE_AND_SET(FROSTED_GLASS_DARK_MODE_WEIGHTS_EMBOSS)
-        GE_VALIDATE_AND_SET(FROSTED_GLASS_DARK_MODE_BG_RATES)
-        GE_VALIDATE_AND_SET(FROSTED_GLASS_DARK_MODE_ED_LIGHT_ANGLES)
-        GE_VALIDATE_AND_SET(GASIFY_SCALE_TWIST_SCALE)
-        GE_VALIDATE_AND_SET(GRID_WARP_GRID_POINTS0)
-        GE_VALIDATE_AND_SET(GRID_WARP_GRID_POINTS1)
-        GE_VALIDATE_AND_SET(GRID_WARP_GRID_POINTS2)
-        GE_VALIDATE_AND_SET(GRID_WARP_GRID_POINTS3)
-        GE_VALIDATE_AND_SET(GRID_WARP_GRID_POINTS4)
-        GE_VALIDATE_AND_SET(GRID_WARP_GRID_POINTS5)
-        GE_VALIDATE_AND_SET(GRID_WARP_GRID_POINTS6)
-        GE_VALIDATE_AND_SET(GRID_WARP_GRID_POINTS7)
-        GE_VALIDATE_AND_SET(GRID_WARP_GRID_POINTS8)
-        GE_VALIDATE_AND_SET(GRID_WARP_ROTATION_ANGLES0)
-        GE_VALIDATE_AND_SET(GRID_WARP_ROTATION_ANGLES1)
-        GE_VALIDATE_AND_SET(GRID_WARP_ROTATION_ANGLES2)
-        GE_VALIDATE_AND_SET(GRID_WARP_ROTATION_ANGLES3)
-        GE_VALIDATE_AND_SET(GRID_WARP_ROTATION_ANGLES4)
-        GE_VALIDATE_AND_SET(GRID_WARP_ROTATION_ANGLES5)
-        GE_VALIDATE_AND_SET(GRID_WARP_ROTATION_ANGLES6)
-        GE_VALIDATE_AND_SET(GRID_WARP_ROTATION_ANGLES7)
-        GE_VALIDATE_AND_SET(GRID_WARP_ROTATION_ANGLES8)
-        GE_VALIDATE_AND_SET(PARTICLE_ABLATION_CENTERS0)
-        GE_VALIDATE_AND_SET(PARTICLE_ABLATION_CENTERS1)
-        GE_VALIDATE_AND_SET(PARTICLE_ABLATION_CENTERS2)
-        GE_VALIDATE_AND_SET(PARTICLE_ABLATION_CENTERS3)
-        GE_VALIDATE_AND_SET(PARTICLE_ABLATION_WIND)
-        GE_VALIDATE_AND_SET(PARTICLE_ABLATION_EXPANSION_SIZE)
-        GE_VALIDATE_AND_SET(PARTICLE_CIRCULAR_HALO_CENTER)
-        GE_VALIDATE_AND_SET(RADIAL_GRADIENT_MASK_CENTER)
-        GE_VALIDATE_AND_SET(RIPPLE_MASK_CENTER)
-        GE_VALIDATE_AND_SET(SDF_DISTORT_OP_SHAPE_L_U_CORNER)
-        GE_VALIDATE_AND_SET(SDF_DISTORT_OP_SHAPE_R_U_CORNER)
-        GE_VALIDATE_AND_SET(SDF_DISTORT_OP_SHAPE_R_B_CORNER)
-        GE_VALIDATE_AND_SET(SDF_DISTORT_OP_SHAPE_L_B_CORNER)
-        GE_VALIDATE_AND_SET(SDF_ELLIPSE_SHAPE_CENTER)
-        GE_VALIDATE_AND_SET(SDF_PATH_SHAPE_OFFSET)
-        GE_VALIDATE_AND_SET(SDF_PATH_SHAPE_SCALE)
-        GE_VALIDATE_AND_SET(SDF_TRANSFORM_SHAPE_CENTER_POSITION)
-        GE_VALIDATE_AND_SET(SDF_TRIANGLE_SHAPE_VERTEX0)
-        GE_VALIDATE_AND_SET(SDF_TRIANGLE_SHAPE_VERTEX1)
-        GE_VALIDATE_AND_SET(SDF_TRIANGLE_SHAPE_VERTEX2)
-        GE_VALIDATE_AND_SET(SPATIAL_GLASS_EFFECT_THICK_PARAMS)
-        GE_VALIDATE_AND_SET(SPATIAL_GLASS_EFFECT_FRESNEL_ENV_PARAMS)
-        GE_VALIDATE_AND_SET(SPATIAL_GLASS_EFFECT_BG_RATES)
-        GE_VALIDATE_AND_SET(SPATIAL_GLASS_EFFECT_WEIGHTS_EDL)
-        GE_VALIDATE_AND_SET(SPATIAL_GLASS_EFFECT_ENV_LIGHT_RATES)
-        GE_VALIDATE_AND_SET(SPATIAL_GLASS_EFFECT_SD_RATES)
-        GE_VALIDATE_AND_SET(WATER_DROPLET_TRANSITION_POSITION)
-        GE_VALIDATE_AND_SET(WAVE_DISTURBANCE_MASK_CLICK_POS)
-        GE_VALIDATE_AND_SET(WAVE_DISTURBANCE_MASK_WAVE_R_D)
-        GE_VALIDATE_AND_SET(WAVE_GRADIENT_MASK_CENTER)
-        GE_VALIDATE_AND_SET(WAVY_RIPPLE_LIGHT_CENTER)
-        GE_VALIDATE_AND_SET(AIBAR_GLOW_POSITIONS0)
-        GE_VALIDATE_AND_SET(AIBAR_GLOW_POSITIONS1)
-        GE_VALIDATE_AND_SET(AIBAR_GLOW_POSITIONS2)
-        GE_VALIDATE_AND_SET(AIBAR_GLOW_POSITIONS3)
-        GE_VALIDATE_AND_SET(AIBAR_RECT_HALO_POSITIONS0)
-        GE_VALIDATE_AND_SET(AIBAR_RECT_HALO_POSITIONS1)
-        GE_VALIDATE_AND_SET(AIBAR_RECT_HALO_POSITIONS2)
-        GE_VALIDATE_AND_SET(AIBAR_RECT_HALO_POSITIONS3)
-        GE_VALIDATE_AND_SET(COLOR_GRADIENT_EFFECT_POSITIONS0)
-        GE_VALIDATE_AND_SET(COLOR_GRADIENT_EFFECT_POSITIONS1)
-        GE_VALIDATE_AND_SET(COLOR_GRADIENT_EFFECT_POSITIONS2)
-        GE_VALIDATE_AND_SET(COLOR_GRADIENT_EFFECT_POSITIONS3)
-        GE_VALIDATE_AND_SET(COLOR_GRADIENT_EFFECT_POSITIONS4)
-        GE_VALIDATE_AND_SET(COLOR_GRADIENT_EFFECT_POSITIONS5)
-        GE_VALIDATE_AND_SET(COLOR_GRADIENT_EFFECT_POSITIONS6)
-        GE_VALIDATE_AND_SET(COLOR_GRADIENT_EFFECT_POSITIONS7)
-        GE_VALIDATE_AND_SET(COLOR_GRADIENT_EFFECT_POSITIONS8)
-        GE_VALIDATE_AND_SET(COLOR_GRADIENT_EFFECT_POSITIONS9)
-        GE_VALIDATE_AND_SET(COLOR_GRADIENT_EFFECT_POSITIONS10)
-        GE_VALIDATE_AND_SET(COLOR_GRADIENT_EFFECT_POSITIONS11)
-        GE_VALIDATE_AND_SET(DISTORT_CHROMA_GRANULARITY)
-        GE_VALIDATE_AND_SET(DISTORT_CHROMA_DISTORT_FACTOR)
-        GE_VALIDATE_AND_SET(LIGHT_CAVE_POSITION)
-        GE_VALIDATE_AND_SET(LIGHT_CAVE_RADIUS_X_Y)
-        GE_VALIDATE_AND_SET(NOISY_FRAME_GRADIENT_MASK_INNER_FRAME_WIDTH)
-        GE_VALIDATE_AND_SET(NOISY_FRAME_GRADIENT_MASK_MIDDLE_FRAME_WIDTH)
-        GE_VALIDATE_AND_SET(NOISY_FRAME_GRADIENT_MASK_OUTSIDE_FRAME_WIDTH)
-        GE_VALIDATE_AND_SET(NOISY_FRAME_GRADIENT_MASK_R_RECT_W_H)
-        GE_VALIDATE_AND_SET(NOISY_FRAME_GRADIENT_MASK_R_RECT_POS)
-        GE_VALIDATE_AND_SET(ROUNDED_RECT_FLOWLIGHT_START_END_POSITION)
-        default:
-            GE_LOGE("SetParamsMemberByTag<std::pair<float, float>>: No matching case for tag %{public}u (filter type "
-                    "%{public}u, params type %{public}u)",
-                static_cast<uint32_t>(tag), static_cast<uint32_t>(expectedFilterType),
-                static_cast<uint32_t>(params.GetType()));
-            break;
-    }
-}
-
-void GEParamsMemberHelper::SetParamsMemberByTag(
-    GEFilterParams& params, GEParamsMemberTag tag, const std::shared_ptr<Drawing::GEShaderShape>& value)
-{
-    auto expectedFilterType = GetFilterTypeFromTag(tag);
-    if (params.GetType() != expectedFilterType) {
-        return;
-    }
-
-    switch (tag) {
-        GE_VALIDATE_AND_SET(BORDER_SDF_LG_COLOR_SHAPE)
-        GE_VALIDATE_AND_SET(BORDER_SDF_SHADER_SHAPE)
-        GE_VALIDATE_AND_SET(FROSTED_GLASS_EFFECT_SDF_SHAPE)
-        GE_VALIDATE_AND_SET(FROSTED_GLASS_SDF_SHAPE)
-        GE_VALIDATE_AND_SET(MAGNIFIER_SDF_SHAPE)
-        GE_VALIDATE_AND_SET(SDF_BORDER_SHAPE)
-        GE_VALIDATE_AND_SET(SDF_CLIP_SHAPE)
-        GE_VALIDATE_AND_SET(SDF_COLOR_SHAPE)
-        GE_VALIDATE_AND_SET(SDF_DISTORT_OP_SHAPE_SHAPE)
-        GE_VALIDATE_AND_SET(SDF_EDGE_LIGHT_EFFECT_SDF_SHAPE)
-        GE_VALIDATE_AND_SET(SDF_EDGE_LIGHT_SDF_SHAPE)
-        GE_VALIDATE_AND_SET(SDF_SHADOW_SHAPE)
-        GE_VALIDATE_AND_SET(SDF_SMOOTH_SUB_OP_SHAPE_LEFT)
-        GE_VALIDATE_AND_SET(SDF_SMOOTH_SUB_OP_SHAPE_RIGHT)
-        GE_VALIDATE_AND_SET(SDF_SUB_OP_SHAPE_LEFT)
-        GE_VALIDATE_AND_SET(SDF_SUB_OP_SHAPE_RIGHT)
-        GE_VALIDATE_AND_SET(SDF_TRANSFORM_SHAPE_SHAPE)
-        GE_VALIDATE_AND_SET(SDF_UNION_OP_LEFT)
-        GE_VALIDATE_AND_SET(SDF_UNION_OP_RIGHT)
-        GE_VALIDATE_AND_SET(SPATIAL_GLASS_EFFECT_SDF_SHAPE)
-        default:
-            GE_LOGE("SetParamsMemberByTag<std::shared_ptr<Drawing::GEShaderShape>>: No matching case for tag "
-                    "%{public}u (filter type %{public}u, params type %{public}u)",
-                static_cast<uint32_t>(tag), static_cast<uint32_t>(expectedFilterType),
-                static_cast<uint32_t>(params.GetType()));
-            break;
-    }
-}
-
-void GEParamsMemberHelper::SetParamsMemberByTag(
-    GEFilterParams& params, GEParamsMemberTag tag, const std::shared_ptr<Drawing::Image>& value)
-{
-    auto expectedFilterType = GetFilterTypeFromTag(tag);
-    if (params.GetType() != expectedFilterType) {
-        return;
-    }
-
-    switch (tag) {
-        GE_VALIDATE_AND_SET(BLUR_BUBBLES_RISE_MASK_IMAGE)
-        GE_VALIDATE_AND_SET(DEPTH_OCCLUSION_DEPTH_MAP)
-        GE_VALIDATE_AND_SET(FROSTED_GLASS_EFFECT_BLUR_IMAGE)
-        GE_VALIDATE_AND_SET(FROSTED_GLASS_EFFECT_BLUR_IMAGE_FOR_EDGE)
-        GE_VALIDATE_AND_SET(GASIFY_BLUR_SOURCE_IMAGE)
-        GE_VALIDATE_AND_SET(GASIFY_BLUR_MASK_IMAGE)
-        GE_VALIDATE_AND_SET(GASIFY_SOURCE_IMAGE)
-        GE_VALIDATE_AND_SET(GASIFY_MASK_IMAGE)
-        GE_VALIDATE_AND_SET(GASIFY_SCALE_TWIST_SOURCE_IMAGE)
-        GE_VALIDATE_AND_SET(GASIFY_SCALE_TWIST_MASK_IMAGE)
-        GE_VALIDATE_AND_SET(IMAGE_MASK_IMAGE)
-        GE_VALIDATE_AND_SET(PIXEL_MAP_MASK_IMAGE)
-        GE_VALIDATE_AND_SET(SDF_EDGE_LIGHT_EFFECT_SDF_IMAGE)
-        GE_VALIDATE_AND_SET(SDF_EDGE_LIGHT_SDF_IMAGE)
-        GE_VALIDATE_AND_SET(SDF_PIXELMAP_SHAPE_IMAGE)
-        GE_VALIDATE_AND_SET(SPATIAL_GLASS_EFFECT_BLUR_IMAGE)
-        GE_VALIDATE_AND_SET(SPATIAL_GLASS_EFFECT_DEPTH_IMAGE)
-        GE_VALIDATE_AND_SET(USE_EFFECT_MASK_IMAGE)
-        GE_VALIDATE_AND_SET(WATER_DROPLET_TRANSITION_TOP_LAYER)
-        default:
-            GE_LOGE("SetParamsMemberByTag<std::shared_ptr<Drawing::Image>>: No matching case for tag %{public}u "
-                    "(filter type %{public}u, params type %{public}u)",
-                static_cast<uint32_t>(tag), static_cast<uint32_t>(expectedFilterType),
-                static_cast<uint32_t>(params.GetType()));
-            break;
-    }
-}
-
-void GEParamsMemberHelper::SetParamsMemberByTag(
-    GEFilterParams& params, GEParamsMemberTag tag, const std::shared_ptr<GEShaderMask>& value)
-{
-    auto expectedFilterType = GetFilterTypeFromTag(tag);
-    if (params.GetType() != expectedFilterType) {
-        return;
-    }
-
-    switch (tag) {
-        GE_VALIDATE_AND_SET(CIRCLE_FLOWLIGHT_MASK)
-        GE_VALIDATE_AND_SET(COLOR_GRADIENT_MASK)
-        GE_VALIDATE_AND_SET(DIRECTION_LIGHT_MASK)
-        GE_VALIDATE_AND_SET(DISPERSION_MASK)
-        GE_VALIDATE_AND_SET(DISPLACEMENT_DISTORT_FILTER_MASK)
-        GE_VALIDATE_AND_SET(EDGE_LIGHT_MASK)
-        GE_VALIDATE_AND_SET(FROSTED_GLASS_EFFECT_WAVE_DISTURBANCE)
-        GE_VALIDATE_AND_SET(FROSTED_GLASS_WAVE_DISTURBANCE)
-        GE_VALIDATE_AND_SET(HARMONIUM_EFFECT_MASK)
-        GE_VALIDATE_AND_SET(HARMONIUM_EFFECT_MASK_CLOCK)
-        GE_VALIDATE_AND_SET(HARMONIUM_EFFECT_USE_EFFECT_MASK)
-        GE_VALIDATE_AND_SET(MASK_TRANSITION_MASK)
-        GE_VALIDATE_AND_SET(SDF_EDGE_LIGHT_EFFECT_LIGHT_MASK)
-        GE_VALIDATE_AND_SET(SDF_EDGE_LIGHT_LIGHT_MASK)
-        GE_VALIDATE_AND_SET(SPATIAL_POINT_LIGHT_MASK)
-        GE_VALIDATE_AND_SET(VARIABLE_RADIUS_BLUR_MASK)
-        GE_VALIDATE_AND_SET(COLOR_GRADIENT_EFFECT_MASK)
-        GE_VALIDATE_AND_SET(DISTORT_CHROMA_TURBULENT_MASK)
-        GE_VALIDATE_AND_SET(DISTORT_CHROMA_MASK)
-        default:
-            GE_LOGE("SetParamsMemberByTag<std::shared_ptr<GEShaderMask>>: No matching case for tag %{public}u (filter "
-                    "type %{public}u, params type %{public}u)",
-                static_cast<uint32_t>(tag), static_cast<uint32_t>(expectedFilterType),
-                static_cast<uint32_t>(params.GetType()));
-            break;
-    }
-}
-
-void GEParamsMemberHelper::SetParamsMemberByTag(
-    GEFilterParams& params, GEParamsMemberTag tag, const std::vector<Vector2f>& value)
-{
-    auto expectedFilterType = GetFilterTypeFromTag(tag);
-    if (params.GetType() != expectedFilterType) {
-        return;
-    }
-
-    switch (tag) {
-        GE_VALIDATE_AND_SET(CONTOUR_DIAGONAL_FLOW_LIGHT_CONTOUR)
-        GE_VALIDATE_AND_SET(DOT_MATRIX_START_POINTS)
-        GE_VALIDATE_AND_SET(HARMONIUM_EFFECT_RIPPLE_POSITION)
-        default:
-            GE_LOGE("SetParamsMemberByTag<std::vector<Vector2f>>: No matching case for tag %{public}u (filter type "
-                    "%{public}u, params type %{public}u)",
-                static_cast<uint32_t>(tag), static_cast<uint32_t>(expectedFilterType),
-                static_cast<uint32_t>(params.GetType()));
-            break;
-    }
-}
-
-void GEParamsMemberHelper::SetParamsMemberByTag(
-    GEFilterParams& params, GEParamsMemberTag tag, const std::vector<Vector4f>& value)
-{
-    auto expectedFilterType = GetFilterTypeFromTag(tag);
-    if (params.GetType() != expectedFilterType) {
-        return;
-    }
-
-    switch (tag) {
-        GE_VALIDATE_AND_SET(DOT_MATRIX_EFFECT_COLORS)
-        GE_VALIDATE_AND_SET(MAP_COLOR_BY_BRIGHTNESS_COLORS)
-        default:
-            GE_LOGE("SetParamsMemberByTag<std::vector<Vector4f>>: No matching case for tag %{public}u (filter type "
-                    "%{public}u, params type %{public}u)",
-                static_cast<uint32_t>(tag), static_cast<uint32_t>(expectedFilterType),
-                static_cast<uint32_t>(params.GetType()));
-            break;
+#define GE_SET_PARAMS_MEMBER_BY_TAG(Type)                                     \
+    void GEParamsMemberHelper::SetParamsMemberByTag(                          \
+        GEFilterParams& params, GEParamsMemberTag tag, const Type& value)     \
+    {                                                                         \
+        SetMemberByKind(params, tag, GEParamsValueKind<Type>::VALUE, &value); \
     }
-}
-
-void GEParamsMemberHelper::SetParamsMemberByTag(
-    GEFilterParams& params, GEParamsMemberTag tag, const std::vector<float>& value)
-{
-    auto expectedFilterType = GetFilterTypeFromTag(tag);
-    if (params.GetType() != expectedFilterType) {
-        return;
-    }
-
-    switch (tag) {
-        GE_VALIDATE_AND_SET(COLOR_GRADIENT_COLORS)
-        GE_VALIDATE_AND_SET(COLOR_GRADIENT_POSITIONS)
-        GE_VALIDATE_AND_SET(COLOR_GRADIENT_STRENGTHS)
-        GE_VALIDATE_AND_SET(MAP_COLOR_BY_BRIGHTNESS_POSITIONS)
-        GE_VALIDATE_AND_SET(RADIAL_GRADIENT_MASK_COLORS)
-        GE_VALIDATE_AND_SET(RADIAL_GRADIENT_MASK_POSITIONS)
-        default:
-            GE_LOGE("SetParamsMemberByTag<std::vector<float>>: No matching case for tag %{public}u (filter type "
-                    "%{public}u, params type %{public}u)",
-                static_cast<uint32_t>(tag), static_cast<uint32_t>(expectedFilterType),
-                static_cast<uint32_t>(params.GetType()));
-            break;
-    }
-}
-
-void GEParamsMemberHelper::SetParamsMemberByTag(
-    GEFilterParams& params, GEParamsMemberTag tag, const std::vector<std::pair<float, float>>& value)
-{
-    auto expectedFilterType = GetFilterTypeFromTag(tag);
-    if (params.GetType() != expectedFilterType) {
-        return;
-    }
-
-    switch (tag) {
-        GE_VALIDATE_AND_SET(LINEAR_GRADIENT_BLUR_FRACTION_STOPS)
-        GE_VALIDATE_AND_SET(LINEAR_GRADIENT_MASK_FRACTION_STOPS)
-        default:
-            GE_LOGE("SetParamsMemberByTag<std::vector<std::pair<float, float>>>: No matching case for tag %{public}u "
-                    "(filter type %{public}u, params type %{public}u)",
-                static_cast<uint32_t>(tag), static_cast<uint32_t>(expectedFilterType),
-                static_cast<uint32_t>(params.GetType()));
-            break;
-    }
-}
-
-void GEParamsMemberHelper::SetParamsMemberByTag(
-    GEFilterParams& params, GEParamsMemberTag tag, const std::weak_ptr<Drawing::Image>& value)
-{
-    auto expectedFilterType = GetFilterTypeFromTag(tag);
-    if (params.GetType() != expectedFilterType) {
-        return;
-    }
-
-    switch (tag) {
-        GE_VALIDATE_AND_SET(FROSTED_GLASS_EFFECT_BLUR_IMAGE)
-        GE_VALIDATE_AND_SET(FROSTED_GLASS_EFFECT_BLUR_IMAGE_FOR_EDGE)
-        GE_VALIDATE_AND_SET(SPATIAL_GLASS_EFFECT_BLUR_IMAGE)
-        GE_VALIDATE_AND_SET(SPATIAL_GLASS_EFFECT_DEPTH_IMAGE)
-        GE_VALIDATE_AND_SET(USE_EFFECT_MASK_IMAGE)
-        default:
-            GE_LOGE("SetParamsMemberByTag<std::weak_ptr<Drawing::Image>>: No matching case for tag %{public}u (filter "
-                    "type %{public}u, params type %{public}u)",
-                static_cast<uint32_t>(tag), static_cast<uint32_t>(expectedFilterType),
-                static_cast<uint32_t>(params.GetType()));
-            break;
-    }
-}
-
-void GEParamsMemberHelper::SetParamsMemberByTag(GEFilterParams& params, GEParamsMemberTag tag, const uint32_t& value)
-{
-    auto expectedFilterType = GetFilterTypeFromTag(tag);
-    if (params.GetType() != expectedFilterType) {
-        return;
-    }
-
-    switch (tag) {
-        GE_VALIDATE_AND_SET(MAGNIFIER_GRADIENT_MASK_COLOR1)
-        GE_VALIDATE_AND_SET(MAGNIFIER_GRADIENT_MASK_COLOR2)
-        GE_VALIDATE_AND_SET(MAGNIFIER_OUTER_CONTOUR_COLOR1)
-        GE_VALIDATE_AND_SET(MAGNIFIER_OUTER_CONTOUR_COLOR2)
-        GE_VALIDATE_AND_SET(SDF_UNION_OP_OP)
-        GE_VALIDATE_AND_SET(WATER_RIPPLE_WAVE_COUNT)
-        GE_VALIDATE_AND_SET(WATER_RIPPLE_RIPPLE_MODE)
-        default:
-            GE_LOGE("SetParamsMemberByTag<uint32_t>: No matching case for tag %{public}u (filter type %{public}u, "
-                    "params type %{public}u)",
-                static_cast<uint32_t>(tag), static_cast<uint32_t>(expectedFilterType),
-                static_cast<uint32_t>(params.GetType()));
-            break;
-    }
-}
 
-#undef GE_VALIDATE_AND_SET
+FOR_EACH_PARAM_TYPE(GE_SET_PARAMS_MEMBER_BY_TAG)
+#undef GE_SET_PARAMS_MEMBER_BY_TAG
 
 } // namespace Drawing
 } // namespace Rosen
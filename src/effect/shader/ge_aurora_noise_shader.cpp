@@ -12,6 +12,9 @@
  * See the License for the specific language governing permissions and
  * limitations under the License.
  */
+#include <cmath>
+#include <limits>
+
 #include "ge_log.h"
 #include "ge_aurora_noise_shader.h"
 #include "ge_shader_diagnostics.h"
@@ -19,6 +22,21 @@
 
 namespace OHOS {
 namespace Rosen {
+namespace {
+bool FloatEqual(float a, float b)
+{
+    return std::abs(a - b) <= std::numeric_limits<float>::epsilon();
+}
+
+// Noise images kept in cacheAnyPtr_ across frames, along with the parameters and down-sampled size they were made for
+struct AuroraNoiseCacheData {
+    std::shared_ptr<Drawing::Image> noiseImg;
+    std::shared_ptr<Drawing::Image> verticalBlurImg;
+    Drawing::GEAuroraNoiseShaderParams params;
+    int width = 0;
+    int height = 0;
+};
+} // namespace
 
 GEAuroraNoiseShader::GEAuroraNoiseShader() {}
 
@@ -245,10 +263,36 @@ void GEAuroraNoiseShader::Preprocess(Drawing::Canvas& canvas, const Drawing::Rec
     Drawing::Rect dsRect {0.0f, 0.0f, 0.125f * rect.GetWidth(), 0.125f * rect.GetHeight()}; // 0.125: 8x downSample
     Drawing::ImageInfo downSampledImg(std::ceil(dsRect.GetWidth()), dsRect.GetHeight(),
         Drawing::ColorType::COLORTYPE_RGBA_8888, Drawing::AlphaType::ALPHATYPE_OPAQUE);
-    noiseImg_ = MakeAuroraNoiseGeneratorShader(canvas, downSampledImg);
     Drawing::ImageInfo verticalBlurImgInf(dsRect.GetWidth(), dsRect.GetHeight(),
         Drawing::ColorType::COLORTYPE_RGBA_8888, Drawing::AlphaType::ALPHATYPE_OPAQUE);
+    // The generator and blur passes only depend on the noise parameters and size, skip them while both are unchanged
+    if (IsNoiseImgReusable(downSampledImg)) {
+        auto cache = std::any_cast<AuroraNoiseCacheData>(cacheAnyPtr_.get());
+        noiseImg_ = cache->noiseImg;
+        verticalBlurImg_ = cache->verticalBlurImg;
+        return;
+    }
+    noiseImg_ = MakeAuroraNoiseGeneratorShader(canvas, downSampledImg);
     verticalBlurImg_ = MakeAuroraNoiseVerticalBlurShader(canvas, verticalBlurImgInf);
+    if (noiseImg_ == nullptr || verticalBlurImg_ == nullptr) {
+        return;
+    }
+    AuroraNoiseCacheData newCache { noiseImg_, verticalBlurImg_, auroraNoiseParams_, downSampledImg.GetWidth(),
+        downSampledImg.GetHeight() };
+    cacheAnyPtr_ = std::make_shared<std::any>(std::move(newCache));
+}
+
+bool GEAuroraNoiseShader::IsNoiseImgReusable(const Drawing::ImageInfo& imageInfo) const
+{
+    if (cacheAnyPtr_ == nullptr || !cacheAnyPtr_->has_value()) {
+        return false;
+    }
+    auto cache = std::any_cast<AuroraNoiseCacheData>(cacheAnyPtr_.get());
+    return cache != nullptr && cache->noiseImg != nullptr && cache->verticalBlurImg != nullptr &&
+        cache->width == imageInfo.GetWidth() && cache->height == imageInfo.GetHeight() &&
+        FloatEqual(cache->params.noise_, auroraNoiseParams_.noise_) &&
+        FloatEqual(cache->params.freqX_, auroraNoiseParams_.freqX_) &&
+        FloatEqual(cache->params.freqY_, auroraNoiseParams_.freqY_);
 }
 
 std::shared_ptr<Drawing::Image> GEAuroraNoiseShader::MakeAuroraNoiseGeneratorShader(Drawing::Canvas& canvas,
@@ -17,23 +17,17 @@
 
 #include <algorithm>
 #include <array>
-#ifdef GE_OHOS
-#include <charconv>
-#include <cstdlib>
-#endif
 #include <iomanip>
 #include <sstream>
 #include <string>
 
 #include "common/rs_vector2.h"
 #include "draw/surface.h"
+#include "ge_feature_flags.h"
 #include "ge_kawase_blur_shader_filter.h"
 #include "ge_mesa_blur_shader_filter.h"
 #include "ge_log.h"
 #include "ge_shader_diagnostics.h"
-#ifdef GE_OHOS
-#include "ge_system_properties.h"
-#endif
 #include "ge_visual_effect_impl.h"
 
 #ifdef USE_M133_SKIA
@@ -45,31 +39,9 @@
 namespace OHOS {
 namespace Rosen {
 
-#ifdef GE_OHOS
-int ConvertToInt(const char* originValue, int defaultValue)
-{
-    if (originValue == nullptr) {
-        return defaultValue;
-    }
-    int value = defaultValue;
-    auto result = std::from_chars(originValue, originValue + std::strlen(originValue), value);
-    if (result.ec == std::errc()) {
-        return value;
-    } else {
-        return defaultValue;
-    }
-}
-#endif
-
 bool GetSwitchMESABlurEnable()
 {
-#ifdef GE_OHOS
-    static CachedHandle handle = CachedParameterCreate("persist.graphic.contourdiagnalmesa.enabled", "1");
-    int32_t changed = 0;
-    return ConvertToInt(CachedParameterGetChanged(handle, &changed), 1) != 0;
-#else
-    return true;
-#endif
+    return GEFeatureFlags::GetInstance().IsEnabled(GEFeatureFlag::CONTOUR_DIAGONAL_MESA);
 }
 
 using CacheDataType = struct CacheData {
@@ -77,6 +49,10 @@ using CacheDataType = struct CacheData {
     std::shared_ptr<Drawing::Image> blurredSdfMaskImg = nullptr;
     uint32_t hash = 0;
     float blurRadius = 0.0f;
+    // Geometry signature: the images are computed at width x height and resampled for nearby sizes
+    float width = 0.0f;
+    float height = 0.0f;
+    std::shared_ptr<Drawing::ColorSpace> colorSpace = nullptr;
 };
 
 using namespace Drawing;
@@ -93,6 +69,10 @@ constexpr int XMIN_I = 0;
 constexpr int XMAX_I = 1;
 constexpr int YMIN_I = 2;
 constexpr int YMAX_I = 3;
+// Cached precalculation is resampled while the size stays within this factor of the cached one
+constexpr float CACHE_RESAMPLE_MAX_SCALE = 1.25f;
+// NDC depends on the aspect ratio, the cache is only resampled for the same aspect within this tolerance
+constexpr float CACHE_ASPECT_TOLERANCE = 0.01f;
 constexpr Drawing::ColorType RGBA_F16 = Drawing::ColorType::COLORTYPE_RGBA_F16;
 constexpr bool NOT_BUDGETED = false;
 // shader
@@ -714,9 +694,12 @@ bool FEqual(float a, float b)
     return std::abs(a - b) <= std::numeric_limits<float>::epsilon();
 }
 
-bool IntersectBBox(const Box4f& a, const Box4f& b)
+bool SameColorSpace(const std::shared_ptr<Drawing::ColorSpace>& a, const std::shared_ptr<Drawing::ColorSpace>& b)
 {
-    return !(a[XMAX_I] < b[XMIN_I] || a[XMIN_I] > b[XMAX_I] || a[YMAX_I] < b[YMIN_I] || a[YMIN_I] > b[YMAX_I]);
+    if (a == nullptr || b == nullptr) {
+        return a == b;
+    }
+    return a->Equals(b);
 }
 } // anonymous namespace
 
@@ -804,8 +787,9 @@ void GEContourDiagonalFlowLightShader::Preprocess(Drawing::Canvas& canvas, const
     pointCnt_ = contourDiagonalFlowLightParams_.contour_.size();
     auto inHash = CalHash(contourDiagonalFlowLightParams_.contour_);
     float inRadius = contourDiagonalFlowLightParams_.haloRadius_;
-    if (cacheAnyPtr_ == nullptr ||  inHash != std::any_cast<CacheDataType>(*cacheAnyPtr_).hash ||
-        !FEqual(inRadius, std::any_cast<CacheDataType>(*cacheAnyPtr_).blurRadius)) {
+    auto canvasSurface = canvas.GetSurface();
+    auto colorSpace = canvasSurface ? canvasSurface->GetImageInfo().GetColorSpace() : nullptr;
+    if (!IsCacheReusable(rect, inHash, inRadius, colorSpace)) {
         auto ndcPoints = ConvertUVToNDC(contourDiagonalFlowLightParams_.contour_, rect.GetWidth(), rect.GetHeight());
         CreateSurfaceAndCanvas(canvas, rect);
         if (offscreenSurface_ == nullptr || offscreenCanvas_ == nullptr) {
@@ -827,6 +811,9 @@ void GEContourDiagonalFlowLightShader::Preprocess(Drawing::Canvas& canvas, const
         CacheDataType cacheData;
         cacheData.hash = inHash;
         cacheData.blurRadius = inRadius;
+        cacheData.width = rect.GetWidth();
+        cacheData.height = rect.GetHeight();
+        cacheData.colorSpace = colorSpace;
 
         auto cacheImg = offscreenSurface_->GetImageSnapshot();
         if (cacheImg) {
@@ -841,6 +828,28 @@ void GEContourDiagonalFlowLightShader::Preprocess(Drawing::Canvas& canvas, const
     }
 }
 
+bool GEContourDiagonalFlowLightShader::IsCacheReusable(const Drawing::Rect& rect, uint32_t hash, float blurRadius,
+    const std::shared_ptr<Drawing::ColorSpace>& colorSpace) const
+{
+    if (cacheAnyPtr_ == nullptr) {
+        return false;
+    }
+    const auto& cache = std::any_cast<const CacheDataType&>(*cacheAnyPtr_);
+    if (hash != cache.hash || !FEqual(blurRadius, cache.blurRadius) || !SameColorSpace(colorSpace, cache.colorSpace)) {
+        return false;
+    }
+    if (cache.width <= 0.0f || cache.height <= 0.0f) {
+        return false;
+    }
+    float cachedAspect = cache.width / cache.height;
+    float aspect = rect.GetWidth() / rect.GetHeight();
+    if (std::abs(aspect - cachedAspect) > CACHE_ASPECT_TOLERANCE * cachedAspect) {
+        return false;
+    }
+    float scale = rect.GetHeight() / cache.height;
+    return scale <= CACHE_RESAMPLE_MAX_SCALE && scale * CACHE_RESAMPLE_MAX_SCALE >= 1.0f;
+}
+
 void GEContourDiagonalFlowLightShader::AutoPartitionCal(Drawing::Canvas& canvas, const Drawing::Rect& rect)
 {
     if (offscreenCanvas_ == nullptr) {
@@ -872,51 +881,11 @@ void GEContourDiagonalFlowLightShader::AutoGridPartition(int width, int height,
     std::vector<Box4f> curveBBoxes;
     Box4f canvasBBox;
     ComputeAllCurveBoundingBoxes(width, height, maxThickness, canvasBBox, curveBBoxes);
-    // init workQueue
-    std::queue<Grid> workQueue;
-    InitializeWorkQueue(canvasBBox, curveBBoxes, workQueue);
-    // grid Partition
-    while (!workQueue.empty()) {
-        Grid current = workQueue.front();
-        workQueue.pop();
-        // cal grid size
-        float w = current.bbox[1] - current.bbox[0];
-        float h = current.bbox[3] - current.bbox[2];
-        // check is need to split
-        bool needsSplit = (static_cast<int>(current.curveIndices.size()) > MAX_CURVES_PER_GRID) &&
-            (w > MIN_GRID_SIZE && h > MIN_GRID_SIZE);
-        if (needsSplit) {
-            SplitGrid(current, curveBBoxes, workQueue, MIN_GRID_SIZE);
-        } else {
-            ProcessFinalGrid(current, curveBBoxes, height);
-        }
-    }
-}
-
-void GEContourDiagonalFlowLightShader::SplitGrid(const Grid& current, const std::vector<Box4f>& curveBBoxes,
-    std::queue<Grid>& workQueue, float minGridSize)
-{
-    // partition grid - quadtree
-    float midX = (current.bbox[XMIN_I] + current.bbox[XMAX_I]) * 0.5f;
-    float midY = (current.bbox[YMIN_I] + current.bbox[YMAX_I]) * 0.5f;
-    Box4f quadrants[4] = {
-        {current.bbox[XMIN_I], midX, current.bbox[YMIN_I], midY}, // Top-Left
-        {midX, current.bbox[XMAX_I], current.bbox[YMIN_I], midY}, // Top-Right
-        {current.bbox[XMIN_I], midX, midY, current.bbox[YMAX_I]}, // Bottom-Left
-        {midX, current.bbox[XMAX_I], midY, current.bbox[YMAX_I]}  // Bottom-Right
-    };
-    for (const auto& quad : quadrants) {
-        Grid child{quad, {}};
-        // find intersecting curves
-        for (int idx : current.curveIndices) {
-            if (IntersectBBox(child.bbox, curveBBoxes[idx])) {
-                child.curveIndices.push_back(idx);
-            }
-        }
-        // add node to workqueue
-        if (!child.curveIndices.empty()) {
-            workQueue.push(child);
-        }
+    // grid Partition, curves outside the canvas are dropped by the binning
+    binning_.Build(canvasBBox, curveBBoxes, { static_cast<uint32_t>(MAX_CURVES_PER_GRID),
+        static_cast<float>(MIN_GRID_SIZE), GESpatialBinning::SplitMode::QUAD });
+    for (const auto& cell : binning_.GetCells()) {
+        ProcessFinalGrid(cell.bbox, binning_.GetCellItems(cell), cell.count, height);
     }
 }
 
@@ -1020,30 +989,17 @@ Box4f GEContourDiagonalFlowLightShader::ComputeCurveBoundingBox(
     return {minX, maxX, minY, maxY};
 }
 
-void GEContourDiagonalFlowLightShader::InitializeWorkQueue(
-    const Box4f& canvasBBox, const std::vector<Box4f>& curveBBoxes, std::queue<Grid>& workQueue)
-{
-    // init root grid
-    std::vector<int> initialCurves;
-    for (size_t i = 0; i < numCurves_; ++i) {
-        if (IntersectBBox(canvasBBox, curveBBoxes[i])) {
-            initialCurves.push_back(i);
-        }
-    }
-    workQueue.push({canvasBBox, initialCurves});
-}
-
 void GEContourDiagonalFlowLightShader::ProcessFinalGrid(
-    Grid& current, const std::vector<Box4f>& curveBBoxes, int height)
+    const Box4f& bbox, const uint32_t* curveIndices, uint32_t count, int height)
 {
-    Grid processedGrid = current;
     std::vector<float> gridCurves;
     std::vector<float> inOrderSeg;
     constexpr int slidingWindowLen = 4; // curve 3 point(6 value), slidingWindowLen is 4
     // since only a partial image is captured, the following shifts need to be applied.
-    float xShift = 2*processedGrid.bbox[0] / static_cast<float>(height);
-    float yShift = 2*processedGrid.bbox[2] / static_cast<float>(height);
-    for (int idx : processedGrid.curveIndices) {
+    float xShift = 2*bbox[0] / static_cast<float>(height);
+    float yShift = 2*bbox[2] / static_cast<float>(height);
+    for (uint32_t i = 0; i < count; ++i) {
+        size_t idx = curveIndices[i];
         gridCurves.push_back(controlPoints_[slidingWindowLen * idx] - xShift);      // start point x
         gridCurves.push_back(controlPoints_[slidingWindowLen * idx + 1] - yShift);  // start point y
         gridCurves.push_back(controlPoints_[slidingWindowLen * idx + 2] - xShift);  // 2:control point x
@@ -1055,7 +1011,7 @@ void GEContourDiagonalFlowLightShader::ProcessFinalGrid(
         
         inOrderSeg.push_back(static_cast<float>(idx));
     }
-    curvesInGrid_.push_back(std::make_pair(gridCurves, processedGrid));
+    curvesInGrid_.push_back(std::make_pair(gridCurves, Grid { bbox }));
     segmentIndex_.push_back(inOrderSeg);
 }
 
@@ -1092,7 +1048,10 @@ std::shared_ptr<Drawing::Image> GEContourDiagonalFlowLightShader::DrawRuntimeSha
     auto width = rect.GetWidth();
     auto height = rect.GetHeight();
     builder_ = GetContourDiagonalFlowLightBuilder();
+    // The cache may have been computed for a nearby size, stretch it over the rect
     Drawing::Matrix matrix;
+    matrix.SetScale(width / static_cast<float>(precalculationImage->GetWidth()),
+        height / static_cast<float>(precalculationImage->GetHeight()));
     auto precalculationShader = Drawing::ShaderEffect::CreateImageShader(*precalculationImage, Drawing::TileMode::CLAMP,
         Drawing::TileMode::CLAMP, Drawing::SamplingOptions(Drawing::FilterMode::LINEAR), matrix);
     const float defaultLineLength = 0.3f;
@@ -1126,7 +1085,8 @@ std::shared_ptr<Drawing::Image> GEContourDiagonalFlowLightShader::DrawRuntimeSha
 std::shared_ptr<Drawing::Image> GEContourDiagonalFlowLightShader::DrawWithLightSurface(Drawing::Canvas& canvas,
     std::shared_ptr<Drawing::RuntimeShaderBuilder> builder, const Drawing::ImageInfo& imageInfo)
 {
-    if (lightSurface_ == nullptr) {
+    if (lightSurface_ == nullptr || lightSurface_->GetImageInfo().GetWidth() != imageInfo.GetWidth() ||
+        lightSurface_->GetImageInfo().GetHeight() != imageInfo.GetHeight()) {
         lightSurface_ = Drawing::Surface::MakeRenderTarget(canvas.GetGPUContext().get(), NOT_BUDGETED, imageInfo);
     }
     if (builder == nullptr || lightSurface_ == nullptr) {
@@ -382,17 +382,27 @@ void GEFrostedGlassEffect::MakeDrawingShader(Drawing::Canvas& canvas, const Draw
         return;
     }
 
-    auto shader = Drawing::ShaderEffect::CreateImageShader(*cachedBlurImage, Drawing::TileMode::CLAMP,
-        Drawing::TileMode::CLAMP, Drawing::SamplingOptions(Drawing::FilterMode::LINEAR), Drawing::Matrix());
-    if (shader == nullptr) {
-        GE_LOGE("GEFrostedGlassEffect::create shader failed.");
-        return;
-    }
+    auto& sdfShape = frostedGlassEffectParams_.sdfShape;
+    uint32_t shapeHash = sdfShape ? sdfShape->GetHash() : 0;
+    auto builder = GetCachedShaderBuilder(cachedBlurImage->GetUniqueID(), shapeHash, rect);
+    if (builder != nullptr) {
+        // Same blur image and shape, the child shaders are kept and only the uniforms follow this frame
+        FrostedGlassEffect::InterpolateAdaptiveParams(frostedGlassEffectParams_);
+        SetFrostedGlassUniforms(*builder, rect);
+    } else {
+        auto shader = Drawing::ShaderEffect::CreateImageShader(*cachedBlurImage, Drawing::TileMode::CLAMP,
+            Drawing::TileMode::CLAMP, Drawing::SamplingOptions(Drawing::FilterMode::LINEAR), Drawing::Matrix());
+        if (shader == nullptr) {
+            GE_LOGE("GEFrostedGlassEffect::create shader failed.");
+            return;
+        }
 
-    auto builder = MakeFrostedGlassShader(canvas, shader, rect);
-    if (builder == nullptr) {
-        GE_LOGE("GEFrostedGlassEffect::OnProcessImage builder is null");
-        return;
+        builder = MakeFrostedGlassShader(canvas, shader, rect);
+        if (builder == nullptr) {
+            GE_LOGE("GEFrostedGlassEffect::OnProcessImage builder is null");
+            return;
+        }
+        SetCachedShaderBuilder(cachedBlurImage->GetUniqueID(), shapeHash, rect, builder);
     }
 
     auto frostedGlassShader = builder->MakeShader(nullptr, false);
@@ -450,36 +460,41 @@ std::shared_ptr<Drawing::RuntimeShaderBuilder> GEFrostedGlassEffect::MakeFrosted
     builder->SetChild("image", imageShader);
     builder->SetChild("edgeBlurredImg", imageShader);
     builder->SetChild("bgBlurredImg", imageShader);
-    builder->SetUniform("iResolution", imageWidth, imageHeight);
     builder->SetChild("sdfNormalImg", sdfNormalShader);
-    builder->SetUniform("borderWidth", frostedGlassEffectParams_.envLightParams[NUM_0]);
-    builder->SetUniform("offset", 0.0f);
-    builder->SetUniform("downSampleFactor", 1.0f);
+    SetFrostedGlassUniforms(*builder, rect);
+    return builder;
+}
+
+void GEFrostedGlassEffect::SetFrostedGlassUniforms(Drawing::RuntimeShaderBuilder& builder, const Drawing::Rect& rect)
+{
+    builder.SetUniform("iResolution", rect.GetWidth(), rect.GetHeight());
+    builder.SetUniform("borderWidth", frostedGlassEffectParams_.envLightParams[NUM_0]);
+    builder.SetUniform("offset", 0.0f);
+    builder.SetUniform("downSampleFactor", 1.0f);
     // Background darken parameter
-    builder->SetUniform("bgFactor", 1.0f);
+    builder.SetUniform("bgFactor", 1.0f);
     // Inner shadow parameters
-    builder->SetUniform("innerShadowRefractPx", frostedGlassEffectParams_.sdParams[NUM_0]);
-    builder->SetUniform("innerShadowWidth", frostedGlassEffectParams_.sdParams[NUM_1]);
-    builder->SetUniform("sdK", frostedGlassEffectParams_.sdKBS[NUM_0]);
-    builder->SetUniform("sdB", frostedGlassEffectParams_.sdKBS[NUM_1]);
-    builder->SetUniform("sdS", frostedGlassEffectParams_.sdKBS[NUM_2]);
+    builder.SetUniform("innerShadowRefractPx", frostedGlassEffectParams_.sdParams[NUM_0]);
+    builder.SetUniform("innerShadowWidth", frostedGlassEffectParams_.sdParams[NUM_1]);
+    builder.SetUniform("sdK", frostedGlassEffectParams_.sdKBS[NUM_0]);
+    builder.SetUniform("sdB", frostedGlassEffectParams_.sdKBS[NUM_1]);
+    builder.SetUniform("sdS", frostedGlassEffectParams_.sdKBS[NUM_2]);
     // Env refraction parameters
-    builder->SetUniform("refractOutPx", frostedGlassEffectParams_.refractOutPx);
-    builder->SetUniform("envK", frostedGlassEffectParams_.envLightKBS[NUM_0]);
-    builder->SetUniform("envB", frostedGlassEffectParams_.envLightKBS[NUM_1]);
-    builder->SetUniform("envS", frostedGlassEffectParams_.envLightKBS[NUM_2]);
+    builder.SetUniform("refractOutPx", frostedGlassEffectParams_.refractOutPx);
+    builder.SetUniform("envK", frostedGlassEffectParams_.envLightKBS[NUM_0]);
+    builder.SetUniform("envB", frostedGlassEffectParams_.envLightKBS[NUM_1]);
+    builder.SetUniform("envS", frostedGlassEffectParams_.envLightKBS[NUM_2]);
     // Edge highlights parameters
-    builder->SetUniform("highLightAngleDeg", frostedGlassEffectParams_.edLightAngles[NUM_0]);
-    builder->SetUniform("highLightFeatherDeg", frostedGlassEffectParams_.edLightAngles[NUM_1]);
-    builder->SetUniform("highLightWidthPx", frostedGlassEffectParams_.edLightParams[NUM_0]);
-    builder->SetUniform("highLightFeatherPx", frostedGlassEffectParams_.edLightParams[NUM_1]);
-    builder->SetUniform("highLightShiftPx", 0.0f);
-    builder->SetUniform("highLightDirection", frostedGlassEffectParams_.edLightDir[NUM_0],
-                        frostedGlassEffectParams_.edLightDir[NUM_1]);
-    builder->SetUniform("hlK", frostedGlassEffectParams_.edLightKBS[NUM_0]);
-    builder->SetUniform("hlB", frostedGlassEffectParams_.edLightKBS[NUM_1]);
-    builder->SetUniform("hlS", frostedGlassEffectParams_.edLightKBS[NUM_2]);
-    return builder;
+    builder.SetUniform("highLightAngleDeg", frostedGlassEffectParams_.edLightAngles[NUM_0]);
+    builder.SetUniform("highLightFeatherDeg", frostedGlassEffectParams_.edLightAngles[NUM_1]);
+    builder.SetUniform("highLightWidthPx", frostedGlassEffectParams_.edLightParams[NUM_0]);
+    builder.SetUniform("highLightFeatherPx", frostedGlassEffectParams_.edLightParams[NUM_1]);
+    builder.SetUniform("highLightShiftPx", 0.0f);
+    builder.SetUniform("highLightDirection", frostedGlassEffectParams_.edLightDir[NUM_0],
+                       frostedGlassEffectParams_.edLightDir[NUM_1]);
+    builder.SetUniform("hlK", frostedGlassEffectParams_.edLightKBS[NUM_0]);
+    builder.SetUniform("hlB", frostedGlassEffectParams_.edLightKBS[NUM_1]);
+    builder.SetUniform("hlS", frostedGlassEffectParams_.edLightKBS[NUM_2]);
 }
 } // namespace Rosen
 } // namespace OHOS
\ No newline at end of file
@@ -14,6 +14,7 @@
  */
 
 #include "ge_log.h"
+#include "ge_noise_atlas.h"
 #include "ge_particle_circular_halo_shader.h"
 #include "ge_shader_diagnostics.h"
 #include "ge_visual_effect_impl.h"
@@ -23,6 +24,8 @@ namespace Rosen {
 namespace {
     static constexpr char GLOW_HALO_PROG[] = R"(
         uniform half2 iResolution;
+        uniform shader noiseAtlas;
+        uniform float noiseTexelsPerCell;
         const half2 rotationCenter = half2(0.5);
         const float DOWN_SAMPLE_SCALE = 4.0;
 
@@ -30,38 +33,16 @@ namespace {
         const float PI = 3.14159;
         const float PI2 = 6.28318;
 
-        const half2 RAND2_A = half2(127.1, 1.7);
-        const half2 RAND2_B = half2(269.5, 183.3);
-        const float RAND2_MUL = 4258.5453123;
         // ****************************** Sub-functions ******************************
-        half2 Random2D(half2 st)
-        {
-            st = half2(dot(st, RAND2_A), dot(st, RAND2_B));
-            return -1.0 + 2.0 * fract(sin(st) * RAND2_MUL);
-        }
-
+        // Baked by GENoiseAtlas: r holds 2D gradient noise, g holds 1D value noise
         float Noise2D(half2 st)
         {
-            half2 i = floor(st);
-            half2 f = fract(st);
-            half2 u = smoothstep(0.0, 1.0, f);
-            return mix(mix(dot(Random2D(i + half2(0.0, 0.0)), f - half2(0.0, 0.0)),
-                           dot(Random2D(i + half2(1.0, 0.0)), f - half2(1.0, 0.0)), u.x),
-                       mix(dot(Random2D(i + half2(0.0, 1.0)), f - half2(0.0, 1.0)),
-                           dot(Random2D(i + half2(1.0, 1.0)), f - half2(1.0, 1.0)), u.x),
-                       u.y);
-        }
-
-        float Random1D(float x)
-        {
-            return fract(sin(x) * RAND2_MUL);
+            return noiseAtlas.eval(vec2(st) * noiseTexelsPerCell).r * 2.0 - 1.0;
         }
 
         float Noise1D(float t)
         {
-            float f = fract(t);
-            float u = smoothstep(0.0, 1.0, f);
-            return mix(Random1D(floor(t)), Random1D(floor(t) + 1.0), u);
+            return noiseAtlas.eval(vec2(t * noiseTexelsPerCell, 0.5)).g;
         }
 
         float CentralAmbienceHaloBorder(half2 uv, half2 polarCoords, float radius, float animationTime,
@@ -145,6 +126,8 @@ namespace {
     static constexpr char SINGLE_PARTICLE_HALO_PROG[] = R"(
         uniform half2 iResolution;
         uniform half randomNoise;
+        uniform shader noiseAtlas;
+        uniform float noiseTexelsPerCell;
         const half2 rotationCenter = half2(0.5);
         const half DOWN_SAMPLE_SCALE = 4.0;
 
@@ -154,39 +137,16 @@ namespace {
         const half PI = 3.14159;
         const half PI2 = 6.28318;
 
-        const half2 RAND2_A = half2(127.1, 1.7);
-        const half2 RAND2_B = half2(269.5, 183.3);
-        const half RAND2_MUL = 2358.5453123;
-
         // ****************************** Sub-functions ******************************
-        half2 Random2D(half2 st)
-        {
-            st = half2(dot(st, RAND2_A), dot(st, RAND2_B));
-            return -1.0 + 2.0 * fract(sin(st) * RAND2_MUL);
-        }
-
+        // Baked by GENoiseAtlas: r holds 2D gradient noise, g holds 1D value noise
         half Noise2D(half2 st)
         {
-            half2 i = floor(st);
-            half2 f = fract(st);
-            half2 u = smoothstep(0.0, 1.0, f);
-            return mix(mix(dot(Random2D(i + half2(0.0, 0.0)), f - half2(0.0, 0.0)),
-                           dot(Random2D(i + half2(1.0, 0.0)), f - half2(1.0, 0.0)), u.x),
-                       mix(dot(Random2D(i + half2(0.0, 1.0)), f - half2(0.0, 1.0)),
-                           dot(Random2D(i + half2(1.0, 1.0)), f - half2(1.0, 1.0)), u.x),
-                       u.y);
-        }
-
-        half Random1D(half x)
-        {
-            return fract(sin(x) * RAND2_MUL);
+            return half(noiseAtlas.eval(vec2(st) * noiseTexelsPerCell).r * 2.0 - 1.0);
         }
 
         half Noise1D(half t)
         {
-            half f = fract(t);
-            half u = smoothstep(0.0, 1.0, f);
-            return mix(Random1D(floor(t)), Random1D(floor(t) + 1.0), u);
+            return half(noiseAtlas.eval(vec2(float(t) * noiseTexelsPerCell, 0.5)).g);
         }
 
         half2 ShapePerturbation(half2 uv, half noiseVariation, half noiseScale, half noiseStrength)
@@ -439,6 +399,9 @@ namespace {
             return fragColor;
         }
     )";
+
+    // 128 x 128 atlas, 16 lattice cells per side wrap well beyond the noise coordinates of the halo rings
+    constexpr uint32_t NOISE_ATLAS_SIZE = 128;
 }
 
 struct CacheDataType {
@@ -589,7 +552,14 @@ std::shared_ptr<Drawing::Image> GEParticleCircularHaloShader::MakeGlowHaloShader
         GE_LOGE("GEParticleCircularHaloShader MakeGlowHaloShader preCalculatedBuilder_ is nullptr.");
         return nullptr;
     }
+    auto noiseAtlas = GENoiseAtlas::GetInstance().GetShader(NOISE_ATLAS_SIZE);
+    if (noiseAtlas == nullptr) {
+        GE_LOGE("GEParticleCircularHaloShader MakeGlowHaloShader noiseAtlas is nullptr.");
+        return nullptr;
+    }
     glowHaloBuilder_->SetUniform("iResolution", width, height);
+    glowHaloBuilder_->SetChild("noiseAtlas", noiseAtlas);
+    glowHaloBuilder_->SetUniform("noiseTexelsPerCell", static_cast<float>(GENoiseAtlas::TEXELS_PER_CELL));
     auto glowHaloShader = glowHaloBuilder_->MakeImage(canvas.GetGPUContext().get(), nullptr, imageInfo, false);
     if (glowHaloShader == nullptr) {
         GE_LOGE("GEParticleCircularHaloShader glowHaloShader is nullptr.");
@@ -611,6 +581,13 @@ std::shared_ptr<Drawing::Image> GEParticleCircularHaloShader::MakeSingleParticle
     }
     singleParticleHaloBuilder_->SetUniform("iResolution", width, height);
     singleParticleHaloBuilder_->SetUniform("randomNoise", particleCircularHaloParams_.noise_);
+    auto noiseAtlas = GENoiseAtlas::GetInstance().GetShader(NOISE_ATLAS_SIZE);
+    if (noiseAtlas == nullptr) {
+        GE_LOGE("GEParticleCircularHaloShader::MakeSingleParticleHaloShader noiseAtlas is nullptr.");
+        return nullptr;
+    }
+    singleParticleHaloBuilder_->SetChild("noiseAtlas", noiseAtlas);
+    singleParticleHaloBuilder_->SetUniform("noiseTexelsPerCell", static_cast<float>(GENoiseAtlas::TEXELS_PER_CELL));
     auto singleParticleHaloShader =
         singleParticleHaloBuilder_->MakeImage(canvas.GetGPUContext().get(), nullptr, imageInfo, false);
     if (singleParticleHaloShader == nullptr) {
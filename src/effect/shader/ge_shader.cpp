@@ -17,6 +17,7 @@
 #include "draw/surface.h"
 #include "ge_cache_helper.h"
 #include "ge_log.h"
+#include "ge_system_properties.h"
 #include "ge_trace.h"
 #ifdef USE_M133_SKIA
 #include "src/core/SkChecksum.h"
@@ -33,6 +34,16 @@ struct SDFImageCache {
 auto PackSDFCacheAnyFunc = GECacheHelper::PackCacheAny<SDFImageCache>;
 auto UnpackSDFCacheAnyOrDefaultFunc = GECacheHelper::UnpackCacheAnyOrDefault<SDFImageCache>;
 
+struct ShaderBuilderCache {
+    uint32_t imageId = 0;
+    uint32_t shapeHash = 0;
+    int width = 0;
+    int height = 0;
+    std::shared_ptr<Drawing::RuntimeShaderBuilder> builder = nullptr;
+};
+auto PackBuilderCacheAnyFunc = GECacheHelper::PackCacheAny<ShaderBuilderCache>;
+auto UnpackBuilderCacheAnyOrDefaultFunc = GECacheHelper::UnpackCacheAnyOrDefault<ShaderBuilderCache>;
+
 uint32_t CalHash(std::shared_ptr<Drawing::ColorSpace> colorSpace, uint32_t hashIn = 0)
 {
 #ifdef USE_M133_SKIA
@@ -49,7 +60,7 @@ uint32_t CalHash(std::shared_ptr<Drawing::ColorSpace> colorSpace, uint32_t hashI
 }
 
 uint32_t CalHash(Drawing::Size size, bool hasNormal, uint32_t shapeHash,
-    std::shared_ptr<Drawing::ColorSpace> colorSpace)
+    std::shared_ptr<Drawing::ColorSpace> colorSpace, Drawing::GESDFImageEncoding encoding)
 {
 #ifdef USE_M133_SKIA
     const auto hashFunc = SkChecksum::Hash32;
@@ -64,10 +75,24 @@ uint32_t CalHash(Drawing::Size size, bool hasNormal, uint32_t shapeHash,
     uint8_t normalFlag = hasNormal ? 1 : 0;
     hashOut = hashFunc(&normalFlag, sizeof(normalFlag), hashOut);
     hashOut = hashFunc(&shapeHash, sizeof(shapeHash), hashOut);
+    hashOut = hashFunc(&encoding, sizeof(encoding), hashOut);
     return hashOut;
 }
 }
 
+Drawing::GESDFImageEncoding GEShader::GetDefaultSDFImageEncoding()
+{
+#ifdef GE_OHOS
+    static const auto encoding = GESystemProperties::ConvertToInt(
+        GESystemProperties::GetEventProperty("persist.sys.graphic.ge.sdfEncoding").c_str(), 0) ==
+        static_cast<int>(Drawing::GESDFImageEncoding::QUANTIZED) ?
+        Drawing::GESDFImageEncoding::QUANTIZED : Drawing::GESDFImageEncoding::FLOAT;
+    return encoding;
+#else
+    return Drawing::GESDFImageEncoding::FLOAT;
+#endif
+}
+
 bool GEShader::TryDrawShaderWithPen(Drawing::Canvas& canvas, const Drawing::Rect& rect)
 {
     auto width = rect.GetWidth();
@@ -142,10 +167,11 @@ std::shared_ptr<Drawing::ShaderEffect> GEShader::MakeSDFShaderWithCache(
     std::shared_ptr<Drawing::ColorSpace> colorSpace = canvasSurface ?
         canvasSurface->GetImageInfo().GetColorSpace() : nullptr;
     auto inputHash = CalHash(Drawing::Size(rect.GetWidth(), rect.GetHeight()), hasNormal, sdfShape->GetHash(),
-        colorSpace);
+        colorSpace, sdfImageEncoding_);
     if (inputHash != UnpackSDFCacheAnyOrDefaultFunc(cacheAnyPtr_, emptyCache).hash) {
         // gernerate cache
-        auto sdfImg = sdfShape->MakeSDFImage(canvas, rect.GetWidth(), rect.GetHeight(), hasNormal);
+        auto sdfImg = sdfShape->MakeSDFImage(canvas, rect.GetWidth(), rect.GetHeight(), hasNormal,
+            sdfImageEncoding_);
         if (sdfImg == nullptr) {
             GE_LOGE("GEShader::MakeSDFShaderWithCache make SDFImage is null");
             cacheAnyPtr_ = nullptr;
@@ -168,9 +194,36 @@ std::shared_ptr<Drawing::ShaderEffect> GEShader::MakeSDFShaderWithCache(
     GE_LOGD("GEShader::MakeSDFShaderWithCache %{public}s use cache with hash %{public}u %{public}u "
         "%{public}f %{public}f %{public}u", TypeName().data(), inputHash, sdfShape->GetHash(),
         rect.GetWidth(), rect.GetHeight(), CalHash(colorSpace));
-    Drawing::Matrix sampleMatrix;
-    return Drawing::ShaderEffect::CreateImageShader(*cacheSDFImg, Drawing::TileMode::CLAMP, Drawing::TileMode::CLAMP,
-        Drawing::SamplingOptions(Drawing::FilterMode::LINEAR), sampleMatrix);
+    return Drawing::GESDFShaderShape::MakeSDFImageShader(cacheSDFImg, sdfImageEncoding_);
+}
+
+std::shared_ptr<Drawing::RuntimeShaderBuilder> GEShader::GetCachedShaderBuilder(uint32_t imageId, uint32_t shapeHash,
+    const Drawing::Rect& rect) const
+{
+    if (shapeHash == 0 || cacheAnyPtr_ == nullptr) {
+        return nullptr;
+    }
+    const ShaderBuilderCache emptyCache{};
+    auto cache = UnpackBuilderCacheAnyOrDefaultFunc(cacheAnyPtr_, emptyCache);
+    if (cache.imageId != imageId || cache.shapeHash != shapeHash ||
+        cache.width != static_cast<int>(rect.GetWidth()) || cache.height != static_cast<int>(rect.GetHeight())) {
+        return nullptr;
+    }
+    GE_LOGD("GEShader::GetCachedShaderBuilder %{public}s use cache with image %{public}u shape %{public}u",
+        TypeName().data(), imageId, shapeHash);
+    return cache.builder;
+}
+
+void GEShader::SetCachedShaderBuilder(uint32_t imageId, uint32_t shapeHash, const Drawing::Rect& rect,
+    const std::shared_ptr<Drawing::RuntimeShaderBuilder>& builder) const
+{
+    if (shapeHash == 0 || builder == nullptr) {
+        cacheAnyPtr_ = nullptr;
+        return;
+    }
+    ShaderBuilderCache cacheData{imageId, shapeHash, static_cast<int>(rect.GetWidth()),
+        static_cast<int>(rect.GetHeight()), builder};
+    cacheAnyPtr_ = PackBuilderCacheAnyFunc(std::move(cacheData));
 }
 } // namespace Rosen
 } // namespace OHOS
\ No newline at end of file
@@ -59,17 +59,26 @@ void GESpatialGlassEffect::MakeDrawingShader(const Drawing::Rect& rect, float pr
         return;
     }
 
-    auto baseBlurShader = Drawing::ShaderEffect::CreateImageShader(*cachedBlurImage, Drawing::TileMode::CLAMP,
-        Drawing::TileMode::CLAMP, Drawing::SamplingOptions(Drawing::FilterMode::LINEAR), Drawing::Matrix());
-    if (baseBlurShader == nullptr) {
-        GE_LOGE("GESpatialGlassEffect::create shader failed.");
-        return;
-    }
+    auto& sdfShape = spatialGlassEffectParams_.sdfShape;
+    uint32_t shapeHash = sdfShape ? sdfShape->GetHash() : 0;
+    auto builder = GetCachedShaderBuilder(cachedBlurImage->GetUniqueID(), shapeHash, rect);
+    if (builder != nullptr) {
+        // Same blur image and shape, only the resolution uniform is refreshed
+        builder->SetUniform("iResolution", rect.GetWidth(), rect.GetHeight());
+    } else {
+        auto baseBlurShader = Drawing::ShaderEffect::CreateImageShader(*cachedBlurImage, Drawing::TileMode::CLAMP,
+            Drawing::TileMode::CLAMP, Drawing::SamplingOptions(Drawing::FilterMode::LINEAR), Drawing::Matrix());
+        if (baseBlurShader == nullptr) {
+            GE_LOGE("GESpatialGlassEffect::create shader failed.");
+            return;
+        }
 
-    auto builder = MakeSpatialGlassShader(baseBlurShader, rect);
-    if (builder == nullptr) {
-        GE_LOGE("GESpatialGlassEffect::OnProcessImage builder is null");
-        return;
+        builder = MakeSpatialGlassShader(baseBlurShader, rect);
+        if (builder == nullptr) {
+            GE_LOGE("GESpatialGlassEffect::OnProcessImage builder is null");
+            return;
+        }
+        SetCachedShaderBuilder(cachedBlurImage->GetUniqueID(), shapeHash, rect, builder);
     }
 
     auto spatialGlassShader = builder->MakeShader(nullptr, false);
@@ -23,13 +23,12 @@ namespace Rosen {
 std::shared_ptr<GEXComplexShader> GEXComplexShader::CreateDynamicImpl(const GEXComplexShaderParams& param)
 {
     auto type = static_cast<uint32_t>(Drawing::GEVisualEffectImpl::FilterType::COMPLEX_SHADER);
-    auto impl = GEExternalDynamicLoader::GetInstance().CreateGEXObjectByType(
-        type, sizeof(GEXComplexShaderParams), static_cast<void*>(const_cast<GEXComplexShaderParams*>(&param)));
+    auto impl = GEExternalDynamicLoader::GetInstance().CreateGEXObject<GEXComplexShader>(type, param);
     if (!impl) {
         GE_LOGE("GEXComplexShader::CreateDynamicImpl create object failed.");
         return nullptr;
     }
-    return std::shared_ptr<GEXComplexShader>{(static_cast<GEXComplexShader*>(impl))};
+    return impl;
 }
  
  
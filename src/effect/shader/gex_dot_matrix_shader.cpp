@@ -23,14 +23,12 @@ namespace Rosen {
 std::shared_ptr<GEXDotMatrixShader> GEXDotMatrixShader::CreateDynamicImpl(DotMatrixNormalParams& param)
 {
     auto type = static_cast<uint32_t>(Drawing::GEVisualEffectImpl::FilterType::DOT_MATRIX);
-    auto impl = GEExternalDynamicLoader::GetInstance().CreateGEXObjectByType(
-        type, sizeof(DotMatrixNormalParams), static_cast<void*>(&param));
+    auto impl = GEExternalDynamicLoader::GetInstance().CreateGEXObject<GEXDotMatrixShader>(type, param);
     if (!impl) {
         GE_LOGE("GEXDotMatrixShader::CreateDynamicImpl create object failed.");
         return nullptr;
     }
-    std::shared_ptr<GEXDotMatrixShader> dmShader(static_cast<GEXDotMatrixShader*>(impl));
-    return dmShader;
+    return impl;
 }
 
 const std::string GEXDotMatrixShader::GetDescription() const
@@ -25,7 +25,9 @@
 
 #include "common/rs_common_def.h"
 #include "draw/surface.h"
+#include "ge_intermediate_format.h"
 #include "ge_log.h"
+#include "ge_quality_governor.h"
 #include "ge_trace.h"
 
 namespace OHOS {
@@ -36,6 +38,10 @@ namespace {
 static constexpr float MIN_SCALE = 100.0f;
 static constexpr uint32_t LINE = 2;
 constexpr uint32_t MAX_CURVES_SUBMIT_PER_GRID = 20;
+constexpr uint32_t MAX_CELLS_IN_PACK = 8; // keep in sync with PRECALCULATION_FOR_SDF_SHADER
+constexpr uint32_t CELL_RECT_FLOAT_COUNT = 4;
+constexpr uint32_t CELL_RANGE_FLOAT_COUNT = 2;
+constexpr int PROPAGATION_DOWNSCALE = 2;
 constexpr uint32_t MIN_GRID_SIZE = 64;
 constexpr uint32_t CURVE_FLOAT_COUNT = 6;
 constexpr uint32_t XMIN_I = 0;
@@ -46,15 +52,9 @@ constexpr Drawing::ColorType RGBA_F16 = Drawing::ColorType::COLORTYPE_RGBA_F16;
 constexpr float MIN_SCALE_CLAMP = 0.001f;
 constexpr float NDC_MULTIPLIER = 2.0f;      // multiplier for NDC coordinate conversion
 constexpr float NDC_OFFSET = 1.0f;          // offset for NDC coordinate conversion
-constexpr float MIDPOINT_FACTOR = 0.5f;     // factor for calculating midpoint
 constexpr float MAX_ASPECT = 3.0f;          // Large aspect ratio difference
 constexpr float ALIGN_STEP = 8.0f;          // ceil the width and height of the downsampled components
 
-bool IntersectBBox(const Box4f& a, const Box4f& b)
-{
-    return !(a[XMAX_I] < b[XMIN_I] || a[XMIN_I] > b[XMAX_I] || a[YMAX_I] < b[YMIN_I] || a[YMIN_I] > b[YMAX_I]);
-}
-
 // 150.0f: default base width, 250.0f: default base height
 std::vector<Vector2f> ConvertPixelToNDC(const std::vector<Vector2f>& pixelPoints, float baseWidth = 150.0f,
     float baseHeight = 250.0f)
@@ -204,6 +204,11 @@ static const std::string PRECALCULATION_FOR_SDF_SHADER = R"(
     uniform shader u_prevD;
     uniform float u_isFirstBatch;
     uniform vec2 u_validRange;
+    // Packed cells share one draw, each pixel only tests the curves of its own cell
+    const int MAX_CELLS_IN_PACK = 8;
+    uniform float u_cellCount;
+    uniform vec4 u_cellRects[MAX_CELLS_IN_PACK];
+    uniform vec2 u_cellRanges[MAX_CELLS_IN_PACK];
 
     const float INF_1E4 = 1e4;
     const float SQRT3 = 1.7320508;
@@ -377,7 +382,7 @@ static const std::string PRECALCULATION_FOR_SDF_SHADER = R"(
         return finalD;
     }
 
-    void FindTwoClosestCurves(vec2 p, out float d1, out float d2,
+    void FindTwoClosestCurves(vec2 p, vec2 range, out float d1, out float d2,
         out vec2 c1_0, out vec2 c1_1, out vec2 c1_2,
         out vec2 c2_0, out vec2 c2_1, out vec2 c2_2, out float closestIdx)
     {
@@ -392,6 +397,8 @@ static const std::string PRECALCULATION_FOR_SDF_SHADER = R"(
         c2_2 = vec2(0.0);
 
         for (int i = 0; i < MAX_CURVES_IN_GRID; i++) {
+            if (float(i) < range.x) continue;
+            if (float(i) >= range.y) break;
             int global_curve_idx = int(segmentIndex[i]);
             if (global_curve_idx < 0) break;
 
@@ -424,6 +431,17 @@ static const std::string PRECALCULATION_FOR_SDF_SHADER = R"(
         }
     }
 
+    vec2 findCellRange(vec2 fragCoord) {
+        for (int c = 0; c < MAX_CELLS_IN_PACK; c++) {
+            if (float(c) >= u_cellCount) break;
+            vec4 r = u_cellRects[c];
+            if (fragCoord.x >= r.x && fragCoord.x < r.z && fragCoord.y >= r.y && fragCoord.y < r.w) {
+                return u_cellRanges[c];
+            }
+        }
+        return vec2(0.0, float(MAX_CURVES_IN_GRID));
+    }
+
     vec4 main(vec2 fragCoord) {
         vec2 uv = fragCoord / iResolution;
         float ndcAspect = iResolution.x / iResolution.y;
@@ -435,7 +453,8 @@ static const std::string PRECALCULATION_FOR_SDF_SHADER = R"(
         vec2 c1[3];
         vec2 c2[3];
         float closestIdx;
-        FindTwoClosestCurves(ndc, d1, d2, c1[0], c1[1], c1[2], c2[0], c2[1], c2[2], closestIdx);
+        FindTwoClosestCurves(ndc, findCellRange(fragCoord), d1, d2, c1[0], c1[1], c1[2], c2[0], c2[1], c2[2],
+            closestIdx);
         d1 = sqrt(abs(d1)) * sign(d1);
         d2 = sqrt(abs(d2)) * sign(d2);
 
@@ -455,19 +474,67 @@ static const std::string PRECALCULATION_FOR_SDF_SHADER = R"(
     }
 )";
 
-static const std::string NORMAL_CALCULATION_SHADER = R"(
+// Last propagation step at full resolution, folded with the normal calculation. u_sdfTex is the full resolution
+// input of the step, u_fieldTex the propagated field (the same image, or a lower resolution one scaled up).
+static const std::string SDF_FINAL_PASS_SHADER = R"(
     uniform vec2 iResolution;
-    uniform shader u_seeds;
     uniform float pixelScale;
+    uniform shader u_sdfTex;
+    uniform shader u_sdfLinearTex;
+    uniform shader u_fieldTex;
+    uniform shader u_maskTex;
+
+    const float INF_1E4 = 1e4;
+    const float EPSILON_1E_MINUS_3 = 0.001;
+
+    float sampleSdf(vec2 baseUv, vec2 offset) {
+        float sdf = abs(u_sdfTex.eval(baseUv + offset).r);
+        if (sdf < INF_1E4 - EPSILON_1E_MINUS_3) {
+            float ndcOffset = length(offset) * (2.0 / iResolution.y);
+            return sdf + ndcOffset;
+        }
+        return INF_1E4;
+    }
+
+    // Signed field before the last step, with the same sign rules as the propagation
+    float fieldAt(vec2 p) {
+        float mask = u_maskTex.eval(p).r;
+        float fine = u_sdfLinearTex.eval(p).r;
+        if (mask < EPSILON_1E_MINUS_3) {
+            return abs(fine);
+        }
+        if (mask < 1.0) {
+            return fine;
+        }
+        return -min(abs(fine), abs(u_fieldTex.eval(p).r));
+    }
 
     vec4 main(vec2 fragCoord) {
-        float centerSdf = u_seeds.eval(fragCoord).r * pixelScale;
+        float mask = u_maskTex.eval(fragCoord).r;
+        float currentSdf = u_sdfTex.eval(fragCoord).r;
+        float dist = currentSdf;
+        if (mask < EPSILON_1E_MINUS_3) {
+            dist = abs(currentSdf);
+        } else if (mask >= 1.0) {
+            float minSdf = min(abs(currentSdf), abs(u_fieldTex.eval(fragCoord).r));
+            minSdf = min(minSdf, sampleSdf(fragCoord, vec2(-1.0, -1.0)));
+            minSdf = min(minSdf, sampleSdf(fragCoord, vec2(0.0, -1.0)));
+            minSdf = min(minSdf, sampleSdf(fragCoord, vec2(1.0, -1.0)));
+            minSdf = min(minSdf, sampleSdf(fragCoord, vec2(-1.0, 0.0)));
+            minSdf = min(minSdf, sampleSdf(fragCoord, vec2(1.0, 0.0)));
+            minSdf = min(minSdf, sampleSdf(fragCoord, vec2(-1.0, 1.0)));
+            minSdf = min(minSdf, sampleSdf(fragCoord, vec2(0.0, 1.0)));
+            minSdf = min(minSdf, sampleSdf(fragCoord, vec2(1.0, 1.0)));
+            dist = -minSdf;
+        }
+
+        float centerSdf = dist * pixelScale;
         float h = 1.0 + clamp(abs(centerSdf) * 0.2, 0.0, 8.0);
 
-        float L = u_seeds.eval(fragCoord + vec2(-h, 0.0)).r;
-        float R = u_seeds.eval(fragCoord + vec2(h, 0.0)).r;
-        float T = u_seeds.eval(fragCoord + vec2(0.0, -h)).r;
-        float B = u_seeds.eval(fragCoord + vec2(0.0, h)).r;
+        float L = fieldAt(fragCoord + vec2(-h, 0.0));
+        float R = fieldAt(fragCoord + vec2(h, 0.0));
+        float T = fieldAt(fragCoord + vec2(0.0, -h));
+        float B = fieldAt(fragCoord + vec2(0.0, h));
 
         vec2 normal = vec2(R - L, B - T) * 0.5;
         float len = length(normal);
@@ -489,7 +556,7 @@ static const std::string CLEAR_INF_SHADER = R"(
 )";
 
 thread_local static std::shared_ptr<Drawing::RuntimeEffect> g_precalcShaderEffect_ = nullptr;
-thread_local static std::shared_ptr<Drawing::RuntimeEffect> g_normalShaderEffect_ = nullptr;
+thread_local static std::shared_ptr<Drawing::RuntimeEffect> g_finalPassShaderEffect_ = nullptr;
 thread_local static std::shared_ptr<Drawing::RuntimeEffect> g_sdfPropEffect_ = nullptr;
 thread_local static std::shared_ptr<Drawing::RuntimeEffect> g_clearInfEffect = nullptr;
 
@@ -601,16 +668,16 @@ std::shared_ptr<Drawing::RuntimeShaderBuilder> GESDFPathShaderShape::MakePrecalc
     return std::make_shared<Drawing::RuntimeShaderBuilder>(g_precalcShaderEffect_);
 }
 
-std::shared_ptr<Drawing::RuntimeShaderBuilder> GESDFPathShaderShape::MakeNormalShaderBuilder()
+std::shared_ptr<Drawing::RuntimeShaderBuilder> GESDFPathShaderShape::MakeFinalPassShaderBuilder()
 {
-    if (g_normalShaderEffect_ == nullptr) {
-        g_normalShaderEffect_ = RuntimeEffect::CreateForShader(NORMAL_CALCULATION_SHADER);
-        if (g_normalShaderEffect_ == nullptr) {
-            LOGE("GESDFPathShaderShape::MakeNormalShaderBuilder failed to create effect");
+    if (g_finalPassShaderEffect_ == nullptr) {
+        g_finalPassShaderEffect_ = RuntimeEffect::CreateForShader(SDF_FINAL_PASS_SHADER);
+        if (g_finalPassShaderEffect_ == nullptr) {
+            LOGE("GESDFPathShaderShape::MakeFinalPassShaderBuilder failed to create effect");
             return nullptr;
         }
     }
-    return std::make_shared<Drawing::RuntimeShaderBuilder>(g_normalShaderEffect_);
+    return std::make_shared<Drawing::RuntimeShaderBuilder>(g_finalPassShaderEffect_);
 }
 
 std::shared_ptr<Drawing::RuntimeShaderBuilder> GESDFPathShaderShape::MakeSdfPropShaderBuilder()
@@ -637,7 +704,8 @@ std::shared_ptr<Image> GESDFPathShaderShape::RunSDFPropagation(
         LOGD("GESDFPathShaderShape::RunSDFPropagation maskTex is null");
         return sdfTex;
     }
-    if (numPasses_ <= 0) {
+    // The last step (step 1) runs in ComputeDistanceField
+    if (numPasses_ <= 1) {
         return sdfTex;
     }
 
@@ -647,8 +715,13 @@ std::shared_ptr<Image> GESDFPathShaderShape::RunSDFPropagation(
         return sdfTex;
     }
 
-    SamplingOptions nearest(FilterMode::NEAREST, MipmapMode::NONE);
-    auto outputImageInfo = sdfTex->GetImageInfo();
+    // The long steps only carry distances across empty grids, they run at reduced resolution with halved steps
+    const bool reduced = width >= PROPAGATION_DOWNSCALE && height >= PROPAGATION_DOWNSCALE;
+    const int scale = reduced ? PROPAGATION_DOWNSCALE : 1;
+    const int passWidth = width / scale;
+    const int passHeight = height / scale;
+    auto outputImageInfo = GEIntermediateFormat::MakeImageInfo(passWidth, passHeight, sdfTex->GetImageInfo(),
+        GEIntermediateFormat::Usage::DISTANCE, 0.0f);
 
     auto builder = MakeSdfPropShaderBuilder();
     if (!builder) {
@@ -656,22 +729,27 @@ std::shared_ptr<Image> GESDFPathShaderShape::RunSDFPropagation(
         return sdfTex;
     }
 
-    auto maskShader = ShaderEffect::CreateImageShader(*maskTex, TileMode::CLAMP, TileMode::CLAMP, nearest, Matrix());
+    SamplingOptions nearest(FilterMode::NEAREST, MipmapMode::NONE);
+    Matrix fullResMatrix;
+    fullResMatrix.SetScale(static_cast<float>(passWidth) / width, static_cast<float>(passHeight) / height);
+    auto maskShader = ShaderEffect::CreateImageShader(*maskTex, TileMode::CLAMP, TileMode::CLAMP, nearest,
+        fullResMatrix);
     builder->SetChild("u_maskTex", maskShader);
-    builder->SetUniform("iResolution", static_cast<float>(width), static_cast<float>(height));
+    builder->SetUniform("iResolution", static_cast<float>(passWidth), static_cast<float>(passHeight));
 
     std::shared_ptr<Image> input = sdfTex;
     std::shared_ptr<Image> output = nullptr;
-    for (size_t i = 0; i < numPasses_; i++) {
-        int pixelStep = static_cast<int>(pow(2.0f, numPasses_ - i - 1)); // 2.0f: power base
-        auto inputSdfShader =
-            ShaderEffect::CreateImageShader(*input, TileMode::CLAMP, TileMode::CLAMP, nearest, Matrix());
+    for (size_t i = 0; i + 1 < numPasses_; i++) {
+        int pixelStep = static_cast<int>(pow(2.0f, numPasses_ - i - 1)) / scale; // 2.0f: power base
+        // The first pass reads the full resolution seeds
+        auto inputSdfShader = ShaderEffect::CreateImageShader(*input, TileMode::CLAMP, TileMode::CLAMP, nearest,
+            i == 0 ? fullResMatrix : Matrix());
         builder->SetChild("u_sdfTex", inputSdfShader);
-        builder->SetUniform("u_step", static_cast<float>(pixelStep));
+        builder->SetUniform("u_step", static_cast<float>(std::max(pixelStep, 1)));
         output = builder->MakeImage(gpuContext.get(), nullptr, outputImageInfo, false);
         if (!output) {
             LOGE("GESDFPathShaderShape::RunSDFPropagation pass %zu MakeImage failed", i);
-            return input;
+            return i == 0 ? sdfTex : input;
         }
 
         std::swap(input, output);
@@ -679,12 +757,12 @@ std::shared_ptr<Image> GESDFPathShaderShape::RunSDFPropagation(
     return input;
 }
 
-std::shared_ptr<Image> GESDFPathShaderShape::ComputeDistanceField(
-    Canvas& canvas, std::shared_ptr<Image> sdfTex, int width, int height)
+std::shared_ptr<Image> GESDFPathShaderShape::ComputeDistanceField(Canvas& canvas, std::shared_ptr<Image> sdfTex,
+    std::shared_ptr<Image> fieldTex, std::shared_ptr<Image> maskTex, int width, int height)
 {
     GE_TRACE_NAME_FMT("GESDFPathShaderShape::ComputeDistanceField");
-    if (!sdfTex) {
-        LOGE("GESDFPathShaderShape::ComputeDistanceField sdfTex is null");
+    if (!sdfTex || !fieldTex || !maskTex) {
+        LOGE("GESDFPathShaderShape::ComputeDistanceField input is null");
         return nullptr;
     }
     auto gpuContext = canvas.GetGPUContext();
@@ -692,24 +770,38 @@ std::shared_ptr<Image> GESDFPathShaderShape::ComputeDistanceField(
         LOGE("GESDFPathShaderShape::ComputeDistanceField no GPU context");
         return nullptr;
     }
+    if (fieldTex->GetWidth() <= 0 || fieldTex->GetHeight() <= 0) {
+        LOGE("GESDFPathShaderShape::ComputeDistanceField invalid field size");
+        return nullptr;
+    }
 
-    SamplingOptions nearest(FilterMode::LINEAR, MipmapMode::LINEAR);
-    auto inputImageInfo = sdfTex->GetImageInfo();
-
-    auto normalBuilder = MakeNormalShaderBuilder();
-    if (!normalBuilder) {
+    auto builder = MakeFinalPassShaderBuilder();
+    if (!builder) {
         LOGE("GESDFPathShaderShape::ComputeDistanceField effect create failed");
         return nullptr;
     }
 
-    auto inputShader = ShaderEffect::CreateImageShader(*sdfTex, TileMode::CLAMP, TileMode::CLAMP, nearest, Matrix());
-    normalBuilder->SetChild("u_seeds", inputShader);
-    normalBuilder->SetUniform("pixelScale", static_cast<float>(height * (1.0f / params_.scale.y_)));
-    normalBuilder->SetUniform("iResolution", static_cast<float>(width), static_cast<float>(height));
+    SamplingOptions nearest(FilterMode::NEAREST, MipmapMode::NONE);
+    SamplingOptions linear(FilterMode::LINEAR, MipmapMode::NONE);
+    Matrix upscaleMatrix;
+    upscaleMatrix.SetScale(static_cast<float>(width) / fieldTex->GetWidth(),
+        static_cast<float>(height) / fieldTex->GetHeight());
+    builder->SetChild("u_sdfTex",
+        ShaderEffect::CreateImageShader(*sdfTex, TileMode::CLAMP, TileMode::CLAMP, nearest, Matrix()));
+    builder->SetChild("u_sdfLinearTex",
+        ShaderEffect::CreateImageShader(*sdfTex, TileMode::CLAMP, TileMode::CLAMP, linear, Matrix()));
+    builder->SetChild("u_fieldTex",
+        ShaderEffect::CreateImageShader(*fieldTex, TileMode::CLAMP, TileMode::CLAMP, linear, upscaleMatrix));
+    builder->SetChild("u_maskTex",
+        ShaderEffect::CreateImageShader(*maskTex, TileMode::CLAMP, TileMode::CLAMP, nearest, Matrix()));
+    builder->SetUniform("pixelScale", static_cast<float>(height * (1.0f / params_.scale.y_)));
+    builder->SetUniform("iResolution", static_cast<float>(width), static_cast<float>(height));
+    auto outputImageInfo = GEIntermediateFormat::MakeImageInfo(width, height, sdfTex->GetImageInfo(),
+        GEIntermediateFormat::Usage::DISTANCE, 0.0f);
 #ifdef RS_ENABLE_GPU
-    return normalBuilder->MakeImage(gpuContext.get(), nullptr, inputImageInfo, false);
+    return builder->MakeImage(gpuContext.get(), nullptr, outputImageInfo, false);
 #else
-    return normalBuilder->MakeImage(nullptr, nullptr, inputImageInfo, false);
+    return builder->MakeImage(nullptr, nullptr, outputImageInfo, false);
 #endif
 }
 
@@ -791,67 +883,16 @@ void GESDFPathShaderShape::AutoGridPartition(float width, float height, const st
     Box4f canvasBBox;
     ComputeAllCurveBoundingBoxes(width, height, pixelControlPoints, canvasBBox, curveBBoxes);
 
-    std::queue<Grid> workQueue;
-    InitializeWorkQueue(canvasBBox, curveBBoxes, workQueue);
-
-    while (!workQueue.empty()) {
-        Grid current = workQueue.front();
-        workQueue.pop();
-        float w = current.bbox[XMAX_I] - current.bbox[XMIN_I];
-        float h = current.bbox[YMAX_I] - current.bbox[YMIN_I];
-        bool needsSplit = (current.curveIndices.size() > 4) && // 4: max curves per grid
-                          (w > MIN_GRID_SIZE || h > MIN_GRID_SIZE);
-        if (needsSplit) {
-            SplitGrid(current, curveBBoxes, workQueue, MIN_GRID_SIZE);
-        } else {
-            ProcessFinalGrid(current, curveBBoxes);
-        }
+    // 4: max curves per grid
+    binning_.Build(canvasBBox, curveBBoxes, { 4, MIN_GRID_SIZE, GESpatialBinning::SplitMode::QUAD_OR_HALF });
+    for (const auto& cell : binning_.GetCells()) {
+        ProcessFinalGrid(cell.bbox, binning_.GetCellItems(cell), cell.count);
     }
-}
-
-void GESDFPathShaderShape::SplitGrid(
-    const Grid& current, const std::vector<Box4f>& curveBBoxes, std::queue<Grid>& workQueue, float minGridSize)
-{
-    GE_TRACE_NAME_FMT("GESDFPathShaderShape::SplitGrid");
-    float midX = (current.bbox[XMIN_I] + current.bbox[XMAX_I]) * MIDPOINT_FACTOR;
-    float midY = (current.bbox[YMIN_I] + current.bbox[YMAX_I]) * MIDPOINT_FACTOR;
-
-    // Divide into four quadrants
-    std::vector<Box4f> quadrants = {
-        { current.bbox[XMIN_I], midX, current.bbox[YMIN_I], midY }, // Top-Left
-        { midX, current.bbox[XMAX_I], current.bbox[YMIN_I], midY }, // Top-Right
-        { current.bbox[XMIN_I], midX, midY, current.bbox[YMAX_I] }, // Bottom-Left
-        { midX, current.bbox[XMAX_I], midY, current.bbox[YMAX_I] }  // Bottom-Right
-    };
-
-    if (current.bbox[XMAX_I] - current.bbox[XMIN_I] <= MIN_GRID_SIZE) {
-        quadrants = {
-            { current.bbox[XMIN_I], current.bbox[XMAX_I], current.bbox[YMIN_I], midY }, // Top
-            { current.bbox[XMIN_I], current.bbox[XMAX_I], midY, current.bbox[YMAX_I] }  // Bottom
-        };
-    } else if (current.bbox[YMAX_I] - current.bbox[YMIN_I] <= MIN_GRID_SIZE) {
-        quadrants = {
-            { current.bbox[XMIN_I], midX, current.bbox[YMIN_I], current.bbox[YMAX_I] }, // Left
-            { midX, current.bbox[XMAX_I], current.bbox[YMIN_I], current.bbox[YMAX_I] }  // Right
-        };
-    }
-
-    for (const auto& quad : quadrants) {
-        Grid child { quad, {} };
-        for (int idx : current.curveIndices) {
-            if (IntersectBBox(child.bbox, curveBBoxes[idx])) {
-                child.curveIndices.push_back(idx);
-            }
-        }
-        if (!child.curveIndices.empty()) {
-            workQueue.push(child);
-        } else {
-            allGridsCovered_ = false;
-            float side = std::min(quad[XMAX_I] - quad[XMIN_I],
-                                  quad[YMAX_I] - quad[YMIN_I]);
-            if (side > maxEmptyGridShortSide_ && side < canvasMinSide_ * 0.25f) { // 0.25: Corresponds to 2 partitions
-                maxEmptyGridShortSide_ = side;
-            }
+    for (const auto& empty : binning_.GetEmptyCells()) {
+        allGridsCovered_ = false;
+        float side = std::min(empty[XMAX_I] - empty[XMIN_I], empty[YMAX_I] - empty[YMIN_I]);
+        if (side > maxEmptyGridShortSide_ && side < canvasMinSide_ * 0.25f) { // 0.25: Corresponds to 2 partitions
+            maxEmptyGridShortSide_ = side;
         }
     }
 }
@@ -892,23 +933,13 @@ Box4f GESDFPathShaderShape::ComputeCurveBoundingBox(size_t curveIndex, float max
     return { minX, maxX, minY, maxY };
 }
 
-void GESDFPathShaderShape::InitializeWorkQueue(
-    const Box4f& canvasBBox, const std::vector<Box4f>& curveBBoxes, std::queue<Grid>& workQueue)
-{
-    std::vector<uint32_t> initialCurves(numCurves_);
-    for (size_t i = 0; i < numCurves_; ++i) {
-        initialCurves[i] = i;
-    }
-    workQueue.push({ canvasBBox, initialCurves });
-}
-
-void GESDFPathShaderShape::ProcessFinalGrid(Grid& current, const std::vector<Box4f>& curveBBoxes)
+void GESDFPathShaderShape::ProcessFinalGrid(const Box4f& bbox, const uint32_t* curveIndices, uint32_t count)
 {
     GE_TRACE_NAME_FMT("GESDFPathShaderShape::ProcessFinalGrid");
-    Grid processedGrid = current;
     std::vector<float> gridCurves;
     std::vector<float> inOrderSeg;
-    for (size_t idx : processedGrid.curveIndices) {
+    for (uint32_t i = 0; i < count; ++i) {
+        size_t idx = curveIndices[i];
         size_t baseIdx = idx * CURVE_FLOAT_COUNT;
         if (baseIdx + CURVE_FLOAT_COUNT - 1 > controlPoints_.size()) {
             LOGE("GESDFPathShaderShape::ProcessFinalGrid index out of bounds");
@@ -923,7 +954,7 @@ void GESDFPathShaderShape::ProcessFinalGrid(Grid& current, const std::vector<Box
         gridCurves.push_back(controlPoints_[baseIdx + 5]); // 5: endPoint.y
         inOrderSeg.push_back(static_cast<float>(idx));
     }
-    curvesInGrid_.push_back(std::make_pair(gridCurves, processedGrid));
+    curvesInGrid_.push_back(std::make_pair(gridCurves, Grid { bbox }));
     segmentIndex_.push_back(inOrderSeg);
 }
 
@@ -1005,6 +1036,7 @@ void GESDFPathShaderShape::ProcessSingleBatch(Drawing::RuntimeShaderBuilder& bui
     builder.SetUniform("segmentIndex", batchSegments.data(), batchSegments.size());
     builder.SetUniform("u_isFirstBatch", (batch == 0) ? 1.0f : 0.0f);
     builder.SetUniform("u_validRange", vStart, vEnd);
+    builder.SetUniform("u_cellCount", 0.0f);
 
     SamplingOptions nearest(FilterMode::LINEAR, MipmapMode::LINEAR);
     if (batch > 0) {
@@ -1035,6 +1067,72 @@ void GESDFPathShaderShape::ProcessSingleBatch(Drawing::RuntimeShaderBuilder& bui
     offscreenCanvas_->DetachBrush();
 }
 
+void GESDFPathShaderShape::ProcessPackedGrids(Drawing::RuntimeShaderBuilder& builder,
+    const std::vector<size_t>& gridIndices)
+{
+    if (gridIndices.empty() || !offscreenCanvas_) {
+        return;
+    }
+    if (gridIndices.size() > MAX_CELLS_IN_PACK) {
+        LOGE("GESDFPathShaderShape::ProcessPackedGrids too many grids in one pack");
+        return;
+    }
+    std::vector<float> packCurves;
+    std::vector<float> packSegments;
+    std::vector<float> cellRects(MAX_CELLS_IN_PACK * CELL_RECT_FLOAT_COUNT, 0.0f);
+    std::vector<float> cellRanges(MAX_CELLS_IN_PACK * CELL_RANGE_FLOAT_COUNT, 0.0f);
+    packCurves.reserve(MAX_CURVES_SUBMIT_PER_GRID * CURVE_FLOAT_COUNT);
+    packSegments.reserve(MAX_CURVES_SUBMIT_PER_GRID);
+    for (size_t cell = 0; cell < gridIndices.size(); ++cell) {
+        if (gridIndices[cell] >= curvesInGrid_.size() || gridIndices[cell] >= segmentIndex_.size()) {
+            LOGE("GESDFPathShaderShape::ProcessPackedGrids grid index out of bounds");
+            return;
+        }
+        const auto& grid = curvesInGrid_[gridIndices[cell]];
+        const auto& segments = segmentIndex_[gridIndices[cell]];
+        const Box4f& area = grid.second.bbox;
+        size_t rectBase = cell * CELL_RECT_FLOAT_COUNT;
+        cellRects[rectBase] = area[XMIN_I];
+        cellRects[rectBase + 1] = area[YMIN_I]; // 1: top
+        cellRects[rectBase + 2] = area[XMAX_I]; // 2: right
+        cellRects[rectBase + 3] = area[YMAX_I]; // 3: bottom
+        cellRanges[cell * CELL_RANGE_FLOAT_COUNT] = static_cast<float>(packSegments.size());
+        packCurves.insert(packCurves.end(), grid.first.begin(), grid.first.end());
+        packSegments.insert(packSegments.end(), segments.begin(), segments.end());
+        cellRanges[cell * CELL_RANGE_FLOAT_COUNT + 1] = static_cast<float>(packSegments.size());
+    }
+    if (packSegments.size() > MAX_CURVES_SUBMIT_PER_GRID) {
+        LOGE("GESDFPathShaderShape::ProcessPackedGrids too many curves in one pack");
+        return;
+    }
+    packCurves.resize(MAX_CURVES_SUBMIT_PER_GRID * CURVE_FLOAT_COUNT, -2.0f); // -2.0f: not included in the NDC space
+    packSegments.resize(MAX_CURVES_SUBMIT_PER_GRID, -1.0f); // -1.0f: invalid negative curve index
+
+    builder.SetUniform("controlPoints", packCurves.data(), packCurves.size());
+    builder.SetUniform("segmentIndex", packSegments.data(), packSegments.size());
+    builder.SetUniform("u_isFirstBatch", 1.0f);
+    builder.SetUniform("u_validRange", 0.0f, MAX_CURVES_SUBMIT_PER_GRID - 1.0f);
+    builder.SetUniform("u_cellCount", static_cast<float>(gridIndices.size()));
+    builder.SetUniform("u_cellRects", cellRects.data(), cellRects.size());
+    builder.SetUniform("u_cellRanges", cellRanges.data(), cellRanges.size());
+
+    auto shader = builder.MakeShader(nullptr, false);
+    if (!shader) {
+        LOGE("GESDFPathShaderShape::ProcessPackedGrids shader create failed");
+        return;
+    }
+
+    // One shader for all cells of the pack, the rect draws share the paint and are batched together
+    Drawing::Brush brush;
+    brush.SetShaderEffect(shader);
+    offscreenCanvas_->AttachBrush(brush);
+    for (size_t gridIndex : gridIndices) {
+        const Box4f& area = curvesInGrid_[gridIndex].second.bbox;
+        offscreenCanvas_->DrawRect(Drawing::Rect(area[XMIN_I], area[YMIN_I], area[XMAX_I], area[YMAX_I]));
+    }
+    offscreenCanvas_->DetachBrush();
+}
+
 void GESDFPathShaderShape::RenderGridsToSurface(const Drawing::Rect& targetRect)
 {
     GE_TRACE_NAME_FMT("GESDFPathShaderShape::RenderGridsToSurface");
@@ -1048,9 +1146,22 @@ void GESDFPathShaderShape::RenderGridsToSurface(const Drawing::Rect& targetRect)
     builder->SetUniform("u_curveCount", static_cast<float>(numCurves_));
     std::shared_ptr<Drawing::Image> prevSdf = nullptr;
     std::shared_ptr<Drawing::ShaderEffect> prevShader = nullptr;
+    // Grids fitting in one submission are packed together, so most paths need a few draws instead of one per grid
+    std::vector<size_t> pack;
+    size_t packCurves = 0;
     for (size_t i = 0; i < curvesInGrid_.size(); i++) {
         size_t totalCurves = curvesInGrid_[i].first.size() / CURVE_FLOAT_COUNT;
         if (totalCurves == 0) continue;
+        if (totalCurves <= MAX_CURVES_SUBMIT_PER_GRID) {
+            if (pack.size() == MAX_CELLS_IN_PACK || packCurves + totalCurves > MAX_CURVES_SUBMIT_PER_GRID) {
+                ProcessPackedGrids(*builder, pack);
+                pack.clear();
+                packCurves = 0;
+            }
+            pack.push_back(i);
+            packCurves += totalCurves;
+            continue;
+        }
         const size_t curvesPerBatch = MAX_CURVES_SUBMIT_PER_GRID;
         const size_t step = curvesPerBatch > 2 ? curvesPerBatch - 2 : 1; // 2-curve overlap between adjacent batches
         size_t start = 0;
@@ -1064,6 +1175,7 @@ void GESDFPathShaderShape::RenderGridsToSurface(const Drawing::Rect& targetRect)
             start += step;
         }
     }
+    ProcessPackedGrids(*builder, pack);
 }
 
 std::shared_ptr<Image> GESDFPathShaderShape::DrawPathToImage(
@@ -1167,6 +1279,8 @@ void GESDFPathShaderShape::UpdateNumPasses()
     }
     requiredStep = std::clamp(requiredStep, 1.0f, 32.0f); // 32.0:max step for JFA
     int passCount = static_cast<int>(std::floor(std::log2(requiredStep))) + 1;
+    // Drop the largest JFA steps while the effect budget is exceeded, only far distances lose precision
+    passCount -= GEQualityGovernor::GetInstance().GetDegradeSteps();
     numPasses_ = static_cast<size_t>(std::clamp(passCount, 1, 6)); // at least 1 times, at most 6 times
 }
 
@@ -1228,15 +1342,19 @@ void GESDFPathShaderShape::Preprocess(Canvas& canvas, const Rect& rect, bool has
         }
     }
     
-    std::shared_ptr<Image> propagatedSdf = RunSDFPropagation(canvas, offscreenSurface_->GetImageSnapshot(),
-        pathImage, static_cast<int>(width), static_cast<int>(height));
+    std::shared_ptr<Image> seedSdf = offscreenSurface_->GetImageSnapshot();
+    std::shared_ptr<Image> propagatedSdf = RunSDFPropagation(canvas, seedSdf, pathImage,
+        static_cast<int>(width), static_cast<int>(height));
     if (!propagatedSdf) {
         LOGE("GESDFPathShaderShape::Preprocess: RunSDFPropagation returned null");
         return;
     }
 
-    disResult_ =
-        ComputeDistanceField(canvas, propagatedSdf, static_cast<int>(width), static_cast<int>(height));
+    // The last step reads the seeds when the long steps ran at reduced resolution, else the propagated field
+    bool fullResolution = propagatedSdf->GetWidth() == seedSdf->GetWidth() &&
+        propagatedSdf->GetHeight() == seedSdf->GetHeight();
+    disResult_ = ComputeDistanceField(canvas, fullResolution ? propagatedSdf : seedSdf, propagatedSdf, pathImage,
+        static_cast<int>(width), static_cast<int>(height));
     if (!disResult_) {
         LOGE("GESDFPathShaderShape::Preprocess ComputeDistanceField failed");
         return;
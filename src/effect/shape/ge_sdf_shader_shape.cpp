@@ -15,6 +15,9 @@
 
 #include "ge_sdf_shader_shape.h"
 
+#include <algorithm>
+#include <cmath>
+
 #include "draw/surface.h"
 #include "ge_sdf_pixelmap_shader_shape.h"
 #include "ge_sdf_rrect_shader_shape.h"
@@ -37,7 +40,55 @@ static constexpr char SHAPE_SDF_PROG[] = R"(
     }
 )";
 
+// Keep in sync with EncodeQuantizedSDF
+static constexpr char QUANTIZE_SDF_PROG[] = R"(
+    uniform shader sdfNormalImg;
+    uniform float range;
+    vec4 main(vec2 fragCoord)
+    {
+        vec4 sdg = sdfNormalImg.eval(fragCoord);
+        float fixedDist = floor(clamp(sdg.a / (2.0 * range) + 0.5, 0.0, 1.0) * 65535.0 + 0.5);
+        float high = floor(fixedDist / 256.0);
+        float low = fixedDist - high * 256.0;
+        float angle = fract(atan(sdg.g, sdg.r) / 6.28318530718 + 1.0);
+        return vec4(high / 255.0, low / 255.0, floor(angle * 255.0 + 0.5) / 255.0, 1.0);
+    }
+)";
+
+// Keep in sync with DecodeQuantizedSDF
+static constexpr char DEQUANTIZE_SDF_PROG[] = R"(
+    uniform shader sdfImg;
+    uniform float range;
+    vec4 main(vec2 fragCoord)
+    {
+        vec4 texel = floor(sdfImg.eval(fragCoord) * 255.0 + 0.5);
+        float dist = ((texel.r * 256.0 + texel.g) / 65535.0 - 0.5) * 2.0 * range;
+        float angle = texel.b / 255.0 * 6.28318530718;
+        return vec4(cos(angle), sin(angle), 0.0, dist);
+    }
+)";
+
+constexpr float TWO_PI = 6.28318530718f;
+constexpr float FIXED_DIST_MAX = 65535.0f; // 16-bit distance
+constexpr float BYTE_MAX = 255.0f;
+constexpr uint32_t BYTE_BITS = 8;
+constexpr uint32_t BYTE_MASK = 0xFF;
+
 thread_local static std::shared_ptr<Drawing::RuntimeEffect> g_shapeSDFShaderEffect = nullptr;
+thread_local static std::shared_ptr<Drawing::RuntimeEffect> g_quantizeSDFShaderEffect = nullptr;
+thread_local static std::shared_ptr<Drawing::RuntimeEffect> g_dequantizeSDFShaderEffect = nullptr;
+
+std::shared_ptr<Drawing::RuntimeEffect> GetSDFEffect(std::shared_ptr<Drawing::RuntimeEffect>& effect,
+    const char* prog)
+{
+    if (effect == nullptr) {
+        Drawing::RuntimeEffectOptions reo{};
+        reo.needDrawingslToSksl = false;
+        reo.useHighpLocalCoords = true;
+        effect = GECreateRuntimeEffectForShader(prog, reo);
+    }
+    return effect;
+}
 }
 
 std::shared_ptr<ShaderEffect> GESDFShaderShape::GenerateDrawingShader(float width, float height) const
@@ -103,15 +154,12 @@ bool GESDFShaderShape::TryGetCenterAndHalfSize(float& outX, float& outY, Vector2
 }
 
 std::shared_ptr<Drawing::Image> GESDFShaderShape::MakeSDFImage(Canvas& canvas,
-    float width, float height, bool hasNormal)
+    float width, float height, bool hasNormal, GESDFImageEncoding encoding)
 {
-    if (g_shapeSDFShaderEffect == nullptr) {
-        Drawing::RuntimeEffectOptions reo{};
-        reo.needDrawingslToSksl = false;
-        reo.useHighpLocalCoords = true;
-        g_shapeSDFShaderEffect = GECreateRuntimeEffectForShader(SHAPE_SDF_PROG, reo);
-    }
-    if (g_shapeSDFShaderEffect == nullptr) {
+    const bool quantized = encoding == GESDFImageEncoding::QUANTIZED;
+    auto effect = quantized ? GetSDFEffect(g_quantizeSDFShaderEffect, QUANTIZE_SDF_PROG) :
+        GetSDFEffect(g_shapeSDFShaderEffect, SHAPE_SDF_PROG);
+    if (effect == nullptr) {
         GE_LOGE("GESDFShaderShape::MakeSDFImage create runtime error");
         return nullptr;
     }
@@ -121,17 +169,65 @@ std::shared_ptr<Drawing::Image> GESDFShaderShape::MakeSDFImage(Canvas& canvas,
         GE_LOGE("GESDFShaderShape::MakeSDFImage create shader error");
         return nullptr;
     }
-    auto builder = std::make_shared<Drawing::RuntimeShaderBuilder>(g_shapeSDFShaderEffect);
+    auto builder = std::make_shared<Drawing::RuntimeShaderBuilder>(effect);
     builder->SetChild("sdfNormalImg", shader);
+    if (quantized) {
+        builder->SetUniform("range", SDF_QUANTIZED_RANGE);
+    }
     auto canvasSurface = canvas.GetSurface();
     std::shared_ptr<Drawing::ColorSpace> colorSpace = canvasSurface ?
         canvasSurface->GetImageInfo().GetColorSpace() : nullptr;
     Drawing::Matrix makeMatrix;
-    Drawing::ImageInfo imageInfo(width, height, Drawing::ColorType::COLORTYPE_RGBA_F16,
+    Drawing::ImageInfo imageInfo(width, height,
+        quantized ? Drawing::ColorType::COLORTYPE_RGBA_8888 : Drawing::ColorType::COLORTYPE_RGBA_F16,
         Drawing::AlphaType::ALPHATYPE_OPAQUE, colorSpace);
     auto context = canvas.GetGPUContext().get();
     return context ? builder->MakeImage(context, &(makeMatrix), imageInfo, false) : nullptr;
 }
+
+std::shared_ptr<ShaderEffect> GESDFShaderShape::MakeSDFImageShader(const std::shared_ptr<Drawing::Image>& sdfImage,
+    GESDFImageEncoding encoding)
+{
+    if (sdfImage == nullptr) {
+        return nullptr;
+    }
+    Drawing::Matrix sampleMatrix;
+    if (encoding != GESDFImageEncoding::QUANTIZED) {
+        return Drawing::ShaderEffect::CreateImageShader(*sdfImage, Drawing::TileMode::CLAMP, Drawing::TileMode::CLAMP,
+            Drawing::SamplingOptions(Drawing::FilterMode::LINEAR), sampleMatrix);
+    }
+    auto effect = GetSDFEffect(g_dequantizeSDFShaderEffect, DEQUANTIZE_SDF_PROG);
+    if (effect == nullptr) {
+        GE_LOGE("GESDFShaderShape::MakeSDFImageShader create runtime error");
+        return nullptr;
+    }
+    auto imageShader = Drawing::ShaderEffect::CreateImageShader(*sdfImage, Drawing::TileMode::CLAMP,
+        Drawing::TileMode::CLAMP, Drawing::SamplingOptions(Drawing::FilterMode::NEAREST), sampleMatrix);
+    auto builder = std::make_shared<Drawing::RuntimeShaderBuilder>(effect);
+    builder->SetChild("sdfImg", imageShader);
+    builder->SetUniform("range", SDF_QUANTIZED_RANGE);
+    return builder->MakeShader(nullptr, false);
+}
+
+std::array<uint8_t, 4> GESDFShaderShape::EncodeQuantizedSDF(float distance, float gradX, float gradY)
+{
+    float normalized = std::clamp(distance / (2.0f * SDF_QUANTIZED_RANGE) + 0.5f, 0.0f, 1.0f);
+    auto fixedDist = static_cast<uint32_t>(std::floor(normalized * FIXED_DIST_MAX + 0.5f));
+    float angle = std::atan2(gradY, gradX) / TWO_PI + 1.0f;
+    angle -= std::floor(angle);
+    return { static_cast<uint8_t>(fixedDist >> BYTE_BITS), static_cast<uint8_t>(fixedDist & BYTE_MASK),
+        static_cast<uint8_t>(std::floor(angle * BYTE_MAX + 0.5f)), static_cast<uint8_t>(BYTE_MASK) };
+}
+
+void GESDFShaderShape::DecodeQuantizedSDF(const std::array<uint8_t, 4>& texel, float& distance, float& gradX,
+    float& gradY)
+{
+    uint32_t fixedDist = (static_cast<uint32_t>(texel[0]) << BYTE_BITS) | texel[1];
+    distance = (fixedDist / FIXED_DIST_MAX - 0.5f) * 2.0f * SDF_QUANTIZED_RANGE;
+    float angle = texel[2] / BYTE_MAX * TWO_PI;
+    gradX = std::cos(angle);
+    gradY = std::sin(angle);
+}
 } // Drawing
 } // namespace Rosen
 } // namespace OHOS
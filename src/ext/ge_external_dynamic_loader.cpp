@@ -13,8 +13,10 @@
  * limitations under the License.
  */
 #include "ge_external_dynamic_loader.h"
+#include "ge_feature_flags.h"
 #include "ge_log.h"
-#include "ge_system_properties.h"
+
+#include <thread>
 
 #ifdef GE_PLATFORM_UNIX
 #include <dlfcn.h>
@@ -23,7 +25,6 @@
 namespace OHOS {
 namespace Rosen {
 namespace {
-const std::string GRAPHICS_EFFECT_EXT_ENABLE = "rosen.graphic.gex.enable";
 #ifdef GE_PLATFORM_UNIX
 #if (defined(__aarch64__) || defined(__x86_64__))
 const std::string GRAPHICS_EFFECT_EXT_LIB_PATH = "/system/lib64/libgraphics_effect_ext.z.so";
@@ -35,7 +36,9 @@ const std::string GRAPHICS_EFFECT_EXT_DESTROY_INREFACE = "DestroyGEXObject";
 #endif
 }
 
-GEExternalDynamicLoader::GEExternalDynamicLoader()
+GEExternalDynamicLoader::GEExternalDynamicLoader() {}
+
+void GEExternalDynamicLoader::Load()
 {
     LOGI("GEExternalDynamicLoader load");
 #ifdef GE_PLATFORM_UNIX
@@ -64,6 +67,27 @@ GEExternalDynamicLoader::GEExternalDynamicLoader()
 #endif
 }
 
+void GEExternalDynamicLoader::Preload()
+{
+    std::call_once(loadOnce_, [this]() {
+        Load();
+        loaded_.store(true, std::memory_order_release);
+    });
+}
+
+void GEExternalDynamicLoader::PreloadAsync()
+{
+    if (IsLoaded()) {
+        return;
+    }
+    std::thread([this]() { Preload(); }).detach();
+}
+
+bool GEExternalDynamicLoader::IsLoaded() const
+{
+    return loaded_.load(std::memory_order_acquire);
+}
+
 GEExternalDynamicLoader::~GEExternalDynamicLoader()
 {
     LOGI("GEExternalDynamicLoader unload");
@@ -83,43 +107,34 @@ GEExternalDynamicLoader& GEExternalDynamicLoader::GetInstance()
 
 void* GEExternalDynamicLoader::CreateGEXObjectByType(uint32_t type, uint32_t len, void* param)
 {
+    Preload();
     if (!createObjectFunc_) {
         LOGD("GEExternalDynamicLoader::CreateGEXObjectByType interface is null");
         return nullptr;
     }
 
-#ifdef GE_OHOS
-    auto enable = system::GetBoolParameter(GRAPHICS_EFFECT_EXT_ENABLE, true);
-    if (enable) {
+    if (GEFeatureFlags::GetInstance().IsEnabled(GEFeatureFlag::EXTERNAL_EFFECT)) {
         return createObjectFunc_(type, len, param);
     }
 
     LOGW("GEExternalDynamicLoader::CreateGEXObjectByType dynamic load disabled");
     return nullptr;
-#else
-    return createObjectFunc_(type, len, param);
-#endif
 }
 
 bool GEExternalDynamicLoader::DestroyGEXObject(void* ptr)
 {
+    Preload();
     if (!destroyObjectFunc_) {
         LOGD("GEExternalDynamicLoader::DestroyGEXObject interface is null");
         return false;
     }
-#ifdef GE_OHOS
-    auto enable = system::GetBoolParameter(GRAPHICS_EFFECT_EXT_ENABLE, true);
-    if (enable) {
+    if (GEFeatureFlags::GetInstance().IsEnabled(GEFeatureFlag::EXTERNAL_EFFECT)) {
         destroyObjectFunc_(ptr);
         return true;
     }
 
     LOGW("GEExternalDynamicLoader::DestroyGEXObject dynamic load disabled");
     return false;
-#else
-    destroyObjectFunc_(ptr);
-    return true;
-#endif
 }
 
 } // namespace Rosen
@@ -0,0 +1,59 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "ge_hps_backend.h"
+
+#include "ge_log.h"
+#include "ge_system_properties.h"
+
+namespace OHOS {
+namespace Rosen {
+
+bool GEHpsDeviceBackend::IsEnabled() const
+{
+#ifdef GE_OHOS
+    // Determine whether the hps effect render should be enabled.
+    static bool enabled =
+        std::atoi((system::GetParameter("persist.sys.graphic.hpsEffectEnabled", "1")).c_str()) != 0;
+    return enabled;
+#else
+    return false;
+#endif
+}
+
+bool GEHpsDeviceBackend::QueryExtensions(Drawing::Canvas& canvas, std::vector<const char*>& extensions)
+{
+    if (canvas.GetGPUContext() == nullptr) {
+        LOGE("GEHpsDeviceBackend::QueryExtensions canvas.GetGPUContext is nullptr");
+        return false;
+    }
+    canvas.GetGPUContext()->GetHpsEffectSupport(extensions);
+    return true;
+}
+
+std::array<int, 2> GEHpsDeviceBackend::CalcBlurredImageDimension(Drawing::Canvas& canvas,
+    const Drawing::HpsBlurParameter& params)
+{
+    return canvas.CalcHpsBluredImageDimension(params);
+}
+
+bool GEHpsDeviceBackend::DrawImageEffect(Drawing::Canvas& offscreenCanvas, const Drawing::Image& image,
+    std::vector<std::shared_ptr<Drawing::HpsEffectParameter>>& effects)
+{
+    return offscreenCanvas.DrawImageEffectHPS(image, effects);
+}
+
+} // namespace Rosen
+} // namespace OHOS
@@ -0,0 +1,316 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "ge_hps_cpu_backend.h"
+
+#include <algorithm>
+#include <cmath>
+
+#include "image/bitmap.h"
+
+#include "ge_log.h"
+
+namespace OHOS {
+namespace Rosen {
+namespace {
+constexpr int MAX_SURFACE_SIZE = 10000;
+constexpr float MIN_SIGMA = 0.1f;
+constexpr float KERNEL_EXTENT = 3.0f; // Gaussian kernel radius in sigmas
+constexpr float LARGE_BLUR_SIGMA = 16.0f;
+constexpr float MEDIUM_BLUR_SIGMA = 4.0f;
+constexpr float LARGE_BLUR_SCALE = 0.25f;
+constexpr float MEDIUM_BLUR_SCALE = 0.5f;
+constexpr float MAX_CHANNEL = 255.0f;
+constexpr float HALF_CHANNEL = 127.5f;
+constexpr float AIBAR_MIX = 0.42857f;
+
+// Extensions of the effects implemented by this backend, see g_hpsSupportEffectExtensions of HpsEffectFilter
+const char* const CPU_EXTENSIONS[] = {
+    "hps_gaussian_blur_effect",
+    "hps_mesa_blur_effect",
+    "hps_gray_effect",
+    "hps_aibar_effect",
+};
+
+// Same curve as the GEGreyShaderFilter shader
+float CalculateTY(float rgb)
+{
+    if (rgb > HALF_CHANNEL) {
+        rgb = MAX_CHANNEL - rgb;
+    }
+    constexpr float a = 106.5f;  // 3 * b - 3 * c + d
+    constexpr float b = -93.0f;  // 3 * (c - 2 * b)
+    constexpr float p = 0.816240163988f;
+    const float q = -rgb / a + 0.262253485943f;
+    const float s1 = -(q / 2.0f);
+    const float s2 = std::sqrt(s1 * s1 + std::pow(p / 3.0f, 3.0f));
+    const float res = std::cbrt(s1 + s2) + std::cbrt(s1 - s2) - (b / (3.0f * a));
+    return std::min(res, 1.0f);
+}
+
+float CalculateGreyAdjustY(float rgb, float coef1, float coef2)
+{
+    const float t = CalculateTY(rgb);
+    const float weight = std::pow(1.0f - t, 3.0f);
+    return (rgb < HALF_CHANNEL) ? (rgb + coef1 * weight) : (rgb - coef2 * weight);
+}
+
+uint8_t ToChannel(float value)
+{
+    return static_cast<uint8_t>(std::lround(std::clamp(value, 0.0f, 1.0f) * MAX_CHANNEL));
+}
+
+void BlurLine(const float* in, float* out, int count, int stride, const std::vector<float>& kernel)
+{
+    const int radius = static_cast<int>(kernel.size()) - 1;
+    for (int i = 0; i < count; ++i) {
+        float acc[GEHpsCpuBackend::CHANNELS] = { 0.0f, 0.0f, 0.0f, 0.0f };
+        for (int k = -radius; k <= radius; ++k) {
+            const int j = std::clamp(i + k, 0, count - 1);
+            const float w = kernel[std::abs(k)];
+            const float* px = in + static_cast<size_t>(j) * stride;
+            for (int c = 0; c < GEHpsCpuBackend::CHANNELS; ++c) {
+                acc[c] += w * px[c];
+            }
+        }
+        float* dst = out + static_cast<size_t>(i) * stride;
+        std::copy(acc, acc + GEHpsCpuBackend::CHANNELS, dst);
+    }
+}
+} // namespace
+
+bool GEHpsCpuBackend::QueryExtensions(Drawing::Canvas& canvas, std::vector<const char*>& extensions)
+{
+    extensions.assign(std::begin(CPU_EXTENSIONS), std::end(CPU_EXTENSIONS));
+    return true;
+}
+
+float GEHpsCpuBackend::GetBlurScale(float sigma)
+{
+    if (sigma > LARGE_BLUR_SIGMA) {
+        return LARGE_BLUR_SCALE;
+    }
+    return sigma > MEDIUM_BLUR_SIGMA ? MEDIUM_BLUR_SCALE : 1.0f;
+}
+
+std::array<int, 2> GEHpsCpuBackend::CalcBlurredImageDimension(Drawing::Canvas& canvas,
+    const Drawing::HpsBlurParameter& params)
+{
+    const float scale = GetBlurScale(params.sigma);
+    return { std::max(1, static_cast<int>(std::ceil(params.src.GetWidth() * scale))),
+        std::max(1, static_cast<int>(std::ceil(params.src.GetHeight() * scale))) };
+}
+
+void GEHpsCpuBackend::GaussianBlur(PixelBuffer& buffer, float sigma)
+{
+    if (sigma < MIN_SIGMA || buffer.width <= 0 || buffer.height <= 0) {
+        return;
+    }
+    const int radius = static_cast<int>(std::ceil(sigma * KERNEL_EXTENT));
+    std::vector<float> kernel(radius + 1);
+    float sum = 0.0f;
+    for (int i = 0; i <= radius; ++i) {
+        kernel[i] = std::exp(-0.5f * i * i / (sigma * sigma));
+        sum += (i == 0) ? kernel[i] : 2.0f * kernel[i];
+    }
+    for (auto& w : kernel) {
+        w /= sum;
+    }
+    std::vector<float> temp(buffer.rgba.size());
+    const int rowStride = buffer.width * CHANNELS;
+    for (int y = 0; y < buffer.height; ++y) {
+        BlurLine(buffer.At(0, y), temp.data() + static_cast<size_t>(y) * rowStride, buffer.width, CHANNELS, kernel);
+    }
+    for (int x = 0; x < buffer.width; ++x) {
+        BlurLine(temp.data() + static_cast<size_t>(x) * CHANNELS, buffer.At(x, 0), buffer.height, rowStride, kernel);
+    }
+}
+
+void GEHpsCpuBackend::AdjustSaturationBrightness(PixelBuffer& buffer, float saturation, float brightness)
+{
+    // Luminance weights of the saturate filter, same as GEAIBarShaderFilter
+    constexpr float lumR = 0.3086f;
+    constexpr float lumG = 0.6094f;
+    constexpr float lumB = 0.0820f;
+    for (size_t i = 0; i + CHANNELS <= buffer.rgba.size(); i += CHANNELS) {
+        float* px = &buffer.rgba[i];
+        const float luminance = lumR * px[0] + lumG * px[1] + lumB * px[2];
+        for (int c = 0; c < CHANNELS - 1; ++c) {
+            px[c] = std::clamp((luminance + (px[c] - luminance) * saturation) * brightness, 0.0f, px[3]);
+        }
+    }
+}
+
+void GEHpsCpuBackend::GreyAdjust(PixelBuffer& buffer, float coef1, float coef2)
+{
+    for (size_t i = 0; i + CHANNELS <= buffer.rgba.size(); i += CHANNELS) {
+        float* px = &buffer.rgba[i];
+        float y = (0.299f * px[0] + 0.587f * px[1] + 0.114f * px[2]) * MAX_CHANNEL;
+        const float u = (-0.147f * px[0] - 0.289f * px[1] + 0.436f * px[2]) * MAX_CHANNEL;
+        const float v = (0.615f * px[0] - 0.515f * px[1] - 0.100f * px[2]) * MAX_CHANNEL;
+        y = CalculateGreyAdjustY(y, coef1, coef2);
+        px[0] = (y + 1.14f * v) / MAX_CHANNEL;
+        px[1] = (y - 0.39f * u - 0.58f * v) / MAX_CHANNEL;
+        px[2] = (y + 2.03f * u) / MAX_CHANNEL;
+        px[3] = 1.0f;
+    }
+}
+
+void GEHpsCpuBackend::AIBar(PixelBuffer& buffer, float low, float high, float threshold, float opacity,
+    float saturation)
+{
+    constexpr float lumR = 0.3086f;
+    constexpr float lumG = 0.6094f;
+    constexpr float lumB = 0.0820f;
+    for (size_t i = 0; i + CHANNELS <= buffer.rgba.size(); i += CHANNELS) {
+        float* px = &buffer.rgba[i];
+        const float gray = 0.299f * px[0] + 0.587f * px[1] + 0.114f * px[2];
+        const float bin = (gray >= threshold) ? low : high;
+        const float luminance = lumR * px[0] + lumG * px[1] + lumB * px[2];
+        for (int c = 0; c < CHANNELS - 1; ++c) {
+            const float satAdjust = luminance + (px[c] - luminance) * saturation;
+            const float res = satAdjust - (opacity + 1.0f) * gray + bin;
+            px[c] = px[c] + (res - px[c]) * AIBAR_MIX;
+        }
+        px[3] = 1.0f;
+    }
+}
+
+bool GEHpsCpuBackend::ApplyEffect(const Drawing::HpsEffectParameter& effect, float scale, PixelBuffer& buffer)
+{
+    switch (effect.GetEffectType()) {
+        case Drawing::HpsEffect::BLUR: {
+            const auto& blur = static_cast<const Drawing::HpsBlurEffectParameter&>(effect);
+            GaussianBlur(buffer, blur.sigma * scale);
+            AdjustSaturationBrightness(buffer, blur.saturation, blur.brightness);
+            return true;
+        }
+        case Drawing::HpsEffect::MESA: {
+            const auto& mesa = static_cast<const Drawing::HpsMesaParameter&>(effect);
+            GaussianBlur(buffer, mesa.sigma * scale);
+            if (mesa.greyCoef1 > 0.0f || mesa.greyCoef2 > 0.0f) {
+                GreyAdjust(buffer, mesa.greyCoef1, mesa.greyCoef2);
+            }
+            return true;
+        }
+        case Drawing::HpsEffect::GREY: {
+            const auto& grey = static_cast<const Drawing::HpsGreyParameter&>(effect);
+            GreyAdjust(buffer, grey.greyCoef1, grey.greyCoef2);
+            return true;
+        }
+        case Drawing::HpsEffect::AIBAR: {
+            const auto& aiBar = static_cast<const Drawing::HpsAiBarParameter&>(effect);
+            AIBar(buffer, aiBar.aiBarLow, aiBar.aiBarHigh, aiBar.aiBarThreshold, aiBar.aiBarOpacity,
+                aiBar.aiBarSaturation);
+            return true;
+        }
+        default:
+            LOGD("GEHpsCpuBackend::ApplyEffect unsupported effect type %{public}d",
+                static_cast<int>(effect.GetEffectType()));
+            return false;
+    }
+}
+
+bool GEHpsCpuBackend::ReadRegion(const Drawing::Image& image, const Drawing::Rect& src, PixelBuffer& buffer)
+{
+    Drawing::Bitmap bitmap;
+    Drawing::BitmapFormat format { Drawing::COLORTYPE_RGBA_8888, Drawing::ALPHATYPE_PREMUL };
+    if (!bitmap.Build(buffer.width, buffer.height, format)) {
+        LOGE("GEHpsCpuBackend::ReadRegion build bitmap failed");
+        return false;
+    }
+    bitmap.ClearWithColor(Drawing::Color::COLOR_TRANSPARENT);
+    Drawing::Canvas canvas;
+    canvas.Bind(bitmap);
+    const Drawing::Rect dst(0.0f, 0.0f, buffer.width, buffer.height);
+    canvas.DrawImageRect(image, src, dst, Drawing::SamplingOptions(Drawing::FilterMode::LINEAR),
+        Drawing::SrcRectConstraint::STRICT_SRC_RECT_CONSTRAINT);
+    const auto* pixels = static_cast<const uint8_t*>(bitmap.GetPixels());
+    if (pixels == nullptr) {
+        return false;
+    }
+    buffer.rgba.resize(static_cast<size_t>(buffer.width) * buffer.height * CHANNELS);
+    const size_t rowBytes = bitmap.GetRowBytes();
+    for (int y = 0; y < buffer.height; ++y) {
+        const uint8_t* row = pixels + y * rowBytes;
+        float* out = buffer.At(0, y);
+        for (int i = 0; i < buffer.width * CHANNELS; ++i) {
+            out[i] = row[i] / MAX_CHANNEL;
+        }
+    }
+    return true;
+}
+
+std::shared_ptr<Drawing::Image> GEHpsCpuBackend::MakeImage(const PixelBuffer& buffer)
+{
+    Drawing::Bitmap bitmap;
+    Drawing::BitmapFormat format { Drawing::COLORTYPE_RGBA_8888, Drawing::ALPHATYPE_PREMUL };
+    if (!bitmap.Build(buffer.width, buffer.height, format)) {
+        return nullptr;
+    }
+    auto* pixels = static_cast<uint8_t*>(bitmap.GetPixels());
+    if (pixels == nullptr) {
+        return nullptr;
+    }
+    const size_t rowBytes = bitmap.GetRowBytes();
+    for (int y = 0; y < buffer.height; ++y) {
+        uint8_t* row = pixels + y * rowBytes;
+        const float* in = &buffer.rgba[static_cast<size_t>(y) * buffer.width * CHANNELS];
+        for (int i = 0; i < buffer.width * CHANNELS; ++i) {
+            row[i] = ToChannel(in[i]);
+        }
+    }
+    return bitmap.MakeImage();
+}
+
+bool GEHpsCpuBackend::DrawImageEffect(Drawing::Canvas& offscreenCanvas, const Drawing::Image& image,
+    std::vector<std::shared_ptr<Drawing::HpsEffectParameter>>& effects)
+{
+    if (effects.empty() || effects.front() == nullptr) {
+        return false;
+    }
+    // HpsEffectFilter renders all composed effects from the same src to the same dst
+    const auto src = effects.front()->src;
+    const auto dst = effects.front()->dst;
+    PixelBuffer buffer;
+    buffer.width = static_cast<int>(std::ceil(dst.GetWidth()));
+    buffer.height = static_cast<int>(std::ceil(dst.GetHeight()));
+    if (buffer.width <= 0 || buffer.height <= 0 || buffer.width >= MAX_SURFACE_SIZE ||
+        buffer.height >= MAX_SURFACE_SIZE || src.GetWidth() <= 0.0f) {
+        LOGE("GEHpsCpuBackend::DrawImageEffect invalid size %{public}d x %{public}d", buffer.width, buffer.height);
+        return false;
+    }
+    if (!ReadRegion(image, src, buffer)) {
+        return false;
+    }
+    const float scale = dst.GetWidth() / src.GetWidth();
+    for (const auto& effect : effects) {
+        if (effect == nullptr || !ApplyEffect(*effect, scale, buffer)) {
+            return false;
+        }
+    }
+    auto outImage = MakeImage(buffer);
+    if (outImage == nullptr) {
+        LOGE("GEHpsCpuBackend::DrawImageEffect make image failed");
+        return false;
+    }
+    const Drawing::Rect bufferRect(0.0f, 0.0f, buffer.width, buffer.height);
+    offscreenCanvas.DrawImageRect(*outImage, bufferRect, dst, Drawing::SamplingOptions(Drawing::FilterMode::LINEAR),
+        Drawing::SrcRectConstraint::STRICT_SRC_RECT_CONSTRAINT);
+    return true;
+}
+
+} // namespace Rosen
+} // namespace OHOS
@@ -15,6 +15,8 @@
 
 #include "ge_hps_effect_filter.h"
 
+#include <atomic>
+
 #include "draw/surface.h"
 #include "ge_system_properties.h"
 #include "ge_aibar_shader_filter.h"
@@ -32,6 +34,10 @@ namespace {
 static constexpr uint32_t MAX_SURFACE_SIZE = 10000;
 static constexpr size_t EXTENSION_SIZE_LIMIT = 1000;
 static thread_local std::vector<const char *> g_extensionProperties;
+// Bumped on every SetBackend so that each thread queries the extensions of the new backend again
+static std::atomic<uint32_t> g_backendGeneration { 0 };
+static thread_local uint32_t g_extensionGeneration = 0;
+static std::shared_ptr<IGEHpsBackend> g_backend = nullptr;
 const std::map<Drawing::GEVisualEffectImpl::FilterType, const char *> g_hpsSupportEffectExtensions {
     {Drawing::GEVisualEffectImpl::FilterType::KAWASE_BLUR, "hps_gaussian_blur_effect"},
     {Drawing::GEVisualEffectImpl::FilterType::MESA_BLUR, "hps_mesa_blur_effect"},
@@ -52,18 +58,6 @@ const std::unordered_map<Drawing::GEVisualEffectImpl::FilterType, std::unordered
         Drawing::GEFilterType::RADIAL_GRADIENT_MASK}},
 };
 
-static bool GetHpsEffectEnabled()
-{
-#ifdef GE_OHOS
-    // Determine whether the hps effect render should be enabled.
-    static bool enabled =
-        std::atoi((system::GetParameter("persist.sys.graphic.hpsEffectEnabled", "1")).c_str()) != 0;
-    return enabled;
-#else
-    return false;
-#endif
-}
-
 static float GetHpsEffectBlurNoiseFactor()
 {
 #ifdef GE_OHOS
@@ -157,12 +151,16 @@ uint32_t GetUpdatedTypeForEdgeLight(const std::shared_ptr<Drawing::HpsEdgeLightP
 
 HpsEffectFilter::HpsEffectFilter(Drawing::Canvas& canvas)
 {
+    const uint32_t generation = g_backendGeneration.load();
+    if (g_extensionGeneration != generation) {
+        g_extensionProperties.clear();
+        g_extensionGeneration = generation;
+    }
     if (g_extensionProperties.empty()) {
-        if (canvas.GetGPUContext() == nullptr) {
-            LOGE("HpsEffectFilter canvas.GetGPUContext is nullptr");
+        if (!backend_->QueryExtensions(canvas, g_extensionProperties)) {
+            g_extensionProperties.clear();
             return;
         }
-        canvas.GetGPUContext()->GetHpsEffectSupport(g_extensionProperties);
         if (g_extensionProperties.empty()) {
             // add InitFinish for query once only
             g_extensionProperties.push_back("InitFinish");
@@ -288,7 +286,7 @@ std::shared_ptr<Drawing::Image> HpsEffectFilter::GetBlurImageForFrostedGlass(Dra
         LOGE("HpsEffectFilter::GetBlurImageForFrostedGlass blurParams is nullptr");
         return nullptr;
     }
-    std::array<int, 2> dimension = canvas.CalcHpsBluredImageDimension(*blurParams); // There are 2 variables
+    std::array<int, 2> dimension = backend_->CalcBlurredImageDimension(canvas, *blurParams); // There are 2 variables
     auto dst = blurParams->dst;
     if (dimension[0] <= 0 || dimension[1] <= 0 || dimension[0] >= static_cast<int>(MAX_SURFACE_SIZE)
         || dimension[1] >= static_cast<int>(MAX_SURFACE_SIZE)) {
@@ -304,7 +302,7 @@ std::shared_ptr<Drawing::Image> HpsEffectFilter::GetBlurImageForFrostedGlass(Dra
     for (auto& effectInfo : hpsEffect_) {
         effectInfo->dst = dimensionRect;
     }
-    if (!offscreenCanvas->DrawImageEffectHPS(*image, hpsEffect_)) {
+    if (!backend_->DrawImageEffect(*offscreenCanvas, *image, hpsEffect_)) {
         LOGD("HpsEffectFilter::GetBlurImageForFrostedGlass offscreenCanvas->DrawImageEffectHPS error");
         return nullptr;
     }
@@ -314,7 +312,7 @@ std::shared_ptr<Drawing::Image> HpsEffectFilter::GetBlurImageForFrostedGlass(Dra
 
 bool HpsEffectFilter::HpsSupportEffectGE(const Drawing::GEVisualEffectContainer& veContainer)
 {
-    if (!GetHpsEffectEnabled()) {
+    if (!IsHpsEffectEnabled()) {
         return false;
     }
     for (const auto& vef : veContainer.GetFilters()) {
@@ -327,7 +325,7 @@ bool HpsEffectFilter::HpsSupportEffectGE(const Drawing::GEVisualEffectContainer&
 
 bool HpsEffectFilter::IsHpsEffectEnabled() const
 {
-    return GetHpsEffectEnabled();
+    return backend_->IsEnabled();
 }
 
 void HpsEffectFilter::GenerateVisualEffectFromGE(const std::shared_ptr<Drawing::GEVisualEffectImpl>& visualEffectImpl,
@@ -753,7 +751,7 @@ std::array<int, HpsEffectFilter::ARRAY_SIZE_DIMENSION> HpsEffectFilter::GetSurfa
         LOGE("HpsEffectFilter::GetSurfaceSize no BLUR but downscale");
         return {0, 0};
     }
-    std::array<int, ARRAY_SIZE_DIMENSION> dimension = canvas.CalcHpsBluredImageDimension(*blurParams);
+    std::array<int, ARRAY_SIZE_DIMENSION> dimension = backend_->CalcBlurredImageDimension(canvas, *blurParams);
     if (dimension[0] <= 0 || dimension[1] <= 0 || dimension[0] >= static_cast<int>(MAX_SURFACE_SIZE) ||
         dimension[1] >= static_cast<int>(MAX_SURFACE_SIZE)) {
         LOGD("HpsEffectFilter::GetSurfaceSize CalcHpsBluredImageDimension error");
@@ -844,7 +842,7 @@ bool HpsEffectFilter::ApplyHpsEffect(Drawing::Canvas& canvas, const std::shared_
         }
     }
     UpdateHpsEffectCacheParameter(image);
-    if (!offscreenCanvas->DrawImageEffectHPS(*image, hpsEffect_)) {
+    if (!backend_->DrawImageEffect(*offscreenCanvas, *image, hpsEffect_)) {
         LOGD("HpsEffectFilter::ApplyHpsEffect DrawImageEffectHPS fail");
         return false;
     }
@@ -871,6 +869,22 @@ void HpsEffectFilter::SetNeedUpscale(bool needUpscale)
     needUpscale_ = needUpscale;
 }
 
+void HpsEffectFilter::SetBackend(const std::shared_ptr<IGEHpsBackend>& backend)
+{
+    std::atomic_store(&g_backend, backend);
+    ++g_backendGeneration;
+}
+
+std::shared_ptr<IGEHpsBackend> HpsEffectFilter::GetBackend()
+{
+    auto backend = std::atomic_load(&g_backend);
+    if (backend != nullptr) {
+        return backend;
+    }
+    static const auto deviceBackend = std::make_shared<GEHpsDeviceBackend>();
+    return deviceBackend;
+}
+
 void HpsEffectFilter::UnitTestSetExtensionProperties(const std::vector<const char *>& extensionProperties)
 {
     // Used in unit tests due to non-Mockable Drawing::GPUContext, don't use in general cases
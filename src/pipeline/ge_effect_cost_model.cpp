@@ -0,0 +1,103 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "ge_effect_cost_model.h"
+
+#include <chrono>
+
+namespace OHOS {
+namespace Rosen {
+namespace {
+constexpr uint64_t SMOOTHING_SHIFT = 2; // Latest sample weighted 1/4
+constexpr float PICOS_PER_NANO = 1000.0f;
+constexpr float MIN_TEXEL_READS = 1.0f;
+
+// The first sample seeds the average, 1 keeps a measured value distinguishable from an unknown one
+uint64_t Smooth(uint64_t previous, uint64_t sample)
+{
+    const uint64_t average = previous == 0 ? sample :
+        previous - (previous >> SMOOTHING_SHIFT) + (sample >> SMOOTHING_SHIFT);
+    return average == 0 ? 1 : average;
+}
+} // namespace
+
+GEEffectCostModel& GEEffectCostModel::GetInstance()
+{
+    static GEEffectCostModel instance;
+    return instance;
+}
+
+uint64_t GEEffectCostModel::NowNs()
+{
+    return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count());
+}
+
+uint64_t GEEffectCostModel::GetEstimateNs(Drawing::GEFilterType type) const
+{
+    const size_t index = static_cast<size_t>(type);
+    if (index >= MAX_TYPES) {
+        return 0;
+    }
+    return estimatesNs_[index].load(std::memory_order_relaxed);
+}
+
+void GEEffectCostModel::Report(Drawing::GEFilterType type, uint64_t costNs)
+{
+    const size_t index = static_cast<size_t>(type);
+    if (index >= MAX_TYPES) {
+        return;
+    }
+    estimatesNs_[index].store(Smooth(estimatesNs_[index].load(std::memory_order_relaxed), costNs),
+        std::memory_order_relaxed);
+}
+
+uint64_t GEEffectCostModel::GetEstimateNs(Drawing::GEFilterType type, float texelReads) const
+{
+    const size_t index = static_cast<size_t>(type);
+    if (index >= MAX_TYPES) {
+        return 0;
+    }
+    const uint64_t picosPerRead = picosPerTexelRead_[index].load(std::memory_order_relaxed);
+    if (picosPerRead == 0 || !(texelReads >= MIN_TEXEL_READS)) {
+        return GetEstimateNs(type);
+    }
+    const uint64_t estimate = static_cast<uint64_t>(static_cast<float>(picosPerRead) * texelReads / PICOS_PER_NANO);
+    return estimate == 0 ? 1 : estimate;
+}
+
+void GEEffectCostModel::Report(Drawing::GEFilterType type, uint64_t costNs, float texelReads)
+{
+    Report(type, costNs);
+    const size_t index = static_cast<size_t>(type);
+    if (index >= MAX_TYPES || !(texelReads >= MIN_TEXEL_READS)) {
+        return;
+    }
+    const uint64_t picosPerRead = static_cast<uint64_t>(static_cast<float>(costNs) * PICOS_PER_NANO / texelReads);
+    picosPerTexelRead_[index].store(Smooth(picosPerTexelRead_[index].load(std::memory_order_relaxed), picosPerRead),
+        std::memory_order_relaxed);
+}
+
+void GEEffectCostModel::Reset()
+{
+    for (auto& estimate : estimatesNs_) {
+        estimate.store(0, std::memory_order_relaxed);
+    }
+    for (auto& picosPerRead : picosPerTexelRead_) {
+        picosPerRead.store(0, std::memory_order_relaxed);
+    }
+}
+} // namespace Rosen
+} // namespace OHOS
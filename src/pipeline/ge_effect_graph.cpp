@@ -0,0 +1,240 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "ge_effect_graph.h"
+
+#include <algorithm>
+#include <functional>
+#include <queue>
+
+#include "ge_log.h"
+#include "ge_visual_effect_impl.h"
+
+namespace OHOS {
+namespace Rosen {
+
+GEEffectGraph::GEEffectGraph()
+{
+    nodes_.emplace_back(); // Placeholder of SOURCE
+}
+
+GEEffectGraph::NodeId GEEffectGraph::AddNode(
+    const std::shared_ptr<Drawing::GEVisualEffect>& effect, NodeId primaryInput)
+{
+    if (effect == nullptr) {
+        LOGE("GEEffectGraph::AddNode effect is null");
+        return INVALID_NODE;
+    }
+    if (!IsValidNode(primaryInput)) {
+        LOGE("GEEffectGraph::AddNode invalid primary input %{public}u", primaryInput);
+        return INVALID_NODE;
+    }
+    Node node;
+    node.effect = effect;
+    node.primaryInput = primaryInput;
+    nodes_.push_back(std::move(node));
+    return static_cast<NodeId>(nodes_.size() - 1);
+}
+
+bool GEEffectGraph::IsTagOfEffect(
+    const std::shared_ptr<Drawing::GEVisualEffect>& effect, Drawing::GEParamsMemberTag tag)
+{
+    if (effect == nullptr || effect->GetImpl() == nullptr || tag == Drawing::GEParamsMemberTag::INVALID) {
+        return false;
+    }
+    return Drawing::GEParamsMemberHelper::GetFilterTypeFromTag(tag) == effect->GetImpl()->GetFilterType();
+}
+
+bool GEEffectGraph::AddInput(NodeId node, NodeId from, Drawing::GEParamsMemberTag tag)
+{
+    if (node == SOURCE || !IsValidNode(node) || !IsValidNode(from) || node == from) {
+        LOGE("GEEffectGraph::AddInput invalid edge %{public}u -> %{public}u", from, node);
+        return false;
+    }
+    if (!IsTagOfEffect(nodes_[node].effect, tag)) {
+        LOGE("GEEffectGraph::AddInput tag %{public}u does not belong to node %{public}u",
+            static_cast<uint32_t>(tag), node);
+        return false;
+    }
+    nodes_[node].namedInputs.push_back({ from, tag });
+    return true;
+}
+
+bool GEEffectGraph::AddInput(NodeId node, NodeId from, const std::string& tagName)
+{
+    return AddInput(node, from, Drawing::GEParamsMemberHelper::GEParamsMemberTagFromString(tagName));
+}
+
+bool GEEffectGraph::ExportTo(
+    NodeId from, const std::shared_ptr<Drawing::GEVisualEffect>& consumer, Drawing::GEParamsMemberTag tag)
+{
+    if (from == SOURCE || !IsValidNode(from)) {
+        LOGE("GEEffectGraph::ExportTo invalid node %{public}u", from);
+        return false;
+    }
+    if (!IsTagOfEffect(consumer, tag)) {
+        LOGE("GEEffectGraph::ExportTo tag %{public}u does not belong to consumer", static_cast<uint32_t>(tag));
+        return false;
+    }
+    nodes_[from].exports.push_back({ consumer, tag });
+    return true;
+}
+
+bool GEEffectGraph::SetOutput(NodeId node)
+{
+    if (!IsValidNode(node)) {
+        LOGE("GEEffectGraph::SetOutput invalid node %{public}u", node);
+        return false;
+    }
+    output_ = node;
+    return true;
+}
+
+const GEEffectGraph::Node* GEEffectGraph::GetNode(NodeId node) const
+{
+    if (node == SOURCE || !IsValidNode(node)) {
+        return nullptr;
+    }
+    return &nodes_[node];
+}
+
+std::vector<bool> GEEffectGraph::CollectLiveNodes() const
+{
+    std::vector<bool> live(nodes_.size(), false);
+    std::vector<NodeId> stack;
+    if (IsValidNode(output_)) {
+        stack.push_back(output_);
+    }
+    for (NodeId id = 1; id < nodes_.size(); ++id) {
+        if (!nodes_[id].exports.empty()) {
+            stack.push_back(id);
+        }
+    }
+    while (!stack.empty()) {
+        const NodeId id = stack.back();
+        stack.pop_back();
+        if (live[id]) {
+            continue;
+        }
+        live[id] = true;
+        if (id == SOURCE) {
+            continue;
+        }
+        stack.push_back(nodes_[id].primaryInput);
+        for (const auto& input : nodes_[id].namedInputs) {
+            stack.push_back(input.from);
+        }
+    }
+    return live;
+}
+
+std::optional<GEEffectGraph::Schedule> GEEffectGraph::BuildSchedule() const
+{
+    const auto live = CollectLiveNodes();
+    const size_t nodeCount = nodes_.size();
+    // Every edge is counted, a node feeding both the primary and a named input of a consumer counts twice
+    std::vector<uint32_t> pendingInputs(nodeCount, 0);
+    std::vector<uint32_t> pendingConsumers(nodeCount, 0);
+    std::vector<std::vector<NodeId>> consumers(nodeCount);
+    size_t liveCount = 0;
+    for (NodeId id = 1; id < nodeCount; ++id) {
+        if (!live[id]) {
+            continue;
+        }
+        ++liveCount;
+        auto addEdge = [&](NodeId from) {
+            ++pendingInputs[id];
+            ++pendingConsumers[from];
+            consumers[from].push_back(id);
+        };
+        addEdge(nodes_[id].primaryInput);
+        for (const auto& input : nodes_[id].namedInputs) {
+            addEdge(input.from);
+        }
+    }
+    if (liveCount == 0) {
+        if (output_ == SOURCE) {
+            return Schedule {}; // Nothing to execute, the source is the output
+        }
+        LOGD("GEEffectGraph::BuildSchedule graph has neither output nor exports");
+        return std::nullopt;
+    }
+
+    Schedule schedule;
+    // Min-heap on node id keeps insertion order whenever the topology allows it
+    std::priority_queue<NodeId, std::vector<NodeId>, std::greater<NodeId>> ready;
+    for (NodeId consumer : consumers[SOURCE]) {
+        if (--pendingInputs[consumer] == 0) {
+            ready.push(consumer);
+        }
+    }
+    size_t liveIntermediates = 0;
+    while (!ready.empty()) {
+        const NodeId id = ready.top();
+        ready.pop();
+        const auto& node = nodes_[id];
+        std::vector<NodeId> released;
+        auto consume = [&](NodeId from) {
+            if (--pendingConsumers[from] == 0 && from != output_) {
+                released.push_back(from);
+            }
+        };
+        consume(node.primaryInput);
+        for (const auto& input : node.namedInputs) {
+            consume(input.from);
+        }
+        ++liveIntermediates;
+        schedule.peakLiveIntermediates = std::max(schedule.peakLiveIntermediates, liveIntermediates);
+        // Nodes only feeding exports are handed over to the caller right after execution
+        if (pendingConsumers[id] == 0 && id != output_) {
+            released.push_back(id);
+        }
+        for (NodeId releasedId : released) {
+            if (releasedId != SOURCE) {
+                --liveIntermediates;
+            }
+        }
+        schedule.order.push_back(id);
+        schedule.releaseAfter.push_back(std::move(released));
+        for (NodeId consumer : consumers[id]) {
+            if (--pendingInputs[consumer] == 0) {
+                ready.push(consumer);
+            }
+        }
+    }
+    if (schedule.order.size() != liveCount) {
+        LOGE("GEEffectGraph::BuildSchedule cycle detected, %{public}zu of %{public}zu nodes scheduled",
+            schedule.order.size(), liveCount);
+        return std::nullopt;
+    }
+    return schedule;
+}
+
+GEEffectGraph GEEffectGraph::FromChain(const std::vector<std::shared_ptr<Drawing::GEVisualEffect>>& effects)
+{
+    GEEffectGraph graph;
+    NodeId last = SOURCE;
+    for (const auto& effect : effects) {
+        const NodeId id = graph.AddNode(effect, last);
+        if (id != INVALID_NODE) {
+            last = id;
+        }
+    }
+    graph.SetOutput(last);
+    return graph;
+}
+
+} // namespace Rosen
+} // namespace OHOS
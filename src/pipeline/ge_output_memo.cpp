@@ -0,0 +1,145 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "ge_output_memo.h"
+
+#include <algorithm>
+#include <functional>
+
+#include "ge_log.h"
+
+namespace OHOS {
+namespace Rosen {
+namespace {
+constexpr size_t HASH_MIX = static_cast<size_t>(0x9e3779b97f4a7c15ULL); // Golden ratio, spreads the combined bits
+
+void HashCombine(size_t& seed, size_t value)
+{
+    seed ^= value + HASH_MIX + (seed << 6) + (seed >> 2); // 6, 2: shifts of boost::hash_combine
+}
+
+void HashRect(size_t& seed, const Drawing::Rect& rect)
+{
+    const std::hash<float> hashFloat;
+    HashCombine(seed, hashFloat(rect.GetLeft()));
+    HashCombine(seed, hashFloat(rect.GetTop()));
+    HashCombine(seed, hashFloat(rect.GetRight()));
+    HashCombine(seed, hashFloat(rect.GetBottom()));
+}
+} // namespace
+
+bool GEOutputMemo::Key::operator==(const Key& other) const
+{
+    return position == other.position && inputImageId == other.inputImageId && contentHash == other.contentHash &&
+        src == other.src && dst == other.dst && headroom == other.headroom && isRaster == other.isRaster;
+}
+
+size_t GEOutputMemo::KeyHash::operator()(const Key& key) const
+{
+    size_t seed = std::hash<uint64_t>()(key.contentHash);
+    HashCombine(seed, key.position);
+    HashCombine(seed, key.inputImageId);
+    HashRect(seed, key.src);
+    HashRect(seed, key.dst);
+    HashCombine(seed, std::hash<float>()(key.headroom));
+    HashCombine(seed, key.isRaster ? 1 : 0);
+    return seed;
+}
+
+GEOutputMemo& GEOutputMemo::GetInstance()
+{
+    // Outputs belong to the GPU context of the rendering thread, so each thread keeps its own memo
+    static thread_local GEOutputMemo instance;
+    return instance;
+}
+
+size_t GEOutputMemo::EstimateBytes(const std::shared_ptr<Drawing::Image>& image)
+{
+    if (image == nullptr || image->GetWidth() <= 0 || image->GetHeight() <= 0) {
+        return 0;
+    }
+    const int bytesPerPixel = std::max(image->GetImageInfo().GetBytesPerPixel(), 1);
+    return static_cast<size_t>(image->GetWidth()) * static_cast<size_t>(image->GetHeight()) *
+        static_cast<size_t>(bytesPerPixel);
+}
+
+std::shared_ptr<Drawing::Image> GEOutputMemo::Find(const Key& key)
+{
+    auto it = index_.find(key);
+    if (it == index_.end()) {
+        return nullptr;
+    }
+    entries_.splice(entries_.begin(), entries_, it->second);
+    return it->second->output;
+}
+
+void GEOutputMemo::Store(const Key& key, const std::shared_ptr<Drawing::Image>& output)
+{
+    const size_t bytes = EstimateBytes(output);
+    auto it = index_.find(key);
+    if (it != index_.end()) {
+        usedBytes_ -= it->second->bytes;
+        entries_.erase(it->second);
+        index_.erase(it);
+    }
+    if (bytes == 0 || bytes > budgetBytes_) {
+        LOGD("GEOutputMemo::Store output of %{public}zu bytes not kept", bytes);
+        return;
+    }
+    Evict(budgetBytes_ - bytes);
+    entries_.push_front({ key, output, bytes });
+    index_[key] = entries_.begin();
+    usedBytes_ += bytes;
+}
+
+void GEOutputMemo::SetBudget(size_t budgetBytes)
+{
+    budgetBytes_ = budgetBytes;
+    Evict(budgetBytes_);
+}
+
+size_t GEOutputMemo::GetBudget() const
+{
+    return budgetBytes_;
+}
+
+size_t GEOutputMemo::GetUsedBytes() const
+{
+    return usedBytes_;
+}
+
+size_t GEOutputMemo::GetEntryCount() const
+{
+    return entries_.size();
+}
+
+void GEOutputMemo::Clear()
+{
+    index_.clear();
+    entries_.clear();
+    usedBytes_ = 0;
+}
+
+void GEOutputMemo::Evict(size_t budgetBytes)
+{
+    while (usedBytes_ > budgetBytes && !entries_.empty()) {
+        const auto& oldest = entries_.back();
+        usedBytes_ -= oldest.bytes;
+        index_.erase(oldest.key);
+        entries_.pop_back();
+    }
+}
+} // namespace Rosen
+} // namespace OHOS
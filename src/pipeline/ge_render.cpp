@@ -14,15 +14,26 @@
  */
 #include "ge_render.h"
 
+#include <chrono>
+
 #include "core/ge_effect_factory.h"
 #include "ge_direct_draw_on_canvas_pass.h"
+#include "ge_effect_cost_model.h"
+#include "ge_feature_flags.h"
 #include "ge_filter_composer.h"
+#include "ge_frame_pool.h"
 #include "ge_hps_build_pass.h"
 #include "ge_hps_effect_filter.h"
 #include "ge_hps_upscale_pass.h"
 #include "ge_log.h"
 #include "ge_mesa_fusion_pass.h"
+#include "ge_output_memo.h"
+#include "ge_params_hash.h"
+#include "ge_quality_governor.h"
+#include "ge_shader_composition_pass.h"
 #include "ge_system_properties.h"
+#include "ge_tone_mapping_helper.h"
+#include "ge_tone_mapping_lut.h"
 #include "ge_visual_effect_impl.h"
 
 namespace OHOS {
@@ -37,6 +48,150 @@ std::atomic<bool> GERender::isMesablurAllEnable_(false);
 #endif
 using namespace Rosen::Drawing;
 
+namespace {
+// Period of the GEFramePool frames, the default frame window of GEQualityGovernor
+constexpr std::chrono::nanoseconds FRAME_POOL_PERIOD { 8333333 };
+
+// Ends the GEFramePool frame of the calling thread at its first invocation once a frame period has elapsed
+void EndFramePoolFrameIfElapsed()
+{
+    thread_local std::chrono::steady_clock::time_point frameStart {};
+    const auto now = std::chrono::steady_clock::now();
+    if (now - frameStart < FRAME_POOL_PERIOD) {
+        return;
+    }
+    frameStart = now;
+    GEFramePool::GetInstance().EndFrame();
+}
+
+// Texel reads predicted by the [[ge::cost(...)]] model of the effect for src, 0 when its params have none
+float PredictTexelReads(const GEVisualEffectImpl& ve, const Drawing::Rect& src)
+{
+    auto cost = ve.EstimateCost();
+    return cost ? cost->EstimateTexelReads(src.GetWidth(), src.GetHeight()) : 0.0f;
+}
+
+bool IsRasterCanvas(Drawing::Canvas& canvas)
+{
+#ifdef RS_ENABLE_GPU
+    return canvas.GetGPUContext() == nullptr;
+#else
+    return true;
+#endif
+}
+
+// GASIFY and PARTICLE_ABLATION draw outside of src, the caller must draw their result in the expansion rect
+void RecordExpansion(const GEVisualEffectImpl& ve, const Drawing::Rect& src, GERender::InvocationOutputs& outputs)
+{
+    if (ve.GetFilterType() == GEVisualEffectImpl::FilterType::GASIFY ||
+        ve.GetFilterType() == GEVisualEffectImpl::FilterType::PARTICLE_ABLATION) {
+        outputs.needExpansionFilter = true;
+        outputs.expansionRect = src;
+    }
+}
+
+// False when the invocation cannot be memoized: the memo is disabled, the effect type did not opt in with
+// GE_FACTORY_MEMO_OPTIONS, the caller disabled filter caching, a params member has no content hash, or the filter may
+// store into the cache provider, a side effect a memoized output would skip
+bool MakeOutputMemoKey(Drawing::Canvas& canvas, const GEVisualEffect& visualEffect, uint32_t position,
+    const GERender::ShaderFilterEffectContext& context, GEOutputMemo::Key& key)
+{
+    auto ve = visualEffect.GetImpl();
+    if (ve == nullptr || context.image == nullptr || context.geCacheProvider != nullptr ||
+        !GEFeatureFlags::GetInstance().IsEnabled(GEFeatureFlag::OUTPUT_MEMO)) {
+        return false;
+    }
+    const uint32_t options = GEEffectFactory::GetMemoOptions(ve->GetFilterType());
+    uint64_t paramsHash = 0;
+    if (!(options & GEEffectFactory::MEMO_OUTPUT) || visualEffect.GetCanvasInfo().disableFilterCache ||
+        !ve->HashParams(paramsHash)) {
+        return false;
+    }
+    // Everything besides the params the filter output depends on
+    Drawing::GEParamsHasher hasher;
+    hasher.Add(paramsHash);
+    hasher.Add(visualEffect.GetCanvasInfo());
+    if (options & GEEffectFactory::MEMO_CANVAS_MATRIX) {
+        hasher.Add(canvas.GetTotalMatrix());
+    }
+    hasher.Add(GEQualityGovernor::GetInstance().GetDegradeSteps());
+    hasher.Add(context.outputToneMappingHeadroom);
+    key.position = position;
+    key.inputImageId = context.image->GetUniqueID();
+    key.contentHash = hasher.GetHash();
+    key.src = context.src;
+    key.dst = context.dst;
+    key.headroom = visualEffect.GetSupportHeadroom();
+    key.isRaster = IsRasterCanvas(canvas);
+    return true;
+}
+
+// Key of a run of GEShaderCompositionPass, the keys of its filters hashed together
+bool MakeComposedOutputMemoKey(Drawing::Canvas& canvas,
+    const std::vector<std::shared_ptr<GEVisualEffect>>& visualEffects, uint32_t position,
+    const GERender::ShaderFilterEffectContext& context, GEOutputMemo::Key& key)
+{
+    Drawing::GEParamsHasher hasher;
+    hasher.Add(static_cast<uint64_t>(visualEffects.size()));
+    for (const auto& visualEffect : visualEffects) {
+        if (visualEffect == nullptr || !MakeOutputMemoKey(canvas, *visualEffect, position, context, key)) {
+            return false;
+        }
+        hasher.Add(key.contentHash);
+        hasher.Add(key.headroom);
+    }
+    key.contentHash = hasher.GetHash();
+    return true;
+}
+
+// A thread may render with several GPU contexts, only reuse memoized outputs that belong to the context of canvas
+bool IsUsableOn(Drawing::Canvas& canvas, const Drawing::Image& image)
+{
+#ifdef RS_ENABLE_GPU
+    if (!IsRasterCanvas(canvas)) {
+        return image.IsValid(canvas.GetGPUContext().get());
+    }
+#endif
+    return true;
+}
+
+// Draws src of image to dst tone-mapped in the same draw, through a shader on GPU and the LUT CPU path on raster
+bool DrawToneMappedImage(Drawing::Canvas& canvas, const std::shared_ptr<Drawing::Image>& image,
+    const Drawing::Rect& src, const Drawing::Rect& dst, float headroom)
+{
+    auto& lut = GEToneMappingLut::GetInstance();
+    Drawing::Brush brush;
+    if (IsRasterCanvas(canvas)) {
+        auto toneMapped = lut.ToneMapImage(*image, headroom);
+        if (toneMapped == nullptr) {
+            return false;
+        }
+        canvas.AttachBrush(brush);
+        canvas.DrawImageRect(*toneMapped, src, dst, Drawing::SamplingOptions());
+        canvas.DetachBrush();
+        return true;
+    }
+    if (src.GetWidth() <= 0.0f || src.GetHeight() <= 0.0f) {
+        return false;
+    }
+    Drawing::Matrix matrix;
+    matrix.SetScaleTranslate(dst.GetWidth() / src.GetWidth(), dst.GetHeight() / src.GetHeight(),
+        dst.GetLeft() - src.GetLeft() * dst.GetWidth() / src.GetWidth(),
+        dst.GetTop() - src.GetTop() * dst.GetHeight() / src.GetHeight());
+    auto imageShader = Drawing::ShaderEffect::CreateImageShader(*image, Drawing::TileMode::CLAMP,
+        Drawing::TileMode::CLAMP, Drawing::SamplingOptions(), matrix);
+    auto shader = lut.MakeToneMappedShader(imageShader, headroom);
+    if (shader == nullptr) {
+        return false;
+    }
+    brush.SetShaderEffect(shader);
+    canvas.AttachBrush(brush);
+    canvas.DrawRect(dst);
+    canvas.DetachBrush();
+    return true;
+}
+} // namespace
+
 GERender::GERender() {}
 
 GERender::~GERender() {}
@@ -55,6 +210,10 @@ void GERender::DrawImageEffect(Drawing::Canvas& canvas, Drawing::GEVisualEffectC
         LOGE("GERender::DrawImageRect resImage is null");
         return;
     }
+    const float headroom = veContainer.GetOutputToneMappingHeadroom();
+    if (GEToneMappingHelper::NeedToneMapping(headroom) && DrawToneMappedImage(canvas, resImage, src, dst, headroom)) {
+        return;
+    }
     Drawing::Brush brush;
     canvas.AttachBrush(brush);
     canvas.DrawImageRect(*resImage, src, dst, Drawing::SamplingOptions());
@@ -65,17 +224,95 @@ std::shared_ptr<Drawing::Image> GERender::ApplyImageEffect(Drawing::Canvas& canv
     Drawing::GEVisualEffectContainer& veContainer, const ShaderFilterEffectContext& context,
     const Drawing::SamplingOptions& sampling)
 {
+    return ApplyImageEffectWithResult(canvas, veContainer, context, sampling).image;
+}
+
+GERender::ApplyImageEffectResult GERender::ApplyImageEffectWithResult(Drawing::Canvas& canvas,
+    Drawing::GEVisualEffectContainer& veContainer, const ShaderFilterEffectContext& context,
+    const Drawing::SamplingOptions& sampling)
+{
+    ApplyImageEffectResult result;
     if (!context.image) {
         LOGE("GERender::ApplyImageEffect image is null");
-        return nullptr;
+        return result;
     }
+    EndFramePoolFrameIfElapsed();
+    GEQualityGovernor::CostScope costScope;
     auto resImage = context.image;
-    for (auto& vef: veContainer.GetFilters()) {
-        ShaderFilterEffectContext innerContext {resImage, context.src, context.dst, context.geCacheProvider};
-        ProcessShaderFilter(canvas, vef, resImage, innerContext);
+    auto composables = GEFilterComposer::BuildComposables(veContainer.GetFilters());
+    GEShaderCompositionPass().Run(composables);
+    uint32_t position = 0;
+    for (auto& composable : composables) {
+        ShaderFilterEffectContext innerContext {
+            resImage, context.src, context.dst, context.geCacheProvider, context.deadlineNs};
+        if (auto composed = ShaderCompositionFlag::GetComposedEffects(composable); composed != nullptr) {
+            ProcessMemoizedComposedShaderFilters(canvas, *composed, position, resImage, innerContext, result.outputs);
+            position += static_cast<uint32_t>(composed->size());
+            continue;
+        }
+        ProcessMemoizedShaderFilter(
+            canvas, composable.GetEffect(), position, resImage, innerContext, result.outputs);
+        ++position;
     }
+    PublishLegacyOutputs(result.outputs);
+    result.image = resImage;
+    return result;
+}
 
-    return resImage;
+GERender::ApplyEffectGraphResult GERender::ApplyEffectGraph(Drawing::Canvas& canvas, const GEEffectGraph& graph,
+    const ShaderFilterEffectContext& context)
+{
+    ApplyEffectGraphResult result;
+    if (!context.image) {
+        LOGE("GERender::ApplyEffectGraph image is null");
+        return result;
+    }
+    const auto schedule = graph.BuildSchedule();
+    if (!schedule) {
+        LOGE("GERender::ApplyEffectGraph invalid graph");
+        return result;
+    }
+    EndFramePoolFrameIfElapsed();
+    GEQualityGovernor::CostScope costScope;
+    // Indexed by node id, SOURCE included
+    std::vector<std::shared_ptr<Drawing::Image>> nodeImages(graph.GetNodeCount() + 1);
+    nodeImages[GEEffectGraph::SOURCE] = context.image;
+    for (size_t step = 0; step < schedule->order.size(); ++step) {
+        const auto id = schedule->order[step];
+        const auto* node = graph.GetNode(id);
+        if (node == nullptr) { // Guaranteed by BuildSchedule, kept as a safeguard
+            continue;
+        }
+        auto impl = node->effect->GetImpl();
+        if (impl != nullptr) {
+            for (const auto& input : node->namedInputs) {
+                impl->SetParam(input.tag, nodeImages[input.from]);
+            }
+        }
+        auto resImage = nodeImages[node->primaryInput];
+        ShaderFilterEffectContext innerContext {
+            resImage, context.src, context.dst, context.geCacheProvider, context.deadlineNs};
+        ProcessMemoizedShaderFilter(canvas, node->effect, id, resImage, innerContext, result.outputs);
+        nodeImages[id] = resImage;
+        ++result.executedNodes;
+        for (const auto& exported : node->exports) {
+            auto consumerImpl = exported.consumer->GetImpl();
+            if (consumerImpl == nullptr) {
+                LOGE("GERender::ApplyEffectGraph export consumer has no impl");
+                continue;
+            }
+            consumerImpl->SetParam(exported.tag, resImage);
+            result.exportedImages.push_back(resImage);
+        }
+        for (auto released : schedule->releaseAfter[step]) {
+            nodeImages[released] = nullptr;
+        }
+    }
+    if (graph.GetOutput() != GEEffectGraph::INVALID_NODE) {
+        result.image = nodeImages[graph.GetOutput()];
+    }
+    PublishLegacyOutputs(result.outputs);
+    return result;
 }
 
 bool GERender::BeforeApplyShaderFilter(Drawing::Canvas& canvas,
@@ -93,6 +330,7 @@ bool GERender::BeforeApplyShaderFilter(Drawing::Canvas& canvas,
         return false;
     }
     geShaderFilter->SetSupportHeadroom(visualEffect->GetSupportHeadroom());
+    geShaderFilter->SetOutputToneMappingHeadroom(context.outputToneMappingHeadroom);
     geShaderFilter->SetCache(ve->GetCache());
     geShaderFilter->SetCacheProvider(context.geCacheProvider);
     geShaderFilter->Preprocess(canvas, context.src, context.dst);
@@ -100,26 +338,20 @@ bool GERender::BeforeApplyShaderFilter(Drawing::Canvas& canvas,
 }
 
 bool GERender::AfterApplyShaderFilter(Drawing::Canvas& canvas, const Drawing::GEVisualEffect& visualEffect,
-    const ShaderFilterEffectContext& context, const GEShaderFilter& geShaderFilter)
+    const ShaderFilterEffectContext& context, const GEShaderFilter& geShaderFilter, InvocationOutputs& outputs)
 {
     // Update information after executing the shader filter
     auto ve = visualEffect.GetImpl();
     ve->SetCache(geShaderFilter.GetCache());
-    if (ve->GetFilterType() == Drawing::GEVisualEffectImpl::FilterType::GASIFY ||
-        ve->GetFilterType() == Drawing::GEVisualEffectImpl::FilterType::PARTICLE_ABLATION) {
-        isNeedExpansionFilter_ = true;
-        expansionRect_.SetLeft(context.src.GetLeft());
-        expansionRect_.SetTop(context.src.GetTop());
-        expansionRect_.SetRight(context.src.GetRight());
-        expansionRect_.SetBottom(context.src.GetBottom());
-    }
+    RecordExpansion(*ve, context.src, outputs);
     return true;
 }
 
 GERender::ApplyShaderFilterTarget GERender::DrawShaderFilter(Drawing::Canvas& canvas,
     std::shared_ptr<Drawing::GEVisualEffect> visualEffect, Drawing::Brush& brush,
-    const ShaderFilterEffectContext& context)
+    const ShaderFilterEffectContext& context, InvocationOutputs& outputs)
 {
+    const uint64_t startNs = GEEffectCostModel::NowNs();
     std::shared_ptr<GEShaderFilter> geShaderFilter;
     if (!BeforeApplyShaderFilter(canvas, visualEffect, context, geShaderFilter)) {
         return ApplyShaderFilterTarget::Error;
@@ -129,7 +361,11 @@ GERender::ApplyShaderFilterTarget GERender::DrawShaderFilter(Drawing::Canvas& ca
     if (!status) {
         return ApplyShaderFilterTarget::Error;
     }
-    if (!AfterApplyShaderFilter(canvas, *visualEffect, context, *geShaderFilter)) {
+    outputs.outputToneMapped = geShaderFilter->IsOutputToneMapped();
+    auto ve = visualEffect->GetImpl();
+    GEEffectCostModel::GetInstance().Report(ve->GetFilterType(), GEEffectCostModel::NowNs() - startNs,
+        PredictTexelReads(*ve, context.src));
+    if (!AfterApplyShaderFilter(canvas, *visualEffect, context, *geShaderFilter, outputs)) {
         return ApplyShaderFilterTarget::Error;
     }
     return ApplyShaderFilterTarget::DrawOnCanvas;
@@ -137,20 +373,157 @@ GERender::ApplyShaderFilterTarget GERender::DrawShaderFilter(Drawing::Canvas& ca
 
 GERender::ApplyShaderFilterTarget GERender::ProcessShaderFilter(Drawing::Canvas& canvas,
     std::shared_ptr<Drawing::GEVisualEffect> visualEffect, std::shared_ptr<Drawing::Image>& resImage,
-    const ShaderFilterEffectContext& context)
+    const ShaderFilterEffectContext& context, InvocationOutputs& outputs)
 {
+    const uint64_t startNs = GEEffectCostModel::NowNs();
     std::shared_ptr<GEShaderFilter> geShaderFilter;
     if (!BeforeApplyShaderFilter(canvas, visualEffect, context, geShaderFilter)) {
         return ApplyShaderFilterTarget::Error;
     }
     // When BeforeApplyShaderFilter returning true, geShaderFilter and visualEffect is guranteed not nullptr
     resImage = geShaderFilter->ProcessImage(canvas, resImage, context.src, context.dst);
-    if (!AfterApplyShaderFilter(canvas, *visualEffect, context, *geShaderFilter)) {
+    auto ve = visualEffect->GetImpl();
+    GEEffectCostModel::GetInstance().Report(ve->GetFilterType(), GEEffectCostModel::NowNs() - startNs,
+        PredictTexelReads(*ve, context.src));
+    // Only keep the output alive for the callers that schedule with a deadline
+    if (context.deadlineNs != 0 && resImage != nullptr &&
+        (GEEffectFactory::GetDegradeOptions(ve->GetFilterType()) & GEEffectFactory::DEGRADE_REUSE_OUTPUT)) {
+        ve->SetLastOutput(resImage, context.src);
+    }
+    if (!AfterApplyShaderFilter(canvas, *visualEffect, context, *geShaderFilter, outputs)) {
         return ApplyShaderFilterTarget::Error;
     }
     return ApplyShaderFilterTarget::DrawOnImage;
 }
 
+void GERender::ProcessMemoizedShaderFilter(Drawing::Canvas& canvas,
+    const std::shared_ptr<Drawing::GEVisualEffect>& visualEffect, uint32_t position,
+    std::shared_ptr<Drawing::Image>& image, const ShaderFilterEffectContext& context, InvocationOutputs& outputs)
+{
+    auto& memo = GEOutputMemo::GetInstance();
+    GEOutputMemo::Key key;
+    const bool memoizable = visualEffect != nullptr && MakeOutputMemoKey(canvas, *visualEffect, position, context, key);
+    if (memoizable) {
+        auto output = memo.Find(key);
+        if (output != nullptr && IsUsableOn(canvas, *output)) {
+            auto ve = visualEffect->GetImpl();
+            image = output;
+            RecordExpansion(*ve, context.src, outputs);
+            if (context.deadlineNs != 0) {
+                outputs.scheduleRecords.push_back({ ve->GetFilterType(), EffectDecision::MEMOIZED, 0 });
+            }
+            return;
+        }
+    }
+    if (!ScheduleShaderFilter(visualEffect, image, context, outputs) ||
+        ProcessShaderFilter(canvas, visualEffect, image, context, outputs) != ApplyShaderFilterTarget::DrawOnImage) {
+        return;
+    }
+    if (memoizable && image != nullptr) {
+        memo.Store(key, image);
+    }
+}
+
+bool GERender::ProcessComposedShaderFilters(Drawing::Canvas& canvas,
+    const std::vector<std::shared_ptr<Drawing::GEVisualEffect>>& visualEffects,
+    std::shared_ptr<Drawing::Image>& image, const ShaderFilterEffectContext& context, InvocationOutputs& outputs)
+{
+    if (context.deadlineNs != 0 || image == nullptr) {
+        return false;
+    }
+    const auto info = image->GetImageInfo();
+    Drawing::Matrix matrix;
+    auto shader = Drawing::ShaderEffect::CreateImageShader(*image, Drawing::TileMode::CLAMP,
+        Drawing::TileMode::CLAMP, Drawing::SamplingOptions(Drawing::FilterMode::LINEAR), matrix);
+    std::vector<std::shared_ptr<GEShaderFilter>> geShaderFilters;
+    geShaderFilters.reserve(visualEffects.size());
+    for (const auto& visualEffect : visualEffects) {
+        std::shared_ptr<GEShaderFilter> geShaderFilter;
+        if (!BeforeApplyShaderFilter(canvas, visualEffect, context, geShaderFilter)) {
+            return false;
+        }
+        shader = geShaderFilter->MakeComposableShader(shader, info);
+        if (shader == nullptr) {
+            LOGD("GERender::ProcessComposedShaderFilters %{public}s is not composable",
+                geShaderFilter->TypeName().data());
+            return false;
+        }
+        geShaderFilters.push_back(geShaderFilter);
+    }
+    auto composedImage = GEShaderFilter::MakeComposedImage(canvas, shader, info);
+    if (composedImage == nullptr) {
+        LOGD("GERender::ProcessComposedShaderFilters make image failed");
+        return false;
+    }
+    image = composedImage;
+    // The time of the single pass cannot be split among the filters, GEEffectCostModel only learns from the
+    // invocations processed one by one
+    for (size_t i = 0; i < visualEffects.size(); ++i) {
+        AfterApplyShaderFilter(canvas, *visualEffects[i], context, *geShaderFilters[i], outputs);
+    }
+    return true;
+}
+
+void GERender::ProcessMemoizedComposedShaderFilters(Drawing::Canvas& canvas,
+    const std::vector<std::shared_ptr<Drawing::GEVisualEffect>>& visualEffects, uint32_t position,
+    std::shared_ptr<Drawing::Image>& image, const ShaderFilterEffectContext& context, InvocationOutputs& outputs)
+{
+    auto& memo = GEOutputMemo::GetInstance();
+    GEOutputMemo::Key key;
+    const bool memoizable = MakeComposedOutputMemoKey(canvas, visualEffects, position, context, key);
+    if (memoizable) {
+        auto output = memo.Find(key);
+        if (output != nullptr && IsUsableOn(canvas, *output)) {
+            image = output;
+            for (const auto& visualEffect : visualEffects) {
+                RecordExpansion(*visualEffect->GetImpl(), context.src, outputs);
+            }
+            return;
+        }
+    }
+    if (ProcessComposedShaderFilters(canvas, visualEffects, image, context, outputs)) {
+        if (memoizable && image != nullptr) {
+            memo.Store(key, image);
+        }
+        return;
+    }
+    for (const auto& visualEffect : visualEffects) {
+        ShaderFilterEffectContext innerContext {
+            image, context.src, context.dst, context.geCacheProvider, context.deadlineNs };
+        ProcessMemoizedShaderFilter(canvas, visualEffect, position++, image, innerContext, outputs);
+    }
+}
+
+bool GERender::ScheduleShaderFilter(const std::shared_ptr<Drawing::GEVisualEffect>& visualEffect,
+    std::shared_ptr<Drawing::Image>& image, const ShaderFilterEffectContext& context, InvocationOutputs& outputs)
+{
+    if (context.deadlineNs == 0 || visualEffect == nullptr || visualEffect->GetImpl() == nullptr) {
+        return true;
+    }
+    auto ve = visualEffect->GetImpl();
+    const auto type = ve->GetFilterType();
+    EffectScheduleRecord record { type, EffectDecision::EXECUTED,
+        GEEffectCostModel::GetInstance().GetEstimateNs(type, PredictTexelReads(*ve, context.src)) };
+    // Types never measured run once to get an estimate
+    const bool fitsDeadline = record.estimatedCostNs == 0 ||
+        GEEffectCostModel::NowNs() + record.estimatedCostNs <= context.deadlineNs;
+    if (!fitsDeadline) {
+        const uint32_t options = GEEffectFactory::GetDegradeOptions(type);
+        auto lastOutput = (options & GEEffectFactory::DEGRADE_REUSE_OUTPUT) ? ve->GetLastOutput(context.src) : nullptr;
+        if (lastOutput != nullptr) {
+            image = lastOutput;
+            record.decision = EffectDecision::REUSED_OUTPUT;
+        } else if (options & GEEffectFactory::DEGRADE_SKIP) {
+            record.decision = EffectDecision::SKIPPED;
+        }
+    }
+    LOGD("GERender::ScheduleShaderFilter type %{public}d decision %{public}d estimate %{public}llu",
+        static_cast<int>(type), static_cast<int>(record.decision),
+        static_cast<unsigned long long>(record.estimatedCostNs));
+    outputs.scheduleRecords.push_back(record);
+    return record.decision == EffectDecision::EXECUTED;
+}
+
 // Internal helper for composing / transforming effects with GEFilterComposer.
 // Add passes in this function if needed.
 // Used in ApplyHpsGEImageEffect only.
@@ -171,6 +544,8 @@ static bool ComposeEffects(Drawing::Canvas& canvas,
     if (!composerResult.anyPassChanged) { // Compatiblity fallback when no change applied to composables
         return false;
     }
+    // Kept out of the fallback decision: chains only composition would change go to ApplyImageEffect, which composes
+    GEShaderCompositionPass().Run(composables);
     return true;
 }
 
@@ -182,6 +557,8 @@ GERender::ApplyHpsGEResult GERender::ApplyHpsGEImageEffect(Drawing::Canvas& canv
         LOGE("GERender::ApplyHpsGEImageEffect image is null");
         return ApplyHpsGEResult::CanvasNotDrawnAndHpsNotApplied();
     }
+    EndFramePoolFrameIfElapsed();
+    GEQualityGovernor::CostScope costScope;
     const auto& visualEffects = veContainer.GetFilters();
     std::vector<GEFilterComposable> composables;
     if (!ComposeEffects(canvas, visualEffects, context, composables)) {
@@ -189,14 +566,24 @@ GERender::ApplyHpsGEResult GERender::ApplyHpsGEImageEffect(Drawing::Canvas& canv
     }
     auto currentImage = context.image;
     std::shared_ptr<Drawing::Image> resImage = nullptr;
+    InvocationOutputs outputs;
+    const GEFilterComposable* lastComposable = composables.empty() ? nullptr : &composables.back();
     bool appliedHpsBlur = false;
     bool lastAppliedHpsBlur = false;
     ApplyShaderFilterTarget applyTarget = ApplyShaderFilterTarget::Error; // Last applied target
     for (auto& composable: composables) {
         resImage = nullptr; // cleared the out variable to determine errors in hps call
         if (auto visualEffect = composable.GetEffect(); visualEffect != nullptr) {
-            ShaderFilterEffectContext geContext { currentImage, context.src, context.dst, context.geCacheProvider };
-            applyTarget = DispatchGEShaderFilter(canvas, brush, composable, visualEffect, geContext);
+            ShaderFilterEffectContext geContext {
+                currentImage, context.src, context.dst, context.geCacheProvider, context.deadlineNs };
+            if (&composable == lastComposable) {
+                geContext.outputToneMappingHeadroom = veContainer.GetOutputToneMappingHeadroom();
+            }
+            if (auto composed = ShaderCompositionFlag::GetComposedEffects(composable); composed != nullptr) {
+                applyTarget = DispatchComposedShaderFilters(canvas, brush, composable, *composed, geContext, outputs);
+            } else {
+                applyTarget = DispatchGEShaderFilter(canvas, brush, composable, visualEffect, geContext, outputs);
+            }
             resImage = geContext.image;
         } else if (auto hpsEffect = composable.GetHpsEffect(); hpsEffect != nullptr) {
             HpsEffectFilter::HpsEffectContext hpsEffectContext = {
@@ -209,23 +596,31 @@ GERender::ApplyHpsGEResult GERender::ApplyHpsGEImageEffect(Drawing::Canvas& canv
             LOGE("GERender::ApplyHpsGEImageEffect unhandled composable type");
         }
         if (resImage == nullptr) { // On error early returns
-            return ApplyHpsGEResult::CanvasNotDrawnAndHpsNotApplied();
+            PublishLegacyOutputs(outputs);
+            auto result = ApplyHpsGEResult::CanvasNotDrawnAndHpsNotApplied();
+            result.outputs = outputs;
+            return result;
         }
         currentImage = resImage;
     }
 
     outImage = resImage;
-    return { applyTarget == ApplyShaderFilterTarget::DrawOnCanvas, appliedHpsBlur }; // canvas drawn & applied hps blur
+    PublishLegacyOutputs(outputs);
+    // canvas drawn & applied hps blur
+    return { applyTarget == ApplyShaderFilterTarget::DrawOnCanvas, appliedHpsBlur, outputs };
 }
 
 GERender::ApplyShaderFilterTarget GERender::DispatchGEShaderFilter(Drawing::Canvas& canvas, Drawing::Brush& brush,
     GEFilterComposable& composable, std::shared_ptr<Drawing::GEVisualEffect>& visualEffect,
-    ShaderFilterEffectContext& geContext)
+    ShaderFilterEffectContext& geContext, InvocationOutputs& outputs)
 {
+    if (!ScheduleShaderFilter(visualEffect, geContext.image, geContext, outputs)) {
+        return ApplyShaderFilterTarget::DrawOnImage;
+    }
     ApplyShaderFilterTarget applyTarget;
     // Enabled direct drawing on canvas
     if (DirectDrawOnCanvasFlag::IsDirectDrawOnCanvasEnabled(composable)) {
-        applyTarget = DrawShaderFilter(canvas, visualEffect, brush, geContext);
+        applyTarget = DrawShaderFilter(canvas, visualEffect, brush, geContext, outputs);
         if (applyTarget == ApplyShaderFilterTarget::DrawOnCanvas) {
             return applyTarget;
         }
@@ -233,8 +628,31 @@ GERender::ApplyShaderFilterTarget GERender::DispatchGEShaderFilter(Drawing::Canv
     // Compatibility issue: dst assigned with src is a legacy issue when RSDrawingFilter calls
     // geRender->ApplyImageEffect(). When the issue is resolved, please remove this line.
     geContext.dst = geContext.src;
+    // The output goes back to the caller as an image, tone mapping is only fused when drawing on canvas
+    geContext.outputToneMappingHeadroom = 0.0f;
     // Direct drawing on canvas is disabled / not supported / failed, fallback to ProcessShaderFilter
-    applyTarget = ProcessShaderFilter(canvas, visualEffect, geContext.image, geContext);
+    applyTarget = ProcessShaderFilter(canvas, visualEffect, geContext.image, geContext, outputs);
+    return applyTarget;
+}
+
+GERender::ApplyShaderFilterTarget GERender::DispatchComposedShaderFilters(Drawing::Canvas& canvas,
+    Drawing::Brush& brush, GEFilterComposable& composable,
+    const std::vector<std::shared_ptr<Drawing::GEVisualEffect>>& visualEffects, ShaderFilterEffectContext& geContext,
+    InvocationOutputs& outputs)
+{
+    // Same legacy dst as DispatchGEShaderFilter, composed runs always draw on an image
+    geContext.dst = geContext.src;
+    geContext.outputToneMappingHeadroom = 0.0f;
+    if (ProcessComposedShaderFilters(canvas, visualEffects, geContext.image, geContext, outputs)) {
+        return ApplyShaderFilterTarget::DrawOnImage;
+    }
+    ApplyShaderFilterTarget applyTarget = ApplyShaderFilterTarget::Error;
+    for (auto visualEffect : visualEffects) {
+        applyTarget = DispatchGEShaderFilter(canvas, brush, composable, visualEffect, geContext, outputs);
+        if (geContext.image == nullptr) {
+            break;
+        }
+    }
     return applyTarget;
 }
 
@@ -296,6 +714,8 @@ void GERender::DrawShaderEffect(Drawing::Canvas& canvas, Drawing::GEVisualEffect
     const Drawing::Rect& bounds)
 {
     LOGD("GERender::shaderEffects %{public}zu", veContainer.GetFilters().size());
+    EndFramePoolFrameIfElapsed();
+    GEQualityGovernor::CostScope costScope;
     std::vector<std::shared_ptr<GEShader>> shaderEffects;
     for (auto vef : veContainer.GetFilters()) {
         if (vef == nullptr) {
@@ -323,17 +743,36 @@ std::shared_ptr<GEShader> GERender::GenerateShaderEffect(const std::shared_ptr<D
 void GERender::SetMesablurAllEnabledByCCM(bool flag)
 {
     if (flag) {
-        isMesablurAllEnable_.store(true);
+        isMesablurAllEnable_.store(true, std::memory_order_release);
     }
 }
 
+void GERender::PublishLegacyOutputs(const InvocationOutputs& outputs) const
+{
+    // Keep the legacy sticky semantics: the flag is only raised, the rect only updated along with it
+    if (!outputs.needExpansionFilter) {
+        return;
+    }
+    std::lock_guard<std::mutex> lock(legacyOutputsMutex_);
+    legacyOutputs_[std::this_thread::get_id()] = outputs;
+}
+
 bool GERender::IsNeedExpansionFilter()
 {
-    if (isNeedExpansionFilter_) {
-        isNeedExpansionFilter_ = false;
-        return true;
+    std::lock_guard<std::mutex> lock(legacyOutputsMutex_);
+    auto it = legacyOutputs_.find(std::this_thread::get_id());
+    if (it == legacyOutputs_.end() || !it->second.needExpansionFilter) {
+        return false;
     }
-    return false;
+    it->second.needExpansionFilter = false;
+    return true;
+}
+
+Drawing::Rect GERender::GetExpansionRect() const
+{
+    std::lock_guard<std::mutex> lock(legacyOutputsMutex_);
+    auto it = legacyOutputs_.find(std::this_thread::get_id());
+    return it != legacyOutputs_.end() ? it->second.expansionRect : Drawing::Rect {};
 }
 
 bool GERender::IsFrostedGlassFilter(Drawing::GEVisualEffectContainer& veContainer)
@@ -0,0 +1,105 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "ge_shader_composition_pass.h"
+
+#include "ge_feature_flags.h"
+#include "ge_filter_type.h"
+#include "ge_log.h"
+
+namespace OHOS {
+namespace Rosen {
+
+enum class ShaderComposition { NONE, RUN_START, ANY_POSITION };
+
+static ShaderComposition GetShaderComposition(Drawing::GEFilterType type)
+{
+    // NOTICE: DO NOT use std::map/std::unordered_set to replace switch/case, it's worse in performance, not better.
+    switch (type) {
+        // Filters overriding GEShaderFilter::MakeComposableShader and sampling their input once per pixel.
+        // If you want to add new support, add a case line below to support it
+        case Drawing::GEFilterType::GREY:
+        case Drawing::GEFilterType::AIBAR:
+        case Drawing::GEFilterType::WATER_RIPPLE:
+        case Drawing::GEFilterType::HEAT_DISTORTION:
+        case Drawing::GEFilterType::DISPLACEMENT_DISTORT_FILTER:
+        case Drawing::GEFilterType::COLOR_GRADIENT:
+            return ShaderComposition::ANY_POSITION;
+        // Samples its input once per color channel and once for the alpha
+        case Drawing::GEFilterType::DISPERSION:
+            return ShaderComposition::RUN_START;
+        default:
+            return ShaderComposition::NONE;
+    }
+    return ShaderComposition::NONE; // should be unreachable
+}
+
+static ShaderComposition GetShaderComposition(GEFilterComposable& composable)
+{
+    auto effect = composable.GetEffect();
+    if (effect == nullptr || effect->GetImpl() == nullptr) {
+        return ShaderComposition::NONE;
+    }
+    return GetShaderComposition(effect->GetImpl()->GetFilterType());
+}
+
+const std::vector<std::shared_ptr<Drawing::GEVisualEffect>>* ShaderCompositionFlag::GetComposedEffects(
+    const GEFilterComposable& composable)
+{
+    auto flag = composable.GetFlags<ShaderCompositionFlag>();
+    return flag != nullptr ? &flag->effects : nullptr;
+}
+
+std::string_view GEShaderCompositionPass::GetLogName() const
+{
+    return "GEShaderCompositionPass";
+}
+
+GEFilterComposerPassResult GEShaderCompositionPass::Run(std::vector<GEFilterComposable>& composables)
+{
+    if (composables.size() < 2 || !GEFeatureFlags::GetInstance().IsEnabled(GEFeatureFlag::SHADER_COMPOSITION)) {
+        return GEFilterComposerPassResult { false };
+    }
+    std::vector<GEFilterComposable> resultComposables;
+    bool composed = false;
+    size_t i = 0;
+    while (i < composables.size()) {
+        size_t end = i + 1;
+        if (GetShaderComposition(composables[i]) != ShaderComposition::NONE) {
+            while (end < composables.size() && end - i < MAX_RUN_LENGTH &&
+                GetShaderComposition(composables[end]) == ShaderComposition::ANY_POSITION) {
+                ++end;
+            }
+        }
+        resultComposables.push_back(composables[i]);
+        if (end - i > 1) {
+            std::vector<std::shared_ptr<Drawing::GEVisualEffect>> effects;
+            for (size_t j = i; j < end; ++j) {
+                effects.push_back(composables[j].GetEffect());
+            }
+            LOGD("GEShaderCompositionPass::Run %{public}zu filters composed", effects.size());
+            resultComposables.back().SetFlags(std::make_shared<ShaderCompositionFlag>(std::move(effects)));
+            composed = true;
+        }
+        i = end; // consumed the run, next loop starts after it
+    }
+    if (composed) {
+        composables.swap(resultComposables);
+    }
+    return GEFilterComposerPassResult { composed };
+}
+
+} // namespace Rosen
+} // namespace OHOS
@@ -14,23 +14,16 @@
  */
 
 #include "ge_cache_helper.h"
-#include "ge_system_properties.h"
+#include "ge_feature_flags.h"
 
 namespace OHOS::Rosen {
 bool GECacheHelper::IsSDFCacheEnabled(bool defaultValue)
 {
-#ifdef GE_OHOS
     // if -1, return the defaultValue; else if 0 force false, else if 1 force true
-    static CachedHandle g_Handle = CachedParameterCreate("persist.sys.graphic.effect.enablesdfcache", "-1");
-    int changed = 0;
-    const char* enable = CachedParameterGetChanged(g_Handle, &changed);
-    auto readValue = GESystemProperties::ConvertToInt(enable, -1);
+    auto readValue = GEFeatureFlags::GetInstance().GetInt(GEFeatureFlag::SDF_CACHE);
     if (readValue == -1) {
         return defaultValue;
     }
     return readValue > 0;
-#else
-    return defaultValue;
-#endif
 }
 } // OHOS::Rosen
\ No newline at end of file
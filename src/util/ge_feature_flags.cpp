@@ -0,0 +1,187 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "ge_feature_flags.h"
+
+#include <string>
+
+#include "ge_log.h"
+#include "ge_system_properties.h"
+
+namespace OHOS {
+namespace Rosen {
+namespace {
+struct FlagInfo {
+    GEFeatureFlag flag;
+    const char* property;
+    int32_t defaultValue;
+};
+
+constexpr FlagInfo FLAG_INFOS[] = {
+    { GEFeatureFlag::DEBUG_TRACE, "persist.sys.graphic.openDebugTrace", 0 },
+    { GEFeatureFlag::SDF_CACHE, "persist.sys.graphic.effect.enablesdfcache", -1 },
+    { GEFeatureFlag::EXTERNAL_EFFECT, "rosen.graphic.gex.enable", 1 },
+    { GEFeatureFlag::KAWASE_ORIGINAL_IMAGE, "persist.sys.graphic.kawaseOriginalEnable", 0 },
+    { GEFeatureFlag::BLUR_EXTRA_FILTER, "persist.sys.graphic.blurExtraFilter", 0 },
+    { GEFeatureFlag::SIMPLIFIED_MESA, "persist.sys.graphic.simplifiedMesaEnable", 0 },
+    { GEFeatureFlag::CONTOUR_DIAGONAL_MESA, "persist.graphic.contourdiagnalmesa.enabled", 1 },
+    { GEFeatureFlag::SUPPORTS_AF, "persist.sys.graphic.supports_af", 0 },
+    { GEFeatureFlag::OUTPUT_MEMO, "persist.sys.graphic.ge.outputMemo", 0 },
+    { GEFeatureFlag::SHADER_COMPOSITION, "persist.sys.graphic.ge.shaderComposition", 1 },
+};
+static_assert(sizeof(FLAG_INFOS) / sizeof(FLAG_INFOS[0]) == GEFeatureFlags::FLAG_COUNT, "Every flag needs an info");
+
+constexpr bool AreFlagInfosInOrder()
+{
+    for (size_t i = 0; i < GEFeatureFlags::FLAG_COUNT; ++i) {
+        if (static_cast<size_t>(FLAG_INFOS[i].flag) != i) {
+            return false;
+        }
+    }
+    return true;
+}
+static_assert(AreFlagInfosInOrder(), "FLAG_INFOS is indexed by flag");
+
+const FlagInfo& GetFlagInfo(GEFeatureFlag flag)
+{
+    return FLAG_INFOS[static_cast<size_t>(flag)];
+}
+
+#ifdef GE_OHOS
+// Accepts the spellings of system::GetBoolParameter as well as integers
+int32_t ParseFlagValue(const std::string& value, int32_t defaultValue)
+{
+    if (value.empty()) {
+        return defaultValue;
+    }
+    if (value == "true" || value == "on" || value == "yes" || value == "y") {
+        return 1;
+    }
+    if (value == "false" || value == "off" || value == "no" || value == "n") {
+        return 0;
+    }
+    return GESystemProperties::ConvertToInt(value.c_str(), defaultValue);
+}
+
+void OnFlagPropertyChanged(const char* key, const char* value, void* context)
+{
+    (void)key;
+    (void)value;
+    if (context != nullptr) {
+        static_cast<GEFeatureFlags*>(context)->Refresh();
+    }
+}
+#endif
+
+int32_t ReadFlagProperty(const FlagInfo& info)
+{
+#ifdef GE_OHOS
+    return ParseFlagValue(system::GetParameter(info.property, ""), info.defaultValue);
+#else
+    return info.defaultValue;
+#endif
+}
+} // namespace
+
+GEFeatureFlags& GEFeatureFlags::GetInstance()
+{
+    static GEFeatureFlags instance;
+    return instance;
+}
+
+GEFeatureFlags::GEFeatureFlags()
+{
+    std::array<int32_t, FLAG_COUNT> values {};
+    for (const auto& info : FLAG_INFOS) {
+        values[static_cast<size_t>(info.flag)] = ReadFlagProperty(info);
+    }
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        propertyValues_ = values;
+        auto snapshot = std::make_unique<Snapshot>();
+        snapshot->values = values;
+        current_.store(snapshot.get(), std::memory_order_release);
+        snapshots_.push_back(std::move(snapshot));
+    }
+#ifdef GE_OHOS
+    for (const auto& info : FLAG_INFOS) {
+        if (WatchParameter(info.property, OnFlagPropertyChanged, this) != 0) {
+            LOGW("GEFeatureFlags watch %{public}s failed, changes apply on the next Refresh", info.property);
+        }
+    }
+#endif
+}
+
+bool GEFeatureFlags::Refresh()
+{
+    std::array<int32_t, FLAG_COUNT> values {};
+    for (const auto& info : FLAG_INFOS) {
+        values[static_cast<size_t>(info.flag)] = ReadFlagProperty(info);
+    }
+    std::lock_guard<std::mutex> lock(mutex_);
+    return PublishLocked(values);
+}
+
+void GEFeatureFlags::SetOverride(GEFeatureFlag flag, int32_t value)
+{
+    if (flag >= GEFeatureFlag::COUNT) {
+        LOGE("GEFeatureFlags::SetOverride invalid flag %{public}u", static_cast<uint32_t>(flag));
+        return;
+    }
+    std::lock_guard<std::mutex> lock(mutex_);
+    overrideValues_[static_cast<size_t>(flag)] = value;
+    hasOverride_[static_cast<size_t>(flag)] = true;
+    PublishLocked(propertyValues_);
+}
+
+void GEFeatureFlags::ClearOverrides()
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    hasOverride_.fill(false);
+    PublishLocked(propertyValues_);
+}
+
+bool GEFeatureFlags::PublishLocked(const std::array<int32_t, FLAG_COUNT>& propertyValues)
+{
+    propertyValues_ = propertyValues;
+    std::array<int32_t, FLAG_COUNT> values = propertyValues;
+    for (size_t i = 0; i < FLAG_COUNT; ++i) {
+        if (hasOverride_[i]) {
+            values[i] = overrideValues_[i];
+        }
+    }
+    const Snapshot* current = current_.load(std::memory_order_relaxed);
+    if (current->values == values) {
+        return false;
+    }
+    auto snapshot = std::make_unique<Snapshot>();
+    snapshot->values = values;
+    snapshot->version = current->version + 1;
+    current_.store(snapshot.get(), std::memory_order_release);
+    snapshots_.push_back(std::move(snapshot));
+    return true;
+}
+
+const char* GEFeatureFlags::GetPropertyName(GEFeatureFlag flag)
+{
+    return flag < GEFeatureFlag::COUNT ? GetFlagInfo(flag).property : "";
+}
+
+int32_t GEFeatureFlags::GetDefaultValue(GEFeatureFlag flag)
+{
+    return flag < GEFeatureFlag::COUNT ? GetFlagInfo(flag).defaultValue : 0;
+}
+} // namespace Rosen
+} // namespace OHOS
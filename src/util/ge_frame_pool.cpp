@@ -0,0 +1,188 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "ge_frame_pool.h"
+
+#include <algorithm>
+
+#include "ge_system_properties.h"
+
+namespace OHOS {
+namespace Rosen {
+namespace {
+struct FreeBlock {
+    FreeBlock* next = nullptr;
+};
+
+// Cleared when the free lists of the thread are destroyed, blocks freed later by other thread exit code go to the heap
+thread_local bool g_freeListsAlive = false;
+
+// Free lists of one thread, the blocks go back to the heap when the thread exits
+struct ThreadFreeLists {
+    FreeBlock* heads[GEFramePool::SIZE_CLASS_COUNT] = {};
+    uint32_t counts[GEFramePool::SIZE_CLASS_COUNT] = {};
+
+    ThreadFreeLists()
+    {
+        g_freeListsAlive = true;
+    }
+
+    ~ThreadFreeLists()
+    {
+        g_freeListsAlive = false;
+        for (size_t sizeClass = 0; sizeClass < GEFramePool::SIZE_CLASS_COUNT; ++sizeClass) {
+            Trim(sizeClass, 0);
+        }
+    }
+
+    void Trim(size_t sizeClass, uint32_t keep)
+    {
+        while (counts[sizeClass] > keep) {
+            FreeBlock* block = heads[sizeClass];
+            heads[sizeClass] = block->next;
+            --counts[sizeClass];
+            ::operator delete(block);
+        }
+    }
+};
+
+ThreadFreeLists* GetThreadFreeLists()
+{
+    thread_local ThreadFreeLists freeLists;
+    return g_freeListsAlive ? &freeLists : nullptr;
+}
+
+size_t GetClassSize(size_t sizeClass)
+{
+    return GEFramePool::MIN_BLOCK_SIZE << sizeClass;
+}
+} // namespace
+
+GEFramePool& GEFramePool::GetInstance()
+{
+    static GEFramePool instance;
+    return instance;
+}
+
+GEFramePool::GEFramePool()
+{
+#ifdef GE_OHOS
+    enabled_.store(GESystemProperties::ConvertToInt(
+        GESystemProperties::GetEventProperty("persist.sys.graphic.ge.framePool").c_str(), 1) != 0);
+#endif
+}
+
+size_t GEFramePool::GetSizeClass(size_t size)
+{
+    size_t sizeClass = 0;
+    size_t classSize = MIN_BLOCK_SIZE;
+    while (classSize < size && sizeClass < SIZE_CLASS_COUNT) {
+        classSize <<= 1;
+        ++sizeClass;
+    }
+    return sizeClass;
+}
+
+void GEFramePool::AddInUse(int64_t bytes)
+{
+    int64_t inUse = bytesInUse_.fetch_add(bytes, std::memory_order_relaxed) + bytes;
+    int64_t peak = peakBytesInUse_.load(std::memory_order_relaxed);
+    while (inUse > peak && !peakBytesInUse_.compare_exchange_weak(peak, inUse, std::memory_order_relaxed)) {
+    }
+}
+
+void* GEFramePool::Allocate(size_t size)
+{
+    allocations_.fetch_add(1, std::memory_order_relaxed);
+    const size_t sizeClass = GetSizeClass(size);
+    if (sizeClass >= SIZE_CLASS_COUNT) {
+        heapAllocations_.fetch_add(1, std::memory_order_relaxed);
+        return ::operator new(size);
+    }
+    // Blocks always have the size of their class, so a block allocated while the pool is disabled can be pooled later
+    const size_t classSize = GetClassSize(sizeClass);
+    AddInUse(static_cast<int64_t>(classSize));
+    auto* freeLists = IsEnabled() ? GetThreadFreeLists() : nullptr;
+    if (freeLists != nullptr) {
+        FreeBlock* block = freeLists->heads[sizeClass];
+        if (block != nullptr) {
+            freeLists->heads[sizeClass] = block->next;
+            --freeLists->counts[sizeClass];
+            reuses_.fetch_add(1, std::memory_order_relaxed);
+            return block;
+        }
+    }
+    heapAllocations_.fetch_add(1, std::memory_order_relaxed);
+    return ::operator new(classSize);
+}
+
+void GEFramePool::Deallocate(void* ptr, size_t size)
+{
+    if (ptr == nullptr) {
+        return;
+    }
+    const size_t sizeClass = GetSizeClass(size);
+    if (sizeClass >= SIZE_CLASS_COUNT) {
+        ::operator delete(ptr);
+        return;
+    }
+    AddInUse(-static_cast<int64_t>(GetClassSize(sizeClass)));
+    auto* freeLists = IsEnabled() ? GetThreadFreeLists() : nullptr;
+    if (freeLists == nullptr || freeLists->counts[sizeClass] >= MAX_FREE_BLOCKS) {
+        ::operator delete(ptr);
+        return;
+    }
+    auto* block = new (ptr) FreeBlock { freeLists->heads[sizeClass] };
+    freeLists->heads[sizeClass] = block;
+    ++freeLists->counts[sizeClass];
+}
+
+void GEFramePool::EndFrame()
+{
+    auto* freeLists = GetThreadFreeLists();
+    for (size_t sizeClass = 0; freeLists != nullptr && sizeClass < SIZE_CLASS_COUNT; ++sizeClass) {
+        freeLists->Trim(sizeClass, RETAINED_FREE_BLOCKS);
+    }
+    frameStartAllocations_.store(allocations_.load(std::memory_order_relaxed), std::memory_order_relaxed);
+}
+
+void GEFramePool::SetEnabled(bool enabled)
+{
+    enabled_.store(enabled, std::memory_order_relaxed);
+}
+
+GEFramePool::Stats GEFramePool::GetStats() const
+{
+    Stats stats;
+    stats.allocations = allocations_.load(std::memory_order_relaxed);
+    stats.reuses = reuses_.load(std::memory_order_relaxed);
+    stats.heapAllocations = heapAllocations_.load(std::memory_order_relaxed);
+    stats.bytesInUse = static_cast<uint64_t>(std::max<int64_t>(bytesInUse_.load(std::memory_order_relaxed), 0));
+    stats.peakBytesInUse = static_cast<uint64_t>(peakBytesInUse_.load(std::memory_order_relaxed));
+    stats.frameAllocations = stats.allocations - frameStartAllocations_.load(std::memory_order_relaxed);
+    return stats;
+}
+
+uint32_t GEFramePool::GetFreeBlockCount() const
+{
+    const auto* freeLists = GetThreadFreeLists();
+    uint32_t count = 0;
+    for (size_t sizeClass = 0; freeLists != nullptr && sizeClass < SIZE_CLASS_COUNT; ++sizeClass) {
+        count += freeLists->counts[sizeClass];
+    }
+    return count;
+}
+} // namespace Rosen
+} // namespace OHOS
@@ -0,0 +1,86 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "ge_intermediate_format.h"
+
+#include "ge_system_properties.h"
+
+namespace OHOS {
+namespace Rosen {
+namespace {
+// Displays with at most this headroom cannot show colours above SDR white, 8 bits per channel are enough
+constexpr float SDR_HEADROOM = 1.0f;
+
+int LoadAutoSelect()
+{
+#ifdef GE_OHOS
+    return GESystemProperties::ConvertToInt(
+        GESystemProperties::GetEventProperty("persist.sys.graphic.ge.intermediateFormat").c_str(), 1);
+#else
+    return 1;
+#endif
+}
+
+bool IsLinearColorSpace(const std::shared_ptr<Drawing::ColorSpace>& colorSpace)
+{
+    // Linear values lose too much precision in the darks with 8 bits per channel
+    return colorSpace != nullptr && colorSpace->Equals(Drawing::ColorSpace::CreateSRGBLinear());
+}
+} // namespace
+
+std::atomic<int> GEIntermediateFormat::autoSelect_ { LoadAutoSelect() };
+
+void GEIntermediateFormat::SetAutoSelectEnabled(bool enabled)
+{
+    autoSelect_.store(enabled ? 1 : 0, std::memory_order_relaxed);
+}
+
+bool GEIntermediateFormat::IsAutoSelectEnabled()
+{
+    return autoSelect_.load(std::memory_order_relaxed) != 0;
+}
+
+Drawing::ColorType GEIntermediateFormat::SelectColorType(Usage usage, const Drawing::ImageInfo& input,
+    float supportHeadroom)
+{
+    switch (usage) {
+        case Usage::MASK:
+            return Drawing::ColorType::COLORTYPE_RGBA_8888;
+        case Usage::DISTANCE:
+            return Drawing::ColorType::COLORTYPE_RGBA_F16;
+        case Usage::COLOR:
+        default:
+            break;
+    }
+    const Drawing::ColorType inputType = input.GetColorType();
+    if (!IsAutoSelectEnabled() || inputType != Drawing::ColorType::COLORTYPE_RGBA_F16) {
+        return inputType;
+    }
+    // A headroom of 0 means the caller did not tell, keep the input format in case the content is HDR
+    if (supportHeadroom <= 0.0f || supportHeadroom > SDR_HEADROOM || IsLinearColorSpace(input.GetColorSpace())) {
+        return inputType;
+    }
+    return Drawing::ColorType::COLORTYPE_RGBA_8888;
+}
+
+Drawing::ImageInfo GEIntermediateFormat::MakeImageInfo(int width, int height, const Drawing::ImageInfo& input,
+    Usage usage, float supportHeadroom)
+{
+    return Drawing::ImageInfo(width, height, SelectColorType(usage, input, supportHeadroom), input.GetAlphaType(),
+        input.GetColorSpace());
+}
+
+} // namespace Rosen
+} // namespace OHOS
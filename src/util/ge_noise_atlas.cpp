@@ -0,0 +1,211 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "ge_noise_atlas.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+#include "image/bitmap.h"
+
+#include "ge_log.h"
+#include "ge_trace.h"
+
+namespace OHOS {
+namespace Rosen {
+namespace {
+constexpr uint32_t GRADIENT_SALT = 0x9E3779B9u;
+constexpr uint32_t SECOND_GRADIENT_SALT = 0x85EBCA6Bu;
+constexpr uint32_t VALUE_SALT = 0xC2B2AE35u;
+constexpr uint32_t HALF_BITS = 16;
+constexpr uint32_t HALF_MASK = 0xFFFFu;
+constexpr float HALF_MAX = 65535.0f;
+constexpr float WORD_MAX = 4294967295.0f;
+constexpr float BYTE_MAX = 255.0f;
+constexpr float HALF_PIXEL = 0.5f;
+constexpr float SIGNED_SCALE = 0.5f;
+
+// Integer hash of a lattice point, same input always gives the same output on every device
+uint32_t HashLattice(uint32_t x, uint32_t y, uint32_t salt)
+{
+    uint32_t h = x * 0x8DA6B343u ^ y * 0xD8163841u ^ salt; // large odd constants spread the coordinates
+    h ^= h >> 16; // 16: lowbias32 finalizer
+    h *= 0x7FEB352Du;
+    h ^= h >> 15; // 15: lowbias32 finalizer
+    h *= 0x846CA68Bu;
+    h ^= h >> 16; // 16: lowbias32 finalizer
+    return h;
+}
+
+float Smoothstep(float t)
+{
+    return t * t * (3.0f - 2.0f * t); // 3, 2: cubic Hermite
+}
+
+// Dot product of the lattice gradient of (ix, iy) with the offset (fx, fy), gradient components in [-1, 1]
+float GradientDot(uint32_t ix, uint32_t iy, uint32_t salt, float fx, float fy)
+{
+    uint32_t h = HashLattice(ix, iy, salt);
+    float gx = static_cast<float>(h & HALF_MASK) / HALF_MAX * 2.0f - 1.0f;
+    float gy = static_cast<float>(h >> HALF_BITS) / HALF_MAX * 2.0f - 1.0f;
+    return gx * fx + gy * fy;
+}
+
+// Gradient noise over a lattice of period cells, p in cells
+float GradientNoise(float px, float py, uint32_t period, uint32_t salt)
+{
+    float cx = std::floor(px);
+    float cy = std::floor(py);
+    float fx = px - cx;
+    float fy = py - cy;
+    uint32_t x0 = static_cast<uint32_t>(cx) % period;
+    uint32_t y0 = static_cast<uint32_t>(cy) % period;
+    uint32_t x1 = (x0 + 1) % period;
+    uint32_t y1 = (y0 + 1) % period;
+    float ux = Smoothstep(fx);
+    float uy = Smoothstep(fy);
+    float n00 = GradientDot(x0, y0, salt, fx, fy);
+    float n10 = GradientDot(x1, y0, salt, fx - 1.0f, fy);
+    float n01 = GradientDot(x0, y1, salt, fx, fy - 1.0f);
+    float n11 = GradientDot(x1, y1, salt, fx - 1.0f, fy - 1.0f);
+    float top = n00 + (n10 - n00) * ux;
+    float bottom = n01 + (n11 - n01) * ux;
+    return top + (bottom - top) * uy;
+}
+
+float ValueNoise(float p, uint32_t period)
+{
+    float c = std::floor(p);
+    uint32_t x0 = static_cast<uint32_t>(c) % period;
+    uint32_t x1 = (x0 + 1) % period;
+    float v0 = static_cast<float>(HashLattice(x0, 0, VALUE_SALT)) / WORD_MAX;
+    float v1 = static_cast<float>(HashLattice(x1, 0, VALUE_SALT)) / WORD_MAX;
+    return v0 + (v1 - v0) * Smoothstep(p - c);
+}
+
+uint8_t ToByte(float v)
+{
+    return static_cast<uint8_t>(std::clamp(v, 0.0f, 1.0f) * BYTE_MAX + HALF_PIXEL);
+}
+
+// [-1, 1] to a byte
+uint8_t SignedToByte(float v)
+{
+    return ToByte(v * SIGNED_SCALE + SIGNED_SCALE);
+}
+} // namespace
+
+GENoiseAtlas& GENoiseAtlas::GetInstance()
+{
+    static GENoiseAtlas instance;
+    return instance;
+}
+
+bool GENoiseAtlas::Bake(uint32_t size, std::vector<uint8_t>& rgba)
+{
+    if (!IsValidSize(size)) {
+        LOGE("GENoiseAtlas::Bake invalid size %{public}u", size);
+        return false;
+    }
+    GE_TRACE_NAME_FMT("GENoiseAtlas::Bake %u", size);
+    const uint32_t period = size / TEXELS_PER_CELL;
+    const float cellsPerTexel = 1.0f / static_cast<float>(TEXELS_PER_CELL);
+    rgba.resize(static_cast<size_t>(size) * size * CHANNELS);
+
+    // The 1D noise only depends on x, one row is computed and shared by all rows
+    std::vector<uint8_t> valueRow(size);
+    for (uint32_t x = 0; x < size; ++x) {
+        valueRow[x] = ToByte(ValueNoise((x + HALF_PIXEL) * cellsPerTexel, period));
+    }
+    for (uint32_t y = 0; y < size; ++y) {
+        const float py = (y + HALF_PIXEL) * cellsPerTexel;
+        uint8_t* row = rgba.data() + static_cast<size_t>(y) * size * CHANNELS;
+        for (uint32_t x = 0; x < size; ++x) {
+            const float px = (x + HALF_PIXEL) * cellsPerTexel;
+            uint8_t* texel = row + static_cast<size_t>(x) * CHANNELS;
+            texel[0] = SignedToByte(GradientNoise(px, py, period, GRADIENT_SALT));
+            texel[1] = valueRow[x];
+            texel[2] = SignedToByte(GradientNoise(px, py, period, SECOND_GRADIENT_SALT)); // 2: b
+            texel[3] = static_cast<uint8_t>(BYTE_MAX); // 3: a, opaque
+        }
+    }
+    return true;
+}
+
+std::shared_ptr<Drawing::Image> GENoiseAtlas::GetImage(uint32_t size)
+{
+    if (!IsValidSize(size)) {
+        LOGE("GENoiseAtlas::GetImage invalid size %{public}u", size);
+        return nullptr;
+    }
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = images_.find(size);
+    if (it != images_.end()) {
+        return it->second;
+    }
+
+    std::vector<uint8_t> rgba;
+    if (!Bake(size, rgba)) {
+        return nullptr;
+    }
+    Drawing::Bitmap bitmap;
+    Drawing::BitmapFormat format { Drawing::COLORTYPE_RGBA_8888, Drawing::ALPHATYPE_OPAQUE };
+    if (!bitmap.Build(size, size, format)) {
+        LOGE("GENoiseAtlas::GetImage build bitmap failed");
+        return nullptr;
+    }
+    auto* pixels = static_cast<uint8_t*>(bitmap.GetPixels());
+    if (pixels == nullptr) {
+        return nullptr;
+    }
+    const size_t rowBytes = bitmap.GetRowBytes();
+    const size_t srcRowBytes = static_cast<size_t>(size) * CHANNELS;
+    for (uint32_t y = 0; y < size; ++y) {
+        std::memcpy(pixels + y * rowBytes, rgba.data() + y * srcRowBytes, srcRowBytes);
+    }
+    auto image = bitmap.MakeImage();
+    if (image == nullptr) {
+        LOGE("GENoiseAtlas::GetImage make image failed");
+        return nullptr;
+    }
+    images_.emplace(size, image);
+    return image;
+}
+
+std::shared_ptr<Drawing::ShaderEffect> GENoiseAtlas::GetShader(uint32_t size)
+{
+    auto image = GetImage(size);
+    if (image == nullptr) {
+        return nullptr;
+    }
+    Drawing::Matrix matrix;
+    return Drawing::ShaderEffect::CreateImageShader(*image, Drawing::TileMode::REPEAT, Drawing::TileMode::REPEAT,
+        Drawing::SamplingOptions(Drawing::FilterMode::LINEAR), matrix);
+}
+
+size_t GENoiseAtlas::GetCachedCount() const
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    return images_.size();
+}
+
+void GENoiseAtlas::Clear()
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    images_.clear();
+}
+} // namespace Rosen
+} // namespace OHOS
@@ -0,0 +1,154 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "ge_quality_governor.h"
+
+#include <algorithm>
+
+#include "ge_log.h"
+#include "ge_system_properties.h"
+
+namespace OHOS {
+namespace Rosen {
+namespace {
+constexpr uint8_t MAX_LEVEL = static_cast<uint8_t>(GEQualityGovernor::QualityLevel::LOW);
+
+uint64_t NowNs()
+{
+    return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count());
+}
+} // namespace
+
+GEQualityGovernor& GEQualityGovernor::GetInstance()
+{
+    static GEQualityGovernor instance;
+    return instance;
+}
+
+GEQualityGovernor::GEQualityGovernor()
+{
+#ifdef GE_OHOS
+    enabled_.store(GESystemProperties::ConvertToInt(
+        GESystemProperties::GetEventProperty("persist.sys.graphic.ge.qualityGovernor").c_str(), 0) != 0);
+#endif
+}
+
+void GEQualityGovernor::SetEnabled(bool enabled)
+{
+    enabled_.store(enabled, std::memory_order_relaxed);
+}
+
+void GEQualityGovernor::SetConfig(const Config& config)
+{
+    if (config.framePeriodNs == 0 || config.effectBudgetNs == 0 || config.smoothing <= 0.0f ||
+        config.smoothing > 1.0f) {
+        LOGE("GEQualityGovernor::SetConfig invalid config");
+        return;
+    }
+    std::lock_guard<std::mutex> lock(mutex_);
+    config_ = config;
+}
+
+GEQualityGovernor::Config GEQualityGovernor::GetConfig() const
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    return config_;
+}
+
+void GEQualityGovernor::ReportCost(uint64_t costNs)
+{
+    ReportCost(costNs, NowNs());
+}
+
+void GEQualityGovernor::ReportCost(uint64_t costNs, uint64_t nowNs)
+{
+    if (!IsEnabled()) {
+        return;
+    }
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (windowStartNs_ == 0 || nowNs < windowStartNs_) {
+        windowStartNs_ = nowNs;
+    }
+    CloseWindowLocked(nowNs);
+    windowCostNs_ += costNs;
+}
+
+void GEQualityGovernor::CloseWindowLocked(uint64_t nowNs)
+{
+    const uint64_t period = config_.framePeriodNs;
+    if (nowNs - windowStartNs_ < period) {
+        return;
+    }
+    // The closed window is followed by idle frames without any effect, they count as frames with headroom
+    const uint64_t elapsedFrames = (nowNs - windowStartNs_) / period;
+    const uint64_t frames = std::min<uint64_t>(elapsedFrames, config_.recoverFrames + 1);
+    uint64_t frameCost = windowCostNs_;
+    for (uint64_t i = 0; i < frames; ++i) {
+        smoothedCostNs_ = config_.smoothing * frameCost + (1.0f - config_.smoothing) * smoothedCostNs_;
+        frameCost = 0;
+        uint8_t level = level_.load(std::memory_order_relaxed);
+        if (smoothedCostNs_ > config_.effectBudgetNs) {
+            headroomFrames_ = 0;
+            if (++overBudgetFrames_ >= config_.degradeFrames && level < MAX_LEVEL) {
+                level_.store(++level, std::memory_order_relaxed);
+                overBudgetFrames_ = 0;
+                LOGD("GEQualityGovernor degrade to level %{public}u", level);
+            }
+        } else if (smoothedCostNs_ < config_.effectBudgetNs * config_.recoverRatio) {
+            overBudgetFrames_ = 0;
+            if (++headroomFrames_ >= config_.recoverFrames && level > 0) {
+                level_.store(--level, std::memory_order_relaxed);
+                headroomFrames_ = 0;
+                LOGD("GEQualityGovernor recover to level %{public}u", level);
+            }
+        } else {
+            overBudgetFrames_ = 0;
+            headroomFrames_ = 0;
+        }
+    }
+    windowCostNs_ = 0;
+    windowStartNs_ += elapsedFrames * period;
+}
+
+uint64_t GEQualityGovernor::GetSmoothedFrameCostNs() const
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    return static_cast<uint64_t>(smoothedCostNs_);
+}
+
+void GEQualityGovernor::Reset()
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    level_.store(static_cast<uint8_t>(QualityLevel::HIGH), std::memory_order_relaxed);
+    windowStartNs_ = 0;
+    windowCostNs_ = 0;
+    smoothedCostNs_ = 0.0f;
+    overBudgetFrames_ = 0;
+    headroomFrames_ = 0;
+}
+
+GEQualityGovernor::CostScope::~CostScope()
+{
+    auto& governor = GEQualityGovernor::GetInstance();
+    if (!governor.IsEnabled()) {
+        return;
+    }
+    const auto cost = std::chrono::steady_clock::now() - start_;
+    governor.ReportCost(static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(cost).count()));
+}
+
+} // namespace Rosen
+} // namespace OHOS
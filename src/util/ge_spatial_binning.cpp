@@ -0,0 +1,177 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "ge_spatial_binning.h"
+
+#include <algorithm>
+#include <future>
+
+#include "ge_trace.h"
+
+namespace OHOS {
+namespace Rosen {
+namespace {
+constexpr uint32_t XMIN_I = 0;
+constexpr uint32_t XMAX_I = 1;
+constexpr uint32_t YMIN_I = 2;
+constexpr uint32_t YMAX_I = 3;
+constexpr uint32_t MAX_CHILDREN = 4;
+constexpr float MIDPOINT_FACTOR = 0.5f;
+} // namespace
+
+bool GESpatialBinning::Intersect(const Box& a, const Box& b)
+{
+    return !(a[XMAX_I] < b[XMIN_I] || a[XMIN_I] > b[XMAX_I] || a[YMAX_I] < b[YMIN_I] || a[YMIN_I] > b[YMAX_I]);
+}
+
+void GESpatialBinning::Build(const Box& root, const std::vector<Box>& itemBoxes, const Config& config)
+{
+    GE_TRACE_NAME_FMT("GESpatialBinning::Build %zu items", itemBoxes.size());
+    config_ = config;
+    cells_.clear();
+    items_.clear();
+    emptyCells_.clear();
+    nodes_.clear();
+    pool_.clear();
+
+    const size_t itemCount = itemBoxes.size();
+    minX_.resize(itemCount);
+    maxX_.resize(itemCount);
+    minY_.resize(itemCount);
+    maxY_.resize(itemCount);
+    for (size_t i = 0; i < itemCount; ++i) {
+        minX_[i] = itemBoxes[i][XMIN_I];
+        maxX_[i] = itemBoxes[i][XMAX_I];
+        minY_[i] = itemBoxes[i][YMIN_I];
+        maxY_[i] = itemBoxes[i][YMAX_I];
+    }
+
+    pool_.resize(itemCount);
+    for (size_t i = 0; i < itemCount; ++i) {
+        pool_[i] = static_cast<uint32_t>(i);
+    }
+    uint32_t rootCount = BinItems(root, pool_.data(), static_cast<uint32_t>(itemCount), pool_.data());
+    pool_.resize(rootCount);
+    nodes_.push_back({ root, 0, rootCount });
+
+    // nodes_ is the breadth first work queue, it only grows during the build
+    for (size_t head = 0; head < nodes_.size(); ++head) {
+        const Node node = nodes_[head];
+        if (NeedsSplit(node)) {
+            SplitNode(node);
+            continue;
+        }
+        cells_.push_back({ node.bbox, static_cast<uint32_t>(items_.size()), node.count });
+        items_.insert(items_.end(), pool_.begin() + node.first, pool_.begin() + node.first + node.count);
+    }
+}
+
+bool GESpatialBinning::NeedsSplit(const Node& node) const
+{
+    if (node.count <= config_.maxItemsPerCell) {
+        return false;
+    }
+    const float width = node.bbox[XMAX_I] - node.bbox[XMIN_I];
+    const float height = node.bbox[YMAX_I] - node.bbox[YMIN_I];
+    if (config_.mode == SplitMode::QUAD) {
+        return width > config_.minCellSize && height > config_.minCellSize;
+    }
+    return width > config_.minCellSize || height > config_.minCellSize;
+}
+
+uint32_t GESpatialBinning::SplitBox(const Box& box, Box* children) const
+{
+    const float midX = (box[XMIN_I] + box[XMAX_I]) * MIDPOINT_FACTOR;
+    const float midY = (box[YMIN_I] + box[YMAX_I]) * MIDPOINT_FACTOR;
+    if (config_.mode == SplitMode::QUAD_OR_HALF) {
+        if (box[XMAX_I] - box[XMIN_I] <= config_.minCellSize) {
+            children[0] = { box[XMIN_I], box[XMAX_I], box[YMIN_I], midY }; // Top
+            children[1] = { box[XMIN_I], box[XMAX_I], midY, box[YMAX_I] }; // Bottom
+            return 2; // 2: halves
+        }
+        if (box[YMAX_I] - box[YMIN_I] <= config_.minCellSize) {
+            children[0] = { box[XMIN_I], midX, box[YMIN_I], box[YMAX_I] }; // Left
+            children[1] = { midX, box[XMAX_I], box[YMIN_I], box[YMAX_I] }; // Right
+            return 2; // 2: halves
+        }
+    }
+    children[0] = { box[XMIN_I], midX, box[YMIN_I], midY }; // Top-Left
+    children[1] = { midX, box[XMAX_I], box[YMIN_I], midY }; // Top-Right
+    children[2] = { box[XMIN_I], midX, midY, box[YMAX_I] }; // 2: Bottom-Left
+    children[3] = { midX, box[XMAX_I], midY, box[YMAX_I] }; // 3: Bottom-Right
+    return MAX_CHILDREN;
+}
+
+void GESpatialBinning::SplitNode(const Node& node)
+{
+    Box children[MAX_CHILDREN];
+    const uint32_t childCount = SplitBox(node.bbox, children);
+
+    // Every child gets a slot as large as the parent, the slots are compacted once all children are binned
+    const size_t base = pool_.size();
+    pool_.resize(base + static_cast<size_t>(childCount) * node.count);
+    const uint32_t* src = pool_.data() + node.first;
+    uint32_t childItems[MAX_CHILDREN] = {};
+    auto binChild = [this, &children, &childItems, src, base, &node](uint32_t child) {
+        childItems[child] = BinItems(children[child], src, node.count,
+            pool_.data() + base + static_cast<size_t>(child) * node.count);
+    };
+    if (node.count >= PARALLEL_MIN_ITEMS) {
+        std::future<void> workers[MAX_CHILDREN];
+        for (uint32_t child = 1; child < childCount; ++child) {
+            workers[child] = std::async(std::launch::async, binChild, child);
+        }
+        binChild(0);
+        for (uint32_t child = 1; child < childCount; ++child) {
+            workers[child].wait();
+        }
+    } else {
+        for (uint32_t child = 0; child < childCount; ++child) {
+            binChild(child);
+        }
+    }
+
+    size_t write = base;
+    for (uint32_t child = 0; child < childCount; ++child) {
+        if (childItems[child] == 0) {
+            emptyCells_.push_back(children[child]);
+            continue;
+        }
+        const size_t slot = base + static_cast<size_t>(child) * node.count;
+        if (slot != write) {
+            std::copy(pool_.begin() + slot, pool_.begin() + slot + childItems[child], pool_.begin() + write);
+        }
+        nodes_.push_back({ children[child], static_cast<uint32_t>(write), childItems[child] });
+        write += childItems[child];
+    }
+    pool_.resize(write);
+}
+
+uint32_t GESpatialBinning::BinItems(const Box& box, const uint32_t* src, uint32_t count, uint32_t* dst) const
+{
+    // Branchless: every index is written, the output position only advances on a hit
+    uint32_t hits = 0;
+    for (uint32_t i = 0; i < count; ++i) {
+        const uint32_t idx = src[i];
+        const bool hit = !(box[XMAX_I] < minX_[idx]) & !(box[XMIN_I] > maxX_[idx]) &
+            !(box[YMAX_I] < minY_[idx]) & !(box[YMIN_I] > maxY_[idx]);
+        dst[hits] = idx;
+        hits += static_cast<uint32_t>(hit);
+    }
+    return hits;
+}
+
+} // namespace Rosen
+} // namespace OHOS
@@ -15,6 +15,9 @@
 
 #include "ge_system_properties.h"
 
+#include <mutex>
+#include <unordered_map>
+
 namespace OHOS {
 namespace Rosen {
 
@@ -30,9 +33,23 @@ std::string GESystemProperties::GetEventProperty(const std::string& paraName)
 bool GESystemProperties::GetBoolSystemProperty(const char* name, bool defaultValue)
 {
 #ifdef GE_OHOS
-    static CachedHandle g_Handle = CachedParameterCreate(name, defaultValue ? "1" : "0");
+    if (name == nullptr) {
+        return defaultValue;
+    }
+    // One cached handle per property name, hot path flags belong in GEFeatureFlags
+    static std::mutex handlesMutex;
+    static std::unordered_map<std::string, CachedHandle> handles;
+    CachedHandle handle = nullptr;
+    {
+        std::lock_guard<std::mutex> lock(handlesMutex);
+        auto it = handles.find(name);
+        if (it == handles.end()) {
+            it = handles.emplace(name, CachedParameterCreate(name, defaultValue ? "1" : "0")).first;
+        }
+        handle = it->second;
+    }
     int changed = 0;
-    const char* enable = CachedParameterGetChanged(g_Handle, &changed);
+    const char* enable = CachedParameterGetChanged(handle, &changed);
     return ConvertToInt(enable, defaultValue ? 1 : 0) != 0;
 #else
     return false;
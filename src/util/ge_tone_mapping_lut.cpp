@@ -0,0 +1,369 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "ge_tone_mapping_lut.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <vector>
+
+#include "draw/canvas.h"
+#include "effect/runtime_effect.h"
+#include "effect/runtime_shader_builder.h"
+#include "image/bitmap.h"
+
+#include "ge_log.h"
+#include "ge_shader_diagnostics.h"
+#include "ge_tone_mapping_helper.h"
+#include "ge_trace.h"
+
+namespace OHOS {
+namespace Rosen {
+namespace {
+constexpr float SDR_LUMINANCE = 1.0f;
+constexpr float LUMINANCE_RANGE = EFFECT_MAX_LUMINANCE - SDR_LUMINANCE;
+constexpr float LAST_INDEX = static_cast<float>(GEToneMappingLut::SIZE - 1);
+constexpr float MIN_ALPHA = 1e-4f;
+constexpr float FIXED_MAX = 65535.0f;
+constexpr float HALF_ROUND = 0.5f;
+constexpr uint32_t BYTE_BITS = 8;
+constexpr uint32_t BYTE_MASK = 0xFFu;
+constexpr uint8_t BYTE_MAX = 0xFF;
+
+constexpr uint32_t FLOAT_EXPONENT_BIAS = 127;
+constexpr uint32_t HALF_EXPONENT_BIAS = 15;
+constexpr uint32_t FLOAT_MANTISSA_BITS = 23;
+constexpr uint32_t HALF_MANTISSA_BITS = 10;
+constexpr uint32_t MANTISSA_SHIFT = FLOAT_MANTISSA_BITS - HALF_MANTISSA_BITS;
+constexpr uint32_t HALF_MAX_EXPONENT = 31;
+constexpr uint16_t HALF_MAX_FINITE = 0x7BFF;
+constexpr uint32_t HALF_SIGN_SHIFT = 16;
+
+// Same source as the per-pixel path of ApplyRgba, keep them in sync
+constexpr char TONE_MAPPING_PROG[] = R"(
+    uniform shader content;
+    uniform shader curve;
+    uniform float headroom;
+
+    const float LAST_INDEX = 255.0;
+    const float MAX_LUMINANCE = 2.0;
+    const float MIN_ALPHA = 1e-4;
+
+    float CurveAt(float index)
+    {
+        float4 texel = curve.eval(float2(index + 0.5, 0.5));
+        return (texel.r * 65280.0 + texel.g * 255.0) / 65535.0;
+    }
+
+    half4 main(float2 coord)
+    {
+        float4 color = content.eval(coord);
+        float high = max(max(max(color.r, color.g), color.b) / max(color.a, MIN_ALPHA), 1.0);
+        float ratio = headroom / high;
+        if (high < MAX_LUMINANCE) {
+            float pos = (high - 1.0) * LAST_INDEX;
+            float index = floor(pos);
+            float value = mix(CurveAt(index), CurveAt(min(index + 1.0, LAST_INDEX)), pos - index);
+            float mapped = (MAX_LUMINANCE - headroom) * value + (headroom - 1.0) * high;
+            ratio = clamp(mapped, 0.0, headroom) / high;
+        }
+        return half4(color.rgb * ratio, color.a);
+    }
+)";
+
+thread_local static std::shared_ptr<Drawing::RuntimeEffect> g_toneMappingEffect = nullptr;
+
+float HalfToFloat(uint16_t half)
+{
+    const uint32_t sign = static_cast<uint32_t>(half >> 15) << 31; // 15, 31: sign bits of half and float
+    const uint32_t exponent = (half >> HALF_MANTISSA_BITS) & HALF_MAX_EXPONENT;
+    const uint32_t mantissa = half & ((1u << HALF_MANTISSA_BITS) - 1);
+    uint32_t bits = 0;
+    if (exponent == 0) {
+        // Subnormal halves are below what colours need, they read as zero
+        bits = sign;
+    } else if (exponent == HALF_MAX_EXPONENT) {
+        bits = sign | (0xFFu << FLOAT_MANTISSA_BITS) | (mantissa << MANTISSA_SHIFT); // 0xFF: inf / nan exponent
+    } else {
+        bits = sign | ((exponent - HALF_EXPONENT_BIAS + FLOAT_EXPONENT_BIAS) << FLOAT_MANTISSA_BITS) |
+            (mantissa << MANTISSA_SHIFT);
+    }
+    float value = 0.0f;
+    std::memcpy(&value, &bits, sizeof(value));
+    return value;
+}
+
+uint16_t FloatToHalf(float value)
+{
+    uint32_t bits = 0;
+    std::memcpy(&bits, &value, sizeof(bits));
+    const uint16_t sign = static_cast<uint16_t>((bits >> HALF_SIGN_SHIFT) & 0x8000u); // 0x8000: sign bit of half
+    const int32_t exponent = static_cast<int32_t>((bits >> FLOAT_MANTISSA_BITS) & 0xFFu) -
+        static_cast<int32_t>(FLOAT_EXPONENT_BIAS) + static_cast<int32_t>(HALF_EXPONENT_BIAS);
+    if (exponent <= 0) {
+        return sign;
+    }
+    if (exponent >= static_cast<int32_t>(HALF_MAX_EXPONENT)) {
+        return sign | HALF_MAX_FINITE;
+    }
+    // Round to nearest, a carry out of the mantissa correctly bumps the exponent
+    const uint32_t half = (static_cast<uint32_t>(exponent) << HALF_MANTISSA_BITS) |
+        ((bits & ((1u << FLOAT_MANTISSA_BITS) - 1)) >> MANTISSA_SHIFT);
+    const uint32_t roundBit = (bits >> (MANTISSA_SHIFT - 1)) & 1u;
+    return sign | static_cast<uint16_t>(std::min<uint32_t>(half + roundBit, HALF_MAX_FINITE));
+}
+
+float Interpolate(const GEToneMappingLut::Curve& curve, float high)
+{
+    const float pos = std::min((high - SDR_LUMINANCE) * (LAST_INDEX / LUMINANCE_RANGE), LAST_INDEX);
+    const uint32_t index = static_cast<uint32_t>(pos);
+    const float next = curve[std::min(index + 1, GEToneMappingLut::SIZE - 1)];
+    return curve[index] + (next - curve[index]) * (pos - static_cast<float>(index));
+}
+
+void ApplyPixel(const GEToneMappingLut::Curve& curve, float headroom, float* pixel)
+{
+    const float high = std::max({ pixel[0], pixel[1], pixel[2] }) / std::max(pixel[3], MIN_ALPHA); // 2, 3: b, a
+    const float ratio = GEToneMappingLut::GetCompressRatio(curve, headroom, high);
+    pixel[0] *= ratio;
+    pixel[1] *= ratio;
+    pixel[2] *= ratio; // 2: b
+}
+
+#if defined(__GNUC__) || defined(__clang__)
+// 4 lanes map to NEON on the devices and SSE on the hosts
+using Float4 = float __attribute__((vector_size(16)));
+using Int4 = int32_t __attribute__((vector_size(16)));
+constexpr size_t LANES = 4;
+
+inline Float4 Splat(float v)
+{
+    return Float4 { v, v, v, v };
+}
+
+inline Float4 Select(Int4 mask, Float4 a, Float4 b)
+{
+    return reinterpret_cast<Float4>((reinterpret_cast<Int4>(a) & mask) | (reinterpret_cast<Int4>(b) & ~mask));
+}
+
+inline Float4 Max(Float4 a, Float4 b)
+{
+    return Select(a > b, a, b);
+}
+
+inline Float4 Min(Float4 a, Float4 b)
+{
+    return Select(a < b, a, b);
+}
+
+// Tone maps 4 premultiplied pixels, the lanes hold one channel of each pixel
+void ApplyLanes(const GEToneMappingLut::Curve& curve, float headroom, float* pixels)
+{
+    Float4 r = Splat(0.0f);
+    Float4 g = Splat(0.0f);
+    Float4 b = Splat(0.0f);
+    Float4 a = Splat(0.0f);
+    for (size_t lane = 0; lane < LANES; ++lane) {
+        const float* pixel = pixels + lane * GEToneMappingLut::CHANNELS;
+        r[lane] = pixel[0];
+        g[lane] = pixel[1];
+        b[lane] = pixel[2]; // 2: b
+        a[lane] = pixel[3]; // 3: a
+    }
+    const Float4 high = Max(Max(Max(r, g), b) / Max(a, Splat(MIN_ALPHA)), Splat(SDR_LUMINANCE));
+    const Float4 pos = Min((high - Splat(SDR_LUMINANCE)) * Splat(LAST_INDEX / LUMINANCE_RANGE), Splat(LAST_INDEX));
+    const Int4 index = __builtin_convertvector(pos, Int4);
+    // The LUT reads are the only scalar part, there is no gather on the targets
+    Float4 value = Splat(0.0f);
+    Float4 next = Splat(0.0f);
+    for (size_t lane = 0; lane < LANES; ++lane) {
+        const uint32_t i = static_cast<uint32_t>(index[lane]);
+        value[lane] = curve[i];
+        next[lane] = curve[std::min(i + 1, GEToneMappingLut::SIZE - 1)];
+    }
+    value += (next - value) * (pos - __builtin_convertvector(index, Float4));
+    const Float4 mapped = (Splat(EFFECT_MAX_LUMINANCE) - Splat(headroom)) * value +
+        (Splat(headroom) - Splat(SDR_LUMINANCE)) * high;
+    const Float4 inCurve = Min(Max(mapped, Splat(0.0f)), Splat(headroom)) / high;
+    const Float4 ratio = Select(high < Splat(EFFECT_MAX_LUMINANCE), inCurve, Splat(headroom) / high);
+    r *= ratio;
+    g *= ratio;
+    b *= ratio;
+    for (size_t lane = 0; lane < LANES; ++lane) {
+        float* pixel = pixels + lane * GEToneMappingLut::CHANNELS;
+        pixel[0] = r[lane];
+        pixel[1] = g[lane];
+        pixel[2] = b[lane]; // 2: b
+    }
+}
+#else
+constexpr size_t LANES = 1;
+
+void ApplyLanes(const GEToneMappingLut::Curve& curve, float headroom, float* pixels)
+{
+    ApplyPixel(curve, headroom, pixels);
+}
+#endif
+} // namespace
+
+GEToneMappingLut& GEToneMappingLut::GetInstance()
+{
+    static GEToneMappingLut instance;
+    return instance;
+}
+
+void GEToneMappingLut::Bake(Curve& curve)
+{
+    GE_TRACE_NAME_FMT("GEToneMappingLut::Bake %u", SIZE);
+    for (uint32_t i = 0; i < SIZE; ++i) {
+        // At headroom SDR_LUMINANCE the mapping is the curve itself
+        const float high = SDR_LUMINANCE + static_cast<float>(i) * (LUMINANCE_RANGE / LAST_INDEX);
+        curve[i] = GEToneMappingHelper::GetBrightnessMapping(SDR_LUMINANCE, high);
+    }
+}
+
+const GEToneMappingLut::Curve& GEToneMappingLut::GetCurve()
+{
+    std::call_once(curveOnce_, [this]() { Bake(curve_); });
+    return curve_;
+}
+
+std::shared_ptr<Drawing::Image> GEToneMappingLut::GetImage()
+{
+    const auto& curve = GetCurve();
+    std::lock_guard<std::mutex> lock(imageMutex_);
+    if (image_ != nullptr) {
+        return image_;
+    }
+    Drawing::Bitmap bitmap;
+    Drawing::BitmapFormat format { Drawing::COLORTYPE_RGBA_8888, Drawing::ALPHATYPE_OPAQUE };
+    if (!bitmap.Build(SIZE, 1, format)) {
+        LOGE("GEToneMappingLut::GetImage build bitmap failed");
+        return nullptr;
+    }
+    auto* pixels = static_cast<uint8_t*>(bitmap.GetPixels());
+    if (pixels == nullptr) {
+        return nullptr;
+    }
+    for (uint32_t i = 0; i < SIZE; ++i) {
+        const uint32_t fixed = static_cast<uint32_t>(std::clamp(curve[i], 0.0f, 1.0f) * FIXED_MAX + HALF_ROUND);
+        uint8_t* texel = pixels + i * CHANNELS;
+        texel[0] = static_cast<uint8_t>(fixed >> BYTE_BITS);
+        texel[1] = static_cast<uint8_t>(fixed & BYTE_MASK);
+        texel[2] = 0; // 2: b, unused
+        texel[3] = BYTE_MAX; // 3: a, opaque
+    }
+    image_ = bitmap.MakeImage();
+    if (image_ == nullptr) {
+        LOGE("GEToneMappingLut::GetImage make image failed");
+    }
+    return image_;
+}
+
+std::shared_ptr<Drawing::ShaderEffect> GEToneMappingLut::MakeToneMappedShader(
+    const std::shared_ptr<Drawing::ShaderEffect>& content, float headroom)
+{
+    if (content == nullptr || !GEToneMappingHelper::NeedToneMapping(headroom)) {
+        return nullptr;
+    }
+    if (g_toneMappingEffect == nullptr) {
+        g_toneMappingEffect = GECreateRuntimeEffectForShader(TONE_MAPPING_PROG);
+        if (g_toneMappingEffect == nullptr) {
+            LOGE("GEToneMappingLut::MakeToneMappedShader create runtime effect failed");
+            return nullptr;
+        }
+    }
+    auto image = GetImage();
+    if (image == nullptr) {
+        return nullptr;
+    }
+    Drawing::Matrix matrix;
+    auto curveShader = Drawing::ShaderEffect::CreateImageShader(*image, Drawing::TileMode::CLAMP,
+        Drawing::TileMode::CLAMP, Drawing::SamplingOptions(Drawing::FilterMode::NEAREST), matrix);
+    Drawing::RuntimeShaderBuilder builder(g_toneMappingEffect);
+    builder.SetChild("content", content);
+    builder.SetChild("curve", curveShader);
+    builder.SetUniform("headroom", headroom);
+    return builder.MakeShader(nullptr, false);
+}
+
+std::shared_ptr<Drawing::Image> GEToneMappingLut::ToneMapImage(const Drawing::Image& image, float headroom)
+{
+    if (!GEToneMappingHelper::NeedToneMapping(headroom)) {
+        return nullptr;
+    }
+    const int32_t width = image.GetWidth();
+    const int32_t height = image.GetHeight();
+    GE_TRACE_NAME_FMT("GEToneMappingLut::ToneMapImage %d x %d", width, height);
+    // Tagged with the color space of the source, so HDR content keeps it through the offscreen and the output
+    Drawing::Bitmap bitmap;
+    Drawing::ImageInfo info(width, height, Drawing::COLORTYPE_RGBA_F16, Drawing::ALPHATYPE_PREMUL,
+        image.GetImageInfo().GetColorSpace());
+    if (width <= 0 || height <= 0 || !bitmap.Build(info)) {
+        LOGE("GEToneMappingLut::ToneMapImage build bitmap failed");
+        return nullptr;
+    }
+    bitmap.ClearWithColor(Drawing::Color::COLOR_TRANSPARENT);
+    Drawing::Canvas canvas;
+    canvas.Bind(bitmap);
+    canvas.DrawImage(image, 0.0f, 0.0f, Drawing::SamplingOptions());
+    auto* pixels = static_cast<uint8_t*>(bitmap.GetPixels());
+    if (pixels == nullptr) {
+        return nullptr;
+    }
+    const auto& curve = GetCurve();
+    const size_t rowBytes = bitmap.GetRowBytes();
+    const size_t rowValues = static_cast<size_t>(width) * CHANNELS;
+    std::vector<float> row(rowValues);
+    for (int32_t y = 0; y < height; ++y) {
+        auto* halves = reinterpret_cast<uint16_t*>(pixels + y * rowBytes);
+        for (size_t i = 0; i < rowValues; ++i) {
+            row[i] = HalfToFloat(halves[i]);
+        }
+        ApplyRgba(curve, headroom, row.data(), static_cast<size_t>(width));
+        for (size_t i = 0; i < rowValues; ++i) {
+            halves[i] = FloatToHalf(row[i]);
+        }
+    }
+    return bitmap.MakeImage();
+}
+
+float GEToneMappingLut::GetCompressRatio(const Curve& curve, float headroom, float high)
+{
+    high = std::max(high, SDR_LUMINANCE);
+    if (high >= EFFECT_MAX_LUMINANCE) {
+        return headroom / high;
+    }
+    const float mapped = (EFFECT_MAX_LUMINANCE - headroom) * Interpolate(curve, high) +
+        (headroom - SDR_LUMINANCE) * high;
+    return std::clamp(mapped, 0.0f, headroom) / high;
+}
+
+void GEToneMappingLut::ApplyRgba(const Curve& curve, float headroom, float* rgba, size_t pixelCount)
+{
+    if (rgba == nullptr || !GEToneMappingHelper::NeedToneMapping(headroom)) {
+        return;
+    }
+    size_t i = 0;
+    for (; i + LANES <= pixelCount; i += LANES) {
+        ApplyLanes(curve, headroom, rgba + i * CHANNELS);
+    }
+    for (; i < pixelCount; ++i) {
+        ApplyPixel(curve, headroom, rgba + i * CHANNELS);
+    }
+}
+} // namespace Rosen
+} // namespace OHOS
@@ -0,0 +1,588 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "ge_warp_mesh.h"
+
+#include <algorithm>
+#include <cmath>
+#include <condition_variable>
+#include <functional>
+#include <list>
+#include <mutex>
+#include <thread>
+
+#include "image/bitmap.h"
+
+#include "ge_log.h"
+#include "ge_trace.h"
+
+namespace OHOS {
+namespace Rosen {
+namespace {
+constexpr uint32_t CHANNELS = 4;
+constexpr uint32_t ALPHA = 3;
+constexpr uint32_t TRIANGLE_VERTICES = 3;
+constexpr float PIXEL_CENTER = 0.5f;
+constexpr float CHANNEL_MAX = 255.0f;
+constexpr float MIN_AREA = 1e-6f;
+constexpr size_t MAX_WORKERS = 4;
+constexpr int64_t PARALLEL_MIN_PIXELS = 256 * 256; // 256: below this the workers cost more than they save
+
+// Index of the control points, clockwise from the top-left corner as in Canvas::DrawPatch
+constexpr size_t TOP_LEFT = 0;
+constexpr size_t TOP_ONE_THIRD = 1;
+constexpr size_t TOP_TWO_THIRDS = 2;
+constexpr size_t TOP_RIGHT = 3;
+constexpr size_t RIGHT_ONE_THIRD = 4;
+constexpr size_t RIGHT_TWO_THIRDS = 5;
+constexpr size_t BOTTOM_RIGHT = 6;
+constexpr size_t BOTTOM_TWO_THIRDS = 7;
+constexpr size_t BOTTOM_ONE_THIRD = 8;
+constexpr size_t BOTTOM_LEFT = 9;
+constexpr size_t LEFT_TWO_THIRDS = 10;
+constexpr size_t LEFT_ONE_THIRD = 11;
+
+struct PixelBuffer {
+    uint8_t* pixels = nullptr;
+    size_t rowBytes = 0;
+    int32_t width = 0;
+    int32_t height = 0;
+
+    uint8_t* At(int32_t x, int32_t y) const
+    {
+        return pixels + static_cast<size_t>(y) * rowBytes + static_cast<size_t>(x) * CHANNELS;
+    }
+};
+
+// Triangle in pixel space. Edge i is opposite vertex i, edge(p) = a * p.x + b * p.y + c is its barycentric weight
+// times the area, positive inside.
+struct Triangle {
+    std::array<float, TRIANGLE_VERTICES> u {};
+    std::array<float, TRIANGLE_VERTICES> v {};
+    std::array<float, TRIANGLE_VERTICES> a {};
+    std::array<float, TRIANGLE_VERTICES> b {};
+    std::array<float, TRIANGLE_VERTICES> c {};
+    // Pixel centres exactly on an edge belong to one of the triangles sharing it, so they are not blended twice
+    std::array<bool, TRIANGLE_VERTICES> tieInside {};
+    float invArea = 0.0f;
+    int32_t minX = 0;
+    int32_t maxX = 0;
+    int32_t minY = 0;
+    int32_t maxY = 0;
+};
+
+Drawing::Point EvalCubic(const Drawing::Point& p0, const Drawing::Point& p1, const Drawing::Point& p2,
+    const Drawing::Point& p3, float t)
+{
+    const float mt = 1.0f - t;
+    const float b0 = mt * mt * mt;
+    const float b1 = 3.0f * mt * mt * t; // 3: Bernstein coefficient
+    const float b2 = 3.0f * mt * t * t; // 3: Bernstein coefficient
+    const float b3 = t * t * t;
+    return { b0 * p0.GetX() + b1 * p1.GetX() + b2 * p2.GetX() + b3 * p3.GetX(),
+        b0 * p0.GetY() + b1 * p1.GetY() + b2 * p2.GetY() + b3 * p3.GetY() };
+}
+
+Drawing::Point Bilerp(const std::array<Drawing::Point, GEWarpMesh::PATCH_CORNER_NUM>& corners, float u, float v)
+{
+    // Corners are top-left, top-right, bottom-right, bottom-left
+    const float x = (1.0f - v) * ((1.0f - u) * corners[0].GetX() + u * corners[1].GetX()) +
+        v * ((1.0f - u) * corners[3].GetX() + u * corners[2].GetX()); // 2, 3: bottom corners
+    const float y = (1.0f - v) * ((1.0f - u) * corners[0].GetY() + u * corners[1].GetY()) +
+        v * ((1.0f - u) * corners[3].GetY() + u * corners[2].GetY()); // 2, 3: bottom corners
+    return { x, y };
+}
+
+bool SetupTriangle(const std::array<GEWarpMesh::Vertex, TRIANGLE_VERTICES>& vertices, float scaleX, float scaleY,
+    const PixelBuffer& target, Triangle& triangle)
+{
+    std::array<float, TRIANGLE_VERTICES> x {};
+    std::array<float, TRIANGLE_VERTICES> y {};
+    for (uint32_t i = 0; i < TRIANGLE_VERTICES; ++i) {
+        x[i] = vertices[i].x * scaleX;
+        y[i] = vertices[i].y * scaleY;
+        triangle.u[i] = vertices[i].u * scaleX;
+        triangle.v[i] = vertices[i].v * scaleY;
+    }
+    float area = (x[1] - x[0]) * (y[2] - y[0]) - (y[1] - y[0]) * (x[2] - x[0]); // 2: third vertex
+    if (std::fabs(area) < MIN_AREA) {
+        return false;
+    }
+    if (area < 0.0f) {
+        // Folded parts of a warp are still drawn, like on a canvas
+        std::swap(x[1], x[2]); // 2: third vertex
+        std::swap(y[1], y[2]); // 2: third vertex
+        std::swap(triangle.u[1], triangle.u[2]); // 2: third vertex
+        std::swap(triangle.v[1], triangle.v[2]); // 2: third vertex
+        area = -area;
+    }
+    for (uint32_t i = 0; i < TRIANGLE_VERTICES; ++i) {
+        const uint32_t from = (i + 1) % TRIANGLE_VERTICES;
+        const uint32_t to = (i + 2) % TRIANGLE_VERTICES; // 2: the other vertex of the edge
+        triangle.a[i] = y[from] - y[to];
+        triangle.b[i] = x[to] - x[from];
+        triangle.c[i] = -(triangle.a[i] * x[from] + triangle.b[i] * y[from]);
+        triangle.tieInside[i] = triangle.a[i] > 0.0f || (triangle.a[i] == 0.0f && triangle.b[i] > 0.0f);
+    }
+    triangle.invArea = 1.0f / area;
+    const auto [minX, maxX] = std::minmax({ x[0], x[1], x[2] }); // 2: third vertex
+    const auto [minY, maxY] = std::minmax({ y[0], y[1], y[2] }); // 2: third vertex
+    triangle.minX = std::max(static_cast<int32_t>(std::floor(minX)), 0);
+    triangle.maxX = std::min(static_cast<int32_t>(std::ceil(maxX)), target.width - 1);
+    triangle.minY = std::max(static_cast<int32_t>(std::floor(minY)), 0);
+    triangle.maxY = std::min(static_cast<int32_t>(std::ceil(maxY)), target.height - 1);
+    return triangle.minX <= triangle.maxX && triangle.minY <= triangle.maxY;
+}
+
+// Bilinear sample at texel space (u, v) with clamped edges, premultiplied and in [0, 255]
+void SamplePixel(const PixelBuffer& texture, float u, float v, float* color)
+{
+    const float sx = std::clamp(u - PIXEL_CENTER, 0.0f, static_cast<float>(texture.width - 1));
+    const float sy = std::clamp(v - PIXEL_CENTER, 0.0f, static_cast<float>(texture.height - 1));
+    const int32_t x0 = static_cast<int32_t>(sx);
+    const int32_t y0 = static_cast<int32_t>(sy);
+    const int32_t x1 = std::min(x0 + 1, texture.width - 1);
+    const int32_t y1 = std::min(y0 + 1, texture.height - 1);
+    const float fx = sx - static_cast<float>(x0);
+    const float fy = sy - static_cast<float>(y0);
+    const uint8_t* t00 = texture.At(x0, y0);
+    const uint8_t* t10 = texture.At(x1, y0);
+    const uint8_t* t01 = texture.At(x0, y1);
+    const uint8_t* t11 = texture.At(x1, y1);
+    for (uint32_t ch = 0; ch < CHANNELS; ++ch) {
+        const float top = t00[ch] + (t10[ch] - t00[ch]) * fx;
+        const float bottom = t01[ch] + (t11[ch] - t01[ch]) * fx;
+        color[ch] = top + (bottom - top) * fy;
+    }
+}
+
+void BlendPixel(const float* color, uint8_t* pixel)
+{
+    const float inverseAlpha = 1.0f - color[ALPHA] / CHANNEL_MAX;
+    for (uint32_t ch = 0; ch < CHANNELS; ++ch) {
+        const float value = color[ch] + pixel[ch] * inverseAlpha + PIXEL_CENTER;
+        pixel[ch] = static_cast<uint8_t>(std::min(value, CHANNEL_MAX));
+    }
+}
+
+void ShadePixel(const Triangle& triangle, const PixelBuffer& texture, const PixelBuffer& target, int32_t x,
+    int32_t y)
+{
+    const float px = static_cast<float>(x) + PIXEL_CENTER;
+    const float py = static_cast<float>(y) + PIXEL_CENTER;
+    std::array<float, TRIANGLE_VERTICES> weights {};
+    for (uint32_t i = 0; i < TRIANGLE_VERTICES; ++i) {
+        weights[i] = triangle.a[i] * px + triangle.b[i] * py + triangle.c[i];
+        if (weights[i] < 0.0f || (weights[i] == 0.0f && !triangle.tieInside[i])) {
+            return;
+        }
+    }
+    const float u = (weights[0] * triangle.u[0] + weights[1] * triangle.u[1] + weights[2] * triangle.u[2]) *
+        triangle.invArea; // 2: third vertex
+    const float v = (weights[0] * triangle.v[0] + weights[1] * triangle.v[1] + weights[2] * triangle.v[2]) *
+        triangle.invArea; // 2: third vertex
+    float color[CHANNELS] = {};
+    SamplePixel(texture, u, v, color);
+    BlendPixel(color, target.At(x, y));
+}
+
+#if defined(__GNUC__) || defined(__clang__)
+// 4 lanes map to NEON on the devices and SSE on the hosts
+using Float4 = float __attribute__((vector_size(16)));
+using Int4 = int32_t __attribute__((vector_size(16)));
+constexpr int32_t LANES = 4;
+
+inline Float4 Splat(float v)
+{
+    return Float4 { v, v, v, v };
+}
+
+inline Float4 Select(Int4 mask, Float4 a, Float4 b)
+{
+    return reinterpret_cast<Float4>((reinterpret_cast<Int4>(a) & mask) | (reinterpret_cast<Int4>(b) & ~mask));
+}
+
+inline Float4 Clamp(Float4 v, float low, float high)
+{
+    v = Select(v < Splat(low), Splat(low), v);
+    return Select(v > Splat(high), Splat(high), v);
+}
+
+// Shades the 4 pixels from (x, y) covered by triangle, the lanes hold one pixel each
+void ShadeLanes(const Triangle& triangle, const PixelBuffer& texture, const PixelBuffer& target, int32_t x,
+    int32_t y)
+{
+    const Float4 px = Splat(static_cast<float>(x) + PIXEL_CENTER) + Float4 { 0.0f, 1.0f, 2.0f, 3.0f };
+    const Float4 py = Splat(static_cast<float>(y) + PIXEL_CENTER);
+    Int4 inside = px < Splat(static_cast<float>(triangle.maxX + 1));
+    std::array<Float4, TRIANGLE_VERTICES> weights {};
+    for (uint32_t i = 0; i < TRIANGLE_VERTICES; ++i) {
+        weights[i] = Splat(triangle.a[i]) * px + Splat(triangle.b[i]) * py + Splat(triangle.c[i]);
+        const Int4 onEdge = triangle.tieInside[i] ? (weights[i] == Splat(0.0f)) : Int4 { 0, 0, 0, 0 };
+        inside &= (weights[i] > Splat(0.0f)) | onEdge;
+    }
+    if ((inside[0] | inside[1] | inside[2] | inside[3]) == 0) { // 2, 3: lanes
+        return;
+    }
+    const Float4 u = (weights[0] * Splat(triangle.u[0]) + weights[1] * Splat(triangle.u[1]) +
+        weights[2] * Splat(triangle.u[2])) * Splat(triangle.invArea); // 2: third vertex
+    const Float4 v = (weights[0] * Splat(triangle.v[0]) + weights[1] * Splat(triangle.v[1]) +
+        weights[2] * Splat(triangle.v[2])) * Splat(triangle.invArea); // 2: third vertex
+    const Float4 sx = Clamp(u - Splat(PIXEL_CENTER), 0.0f, static_cast<float>(texture.width - 1));
+    const Float4 sy = Clamp(v - Splat(PIXEL_CENTER), 0.0f, static_cast<float>(texture.height - 1));
+    // Coordinates are clamped to be positive, so the truncation is a floor
+    const Int4 x0 = __builtin_convertvector(sx, Int4);
+    const Int4 y0 = __builtin_convertvector(sy, Int4);
+    const Float4 fx = sx - __builtin_convertvector(x0, Float4);
+    const Float4 fy = sy - __builtin_convertvector(y0, Float4);
+
+    // The texel and target reads are the only scalar part, there is no gather on the targets
+    std::array<std::array<Float4, CHANNELS>, 4> taps {}; // 4: bilinear taps
+    std::array<Float4, CHANNELS> dst {};
+    for (int32_t lane = 0; lane < LANES; ++lane) {
+        if (inside[lane] == 0) {
+            continue;
+        }
+        const int32_t x1 = std::min(x0[lane] + 1, texture.width - 1);
+        const int32_t y1 = std::min(y0[lane] + 1, texture.height - 1);
+        const uint8_t* texels[] = { texture.At(x0[lane], y0[lane]), texture.At(x1, y0[lane]),
+            texture.At(x0[lane], y1), texture.At(x1, y1) };
+        const uint8_t* pixel = target.At(x + lane, y);
+        for (uint32_t ch = 0; ch < CHANNELS; ++ch) {
+            for (size_t tap = 0; tap < taps.size(); ++tap) {
+                taps[tap][ch][lane] = texels[tap][ch];
+            }
+            dst[ch][lane] = pixel[ch];
+        }
+    }
+    std::array<Float4, CHANNELS> color {};
+    for (uint32_t ch = 0; ch < CHANNELS; ++ch) {
+        const Float4 top = taps[0][ch] + (taps[1][ch] - taps[0][ch]) * fx;
+        const Float4 bottom = taps[2][ch] + (taps[3][ch] - taps[2][ch]) * fx; // 2, 3: bottom taps
+        color[ch] = top + (bottom - top) * fy;
+    }
+    const Float4 inverseAlpha = Splat(1.0f) - color[ALPHA] * Splat(1.0f / CHANNEL_MAX);
+    for (uint32_t ch = 0; ch < CHANNELS; ++ch) {
+        const Float4 blended = color[ch] + dst[ch] * inverseAlpha + Splat(PIXEL_CENTER);
+        color[ch] = Select(blended > Splat(CHANNEL_MAX), Splat(CHANNEL_MAX), blended);
+    }
+    for (int32_t lane = 0; lane < LANES; ++lane) {
+        if (inside[lane] == 0) {
+            continue;
+        }
+        uint8_t* pixel = target.At(x + lane, y);
+        for (uint32_t ch = 0; ch < CHANNELS; ++ch) {
+            pixel[ch] = static_cast<uint8_t>(color[ch][lane]);
+        }
+    }
+}
+#else
+constexpr int32_t LANES = 1;
+
+void ShadeLanes(const Triangle& triangle, const PixelBuffer& texture, const PixelBuffer& target, int32_t x,
+    int32_t y)
+{
+    ShadePixel(triangle, texture, target, x, y);
+}
+#endif
+
+// Rows [rowBegin, rowEnd) of every triangle, in mesh order so overlaps blend like on a canvas
+void DrawBand(const std::vector<Triangle>& triangles, const PixelBuffer& texture, const PixelBuffer& target,
+    int32_t rowBegin, int32_t rowEnd)
+{
+    for (const auto& triangle : triangles) {
+        const int32_t top = std::max(triangle.minY, rowBegin);
+        const int32_t bottom = std::min(triangle.maxY + 1, rowEnd);
+        for (int32_t y = top; y < bottom; ++y) {
+            int32_t x = triangle.minX;
+            // Lanes past maxX are masked, only spans ending at the right edge of the target finish pixel by pixel
+            for (; x + LANES <= target.width && x <= triangle.maxX; x += LANES) {
+                ShadeLanes(triangle, texture, target, x, y);
+            }
+            for (; x <= triangle.maxX; ++x) {
+                ShadePixel(triangle, texture, target, x, y);
+            }
+        }
+    }
+}
+
+bool ReadTexture(const Drawing::Image& image, Drawing::Bitmap& bitmap, PixelBuffer& texture)
+{
+    // Read in the color space of the image, so its pixels are not converted on the way to the texture
+    Drawing::ImageInfo info(image.GetWidth(), image.GetHeight(), Drawing::COLORTYPE_RGBA_8888,
+        Drawing::ALPHATYPE_PREMUL, image.GetImageInfo().GetColorSpace());
+    if (!bitmap.Build(info)) {
+        LOGE("GEWarpMesh::ReadTexture build bitmap failed");
+        return false;
+    }
+    bitmap.ClearWithColor(Drawing::Color::COLOR_TRANSPARENT);
+    Drawing::Canvas canvas;
+    canvas.Bind(bitmap);
+    canvas.DrawImage(image, 0.0f, 0.0f, Drawing::SamplingOptions());
+    texture = { static_cast<uint8_t*>(bitmap.GetPixels()), bitmap.GetRowBytes(), image.GetWidth(),
+        image.GetHeight() };
+    return texture.pixels != nullptr;
+}
+
+// Workers drawing the bands of Rasterize, started once so a draw does not pay for creating threads
+class BandWorkers {
+public:
+    static BandWorkers& GetInstance()
+    {
+        // Never destroyed, the detached workers wait on it until the process exits
+        static BandWorkers* instance = new BandWorkers();
+        return *instance;
+    }
+
+    // Runs task(0) .. task(count - 1) on the workers and the calling thread, returns once all are done.
+    // One Rasterize uses the workers at a time, concurrent calls run their tasks on the calling thread.
+    void Run(size_t count, const std::function<void(size_t)>& task)
+    {
+        std::unique_lock<std::mutex> runLock(runMutex_, std::try_to_lock);
+        if (!runLock.owns_lock() || count <= 1) {
+            for (size_t index = 0; index < count; ++index) {
+                task(index);
+            }
+            return;
+        }
+        std::unique_lock<std::mutex> lock(mutex_);
+        task_ = &task;
+        next_ = 0;
+        count_ = count;
+        pending_ = count;
+        wake_.notify_all();
+        RunTasks(lock);
+        done_.wait(lock, [this]() { return pending_ == 0; });
+        task_ = nullptr;
+    }
+
+private:
+    BandWorkers()
+    {
+        for (size_t worker = 1; worker < MAX_WORKERS; ++worker) {
+            std::thread([this]() {
+                std::unique_lock<std::mutex> lock(mutex_);
+                while (true) {
+                    wake_.wait(lock, [this]() { return next_ < count_; });
+                    RunTasks(lock);
+                }
+            }).detach();
+        }
+    }
+
+    // Claims the tasks left one by one, lock is held on entry and exit
+    void RunTasks(std::unique_lock<std::mutex>& lock)
+    {
+        while (next_ < count_) {
+            const size_t index = next_++;
+            const auto* task = task_;
+            lock.unlock();
+            (*task)(index);
+            lock.lock();
+            if (--pending_ == 0) {
+                done_.notify_all();
+            }
+        }
+    }
+
+    std::mutex runMutex_;
+    std::mutex mutex_;
+    std::condition_variable wake_;
+    std::condition_variable done_;
+    const std::function<void(size_t)>* task_ = nullptr;
+    size_t next_ = 0;
+    size_t count_ = 0;
+    size_t pending_ = 0;
+};
+
+struct MeshCache {
+    std::mutex mutex;
+    // Most recently used first
+    std::list<std::shared_ptr<const GEWarpMesh>> meshes;
+};
+
+MeshCache& GetMeshCache()
+{
+    static MeshCache cache;
+    return cache;
+}
+} // namespace
+
+bool GEWarpMesh::Patch::operator==(const Patch& other) const
+{
+    auto samePoint = [](const Drawing::Point& lhs, const Drawing::Point& rhs) {
+        return lhs.GetX() == rhs.GetX() && lhs.GetY() == rhs.GetY();
+    };
+    return std::equal(cubics.begin(), cubics.end(), other.cubics.begin(), samePoint) &&
+        std::equal(texCoords.begin(), texCoords.end(), other.texCoords.begin(), samePoint);
+}
+
+GEWarpMesh::GEWarpMesh(const std::vector<Patch>& patches) : patches_(patches)
+{
+    GE_TRACE_NAME_FMT("GEWarpMesh::Tessellate %zu patches", patches.size());
+    constexpr size_t patchVertices = (LOD + 1) * (LOD + 1);
+    constexpr size_t patchIndices = LOD * LOD * 2 * TRIANGLE_VERTICES; // 2: triangles per quad
+    vertices_.reserve(patches.size() * patchVertices);
+    indices_.reserve(patches.size() * patchIndices);
+    for (const auto& patch : patches) {
+        Tessellate(patch);
+    }
+}
+
+void GEWarpMesh::Tessellate(const Patch& patch)
+{
+    const auto& p = patch.cubics;
+    const std::array<Drawing::Point, PATCH_CORNER_NUM> corners = { p[TOP_LEFT], p[TOP_RIGHT], p[BOTTOM_RIGHT],
+        p[BOTTOM_LEFT] };
+    std::array<Drawing::Point, LOD + 1> top {};
+    std::array<Drawing::Point, LOD + 1> bottom {};
+    for (uint32_t col = 0; col <= LOD; ++col) {
+        const float u = static_cast<float>(col) / LOD;
+        top[col] = EvalCubic(p[TOP_LEFT], p[TOP_ONE_THIRD], p[TOP_TWO_THIRDS], p[TOP_RIGHT], u);
+        bottom[col] = EvalCubic(p[BOTTOM_LEFT], p[BOTTOM_ONE_THIRD], p[BOTTOM_TWO_THIRDS], p[BOTTOM_RIGHT], u);
+    }
+    const uint32_t base = static_cast<uint32_t>(vertices_.size());
+    for (uint32_t row = 0; row <= LOD; ++row) {
+        const float v = static_cast<float>(row) / LOD;
+        const auto left = EvalCubic(p[TOP_LEFT], p[LEFT_ONE_THIRD], p[LEFT_TWO_THIRDS], p[BOTTOM_LEFT], v);
+        const auto right = EvalCubic(p[TOP_RIGHT], p[RIGHT_ONE_THIRD], p[RIGHT_TWO_THIRDS], p[BOTTOM_RIGHT], v);
+        for (uint32_t col = 0; col <= LOD; ++col) {
+            const float u = static_cast<float>(col) / LOD;
+            // Coons patch: the ruled surfaces between opposite edges minus the bilinear surface of the corners
+            const auto corner = Bilerp(corners, u, v);
+            const auto tex = Bilerp(patch.texCoords, u, v);
+            vertices_.push_back({
+                (1.0f - v) * top[col].GetX() + v * bottom[col].GetX() + (1.0f - u) * left.GetX() +
+                    u * right.GetX() - corner.GetX(),
+                (1.0f - v) * top[col].GetY() + v * bottom[col].GetY() + (1.0f - u) * left.GetY() +
+                    u * right.GetY() - corner.GetY(),
+                tex.GetX(), tex.GetY() });
+        }
+    }
+    for (uint32_t row = 0; row < LOD; ++row) {
+        for (uint32_t col = 0; col < LOD; ++col) {
+            const uint32_t topLeft = base + row * (LOD + 1) + col;
+            const uint32_t bottomLeft = topLeft + LOD + 1;
+            indices_.insert(indices_.end(), { topLeft, topLeft + 1, bottomLeft + 1, topLeft, bottomLeft + 1,
+                bottomLeft });
+        }
+    }
+}
+
+std::shared_ptr<const GEWarpMesh> GEWarpMesh::Get(const std::vector<Patch>& patches)
+{
+    auto& cache = GetMeshCache();
+    {
+        std::lock_guard<std::mutex> lock(cache.mutex);
+        for (auto it = cache.meshes.begin(); it != cache.meshes.end(); ++it) {
+            if ((*it)->GetPatches() == patches) {
+                cache.meshes.splice(cache.meshes.begin(), cache.meshes, it);
+                return cache.meshes.front();
+            }
+        }
+    }
+    // Tessellated outside the lock, a racing thread at worst tessellates the same patches once more
+    auto mesh = std::make_shared<const GEWarpMesh>(patches);
+    std::lock_guard<std::mutex> lock(cache.mutex);
+    cache.meshes.push_front(mesh);
+    if (cache.meshes.size() > CACHE_CAPACITY) {
+        cache.meshes.pop_back();
+    }
+    return mesh;
+}
+
+void GEWarpMesh::ClearCache()
+{
+    auto& cache = GetMeshCache();
+    std::lock_guard<std::mutex> lock(cache.mutex);
+    cache.meshes.clear();
+}
+
+bool GEWarpMesh::IsRasterCanvas(Drawing::Canvas& canvas)
+{
+#ifdef RS_ENABLE_GPU
+    return canvas.GetGPUContext() == nullptr;
+#else
+    return true;
+#endif
+}
+
+bool GEWarpMesh::IsRasterizable(const Drawing::Image& image)
+{
+    const auto colorType = image.GetImageInfo().GetColorType();
+    return colorType == Drawing::COLORTYPE_RGBA_8888 || colorType == Drawing::COLORTYPE_BGRA_8888;
+}
+
+std::shared_ptr<Drawing::Image> GEWarpMesh::Rasterize(const Drawing::Image& image, int32_t width,
+    int32_t height) const
+{
+    if (image.GetWidth() <= 0 || image.GetHeight() <= 0 || width <= 0 || height <= 0) {
+        LOGE("GEWarpMesh::Rasterize size is invalid");
+        return nullptr;
+    }
+    if (!IsRasterizable(image)) {
+        LOGE("GEWarpMesh::Rasterize color type %{public}d is not supported",
+            static_cast<int>(image.GetImageInfo().GetColorType()));
+        return nullptr;
+    }
+    GE_TRACE_NAME_FMT("GEWarpMesh::Rasterize %d x %d", width, height);
+    Drawing::Bitmap textureBitmap;
+    PixelBuffer texture;
+    if (!ReadTexture(image, textureBitmap, texture)) {
+        return nullptr;
+    }
+    // Same color space as the texture, the warped pixels are copied without conversion
+    Drawing::Bitmap bitmap;
+    Drawing::ImageInfo info(width, height, Drawing::COLORTYPE_RGBA_8888, Drawing::ALPHATYPE_PREMUL,
+        image.GetImageInfo().GetColorSpace());
+    if (!bitmap.Build(info)) {
+        LOGE("GEWarpMesh::Rasterize build bitmap failed");
+        return nullptr;
+    }
+    bitmap.ClearWithColor(Drawing::Color::COLOR_TRANSPARENT);
+    const PixelBuffer target { static_cast<uint8_t*>(bitmap.GetPixels()), bitmap.GetRowBytes(), width, height };
+    if (target.pixels == nullptr) {
+        return nullptr;
+    }
+
+    std::vector<Triangle> triangles;
+    triangles.reserve(indices_.size() / TRIANGLE_VERTICES);
+    const float scaleX = static_cast<float>(image.GetWidth());
+    const float scaleY = static_cast<float>(image.GetHeight());
+    for (size_t i = 0; i + TRIANGLE_VERTICES <= indices_.size(); i += TRIANGLE_VERTICES) {
+        Triangle triangle;
+        if (SetupTriangle({ vertices_[indices_[i]], vertices_[indices_[i + 1]], vertices_[indices_[i + 2]] },
+            scaleX, scaleY, target, triangle)) { // 2: third vertex
+            triangles.push_back(triangle);
+        }
+    }
+
+    // Bands own disjoint rows, so the workers never touch the same pixel
+    const int32_t bands = (height + TILE_ROWS - 1) / TILE_ROWS;
+    auto drawBand = [&triangles, &texture, &target, height](size_t band) {
+        const int32_t rowBegin = static_cast<int32_t>(band) * TILE_ROWS;
+        DrawBand(triangles, texture, target, rowBegin, std::min(rowBegin + TILE_ROWS, height));
+    };
+    if (static_cast<int64_t>(width) * height < PARALLEL_MIN_PIXELS) {
+        for (int32_t band = 0; band < bands; ++band) {
+            drawBand(static_cast<size_t>(band));
+        }
+    } else {
+        BandWorkers::GetInstance().Run(static_cast<size_t>(bands), drawBand);
+    }
+    return bitmap.MakeImage();
+}
+} // namespace Rosen
+} // namespace OHOS
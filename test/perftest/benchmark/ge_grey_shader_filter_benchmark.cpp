@@ -0,0 +1,33 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <benchmark/benchmark.h>
+
+#include "ge_perf_test_utils.h"
+#include "ge_grey_shader_filter_perf_case.h"
+
+namespace OHOS {
+namespace Rosen {
+static void BM_GEGreyShaderFilter(benchmark::State& state)
+{
+    GEPerfTestContext context;
+    auto effect = MakeGEGreyShaderFilterPerfCase();
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(context.Apply(effect));
+    }
+}
+BENCHMARK(BM_GEGreyShaderFilter);
+} // namespace Rosen
+} // namespace OHOS
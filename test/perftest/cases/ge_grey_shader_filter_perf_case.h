@@ -0,0 +1,38 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef GRAPHICS_EFFECT_GE_GREY_SHADER_FILTER_PERF_CASE_H
+#define GRAPHICS_EFFECT_GE_GREY_SHADER_FILTER_PERF_CASE_H
+
+#include <memory>
+
+#include "ge_shader_filter_params.h"
+#include "ge_visual_effect.h"
+
+namespace OHOS {
+namespace Rosen {
+// Configuration of GEGreyShaderFilter measured by its benchmark and checked by its perf contract test
+inline std::shared_ptr<Drawing::GEVisualEffect> MakeGEGreyShaderFilterPerfCase()
+{
+    auto effect = std::make_shared<Drawing::GEVisualEffect>(Drawing::GE_FILTER_GREY);
+    // Strong enough to move the dark and light cells of the signature well beyond the golden tolerance
+    effect->SetParam(Drawing::GE_FILTER_GREY_COEF_1, 40.0f); // 40.0: lift of the dark tones, in 0-255 luminance
+    effect->SetParam(Drawing::GE_FILTER_GREY_COEF_2, 60.0f); // 60.0: drop of the light tones, in 0-255 luminance
+    return effect;
+}
+} // namespace Rosen
+} // namespace OHOS
+
+#endif // GRAPHICS_EFFECT_GE_GREY_SHADER_FILTER_PERF_CASE_H
@@ -0,0 +1,232 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "ge_perf_test_utils.h"
+
+#include <algorithm>
+#include <cstdlib>
+#include <fstream>
+#include <sstream>
+
+#include "draw/color.h"
+
+#include "ge_log.h"
+#include "ge_render.h"
+#include "ge_visual_effect_container.h"
+
+namespace OHOS {
+namespace Rosen {
+namespace {
+constexpr char PERF_DATA_DIR[] = "/data/test/graphics_effect/perftest/";
+constexpr char PERF_OUTPUT_DIR[] = "/data/local/tmp/";
+constexpr char RECORD_GOLDEN_ENV[] = "GE_PERF_RECORD_GOLDEN";
+constexpr int32_t CHECKER_CELL = 16;
+constexpr uint8_t CHECKER_DARK = 64;
+constexpr uint8_t CHECKER_LIGHT = 192;
+constexpr uint32_t BYTE_MAX = 255;
+
+std::string Trim(const std::string& text)
+{
+    const auto begin = text.find_first_not_of(" \t\r");
+    if (begin == std::string::npos) {
+        return "";
+    }
+    const auto end = text.find_last_not_of(" \t\r");
+    return text.substr(begin, end - begin + 1);
+}
+} // namespace
+
+GEPerfTestContext::GEPerfTestContext(int32_t width, int32_t height) : width_(width), height_(height)
+{
+    Drawing::BitmapFormat format { Drawing::COLORTYPE_RGBA_8888, Drawing::ALPHATYPE_PREMUL };
+    Drawing::Bitmap input;
+    if (width <= 0 || height <= 0 || !input.Build(width, height, format) || !target_.Build(width, height, format)) {
+        LOGE("GEPerfTestContext build bitmaps failed");
+        return;
+    }
+    auto* pixels = static_cast<uint8_t*>(input.GetPixels());
+    if (pixels == nullptr) {
+        return;
+    }
+    const size_t rowBytes = input.GetRowBytes();
+    for (int32_t y = 0; y < height; ++y) {
+        uint8_t* row = pixels + y * rowBytes;
+        for (int32_t x = 0; x < width; ++x) {
+            const bool dark = ((x / CHECKER_CELL) + (y / CHECKER_CELL)) % 2 == 0; // 2: checker parity
+            uint8_t* texel = row + x * GEImageSignature::CHANNELS;
+            texel[0] = static_cast<uint8_t>(x * BYTE_MAX / std::max(width - 1, 1));
+            texel[1] = static_cast<uint8_t>(y * BYTE_MAX / std::max(height - 1, 1));
+            texel[2] = dark ? CHECKER_DARK : CHECKER_LIGHT; // 2: b
+            texel[3] = static_cast<uint8_t>(BYTE_MAX);      // 3: a, opaque
+        }
+    }
+    input_ = input.MakeImage();
+    canvas_.Bind(target_);
+}
+
+std::shared_ptr<Drawing::Image> GEPerfTestContext::Apply(const std::shared_ptr<Drawing::GEVisualEffect>& effect)
+{
+    if (input_ == nullptr || effect == nullptr) {
+        return nullptr;
+    }
+    Drawing::GEVisualEffectContainer container;
+    container.AddToChainedFilter(effect);
+    const Drawing::Rect rect(0.0f, 0.0f, static_cast<float>(width_), static_cast<float>(height_));
+    GraphicsEffectEngine::GERender render;
+    return render.ApplyImageEffect(canvas_, container, { input_, rect, rect },
+        Drawing::SamplingOptions(Drawing::FilterMode::LINEAR));
+}
+
+bool GEPerfTestContext::ComputeSignature(const Drawing::Image& image, GEImageSignature& signature)
+{
+    constexpr int32_t size = GEImageSignature::SIZE;
+    constexpr int32_t channels = GEImageSignature::CHANNELS;
+    const int32_t width = image.GetWidth();
+    const int32_t height = image.GetHeight();
+    Drawing::Bitmap bitmap;
+    Drawing::BitmapFormat format { Drawing::COLORTYPE_RGBA_8888, Drawing::ALPHATYPE_PREMUL };
+    if (width < size || height < size || !bitmap.Build(width, height, format)) {
+        return false;
+    }
+    bitmap.ClearWithColor(Drawing::Color::COLOR_TRANSPARENT);
+    Drawing::Canvas canvas;
+    canvas.Bind(bitmap);
+    canvas.DrawImage(image, 0.0f, 0.0f, Drawing::SamplingOptions());
+    const auto* pixels = static_cast<const uint8_t*>(bitmap.GetPixels());
+    if (pixels == nullptr) {
+        return false;
+    }
+    // Block averages, small rasterization differences stay within the tolerance
+    const size_t rowBytes = bitmap.GetRowBytes();
+    for (int32_t cellY = 0; cellY < size; ++cellY) {
+        for (int32_t cellX = 0; cellX < size; ++cellX) {
+            const int32_t x0 = cellX * width / size;
+            const int32_t x1 = (cellX + 1) * width / size;
+            const int32_t y0 = cellY * height / size;
+            const int32_t y1 = (cellY + 1) * height / size;
+            std::array<uint64_t, channels> sums {};
+            for (int32_t y = y0; y < y1; ++y) {
+                const uint8_t* row = pixels + y * rowBytes;
+                for (int32_t x = x0; x < x1; ++x) {
+                    for (int32_t c = 0; c < channels; ++c) {
+                        sums[c] += row[x * channels + c];
+                    }
+                }
+            }
+            const uint64_t count = static_cast<uint64_t>(x1 - x0) * static_cast<uint64_t>(y1 - y0);
+            for (int32_t c = 0; c < channels; ++c) {
+                signature.rgba[(cellY * size + cellX) * channels + c] = static_cast<uint8_t>(sums[c] / count);
+            }
+        }
+    }
+    return true;
+}
+
+std::string GetPerfDataPath(const std::string& fileName)
+{
+    return PERF_DATA_DIR + fileName;
+}
+
+std::string GetPerfOutputPath(const std::string& fileName)
+{
+    return PERF_OUTPUT_DIR + fileName;
+}
+
+bool IsGoldenRecordingEnabled()
+{
+    const char* value = std::getenv(RECORD_GOLDEN_ENV);
+    return value != nullptr && std::string(value) == "1";
+}
+
+bool LoadPerfBudget(const std::string& path, GEPerfBudget& budget)
+{
+    std::ifstream file(path);
+    if (!file.is_open()) {
+        LOGE("LoadPerfBudget open %{public}s failed", path.c_str());
+        return false;
+    }
+    std::string line;
+    while (std::getline(file, line)) {
+        line = Trim(line.substr(0, line.find('#')));
+        const auto separator = line.find('=');
+        if (line.empty() || separator == std::string::npos) {
+            continue;
+        }
+        const std::string key = Trim(line.substr(0, separator));
+        const char* value = line.c_str() + separator + 1;
+        if (key == "max_passes") {
+            budget.maxPasses = std::strtof(value, nullptr);
+        } else if (key == "max_pool_allocations") {
+            budget.maxPoolAllocations = std::strtoull(value, nullptr, 10); // 10: decimal
+        } else if (key == "golden_tolerance") {
+            budget.goldenTolerance = static_cast<uint32_t>(std::strtoul(value, nullptr, 10)); // 10: decimal
+        } else {
+            LOGE("LoadPerfBudget unknown key %{public}s in %{public}s", key.c_str(), path.c_str());
+            return false;
+        }
+    }
+    return true;
+}
+
+bool LoadSignature(const std::string& path, GEImageSignature& signature)
+{
+    std::ifstream file(path);
+    if (!file.is_open()) {
+        return false;
+    }
+    std::string line;
+    size_t count = 0;
+    while (std::getline(file, line)) {
+        if (line.empty() || line[0] == '#') {
+            continue;
+        }
+        std::istringstream values(line);
+        uint32_t value = 0;
+        while (values >> value) {
+            if (count >= signature.rgba.size() || value > BYTE_MAX) {
+                LOGE("LoadSignature invalid data in %{public}s", path.c_str());
+                return false;
+            }
+            signature.rgba[count++] = static_cast<uint8_t>(value);
+        }
+    }
+    return count == signature.rgba.size();
+}
+
+bool SaveSignature(const std::string& path, const GEImageSignature& signature)
+{
+    std::ofstream file(path);
+    if (!file.is_open()) {
+        LOGE("SaveSignature open %{public}s failed", path.c_str());
+        return false;
+    }
+    file << "# " << GEImageSignature::SIZE << "x" << GEImageSignature::SIZE << " RGBA signature, one row per line\n";
+    constexpr size_t rowSize = GEImageSignature::SIZE * GEImageSignature::CHANNELS;
+    for (size_t i = 0; i < signature.rgba.size(); ++i) {
+        file << static_cast<uint32_t>(signature.rgba[i]) << ((i + 1) % rowSize == 0 ? "\n" : " ");
+    }
+    return file.good();
+}
+
+uint32_t GetMaxSignatureDiff(const GEImageSignature& lhs, const GEImageSignature& rhs)
+{
+    uint32_t maxDiff = 0;
+    for (size_t i = 0; i < lhs.rgba.size(); ++i) {
+        maxDiff = std::max(maxDiff, static_cast<uint32_t>(std::abs(lhs.rgba[i] - rhs.rgba[i])));
+    }
+    return maxDiff;
+}
+} // namespace Rosen
+} // namespace OHOS
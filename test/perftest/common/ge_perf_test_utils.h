@@ -0,0 +1,93 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef GRAPHICS_EFFECT_GE_PERF_TEST_UTILS_H
+#define GRAPHICS_EFFECT_GE_PERF_TEST_UTILS_H
+
+#include <array>
+#include <cstdint>
+#include <memory>
+#include <string>
+
+#include "draw/canvas.h"
+#include "image/bitmap.h"
+#include "image/image.h"
+
+#include "ge_visual_effect.h"
+
+namespace OHOS {
+namespace Rosen {
+// Limits of one effect, read from test/perftest/budget/<effect>.budget
+struct GEPerfBudget {
+    float maxPasses = 0.0f;            // max_passes: upper bound of the [[ge::cost(...)]] pass count
+    uint64_t maxPoolAllocations = 0;   // max_pool_allocations: GEFramePool allocations of one warm invocation
+    uint32_t goldenTolerance = 0;      // golden_tolerance: max channel difference to the golden signature
+};
+
+// Downscaled RGBA of an output, compared against test/perftest/golden/<effect>.golden
+struct GEImageSignature {
+    static constexpr int32_t SIZE = 8;
+    static constexpr int32_t CHANNELS = 4;
+    std::array<uint8_t, SIZE * SIZE * CHANNELS> rgba {};
+};
+
+/**
+ * @class GEPerfTestContext
+ * @brief Headless raster target shared by the benchmarks and the perf contract tests.
+ *
+ * The input is a deterministic gradient with a checker pattern, so blurs, distortions and color effects all change
+ * it. Effects run through GERender like in production, on a canvas bound to a bitmap.
+ */
+class GEPerfTestContext {
+public:
+    static constexpr int32_t DEFAULT_SIZE = 256;
+
+    explicit GEPerfTestContext(int32_t width = DEFAULT_SIZE, int32_t height = DEFAULT_SIZE);
+    ~GEPerfTestContext() = default;
+
+    // nullptr when the context failed to build its bitmaps
+    const std::shared_ptr<Drawing::Image>& GetInput() const
+    {
+        return input_;
+    }
+
+    // Output of the effect applied to the input, nullptr on failure
+    std::shared_ptr<Drawing::Image> Apply(const std::shared_ptr<Drawing::GEVisualEffect>& effect);
+
+    static bool ComputeSignature(const Drawing::Image& image, GEImageSignature& signature);
+
+private:
+    int32_t width_ = 0;
+    int32_t height_ = 0;
+    Drawing::Bitmap target_;
+    Drawing::Canvas canvas_;
+    std::shared_ptr<Drawing::Image> input_ = nullptr;
+};
+
+// Device path of a file deployed by test/perftest/ohos_test.xml
+std::string GetPerfDataPath(const std::string& fileName);
+// Device path recorded goldens are written to, pull them into test/perftest/golden
+std::string GetPerfOutputPath(const std::string& fileName);
+// Goldens are only recorded on explicit opt-in, with GE_PERF_RECORD_GOLDEN=1 in the environment
+bool IsGoldenRecordingEnabled();
+
+bool LoadPerfBudget(const std::string& path, GEPerfBudget& budget);
+bool LoadSignature(const std::string& path, GEImageSignature& signature);
+bool SaveSignature(const std::string& path, const GEImageSignature& signature);
+uint32_t GetMaxSignatureDiff(const GEImageSignature& lhs, const GEImageSignature& rhs);
+} // namespace Rosen
+} // namespace OHOS
+
+#endif // GRAPHICS_EFFECT_GE_PERF_TEST_UTILS_H
@@ -0,0 +1,96 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+
+#include "ge_frame_pool.h"
+#include "ge_perf_test_utils.h"
+#include "ge_grey_shader_filter_perf_case.h"
+
+using namespace testing;
+using namespace testing::ext;
+
+namespace OHOS {
+namespace Rosen {
+class GEGreyShaderFilterPerfTest : public testing::Test {
+public:
+    static void SetUpTestCase() {}
+    static void TearDownTestCase() {}
+    void SetUp() override
+    {
+        ASSERT_TRUE(LoadPerfBudget(GetPerfDataPath("budget/ge_grey_shader_filter.budget"), budget_));
+    }
+    void TearDown() override {}
+
+    GEPerfBudget budget_;
+    GEPerfTestContext context_;
+};
+
+/**
+ * @tc.name: PassBudget
+ * @tc.desc: The passes predicted by [[ge::cost(...)]] stay within max_passes
+ * @tc.type: FUNC
+ */
+HWTEST_F(GEGreyShaderFilterPerfTest, PassBudget, TestSize.Level1)
+{
+    auto effect = MakeGEGreyShaderFilterPerfCase();
+    ASSERT_NE(effect->GetImpl(), nullptr);
+    auto cost = effect->GetImpl()->EstimateCost();
+    if (!cost.has_value()) {
+        GTEST_LOG_(INFO) << "GEGreyShaderFilterPerfTest PassBudget skipped, the params have no [[ge::cost(...)]]";
+        return;
+    }
+    EXPECT_LE(cost->passes, budget_.maxPasses);
+}
+
+/**
+ * @tc.name: AllocationBudget
+ * @tc.desc: A warm invocation allocates at most max_pool_allocations objects from GEFramePool
+ * @tc.type: FUNC
+ */
+HWTEST_F(GEGreyShaderFilterPerfTest, AllocationBudget, TestSize.Level1)
+{
+    auto effect = MakeGEGreyShaderFilterPerfCase();
+    // The first invocation compiles the shaders and fills the caches
+    ASSERT_NE(context_.Apply(effect), nullptr);
+    auto& pool = GEFramePool::GetInstance();
+    pool.EndFrame();
+    ASSERT_NE(context_.Apply(effect), nullptr);
+    EXPECT_LE(pool.GetStats().frameAllocations, budget_.maxPoolAllocations);
+}
+
+/**
+ * @tc.name: GoldenImage
+ * @tc.desc: The output matches golden/ge_grey_shader_filter.golden within golden_tolerance
+ * @tc.type: FUNC
+ */
+HWTEST_F(GEGreyShaderFilterPerfTest, GoldenImage, TestSize.Level1)
+{
+    auto output = context_.Apply(MakeGEGreyShaderFilterPerfCase());
+    ASSERT_NE(output, nullptr);
+    GEImageSignature actual;
+    ASSERT_TRUE(GEPerfTestContext::ComputeSignature(*output, actual));
+    if (IsGoldenRecordingEnabled()) {
+        // Recorded to review and commit under test/perftest/golden
+        EXPECT_TRUE(SaveSignature(GetPerfOutputPath("ge_grey_shader_filter.golden"), actual));
+        GTEST_LOG_(INFO) << "GEGreyShaderFilterPerfTest recorded " << GetPerfOutputPath("ge_grey_shader_filter.golden");
+    }
+    GEImageSignature golden;
+    ASSERT_TRUE(LoadSignature(GetPerfDataPath("golden/ge_grey_shader_filter.golden"), golden))
+        << "Missing golden/ge_grey_shader_filter.golden, record one with GE_PERF_RECORD_GOLDEN=1";
+    EXPECT_LE(GetMaxSignatureDiff(actual, golden), budget_.goldenTolerance);
+}
+} // namespace Rosen
+} // namespace OHOS
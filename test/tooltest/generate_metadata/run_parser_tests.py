@@ -92,6 +92,7 @@ class StructExpectedResult:
     filter_name: str
     fields: List[FieldExpectedResult] = field(default_factory=list)
     params: Dict[str, Any] = field(default_factory=dict)
+    cost: Dict[str, str] = field(default_factory=dict)
 
 
 @dataclass
@@ -160,8 +161,8 @@ class Validator:
             PropAttributeExpected: [],
             FieldExpectedResult: ["prop_attributes", "array_accessor_length"],
             FieldInfo: ["prop_attributes", "attributes"],
-            StructExpectedResult: ["fields", "params"],
-            StructInfo: ["fields", "errors", "params"],
+            StructExpectedResult: ["fields", "params", "cost"],
+            StructInfo: ["fields", "errors", "params", "cost"],
         }
         excluded = exclude_fields.get(cls, [])
         return [f.name for f in fields(cls) if f.name not in excluded]
@@ -234,10 +235,11 @@ class Validator:
         context: ValidationContext,
         exp_params: Dict,
         act_params: Dict,
+        label: str = "params",
     ):
         """Validate params dictionary."""
         if exp_params != act_params:
-            self._add_difference(validation, f"{context} params mismatch")
+            self._add_difference(validation, f"{context} {label} mismatch")
             missing_keys = set(exp_params.keys()) - set(act_params.keys())
             extra_keys = set(act_params.keys()) - set(exp_params.keys())
             diff_keys = set(
@@ -248,16 +250,16 @@ class Validator:
 
             if missing_keys:
                 self._add_difference(
-                    validation, f"{context} params missing keys: {sorted(missing_keys)}"
+                    validation, f"{context} {label} missing keys: {sorted(missing_keys)}"
                 )
             if extra_keys:
                 self._add_difference(
-                    validation, f"{context} params extra keys: {sorted(extra_keys)}"
+                    validation, f"{context} {label} extra keys: {sorted(extra_keys)}"
                 )
             for key in sorted(diff_keys):
                 self._add_difference(
                     validation,
-                    f"{context} params['{key}'] mismatch: expected '{exp_params[key]}', got '{act_params[key]}'",
+                    f"{context} {label}['{key}'] mismatch: expected '{exp_params[key]}', got '{act_params[key]}'",
                 )
 
     def _validate_struct(
@@ -275,6 +277,7 @@ class Validator:
         exp_params = exp_struct.params or {}
         act_params = act_struct.params or {}
         self._validate_params(validation, context, exp_params, act_params)
+        self._validate_params(validation, context, exp_struct.cost or {}, act_struct.cost or {}, "cost")
 
         exp_fields = exp_struct.fields
         act_fields = act_struct.fields
@@ -453,6 +456,10 @@ class ResultFormatter:
             lines.append(f"  Params ({len(struct.params)}):")
             for key, value in sorted(struct.params.items()):
                 lines.append(f"    - {key}: {value}")
+        if struct.cost:
+            lines.append(f"  Cost ({len(struct.cost)}):")
+            for key, value in sorted(struct.cost.items()):
+                lines.append(f"    - {key}: {value}")
         lines.append(f"  Fields ({len(struct.fields)}):")
         for field in struct.fields:
             lines.extend(self._format_field_details(field))
@@ -608,6 +615,7 @@ class TestRunner:
                 self._parse_field_from_json(f) for f in struct_data.get("fields", [])
             ],
             params=struct_data.get("params", {}),
+            cost=struct_data.get("cost", {}),
         )
 
     def load_expected_results(self) -> bool:
@@ -679,6 +687,7 @@ class TestRunner:
                         for field in struct.fields
                     ],
                     params=struct.params,
+                    cost=struct.cost,
                 )
                 structs_data.append(asdict(struct_data))
 
@@ -160,6 +160,58 @@ HWTEST_F(GEAuroraNoiseShaderTest, Preprocess_001, TestSize.Level1)
     EXPECT_NE(shader.verticalBlurImg_, nullptr);
 }
 
+/**
+ * @tc.name: Preprocess_002
+ * @tc.desc: Verify the noise images are reused while the parameters and size are unchanged
+ * @tc.type: FUNC
+ */
+HWTEST_F(GEAuroraNoiseShaderTest, Preprocess_002, TestSize.Level1)
+{
+    GEAuroraNoiseShaderParams params{0.5};
+    auto shader = GEAuroraNoiseShader(params);
+    shader.Preprocess(*canvas_, rect_);
+    auto noiseImg = shader.noiseImg_;
+    ASSERT_NE(noiseImg, nullptr);
+    shader.Preprocess(*canvas_, rect_);
+    EXPECT_EQ(shader.noiseImg_, noiseImg);
+
+    params.noise_ = 0.6f;
+    shader.SetAuroraNoiseParams(params);
+    shader.Preprocess(*canvas_, rect_);
+    EXPECT_NE(shader.noiseImg_, noiseImg); // noise changed
+    noiseImg = shader.noiseImg_;
+    shader.Preprocess(*canvas_, Drawing::Rect(0.0f, 0.0f, 2.0f * rect_.GetWidth(), rect_.GetHeight()));
+    EXPECT_NE(shader.noiseImg_, noiseImg); // size changed
+}
+
+/**
+ * @tc.name: Preprocess_003
+ * @tc.desc: Verify the noise images are reused by a new shader carrying the cache of the previous one
+ * @tc.type: FUNC
+ */
+HWTEST_F(GEAuroraNoiseShaderTest, Preprocess_003, TestSize.Level1)
+{
+    GEAuroraNoiseShaderParams params{0.5};
+    auto firstShader = std::make_shared<GEAuroraNoiseShader>(params);
+    firstShader->Preprocess(*canvas_, rect_);
+    auto noiseImg = firstShader->noiseImg_;
+    ASSERT_NE(noiseImg, nullptr);
+    ASSERT_NE(firstShader->GetCache(), nullptr);
+
+    // Each draw creates a new shader and hands it the cache of the visual effect
+    auto secondShader = std::make_shared<GEAuroraNoiseShader>(params);
+    secondShader->SetCache(firstShader->GetCache());
+    secondShader->Preprocess(*canvas_, rect_);
+    EXPECT_EQ(secondShader->noiseImg_, noiseImg);
+    EXPECT_EQ(secondShader->verticalBlurImg_, firstShader->verticalBlurImg_);
+
+    params.noise_ = 0.6f;
+    auto thirdShader = std::make_shared<GEAuroraNoiseShader>(params);
+    thirdShader->SetCache(secondShader->GetCache());
+    thirdShader->Preprocess(*canvas_, rect_);
+    EXPECT_NE(thirdShader->noiseImg_, noiseImg); // noise changed
+}
+
 /**
  * @tc.name: MakeAuroraNoiseShader_001
  * @tc.desc: Verify function MakeAuroraNoiseShader
@@ -66,7 +66,7 @@ void GEBezierWarpShaderFilterTest::TearDown()
 
 /**
  * @tc.name: OnProcessImage_001
- * @tc.desc: Verify the OnProcessImage: image is nullptr
+ * @tc.desc: Verify the OnProcessImage: null image, and raster canvases drawn without a surface
  * @tc.type: FUNC
  */
 HWTEST_F(GEBezierWarpShaderFilterTest, OnProcessImage_001, TestSize.Level0)
@@ -75,7 +75,9 @@ HWTEST_F(GEBezierWarpShaderFilterTest, OnProcessImage_001, TestSize.Level0)
 
     Drawing::GEBezierWarpShaderFilterParams geBezierWarpShaderFilterParams;
     auto geBezierWarpShaderFilter = std::make_unique<GEBezierWarpShaderFilter>(geBezierWarpShaderFilterParams);
-    EXPECT_EQ(geBezierWarpShaderFilter->OnProcessImage(canvas_, image_, src_, dst_), nullptr);
+    EXPECT_EQ(geBezierWarpShaderFilter->OnProcessImage(canvas_, nullptr, src_, dst_), nullptr);
+    // canvas_ has no surface, the warp mesh rasterizer does not need one
+    EXPECT_NE(geBezierWarpShaderFilter->OnProcessImage(canvas_, image_, src_, dst_), nullptr);
 
     GTEST_LOG_(INFO) << "GEBezierWarpShaderFilterTest OnProcessImage_001 end";
 }
@@ -15,6 +15,7 @@
 
 #include <gtest/gtest.h>
 #include "ge_cache_helper.h"
+#include "ge_feature_flags.h"
 #ifdef GE_OHOS
 #include <parameter.h>
 #include <parameters.h>
@@ -34,6 +35,12 @@ public:
     static void TearDownTestCase();
     void SetUp() override;
     void TearDown() override;
+    void SetSDFCacheParameter(const std::string& value)
+    {
+        system::SetParameter(enableSDFTag_.c_str(), value.c_str());
+        // The parameter watcher refreshes the flags asynchronously, refresh now so the change is seen at once
+        GEFeatureFlags::GetInstance().Refresh();
+    }
     const std::string enableSDFTag_ = "persist.sys.graphic.effect.enablesdfcache";
     const std::string keepDefaultValue_ = "-1";
     const std::string forceFalseValue_ = "0";
@@ -44,12 +51,12 @@ void GECacheHelperTest::SetUpTestCase(void) {}
 void GECacheHelperTest::TearDownTestCase(void) {}
 void GECacheHelperTest::SetUp()
 {
-    system::SetParameter(enableSDFTag_.c_str(), keepDefaultValue_.c_str());
+    SetSDFCacheParameter(keepDefaultValue_);
 }
 
 void GECacheHelperTest::TearDown()
 {
-    system::SetParameter(enableSDFTag_.c_str(), keepDefaultValue_.c_str());
+    SetSDFCacheParameter(keepDefaultValue_);
 }
 
 /**
@@ -60,7 +67,7 @@ void GECacheHelperTest::TearDown()
 HWTEST_F(GECacheHelperTest, IsSDFCacheEnabledDefault, TestSize.Level1)
 {
     GTEST_LOG_(INFO) << "GECacheHelperTest IsSDFCacheEnabledDefault start";
-    system::SetParameter(enableSDFTag_.c_str(), keepDefaultValue_.c_str());
+    SetSDFCacheParameter(keepDefaultValue_);
     bool result = GECacheHelper::IsSDFCacheEnabled(true);
     EXPECT_TRUE(result);
     result = GECacheHelper::IsSDFCacheEnabled(false);
@@ -76,7 +83,7 @@ HWTEST_F(GECacheHelperTest, IsSDFCacheEnabledDefault, TestSize.Level1)
 HWTEST_F(GECacheHelperTest, IsSDFCacheEnabledForceFalse, TestSize.Level1)
 {
     GTEST_LOG_(INFO) << "GECacheHelperTest IsSDFCacheEnabledForceFalse start";
-    system::SetParameter(enableSDFTag_.c_str(), forceFalseValue_.c_str());
+    SetSDFCacheParameter(forceFalseValue_);
     bool result = GECacheHelper::IsSDFCacheEnabled(false);
     EXPECT_FALSE(result);
     result = GECacheHelper::IsSDFCacheEnabled(true);
@@ -92,7 +99,7 @@ HWTEST_F(GECacheHelperTest, IsSDFCacheEnabledForceFalse, TestSize.Level1)
 HWTEST_F(GECacheHelperTest, IsSDFCacheEnabledForceTrue, TestSize.Level1)
 {
     GTEST_LOG_(INFO) << "GECacheHelperTest IsSDFCacheEnabledForceTrue start";
-    system::SetParameter(enableSDFTag_.c_str(), forceTrueValue_.c_str());
+    SetSDFCacheParameter(forceTrueValue_);
     bool result = GECacheHelper::IsSDFCacheEnabled(false);
     EXPECT_TRUE(result);
     result = GECacheHelper::IsSDFCacheEnabled(true);
@@ -340,6 +340,38 @@ HWTEST_F(GEContourDiagonalFlowLightShaderTest, Preprocess_001, TestSize.Level1)
     EXPECT_EQ(shader4.cacheAnyPtr_, nullptr); // rect is not valid
 }
 
+/**
+ * @tc.name: Preprocess_002
+ * @tc.desc: Verify the precalculation is reused for nearby sizes of the same aspect and recomputed otherwise
+ * @tc.type: FUNC
+ */
+HWTEST_F(GEContourDiagonalFlowLightShaderTest, Preprocess_002, TestSize.Level1)
+{
+    auto params = InitializeParams();
+    params.contour_ = std::vector<Vector2f>(80, Vector2f(0.2f, 0.3f));
+    auto shader = GEContourDiagonalFlowLightShader(params);
+    shader.Preprocess(*canvas_, rect_);
+    auto cache = shader.cacheAnyPtr_;
+    ASSERT_NE(cache, nullptr);
+
+    shader.Preprocess(*canvas_, Drawing::Rect(0.0f, 0.0f, 110.0f, 110.0f)); // 110: within the resample range
+    EXPECT_EQ(shader.cacheAnyPtr_, cache);
+    shader.Preprocess(*canvas_, Drawing::Rect(0.0f, 0.0f, 90.0f, 90.0f)); // 90: within the resample range
+    EXPECT_EQ(shader.cacheAnyPtr_, cache);
+
+    params.haloRadius_ += 1.0f;
+    shader.SetGEContentDiagonalFlowLightShaderParams(params);
+    shader.Preprocess(*canvas_, rect_);
+    EXPECT_NE(shader.cacheAnyPtr_, cache); // halo radius is part of the signature
+    cache = shader.cacheAnyPtr_;
+
+    shader.Preprocess(*canvas_, Drawing::Rect(0.0f, 0.0f, 100.0f, 60.0f)); // 60: aspect ratio changed
+    EXPECT_NE(shader.cacheAnyPtr_, cache);
+    cache = shader.cacheAnyPtr_;
+    shader.Preprocess(*canvas_, Drawing::Rect(0.0f, 0.0f, 200.0f, 120.0f)); // 200 x 120: same aspect, twice the size
+    EXPECT_NE(shader.cacheAnyPtr_, cache);
+}
+
 /**
  * @tc.name: DrawShader_001
  * @tc.desc: Verify function DrawShader
@@ -819,11 +851,11 @@ HWTEST_F(GEContourDiagonalFlowLightShaderTest, ComputeAllCurveBoundingBoxes_001,
 }
 
 /**
- * @tc.name: InitializeWorkQueue_001
- * @tc.desc: Verify function InitializeWorkQueue
+ * @tc.name: BinningRoot_001
+ * @tc.desc: Verify the grid binning keeps the curves touching the root grid
  * @tc.type: FUNC
  */
-HWTEST_F(GEContourDiagonalFlowLightShaderTest, InitializeWorkQueue_001, TestSize.Level1)
+HWTEST_F(GEContourDiagonalFlowLightShaderTest, BinningRoot_001, TestSize.Level1)
 {
     auto params = InitializeParams();
     const int w = 200, h = 200;
@@ -849,21 +881,22 @@ HWTEST_F(GEContourDiagonalFlowLightShaderTest, InitializeWorkQueue_001, TestSize
     shader.ComputeAllCurveBoundingBoxes(w, h, 0.05f, canvasBBoxUnion, curveBBoxes); // 0.05: maxThickness
     Box4f leftHalfCanvas{0.0f, float(w) * 0.5f, 0.0f, float(h)};
 
-    std::queue<Grid> workQueue;
-    shader.InitializeWorkQueue(leftHalfCanvas, curveBBoxes, workQueue);
+    // 128: minGridSize, the limit above the curve count keeps the root grid whole
+    shader.binning_.Build(leftHalfCanvas, curveBBoxes, { static_cast<uint32_t>(shader.numCurves_), 128.0f,
+        GESpatialBinning::SplitMode::QUAD });
 
-    ASSERT_FALSE(workQueue.empty());
-    Grid root = workQueue.front();
-    EXPECT_GT(root.curveIndices.size(), 0u);
-    EXPECT_EQ(root.curveIndices.size(), static_cast<size_t>(shader.numCurves_));
+    ASSERT_EQ(shader.binning_.GetCells().size(), 1u);
+    const auto& root = shader.binning_.GetCells().front();
+    EXPECT_GT(root.count, 0u);
+    EXPECT_EQ(root.count, static_cast<uint32_t>(shader.numCurves_));
 }
 
 /**
- * @tc.name: SplitGrid_001
- * @tc.desc: Verify function SplitGrid
+ * @tc.name: BinningSplit_001
+ * @tc.desc: Verify the grid binning splits a grid holding too many curves
  * @tc.type: FUNC
  */
-HWTEST_F(GEContourDiagonalFlowLightShaderTest, SplitGrid_001, TestSize.Level1)
+HWTEST_F(GEContourDiagonalFlowLightShaderTest, BinningSplit_001, TestSize.Level1)
 {
     auto params = InitializeParams();
     const int w = 100, h = 100;
@@ -889,22 +922,17 @@ HWTEST_F(GEContourDiagonalFlowLightShaderTest, SplitGrid_001, TestSize.Level1)
     Box4f canvasBBox;
     shader.ComputeAllCurveBoundingBoxes(w, h, 0.05f, canvasBBox, curveBBoxes); // 0.05f: maxThickness
 
-    std::queue<Grid> workQueue;
-    shader.InitializeWorkQueue(canvasBBox, curveBBoxes, workQueue);
-    ASSERT_FALSE(workQueue.empty());
-    Grid current = workQueue.front();
-
-    size_t q0 = workQueue.size();
-    shader.SplitGrid(current, curveBBoxes, workQueue, 128); // 128: minGridSize
-    EXPECT_GT(workQueue.size(), q0);
+    // 4: max curves per grid, 16: minGridSize
+    shader.binning_.Build(canvasBBox, curveBBoxes, { 4, 16.0f, GESpatialBinning::SplitMode::QUAD });
+    EXPECT_GT(shader.binning_.GetCells().size(), 1u);
 }
 
 /**
- * @tc.name: SplitGrid_002
- * @tc.desc: Verify function SplitGrid sparse quadrants for empty child.curveIndices
+ * @tc.name: BinningSplit_002
+ * @tc.desc: Verify the grid binning drops sparse quadrants without curves
  * @tc.type: FUNC
  */
-HWTEST_F(GEContourDiagonalFlowLightShaderTest, SplitGrid_002, TestSize.Level1)
+HWTEST_F(GEContourDiagonalFlowLightShaderTest, BinningSplit_002, TestSize.Level1)
 {
     auto params = InitializeParams();
     const int w = 200, h = 200;
@@ -928,18 +956,20 @@ HWTEST_F(GEContourDiagonalFlowLightShaderTest, SplitGrid_002, TestSize.Level1)
     Box4f canvasBBox;
     shader.ComputeAllCurveBoundingBoxes(w, h, 0.05f, canvasBBox, curveBBoxes); // 0.05:maxThickness
 
-    std::queue<Grid> workQueue;
-    shader.InitializeWorkQueue(canvasBBox, curveBBoxes, workQueue);
-    ASSERT_FALSE(workQueue.empty());
-    size_t q0 = workQueue.size();
-    Grid current = workQueue.front(); // entire curveIndices
-    current.bbox[1] += 1000.0f;  // XMAX_I, expand to the right
-    current.bbox[3] += 1000.0f;  // YMAX_I, expand downwards
-
-    shader.SplitGrid(current, curveBBoxes, workQueue, 128); // 128: minGridSize
-    size_t pushed = workQueue.size() - q0;
-    // only push the lefttop corner to the workQueue，child.curveIndices.empty() is true in the other three corners
-    EXPECT_EQ(pushed, 1u);
+    Box4f root = canvasBBox;
+    root[1] += 1000.0f;  // XMAX_I, expand to the right
+    root[3] += 1000.0f;  // YMAX_I, expand downwards
+
+    // 1: max curves per grid, 128: minGridSize
+    shader.binning_.Build(root, curveBBoxes, { 1, 128.0f, GESpatialBinning::SplitMode::QUAD });
+    // only the lefttop corner keeps curves, the other three corners of the first split are empty
+    const auto& emptyCells = shader.binning_.GetEmptyCells();
+    ASSERT_GE(emptyCells.size(), 3u);
+    float midX = (root[0] + root[1]) * 0.5f;
+    EXPECT_FLOAT_EQ(emptyCells[0][0], midX); // Top-Right quadrant
+    for (const auto& cell : shader.binning_.GetCells()) {
+        EXPECT_LE(cell.bbox[1], midX);
+    }
 }
 
 /**
@@ -955,10 +985,10 @@ HWTEST_F(GEContourDiagonalFlowLightShaderTest, ProcessFinalGrid_001, TestSize.Le
     std::vector<Box4f> curveBBoxes;
     Box4f canvasBBox;
     shader.ComputeAllCurveBoundingBoxes(100, 100, 0.05f, canvasBBox, curveBBoxes); // width, height, maxThickness
-    std::queue<Grid> workQueue;
-    shader.InitializeWorkQueue(canvasBBox, curveBBoxes, workQueue);
-    Grid current = workQueue.front();
-    shader.ProcessFinalGrid(current, curveBBoxes, 100); // 100: height
+    shader.binning_.Build(canvasBBox, curveBBoxes, { 16, 128.0f, GESpatialBinning::SplitMode::QUAD }); // 16, 128
+    ASSERT_FALSE(shader.binning_.GetCells().empty());
+    const auto& cell = shader.binning_.GetCells().front();
+    shader.ProcessFinalGrid(cell.bbox, shader.binning_.GetCellItems(cell), cell.count, 100); // 100: height
     ASSERT_FALSE(shader.curvesInGrid_.empty());
     ASSERT_FALSE(shader.segmentIndex_.empty());
 }
@@ -999,13 +1029,14 @@ HWTEST_F(GEContourDiagonalFlowLightShaderTest, ProcessFinalGrid_002, TestSize.Le
     Box4f canvasBBoxUnion;
     shader.ComputeAllCurveBoundingBoxes(w, h, 0.05f, canvasBBoxUnion, curveBBoxes); // 0.05f: maxThickness
     Box4f rightCanvas{0.80f * w, static_cast<float>(w), 0.0f, static_cast<float>(h)};
-    std::queue<Grid> workQueue;
-    shader.InitializeWorkQueue(rightCanvas, curveBBoxes, workQueue);
-    ASSERT_FALSE(workQueue.empty());
-    Grid current = workQueue.front();
-    EXPECT_EQ(current.curveIndices.size(), kR + 1);
-    EXPECT_LT(current.curveIndices.size(), static_cast<size_t>(shader.numCurves_));
-    shader.ProcessFinalGrid(current, curveBBoxes, 100); // 100: height
+    // 128: minGridSize, the limit of all curves keeps the root grid whole
+    shader.binning_.Build(rightCanvas, curveBBoxes, { static_cast<uint32_t>(shader.numCurves_), 128.0f,
+        GESpatialBinning::SplitMode::QUAD });
+    ASSERT_EQ(shader.binning_.GetCells().size(), 1u);
+    const auto& cell = shader.binning_.GetCells().front();
+    EXPECT_EQ(cell.count, kR + 1);
+    EXPECT_LT(cell.count, static_cast<uint32_t>(shader.numCurves_));
+    shader.ProcessFinalGrid(cell.bbox, shader.binning_.GetCellItems(cell), cell.count, 100); // 100: height
     ASSERT_FALSE(shader.curvesInGrid_.empty());
     ASSERT_FALSE(shader.segmentIndex_.empty());
 }
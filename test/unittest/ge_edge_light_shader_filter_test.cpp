@@ -67,6 +67,7 @@ void GEEdgeLightShaderFilterTest::SetUp()
     imageComposite_ = bmp.MakeImage();
     bmp.Build(0, 0, format); // 0, 0  bitmap size
     imageEmpty_ = bmp.MakeImage();
+    GEEdgeLightImageCache::GetInstance().Clear();
 }
 
 void GEEdgeLightShaderFilterTest::TearDown()
@@ -195,6 +196,86 @@ HWTEST_F(GEEdgeLightShaderFilterTest, OnProcessImageTest, TestSize.Level1)
     EXPECT_EQ(edgeLightShaderFilter->OnProcessImage(canvas_, image_, src_, dst_), image_);
 }
 
+/**
+ * @tc.name: ImageCacheKeepsSeveralEntries
+ * @tc.desc: Verify two surfaces rendering alternately both hit the cache and the statistics count them
+ * @tc.type: FUNC
+ */
+HWTEST_F(GEEdgeLightShaderFilterTest, ImageCacheKeepsSeveralEntries, TestSize.Level1)
+{
+    auto filter = CreateEdgeLightShaderFilter();
+    auto& cache = GEEdgeLightImageCache::GetInstance();
+    auto keyA = filter->MakeCacheKey(image_);
+    auto keyB = filter->MakeCacheKey(imageComposite_);
+    ASSERT_NE(keyA.imageId, keyB.imageId);
+
+    EXPECT_EQ(cache.Find(keyA), nullptr);
+    cache.Insert(keyA, imageComposite_);
+    EXPECT_EQ(cache.Find(keyB), nullptr);
+    cache.Insert(keyB, image_);
+
+    for (int frame = 0; frame < 3; ++frame) { // 3 frames with both surfaces
+        EXPECT_EQ(cache.Find(keyA), imageComposite_);
+        EXPECT_EQ(cache.Find(keyB), image_);
+    }
+    auto stats = cache.GetStats();
+    EXPECT_EQ(stats.hits, 6u);   // 6: two hits per frame
+    EXPECT_EQ(stats.misses, 2u); // 2: first frame of each surface
+    EXPECT_EQ(stats.evictions, 0u);
+}
+
+/**
+ * @tc.name: ImageCacheKeyCoversParams
+ * @tc.desc: Verify color, bloom and raw color changes miss the cache
+ * @tc.type: FUNC
+ */
+HWTEST_F(GEEdgeLightShaderFilterTest, ImageCacheKeyCoversParams, TestSize.Level1)
+{
+    auto filter = CreateEdgeLightShaderFilter();
+    auto& cache = GEEdgeLightImageCache::GetInstance();
+    cache.Insert(filter->MakeCacheKey(image_), imageComposite_);
+    EXPECT_EQ(cache.Find(filter->MakeCacheKey(image_)), imageComposite_);
+
+    filter->color_ = Vector4f(0.5f, 0.5f, 0.5f, 0.0f);
+    EXPECT_EQ(cache.Find(filter->MakeCacheKey(image_)), nullptr);
+    filter->color_ = Vector4f(0.2f, 0.7f, 0.1f, 0.0f);
+    filter->bloom_ = false;
+    EXPECT_EQ(cache.Find(filter->MakeCacheKey(image_)), nullptr);
+    filter->bloom_ = true;
+    filter->useRawColor_ = true;
+    EXPECT_EQ(cache.Find(filter->MakeCacheKey(image_)), nullptr);
+}
+
+/**
+ * @tc.name: ImageCacheEvictsLeastRecentlyUsed
+ * @tc.desc: Verify the cache is bounded and evicts the least recently used entry
+ * @tc.type: FUNC
+ */
+HWTEST_F(GEEdgeLightShaderFilterTest, ImageCacheEvictsLeastRecentlyUsed, TestSize.Level1)
+{
+    auto& cache = GEEdgeLightImageCache::GetInstance();
+    EdgeLightCacheKey key;
+    for (uint32_t id = 1; id <= GEEdgeLightImageCache::MAX_ENTRIES; ++id) {
+        key.imageId = id;
+        cache.Insert(key, image_);
+    }
+    key.imageId = 1;
+    EXPECT_NE(cache.Find(key), nullptr); // Entry 1 becomes the most recently used
+
+    key.imageId = GEEdgeLightImageCache::MAX_ENTRIES + 1;
+    cache.Insert(key, image_);
+    EXPECT_EQ(cache.Size(), GEEdgeLightImageCache::MAX_ENTRIES);
+    EXPECT_EQ(cache.GetStats().evictions, 1u);
+    key.imageId = 2; // 2: oldest entry after 1 was used
+    EXPECT_EQ(cache.Find(key), nullptr);
+    key.imageId = 1;
+    EXPECT_NE(cache.Find(key), nullptr);
+
+    cache.Clear();
+    EXPECT_EQ(cache.Size(), 0u);
+    EXPECT_EQ(cache.GetStats().hits, 0u);
+}
+
 } // namespace GraphicsEffectEngine
 } // namespace Rosen
 } // namespace OHOS
\ No newline at end of file
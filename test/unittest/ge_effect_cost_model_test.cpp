@@ -0,0 +1,109 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+
+#include "ge_effect_cost_model.h"
+
+using namespace testing;
+using namespace testing::ext;
+
+namespace OHOS {
+namespace Rosen {
+
+class GEEffectCostModelTest : public testing::Test {
+public:
+    static void SetUpTestCase() {}
+    static void TearDownTestCase() {}
+    void SetUp() override
+    {
+        GEEffectCostModel::GetInstance().Reset();
+    }
+    void TearDown() override
+    {
+        GEEffectCostModel::GetInstance().Reset();
+    }
+};
+
+/**
+ * @tc.name: FirstSampleSeedsEstimate
+ * @tc.desc: Verify an unmeasured type reports 0 and the first sample becomes the estimate
+ * @tc.type: FUNC
+ */
+HWTEST_F(GEEffectCostModelTest, FirstSampleSeedsEstimate, TestSize.Level1)
+{
+    auto& model = GEEffectCostModel::GetInstance();
+    EXPECT_EQ(model.GetEstimateNs(Drawing::GEFilterType::KAWASE_BLUR), 0u);
+    model.Report(Drawing::GEFilterType::KAWASE_BLUR, 4000); // 4000 ns
+    EXPECT_EQ(model.GetEstimateNs(Drawing::GEFilterType::KAWASE_BLUR), 4000u);
+    EXPECT_EQ(model.GetEstimateNs(Drawing::GEFilterType::MESA_BLUR), 0u);
+}
+
+/**
+ * @tc.name: EstimateFollowsMovingAverage
+ * @tc.desc: Verify later samples are weighted 1/4 and a zero cost keeps the type measured
+ * @tc.type: FUNC
+ */
+HWTEST_F(GEEffectCostModelTest, EstimateFollowsMovingAverage, TestSize.Level1)
+{
+    auto& model = GEEffectCostModel::GetInstance();
+    model.Report(Drawing::GEFilterType::GREY, 4000); // 4000 ns
+    model.Report(Drawing::GEFilterType::GREY, 8000); // 8000 ns
+    EXPECT_EQ(model.GetEstimateNs(Drawing::GEFilterType::GREY), 5000u); // 4000 * 3 / 4 + 8000 / 4
+
+    model.Report(Drawing::GEFilterType::AIBAR, 0);
+    EXPECT_EQ(model.GetEstimateNs(Drawing::GEFilterType::AIBAR), 1u);
+}
+
+/**
+ * @tc.name: InvalidTypeIgnored
+ * @tc.desc: Verify out of range types are ignored and Reset clears the estimates
+ * @tc.type: FUNC
+ */
+HWTEST_F(GEEffectCostModelTest, InvalidTypeIgnored, TestSize.Level1)
+{
+    auto& model = GEEffectCostModel::GetInstance();
+    model.Report(Drawing::GEFilterType::MAX, 1000); // 1000 ns
+    EXPECT_EQ(model.GetEstimateNs(Drawing::GEFilterType::MAX), 0u);
+
+    model.Report(Drawing::GEFilterType::GREY, 1000); // 1000 ns
+    model.Reset();
+    EXPECT_EQ(model.GetEstimateNs(Drawing::GEFilterType::GREY), 0u);
+    EXPECT_GT(GEEffectCostModel::NowNs(), 0u);
+}
+
+/**
+ * @tc.name: EstimateScalesWithTexelReads
+ * @tc.desc: Verify the learned cost per texel read scales the estimate and unknown reads use the per type estimate
+ * @tc.type: FUNC
+ */
+HWTEST_F(GEEffectCostModelTest, EstimateScalesWithTexelReads, TestSize.Level1)
+{
+    auto& model = GEEffectCostModel::GetInstance();
+    EXPECT_EQ(model.GetEstimateNs(Drawing::GEFilterType::KAWASE_BLUR, 1000.0f), 0u); // 1000: texel reads
+
+    model.Report(Drawing::GEFilterType::KAWASE_BLUR, 4000, 1000.0f); // 4000 ns for 1000 texel reads
+    EXPECT_EQ(model.GetEstimateNs(Drawing::GEFilterType::KAWASE_BLUR), 4000u);
+    EXPECT_EQ(model.GetEstimateNs(Drawing::GEFilterType::KAWASE_BLUR, 2000.0f), 8000u); // 2000: twice the reads
+    EXPECT_EQ(model.GetEstimateNs(Drawing::GEFilterType::KAWASE_BLUR, 0.0f), 4000u);
+
+    model.Report(Drawing::GEFilterType::GREY, 4000, 0.0f); // 4000 ns, no predicted reads
+    EXPECT_EQ(model.GetEstimateNs(Drawing::GEFilterType::GREY, 1000.0f), 4000u); // 1000: texel reads
+    model.Reset();
+    EXPECT_EQ(model.GetEstimateNs(Drawing::GEFilterType::KAWASE_BLUR, 1000.0f), 0u); // 1000: texel reads
+}
+
+} // namespace Rosen
+} // namespace OHOS
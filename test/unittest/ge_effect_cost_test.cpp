@@ -0,0 +1,104 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+
+#include "ge_effect_cost.h"
+#include "ge_filter_params.h"
+#include "ge_params_reflection.h"
+
+using namespace testing;
+using namespace testing::ext;
+
+namespace OHOS {
+namespace Rosen {
+namespace Drawing {
+
+class GEEffectCostTest : public testing::Test {
+public:
+    static void SetUpTestCase() {}
+    static void TearDownTestCase() {}
+    void SetUp() override {}
+    void TearDown() override {}
+};
+
+/**
+ * @tc.name: CostMathHelpers
+ * @tc.desc: Verify the helpers of the cost expressions and the texel read estimate are usable at compile time
+ * @tc.type: FUNC
+ */
+HWTEST_F(GEEffectCostTest, CostMathHelpers, TestSize.Level1)
+{
+    static_assert(GEEffectCostMath::Ceil(2.1f) == 3.0f, "Ceil rounds up");
+    static_assert(GEEffectCostMath::Ceil(2.0f) == 2.0f, "Ceil keeps integers");
+    static_assert(GEEffectCostMath::Clamp(9.0f, 1.0f, 7.0f) == 7.0f, "Clamp to the upper bound");
+    constexpr GEEffectCost cost { 2.0f, 1.0f, 0.5f, 4.0f }; // 2 passes, radius 1, half resolution, 4 reads
+    static_assert(cost.EstimateTexelReads(6.0f, 2.0f) == 64.0f, "2 * 4 * (8 * 0.5) * (4 * 0.5)");
+    EXPECT_FLOAT_EQ(GEEffectCost {}.EstimateTexelReads(10.0f, 10.0f), 100.0f); // 10 x 10 output read once
+}
+
+/**
+ * @tc.name: KawaseCostFollowsRadius
+ * @tc.desc: Verify the Kawase model matches the pass count and down-sampling steps of the filter
+ * @tc.type: FUNC
+ */
+HWTEST_F(GEEffectCostTest, KawaseCostFollowsRadius, TestSize.Level1)
+{
+    static_assert(GEEffectCostEstimator<GEKawaseBlurShaderFilterParams>::HAS_MODEL, "Kawase has a cost model");
+    static_assert(!GEEffectCostEstimator<GEAIBarShaderFilterParams>::HAS_MODEL, "AIBar has no cost model");
+    static_assert(HasEffectCostModel(GEFilterType::KAWASE_BLUR) && !HasEffectCostModel(GEFilterType::AIBAR),
+        "HasEffectCostModel follows the annotations");
+
+    GEKawaseBlurShaderFilterParams params;
+    params.radius = 5; // 5: blur radius 20
+    auto cost = GEEffectCostEstimator<GEKawaseBlurShaderFilterParams>::Estimate(params);
+    EXPECT_FLOAT_EQ(cost.passes, 5.0f);          // 5: ceil(20 / 4.6)
+    EXPECT_FLOAT_EQ(cost.resolutionScale, 0.5f); // 0.5: base down-sampling
+    EXPECT_FLOAT_EQ(cost.readsPerPixel, 5.0f);   // 5: taps of the Kawase shader
+
+    params.radius = 120; // 120: blur radius 480
+    cost = GEEffectCostEstimator<GEKawaseBlurShaderFilterParams>::Estimate(params);
+    EXPECT_FLOAT_EQ(cost.passes, 7.0f);             // 7: MAX_PASSES_LARGE_RADIUS
+    EXPECT_FLOAT_EQ(cost.resolutionScale, 0.0625f); // 0.0625: down-sampling above blur radius 400
+}
+
+/**
+ * @tc.name: EstimateCostFromBoxedParams
+ * @tc.desc: Verify GEParamsBuilder::EstimateCost dispatches on the params type and returns nullopt without a model
+ * @tc.type: FUNC
+ */
+HWTEST_F(GEEffectCostTest, EstimateCostFromBoxedParams, TestSize.Level1)
+{
+    auto mesa = GEParamsBuilder::Build(GEFilterType::MESA_BLUR);
+    ASSERT_NE(mesa, nullptr);
+    auto mesaParams = GEFilterParams::Unbox<GEMESABlurShaderFilterParams>(*mesa);
+    ASSERT_NE(mesaParams, nullptr);
+    mesaParams->radius = 30; // 30: five passes at 1/8 resolution
+    mesaParams->isDirection = true;
+    auto cost = GEParamsBuilder::EstimateCost(*mesa);
+    ASSERT_TRUE(cost.has_value());
+    EXPECT_FLOAT_EQ(cost->passes, 5.0f);
+    EXPECT_FLOAT_EQ(cost->resolutionScale, 0.125f);
+    EXPECT_FLOAT_EQ(cost->readsPerPixel, 2.0f); // 2: direction blur taps
+    EXPECT_FLOAT_EQ(cost->readRadius, 30.0f);
+
+    auto aibar = GEParamsBuilder::Build(GEFilterType::AIBAR);
+    ASSERT_NE(aibar, nullptr);
+    EXPECT_FALSE(GEParamsBuilder::EstimateCost(*aibar).has_value());
+}
+
+} // namespace Drawing
+} // namespace Rosen
+} // namespace OHOS
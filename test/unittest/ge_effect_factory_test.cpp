@@ -310,5 +310,46 @@ HWTEST_F(GEEffectFactoryTest, VerifyRegistrationCoverage_001, TestSize.Level1)
     }
 }
 
+/**
+ * @tc.name: GetDegradeOptions_001
+ * @tc.desc: Verify degradation options declared at registration and the default for other types
+ * @tc.type:FUNC
+ */
+HWTEST_F(GEEffectFactoryTest, GetDegradeOptions_001, TestSize.Level1)
+{
+    EXPECT_EQ(GEEffectFactory::GetDegradeOptions(GEFilterType::KAWASE_BLUR), GEEffectFactory::DEGRADE_REUSE_OUTPUT);
+    EXPECT_NE(GEEffectFactory::GetDegradeOptions(GEFilterType::EDGE_LIGHT) & GEEffectFactory::DEGRADE_SKIP, 0u);
+    EXPECT_EQ(GEEffectFactory::GetDegradeOptions(GEFilterType::GREY), GEEffectFactory::DEGRADE_NONE);
+    EXPECT_EQ(GEEffectFactory::GetDegradeOptions(GEFilterType::MAX), GEEffectFactory::DEGRADE_NONE);
+}
+
+/**
+ * @tc.name: GetMemoOptions_001
+ * @tc.desc: Verify only stateless filters opt in to output memoization
+ * @tc.type:FUNC
+ */
+HWTEST_F(GEEffectFactoryTest, GetMemoOptions_001, TestSize.Level1)
+{
+    EXPECT_EQ(GEEffectFactory::GetMemoOptions(GEFilterType::KAWASE_BLUR), GEEffectFactory::MEMO_OUTPUT);
+    EXPECT_EQ(GEEffectFactory::GetMemoOptions(GEFilterType::MOTION_BLUR), GEEffectFactory::MEMO_NONE);
+    EXPECT_EQ(GEEffectFactory::GetMemoOptions(GEFilterType::FROSTED_GLASS_BLUR), GEEffectFactory::MEMO_NONE);
+    EXPECT_EQ(GEEffectFactory::GetMemoOptions(GEFilterType::MAX), GEEffectFactory::MEMO_NONE);
+    GEEffectFactory::RegisterMemoOptions(GEFilterType::NONE, GEEffectFactory::MEMO_OUTPUT);
+    EXPECT_EQ(GEEffectFactory::GetMemoOptions(GEFilterType::NONE), GEEffectFactory::MEMO_NONE);
+}
+
+/**
+ * @tc.name: RegisterDegradeOptions_001
+ * @tc.desc: Verify NONE and out of range types are ignored
+ * @tc.type:FUNC
+ */
+HWTEST_F(GEEffectFactoryTest, RegisterDegradeOptions_001, TestSize.Level1)
+{
+    GEEffectFactory::RegisterDegradeOptions(GEFilterType::NONE, GEEffectFactory::DEGRADE_SKIP);
+    EXPECT_EQ(GEEffectFactory::GetDegradeOptions(GEFilterType::NONE), GEEffectFactory::DEGRADE_NONE);
+    GEEffectFactory::RegisterDegradeOptions(GEFilterType::MAX, GEEffectFactory::DEGRADE_SKIP);
+    EXPECT_EQ(GEEffectFactory::GetDegradeOptions(GEFilterType::MAX), GEEffectFactory::DEGRADE_NONE);
+}
+
 } // namespace GraphicsEffectEngine
 } // namespace OHOS
\ No newline at end of file
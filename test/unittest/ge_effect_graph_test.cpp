@@ -0,0 +1,233 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+#include <memory>
+#include <vector>
+
+#include "ge_effect_graph.h"
+#include "ge_render.h"
+#include "ge_visual_effect_impl.h"
+
+using namespace testing;
+using namespace testing::ext;
+
+namespace OHOS {
+namespace Rosen {
+
+using Drawing::GEParamsMemberTag;
+using NodeId = GEEffectGraph::NodeId;
+
+class GEEffectGraphTest : public testing::Test {
+public:
+    void SetUp() override
+    {
+        Drawing::Bitmap bmp;
+        Drawing::BitmapFormat format { Drawing::COLORTYPE_RGBA_8888, Drawing::ALPHATYPE_PREMUL };
+        bmp.Build(50, 50, format);
+        bmp.ClearWithColor(Drawing::Color::COLOR_BLUE);
+        image_ = bmp.MakeImage();
+    }
+
+    static std::shared_ptr<Drawing::GEVisualEffect> CreateEffect(const std::string& name)
+    {
+        return std::make_shared<Drawing::GEVisualEffect>(name, Drawing::DrawingPaintType::BRUSH);
+    }
+
+    Drawing::Canvas canvasNoGpu_;
+    std::shared_ptr<Drawing::Image> image_ { nullptr };
+    Drawing::Rect src_ { 0.0f, 0.0f, 50.0f, 50.0f };
+    Drawing::Rect dst_ { 0.0f, 0.0f, 50.0f, 50.0f };
+};
+
+/**
+ * @tc.name: AddNodeRejectsInvalidArguments
+ * @tc.desc: Null effects and unknown primary inputs are rejected
+ * @tc.type: FUNC
+ */
+HWTEST_F(GEEffectGraphTest, AddNodeRejectsInvalidArguments, TestSize.Level1)
+{
+    GEEffectGraph graph;
+    EXPECT_EQ(graph.AddNode(nullptr), GEEffectGraph::INVALID_NODE);
+    EXPECT_EQ(graph.AddNode(CreateEffect(Drawing::GE_FILTER_GREY), 5), GEEffectGraph::INVALID_NODE);
+    EXPECT_EQ(graph.GetNodeCount(), 0);
+    EXPECT_EQ(graph.GetNode(GEEffectGraph::SOURCE), nullptr);
+}
+
+/**
+ * @tc.name: AddInputValidatesTag
+ * @tc.desc: Named inputs must use a param tag of the consuming effect
+ * @tc.type: FUNC
+ */
+HWTEST_F(GEEffectGraphTest, AddInputValidatesTag, TestSize.Level1)
+{
+    GEEffectGraph graph;
+    const NodeId blur = graph.AddNode(CreateEffect(Drawing::GE_FILTER_KAWASE_BLUR));
+    const NodeId bubbles = graph.AddNode(CreateEffect(Drawing::GE_FILTER_BLUR_BUBBLES_RISE));
+    EXPECT_FALSE(graph.AddInput(blur, bubbles, GEParamsMemberTag::BLUR_BUBBLES_RISE_MASK_IMAGE));
+    EXPECT_FALSE(graph.AddInput(bubbles, blur, GEParamsMemberTag::INVALID));
+    EXPECT_FALSE(graph.AddInput(bubbles, bubbles, GEParamsMemberTag::BLUR_BUBBLES_RISE_MASK_IMAGE));
+    EXPECT_FALSE(graph.AddInput(GEEffectGraph::SOURCE, blur, GEParamsMemberTag::BLUR_BUBBLES_RISE_MASK_IMAGE));
+    EXPECT_TRUE(graph.AddInput(bubbles, blur, GEParamsMemberTag::BLUR_BUBBLES_RISE_MASK_IMAGE));
+    EXPECT_TRUE(graph.AddInput(bubbles, blur, std::string(Drawing::GE_FILTER_BLUR_BUBBLES_RISE_MASK_IMAGE)));
+    ASSERT_NE(graph.GetNode(bubbles), nullptr);
+    EXPECT_EQ(graph.GetNode(bubbles)->namedInputs.size(), 2);
+}
+
+/**
+ * @tc.name: FromChainKeepsChainOrder
+ * @tc.desc: A graph built from a linear chain executes in chain order and releases each image after its consumer
+ * @tc.type: FUNC
+ */
+HWTEST_F(GEEffectGraphTest, FromChainKeepsChainOrder, TestSize.Level1)
+{
+    auto graph = GEEffectGraph::FromChain({ CreateEffect(Drawing::GE_FILTER_GREY),
+        CreateEffect(Drawing::GE_FILTER_KAWASE_BLUR), CreateEffect(Drawing::GE_FILTER_GREY) });
+    EXPECT_EQ(graph.GetOutput(), 3);
+    auto schedule = graph.BuildSchedule();
+    ASSERT_TRUE(schedule.has_value());
+    EXPECT_EQ(schedule->order, (std::vector<NodeId> { 1, 2, 3 }));
+    EXPECT_EQ(schedule->releaseAfter[0], (std::vector<NodeId> { GEEffectGraph::SOURCE }));
+    EXPECT_EQ(schedule->releaseAfter[1], (std::vector<NodeId> { 1 }));
+    EXPECT_EQ(schedule->releaseAfter[2], (std::vector<NodeId> { 2 }));
+    EXPECT_EQ(schedule->peakLiveIntermediates, 2);
+}
+
+/**
+ * @tc.name: EmptyChainOutputsSource
+ * @tc.desc: An empty chain has an empty schedule whose output is the source
+ * @tc.type: FUNC
+ */
+HWTEST_F(GEEffectGraphTest, EmptyChainOutputsSource, TestSize.Level1)
+{
+    auto graph = GEEffectGraph::FromChain({});
+    EXPECT_EQ(graph.GetOutput(), GEEffectGraph::SOURCE);
+    auto schedule = graph.BuildSchedule();
+    ASSERT_TRUE(schedule.has_value());
+    EXPECT_TRUE(schedule->order.empty());
+}
+
+/**
+ * @tc.name: FanOutComputesSharedNodeOnce
+ * @tc.desc: A node consumed by two nodes is scheduled once and released after its last consumer
+ * @tc.type: FUNC
+ */
+HWTEST_F(GEEffectGraphTest, FanOutComputesSharedNodeOnce, TestSize.Level1)
+{
+    GEEffectGraph graph;
+    const NodeId blur = graph.AddNode(CreateEffect(Drawing::GE_FILTER_KAWASE_BLUR));
+    const NodeId grey = graph.AddNode(CreateEffect(Drawing::GE_FILTER_GREY), blur);
+    const NodeId bubbles = graph.AddNode(CreateEffect(Drawing::GE_FILTER_BLUR_BUBBLES_RISE), grey);
+    ASSERT_TRUE(graph.AddInput(bubbles, blur, GEParamsMemberTag::BLUR_BUBBLES_RISE_MASK_IMAGE));
+    ASSERT_TRUE(graph.SetOutput(bubbles));
+
+    auto schedule = graph.BuildSchedule();
+    ASSERT_TRUE(schedule.has_value());
+    EXPECT_EQ(schedule->order, (std::vector<NodeId> { blur, grey, bubbles }));
+    EXPECT_EQ(schedule->releaseAfter[1], (std::vector<NodeId> {}));
+    EXPECT_EQ(schedule->releaseAfter[2], (std::vector<NodeId> { grey, blur }));
+    EXPECT_EQ(schedule->peakLiveIntermediates, 3);
+}
+
+/**
+ * @tc.name: UnusedNodesArePruned
+ * @tc.desc: Nodes reaching neither the output nor an export are not scheduled
+ * @tc.type: FUNC
+ */
+HWTEST_F(GEEffectGraphTest, UnusedNodesArePruned, TestSize.Level1)
+{
+    GEEffectGraph graph;
+    graph.AddNode(CreateEffect(Drawing::GE_FILTER_KAWASE_BLUR));
+    const NodeId grey = graph.AddNode(CreateEffect(Drawing::GE_FILTER_GREY));
+    EXPECT_FALSE(graph.BuildSchedule().has_value()); // no output yet
+    ASSERT_TRUE(graph.SetOutput(grey));
+    auto schedule = graph.BuildSchedule();
+    ASSERT_TRUE(schedule.has_value());
+    EXPECT_EQ(schedule->order, (std::vector<NodeId> { grey }));
+}
+
+/**
+ * @tc.name: CycleIsRejected
+ * @tc.desc: BuildSchedule fails on cyclic graphs
+ * @tc.type: FUNC
+ */
+HWTEST_F(GEEffectGraphTest, CycleIsRejected, TestSize.Level1)
+{
+    GEEffectGraph graph;
+    const NodeId first = graph.AddNode(CreateEffect(Drawing::GE_FILTER_BLUR_BUBBLES_RISE));
+    const NodeId second = graph.AddNode(CreateEffect(Drawing::GE_FILTER_GREY), first);
+    ASSERT_TRUE(graph.AddInput(first, second, GEParamsMemberTag::BLUR_BUBBLES_RISE_MASK_IMAGE));
+    ASSERT_TRUE(graph.SetOutput(second));
+    EXPECT_FALSE(graph.BuildSchedule().has_value());
+}
+
+/**
+ * @tc.name: ExportKeepsNodeLive
+ * @tc.desc: Exported nodes are scheduled without being the output and released right after execution
+ * @tc.type: FUNC
+ */
+HWTEST_F(GEEffectGraphTest, ExportKeepsNodeLive, TestSize.Level1)
+{
+    GEEffectGraph graph;
+    auto glass = CreateEffect(Drawing::GE_SHADER_FROSTED_GLASS_EFFECT);
+    const NodeId blur = graph.AddNode(CreateEffect(Drawing::GE_FILTER_KAWASE_BLUR));
+    EXPECT_FALSE(graph.ExportTo(blur, glass, GEParamsMemberTag::BLUR_BUBBLES_RISE_MASK_IMAGE));
+    EXPECT_FALSE(graph.ExportTo(GEEffectGraph::SOURCE, glass, GEParamsMemberTag::FROSTED_GLASS_EFFECT_BLUR_IMAGE));
+    ASSERT_TRUE(graph.ExportTo(blur, glass, GEParamsMemberTag::FROSTED_GLASS_EFFECT_BLUR_IMAGE));
+    auto schedule = graph.BuildSchedule();
+    ASSERT_TRUE(schedule.has_value());
+    EXPECT_EQ(schedule->order, (std::vector<NodeId> { blur }));
+    EXPECT_EQ(schedule->releaseAfter[0], (std::vector<NodeId> { GEEffectGraph::SOURCE, blur }));
+}
+
+/**
+ * @tc.name: ApplyEffectGraphNullImage
+ * @tc.desc: GERender::ApplyEffectGraph returns an empty result for a null image
+ * @tc.type: FUNC
+ */
+HWTEST_F(GEEffectGraphTest, ApplyEffectGraphNullImage, TestSize.Level1)
+{
+    auto graph = GEEffectGraph::FromChain({ CreateEffect(Drawing::GE_FILTER_GREY) });
+    GraphicsEffectEngine::GERender render;
+    auto result = render.ApplyEffectGraph(canvasNoGpu_, graph, { nullptr, src_, dst_, nullptr });
+    EXPECT_EQ(result.image, nullptr);
+    EXPECT_EQ(result.executedNodes, 0);
+}
+
+/**
+ * @tc.name: ApplyEffectGraphBindsExports
+ * @tc.desc: GERender::ApplyEffectGraph executes each live node once and hands exported images to the caller
+ * @tc.type: FUNC
+ */
+HWTEST_F(GEEffectGraphTest, ApplyEffectGraphBindsExports, TestSize.Level1)
+{
+    GEEffectGraph graph;
+    auto glass = CreateEffect(Drawing::GE_SHADER_FROSTED_GLASS_EFFECT);
+    const NodeId grey = graph.AddNode(CreateEffect(Drawing::GE_FILTER_GREY));
+    ASSERT_TRUE(graph.ExportTo(grey, glass, GEParamsMemberTag::FROSTED_GLASS_EFFECT_BLUR_IMAGE));
+    ASSERT_TRUE(graph.SetOutput(grey));
+
+    GraphicsEffectEngine::GERender render;
+    auto result = render.ApplyEffectGraph(canvasNoGpu_, graph, { image_, src_, dst_, nullptr });
+    EXPECT_EQ(result.executedNodes, 1);
+    ASSERT_EQ(result.exportedImages.size(), 1);
+    EXPECT_EQ(result.exportedImages[0], result.image);
+    auto glassParams = glass->GetImpl()->GetFrostedGlassEffectParams();
+    ASSERT_NE(glassParams, nullptr);
+    EXPECT_EQ(glassParams->blurImage.lock(), result.image);
+}
+
+} // namespace Rosen
+} // namespace OHOS
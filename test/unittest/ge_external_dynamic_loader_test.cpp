@@ -13,6 +13,7 @@
  * limitations under the License.
  */
 #include "ge_external_dynamic_loader.h"
+#include "ge_feature_flags.h"
 #include "ge_mesa_blur_shader_filter.h"
 #include "ge_visual_effect_impl.h"
 
@@ -31,6 +32,7 @@ const std::string GRAPHICS_EFFECT_EXT_LIB_PATH = "/system/lib64/libgraphics_effe
 const std::string GRAPHICS_EFFECT_EXT_LIB_PATH = "/system/lib/libgraphics_effect_ext.z.so";
 #endif
 }
+
 class GEExternalDynamicLoaderTest : public testing::Test {
 public:
     static void SetUpTestCase();
@@ -47,10 +49,12 @@ void GEExternalDynamicLoaderTest::TearDownTestCase(void) {}
 void GEExternalDynamicLoaderTest::SetUp()
 {
     testLoader_ = &GEExternalDynamicLoader::GetInstance();
+    testLoader_->Preload();
 }
 
 void GEExternalDynamicLoaderTest::TearDown()
 {
+    GEFeatureFlags::GetInstance().ClearOverrides();
     testLoader_ = nullptr;
 }
 
@@ -131,5 +135,23 @@ HWTEST_F(GEExternalDynamicLoaderTest, GetInstance_Singleton, TestSize.Level1)
     EXPECT_EQ(&instance1, &instance2);
 }
 
+/**
+ * @tc.name: PreloadAsync_Loaded
+ * @tc.desc: Verify PreloadAsync after loading is harmless and the loader reports it is loaded
+ * @tc.type: FUNC
+ */
+HWTEST_F(GEExternalDynamicLoaderTest, PreloadAsync_Loaded, TestSize.Level1)
+{
+    testLoader_->PreloadAsync();
+    testLoader_->Preload();
+    EXPECT_TRUE(testLoader_->IsLoaded());
+    if (testLoader_->createObjectFunc_ == nullptr) {
+        auto mesaBlurParam = Drawing::GEMESABlurShaderFilterParams();
+        auto object = testLoader_->CreateGEXObject<Drawing::IGEFilterType>(
+            static_cast<uint32_t>(Drawing::GEFilterType::MESA_BLUR), mesaBlurParam);
+        EXPECT_EQ(object, nullptr);
+    }
+}
+
 } // namespace Rosen
 } // namespace OHOS
\ No newline at end of file
@@ -0,0 +1,100 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+
+#include <string>
+
+#include "ge_cache_helper.h"
+#include "ge_feature_flags.h"
+
+using namespace testing;
+using namespace testing::ext;
+
+namespace OHOS {
+namespace Rosen {
+
+class GEFeatureFlagsTest : public testing::Test {
+public:
+    static void SetUpTestCase() {}
+    static void TearDownTestCase() {}
+    void SetUp() override {}
+    void TearDown() override
+    {
+        GEFeatureFlags::GetInstance().ClearOverrides();
+    }
+};
+
+/**
+ * @tc.name: FlagInfos
+ * @tc.desc: Verify every flag has a property name and the documented defaults
+ * @tc.type: FUNC
+ */
+HWTEST_F(GEFeatureFlagsTest, FlagInfos, TestSize.Level1)
+{
+    for (size_t i = 0; i < GEFeatureFlags::FLAG_COUNT; ++i) {
+        EXPECT_FALSE(std::string(GEFeatureFlags::GetPropertyName(static_cast<GEFeatureFlag>(i))).empty());
+    }
+    EXPECT_EQ(std::string(GEFeatureFlags::GetPropertyName(GEFeatureFlag::COUNT)), "");
+    EXPECT_EQ(GEFeatureFlags::GetDefaultValue(GEFeatureFlag::SDF_CACHE), -1);
+    EXPECT_EQ(GEFeatureFlags::GetDefaultValue(GEFeatureFlag::EXTERNAL_EFFECT), 1);
+    EXPECT_EQ(GEFeatureFlags::GetDefaultValue(GEFeatureFlag::KAWASE_ORIGINAL_IMAGE), 0);
+}
+
+/**
+ * @tc.name: OverridePublishesSnapshot
+ * @tc.desc: Verify an override publishes a new snapshot and the replaced snapshot stays readable
+ * @tc.type: FUNC
+ */
+HWTEST_F(GEFeatureFlagsTest, OverridePublishesSnapshot, TestSize.Level1)
+{
+    auto& flags = GEFeatureFlags::GetInstance();
+    const auto& before = flags.GetSnapshot();
+    const int32_t value = before.Get(GEFeatureFlag::BLUR_EXTRA_FILTER);
+
+    flags.SetOverride(GEFeatureFlag::BLUR_EXTRA_FILTER, value + 1);
+    const auto& after = flags.GetSnapshot();
+    EXPECT_EQ(after.version, before.version + 1);
+    EXPECT_EQ(flags.GetInt(GEFeatureFlag::BLUR_EXTRA_FILTER), value + 1);
+    EXPECT_EQ(before.Get(GEFeatureFlag::BLUR_EXTRA_FILTER), value);
+
+    // Same value again publishes nothing
+    flags.SetOverride(GEFeatureFlag::BLUR_EXTRA_FILTER, value + 1);
+    EXPECT_EQ(&flags.GetSnapshot(), &after);
+
+    flags.ClearOverrides();
+    EXPECT_EQ(flags.GetInt(GEFeatureFlag::BLUR_EXTRA_FILTER), value);
+    EXPECT_FALSE(flags.Refresh());
+}
+
+/**
+ * @tc.name: SDFCacheFollowsFlag
+ * @tc.desc: Verify IsSDFCacheEnabled reads the SDF cache flag, -1 keeping the caller default
+ * @tc.type: FUNC
+ */
+HWTEST_F(GEFeatureFlagsTest, SDFCacheFollowsFlag, TestSize.Level1)
+{
+    auto& flags = GEFeatureFlags::GetInstance();
+    flags.SetOverride(GEFeatureFlag::SDF_CACHE, -1);
+    EXPECT_TRUE(GECacheHelper::IsSDFCacheEnabled(true));
+    EXPECT_FALSE(GECacheHelper::IsSDFCacheEnabled(false));
+    flags.SetOverride(GEFeatureFlag::SDF_CACHE, 0);
+    EXPECT_FALSE(GECacheHelper::IsSDFCacheEnabled(true));
+    flags.SetOverride(GEFeatureFlag::SDF_CACHE, 1);
+    EXPECT_TRUE(GECacheHelper::IsSDFCacheEnabled(false));
+}
+
+} // namespace Rosen
+} // namespace OHOS
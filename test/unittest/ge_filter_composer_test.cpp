@@ -22,10 +22,12 @@
 #include "ge_filter_type.h"
 #include "ge_filter_type_info.h"
 #include "ge_direct_draw_on_canvas_pass.h"
+#include "ge_feature_flags.h"
 #include "ge_hps_build_pass.h"
 #include "ge_hps_upscale_pass.h"
 #include "ge_mesa_fusion_pass.h"
 #include "ge_render.h"
+#include "ge_shader_composition_pass.h"
 #include "ge_visual_effect_impl.h"
 
 using namespace testing;
@@ -682,5 +684,65 @@ HWTEST_F(GEFilterComposerTest, HpsUpscalePassRunHpsEffectWithGEAfter, TestSize.L
     GTEST_LOG_(INFO) << "GEFilterComposerTest HpsUpscalePassRunHpsEffectWithGEAfter end";
 }
 
+/**
+ * @tc.name: ShaderCompositionPassRunComposesRun
+ * @tc.desc: Adjacent composable effects are merged into the first one, other effects keep their place
+ * @tc.type: FUNC
+ */
+HWTEST_F(GEFilterComposerTest, ShaderCompositionPassRunComposesRun, TestSize.Level1)
+{
+    GEShaderCompositionPass pass;
+    EXPECT_EQ(pass.GetLogName(), "GEShaderCompositionPass");
+
+    auto greyEffect = CreateGreyEffect();
+    auto aiBarEffect = CreateVisualEffect(Drawing::GE_FILTER_AI_BAR);
+    std::vector<GEFilterComposable> composables { greyEffect, aiBarEffect, CreateKawaseBlurEffect(),
+        CreateGreyEffect() };
+    auto result = pass.Run(composables);
+    EXPECT_TRUE(result.changed);
+    ASSERT_EQ(composables.size(), 3); // 3: the run, the blur and the grey left alone
+    auto composed = ShaderCompositionFlag::GetComposedEffects(composables[0]);
+    ASSERT_NE(composed, nullptr);
+    ASSERT_EQ(composed->size(), 2); // 2: grey and aibar
+    EXPECT_EQ(composed->front(), greyEffect);
+    EXPECT_EQ(composed->back(), aiBarEffect);
+    EXPECT_EQ(ShaderCompositionFlag::GetComposedEffects(composables[1]), nullptr);
+    EXPECT_EQ(ShaderCompositionFlag::GetComposedEffects(composables[2]), nullptr); // 2: single grey
+}
+
+/**
+ * @tc.name: ShaderCompositionPassRunLimits
+ * @tc.desc: Runs stop at MAX_RUN_LENGTH, dispersion only starts a run, nothing merges while the flag is disabled
+ * @tc.type: FUNC
+ */
+HWTEST_F(GEFilterComposerTest, ShaderCompositionPassRunLimits, TestSize.Level1)
+{
+    GEShaderCompositionPass pass;
+    std::vector<GEFilterComposable> greys;
+    for (size_t i = 0; i <= GEShaderCompositionPass::MAX_RUN_LENGTH; ++i) {
+        greys.push_back(CreateGreyEffect());
+    }
+    EXPECT_TRUE(pass.Run(greys).changed);
+    ASSERT_EQ(greys.size(), 2); // 2: a full run and the grey after it
+    auto composed = ShaderCompositionFlag::GetComposedEffects(greys[0]);
+    ASSERT_NE(composed, nullptr);
+    EXPECT_EQ(composed->size(), GEShaderCompositionPass::MAX_RUN_LENGTH);
+
+    std::vector<GEFilterComposable> greyDispersion { CreateGreyEffect(),
+        CreateVisualEffect(Drawing::GE_FILTER_DISPERSION) };
+    EXPECT_FALSE(pass.Run(greyDispersion).changed);
+    EXPECT_EQ(greyDispersion.size(), 2); // 2: nothing merged
+
+    std::vector<GEFilterComposable> dispersionGrey { CreateVisualEffect(Drawing::GE_FILTER_DISPERSION),
+        CreateGreyEffect() };
+    EXPECT_TRUE(pass.Run(dispersionGrey).changed);
+    EXPECT_EQ(dispersionGrey.size(), 1);
+
+    GEFeatureFlags::GetInstance().SetOverride(GEFeatureFlag::SHADER_COMPOSITION, 0);
+    std::vector<GEFilterComposable> disabled { CreateGreyEffect(), CreateGreyEffect() };
+    EXPECT_FALSE(pass.Run(disabled).changed);
+    EXPECT_EQ(disabled.size(), 2); // 2: nothing merged
+    GEFeatureFlags::GetInstance().ClearOverrides();
+}
 } // namespace Rosen
 } // namespace OHOS
\ No newline at end of file
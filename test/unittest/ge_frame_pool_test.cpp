@@ -0,0 +1,153 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <vector>
+
+#include "ge_frame_pool.h"
+
+using namespace testing;
+using namespace testing::ext;
+
+namespace OHOS {
+namespace Rosen {
+namespace {
+struct PooledObject : public GEFramePoolObject {
+    uint8_t payload[100] = {}; // 100: served by the 128 byte class
+};
+} // namespace
+
+class GEFramePoolTest : public testing::Test {
+public:
+    static void SetUpTestCase() {}
+    static void TearDownTestCase() {}
+    void SetUp() override
+    {
+        GEFramePool::GetInstance().SetEnabled(true);
+    }
+    void TearDown() override
+    {
+        GEFramePool::GetInstance().SetEnabled(true);
+        GEFramePool::GetInstance().EndFrame();
+    }
+};
+
+/**
+ * @tc.name: GetSizeClass
+ * @tc.desc: Verify sizes map to the smallest class holding them and large sizes fall outside the pool
+ * @tc.type: FUNC
+ */
+HWTEST_F(GEFramePoolTest, GetSizeClass, TestSize.Level1)
+{
+    EXPECT_EQ(GEFramePool::GetSizeClass(1), 0u);
+    EXPECT_EQ(GEFramePool::GetSizeClass(32), 0u);  // 32: MIN_BLOCK_SIZE
+    EXPECT_EQ(GEFramePool::GetSizeClass(33), 1u);  // 33: just above the 32 byte class
+    EXPECT_EQ(GEFramePool::GetSizeClass(200), 3u); // 200: 256 byte class, index 3
+    EXPECT_EQ(GEFramePool::GetSizeClass(GEFramePool::MAX_BLOCK_SIZE), GEFramePool::SIZE_CLASS_COUNT - 1);
+    EXPECT_EQ(GEFramePool::GetSizeClass(GEFramePool::MAX_BLOCK_SIZE + 1), GEFramePool::SIZE_CLASS_COUNT);
+}
+
+/**
+ * @tc.name: ReuseFreedBlock
+ * @tc.desc: Verify a freed block serves the next allocation of its class and bytes in use follow the blocks
+ * @tc.type: FUNC
+ */
+HWTEST_F(GEFramePoolTest, ReuseFreedBlock, TestSize.Level1)
+{
+    auto& pool = GEFramePool::GetInstance();
+    auto before = pool.GetStats();
+    void* first = pool.Allocate(100); // 100: served by the 128 byte class
+    ASSERT_NE(first, nullptr);
+    EXPECT_EQ(pool.GetStats().bytesInUse, before.bytesInUse + 128); // 128: class size
+    pool.Deallocate(first, 100); // 100: size passed to Allocate
+    EXPECT_EQ(pool.GetStats().bytesInUse, before.bytesInUse);
+
+    void* second = pool.Allocate(120); // 120: same class as 100
+    EXPECT_EQ(second, first);
+    auto after = pool.GetStats();
+    EXPECT_EQ(after.allocations, before.allocations + 2); // 2: allocations made
+    EXPECT_EQ(after.reuses, before.reuses + 1);
+    EXPECT_GE(after.peakBytesInUse, before.bytesInUse + 128); // 128: class size
+    pool.Deallocate(second, 120); // 120: size passed to Allocate
+
+    // Objects deriving GEFramePoolObject and shared objects from the allocator take the same path
+    auto object = std::make_unique<PooledObject>();
+    object.reset();
+    auto shared = std::allocate_shared<std::vector<int>>(GEFramePoolAllocator<std::vector<int>>(), 4, 1);
+    ASSERT_NE(shared, nullptr);
+    EXPECT_EQ(shared->size(), 4u); // 4: elements constructed
+    shared.reset();
+    EXPECT_EQ(pool.GetStats().bytesInUse, before.bytesInUse);
+    EXPECT_GT(pool.GetStats().reuses, after.reuses);
+}
+
+/**
+ * @tc.name: LargeAndDisabledGoToHeap
+ * @tc.desc: Verify large blocks and blocks freed while disabled are not kept in the free lists
+ * @tc.type: FUNC
+ */
+HWTEST_F(GEFramePoolTest, LargeAndDisabledGoToHeap, TestSize.Level1)
+{
+    auto& pool = GEFramePool::GetInstance();
+    pool.EndFrame();
+    uint32_t freeBlocks = pool.GetFreeBlockCount();
+    void* large = pool.Allocate(GEFramePool::MAX_BLOCK_SIZE * 4); // 4: far above the largest class
+    ASSERT_NE(large, nullptr);
+    pool.Deallocate(large, GEFramePool::MAX_BLOCK_SIZE * 4); // 4: size passed to Allocate
+    EXPECT_EQ(pool.GetFreeBlockCount(), freeBlocks);
+
+    pool.SetEnabled(false);
+    auto before = pool.GetStats();
+    void* block = pool.Allocate(40); // 40: 64 byte class
+    ASSERT_NE(block, nullptr);
+    EXPECT_EQ(pool.GetStats().reuses, before.reuses);
+    pool.SetEnabled(true);
+    // Allocated at class size while disabled, so it can be reused by any size of its class once enabled
+    pool.Deallocate(block, 40); // 40: size passed to Allocate
+    EXPECT_EQ(pool.GetFreeBlockCount(), freeBlocks + 1);
+    void* reused = pool.Allocate(64); // 64: full size of the class
+    EXPECT_EQ(reused, block);
+    static_cast<uint8_t*>(reused)[63] = 1; // 63: last byte of the block
+    pool.Deallocate(reused, 64); // 64: size passed to Allocate
+}
+
+/**
+ * @tc.name: EndFrameTrimsFreeLists
+ * @tc.desc: Verify EndFrame keeps at most RETAINED_FREE_BLOCKS per class and restarts the frame counter
+ * @tc.type: FUNC
+ */
+HWTEST_F(GEFramePoolTest, EndFrameTrimsFreeLists, TestSize.Level1)
+{
+    auto& pool = GEFramePool::GetInstance();
+    constexpr uint32_t count = GEFramePool::RETAINED_FREE_BLOCKS * 2; // 2: twice the retained blocks
+    std::vector<void*> blocks;
+    for (uint32_t i = 0; i < count; ++i) {
+        blocks.push_back(pool.Allocate(GEFramePool::MIN_BLOCK_SIZE));
+    }
+    EXPECT_GE(pool.GetStats().frameAllocations, count);
+    for (void* block : blocks) {
+        pool.Deallocate(block, GEFramePool::MIN_BLOCK_SIZE);
+    }
+    EXPECT_GE(pool.GetFreeBlockCount(), count);
+
+    pool.EndFrame();
+    EXPECT_LE(pool.GetFreeBlockCount(), GEFramePool::RETAINED_FREE_BLOCKS * GEFramePool::SIZE_CLASS_COUNT);
+    EXPECT_EQ(pool.GetStats().frameAllocations, 0u);
+}
+
+} // namespace Rosen
+} // namespace OHOS
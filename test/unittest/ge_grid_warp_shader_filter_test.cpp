@@ -65,14 +65,16 @@ void GEGridWarpShaderFilterTest::TearDown()
 
 /**
  * @tc.name: OnProcessImage_001
- * @tc.desc: Verify the OnProcessImage: image is nullptr
+ * @tc.desc: Verify the OnProcessImage: null image, and raster canvases drawn without a surface
  * @tc.type: FUNC
  */
 HWTEST_F(GEGridWarpShaderFilterTest, OnProcessImage_001, TestSize.Level0)
 {
     Drawing::GEGridWarpShaderFilterParams geGridWarpShaderFilterParams;
     auto geGridWarpShaderFilter = std::make_unique<GEGridWarpShaderFilter>(geGridWarpShaderFilterParams);
-    EXPECT_EQ(geGridWarpShaderFilter->OnProcessImage(canvas_, image_, src_, dst_), nullptr);
+    EXPECT_EQ(geGridWarpShaderFilter->OnProcessImage(canvas_, nullptr, src_, dst_), nullptr);
+    // canvas_ has no surface, the warp mesh rasterizer does not need one
+    EXPECT_NE(geGridWarpShaderFilter->OnProcessImage(canvas_, image_, src_, dst_), nullptr);
 }
 
 /**
@@ -0,0 +1,238 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+
+#include "draw/surface.h"
+#include "image/bitmap.h"
+
+#include "ge_hps_cpu_backend.h"
+#include "ge_hps_effect_filter.h"
+#include "ge_render.h"
+
+using namespace testing;
+using namespace testing::ext;
+
+namespace OHOS {
+namespace Rosen {
+
+class GEHpsCpuBackendTest : public testing::Test {
+public:
+    static void SetUpTestCase() {}
+    static void TearDownTestCase() {}
+    void SetUp() override;
+    void TearDown() override;
+
+    static std::shared_ptr<Drawing::Image> MakeImage();
+    static GEHpsCpuBackend::PixelBuffer MakeBuffer(int width, int height, float value);
+
+    std::shared_ptr<Drawing::Surface> surface_ = nullptr;
+};
+
+void GEHpsCpuBackendTest::SetUp()
+{
+    HpsEffectFilter::UnitTestSetExtensionProperties({});
+    HpsEffectFilter::SetBackend(std::make_shared<GEHpsCpuBackend>());
+    surface_ = Drawing::Surface::MakeRasterN32Premul(50, 50); // 50, 50 surface size
+    ASSERT_NE(surface_, nullptr);
+}
+
+void GEHpsCpuBackendTest::TearDown()
+{
+    HpsEffectFilter::SetBackend(nullptr);
+    HpsEffectFilter::UnitTestSetExtensionProperties({});
+}
+
+std::shared_ptr<Drawing::Image> GEHpsCpuBackendTest::MakeImage()
+{
+    Drawing::Bitmap bmp;
+    Drawing::BitmapFormat format { Drawing::COLORTYPE_RGBA_8888, Drawing::ALPHATYPE_PREMUL };
+    bmp.Build(50, 50, format); // 50, 50 bitmap size
+    bmp.ClearWithColor(Drawing::Color::COLOR_BLUE);
+    return bmp.MakeImage();
+}
+
+GEHpsCpuBackend::PixelBuffer GEHpsCpuBackendTest::MakeBuffer(int width, int height, float value)
+{
+    GEHpsCpuBackend::PixelBuffer buffer;
+    buffer.width = width;
+    buffer.height = height;
+    buffer.rgba.assign(static_cast<size_t>(width) * height * GEHpsCpuBackend::CHANNELS, value);
+    return buffer;
+}
+
+/**
+ * @tc.name: GaussianBlurPreservesEnergy
+ * @tc.desc: Verify the gaussian blur of an impulse is normalized and symmetric
+ * @tc.type: FUNC
+ */
+HWTEST_F(GEHpsCpuBackendTest, GaussianBlurPreservesEnergy, TestSize.Level1)
+{
+    auto buffer = MakeBuffer(21, 21, 0.0f); // 21 x 21 keeps the kernel of sigma 2 inside the buffer
+    float* center = buffer.At(10, 10);
+    std::fill(center, center + GEHpsCpuBackend::CHANNELS, 1.0f);
+    GEHpsCpuBackend::GaussianBlur(buffer, 2.0f);
+
+    float sum = 0.0f;
+    for (size_t i = 0; i < buffer.rgba.size(); i += GEHpsCpuBackend::CHANNELS) {
+        sum += buffer.rgba[i];
+    }
+    EXPECT_NEAR(sum, 1.0f, 1e-4f);
+    EXPECT_LT(buffer.At(10, 10)[0], 1.0f);
+    EXPECT_FLOAT_EQ(buffer.At(8, 10)[0], buffer.At(12, 10)[0]);
+    EXPECT_FLOAT_EQ(buffer.At(10, 8)[0], buffer.At(10, 12)[0]);
+}
+
+/**
+ * @tc.name: GaussianBlurKeepsConstantImage
+ * @tc.desc: Verify the clamped edges keep a constant image unchanged
+ * @tc.type: FUNC
+ */
+HWTEST_F(GEHpsCpuBackendTest, GaussianBlurKeepsConstantImage, TestSize.Level1)
+{
+    auto buffer = MakeBuffer(8, 5, 0.5f);
+    GEHpsCpuBackend::GaussianBlur(buffer, 3.0f);
+    for (float value : buffer.rgba) {
+        EXPECT_NEAR(value, 0.5f, 1e-5f);
+    }
+}
+
+/**
+ * @tc.name: GreyAdjustZeroCoefIsIdentity
+ * @tc.desc: Verify the grey curve without coefficients only round-trips through YUV
+ * @tc.type: FUNC
+ */
+HWTEST_F(GEHpsCpuBackendTest, GreyAdjustZeroCoefIsIdentity, TestSize.Level1)
+{
+    GEHpsCpuBackend::PixelBuffer buffer { 1, 1, { 0.3f, 0.5f, 0.7f, 1.0f } };
+    GEHpsCpuBackend::GreyAdjust(buffer, 0.0f, 0.0f);
+    EXPECT_NEAR(buffer.rgba[0], 0.3f, 1e-2f);
+    EXPECT_NEAR(buffer.rgba[1], 0.5f, 1e-2f);
+    EXPECT_NEAR(buffer.rgba[2], 0.7f, 1e-2f);
+
+    GEHpsCpuBackend::PixelBuffer dark { 1, 1, { 0.2f, 0.2f, 0.2f, 1.0f } };
+    GEHpsCpuBackend::GreyAdjust(dark, 10.0f, 10.0f); // 10.0 lifts dark tones
+    EXPECT_GT(dark.rgba[0], 0.2f);
+}
+
+/**
+ * @tc.name: AIBarBinarizesDarkPixels
+ * @tc.desc: Verify AIBar mixes a black pixel toward the high binarization value
+ * @tc.type: FUNC
+ */
+HWTEST_F(GEHpsCpuBackendTest, AIBarBinarizesDarkPixels, TestSize.Level1)
+{
+    GEHpsCpuBackend::PixelBuffer buffer { 1, 1, { 0.0f, 0.0f, 0.0f, 1.0f } };
+    GEHpsCpuBackend::AIBar(buffer, 0.2f, 0.8f, 0.5f, 0.1f, 1.0f); // low, high, threshold, opacity, saturation
+    EXPECT_NEAR(buffer.rgba[0], 0.8f * 0.42857f, 1e-5f);
+    EXPECT_FLOAT_EQ(buffer.rgba[3], 1.0f);
+}
+
+/**
+ * @tc.name: CalcBlurredImageDimensionDownscales
+ * @tc.desc: Verify the offscreen size shrinks with the blur sigma
+ * @tc.type: FUNC
+ */
+HWTEST_F(GEHpsCpuBackendTest, CalcBlurredImageDimensionDownscales, TestSize.Level1)
+{
+    GEHpsCpuBackend backend;
+    Drawing::Canvas canvas;
+    const Drawing::Rect src(0.0f, 0.0f, 100.0f, 60.0f);
+    auto small = backend.CalcBlurredImageDimension(canvas, Drawing::HpsBlurParameter(src, src, 2.0f, 1.0f, 1.0f));
+    EXPECT_EQ(small[0], 100);
+    EXPECT_EQ(small[1], 60);
+    auto large = backend.CalcBlurredImageDimension(canvas, Drawing::HpsBlurParameter(src, src, 20.0f, 1.0f, 1.0f));
+    EXPECT_EQ(large[0], 25);
+    EXPECT_EQ(large[1], 15);
+}
+
+/**
+ * @tc.name: SetBackendSwitchesFilters
+ * @tc.desc: Verify filters created after SetBackend use the installed backend and its extensions
+ * @tc.type: FUNC
+ */
+HWTEST_F(GEHpsCpuBackendTest, SetBackendSwitchesFilters, TestSize.Level1)
+{
+    EXPECT_STREQ(HpsEffectFilter::GetBackend()->GetName(), "GEHpsCpuBackend");
+    auto filter = std::make_shared<HpsEffectFilter>(*surface_->GetCanvas());
+    EXPECT_TRUE(filter->IsHpsEffectEnabled());
+    EXPECT_TRUE(filter->IsFilterSupported());
+
+    auto kawase = std::make_shared<Drawing::GEVisualEffect>(Drawing::GE_FILTER_KAWASE_BLUR);
+    EXPECT_TRUE(filter->IsEffectSupported(kawase));
+    auto edgeLight = std::make_shared<Drawing::GEVisualEffect>(Drawing::GE_FILTER_EDGE_LIGHT);
+    EXPECT_FALSE(filter->IsEffectSupported(edgeLight));
+
+    HpsEffectFilter::SetBackend(nullptr);
+    EXPECT_STREQ(HpsEffectFilter::GetBackend()->GetName(), "GEHpsDeviceBackend");
+}
+
+/**
+ * @tc.name: ApplyHpsEffectOnRasterCanvas
+ * @tc.desc: Verify a composed blur and grey run end to end without the vendor extension
+ * @tc.type: FUNC
+ */
+HWTEST_F(GEHpsCpuBackendTest, ApplyHpsEffectOnRasterCanvas, TestSize.Level1)
+{
+    auto& canvas = *surface_->GetCanvas();
+    auto filter = std::make_shared<HpsEffectFilter>(canvas);
+    auto kawase = std::make_shared<Drawing::GEVisualEffect>(Drawing::GE_FILTER_KAWASE_BLUR);
+    kawase->SetParam(Drawing::GE_FILTER_KAWASE_BLUR_RADIUS, 10); // 10 blur radius
+    auto grey = std::make_shared<Drawing::GEVisualEffect>(Drawing::GE_FILTER_GREY);
+    grey->SetParam(Drawing::GE_FILTER_GREY_COEF_1, 1.0f); // 1.0 grey blur coff
+    grey->SetParam(Drawing::GE_FILTER_GREY_COEF_2, 1.0f); // 1.0 grey blur coff
+
+    auto image = MakeImage();
+    const Drawing::Rect rect(0.0f, 0.0f, 50.0f, 50.0f);
+    filter->GenerateVisualEffectFromGE(kawase->GetImpl(), rect, rect, 1.0f, 1.0f, image);
+    filter->GenerateVisualEffectFromGE(grey->GetImpl(), rect, rect, 1.0f, 1.0f, image);
+    std::shared_ptr<Drawing::Image> outImage = nullptr;
+    HpsEffectFilter::HpsEffectContext context { 1.0f, nullptr, 0 };
+    EXPECT_TRUE(filter->ApplyHpsEffect(canvas, image, outImage, context)); // Downscaled blur is drawn on canvas
+    ASSERT_NE(outImage, nullptr);
+    EXPECT_EQ(outImage->GetWidth(), 25); // sigma 10 renders at half resolution
+}
+
+/**
+ * @tc.name: ApplyHpsGEImageEffectComposesHps
+ * @tc.desc: Verify GEHpsBuildPass and GEHpsUpscalePass run end to end through GERender
+ * @tc.type: FUNC
+ */
+HWTEST_F(GEHpsCpuBackendTest, ApplyHpsGEImageEffectComposesHps, TestSize.Level1)
+{
+    auto& canvas = *surface_->GetCanvas();
+    auto kawase = std::make_shared<Drawing::GEVisualEffect>(Drawing::GE_FILTER_KAWASE_BLUR);
+    kawase->SetParam(Drawing::GE_FILTER_KAWASE_BLUR_RADIUS, 10); // 10 blur radius
+    Drawing::GEVisualEffectContainer veContainer;
+    veContainer.AddToChainedFilter(kawase);
+
+    GraphicsEffectEngine::GERender geRender;
+    GraphicsEffectEngine::GERender::HpsGEImageEffectContext context;
+    context.image = MakeImage();
+    context.src = Drawing::Rect(0.0f, 0.0f, 50.0f, 50.0f);
+    context.dst = context.src;
+    context.alpha = 1.0f;
+    context.saturationForHPS = 1.0f;
+    context.brightnessForHPS = 1.0f;
+    std::shared_ptr<Drawing::Image> outImage = nullptr;
+    Drawing::Brush brush;
+    auto result = geRender.ApplyHpsGEImageEffect(canvas, veContainer, context, outImage, brush);
+    EXPECT_TRUE(result.isHpsBlurApplied);
+    EXPECT_TRUE(result.hasDrawnOnCanvas);
+    EXPECT_NE(outImage, nullptr);
+}
+
+} // namespace Rosen
+} // namespace OHOS
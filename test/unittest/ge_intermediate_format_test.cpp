@@ -0,0 +1,145 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+
+#include "effect/color_space.h"
+#include "image/bitmap.h"
+
+#include "ge_intermediate_format.h"
+#include "ge_kawase_blur_shader_filter.h"
+
+using namespace testing;
+using namespace testing::ext;
+
+namespace OHOS {
+namespace Rosen {
+
+class GEIntermediateFormatTest : public testing::Test {
+public:
+    static void SetUpTestCase() {}
+    static void TearDownTestCase() {}
+    void SetUp() override
+    {
+        savedEnabled_ = GEIntermediateFormat::IsAutoSelectEnabled();
+        GEIntermediateFormat::SetAutoSelectEnabled(true);
+    }
+    void TearDown() override
+    {
+        GEIntermediateFormat::SetAutoSelectEnabled(savedEnabled_);
+    }
+
+    static Drawing::ImageInfo MakeInfo(Drawing::ColorType colorType,
+        std::shared_ptr<Drawing::ColorSpace> colorSpace = Drawing::ColorSpace::CreateSRGB())
+    {
+        return Drawing::ImageInfo(100, 50, colorType, Drawing::ALPHATYPE_PREMUL, colorSpace); // 100 x 50 input
+    }
+
+    bool savedEnabled_ = true;
+};
+
+/**
+ * @tc.name: ColorDropsF16WithoutHeadroom
+ * @tc.desc: Verify colour passes of an F16 input use RGBA8 only when the headroom is known and at most SDR
+ * @tc.type: FUNC
+ */
+HWTEST_F(GEIntermediateFormatTest, ColorDropsF16WithoutHeadroom, TestSize.Level1)
+{
+    using Usage = GEIntermediateFormat::Usage;
+    auto f16 = MakeInfo(Drawing::COLORTYPE_RGBA_F16);
+    EXPECT_EQ(GEIntermediateFormat::SelectColorType(Usage::COLOR, f16, 1.0f), Drawing::COLORTYPE_RGBA_8888);
+    EXPECT_EQ(GEIntermediateFormat::SelectColorType(Usage::COLOR, f16, 0.0f), Drawing::COLORTYPE_RGBA_F16);
+    EXPECT_EQ(GEIntermediateFormat::SelectColorType(Usage::COLOR, f16, 2.0f), Drawing::COLORTYPE_RGBA_F16); // 2.0 HDR
+
+    auto linear = MakeInfo(Drawing::COLORTYPE_RGBA_F16, Drawing::ColorSpace::CreateSRGBLinear());
+    EXPECT_EQ(GEIntermediateFormat::SelectColorType(Usage::COLOR, linear, 1.0f), Drawing::COLORTYPE_RGBA_F16);
+
+    auto rgba8 = MakeInfo(Drawing::COLORTYPE_RGBA_8888);
+    EXPECT_EQ(GEIntermediateFormat::SelectColorType(Usage::COLOR, rgba8, 2.0f), // 2.0 HDR headroom
+        Drawing::COLORTYPE_RGBA_8888);
+}
+
+/**
+ * @tc.name: MaskAndDistanceIgnoreInput
+ * @tc.desc: Verify masks always use RGBA8 and distances always use F16
+ * @tc.type: FUNC
+ */
+HWTEST_F(GEIntermediateFormatTest, MaskAndDistanceIgnoreInput, TestSize.Level1)
+{
+    using Usage = GEIntermediateFormat::Usage;
+    auto f16 = MakeInfo(Drawing::COLORTYPE_RGBA_F16);
+    auto rgba8 = MakeInfo(Drawing::COLORTYPE_RGBA_8888);
+    EXPECT_EQ(GEIntermediateFormat::SelectColorType(Usage::MASK, f16, 2.0f), Drawing::COLORTYPE_RGBA_8888); // 2.0 HDR
+    EXPECT_EQ(GEIntermediateFormat::SelectColorType(Usage::DISTANCE, rgba8, 1.0f), Drawing::COLORTYPE_RGBA_F16);
+
+    GEIntermediateFormat::SetAutoSelectEnabled(false);
+    EXPECT_EQ(GEIntermediateFormat::SelectColorType(Usage::MASK, f16, 1.0f), Drawing::COLORTYPE_RGBA_8888);
+    EXPECT_EQ(GEIntermediateFormat::SelectColorType(Usage::DISTANCE, rgba8, 1.0f), Drawing::COLORTYPE_RGBA_F16);
+}
+
+/**
+ * @tc.name: DisabledKeepsInputFormat
+ * @tc.desc: Verify a disabled policy gives colour passes the input colour type
+ * @tc.type: FUNC
+ */
+HWTEST_F(GEIntermediateFormatTest, DisabledKeepsInputFormat, TestSize.Level1)
+{
+    GEIntermediateFormat::SetAutoSelectEnabled(false);
+    EXPECT_FALSE(GEIntermediateFormat::IsAutoSelectEnabled());
+    auto f16 = MakeInfo(Drawing::COLORTYPE_RGBA_F16);
+    EXPECT_EQ(GEIntermediateFormat::SelectColorType(GEIntermediateFormat::Usage::COLOR, f16, 1.0f),
+        Drawing::COLORTYPE_RGBA_F16);
+}
+
+/**
+ * @tc.name: MakeImageInfoKeepsAlphaAndColorSpace
+ * @tc.desc: Verify MakeImageInfo only changes the size and the colour type
+ * @tc.type: FUNC
+ */
+HWTEST_F(GEIntermediateFormatTest, MakeImageInfoKeepsAlphaAndColorSpace, TestSize.Level1)
+{
+    auto f16 = MakeInfo(Drawing::COLORTYPE_RGBA_F16);
+    auto info = GEIntermediateFormat::MakeImageInfo(25, 13, f16, GEIntermediateFormat::Usage::COLOR, 1.0f); // 25 x 13
+    EXPECT_EQ(info.GetWidth(), 25);  // 25: requested width
+    EXPECT_EQ(info.GetHeight(), 13); // 13: requested height
+    EXPECT_EQ(info.GetColorType(), Drawing::COLORTYPE_RGBA_8888);
+    EXPECT_EQ(info.GetAlphaType(), Drawing::ALPHATYPE_PREMUL);
+    EXPECT_EQ(info.GetColorSpace(), f16.GetColorSpace());
+}
+
+/**
+ * @tc.name: KawaseBlurOfF16Input
+ * @tc.desc: Verify Kawase blur of an F16 input still produces an image with the policy on
+ * @tc.type: FUNC
+ */
+HWTEST_F(GEIntermediateFormatTest, KawaseBlurOfF16Input, TestSize.Level1)
+{
+    Drawing::Bitmap bmp;
+    Drawing::BitmapFormat format { Drawing::COLORTYPE_RGBA_F16, Drawing::ALPHATYPE_PREMUL };
+    bmp.Build(50, 50, format); // 50, 50 bitmap size
+    bmp.ClearWithColor(Drawing::Color::COLOR_BLUE);
+    auto image = bmp.MakeImage();
+    ASSERT_NE(image, nullptr);
+
+    Drawing::GEKawaseBlurShaderFilterParams params { 10 }; // 10 blur radius
+    GEKawaseBlurShaderFilter filter(params);
+    filter.SetSupportHeadroom(1.0f);
+    Drawing::Canvas canvas;
+    const Drawing::Rect rect(0.0f, 0.0f, 50.0f, 50.0f);
+    EXPECT_NE(filter.OnProcessImage(canvas, image, rect, rect), nullptr);
+}
+
+} // namespace Rosen
+} // namespace OHOS
@@ -15,6 +15,8 @@
 
 #include <gtest/gtest.h>
 
+#include <cmath>
+
 #include "ge_motion_blur_shader_filter.h"
 
 #include "draw/color.h"
@@ -264,5 +266,107 @@ HWTEST_F(GEMotionBlurShaderFilterTest, CreateUpscaledImageWithValidCanvas, TestS
     EXPECT_NE(result, nullptr);
 }
 
+/**
+ * @tc.name: MultiResolutionMode_001
+ * @tc.desc: Verify the mode param selects the multi-resolution mode and unknown values fall back to single pass
+ * @tc.type: FUNC
+ */
+HWTEST_F(GEMotionBlurShaderFilterTest, MultiResolutionMode_001, TestSize.Level1)
+{
+    Drawing::GEMotionBlurShaderFilterParams params;
+    params.mode = 1; // 1: MULTI_RESOLUTION
+    GEMotionBlurShaderFilter multiRes(params);
+    EXPECT_EQ(multiRes.mode_, GEMotionBlurShaderFilter::Mode::MULTI_RESOLUTION);
+
+    params.mode = 7; // 7: unknown mode
+    GEMotionBlurShaderFilter unknown(params);
+    EXPECT_EQ(unknown.mode_, GEMotionBlurShaderFilter::Mode::SINGLE_PASS);
+}
+
+/**
+ * @tc.name: GetMotionLength_001
+ * @tc.desc: Verify the motion length covers translation and scaling around the anchor
+ * @tc.type: FUNC
+ */
+HWTEST_F(GEMotionBlurShaderFilterTest, GetMotionLength_001, TestSize.Level1)
+{
+    Vector2f noScale(1.0f, 1.0f);
+    Vector2f origin(0.0f, 0.0f);
+    Vector2f offset(3.0f, 4.0f); // 3, 4: offset of length 5
+    EXPECT_FLOAT_EQ(GEMotionBlurShaderFilter::GetMotionLength(offset, noScale, origin, 100.0f, 100.0f, 2.0f), 10.0f);
+
+    Vector2f scale(1.1f, 1.1f); // 1.1: 10% growth per frame
+    float length = GEMotionBlurShaderFilter::GetMotionLength(origin, scale, origin, 100.0f, 100.0f, 1.0f);
+    EXPECT_NEAR(length, 10.0f * std::sqrt(2.0f), 1e-3f); // Far corner moves by 10 on both axes
+}
+
+/**
+ * @tc.name: GetMultiResScale_001
+ * @tc.desc: Verify longer motions use smaller copies down to the minimum scale
+ * @tc.type: FUNC
+ */
+HWTEST_F(GEMotionBlurShaderFilterTest, GetMultiResScale_001, TestSize.Level1)
+{
+    EXPECT_FLOAT_EQ(GEMotionBlurShaderFilter::GetMultiResScale(0.0f), 0.5f);
+    EXPECT_FLOAT_EQ(GEMotionBlurShaderFilter::GetMultiResScale(63.0f), 0.5f);    // 63: below two levels
+    EXPECT_FLOAT_EQ(GEMotionBlurShaderFilter::GetMultiResScale(64.0f), 0.25f);   // 64: one halving
+    EXPECT_FLOAT_EQ(GEMotionBlurShaderFilter::GetMultiResScale(200.0f), 0.125f); // 200: two halvings
+    EXPECT_FLOAT_EQ(GEMotionBlurShaderFilter::GetMultiResScale(1e5f), 0.125f);   // 1e5: clamped to minimum scale
+}
+
+/**
+ * @tc.name: GetAdaptiveSampleCount_001
+ * @tc.desc: Verify the sample count follows the motion length within the configured maximum
+ * @tc.type: FUNC
+ */
+HWTEST_F(GEMotionBlurShaderFilterTest, GetAdaptiveSampleCount_001, TestSize.Level1)
+{
+    EXPECT_EQ(GEMotionBlurShaderFilter::GetAdaptiveSampleCount(0.0f, 8), 1);     // 8: default sample count
+    EXPECT_EQ(GEMotionBlurShaderFilter::GetAdaptiveSampleCount(9.0f, 8), 5);     // 9 pixels at 2 pixels spacing
+    EXPECT_EQ(GEMotionBlurShaderFilter::GetAdaptiveSampleCount(1000.0f, 8), 8);  // Capped by the params
+    EXPECT_EQ(GEMotionBlurShaderFilter::GetAdaptiveSampleCount(1000.0f, 100), 50); // 50: shader loop bound
+}
+
+/**
+ * @tc.name: MultiResolutionProcess_001
+ * @tc.desc: Verify the multi-resolution mode blurs a moving image and reuses the low resolution copy across frames
+ * @tc.type: FUNC
+ */
+HWTEST_F(GEMotionBlurShaderFilterTest, MultiResolutionProcess_001, TestSize.Level1)
+{
+    auto surface = Drawing::Surface::MakeRasterN32Premul(imageWidth_ * 2, imageHeight_); // 2: room to move
+    ASSERT_NE(surface, nullptr);
+    auto canvas = surface->GetCanvas();
+    ASSERT_NE(canvas, nullptr);
+    Drawing::GEMotionBlurShaderFilterParams params;
+    params.radius = 10.0f;
+    params.mode = 1; // 1: MULTI_RESOLUTION
+    auto filter = std::make_shared<GEMotionBlurShaderFilter>(params);
+
+    // The first frame only records the rect
+    EXPECT_EQ(filter->OnProcessImage(*canvas, image_, src_, dst_), image_);
+    canvas->Translate(20.0f, 0.0f); // 20: horizontal motion
+    auto result = filter->OnProcessImage(*canvas, image_, src_, dst_);
+    ASSERT_NE(result, nullptr);
+
+    auto cache = filter->GetCache();
+    ASSERT_NE(cache, nullptr);
+    auto* cacheData = std::any_cast<MotionBlurCacheData>(cache.get());
+    ASSERT_NE(cacheData, nullptr);
+    EXPECT_EQ(cacheData->mode, static_cast<int32_t>(GEMotionBlurShaderFilter::Mode::MULTI_RESOLUTION));
+    if (cacheData->lowResImage == nullptr) {
+        return; // Runtime effects are unavailable on this target
+    }
+    EXPECT_EQ(cacheData->lowResImageId, image_->GetUniqueID());
+    EXPECT_EQ(result->GetWidth(), image_->GetWidth());
+    auto lowResImage = cacheData->lowResImage;
+
+    canvas->Translate(20.0f, 0.0f); // 20: same motion on the next frame
+    filter->OnProcessImage(*canvas, image_, src_, dst_);
+    cacheData = std::any_cast<MotionBlurCacheData>(filter->GetCache().get());
+    ASSERT_NE(cacheData, nullptr);
+    EXPECT_EQ(cacheData->lowResImage, lowResImage);
+}
+
 } // namespace Rosen
 } // namespace OHOS
@@ -0,0 +1,161 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstdlib>
+
+#include "ge_noise_atlas.h"
+
+using namespace testing;
+using namespace testing::ext;
+
+namespace OHOS {
+namespace Rosen {
+
+class GENoiseAtlasTest : public testing::Test {
+public:
+    static void SetUpTestCase() {}
+    static void TearDownTestCase() {}
+    void SetUp() override {}
+    void TearDown() override
+    {
+        GENoiseAtlas::GetInstance().Clear();
+    }
+
+    static int Channel(const std::vector<uint8_t>& rgba, uint32_t size, uint32_t x, uint32_t y, uint32_t channel)
+    {
+        return rgba[(static_cast<size_t>(y) * size + x) * GENoiseAtlas::CHANNELS + channel];
+    }
+};
+
+/**
+ * @tc.name: BakeRejectsInvalidSize
+ * @tc.desc: Verify sizes out of range or not a power of two are rejected
+ * @tc.type: FUNC
+ */
+HWTEST_F(GENoiseAtlasTest, BakeRejectsInvalidSize, TestSize.Level1)
+{
+    std::vector<uint8_t> rgba;
+    EXPECT_FALSE(GENoiseAtlas::Bake(0, rgba));
+    EXPECT_FALSE(GENoiseAtlas::Bake(48, rgba));   // 48: not a power of two
+    EXPECT_FALSE(GENoiseAtlas::Bake(1024, rgba)); // 1024: above MAX_SIZE
+    EXPECT_FALSE(GENoiseAtlas::Bake(16, rgba));   // 16: below MIN_SIZE
+    EXPECT_TRUE(rgba.empty());
+    EXPECT_EQ(GENoiseAtlas::GetInstance().GetImage(48), nullptr); // 48: not a power of two
+}
+
+/**
+ * @tc.name: BakeIsDeterministic
+ * @tc.desc: Verify two bakes are identical, opaque, and the 1D noise is the same on every row
+ * @tc.type: FUNC
+ */
+HWTEST_F(GENoiseAtlasTest, BakeIsDeterministic, TestSize.Level1)
+{
+    constexpr uint32_t size = 64; // 64 x 64 atlas
+    std::vector<uint8_t> first;
+    std::vector<uint8_t> second;
+    ASSERT_TRUE(GENoiseAtlas::Bake(size, first));
+    ASSERT_TRUE(GENoiseAtlas::Bake(size, second));
+    ASSERT_EQ(first.size(), static_cast<size_t>(size) * size * GENoiseAtlas::CHANNELS);
+    EXPECT_EQ(first, second);
+    for (uint32_t y = 0; y < size; ++y) {
+        for (uint32_t x = 0; x < size; ++x) {
+            EXPECT_EQ(Channel(first, size, x, y, 1), Channel(first, size, x, 0, 1));
+            EXPECT_EQ(Channel(first, size, x, y, 3), 255); // 3: alpha, 255: opaque
+        }
+    }
+}
+
+/**
+ * @tc.name: BakeWrapsSeamlessly
+ * @tc.desc: Verify the step across the wrap seam is no larger than the steps between neighbours inside the atlas
+ * @tc.type: FUNC
+ */
+HWTEST_F(GENoiseAtlasTest, BakeWrapsSeamlessly, TestSize.Level1)
+{
+    constexpr uint32_t size = 128; // 128 x 128 atlas
+    std::vector<uint8_t> rgba;
+    ASSERT_TRUE(GENoiseAtlas::Bake(size, rgba));
+    for (uint32_t channel = 0; channel < 3; ++channel) { // 3: r, g and b hold noise
+        int innerStep = 0;
+        int seamStep = 0;
+        for (uint32_t i = 0; i < size; ++i) {
+            for (uint32_t j = 0; j + 1 < size; ++j) {
+                innerStep = std::max(innerStep,
+                    std::abs(Channel(rgba, size, j + 1, i, channel) - Channel(rgba, size, j, i, channel)));
+                innerStep = std::max(innerStep,
+                    std::abs(Channel(rgba, size, i, j + 1, channel) - Channel(rgba, size, i, j, channel)));
+            }
+            seamStep = std::max(seamStep,
+                std::abs(Channel(rgba, size, 0, i, channel) - Channel(rgba, size, size - 1, i, channel)));
+            seamStep = std::max(seamStep,
+                std::abs(Channel(rgba, size, i, 0, channel) - Channel(rgba, size, i, size - 1, channel)));
+        }
+        EXPECT_GT(innerStep, 0);
+        EXPECT_LE(seamStep, innerStep);
+    }
+}
+
+/**
+ * @tc.name: BakeSpansNoiseRange
+ * @tc.desc: Verify the gradient noise is centred on zero and covers a useful part of its range
+ * @tc.type: FUNC
+ */
+HWTEST_F(GENoiseAtlasTest, BakeSpansNoiseRange, TestSize.Level1)
+{
+    constexpr uint32_t size = 256; // 256 x 256 atlas
+    std::vector<uint8_t> rgba;
+    ASSERT_TRUE(GENoiseAtlas::Bake(size, rgba));
+    int minValue = 255; // 255: byte max
+    int maxValue = 0;
+    double sum = 0.0;
+    for (uint32_t y = 0; y < size; ++y) {
+        for (uint32_t x = 0; x < size; ++x) {
+            int value = Channel(rgba, size, x, y, 0);
+            minValue = std::min(minValue, value);
+            maxValue = std::max(maxValue, value);
+            sum += value;
+        }
+    }
+    double mean = sum / (static_cast<double>(size) * size);
+    EXPECT_LT(minValue, 64);  // 64: noise reaches below -0.5
+    EXPECT_GT(maxValue, 192); // 192: noise reaches above 0.5
+    EXPECT_NEAR(mean, 127.5, 16.0); // 127.5: zero, 16: tolerance of the mean
+}
+
+/**
+ * @tc.name: GetImageIsShared
+ * @tc.desc: Verify an atlas is baked once per size and shared until cleared
+ * @tc.type: FUNC
+ */
+HWTEST_F(GENoiseAtlasTest, GetImageIsShared, TestSize.Level1)
+{
+    auto& atlas = GENoiseAtlas::GetInstance();
+    auto image = atlas.GetImage(64); // 64 x 64 atlas
+    ASSERT_NE(image, nullptr);
+    EXPECT_EQ(image->GetWidth(), 64);
+    EXPECT_EQ(atlas.GetImage(64), image);
+    EXPECT_NE(atlas.GetImage(32), image); // 32: another size gets its own atlas
+    EXPECT_EQ(atlas.GetCachedCount(), 2u); // 2: sizes baked
+    EXPECT_NE(atlas.GetShader(64), nullptr);
+
+    atlas.Clear();
+    EXPECT_EQ(atlas.GetCachedCount(), 0u);
+}
+
+} // namespace Rosen
+} // namespace OHOS
@@ -0,0 +1,275 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+
+#include <thread>
+
+#include "draw/path.h"
+
+#include "ge_feature_flags.h"
+#include "ge_output_memo.h"
+#include "ge_params_hash.h"
+#include "ge_render.h"
+#include "ge_visual_effect.h"
+#include "ge_visual_effect_container.h"
+#include "ge_visual_effect_impl.h"
+
+using namespace testing;
+using namespace testing::ext;
+
+namespace OHOS {
+namespace Rosen {
+namespace {
+constexpr int IMAGE_SIZE = 16; // 16: 1 KiB with 4 bytes per pixel
+constexpr size_t IMAGE_BYTES = IMAGE_SIZE * IMAGE_SIZE * 4; // 4: RGBA_8888
+
+std::shared_ptr<Drawing::Image> MakeImage()
+{
+    Drawing::Bitmap bmp;
+    Drawing::BitmapFormat format { Drawing::COLORTYPE_RGBA_8888, Drawing::ALPHATYPE_PREMUL };
+    bmp.Build(IMAGE_SIZE, IMAGE_SIZE, format);
+    bmp.ClearWithColor(Drawing::Color::COLOR_BLUE);
+    return bmp.MakeImage();
+}
+
+GEOutputMemo::Key MakeKey(uint64_t contentHash)
+{
+    GEOutputMemo::Key key;
+    key.position = 0;
+    key.inputImageId = 1;
+    key.contentHash = contentHash;
+    key.src = Drawing::Rect(0.0f, 0.0f, IMAGE_SIZE, IMAGE_SIZE);
+    key.dst = key.src;
+    key.isRaster = true;
+    return key;
+}
+
+bool HashKawaseBlur(int radius, uint64_t& hash)
+{
+    auto visualEffect = std::make_shared<Drawing::GEVisualEffect>(Drawing::GE_FILTER_KAWASE_BLUR);
+    visualEffect->SetParam(Drawing::GE_FILTER_KAWASE_BLUR_RADIUS, radius);
+    return visualEffect->GetImpl()->HashParams(hash);
+}
+} // namespace
+
+class GEOutputMemoTest : public testing::Test {
+public:
+    static void SetUpTestCase() {}
+    static void TearDownTestCase() {}
+    void SetUp() override
+    {
+        GEOutputMemo::GetInstance().Clear();
+    }
+    void TearDown() override
+    {
+        GEOutputMemo::GetInstance().Clear();
+        GEOutputMemo::GetInstance().SetBudget(GEOutputMemo::DEFAULT_BUDGET_BYTES);
+        GEFeatureFlags::GetInstance().ClearOverrides();
+    }
+
+    static inline Drawing::Canvas canvas_;
+};
+
+/**
+ * @tc.name: StoreAndFind
+ * @tc.desc: A stored output is found again by an equal key only
+ * @tc.type: FUNC
+ */
+HWTEST_F(GEOutputMemoTest, StoreAndFind, TestSize.Level1)
+{
+    auto& memo = GEOutputMemo::GetInstance();
+    auto output = MakeImage();
+    ASSERT_NE(output, nullptr);
+    memo.Store(MakeKey(1), output);
+    EXPECT_EQ(memo.Find(MakeKey(1)), output);
+    EXPECT_EQ(memo.Find(MakeKey(2)), nullptr); // 2: other params
+
+    auto otherRect = MakeKey(1);
+    otherRect.dst = Drawing::Rect(0.0f, 0.0f, 1.0f, 1.0f);
+    EXPECT_EQ(memo.Find(otherRect), nullptr);
+    EXPECT_EQ(memo.GetEntryCount(), 1u);
+    EXPECT_EQ(memo.GetUsedBytes(), IMAGE_BYTES);
+}
+
+/**
+ * @tc.name: EvictLeastRecentlyUsed
+ * @tc.desc: Outputs beyond the budget evict the least recently used ones
+ * @tc.type: FUNC
+ */
+HWTEST_F(GEOutputMemoTest, EvictLeastRecentlyUsed, TestSize.Level1)
+{
+    auto& memo = GEOutputMemo::GetInstance();
+    memo.SetBudget(IMAGE_BYTES * 2); // 2: room for two outputs
+    memo.Store(MakeKey(1), MakeImage());
+    memo.Store(MakeKey(2), MakeImage()); // 2: second output
+    ASSERT_NE(memo.Find(MakeKey(1)), nullptr);
+    memo.Store(MakeKey(3), MakeImage()); // 3: evicts key 2, key 1 was used last
+    EXPECT_NE(memo.Find(MakeKey(1)), nullptr);
+    EXPECT_EQ(memo.Find(MakeKey(2)), nullptr); // 2: evicted
+    EXPECT_NE(memo.Find(MakeKey(3)), nullptr); // 3: newest
+    EXPECT_EQ(memo.GetUsedBytes(), IMAGE_BYTES * 2); // 2: two outputs kept
+
+    memo.SetBudget(IMAGE_BYTES);
+    EXPECT_EQ(memo.GetEntryCount(), 1u);
+    EXPECT_NE(memo.Find(MakeKey(3)), nullptr); // 3: most recently used survives
+}
+
+/**
+ * @tc.name: SkipOversizedOutput
+ * @tc.desc: Outputs larger than the budget and null outputs are not kept, and replace stale entries
+ * @tc.type: FUNC
+ */
+HWTEST_F(GEOutputMemoTest, SkipOversizedOutput, TestSize.Level1)
+{
+    auto& memo = GEOutputMemo::GetInstance();
+    memo.Store(MakeKey(1), MakeImage());
+    memo.SetBudget(IMAGE_BYTES - 1);
+    EXPECT_EQ(memo.GetEntryCount(), 0u);
+    memo.Store(MakeKey(1), MakeImage());
+    EXPECT_EQ(memo.Find(MakeKey(1)), nullptr);
+
+    memo.SetBudget(GEOutputMemo::DEFAULT_BUDGET_BYTES);
+    memo.Store(MakeKey(1), MakeImage());
+    memo.Store(MakeKey(1), nullptr);
+    EXPECT_EQ(memo.Find(MakeKey(1)), nullptr);
+    EXPECT_EQ(memo.GetUsedBytes(), 0u);
+}
+
+/**
+ * @tc.name: Clear
+ * @tc.desc: Clear drops every output
+ * @tc.type: FUNC
+ */
+HWTEST_F(GEOutputMemoTest, Clear, TestSize.Level1)
+{
+    auto& memo = GEOutputMemo::GetInstance();
+    memo.Store(MakeKey(1), MakeImage());
+    memo.Store(MakeKey(2), MakeImage()); // 2: second output
+    memo.Clear();
+    EXPECT_EQ(memo.GetEntryCount(), 0u);
+    EXPECT_EQ(memo.GetUsedBytes(), 0u);
+    EXPECT_EQ(memo.Find(MakeKey(1)), nullptr);
+}
+
+/**
+ * @tc.name: PerThread
+ * @tc.desc: Each thread keeps its own outputs, which never leak into the memo of another thread
+ * @tc.type: FUNC
+ */
+HWTEST_F(GEOutputMemoTest, PerThread, TestSize.Level1)
+{
+    size_t otherThreadEntries = 0;
+    std::thread other([&otherThreadEntries]() {
+        auto& memo = GEOutputMemo::GetInstance();
+        memo.Store(MakeKey(1), MakeImage());
+        otherThreadEntries = memo.GetEntryCount();
+        memo.Clear();
+    });
+    other.join();
+    EXPECT_EQ(otherThreadEntries, 1u);
+    EXPECT_EQ(GEOutputMemo::GetInstance().GetEntryCount(), 0u);
+    EXPECT_EQ(GEOutputMemo::GetInstance().Find(MakeKey(1)), nullptr);
+}
+
+/**
+ * @tc.name: HashParams
+ * @tc.desc: Equal params hash equally, changed params hash differently
+ * @tc.type: FUNC
+ */
+HWTEST_F(GEOutputMemoTest, HashParams, TestSize.Level1)
+{
+    uint64_t first = 0;
+    uint64_t second = 0;
+    uint64_t other = 0;
+    ASSERT_TRUE(HashKawaseBlur(1, first));
+    ASSERT_TRUE(HashKawaseBlur(1, second));
+    ASSERT_TRUE(HashKawaseBlur(2, other)); // 2: other radius
+    EXPECT_EQ(first, second);
+    EXPECT_NE(first, other);
+}
+
+/**
+ * @tc.name: HasherUnhashableTypes
+ * @tc.desc: Objects without a content identity make the hasher unhashable, absent ones do not
+ * @tc.type: FUNC
+ */
+HWTEST_F(GEOutputMemoTest, HasherUnhashableTypes, TestSize.Level1)
+{
+    Drawing::GEParamsHasher absent;
+    absent.Add(std::shared_ptr<Drawing::GEShaderMask>());
+    absent.Add(std::shared_ptr<Drawing::Image>());
+    EXPECT_TRUE(absent.IsHashable());
+
+    Drawing::GEParamsHasher path;
+    path.Add(std::make_shared<Drawing::Path>());
+    EXPECT_FALSE(path.IsHashable());
+
+    Drawing::GEParamsHasher zero;
+    Drawing::GEParamsHasher negativeZero;
+    zero.Add(0.0f);
+    negativeZero.Add(-0.0f);
+    EXPECT_EQ(zero.GetHash(), negativeZero.GetHash());
+}
+
+/**
+ * @tc.name: ApplyImageEffectReusesOutput
+ * @tc.desc: A repeated invocation returns the memoized output, none is kept while the flag is disabled
+ * @tc.type: FUNC
+ */
+HWTEST_F(GEOutputMemoTest, ApplyImageEffectReusesOutput, TestSize.Level1)
+{
+    auto visualEffect = std::make_shared<Drawing::GEVisualEffect>(Drawing::GE_FILTER_KAWASE_BLUR);
+    visualEffect->SetParam(Drawing::GE_FILTER_KAWASE_BLUR_RADIUS, 1);
+    Drawing::GEVisualEffectContainer veContainer;
+    veContainer.AddToChainedFilter(visualEffect);
+
+    auto image = MakeImage();
+    const Drawing::Rect rect(0.0f, 0.0f, IMAGE_SIZE, IMAGE_SIZE);
+    GraphicsEffectEngine::GERender geRender;
+    GEFeatureFlags::GetInstance().SetOverride(GEFeatureFlag::OUTPUT_MEMO, 0);
+    geRender.ApplyImageEffect(canvas_, veContainer, { image, rect, rect }, {});
+    EXPECT_EQ(GEOutputMemo::GetInstance().GetEntryCount(), 0u);
+
+    GEFeatureFlags::GetInstance().SetOverride(GEFeatureFlag::OUTPUT_MEMO, 1);
+    auto first = geRender.ApplyImageEffect(canvas_, veContainer, { image, rect, rect }, {});
+    if (first == nullptr || first == image) {
+        return; // Filter unavailable on this canvas, nothing to memoize
+    }
+    EXPECT_EQ(geRender.ApplyImageEffect(canvas_, veContainer, { image, rect, rect }, {}), first);
+}
+
+/**
+ * @tc.name: ApplyImageEffectDisableFilterCache
+ * @tc.desc: No output is kept for effects whose canvas info disables filter caching
+ * @tc.type: FUNC
+ */
+HWTEST_F(GEOutputMemoTest, ApplyImageEffectDisableFilterCache, TestSize.Level1)
+{
+    auto visualEffect = std::make_shared<Drawing::GEVisualEffect>(Drawing::GE_FILTER_KAWASE_BLUR);
+    visualEffect->SetParam(Drawing::GE_FILTER_KAWASE_BLUR_RADIUS, 1);
+    Drawing::GEVisualEffectContainer veContainer;
+    veContainer.AddToChainedFilter(visualEffect);
+    veContainer.SetDisableFilterCache(true);
+
+    auto image = MakeImage();
+    const Drawing::Rect rect(0.0f, 0.0f, IMAGE_SIZE, IMAGE_SIZE);
+    GraphicsEffectEngine::GERender geRender;
+    GEFeatureFlags::GetInstance().SetOverride(GEFeatureFlag::OUTPUT_MEMO, 1);
+    geRender.ApplyImageEffect(canvas_, veContainer, { image, rect, rect }, {});
+    EXPECT_EQ(GEOutputMemo::GetInstance().GetEntryCount(), 0u);
+}
+} // namespace Rosen
+} // namespace OHOS
@@ -0,0 +1,225 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+
+#include "ge_kawase_blur_shader_filter.h"
+#include "ge_mesa_blur_shader_filter.h"
+#include "ge_quality_governor.h"
+
+using namespace testing;
+using namespace testing::ext;
+
+namespace OHOS {
+namespace Rosen {
+
+class GEQualityGovernorTest : public testing::Test {
+public:
+    static void SetUpTestCase() {}
+    static void TearDownTestCase() {}
+    void SetUp() override;
+    void TearDown() override;
+
+    // Reports one frame over budget per frame period until the level reaches MEDIUM
+    static void DegradeOnce();
+
+    static constexpr uint64_t PERIOD = 1000;    // 1000 ns frame period
+    static constexpr uint64_t BUDGET = 100;     // 100 ns effect budget
+    static constexpr uint64_t START = 1000;     // 1000 ns first report
+    GEQualityGovernor::Config savedConfig_ {};
+    bool savedEnabled_ = false;
+};
+
+void GEQualityGovernorTest::SetUp()
+{
+    auto& governor = GEQualityGovernor::GetInstance();
+    savedConfig_ = governor.GetConfig();
+    savedEnabled_ = governor.IsEnabled();
+    GEQualityGovernor::Config config;
+    config.framePeriodNs = PERIOD;
+    config.effectBudgetNs = BUDGET;
+    config.smoothing = 1.0f;    // 1.0 no smoothing, every frame is judged alone
+    config.recoverRatio = 0.5f; // 0.5 headroom ratio
+    config.degradeFrames = 1;
+    config.recoverFrames = 2;   // 2 frames with headroom
+    governor.SetConfig(config);
+    governor.SetEnabled(true);
+    governor.Reset();
+}
+
+void GEQualityGovernorTest::TearDown()
+{
+    auto& governor = GEQualityGovernor::GetInstance();
+    governor.SetConfig(savedConfig_);
+    governor.SetEnabled(savedEnabled_);
+    governor.Reset();
+}
+
+void GEQualityGovernorTest::DegradeOnce()
+{
+    auto& governor = GEQualityGovernor::GetInstance();
+    governor.ReportCost(BUDGET * 2, START);     // 2: twice the budget
+    governor.ReportCost(0, START + PERIOD);     // Closes the window over budget
+}
+
+/**
+ * @tc.name: DegradeAfterOverBudgetFrames
+ * @tc.desc: Verify the level drops one step per frame over budget and stops at LOW
+ * @tc.type: FUNC
+ */
+HWTEST_F(GEQualityGovernorTest, DegradeAfterOverBudgetFrames, TestSize.Level1)
+{
+    auto& governor = GEQualityGovernor::GetInstance();
+    EXPECT_EQ(governor.GetQualityLevel(), GEQualityGovernor::QualityLevel::HIGH);
+    governor.ReportCost(BUDGET * 2, START); // 2: twice the budget
+    EXPECT_EQ(governor.GetQualityLevel(), GEQualityGovernor::QualityLevel::HIGH); // Window still open
+
+    uint64_t now = START;
+    for (int frame = 0; frame < 4; ++frame) { // 4 frames, more than the levels available
+        now += PERIOD;
+        governor.ReportCost(BUDGET * 2, now); // 2: twice the budget
+    }
+    EXPECT_EQ(governor.GetQualityLevel(), GEQualityGovernor::QualityLevel::LOW);
+    EXPECT_EQ(governor.GetDegradeSteps(), 2); // 2: LOW is two steps below HIGH
+    EXPECT_EQ(governor.GetSmoothedFrameCostNs(), BUDGET * 2); // 2: twice the budget
+}
+
+/**
+ * @tc.name: RecoverAfterHeadroomFrames
+ * @tc.desc: Verify idle frames count as headroom and recover one step after recoverFrames
+ * @tc.type: FUNC
+ */
+HWTEST_F(GEQualityGovernorTest, RecoverAfterHeadroomFrames, TestSize.Level1)
+{
+    auto& governor = GEQualityGovernor::GetInstance();
+    DegradeOnce();
+    ASSERT_EQ(governor.GetQualityLevel(), GEQualityGovernor::QualityLevel::MEDIUM);
+
+    // One frame with headroom is not enough
+    governor.ReportCost(0, START + PERIOD * 2); // 2: next frame
+    EXPECT_EQ(governor.GetQualityLevel(), GEQualityGovernor::QualityLevel::MEDIUM);
+
+    // Costs between the recover threshold and the budget hold the level
+    governor.ReportCost(BUDGET * 3 / 4, START + PERIOD * 2); // 3 / 4: above the recover ratio
+    governor.ReportCost(0, START + PERIOD * 3);  // 3: next frame
+    governor.ReportCost(0, START + PERIOD * 4);  // 4: next frame
+    EXPECT_EQ(governor.GetQualityLevel(), GEQualityGovernor::QualityLevel::MEDIUM);
+
+    // A long pause without effects counts as frames with headroom
+    governor.ReportCost(0, START + PERIOD * 10); // 10: several idle frames later
+    EXPECT_EQ(governor.GetQualityLevel(), GEQualityGovernor::QualityLevel::HIGH);
+}
+
+/**
+ * @tc.name: DisabledReportsHigh
+ * @tc.desc: Verify a disabled governor ignores costs and always reports HIGH
+ * @tc.type: FUNC
+ */
+HWTEST_F(GEQualityGovernorTest, DisabledReportsHigh, TestSize.Level1)
+{
+    auto& governor = GEQualityGovernor::GetInstance();
+    DegradeOnce();
+    ASSERT_EQ(governor.GetQualityLevel(), GEQualityGovernor::QualityLevel::MEDIUM);
+    governor.SetEnabled(false);
+    EXPECT_EQ(governor.GetQualityLevel(), GEQualityGovernor::QualityLevel::HIGH);
+    EXPECT_EQ(governor.GetDegradeSteps(), 0);
+
+    governor.Reset();
+    governor.ReportCost(BUDGET * 2, START);     // 2: twice the budget
+    governor.ReportCost(0, START + PERIOD);
+    EXPECT_EQ(governor.GetSmoothedFrameCostNs(), 0u);
+}
+
+/**
+ * @tc.name: SetConfigRejectsInvalid
+ * @tc.desc: Verify an invalid config keeps the previous one
+ * @tc.type: FUNC
+ */
+HWTEST_F(GEQualityGovernorTest, SetConfigRejectsInvalid, TestSize.Level1)
+{
+    auto& governor = GEQualityGovernor::GetInstance();
+    GEQualityGovernor::Config config;
+    config.framePeriodNs = 0;
+    governor.SetConfig(config);
+    EXPECT_EQ(governor.GetConfig().framePeriodNs, PERIOD);
+
+    config.framePeriodNs = PERIOD;
+    config.smoothing = 0.0f;
+    governor.SetConfig(config);
+    EXPECT_EQ(governor.GetConfig().effectBudgetNs, BUDGET);
+}
+
+/**
+ * @tc.name: CostScopeReportsCost
+ * @tc.desc: Verify CostScope adds its lifetime to the open frame window
+ * @tc.type: FUNC
+ */
+HWTEST_F(GEQualityGovernorTest, CostScopeReportsCost, TestSize.Level1)
+{
+    auto& governor = GEQualityGovernor::GetInstance();
+    GEQualityGovernor::Config config = governor.GetConfig();
+    config.framePeriodNs = 1000000000; // 1 s window, the scope below stays in the first window
+    governor.SetConfig(config);
+    {
+        GEQualityGovernor::CostScope scope;
+    }
+    EXPECT_NE(governor.windowStartNs_, 0u);
+    EXPECT_EQ(governor.GetQualityLevel(), GEQualityGovernor::QualityLevel::HIGH);
+}
+
+/**
+ * @tc.name: KawaseScaleFollowsLevel
+ * @tc.desc: Verify Kawase blur halves its down-sampling scale at MEDIUM
+ * @tc.type: FUNC
+ */
+HWTEST_F(GEQualityGovernorTest, KawaseScaleFollowsLevel, TestSize.Level1)
+{
+    Drawing::GEKawaseBlurShaderFilterParams params { 10 }; // 10 blur radius
+    GEKawaseBlurShaderFilter filter(params);
+    filter.ComputeRadiusAndScale(10); // 10 blur radius
+    const float highScale = filter.blurScale_;
+
+    DegradeOnce();
+    filter.ComputeRadiusAndScale(10); // 10 blur radius
+    EXPECT_FLOAT_EQ(filter.blurScale_, highScale * 0.5f); // 0.5: one extra down-sampling step
+
+    filter.ComputeRadiusAndScale(1000); // 1000 radius already uses the smallest scale
+    EXPECT_FLOAT_EQ(filter.blurScale_, 0.0625f); // 0.0625: smallest Kawase scale
+}
+
+/**
+ * @tc.name: MesaScaleAndOffsetsFollowLevel
+ * @tc.desc: Verify MESA blur halves its scale and pass offsets at MEDIUM
+ * @tc.type: FUNC
+ */
+HWTEST_F(GEQualityGovernorTest, MesaScaleAndOffsetsFollowLevel, TestSize.Level1)
+{
+    Drawing::GEMESABlurShaderFilterParams params { 15, 0.f, 0.f, 0.f, 0.f, 0.f, 0.f, 0, 0.f, 0.f }; // 15 blur radius
+    GEMESABlurShaderFilter filter(params);
+    GEMESABlurShaderFilter::NewBlurParams highParams;
+    ASSERT_TRUE(filter.SetBlurParams(highParams));
+    const float highScale = filter.blurScale_;
+
+    DegradeOnce();
+    GEMESABlurShaderFilter::NewBlurParams mediumParams;
+    ASSERT_TRUE(filter.SetBlurParams(mediumParams));
+    EXPECT_FLOAT_EQ(filter.blurScale_, highScale * 0.5f); // 0.5: one extra down-sampling step
+    ASSERT_EQ(mediumParams.numberOfPasses, highParams.numberOfPasses);
+    EXPECT_FLOAT_EQ(mediumParams.offsets[0], highParams.offsets[0] * 0.5f); // 0.5: offsets in scaled pixels
+    EXPECT_FLOAT_EQ(mediumParams.offsets[1], highParams.offsets[1] * 0.5f); // 0.5: offsets in scaled pixels
+}
+
+} // namespace Rosen
+} // namespace OHOS
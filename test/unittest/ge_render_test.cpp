@@ -15,6 +15,15 @@
 
 #include <gtest/gtest.h>
 
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <thread>
+#include <vector>
+
+#include "ge_effect_cost_model.h"
+#include "ge_feature_flags.h"
+#include "ge_frame_pool.h"
 #include "ge_render.h"
 #include "ge_visual_effect_impl.h"
 #include "pipeline/rs_paint_filter_canvas.h"
@@ -856,6 +865,43 @@ HWTEST_F(GERenderTest, ApplyHpsGEImageEffect_DisabledHpsGrey, TestSize.Level1)
     GTEST_LOG_(INFO) << "GERenderTest ApplyHpsGEImageEffect_DisabledHpsGrey end";
 }
 
+/**
+ * @tc.name: ApplyHpsGEImageEffect_ComposableOnlyChain
+ * @tc.desc: Verify a chain only shader composition would change still falls back to the caller
+ * @tc.type: FUNC
+ */
+HWTEST_F(GERenderTest, ApplyHpsGEImageEffect_ComposableOnlyChain, TestSize.Level1)
+{
+    GTEST_LOG_(INFO) << "GERenderTest ApplyHpsGEImageEffect_ComposableOnlyChain start";
+
+    auto image = MakeImage();
+    ASSERT_NE(image, nullptr);
+    HpsEffectFilter::UnitTestSetExtensionProperties({ "" }); // disable hps features, no other pass applies
+
+    Drawing::GEVisualEffectContainer veContainer;
+    for (int i = 0; i < 2; ++i) { // 2: a run of two greys, composable into one pass
+        auto greyEffect = std::make_shared<Drawing::GEVisualEffect>(Drawing::GE_FILTER_GREY);
+        greyEffect->SetParam(Drawing::GE_FILTER_GREY_COEF_1, 1.0f); // 1.0 grey blur coff
+        greyEffect->SetParam(Drawing::GE_FILTER_GREY_COEF_2, 1.0f); // 1.0 grey blur coff
+        veContainer.AddToChainedFilter(greyEffect);
+    }
+    auto context = GERender::HpsGEImageEffectContext { image, Drawing::Rect(0.0f, 0.0f, 1.0f, 1.0f),
+        Drawing::Rect(0.0f, 0.0f, 1.0f, 1.0f), Drawing::SamplingOptions() };
+    std::shared_ptr<Drawing::Image> outImage = nullptr;
+    Drawing::Brush brush;
+
+    GEFeatureFlags::GetInstance().SetOverride(GEFeatureFlag::SHADER_COMPOSITION, 1);
+    auto geRender = std::make_shared<GERender>();
+    auto result = geRender->ApplyHpsGEImageEffect(*canvas_, veContainer, context, outImage, brush);
+    GEFeatureFlags::GetInstance().ClearOverrides();
+
+    EXPECT_FALSE(result.isHpsBlurApplied);
+    EXPECT_FALSE(result.hasDrawnOnCanvas);
+    EXPECT_EQ(outImage, nullptr); // Not applied, the caller falls back to ApplyImageEffect
+
+    GTEST_LOG_(INFO) << "GERenderTest ApplyHpsGEImageEffect_ComposableOnlyChain end";
+}
+
 /**
  * @tc.name: ApplyHpsGEImageEffect_DirectDrawOnCanvas
  * @tc.desc: Verify ApplyHpsGEImageEffect with direct draw
@@ -1306,6 +1352,35 @@ HWTEST_F(GERenderTest, DrawShaderEffect_EmptyContainer, TestSize.Level1)
     GTEST_LOG_(INFO) << "GERenderTest DrawShaderEffect_EmptyContainer end";
 }
 
+/**
+ * @tc.name: DrawShaderEffect_EndsFramePoolFrame
+ * @tc.desc: Verify the first invocation of a thread after a frame period trims the GEFramePool free lists
+ * @tc.type: FUNC
+ */
+HWTEST_F(GERenderTest, DrawShaderEffect_EndsFramePoolFrame, TestSize.Level1)
+{
+    GTEST_LOG_(INFO) << "GERenderTest DrawShaderEffect_EndsFramePoolFrame start";
+
+    auto& pool = GEFramePool::GetInstance();
+    constexpr uint32_t count = GEFramePool::RETAINED_FREE_BLOCKS * 2; // 2: twice the retained blocks
+    std::vector<void*> blocks;
+    for (uint32_t i = 0; i < count; ++i) {
+        blocks.push_back(pool.Allocate(GEFramePool::MIN_BLOCK_SIZE));
+    }
+    for (void* block : blocks) {
+        pool.Deallocate(block, GEFramePool::MIN_BLOCK_SIZE);
+    }
+    EXPECT_GE(pool.GetFreeBlockCount(), count);
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(10)); // 10: longer than one frame period
+    auto geRender = std::make_shared<GERender>();
+    Drawing::GEVisualEffectContainer veContainer;
+    geRender->DrawShaderEffect(*canvas_, veContainer, Drawing::Rect(0.0f, 0.0f, 10.0f, 10.0f));
+    EXPECT_LE(pool.GetFreeBlockCount(), GEFramePool::RETAINED_FREE_BLOCKS * GEFramePool::SIZE_CLASS_COUNT);
+
+    GTEST_LOG_(INFO) << "GERenderTest DrawShaderEffect_EndsFramePoolFrame end";
+}
+
 /**
  * @tc.name: DrawShaderEffect_AuroraNoiseShader
  * @tc.desc: Verify function DrawShaderEffect with Aurora noise shader visual effect
@@ -1570,6 +1645,40 @@ HWTEST_F(GERenderTest, DrawImageEffect_InvalidRectZeroSize, TestSize.Level1)
     GTEST_LOG_(INFO) << "GERenderTest DrawImageEffect_InvalidRectZeroSize end";
 }
 
+/**
+ * @tc.name: DrawImageEffect_OutputToneMapping
+ * @tc.desc: Verify DrawImageEffect fuses the output tone mapping into its final draw
+ * @tc.type: FUNC
+ */
+HWTEST_F(GERenderTest, DrawImageEffect_OutputToneMapping, TestSize.Level1)
+{
+    GTEST_LOG_(INFO) << "GERenderTest DrawImageEffect_OutputToneMapping start";
+
+    auto visualEffect = std::make_shared<Drawing::GEVisualEffect>(Drawing::GE_FILTER_KAWASE_BLUR);
+    visualEffect->SetParam(Drawing::GE_FILTER_KAWASE_BLUR_RADIUS, 1);
+
+    auto veContainer = std::make_shared<Drawing::GEVisualEffectContainer>();
+    veContainer->AddToChainedFilter(visualEffect);
+    veContainer->SetOutputToneMappingHeadroom(1.5f); // 1.5: below EFFECT_MAX_LUMINANCE, needs tone mapping
+    EXPECT_FLOAT_EQ(veContainer->GetOutputToneMappingHeadroom(), 1.5f);
+
+    auto image = MakeImage();
+    ASSERT_NE(image, nullptr);
+    const Drawing::SamplingOptions sampling;
+    auto geRender = std::make_shared<GERender>();
+    geRender->DrawImageEffect(*canvas_, *veContainer, image, rect_, rect_, sampling);
+
+    // Raster canvases take the CPU path of the LUT
+    Drawing::Bitmap bitmap;
+    Drawing::BitmapFormat format { Drawing::COLORTYPE_RGBA_8888, Drawing::ALPHATYPE_PREMUL };
+    ASSERT_TRUE(bitmap.Build(rect_.GetWidth(), rect_.GetHeight(), format));
+    Drawing::Canvas rasterCanvas;
+    rasterCanvas.Bind(bitmap);
+    geRender->DrawImageEffect(rasterCanvas, *veContainer, image, rect_, rect_, sampling);
+
+    GTEST_LOG_(INFO) << "GERenderTest DrawImageEffect_OutputToneMapping end";
+}
+
 /**
  * @tc.name: DrawShaderEffect_InvalidShaderType
  * @tc.desc: Verify DrawShaderEffect handles invalid shader type gracefully
@@ -1651,5 +1760,277 @@ HWTEST_F(GERenderTest, SetMesablurAllEnabledByCCM_FalseAndTrue, TestSize.Level1)
 
     GTEST_LOG_(INFO) << "GERenderTest SetMesablurAllEnabledByCCM_FalseAndTrue end";
 }
+
+/**
+ * @tc.name: AfterApplyShaderFilter_ReportsExpansionInOutputs
+ * @tc.desc: Verify expansion info goes to the invocation outputs and legacy accessors only see published outputs
+ * @tc.type: FUNC
+ */
+HWTEST_F(GERenderTest, AfterApplyShaderFilter_ReportsExpansionInOutputs, TestSize.Level1)
+{
+    GTEST_LOG_(INFO) << "GERenderTest AfterApplyShaderFilter_ReportsExpansionInOutputs start";
+
+    auto greyEffect = std::make_shared<Drawing::GEVisualEffect>(Drawing::GE_FILTER_GREY);
+    greyEffect->SetParam(Drawing::GE_FILTER_GREY_COEF_1, 1.0f); // 1.0 grey blur coff
+    greyEffect->SetParam(Drawing::GE_FILTER_GREY_COEF_2, 1.0f); // 1.0 grey blur coff
+    auto geRender = std::make_shared<GERender>();
+    auto shaderFilter = geRender->GenerateShaderFilter(greyEffect);
+    ASSERT_NE(shaderFilter, nullptr);
+
+    Drawing::GEVisualEffect gasifyEffect(Drawing::GE_FILTER_GASIFY);
+    const Drawing::Rect src(1.0f, 2.0f, 3.0f, 4.0f);
+    GERender::ShaderFilterEffectContext context { nullptr, src, src, nullptr };
+    GERender::InvocationOutputs outputs;
+    EXPECT_TRUE(geRender->AfterApplyShaderFilter(*canvas_, gasifyEffect, context, *shaderFilter, outputs));
+    EXPECT_TRUE(outputs.needExpansionFilter);
+    EXPECT_EQ(outputs.expansionRect, src);
+    EXPECT_FALSE(geRender->IsNeedExpansionFilter()); // Not published yet
+
+    geRender->PublishLegacyOutputs(outputs);
+    auto otherRender = std::make_shared<GERender>();
+    EXPECT_FALSE(otherRender->IsNeedExpansionFilter());
+    EXPECT_EQ(geRender->GetExpansionRect(), src);
+    EXPECT_TRUE(geRender->IsNeedExpansionFilter());
+    EXPECT_FALSE(geRender->IsNeedExpansionFilter()); // Read-and-reset
+    EXPECT_EQ(geRender->GetExpansionRect(), src);
+
+    GTEST_LOG_(INFO) << "GERenderTest AfterApplyShaderFilter_ReportsExpansionInOutputs end";
+}
+
+/**
+ * @tc.name: PublishLegacyOutputs_InterleavedInstances
+ * @tc.desc: Verify interleaved renderers on one thread keep their own legacy outputs
+ * @tc.type: FUNC
+ */
+HWTEST_F(GERenderTest, PublishLegacyOutputs_InterleavedInstances, TestSize.Level1)
+{
+    GTEST_LOG_(INFO) << "GERenderTest PublishLegacyOutputs_InterleavedInstances start";
+
+    auto firstRender = std::make_shared<GERender>();
+    auto secondRender = std::make_shared<GERender>();
+    GERender::InvocationOutputs firstOutputs;
+    firstOutputs.needExpansionFilter = true;
+    firstOutputs.expansionRect = Drawing::Rect(1.0f, 2.0f, 3.0f, 4.0f);
+    GERender::InvocationOutputs secondOutputs;
+    secondOutputs.needExpansionFilter = true;
+    secondOutputs.expansionRect = Drawing::Rect(5.0f, 6.0f, 7.0f, 8.0f);
+
+    firstRender->PublishLegacyOutputs(firstOutputs);
+    secondRender->PublishLegacyOutputs(secondOutputs);
+    EXPECT_EQ(firstRender->GetExpansionRect(), firstOutputs.expansionRect);
+    EXPECT_EQ(secondRender->GetExpansionRect(), secondOutputs.expansionRect);
+    EXPECT_TRUE(firstRender->IsNeedExpansionFilter());
+    EXPECT_TRUE(secondRender->IsNeedExpansionFilter());
+
+    secondRender.reset();
+    EXPECT_EQ(firstRender->GetExpansionRect(), firstOutputs.expansionRect);
+    EXPECT_FALSE(firstRender->IsNeedExpansionFilter());
+
+    GTEST_LOG_(INFO) << "GERenderTest PublishLegacyOutputs_InterleavedInstances end";
+}
+
+/**
+ * @tc.name: ApplyImageEffectWithResult_NullImage
+ * @tc.desc: Verify ApplyImageEffectWithResult returns empty result on null image
+ * @tc.type: FUNC
+ */
+HWTEST_F(GERenderTest, ApplyImageEffectWithResult_NullImage, TestSize.Level1)
+{
+    GTEST_LOG_(INFO) << "GERenderTest ApplyImageEffectWithResult_NullImage start";
+
+    Drawing::GEVisualEffectContainer veContainer;
+    veContainer.AddToChainedFilter(std::make_shared<Drawing::GEVisualEffect>(Drawing::GE_FILTER_GASIFY));
+    const Drawing::Rect src(0.0f, 0.0f, 1.0f, 1.0f);
+    auto geRender = std::make_shared<GERender>();
+    auto result = geRender->ApplyImageEffectWithResult(*canvas_, veContainer, {nullptr, src, src}, {});
+    EXPECT_EQ(result.image, nullptr);
+    EXPECT_FALSE(result.outputs.needExpansionFilter);
+
+    GTEST_LOG_(INFO) << "GERenderTest ApplyImageEffectWithResult_NullImage end";
+}
+
+/**
+ * @tc.name: ApplyImageEffect_ConcurrentSharedInstance
+ * @tc.desc: Stress one GERender shared by several render threads, each owning its canvas and effects
+ * @tc.type: FUNC
+ */
+HWTEST_F(GERenderTest, ApplyImageEffect_ConcurrentSharedInstance, TestSize.Level1)
+{
+    GTEST_LOG_(INFO) << "GERenderTest ApplyImageEffect_ConcurrentSharedInstance start";
+
+    constexpr int threadCount = 4;
+    constexpr int iterations = 50;
+    auto geRender = std::make_shared<GERender>();
+    std::atomic<int> completed { 0 };
+    std::atomic<int> mismatches { 0 };
+    auto worker = [&](int index) {
+        Drawing::Bitmap bmp;
+        Drawing::BitmapFormat format { Drawing::COLORTYPE_RGBA_8888, Drawing::ALPHATYPE_PREMUL };
+        bmp.Build(50, 50, format); // 50, 50  bitmap size
+        Drawing::Canvas canvas;
+        canvas.Bind(bmp);
+        auto image = MakeImage();
+        auto greyEffect = std::make_shared<Drawing::GEVisualEffect>(Drawing::GE_FILTER_GREY);
+        greyEffect->SetParam(Drawing::GE_FILTER_GREY_COEF_1, 1.0f); // 1.0 grey blur coff
+        greyEffect->SetParam(Drawing::GE_FILTER_GREY_COEF_2, 1.0f); // 1.0 grey blur coff
+        Drawing::GEVisualEffectContainer veContainer;
+        veContainer.AddToChainedFilter(greyEffect);
+        const Drawing::Rect src(0.0f, 0.0f, 50.0f, 50.0f);
+        // Each thread publishes its own rect, the legacy accessors must never observe another thread's outputs
+        const Drawing::Rect ownRect(index, index, index + 1.0f, index + 1.0f);
+        for (int i = 0; i < iterations; ++i) {
+            auto result = geRender->ApplyImageEffectWithResult(canvas, veContainer, {image, src, src}, {});
+            GERender::InvocationOutputs outputs { true, ownRect };
+            geRender->PublishLegacyOutputs(outputs);
+            if (result.outputs.needExpansionFilter || !geRender->IsNeedExpansionFilter() ||
+                !(geRender->GetExpansionRect() == ownRect)) {
+                ++mismatches;
+            }
+            ++completed;
+        }
+    };
+    const auto start = std::chrono::steady_clock::now();
+    std::vector<std::thread> threads;
+    for (int i = 0; i < threadCount; ++i) {
+        threads.emplace_back(worker, i);
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    const auto elapsed =
+        std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count();
+    GTEST_LOG_(INFO) << "GERenderTest ApplyImageEffect_ConcurrentSharedInstance " << threadCount * iterations
+                     << " invocations in " << elapsed << " us";
+    EXPECT_EQ(completed.load(), threadCount * iterations);
+    EXPECT_EQ(mismatches.load(), 0);
+
+    GTEST_LOG_(INFO) << "GERenderTest ApplyImageEffect_ConcurrentSharedInstance end";
+}
+/**
+ * @tc.name: ApplyImageEffect_DeadlineReusesOutput
+ * @tc.desc: Verify a blur running past the deadline reuses its last output, and records are only kept with a deadline
+ * @tc.type: FUNC
+ */
+HWTEST_F(GERenderTest, ApplyImageEffect_DeadlineReusesOutput, TestSize.Level1)
+{
+    GTEST_LOG_(INFO) << "GERenderTest ApplyImageEffect_DeadlineReusesOutput start";
+
+    auto& costModel = GEEffectCostModel::GetInstance();
+    costModel.Reset();
+    auto kawase = std::make_shared<Drawing::GEVisualEffect>(Drawing::GE_FILTER_KAWASE_BLUR);
+    kawase->SetParam(Drawing::GE_FILTER_KAWASE_BLUR_RADIUS, 10); // 10 blur radius
+    Drawing::GEVisualEffectContainer veContainer;
+    veContainer.AddToChainedFilter(kawase);
+    auto geRender = std::make_shared<GERender>();
+    GERender::ShaderFilterEffectContext context { MakeImage(), rect_, rect_, nullptr, 0 };
+
+    auto unscheduled = geRender->ApplyImageEffectWithResult(*canvas_, veContainer, context, {});
+    EXPECT_TRUE(unscheduled.outputs.scheduleRecords.empty());
+    costModel.Reset();
+
+    // Unknown cost, runs and keeps its output
+    context.deadlineNs = GEEffectCostModel::NowNs() + 1000000000; // 1 s ahead
+    auto first = geRender->ApplyImageEffectWithResult(*canvas_, veContainer, context, {});
+    ASSERT_EQ(first.outputs.scheduleRecords.size(), 1u);
+    EXPECT_EQ(first.outputs.scheduleRecords[0].decision, GERender::EffectDecision::EXECUTED);
+    EXPECT_EQ(first.outputs.scheduleRecords[0].estimatedCostNs, 0u);
+    EXPECT_NE(costModel.GetEstimateNs(Drawing::GEFilterType::KAWASE_BLUR), 0u);
+
+    // Deadline already passed, the measured cost no longer fits
+    context.deadlineNs = GEEffectCostModel::NowNs();
+    auto second = geRender->ApplyImageEffectWithResult(*canvas_, veContainer, context, {});
+    ASSERT_EQ(second.outputs.scheduleRecords.size(), 1u);
+    EXPECT_EQ(second.outputs.scheduleRecords[0].decision, GERender::EffectDecision::REUSED_OUTPUT);
+    EXPECT_EQ(second.image, first.image);
+    costModel.Reset();
+
+    GTEST_LOG_(INFO) << "GERenderTest ApplyImageEffect_DeadlineReusesOutput end";
+}
+
+/**
+ * @tc.name: ApplyImageEffect_DeadlineSkipsOrRuns
+ * @tc.desc: Verify effects past the deadline are skipped when allowed and run when they declare no option
+ * @tc.type: FUNC
+ */
+HWTEST_F(GERenderTest, ApplyImageEffect_DeadlineSkipsOrRuns, TestSize.Level1)
+{
+    GTEST_LOG_(INFO) << "GERenderTest ApplyImageEffect_DeadlineSkipsOrRuns start";
+
+    auto& costModel = GEEffectCostModel::GetInstance();
+    costModel.Reset();
+    costModel.Report(Drawing::GEFilterType::EDGE_LIGHT, 1000000000); // 1 s, never fits
+    costModel.Report(Drawing::GEFilterType::GREY, 1000000000);       // 1 s, never fits
+    auto edgeLight = std::make_shared<Drawing::GEVisualEffect>(Drawing::GE_FILTER_EDGE_LIGHT);
+    auto grey = std::make_shared<Drawing::GEVisualEffect>(Drawing::GE_FILTER_GREY);
+    Drawing::GEVisualEffectContainer veContainer;
+    veContainer.AddToChainedFilter(edgeLight);
+    veContainer.AddToChainedFilter(grey);
+    auto geRender = std::make_shared<GERender>();
+    auto image = MakeImage();
+    GERender::ShaderFilterEffectContext context { image, rect_, rect_, nullptr, GEEffectCostModel::NowNs() };
+
+    auto result = geRender->ApplyImageEffectWithResult(*canvas_, veContainer, context, {});
+    ASSERT_EQ(result.outputs.scheduleRecords.size(), 2u); // 2 effects
+    EXPECT_EQ(result.outputs.scheduleRecords[0].type, Drawing::GEFilterType::EDGE_LIGHT);
+    EXPECT_EQ(result.outputs.scheduleRecords[0].decision, GERender::EffectDecision::SKIPPED);
+    EXPECT_EQ(result.outputs.scheduleRecords[1].decision, GERender::EffectDecision::EXECUTED);
+    costModel.Reset();
+
+    GTEST_LOG_(INFO) << "GERenderTest ApplyImageEffect_DeadlineSkipsOrRuns end";
+}
+
+/**
+ * @tc.name: ApplyImageEffect_ComposesAdjacentFilters
+ * @tc.desc: Verify adjacent greys drawn in a single pass match the greys processed one by one
+ * @tc.type: FUNC
+ */
+HWTEST_F(GERenderTest, ApplyImageEffect_ComposesAdjacentFilters, TestSize.Level1)
+{
+    GTEST_LOG_(INFO) << "GERenderTest ApplyImageEffect_ComposesAdjacentFilters start";
+
+    Drawing::GEVisualEffectContainer veContainer;
+    for (int i = 0; i < 2; ++i) { // 2: a run of two greys
+        auto greyEffect = std::make_shared<Drawing::GEVisualEffect>(Drawing::GE_FILTER_GREY);
+        greyEffect->SetParam(Drawing::GE_FILTER_GREY_COEF_1, 1.0f); // 1.0 grey blur coff
+        greyEffect->SetParam(Drawing::GE_FILTER_GREY_COEF_2, 1.0f); // 1.0 grey blur coff
+        veContainer.AddToChainedFilter(greyEffect);
+    }
+    auto image = MakeImage();
+    const Drawing::Rect src(0.0f, 0.0f, 50.0f, 50.0f);
+    Drawing::Canvas canvas;
+    GERender geRender;
+    auto readPixel = [](const std::shared_ptr<Drawing::Image>& output) {
+        Drawing::Bitmap bmp;
+        Drawing::BitmapFormat format { Drawing::COLORTYPE_RGBA_8888, Drawing::ALPHATYPE_PREMUL };
+        bmp.Build(output->GetWidth(), output->GetHeight(), format);
+        Drawing::Canvas readCanvas;
+        readCanvas.Bind(bmp);
+        readCanvas.DrawImage(*output, 0.0f, 0.0f, Drawing::SamplingOptions());
+        return bmp.GetColor(25, 25); // 25: centre of the image
+    };
+
+    GEFeatureFlags::GetInstance().SetOverride(GEFeatureFlag::SHADER_COMPOSITION, 0);
+    auto separate = geRender.ApplyImageEffect(canvas, veContainer, {image, src, src}, {});
+    GEFeatureFlags::GetInstance().SetOverride(GEFeatureFlag::SHADER_COMPOSITION, 1);
+    auto composed = geRender.ApplyImageEffect(canvas, veContainer, {image, src, src}, {});
+    GEFeatureFlags::GetInstance().ClearOverrides();
+    ASSERT_NE(separate, nullptr);
+    ASSERT_NE(composed, nullptr);
+    EXPECT_EQ(composed->GetWidth(), image->GetWidth());
+    EXPECT_EQ(composed->GetHeight(), image->GetHeight());
+    if (separate == image) {
+        return; // Runtime effects unavailable on this canvas, nothing to compare
+    }
+    const auto separateColor = readPixel(separate);
+    const auto composedColor = readPixel(composed);
+    // 1: the separate greys round their intermediate image to 8 bits
+    EXPECT_LE(std::abs(static_cast<int>(Drawing::Color::ColorQuadGetR(separateColor)) -
+        static_cast<int>(Drawing::Color::ColorQuadGetR(composedColor))), 1);
+    EXPECT_LE(std::abs(static_cast<int>(Drawing::Color::ColorQuadGetB(separateColor)) -
+        static_cast<int>(Drawing::Color::ColorQuadGetB(composedColor))), 1);
+
+    GTEST_LOG_(INFO) << "GERenderTest ApplyImageEffect_ComposesAdjacentFilters end";
+}
+
 } // namespace GraphicsEffectEngine
 } // namespace OHOS
@@ -1212,9 +1212,94 @@ HWTEST_F(GESDFPathShaderShapeTest, ComputeDistanceFieldNullSdfTex, TestSize.Leve
     param.path = path;
  
     GESDFPathShaderShape shape(param);
-    auto result = shape.ComputeDistanceField(*canvas_, nullptr, 100, 100);
+    auto result = shape.ComputeDistanceField(*canvas_, nullptr, nullptr, nullptr, 100, 100);
     EXPECT_EQ(result, nullptr);
 }
+
+/**
+ * @tc.name: RunSDFPropagationSinglePass
+ * @tc.desc: Test RunSDFPropagation leaves a single pass to ComputeDistanceField
+ * @tc.type: FUNC
+ */
+HWTEST_F(GESDFPathShaderShapeTest, RunSDFPropagationSinglePass, TestSize.Level1)
+{
+    GESDFPathShapeParams param;
+    GESDFPathShaderShape shape(param);
+    Drawing::Bitmap bmp;
+    Drawing::BitmapFormat fmt { Drawing::COLORTYPE_RGBA_8888, Drawing::ALPHATYPE_PREMUL };
+    bmp.Build(50, 50, fmt); // 50, 50 image size
+    bmp.ClearWithColor(Drawing::Color::COLOR_RED);
+    auto sdfTex = bmp.MakeImage();
+    auto maskTex = bmp.MakeImage();
+    ASSERT_NE(sdfTex, nullptr);
+    ASSERT_NE(maskTex, nullptr);
+
+    shape.numPasses_ = 1;
+    auto result = shape.RunSDFPropagation(*canvas_, sdfTex, maskTex, 50, 50); // 50, 50 image size
+    EXPECT_EQ(result.get(), sdfTex.get());
+}
+
+/**
+ * @tc.name: RunSDFPropagationReducedResolution
+ * @tc.desc: Test RunSDFPropagation runs the long steps at half resolution
+ * @tc.type: FUNC
+ */
+HWTEST_F(GESDFPathShaderShapeTest, RunSDFPropagationReducedResolution, TestSize.Level1)
+{
+    GESDFPathShapeParams param;
+    GESDFPathShaderShape shape(param);
+    Drawing::Bitmap bmp;
+    Drawing::BitmapFormat fmt { Drawing::COLORTYPE_RGBA_F16, Drawing::ALPHATYPE_PREMUL };
+    bmp.Build(50, 50, fmt); // 50, 50 image size
+    bmp.ClearWithColor(Drawing::Color::COLOR_RED);
+    auto sdfTex = bmp.MakeImage();
+    auto maskTex = bmp.MakeImage();
+    ASSERT_NE(sdfTex, nullptr);
+    ASSERT_NE(maskTex, nullptr);
+
+    shape.numPasses_ = 3; // 3: steps 4 and 2 at half resolution, step 1 left to ComputeDistanceField
+    auto result = shape.RunSDFPropagation(*canvas_, sdfTex, maskTex, 50, 50); // 50, 50 image size
+    ASSERT_NE(result, nullptr);
+    if (canvas_->GetGPUContext() == nullptr) {
+        EXPECT_EQ(result.get(), sdfTex.get());
+        return;
+    }
+    EXPECT_EQ(result->GetWidth(), 25);  // 25: half width
+    EXPECT_EQ(result->GetHeight(), 25); // 25: half height
+}
+
+/**
+ * @tc.name: RenderGridsToSurface_PackedGrids_001
+ * @tc.desc: Verify grids with few curves are packed into shared draws
+ * @tc.type: FUNC
+ */
+HWTEST_F(GESDFPathShaderShapeTest, RenderGridsToSurface_PackedGrids_001, TestSize.Level1)
+{
+    GESDFPathShapeParams param;
+    Drawing::Path path;
+    // Short separated segments spread over the canvas, several grids with few curves each
+    for (int i = 0; i < 6; ++i) { // 6 rows
+        float y = 20.0f + 30.0f * static_cast<float>(i); // 30: row spacing
+        path.MoveTo(10.0f, y);
+        path.LineTo(60.0f, y);
+        path.MoveTo(140.0f, y);
+        path.LineTo(190.0f, y);
+    }
+    param.path = path;
+    param.scale = Vector2f(1.0f, 1.0f);
+
+    GESDFPathShaderShape shape(param);
+    Drawing::Rect rect(0.0f, 0.0f, 200.0f, 200.0f);
+    shape.Preprocess(*canvas_, rect, false);
+    ASSERT_GT(shape.curvesInGrid_.size(), 1u);
+
+    auto builder = shape.MakePrecalcShaderBuilder();
+    ASSERT_NE(builder, nullptr);
+    shape.ProcessPackedGrids(*builder, {});
+    shape.ProcessPackedGrids(*builder, { 0, 1 });
+    shape.RenderGridsToSurface(rect);
+    EXPECT_GT(shape.curvesInGrid_.size(), 1u);
+}
  
 /**
  * @tc.name: PreprocessOverflowDimensions
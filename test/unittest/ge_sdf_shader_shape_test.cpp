@@ -14,6 +14,7 @@
  */
 
 #include <gtest/gtest.h>
+#include <cmath>
 #include "ge_cache_helper.h"
 #include "ge_sdf_rrect_shader_shape.h"
 #include "ge_sdf_shader_shape.h"
@@ -132,6 +133,69 @@ HWTEST_F(GESDFShaderShapeTest, GetInscribedRectDefaultReturnsFalse, TestSize.Lev
     EXPECT_FALSE(shape.GetInscribedRect(rect));
     GTEST_LOG_(INFO) << "GESDFShaderShapeTest GetInscribedRectDefaultReturnsFalse end";
 }
+
+/**
+ * @tc.name: QuantizedSDFRoundTripWithinBound
+ * @tc.desc: Verify QUANTIZED distances and gradients decode within the documented error bounds
+ * @tc.type: FUNC
+ */
+HWTEST_F(GESDFShaderShapeTest, QuantizedSDFRoundTripWithinBound, TestSize.Level1)
+{
+    const float distanceBound = GESDFShaderShape::SDF_QUANTIZED_RANGE / 65535.0f + 1e-4f; // 65535: 16-bit distance
+    const float angleBound = 3.14159265f / 255.0f + 1e-4f; // 255: 8-bit angle
+    for (float distance = -200.0f; distance <= 200.0f; distance += 0.37f) { // 0.37: step off the quantization grid
+        float angle = distance * 0.05f; // 0.05: angle changes with distance to cover all directions
+        auto texel = GESDFShaderShape::EncodeQuantizedSDF(distance, std::cos(angle), std::sin(angle));
+        float decoded = 0.0f;
+        float gradX = 0.0f;
+        float gradY = 0.0f;
+        GESDFShaderShape::DecodeQuantizedSDF(texel, decoded, gradX, gradY);
+        EXPECT_NEAR(decoded, distance, distanceBound);
+        float angleError = std::remainder(std::atan2(gradY, gradX) - angle, 6.28318530718f); // 2 PI
+        EXPECT_LE(std::fabs(angleError), angleBound);
+        EXPECT_EQ(texel[3], 255); // 255: opaque
+    }
+}
+
+/**
+ * @tc.name: QuantizedSDFClampsFarDistance
+ * @tc.desc: Verify distances beyond SDF_QUANTIZED_RANGE are clamped to the range
+ * @tc.type: FUNC
+ */
+HWTEST_F(GESDFShaderShapeTest, QuantizedSDFClampsFarDistance, TestSize.Level1)
+{
+    float distance = 0.0f;
+    float gradX = 0.0f;
+    float gradY = 0.0f;
+    GESDFShaderShape::DecodeQuantizedSDF(GESDFShaderShape::EncodeQuantizedSDF(1000.0f, 1.0f, 0.0f), // 1000 px away
+        distance, gradX, gradY);
+    EXPECT_FLOAT_EQ(distance, GESDFShaderShape::SDF_QUANTIZED_RANGE);
+    GESDFShaderShape::DecodeQuantizedSDF(GESDFShaderShape::EncodeQuantizedSDF(-1000.0f, 1.0f, 0.0f), // 1000 px inside
+        distance, gradX, gradY);
+    EXPECT_FLOAT_EQ(distance, -GESDFShaderShape::SDF_QUANTIZED_RANGE);
+    EXPECT_NEAR(gradX, 1.0f, 1e-5f);
+}
+
+/**
+ * @tc.name: MakeSDFImageQuantized
+ * @tc.desc: Verify a QUANTIZED SDF image is RGBA8 and its decode shader can be made
+ * @tc.type: FUNC
+ */
+HWTEST_F(GESDFShaderShapeTest, MakeSDFImageQuantized, TestSize.Level1)
+{
+    EXPECT_EQ(GESDFShaderShape::MakeSDFImageShader(nullptr, GESDFImageEncoding::QUANTIZED), nullptr);
+
+    GESDFRRectShapeParams param{};
+    param.rrect = {0.0f, 0.0f, 100.0f, 100.0f};
+    param.rrect.SetCornerRadius(10.0f, 10.0f);
+    GESDFRRectShaderShape shape(param);
+    auto image = shape.MakeSDFImage(canvas_, rect_.GetWidth(), rect_.GetHeight(), true, GESDFImageEncoding::QUANTIZED);
+    if (image == nullptr) {
+        return; // No GPU context
+    }
+    EXPECT_EQ(image->GetImageInfo().GetColorType(), Drawing::ColorType::COLORTYPE_RGBA_8888);
+    EXPECT_NE(GESDFShaderShape::MakeSDFImageShader(image, GESDFImageEncoding::QUANTIZED), nullptr);
+}
 } // namespace Drawing
 } // namespace Rosen
 } // namespace OHOS
\ No newline at end of file
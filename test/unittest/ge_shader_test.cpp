@@ -269,5 +269,63 @@ HWTEST_F(GEShaderEffectTest, MakeSDFShaderWithCacheHashMatchNullImage, TestSize.
     EXPECT_NE(testShader->GetCache(), nullptr);
     GTEST_LOG_(INFO) << "GEShaderEffectTest MakeSDFShaderWithCacheHashMatchNullImage end";
 }
+
+/**
+ * @tc.name: MakeSDFShaderWithCacheQuantized
+ * @tc.desc: Verify the SDF cache is reused for the same encoding and regenerated when the encoding changes
+ * @tc.type: FUNC
+ */
+HWTEST_F(GEShaderEffectTest, MakeSDFShaderWithCacheQuantized, TestSize.Level1)
+{
+    auto testShader = std::make_shared<GETestShader>();
+    Drawing::GESDFRRectShapeParams param{};
+    param.rrect = {0.0f, 0.0f, 100.0f, 100.0f};
+    param.rrect.SetCornerRadius(10.0f, 10.0f);
+    auto rectShape = std::make_shared<Drawing::GESDFRRectShaderShape>(param);
+    testShader->SetSDFImageEncoding(Drawing::GESDFImageEncoding::FLOAT);
+    if (testShader->MakeSDFShaderWithCache(rectShape, canvas_, rect_) == nullptr) {
+        return; // No GPU context
+    }
+    auto floatCache = testShader->GetCache();
+    EXPECT_NE(testShader->MakeSDFShaderWithCache(rectShape, canvas_, rect_), nullptr);
+    EXPECT_EQ(testShader->GetCache(), floatCache);
+
+    testShader->SetSDFImageEncoding(Drawing::GESDFImageEncoding::QUANTIZED);
+    EXPECT_NE(testShader->MakeSDFShaderWithCache(rectShape, canvas_, rect_), nullptr);
+    EXPECT_NE(testShader->GetCache(), nullptr);
+    EXPECT_NE(testShader->GetCache(), floatCache);
+}
+
+/**
+ * @tc.name: CachedShaderBuilderMatchesKey
+ * @tc.desc: Verify the cached shader builder is returned only for the same image, shape hash and size
+ * @tc.type: FUNC
+ */
+HWTEST_F(GEShaderEffectTest, CachedShaderBuilderMatchesKey, TestSize.Level1)
+{
+    static constexpr char prog[] = R"(
+        vec4 main(float2 fragCoord)
+        {
+            return vec4(1.0);
+        }
+    )";
+    auto testShader = std::make_shared<GETestShader>();
+    auto builder = std::make_shared<Drawing::RuntimeShaderBuilder>(Drawing::RuntimeEffect::CreateForShader(prog));
+    constexpr uint32_t imageId = 3;    // 3: any image ID
+    constexpr uint32_t shapeHash = 42; // 42: any non-zero shape hash
+    testShader->SetCachedShaderBuilder(imageId, shapeHash, rect_, builder);
+    ASSERT_NE(testShader->GetCache(), nullptr);
+
+    EXPECT_EQ(testShader->GetCachedShaderBuilder(imageId, shapeHash, rect_), builder);
+    EXPECT_EQ(testShader->GetCachedShaderBuilder(imageId + 1, shapeHash, rect_), nullptr);
+    EXPECT_EQ(testShader->GetCachedShaderBuilder(imageId, shapeHash + 1, rect_), nullptr);
+    Drawing::Rect otherRect {0.0f, 0.0f, 50.0f, 100.0f};
+    EXPECT_EQ(testShader->GetCachedShaderBuilder(imageId, shapeHash, otherRect), nullptr);
+
+    // A shape hash of 0 means the shape is unknown and drops the cache
+    testShader->SetCachedShaderBuilder(imageId, 0, rect_, builder);
+    EXPECT_EQ(testShader->GetCache(), nullptr);
+    EXPECT_EQ(testShader->GetCachedShaderBuilder(imageId, 0, rect_), nullptr);
+}
 }
 }
\ No newline at end of file
@@ -0,0 +1,173 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+
+#include "ge_spatial_binning.h"
+
+using namespace testing;
+using namespace testing::ext;
+
+namespace OHOS {
+namespace Rosen {
+
+class GESpatialBinningTest : public testing::Test {
+public:
+    static void SetUpTestCase() {}
+    static void TearDownTestCase() {}
+    void SetUp() override {}
+    void TearDown() override {}
+
+    using Box = GESpatialBinning::Box;
+
+    // Every cell must hold exactly the items whose box touches it
+    static void ExpectCellsMatchBruteForce(const GESpatialBinning& binning, const std::vector<Box>& items)
+    {
+        for (const auto& cell : binning.GetCells()) {
+            uint32_t expected = 0;
+            for (const auto& item : items) {
+                expected += GESpatialBinning::Intersect(cell.bbox, item) ? 1 : 0;
+            }
+            EXPECT_EQ(cell.count, expected);
+            const uint32_t* cellItems = binning.GetCellItems(cell);
+            for (uint32_t i = 0; i < cell.count; ++i) {
+                EXPECT_TRUE(GESpatialBinning::Intersect(cell.bbox, items[cellItems[i]]));
+            }
+        }
+    }
+};
+
+/**
+ * @tc.name: QuadSplitDropsEmptyQuadrants
+ * @tc.desc: Verify a crowded cell is split in four and quadrants without items are reported as empty
+ * @tc.type: FUNC
+ */
+HWTEST_F(GESpatialBinningTest, QuadSplitDropsEmptyQuadrants, TestSize.Level1)
+{
+    // 5 small items in the top-left quadrant of a 256 x 256 root
+    std::vector<Box> items;
+    for (int i = 0; i < 5; ++i) { // 5: one more than the cell limit
+        float x = 10.0f + 20.0f * i; // 20: item spacing
+        items.push_back({ x, x + 5.0f, 10.0f, 15.0f }); // 5: item size
+    }
+    GESpatialBinning binning;
+    binning.Build({ 0.0f, 256.0f, 0.0f, 256.0f }, items, { 4, 64.0f, GESpatialBinning::SplitMode::QUAD });
+
+    ASSERT_FALSE(binning.GetCells().empty());
+    EXPECT_GE(binning.GetEmptyCells().size(), 3u); // 3: quadrants left empty by the first split
+    for (const auto& cell : binning.GetCells()) {
+        EXPECT_LE(cell.bbox[1], 128.0f); // 128: every cell stays in the left half
+        EXPECT_LE(cell.count, 4u);       // 4: cell limit
+    }
+    ExpectCellsMatchBruteForce(binning, items);
+}
+
+/**
+ * @tc.name: QuadStopsAtMinCellSize
+ * @tc.desc: Verify QUAD mode does not split a cell whose narrow side is already at the minimum size
+ * @tc.type: FUNC
+ */
+HWTEST_F(GESpatialBinningTest, QuadStopsAtMinCellSize, TestSize.Level1)
+{
+    std::vector<Box> items;
+    for (int i = 0; i < 8; ++i) {                    // 8 items
+        float y = 30.0f * i;                         // 30: item spacing
+        items.push_back({ 0.0f, 64.0f, y, y + 10.0f }); // 64: full width, 10: item height
+    }
+    GESpatialBinning binning;
+    binning.Build({ 0.0f, 64.0f, 0.0f, 256.0f }, items, { 4, 64.0f, GESpatialBinning::SplitMode::QUAD });
+
+    ASSERT_EQ(binning.GetCells().size(), 1u);
+    EXPECT_EQ(binning.GetCells()[0].count, 8u); // 8: every item stays in the root cell
+    EXPECT_TRUE(binning.GetEmptyCells().empty());
+}
+
+/**
+ * @tc.name: QuadOrHalfSplitsNarrowCells
+ * @tc.desc: Verify QUAD_OR_HALF mode halves a narrow cell along its long side
+ * @tc.type: FUNC
+ */
+HWTEST_F(GESpatialBinningTest, QuadOrHalfSplitsNarrowCells, TestSize.Level1)
+{
+    std::vector<Box> items;
+    for (int i = 0; i < 8; ++i) {                    // 8 items
+        float y = 30.0f * i;                         // 30: item spacing
+        items.push_back({ 0.0f, 64.0f, y, y + 10.0f }); // 64: full width, 10: item height
+    }
+    GESpatialBinning binning;
+    binning.Build({ 0.0f, 64.0f, 0.0f, 256.0f }, items, { 4, 64.0f, GESpatialBinning::SplitMode::QUAD_OR_HALF });
+
+    ASSERT_GT(binning.GetCells().size(), 1u);
+    for (const auto& cell : binning.GetCells()) {
+        EXPECT_FLOAT_EQ(cell.bbox[0], 0.0f);  // halves keep the full width
+        EXPECT_FLOAT_EQ(cell.bbox[1], 64.0f); // 64: root width
+        EXPECT_LE(cell.count, 4u);            // 4: cell limit
+    }
+    ExpectCellsMatchBruteForce(binning, items);
+}
+
+/**
+ * @tc.name: RootFiltersOutsideItems
+ * @tc.desc: Verify items not touching the root are left out and boxes sharing an edge intersect
+ * @tc.type: FUNC
+ */
+HWTEST_F(GESpatialBinningTest, RootFiltersOutsideItems, TestSize.Level1)
+{
+    std::vector<Box> items = {
+        { 10.0f, 20.0f, 10.0f, 20.0f },   // inside
+        { 100.0f, 120.0f, 10.0f, 20.0f }, // touches the right edge
+        { 200.0f, 220.0f, 10.0f, 20.0f }, // outside
+    };
+    GESpatialBinning binning;
+    binning.Build({ 0.0f, 100.0f, 0.0f, 100.0f }, items, {});
+
+    ASSERT_EQ(binning.GetCells().size(), 1u);
+    const auto& cell = binning.GetCells()[0];
+    ASSERT_EQ(cell.count, 2u); // 2: inside and touching items
+    EXPECT_EQ(binning.GetCellItems(cell)[0], 0u);
+    EXPECT_EQ(binning.GetCellItems(cell)[1], 1u);
+
+    binning.Build({ 0.0f, 100.0f, 0.0f, 100.0f }, {}, {});
+    ASSERT_EQ(binning.GetCells().size(), 1u);
+    EXPECT_EQ(binning.GetCells()[0].count, 0u);
+}
+
+/**
+ * @tc.name: ParallelBinningMatchesBruteForce
+ * @tc.desc: Verify cells binned on worker threads hold the same items as a brute force test, across two builds
+ * @tc.type: FUNC
+ */
+HWTEST_F(GESpatialBinningTest, ParallelBinningMatchesBruteForce, TestSize.Level1)
+{
+    constexpr uint32_t itemCount = GESpatialBinning::PARALLEL_MIN_ITEMS + 1000; // 1000: above the parallel limit
+    constexpr uint32_t columns = 80;                                             // 80 items per row
+    std::vector<Box> items;
+    items.reserve(itemCount);
+    for (uint32_t i = 0; i < itemCount; ++i) {
+        float x = 12.0f * (i % columns); // 12: item spacing
+        float y = 12.0f * (i / columns);
+        items.push_back({ x, x + 8.0f, y, y + 8.0f }); // 8: item size
+    }
+    GESpatialBinning binning;
+    const GESpatialBinning::Box root = { 0.0f, 960.0f, 0.0f, 960.0f }; // 960: 80 columns of 12
+    for (int build = 0; build < 2; ++build) { // 2: the second build reuses the buffers of the first
+        binning.Build(root, items, { 64, 16.0f, GESpatialBinning::SplitMode::QUAD }); // 64 items, 16 px cells
+        ASSERT_GT(binning.GetCells().size(), 1u);
+        ExpectCellsMatchBruteForce(binning, items);
+    }
+}
+
+} // namespace Rosen
+} // namespace OHOS
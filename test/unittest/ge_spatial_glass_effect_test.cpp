@@ -18,6 +18,7 @@
 #include "ge_visual_effect_impl.h"
 #include "ge_sdf_rrect_shader_shape.h"
 #include "draw/canvas.h"
+#include "image/bitmap.h"
 #include "render_context/render_context.h"
 
 using namespace testing;
@@ -118,5 +119,46 @@ HWTEST_F(GESpatialGlassEffectTest, MakeSpatialGlassShaderNoShape_003, TestSize.L
     EXPECT_EQ(builder, nullptr);
 }
 
+/**
+* @tc.name: MakeDrawingShaderReusesBuilder_004
+* @tc.desc: Verify the shader builder is reused while the blur image and shape hash stay the same
+* @tc.type: FUNC
+*/
+HWTEST_F(GESpatialGlassEffectTest, MakeDrawingShaderReusesBuilder_004, TestSize.Level1)
+{
+    Drawing::Bitmap bmp;
+    Drawing::BitmapFormat format { Drawing::COLORTYPE_RGBA_8888, Drawing::ALPHATYPE_PREMUL };
+    bmp.Build(10, 10, format); // 10, 10 bitmap size
+    auto blurImage = bmp.MakeImage();
+    ASSERT_NE(blurImage, nullptr);
+
+    Drawing::GESDFRRectShapeParams shapeParams;
+    shapeParams.rrect = {0.0f, 0.0f, 10.0f, 10.0f};
+    auto shape = std::make_shared<Drawing::GESDFRRectShaderShape>(shapeParams);
+    shape->SetHash(7); // 7: any non-zero shape hash
+    Drawing::GESpatialGlassEffectParams params;
+    params.blurImage = blurImage;
+    params.sdfShape = shape;
+
+    auto effect = std::make_shared<GESpatialGlassEffect>(params);
+    effect->MakeDrawingShader(rect_, 1.0f);
+    if (effect->GetDrawingShader() == nullptr) {
+        return; // Runtime effects are unavailable on this target
+    }
+    auto builder = effect->GetCachedShaderBuilder(blurImage->GetUniqueID(), 7, rect_); // 7: shape hash
+    ASSERT_NE(builder, nullptr);
+
+    // The next frame creates a new effect with the cache of the previous one
+    auto nextEffect = std::make_shared<GESpatialGlassEffect>(params);
+    nextEffect->SetCache(effect->GetCache());
+    nextEffect->MakeDrawingShader(rect_, 1.0f);
+    EXPECT_NE(nextEffect->GetDrawingShader(), nullptr);
+    EXPECT_EQ(nextEffect->GetCachedShaderBuilder(blurImage->GetUniqueID(), 7, rect_), builder); // 7: shape hash
+
+    shape->SetHash(8); // 8: the shape changed
+    nextEffect->MakeDrawingShader(rect_, 1.0f);
+    EXPECT_NE(nextEffect->GetCachedShaderBuilder(blurImage->GetUniqueID(), 8, rect_), builder); // 8: new hash
+}
+
 } // namespace Rosen
 } // namespace OHOS
\ No newline at end of file
@@ -0,0 +1,121 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+
+#include <vector>
+
+#include "ge_tone_mapping_helper.h"
+#include "ge_tone_mapping_lut.h"
+
+using namespace testing;
+using namespace testing::ext;
+
+namespace OHOS {
+namespace Rosen {
+namespace {
+constexpr float LUT_TOLERANCE = 1e-3f;
+const std::vector<float> HEADROOMS = { 0.5f, 1.0f, 1.2f, 1.5f, 1.9f };
+} // namespace
+
+class GEToneMappingLutTest : public testing::Test {
+public:
+    static void SetUpTestCase() {}
+    static void TearDownTestCase() {}
+    void SetUp() override {}
+    void TearDown() override {}
+};
+
+/**
+ * @tc.name: CompressRatioMatchesHelper
+ * @tc.desc: The ratio read from the baked curve matches GEToneMappingHelper::GetBrightnessMapping
+ * @tc.type: FUNC
+ */
+HWTEST_F(GEToneMappingLutTest, CompressRatioMatchesHelper, TestSize.Level1)
+{
+    const auto& curve = GEToneMappingLut::GetInstance().GetCurve();
+    for (float headroom : HEADROOMS) {
+        for (float high = 1.0f; high <= 3.0f; high += 0.01f) { // 3: beyond EFFECT_MAX_LUMINANCE, 0.01: step
+            const float expected = GEToneMappingHelper::GetBrightnessMapping(headroom, high) / high;
+            EXPECT_NEAR(GEToneMappingLut::GetCompressRatio(curve, headroom, high), expected, LUT_TOLERANCE)
+                << "headroom " << headroom << " high " << high;
+        }
+    }
+}
+
+/**
+ * @tc.name: ApplyRgbaMatchesHelper
+ * @tc.desc: The vectorized CPU path matches the scalar mapping of unpremultiplied colours, tail pixels included
+ * @tc.type: FUNC
+ */
+HWTEST_F(GEToneMappingLutTest, ApplyRgbaMatchesHelper, TestSize.Level1)
+{
+    constexpr size_t pixelCount = 11; // 11: two blocks of 4 and a tail of 3
+    const auto& curve = GEToneMappingLut::GetInstance().GetCurve();
+    for (float headroom : HEADROOMS) {
+        std::vector<Vector4f> colors;
+        std::vector<float> rgba;
+        for (size_t i = 0; i < pixelCount; ++i) {
+            const float alpha = 0.25f + 0.075f * i;  // 0.25, 0.075: alpha in [0.25, 1]
+            const float high = 0.5f + 0.2f * i;      // 0.5, 0.2: max channel in [0.5, 2.5]
+            Vector4f color { high, high * 0.5f, high * 0.25f, alpha }; // 0.5, 0.25: darker g and b
+            colors.push_back(color);
+            rgba.insert(rgba.end(), { color.x_ * alpha, color.y_ * alpha, color.z_ * alpha, alpha });
+        }
+        GEToneMappingLut::ApplyRgba(curve, headroom, rgba.data(), pixelCount);
+        for (size_t i = 0; i < pixelCount; ++i) {
+            const auto expected = GEToneMappingHelper::GetBrightnessMapping(headroom, colors[i]);
+            const float alpha = colors[i].w_;
+            const float* pixel = rgba.data() + i * GEToneMappingLut::CHANNELS;
+            EXPECT_NEAR(pixel[0], expected.x_ * alpha, LUT_TOLERANCE);
+            EXPECT_NEAR(pixel[1], expected.y_ * alpha, LUT_TOLERANCE);
+            EXPECT_NEAR(pixel[2], expected.z_ * alpha, LUT_TOLERANCE); // 2: b
+            EXPECT_FLOAT_EQ(pixel[3], alpha); // 3: a
+        }
+    }
+}
+
+/**
+ * @tc.name: NoToneMappingAtFullHeadroom
+ * @tc.desc: Headrooms that need no tone mapping leave the pixels and shaders alone
+ * @tc.type: FUNC
+ */
+HWTEST_F(GEToneMappingLutTest, NoToneMappingAtFullHeadroom, TestSize.Level1)
+{
+    auto& lut = GEToneMappingLut::GetInstance();
+    std::vector<float> rgba = { 1.5f, 1.0f, 0.5f, 1.0f };
+    const auto original = rgba;
+    GEToneMappingLut::ApplyRgba(lut.GetCurve(), EFFECT_MAX_LUMINANCE, rgba.data(), 1);
+    EXPECT_EQ(rgba, original);
+    GEToneMappingLut::ApplyRgba(lut.GetCurve(), 0.0f, rgba.data(), 1);
+    EXPECT_EQ(rgba, original);
+    EXPECT_EQ(lut.MakeToneMappedShader(nullptr, 1.5f), nullptr); // 1.5: needs tone mapping
+}
+
+/**
+ * @tc.name: GetImage
+ * @tc.desc: The curve image is baked once with one texel per entry
+ * @tc.type: FUNC
+ */
+HWTEST_F(GEToneMappingLutTest, GetImage, TestSize.Level1)
+{
+    auto& lut = GEToneMappingLut::GetInstance();
+    auto image = lut.GetImage();
+    ASSERT_NE(image, nullptr);
+    EXPECT_EQ(image->GetWidth(), static_cast<int>(GEToneMappingLut::SIZE));
+    EXPECT_EQ(lut.GetImage(), image);
+}
+} // namespace Rosen
+} // namespace OHOS
@@ -14,6 +14,7 @@
  */
 
 #include <gtest/gtest.h>
+#include <cstdlib>
 #include "ge_variable_radius_blur_shader_filter.h"
 #include "ge_ripple_shader_mask.h"
 
@@ -181,5 +182,91 @@ HWTEST_F(GEVariableRadiusBlurShaderFilterTest, ProcessImage_ZeroRadius, TestSize
     EXPECT_EQ(filter->OnProcessImage(canvas_, image_, src_, dst_), image_);
 }
 
+/**
+ * @tc.name: GetPyramidLevelCountTest
+ * @tc.desc: Verify the pyramid depth grows with log2 of the radius and is capped
+ * @tc.type:FUNC
+ * @tc.require:
+ */
+HWTEST_F(GEVariableRadiusBlurShaderFilterTest, GetPyramidLevelCountTest, TestSize.Level1)
+{
+    EXPECT_EQ(GEVariableRadiusBlurShaderFilter::GetPyramidLevelCount(0.5f), 0);
+    EXPECT_EQ(GEVariableRadiusBlurShaderFilter::GetPyramidLevelCount(1.0f), 1);
+    EXPECT_EQ(GEVariableRadiusBlurShaderFilter::GetPyramidLevelCount(4.0f), 3);   // 4 px needs level 3
+    EXPECT_EQ(GEVariableRadiusBlurShaderFilter::GetPyramidLevelCount(5.0f), 4);   // 5 px needs level 4
+    EXPECT_EQ(GEVariableRadiusBlurShaderFilter::GetPyramidLevelCount(30.0f), 5);  // capped at 5 levels
+}
+
+/**
+ * @tc.name: ProcessImagePyramidTest001
+ * @tc.desc: Verify the pyramid mode produces an image, and masked averaging falls back to the box passes
+ * @tc.type:FUNC
+ * @tc.require:
+ */
+HWTEST_F(GEVariableRadiusBlurShaderFilterTest, ProcessImagePyramidTest001, TestSize.Level1)
+{
+    Drawing::GEVariableRadiusBlurShaderFilterParams params = { CreateRippleShaderMask(), 40.0f }; // 40 blur radius
+    params.mode = static_cast<int>(GEVariableRadiusBlurShaderFilter::Mode::PYRAMID);
+    auto filter = CreateVariableRadiusBlurShaderFilter(params);
+    ASSERT_NE(filter, nullptr);
+    EXPECT_NE(filter->OnProcessImage(canvas_, image_, src_, dst_), nullptr);
+    EXPECT_EQ(filter->OnProcessImage(canvas_, imageEmpty_, src_, dst_), imageEmpty_);
+
+    filter->params_.applyInsideMask = true;
+    EXPECT_NE(filter->OnProcessImage(canvas_, image_, src_, dst_), nullptr);
+    EXPECT_NE(filter->GetDetailedDescription().find("mode: 1"), std::string::npos);
+}
+
+/**
+ * @tc.name: DrawPyramidGradientBlurOddSizeTest
+ * @tc.desc: Verify deep levels of an odd-sized image stay aligned with the full resolution image
+ * @tc.type:FUNC
+ * @tc.require:
+ */
+HWTEST_F(GEVariableRadiusBlurShaderFilterTest, DrawPyramidGradientBlurOddSizeTest, TestSize.Level1)
+{
+    constexpr int width = 101; // 101: level sizes 51, 26, 13, 7, 4 are rounded up
+    constexpr int height = 9;  // 9: odd height
+    Drawing::Bitmap bmp;
+    Drawing::BitmapFormat format { Drawing::COLORTYPE_RGBA_8888, Drawing::ALPHATYPE_PREMUL };
+    ASSERT_TRUE(bmp.Build(width, height, format));
+    // Horizontal ramp, symmetric down-sampling keeps it a ramp at every level
+    auto* pixels = static_cast<uint8_t*>(bmp.GetPixels());
+    ASSERT_NE(pixels, nullptr);
+    for (int y = 0; y < height; y++) {
+        for (int x = 0; x < width; x++) {
+            uint8_t* pixel = pixels + y * bmp.GetRowBytes() + x * 4; // 4: RGBA
+            pixel[0] = static_cast<uint8_t>(x * 255 / (width - 1)); // 255: full red at the right edge
+            pixel[1] = 0;
+            pixel[2] = 0;
+            pixel[3] = 255; // 255: opaque
+        }
+    }
+    auto image = bmp.MakeImage();
+    ASSERT_NE(image, nullptr);
+
+    GEVariableRadiusBlurShaderFilter::MakePyramidEffects();
+    auto opaqueGradient = Drawing::ShaderEffect::CreateColorShader(Drawing::Color::COLOR_WHITE);
+    const Drawing::Rect dst(0.0f, 0.0f, width, height);
+    // 30: lod clamped to the deepest level 5 over the whole image
+    auto result = GEVariableRadiusBlurShaderFilter::DrawPyramidGradientBlur(image, canvas_, 30.0f, opaqueGradient,
+        dst);
+    ASSERT_NE(result, nullptr);
+    if (result == image) {
+        return; // Pyramid effects unavailable on this canvas
+    }
+    Drawing::Bitmap output;
+    ASSERT_TRUE(output.Build(width, height, format));
+    Drawing::Canvas outputCanvas;
+    outputCanvas.Bind(output);
+    outputCanvas.DrawImage(*result, 0.0f, 0.0f, Drawing::SamplingOptions());
+    const auto* outputPixels = static_cast<const uint8_t*>(output.GetPixels());
+    ASSERT_NE(outputPixels, nullptr);
+    // Level 5 scaled by the rounded-up size instead of 32 would read about 160 here
+    constexpr int centerX = 50;
+    const int red = outputPixels[(height / 2) * output.GetRowBytes() + centerX * 4]; // 4: RGBA
+    EXPECT_LE(std::abs(red - centerX * 255 / (width - 1)), 8); // 8: down-sampling and 8-bit rounding error
+}
+
 }  // namespace Rosen
 }  // namespace OHOS
\ No newline at end of file
@@ -0,0 +1,216 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+
+#include <vector>
+
+#include "image/bitmap.h"
+
+#include "ge_warp_mesh.h"
+
+using namespace testing;
+using namespace testing::ext;
+
+namespace OHOS {
+namespace Rosen {
+namespace {
+constexpr int32_t IMAGE_SIZE = 70; // 70: two bands of TILE_ROWS, a span tail of 2 pixels
+
+// Undistorted patch over [x0, x1] x [y0, y1] of the unit square
+GEWarpMesh::Patch MakeIdentityPatch(float x0, float y0, float x1, float y1)
+{
+    const float dx = (x1 - x0) / 3.0f; // 3: control points at the thirds of the edges
+    const float dy = (y1 - y0) / 3.0f; // 3: control points at the thirds of the edges
+    GEWarpMesh::Patch patch;
+    patch.cubics = { Drawing::Point { x0, y0 }, Drawing::Point { x0 + dx, y0 }, Drawing::Point { x1 - dx, y0 },
+        Drawing::Point { x1, y0 }, Drawing::Point { x1, y0 + dy }, Drawing::Point { x1, y1 - dy },
+        Drawing::Point { x1, y1 }, Drawing::Point { x1 - dx, y1 }, Drawing::Point { x0 + dx, y1 },
+        Drawing::Point { x0, y1 }, Drawing::Point { x0, y1 - dy }, Drawing::Point { x0, y0 + dy } };
+    patch.texCoords = { Drawing::Point { x0, y0 }, Drawing::Point { x1, y0 }, Drawing::Point { x1, y1 },
+        Drawing::Point { x0, y1 } };
+    return patch;
+}
+
+std::vector<GEWarpMesh::Patch> MakeIdentityGrid()
+{
+    return { MakeIdentityPatch(0.0f, 0.0f, 0.5f, 0.5f), MakeIdentityPatch(0.5f, 0.0f, 1.0f, 0.5f),
+        MakeIdentityPatch(0.0f, 0.5f, 0.5f, 1.0f), MakeIdentityPatch(0.5f, 0.5f, 1.0f, 1.0f) };
+}
+
+bool ReadPixels(const Drawing::Image& image, Drawing::Bitmap& bitmap)
+{
+    Drawing::BitmapFormat format { Drawing::COLORTYPE_RGBA_8888, Drawing::ALPHATYPE_PREMUL };
+    if (!bitmap.Build(image.GetWidth(), image.GetHeight(), format)) {
+        return false;
+    }
+    bitmap.ClearWithColor(Drawing::Color::COLOR_TRANSPARENT);
+    Drawing::Canvas canvas;
+    canvas.Bind(bitmap);
+    canvas.DrawImage(image, 0.0f, 0.0f, Drawing::SamplingOptions());
+    return bitmap.GetPixels() != nullptr;
+}
+} // namespace
+
+class GEWarpMeshTest : public testing::Test {
+public:
+    static void SetUpTestCase() {}
+    static void TearDownTestCase() {}
+    void SetUp() override
+    {
+        GEWarpMesh::ClearCache();
+    }
+    void TearDown() override
+    {
+        GEWarpMesh::ClearCache();
+    }
+};
+
+/**
+ * @tc.name: Tessellate
+ * @tc.desc: Every patch becomes a LOD x LOD grid whose corners are the patch corners
+ * @tc.type: FUNC
+ */
+HWTEST_F(GEWarpMeshTest, Tessellate, TestSize.Level1)
+{
+    auto patch = MakeIdentityPatch(0.0f, 0.0f, 1.0f, 1.0f);
+    patch.cubics[1] = Drawing::Point { 0.3f, -0.2f }; // 1: bend the top edge up
+    GEWarpMesh mesh({ patch });
+    constexpr size_t rowVertices = GEWarpMesh::LOD + 1;
+    const auto& vertices = mesh.GetVertices();
+    ASSERT_EQ(vertices.size(), rowVertices * rowVertices);
+    EXPECT_EQ(mesh.GetIndices().size(), GEWarpMesh::LOD * GEWarpMesh::LOD * 6); // 6: two triangles per quad
+    EXPECT_FLOAT_EQ(vertices.front().x, 0.0f);
+    EXPECT_FLOAT_EQ(vertices.front().y, 0.0f);
+    EXPECT_FLOAT_EQ(vertices.back().x, 1.0f);
+    EXPECT_FLOAT_EQ(vertices.back().y, 1.0f);
+    EXPECT_FLOAT_EQ(vertices.back().u, 1.0f);
+    EXPECT_FLOAT_EQ(vertices.back().v, 1.0f);
+    // The bent edge pulls the middle of the top row above the image
+    EXPECT_LT(vertices[GEWarpMesh::LOD / 2].y, 0.0f); // 2: middle of the row
+}
+
+/**
+ * @tc.name: GetCachesMesh
+ * @tc.desc: Equal patches share one mesh, moved control points tessellate a new one
+ * @tc.type: FUNC
+ */
+HWTEST_F(GEWarpMeshTest, GetCachesMesh, TestSize.Level1)
+{
+    auto patches = MakeIdentityGrid();
+    auto mesh = GEWarpMesh::Get(patches);
+    ASSERT_NE(mesh, nullptr);
+    EXPECT_EQ(GEWarpMesh::Get(MakeIdentityGrid()), mesh);
+
+    patches[0].cubics[0] = Drawing::Point { 0.1f, 0.1f }; // 0.1: moved corner
+    auto moved = GEWarpMesh::Get(patches);
+    EXPECT_NE(moved, mesh);
+    EXPECT_EQ(GEWarpMesh::Get(patches), moved);
+}
+
+/**
+ * @tc.name: RasterizeIdentity
+ * @tc.desc: Undistorted patches reproduce the image, shared edges are blended once
+ * @tc.type: FUNC
+ */
+HWTEST_F(GEWarpMeshTest, RasterizeIdentity, TestSize.Level1)
+{
+    Drawing::Bitmap source;
+    Drawing::BitmapFormat format { Drawing::COLORTYPE_RGBA_8888, Drawing::ALPHATYPE_PREMUL };
+    ASSERT_TRUE(source.Build(IMAGE_SIZE, IMAGE_SIZE, format));
+    source.ClearWithColor(Drawing::Color::ColorQuadSetARGB(128, 0, 0, 128)); // 128: half transparent blue
+    auto image = source.MakeImage();
+    ASSERT_NE(image, nullptr);
+
+    auto output = GEWarpMesh::Get(MakeIdentityGrid())->Rasterize(*image, IMAGE_SIZE, IMAGE_SIZE);
+    ASSERT_NE(output, nullptr);
+    Drawing::Bitmap expected;
+    Drawing::Bitmap actual;
+    ASSERT_TRUE(ReadPixels(*image, expected));
+    ASSERT_TRUE(ReadPixels(*output, actual));
+    const auto* expectedPixels = static_cast<const uint8_t*>(expected.GetPixels());
+    const auto* actualPixels = static_cast<const uint8_t*>(actual.GetPixels());
+    for (int32_t y = 0; y < IMAGE_SIZE; ++y) {
+        for (size_t i = 0; i < static_cast<size_t>(IMAGE_SIZE) * 4; ++i) { // 4: RGBA
+            ASSERT_EQ(actualPixels[y * actual.GetRowBytes() + i], expectedPixels[y * expected.GetRowBytes() + i])
+                << "row " << y << " byte " << i;
+        }
+    }
+}
+
+/**
+ * @tc.name: RasterizeInvalidSize
+ * @tc.desc: Empty outputs are rejected
+ * @tc.type: FUNC
+ */
+HWTEST_F(GEWarpMeshTest, RasterizeInvalidSize, TestSize.Level1)
+{
+    Drawing::Bitmap source;
+    Drawing::BitmapFormat format { Drawing::COLORTYPE_RGBA_8888, Drawing::ALPHATYPE_PREMUL };
+    ASSERT_TRUE(source.Build(IMAGE_SIZE, IMAGE_SIZE, format));
+    auto image = source.MakeImage();
+    ASSERT_NE(image, nullptr);
+    auto mesh = GEWarpMesh::Get(MakeIdentityGrid());
+    EXPECT_EQ(mesh->Rasterize(*image, 0, IMAGE_SIZE), nullptr);
+    EXPECT_EQ(mesh->Rasterize(*image, IMAGE_SIZE, -1), nullptr);
+}
+
+/**
+ * @tc.name: RasterizeParallelBands
+ * @tc.desc: Images drawn by the band workers reproduce the image, also when the workers are reused
+ * @tc.type: FUNC
+ */
+HWTEST_F(GEWarpMeshTest, RasterizeParallelBands, TestSize.Level1)
+{
+    constexpr int32_t size = 512; // 512: above the pixel count drawn on the calling thread alone
+    Drawing::Bitmap source;
+    Drawing::BitmapFormat format { Drawing::COLORTYPE_RGBA_8888, Drawing::ALPHATYPE_PREMUL };
+    ASSERT_TRUE(source.Build(size, size, format));
+    source.ClearWithColor(Drawing::Color::ColorQuadSetARGB(255, 0, 128, 0)); // 255, 128: opaque green
+    auto image = source.MakeImage();
+    ASSERT_NE(image, nullptr);
+
+    auto mesh = GEWarpMesh::Get(MakeIdentityGrid());
+    for (int32_t draw = 0; draw < 2; ++draw) { // 2: the second draw reuses the workers
+        auto output = mesh->Rasterize(*image, size, size);
+        ASSERT_NE(output, nullptr);
+        Drawing::Bitmap actual;
+        ASSERT_TRUE(ReadPixels(*output, actual));
+        const auto* actualPixels = static_cast<const uint8_t*>(actual.GetPixels());
+        for (int32_t y = 0; y < size; y += GEWarpMesh::TILE_ROWS - 1) {
+            const uint8_t* pixel = actualPixels + y * actual.GetRowBytes() + (size - 1) * 4; // 4: RGBA
+            EXPECT_EQ(pixel[1], 128) << "row " << y; // 1, 128: green channel
+            EXPECT_EQ(pixel[3], 255) << "row " << y; // 3, 255: opaque alpha
+        }
+    }
+}
+
+/**
+ * @tc.name: RasterizeRejectsWideColor
+ * @tc.desc: F16 sources are left to DrawPatch instead of being quantized to 8 bits
+ * @tc.type: FUNC
+ */
+HWTEST_F(GEWarpMeshTest, RasterizeRejectsWideColor, TestSize.Level1)
+{
+    Drawing::Bitmap source;
+    Drawing::BitmapFormat format { Drawing::COLORTYPE_RGBA_F16, Drawing::ALPHATYPE_PREMUL };
+    ASSERT_TRUE(source.Build(IMAGE_SIZE, IMAGE_SIZE, format));
+    auto image = source.MakeImage();
+    ASSERT_NE(image, nullptr);
+    EXPECT_FALSE(GEWarpMesh::IsRasterizable(*image));
+    EXPECT_EQ(GEWarpMesh::Get(MakeIdentityGrid())->Rasterize(*image, IMAGE_SIZE, IMAGE_SIZE), nullptr);
+}
+} // namespace Rosen
+} // namespace OHOS
@@ -27,7 +27,7 @@ import sys
 from datetime import datetime
 from pathlib import Path
 from string import Template
-from typing import Dict
+from typing import Dict, List
 
 # Import clang-format utilities from generate_metadata
 sys.path.insert(0, str(Path(__file__).parent.parent))
@@ -227,6 +227,99 @@ def generate_cpp_file(name: str, effect_type: str, output_dir: Path, templates_d
     return cpp_file
 
 
+def get_perftest_names(name: str) -> Dict:
+    """Get file names of the perf case, benchmark, contract test, budget and golden of a filter."""
+    base_name = f"ge_{to_snake_case(name)}_shader_filter"
+    return {
+        "class_name": f"GE{to_pascal_case(name)}ShaderFilter",
+        "perf_case": f"{base_name}_perf_case.h",
+        "benchmark": f"{base_name}_benchmark.cpp",
+        "perf_test": f"{base_name}_perf_test.cpp",
+        "budget": f"{base_name}.budget",
+        "golden": f"{base_name}.golden",
+        "header_guard": f"GRAPHICS_EFFECT_{base_name.upper()}_PERF_CASE_H",
+    }
+
+
+def generate_perftest_files(name: str, perftest_dir: Path, templates_dir: Path) -> List[Path]:
+    """Generate perf case, benchmark, contract test and budget of a filter under test/perftest."""
+    names = get_perftest_names(name)
+    variables = {
+        "HEADER_GUARD": names["header_guard"],
+        "CLASS_NAME": names["class_name"],
+        "DISPLAY_NAME": to_pascal_case(name),
+        "PERF_CASE_HEADER": names["perf_case"],
+        "BUDGET_FILE": names["budget"],
+        "GOLDEN_FILE": names["golden"],
+    }
+    outputs = [
+        ("perf_case.h.tpl", perftest_dir / "cases" / names["perf_case"]),
+        ("benchmark.cpp.tpl", perftest_dir / "benchmark" / names["benchmark"]),
+        ("perf_test.cpp.tpl", perftest_dir / "contract" / names["perf_test"]),
+    ]
+    generated = []
+    for template_name, output_file in outputs:
+        template = load_template(templates_dir / template_name)
+        template_content = strip_template_copyright(template.template)
+        output_file.parent.mkdir(parents=True, exist_ok=True)
+        output_file.write_text(get_copyright_header() + Template(template_content).substitute(variables))
+        generated.append(output_file)
+
+    # Budgets are data files without copyright header
+    budget_file = perftest_dir / "budget" / names["budget"]
+    budget_file.parent.mkdir(parents=True, exist_ok=True)
+    budget_file.write_text(load_template(templates_dir / "budget.tpl").substitute(variables))
+    generated.append(budget_file)
+    return generated
+
+
+def append_gn_list_entry(content: str, list_name: str, entry: str) -> str:
+    """Append a quoted entry to a GN list assignment, None if the list is missing."""
+    match = re.search(rf'^{list_name} = \[\n(.*?)^\]', content, re.MULTILINE | re.DOTALL)
+    if not match:
+        return None
+    if f'"{entry}"' in match.group(1):
+        return content
+    return content[:match.end(1)] + f'  "{entry}",\n' + content[match.end(1):]
+
+
+def try_add_perftest_sources(name: str, perftest_dir: Path, root_dir: Path, console: Console) -> bool:
+    """Try to register the perf case in perftest_cases.gni and ohos_test.xml."""
+    names = get_perftest_names(name)
+    gni_file = perftest_dir / "perftest_cases.gni"
+    xml_file = perftest_dir / "ohos_test.xml"
+    if not gni_file.exists() or not xml_file.exists():
+        console.warning(f"{perftest_dir.relative_to(root_dir)} is incomplete")
+        console.step("Add the perf case to test/perftest/perftest_cases.gni and ohos_test.xml manually")
+        return False
+
+    content = gni_file.read_text()
+    for list_name, entry in (("ge_perftest_benchmark_sources", f"benchmark/{names['benchmark']}"),
+                             ("ge_perftest_contract_sources", f"contract/{names['perf_test']}")):
+        updated = append_gn_list_entry(content, list_name, entry)
+        if updated is None:
+            console.warning(f"Could not find '{list_name}' in perftest_cases.gni")
+            console.step(f"Add \"{entry}\" to test/perftest/perftest_cases.gni manually")
+            return False
+        content = updated
+    gni_file.write_text(content)
+
+    xml = xml_file.read_text()
+    budget_push = f"graphics_effect/perftest/budget/{names['budget']} -> /data/test/graphics_effect/perftest/budget/"
+    if budget_push not in xml:
+        anchor = "        </preparer>"
+        if anchor not in xml:
+            console.warning("Could not find '</preparer>' in ohos_test.xml")
+            console.step(f"Push budget/{names['budget']} in test/perftest/ohos_test.xml manually")
+            return False
+        line = f'            <option name="push" value="{budget_push}" src="res"/>\n'
+        xml = xml.replace(anchor, line + anchor, 1)
+        xml_file.write_text(xml)
+
+    console.step("Registered the perf case in test/perftest/perftest_cases.gni and ohos_test.xml")
+    return True
+
+
 def get_output_dir(effect_type: str, target: str, root_dir: Path) -> Path:
     """Get the output directory for a given effect type."""
     if effect_type == EffectType.FILTER:
@@ -298,7 +391,8 @@ def format_generated_file(file_path: Path, clang_format_path: str, console: Cons
         return False
 
 
-def generate_effect(name: str, effect_type: str, root_dir: Path, templates_dir: Path, add_enum: bool = True) -> bool:
+def generate_effect(name: str, effect_type: str, root_dir: Path, templates_dir: Path, add_enum: bool = True,
+                    add_perftest: bool = True) -> bool:
     """Generate all files for a new effect."""
     console = Console()
     
@@ -320,14 +414,28 @@ def generate_effect(name: str, effect_type: str, root_dir: Path, templates_dir:
         cpp_file = generate_cpp_file(name, effect_type, src_output_dir, templates_dir)
         console.file(str(cpp_file.relative_to(root_dir)))
 
+        # Perf cases run effects through the filter chain, so only filters get one
+        perftest_files = []
+        perftest_dir = root_dir / "test" / "perftest"
+        if add_perftest and effect_type == EffectType.FILTER:
+            perftest_files = generate_perftest_files(name, perftest_dir, templates_dir)
+            for perftest_file in perftest_files:
+                console.file(str(perftest_file.relative_to(root_dir)))
+
         clang_format_path = find_clang_format()
         if clang_format_path:
             format_generated_file(params_file, clang_format_path, console)
             format_generated_file(header_file, clang_format_path, console)
             format_generated_file(cpp_file, clang_format_path, console)
+            for perftest_file in perftest_files:
+                if perftest_file.suffix in (".h", ".cpp"):
+                    format_generated_file(perftest_file, clang_format_path, console)
 
         if add_enum:
             try_add_filter_type_enum(name, root_dir, console)
+
+        if perftest_files:
+            try_add_perftest_sources(name, perftest_dir, root_dir, console)
         
         console.summary()
         
@@ -339,6 +447,12 @@ def generate_effect(name: str, effect_type: str, root_dir: Path, templates_dir:
             console.step("Implement shader logic in the generated .cpp file")
             console.step("Run `python tool/generate_metadata/gen_effect_header.py` to generate include")
             console.step("Run `python tool/generate_metadata/gen_metadata.py` to generate param setters")
+            if perftest_files:
+                names = get_perftest_names(name)
+                console.step(f"Set the params of the perf case in test/perftest/cases/{names['perf_case']}")
+                console.step(f"Tighten the limits in test/perftest/budget/{names['budget']} after measuring")
+                console.step(f"Run GraphicsEffectPerfContractTest once with GE_PERF_RECORD_GOLDEN=1, commit the "
+                             f"recorded {names['golden']} to test/perftest/golden and push it in ohos_test.xml")
         
         return console.error_count == 0
 
@@ -407,13 +521,21 @@ Available effect types:
         help="Disable automatic enum addition to ge_filter_type.h (useful for testing)"
     )
 
+    parser.add_argument(
+        "--no-perftest",
+        action="store_true",
+        help="Do not emit the benchmark, budget and golden check of a filter under test/perftest"
+    )
+
     args = parser.parse_args()
 
     if not args.name or not args.type:
         parser.print_help()
         return 1
 
-    return 0 if generate_effect(args.name, args.type, args.root, args.templates, add_enum=not args.no_enum) else 1
+    success = generate_effect(args.name, args.type, args.root, args.templates, add_enum=not args.no_enum,
+                              add_perftest=not args.no_perftest)
+    return 0 if success else 1
 
 
 if __name__ == "__main__":
@@ -0,0 +1,9 @@
+# Perf budget of $CLASS_NAME, loaded by its perf contract test
+# Tighten the limits once the effect is implemented and measured
+
+# Upper bound of the passes predicted by [[ge::cost(...)]]
+max_passes = 1
+# GEFramePool allocations of one warm invocation
+max_pool_allocations = 16
+# Max channel difference (0-255) of the 8x8 output signature to the golden
+golden_tolerance = 4
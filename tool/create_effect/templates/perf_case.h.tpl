@@ -0,0 +1,35 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef $HEADER_GUARD
+#define $HEADER_GUARD
+
+#include <memory>
+
+#include "ge_visual_effect.h"
+
+namespace OHOS {
+namespace Rosen {
+// Configuration of $CLASS_NAME measured by its benchmark and checked by its perf contract test
+inline std::shared_ptr<Drawing::GEVisualEffect> Make${CLASS_NAME}PerfCase()
+{
+    auto effect = std::make_shared<Drawing::GEVisualEffect>("$DISPLAY_NAME");
+    // TODO: Set the params of a typical production configuration, e.g. effect->SetParam("RADIUS", 10.0f)
+    return effect;
+}
+} // namespace Rosen
+} // namespace OHOS
+
+#endif // $HEADER_GUARD
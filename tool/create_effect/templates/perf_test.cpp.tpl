@@ -0,0 +1,96 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+
+#include "ge_frame_pool.h"
+#include "ge_perf_test_utils.h"
+#include "$PERF_CASE_HEADER"
+
+using namespace testing;
+using namespace testing::ext;
+
+namespace OHOS {
+namespace Rosen {
+class ${CLASS_NAME}PerfTest : public testing::Test {
+public:
+    static void SetUpTestCase() {}
+    static void TearDownTestCase() {}
+    void SetUp() override
+    {
+        ASSERT_TRUE(LoadPerfBudget(GetPerfDataPath("budget/$BUDGET_FILE"), budget_));
+    }
+    void TearDown() override {}
+
+    GEPerfBudget budget_;
+    GEPerfTestContext context_;
+};
+
+/**
+ * @tc.name: PassBudget
+ * @tc.desc: The passes predicted by [[ge::cost(...)]] stay within max_passes
+ * @tc.type: FUNC
+ */
+HWTEST_F(${CLASS_NAME}PerfTest, PassBudget, TestSize.Level1)
+{
+    auto effect = Make${CLASS_NAME}PerfCase();
+    ASSERT_NE(effect->GetImpl(), nullptr);
+    auto cost = effect->GetImpl()->EstimateCost();
+    if (!cost.has_value()) {
+        GTEST_LOG_(INFO) << "${CLASS_NAME}PerfTest PassBudget skipped, the params have no [[ge::cost(...)]]";
+        return;
+    }
+    EXPECT_LE(cost->passes, budget_.maxPasses);
+}
+
+/**
+ * @tc.name: AllocationBudget
+ * @tc.desc: A warm invocation allocates at most max_pool_allocations objects from GEFramePool
+ * @tc.type: FUNC
+ */
+HWTEST_F(${CLASS_NAME}PerfTest, AllocationBudget, TestSize.Level1)
+{
+    auto effect = Make${CLASS_NAME}PerfCase();
+    // The first invocation compiles the shaders and fills the caches
+    ASSERT_NE(context_.Apply(effect), nullptr);
+    auto& pool = GEFramePool::GetInstance();
+    pool.EndFrame();
+    ASSERT_NE(context_.Apply(effect), nullptr);
+    EXPECT_LE(pool.GetStats().frameAllocations, budget_.maxPoolAllocations);
+}
+
+/**
+ * @tc.name: GoldenImage
+ * @tc.desc: The output matches golden/$GOLDEN_FILE within golden_tolerance
+ * @tc.type: FUNC
+ */
+HWTEST_F(${CLASS_NAME}PerfTest, GoldenImage, TestSize.Level1)
+{
+    auto output = context_.Apply(Make${CLASS_NAME}PerfCase());
+    ASSERT_NE(output, nullptr);
+    GEImageSignature actual;
+    ASSERT_TRUE(GEPerfTestContext::ComputeSignature(*output, actual));
+    if (IsGoldenRecordingEnabled()) {
+        // Recorded to review and commit under test/perftest/golden
+        EXPECT_TRUE(SaveSignature(GetPerfOutputPath("$GOLDEN_FILE"), actual));
+        GTEST_LOG_(INFO) << "${CLASS_NAME}PerfTest recorded " << GetPerfOutputPath("$GOLDEN_FILE");
+    }
+    GEImageSignature golden;
+    ASSERT_TRUE(LoadSignature(GetPerfDataPath("golden/$GOLDEN_FILE"), golden))
+        << "Missing golden/$GOLDEN_FILE, record one with GE_PERF_RECORD_GOLDEN=1";
+    EXPECT_LE(GetMaxSignatureDiff(actual, golden), budget_.goldenTolerance);
+}
+} // namespace Rosen
+} // namespace OHOS
@@ -85,6 +85,11 @@ class StructInfo:
     fields: List[FieldInfo] = dc_field(default_factory=list)
     errors: List[ParseError] = dc_field(default_factory=list)
     params: Dict[str, Any] = dc_field(default_factory=dict)  # All parsed params (as-is)
+    cost: Dict[str, str] = dc_field(default_factory=dict)  # Parsed ge::cost expressions, keyed by COST_KEYS
+
+
+# Keys accepted by [[ge::cost(...)]], each value is a number or a C++ expression over the struct fields
+COST_KEYS = ("passes", "read_radius", "scale", "reads")
 
 
 class CppParser:
@@ -220,6 +225,7 @@ class CppParser:
         enum_type = None
         filter_name = None
         all_params = {}  # Store all params as-is
+        cost = {}
         for attr in attributes:
             parsed = AttributeParser.parse_attribute(attr)
             if parsed.get("namespace") == "ge" and parsed.get("function") == "params":
@@ -227,6 +233,8 @@ class CppParser:
                 all_params = params.copy()  # Store all params
                 enum_type = params.get("type")
                 filter_name = params.get("name")
+            elif parsed.get("namespace") == "ge" and parsed.get("function") == "cost":
+                cost = self._parse_cost_attribute(attr, parsed)
 
         if not enum_type or not filter_name:
             # Not a params struct, skip it
@@ -270,7 +278,22 @@ class CppParser:
         else:
             self._consume()  # Consume }
 
-        return StructInfo(name=struct_name, enum_type=enum_type, filter_name=filter_name, fields=fields, errors=struct_errors, params=all_params)
+        return StructInfo(
+            name=struct_name, enum_type=enum_type, filter_name=filter_name, fields=fields, errors=struct_errors, params=all_params, cost=cost
+        )
+
+    def _parse_cost_attribute(self, attr: Token, parsed: Dict[str, Any]) -> Dict[str, str]:
+        """Validate a [[ge::cost(...)]] attribute and return its expressions keyed by COST_KEYS."""
+        cost = {}
+        for key, value in parsed.get("params", {}).items():
+            if key not in COST_KEYS:
+                self._add_error(f"Unknown cost key '{key}' (expected one of {', '.join(COST_KEYS)})", attr.line, attr.column)
+                continue
+            if not isinstance(value, str) or not value.strip():
+                self._add_error(f"Empty cost expression for '{key}'", attr.line, attr.column)
+                continue
+            cost[key] = value.strip()
+        return cost
 
     def _add_error(self, message: str, line: int, column: int):
         """Add a parsing error."""
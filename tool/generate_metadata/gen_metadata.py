@@ -310,7 +310,7 @@ def get_effective_type_for_tag(
     """Get the effective type for a field tag.
 
     This function consolidates the logic for determining the effective type
-    that was duplicated in generate_set_params_member_overloads_impl() and collect_effective_types().
+    that was duplicated in get_accepted_types_for_tag() and collect_effective_types().
 
     Args:
         field: The field info
@@ -525,7 +525,7 @@ def generate_struct_tag_ranges_decl(structs: List[StructInfo], type_aliases: Dic
     output.append("// Static helper class for params member tag operations")
     output.append("class GEParamsMemberHelper {")
     output.append("public:")
-    output.append("    // Convert GEParamsMemberTag to corresponding GEFilterType")
+    output.append("    // Convert GEParamsMemberTag to corresponding GEFilterType, one load from the generated member table")
     output.append("    static GEFilterType GetFilterTypeFromTag(GEParamsMemberTag tag);")
 
     output.append("")
@@ -536,7 +536,8 @@ def generate_struct_tag_ranges_decl(structs: List[StructInfo], type_aliases: Dic
 
     output.append("")
     output.append("    // Set params member by tag using overloaded functions (reduces binary bloat)")
-    output.append("    // All implementations are in the .cpp file")
+    output.append("    // All implementations are in the .cpp file, the tag indexes a constexpr table holding the filter type,")
+    output.append("    // the accepted value kinds and their setters")
     output.append(generate_set_params_member_overloads_decl(structs, type_aliases, blocked_types))
 
     output.append("};")
@@ -545,116 +546,222 @@ def generate_struct_tag_ranges_decl(structs: List[StructInfo], type_aliases: Dic
     return "\n".join(output)
 
 
-def generate_get_filter_type_from_tag_impl(structs: List[StructInfo]) -> str:
-    """Generate GEParamsMemberHelper::GetFilterTypeFromTag() implementation."""
+def get_accepted_types_for_tag(
+    field: FieldInfo, tag_info, type_aliases: Dict[str, str], blocked_types: Dict[str, str]
+) -> List[str]:
+    """Get the setter types accepted by a tag, the effective type first.
+
+    When cast_from is specified the original field type is accepted as well, unless both normalize to the
+    same type. Blocked types are dropped, so the result has zero, one or two types.
+    """
+    accepted = []
+    normalized_type = get_effective_type_for_tag(
+        field, tag_info.is_array_element, tag_info.array_index, tag_info.prop_attr_index, type_aliases
+    )
+    if normalized_type not in blocked_types:
+        accepted.append(normalized_type)
+    if has_cast_from(field, tag_info.prop_attr_index):
+        original_type = get_original_field_type(field, tag_info.is_array_element)
+        normalized_original = normalize_type(original_type, type_aliases)
+        if normalized_original != normalized_type and normalized_original not in blocked_types:
+            accepted.append(normalized_original)
+    return accepted
+
+
+def generate_member_dispatch_table_impl(structs: List[StructInfo], type_aliases: Dict[str, str], blocked_types: Optional[Dict[str, str]] = None) -> str:
+    """Generate the constexpr tag dispatch table and GEParamsMemberHelper::GetFilterTypeFromTag().
+
+    The table has one entry per GEParamsMemberTag in enum order, so a lookup is one indexed load instead of
+    a switch over every tag.
+    """
+    if blocked_types is None:
+        blocked_types = {}
+
     output = []
+    sorted_types = sorted(collect_effective_types(structs, type_aliases, blocked_types))
 
-    output.append("GEFilterType GEParamsMemberHelper::GetFilterTypeFromTag(GEParamsMemberTag tag)")
-    output.append("{")
-    output.append("    switch (tag) {")
+    output.append("namespace {")
+    output.append("// Kind of a SetParamsMemberByTag value, the position of its type in FOR_EACH_PARAM_TYPE plus one")
+    output.append("template<typename T>")
+    output.append("struct GEParamsValueKind;")
+    output.append("")
+    output.append("#define GE_PARAMS_VALUE_KIND(Type, Kind) \\")
+    output.append("    template<> \\")
+    output.append("    struct GEParamsValueKind<Type> { \\")
+    output.append("        static constexpr uint8_t VALUE = Kind; \\")
+    output.append("    }")
+    output.append("")
+    for i, type_name in enumerate(sorted_types):
+        output.append(f"GE_PARAMS_VALUE_KIND(ESCAPE({type_name}), {i + 1});")
+    output.append("")
+    output.append("#undef GE_PARAMS_VALUE_KIND")
+    output.append("")
 
-    output.append("#define GE_GET_FILTER_TYPE_CASE(Tag, FilterTypeEnum) \\")
-    output.append("    case GEParamsMemberTag::Tag: {                   \\")
-    output.append("        return GEFilterType::FilterTypeEnum;         \\")
+    output.append("using GEParamsMemberSetter = void (*)(GEFilterParams& params, const void* value);")
+    output.append("using GEParamsMemberHasher = void (*)(const GEFilterParams& params, GEParamsHasher& hasher);")
+    output.append("")
+    output.append("// Member of one tag: the filter type owning it, up to two accepted value kinds with their setters and the")
+    output.append("// hasher of the field. The second kind is the field type of cast_from members, kind 0 accepts nothing.")
+    output.append("struct GEParamsMemberEntry {")
+    output.append("    GEFilterType filterType;")
+    output.append("    uint8_t valueKind;")
+    output.append("    uint8_t fieldKind;")
+    output.append("    GEParamsMemberSetter valueSetter;")
+    output.append("    GEParamsMemberSetter fieldSetter;")
+    output.append("    GEParamsMemberHasher hasher;")
+    output.append("};")
+    output.append("")
+    output.append("// Transforms the value with the constraints of Tag and stores it, the caller checked the filter type")
+    output.append("template<GEParamsMemberTag Tag, typename SetterType>")
+    output.append("void SetMember(GEFilterParams& params, const void* value)")
+    output.append("{")
+    output.append("    using Accessor = GEParamsFieldAccessor<Tag>;")
+    output.append("    using FieldType = typename Accessor::FieldType;")
+    output.append("    auto* actualParams = static_cast<GEFilterParamsWrapper<typename Accessor::ParamsType>&>(params).data.get();")
+    output.append("    if (actualParams == nullptr) {")
+    output.append("        return;")
+    output.append("    }")
+    output.append("    FieldType transformed;")
+    output.append("    if (GEParamsValueTransformer<Tag, SetterType, FieldType>::Transform(")
+    output.append("        *static_cast<const SetterType*>(value), transformed)) {")
+    output.append("        Accessor::Set(*actualParams, transformed);")
     output.append("    }")
+    output.append("}")
+    output.append("")
+    output.append("// Adds the field of Tag to the content hash, the caller checked the filter type")
+    output.append("template<GEParamsMemberTag Tag>")
+    output.append("void HashMember(const GEFilterParams& params, GEParamsHasher& hasher)")
+    output.append("{")
+    output.append("    using Accessor = GEParamsFieldAccessor<Tag>;")
+    output.append("    const auto* actualParams =")
+    output.append("        static_cast<const GEFilterParamsWrapper<typename Accessor::ParamsType>&>(params).data.get();")
+    output.append("    if (actualParams != nullptr) {")
+    output.append("        hasher.Add(Accessor::Get(*actualParams));")
+    output.append("    }")
+    output.append("}")
     output.append("")
 
+    output.append("#define GE_PARAMS_MEMBER_ENTRY(Tag, FilterTypeEnum, Type) \\")
+    output.append("    { GEFilterType::FilterTypeEnum, GEParamsValueKind<Type>::VALUE, 0, \\")
+    output.append("        &SetMember<GEParamsMemberTag::Tag, Type>, nullptr, &HashMember<GEParamsMemberTag::Tag> }")
+    output.append("#define GE_PARAMS_MEMBER_CAST_ENTRY(Tag, FilterTypeEnum, Type, FieldType) \\")
+    output.append("    { GEFilterType::FilterTypeEnum, GEParamsValueKind<Type>::VALUE, GEParamsValueKind<FieldType>::VALUE, \\")
+    output.append("        &SetMember<GEParamsMemberTag::Tag, Type>, &SetMember<GEParamsMemberTag::Tag, FieldType>, \\")
+    output.append("        &HashMember<GEParamsMemberTag::Tag> }")
+    output.append("#define GE_PARAMS_MEMBER_BLOCKED_ENTRY(Tag, FilterTypeEnum) \\")
+    output.append("    { GEFilterType::FilterTypeEnum, 0, 0, nullptr, nullptr, nullptr }")
+    output.append("")
+    output.append("// Indexed by GEParamsMemberTag")
+    output.append("constexpr GEParamsMemberEntry MEMBER_TABLE[] = {")
+    output.append("    GE_PARAMS_MEMBER_BLOCKED_ENTRY(INVALID, NONE),")
+
+    last_tag = "INVALID"
     for struct in structs:
         enum_type = struct.enum_type
         for field in struct.fields:
             for tag_info in iterate_field_tags(struct, field):
-                output.append(f"        GE_GET_FILTER_TYPE_CASE({tag_info.tag_name}, {enum_type})")
+                accepted = get_accepted_types_for_tag(field, tag_info, type_aliases, blocked_types)
+                tag_name = tag_info.tag_name
+                if len(accepted) == 2:
+                    output.append(
+                        f"    GE_PARAMS_MEMBER_CAST_ENTRY({tag_name}, {enum_type}, ESCAPE({accepted[0]}), ESCAPE({accepted[1]})),"
+                    )
+                elif accepted:
+                    output.append(f"    GE_PARAMS_MEMBER_ENTRY({tag_name}, {enum_type}, ESCAPE({accepted[0]})),")
+                else:
+                    output.append(f"    GE_PARAMS_MEMBER_BLOCKED_ENTRY({tag_name}, {enum_type}),")
+                last_tag = tag_name
 
-    output.append("        default:")
-    output.append("            return GEFilterType::NONE;")
+    output.append("};")
+    output.append("")
+    output.append("#undef GE_PARAMS_MEMBER_ENTRY")
+    output.append("#undef GE_PARAMS_MEMBER_CAST_ENTRY")
+    output.append("#undef GE_PARAMS_MEMBER_BLOCKED_ENTRY")
+    output.append("")
+    output.append(f"static_assert(std::size(MEMBER_TABLE) == static_cast<size_t>(GEParamsMemberTag::{last_tag}) + 1,")
+    output.append('    "MEMBER_TABLE must have one entry per GEParamsMemberTag");')
+    output.append("")
+
+    output.append("void SetMemberByKind(GEFilterParams& params, GEParamsMemberTag tag, uint8_t kind, const void* value)")
+    output.append("{")
+    output.append("    const auto index = static_cast<size_t>(tag);")
+    output.append("    if (index >= std::size(MEMBER_TABLE) || MEMBER_TABLE[index].filterType != params.GetType()) {")
+    output.append('        GE_LOGE("SetParamsMemberByTag: tag %{public}u not valid for params type %{public}u",')
+    output.append("            static_cast<uint32_t>(tag), static_cast<uint32_t>(params.GetType()));")
+    output.append("        return;")
+    output.append("    }")
+    output.append("    const auto& entry = MEMBER_TABLE[index];")
+    output.append("    if (entry.valueKind == kind) {")
+    output.append("        entry.valueSetter(params, value);")
+    output.append("    } else if (entry.fieldKind == kind) {")
+    output.append("        entry.fieldSetter(params, value);")
+    output.append("    } else {")
+    output.append('        GE_LOGE("SetParamsMemberByTag: tag %{public}u does not take value kind %{public}u",')
+    output.append("            static_cast<uint32_t>(tag), static_cast<uint32_t>(kind));")
     output.append("    }")
     output.append("}")
+    output.append("} // namespace")
     output.append("")
-    output.append("#undef GE_GET_FILTER_TYPE_CASE")
+
+    output.append("GEFilterType GEParamsMemberHelper::GetFilterTypeFromTag(GEParamsMemberTag tag)")
+    output.append("{")
+    output.append("    const auto index = static_cast<size_t>(tag);")
+    output.append("    return index < std::size(MEMBER_TABLE) ? MEMBER_TABLE[index].filterType : GEFilterType::NONE;")
+    output.append("}")
     output.append("")
 
-    return "\n".join(output)
+    output.append("bool GEParamsBuilder::Hash(const GEFilterParams& params, uint64_t& hash)")
+    output.append("{")
+    output.append("    // The tags of one params type are contiguous, in declaration order")
+    output.append("    size_t first = 0;")
+    output.append("    size_t last = 0;")
+    output.append("    switch (params.GetType()) {")
+    output.append("#define GE_HASH_PARAMS_CASE(EnumType, FirstTag, LastTag) \\")
+    output.append("    case GEFilterType::EnumType: \\")
+    output.append("        first = static_cast<size_t>(GEParamsMemberTag::FirstTag); \\")
+    output.append("        last = static_cast<size_t>(GEParamsMemberTag::LastTag); \\")
+    output.append("        break;")
+    output.append("")
+    for struct in structs:
+        tags = [tag_info.tag_name for field in struct.fields for tag_info in iterate_field_tags(struct, field)]
+        if tags:
+            output.append(f"        GE_HASH_PARAMS_CASE({struct.enum_type}, {tags[0]}, {tags[-1]})")
+    output.append("        default:")
+    output.append("            return false;")
+    output.append("    }")
+    output.append("#undef GE_HASH_PARAMS_CASE")
+    output.append("")
+    output.append("    GEParamsHasher hasher;")
+    output.append("    hasher.Add(params.GetType());")
+    output.append("    for (size_t index = first; index <= last; ++index) {")
+    output.append("        if (MEMBER_TABLE[index].hasher == nullptr) {")
+    output.append("            return false;")
+    output.append("        }")
+    output.append("        MEMBER_TABLE[index].hasher(params, hasher);")
+    output.append("    }")
+    output.append("    if (!hasher.IsHashable()) {")
+    output.append("        return false;")
+    output.append("    }")
+    output.append("    hash = hasher.GetHash();")
+    output.append("    return true;")
+    output.append("}")
+    output.append("")
 
+    return "\n".join(output)
 
-def generate_set_params_member_overloads_impl(structs: List[StructInfo], type_aliases: Dict[str, str], blocked_types: Optional[Dict[str, str]] = None) -> str:
-    """Generate overloaded SetParamsMemberByTag function implementations."""
-    if blocked_types is None:
-        blocked_types = {}
 
+def generate_set_params_member_overloads_impl() -> str:
+    """Generate overloaded SetParamsMemberByTag function implementations, all dispatching through the table."""
     output = []
 
-    output.append("// Helper macro to validate and set parameter")
-    output.append("#define GE_VALIDATE_AND_SET(Tag) \\")
-    output.append("    case GEParamsMemberTag::Tag: { \\")
-    output.append("        using ParamsType = GEParamsFieldAccessor<GEParamsMemberTag::Tag>::ParamsType; \\")
-    output.append("        using FieldType = GEParamsFieldAccessor<GEParamsMemberTag::Tag>::FieldType; \\")
-    output.append("        using SetterType = std::remove_cv_t<std::remove_reference_t<decltype(value)>>; \\")
-    output.append("        auto unboxed = GEFilterParams::Unbox<ParamsType>(params); \\")
-    output.append("        if (unboxed == nullptr) { \\")
-    output.append("            return; \\")
-    output.append("        } \\")
-    output.append("        auto& actualParams = *unboxed; \\")
-    output.append("        FieldType transformed; \\")
-    output.append("        if (GEParamsValueTransformer<GEParamsMemberTag::Tag, SetterType, FieldType>::Transform(value, transformed)) { \\")
-    output.append("            GEParamsFieldAccessor<GEParamsMemberTag::Tag>::Set(actualParams, transformed); \\")
-    output.append("        } \\")
-    output.append("        break; \\")
+    output.append("#define GE_SET_PARAMS_MEMBER_BY_TAG(Type) \\")
+    output.append("    void GEParamsMemberHelper::SetParamsMemberByTag(GEFilterParams& params, GEParamsMemberTag tag, const Type& value) \\")
+    output.append("    { \\")
+    output.append("        SetMemberByKind(params, tag, GEParamsValueKind<Type>::VALUE, &value); \\")
     output.append("    }")
     output.append("")
-
-    # Group tags by their effective type (considering prop attributes and array_accessor_type)
-    # When cast_from is specified, tags are added to BOTH cast_from type AND original field type
-    type_to_tags: Dict[str, List[Tuple[str, str, str]]] = {}
-    for struct in structs:
-        for field in struct.fields:
-            for tag_info in iterate_field_tags(struct, field):
-                # Get effective type (cast_from or field type)
-                normalized_type = get_effective_type_for_tag(
-                    field, tag_info.is_array_element, tag_info.array_index, tag_info.prop_attr_index, type_aliases
-                )
-
-                if normalized_type not in blocked_types:
-                    type_to_tags.setdefault(normalized_type, []).append((tag_info.tag_name, struct.name, field.name))
-
-                # If cast_from is specified, also add to original field type group
-                # When cast_from type differs from field type, we add BOTH groups.
-                # When custom is alone (no cast_from), source=target=field type,
-                # so we only add the field type group once (no duplicate).
-                # When cast_from type equals field type (after alias resolution), skip duplicate.
-                if not has_cast_from(field, tag_info.prop_attr_index):
-                    continue
-                original_type = get_original_field_type(field, tag_info.is_array_element)
-                normalized_original = normalize_type(original_type, type_aliases)
-                if normalized_type == normalized_original or normalized_original in blocked_types:
-                    continue
-                type_to_tags.setdefault(normalized_original, []).append((tag_info.tag_name, struct.name, field.name))
-
-    for field_type, tags in sorted(type_to_tags.items()):
-        output.append(f"void GEParamsMemberHelper::SetParamsMemberByTag(GEFilterParams& params,")
-        output.append(f"    GEParamsMemberTag tag, const {field_type}& value)")
-        output.append("{")
-        output.append("")
-        output.append("    auto expectedFilterType = GetFilterTypeFromTag(tag);")
-        output.append("    if (params.GetType() != expectedFilterType) {")
-        output.append("        return;")
-        output.append("    }")
-        output.append("")
-        output.append("    switch (tag) {")
-
-        for tag_name, struct_name, field_name in tags:
-            output.append(f"        GE_VALIDATE_AND_SET({tag_name})")
-
-        output.append("        default:")
-        output.append(f'            GE_LOGE("SetParamsMemberByTag<{field_type}>: No matching case for tag %{{public}}u (filter type %{{public}}u, params type %{{public}}u)",')
-        output.append("                static_cast<uint32_t>(tag),")
-        output.append("                static_cast<uint32_t>(expectedFilterType),")
-        output.append("                static_cast<uint32_t>(params.GetType()));")
-        output.append("            break;")
-        output.append("    }")
-        output.append("}")
-        output.append("")
-
-    output.append("#undef GE_VALIDATE_AND_SET")
+    output.append("FOR_EACH_PARAM_TYPE(GE_SET_PARAMS_MEMBER_BY_TAG)")
+    output.append("#undef GE_SET_PARAMS_MEMBER_BY_TAG")
     output.append("")
 
     return "\n".join(output)
@@ -785,7 +892,7 @@ def generate_set_params_member_overloads_decl(structs: List[StructInfo], type_al
 
     output.append("    // Overloaded SetParamsMemberByTag for each unique parameter type")
 
-    # Collect unique effective types from all tags (same logic as generate_set_params_member_overloads_impl)
+    # Collect unique effective types from all tags (same logic as get_accepted_types_for_tag)
     unique_types = collect_effective_types(structs, type_aliases, blocked_types)
     sorted_types = sorted(unique_types)
 
@@ -886,9 +993,119 @@ def generate_params_builder_decl() -> str:
     output.append("    // Convert filter name string to GEFilterType")
     output.append("    // Note: Strings are sourced from GEFilterParamsTypeInfo<Struct>::FilterName")
     output.append("    static GEFilterType GetFilterTypeFromString(const std::string& str);")
+    output.append("")
+    output.append("    // Cost predicted by the [[ge::cost(...)]] model of the params, nullopt when the type has none")
+    output.append("    static std::optional<GEEffectCost> EstimateCost(const GEFilterParams& params);")
+    output.append("")
+    output.append("    // Content hash of every member of the params, see GEParamsHasher. False when a member is unhashable.")
+    output.append("    static bool Hash(const GEFilterParams& params, uint64_t& hash);")
+    output.append("};")
+    output.append("")
+
+    return "\n".join(output)
+
+
+# Field types a cost expression may read, they are converted to float for the estimator
+COST_ARITHMETIC_TYPES = {"bool", "int", "float", "double", "int32_t", "uint32_t", "int64_t", "uint64_t", "uint8_t", "size_t"}
+
+# GEEffectCost member initialized from each ge::cost key, keys left out keep the GEEffectCost defaults
+COST_MEMBERS = (("passes", "passes"), ("read_radius", "readRadius"), ("scale", "resolutionScale"), ("reads", "readsPerPixel"))
+
+
+def get_cost_fields(struct: StructInfo) -> List[FieldInfo]:
+    """Return the fields referenced by the ge::cost expressions of a struct, reporting non arithmetic ones."""
+    expressions = " ".join(struct.cost.values())
+    identifiers = set(re.findall(r"[A-Za-z_]\w*", expressions))
+    used_fields = []
+    for field in struct.fields:
+        if field.name not in identifiers:
+            continue
+        if field.type not in COST_ARITHMETIC_TYPES:
+            console.error(f"{struct.name}: cost expressions can't read '{field.name}' of type '{field.type}'")
+            continue
+        used_fields.append(field)
+    return used_fields
+
+
+def generate_effect_cost_models(structs: List[StructInfo]) -> str:
+    """Generate GEEffectCostEstimator specializations from the ge::cost attributes."""
+    output = []
+
+    output.append("// GEEffectCostEstimator template specializations")
+    output.append("// Generated from the [[ge::cost(...)]] attributes, Estimate predicts the cost of the effect for params")
+    output.append("template<typename T>")
+    output.append("struct GEEffectCostEstimator {")
+    output.append("    static constexpr bool HAS_MODEL = false;")
     output.append("};")
     output.append("")
 
+    for struct in structs:
+        if not struct.cost:
+            continue
+        output.append("template<>")
+        output.append(f"struct GEEffectCostEstimator<{struct.name}> {{")
+        output.append("    static constexpr bool HAS_MODEL = true;")
+        output.append(f"    static constexpr GEEffectCost Estimate([[maybe_unused]] const {struct.name}& params)")
+        output.append("    {")
+        output.append("        using namespace GEEffectCostMath;")
+        for field in get_cost_fields(struct):
+            output.append(f"        const float {field.name} = static_cast<float>(params.{field.name});")
+        output.append("        GEEffectCost cost;")
+        for key, member in COST_MEMBERS:
+            if key in struct.cost:
+                output.append(f"        cost.{member} = static_cast<float>({struct.cost[key]});")
+        output.append("        return cost;")
+        output.append("    }")
+        output.append("};")
+        output.append("")
+
+    output.append("// Whether the params of filterType carry a cost model")
+    output.append("constexpr bool HasEffectCostModel(GEFilterType filterType)")
+    output.append("{")
+    output.append("    switch (filterType) {")
+    cost_structs = [struct for struct in structs if struct.cost]
+    for struct in cost_structs:
+        output.append(f"        case GEFilterType::{struct.enum_type}:")
+    if cost_structs:
+        output.append("            return true;")
+    output.append("        default:")
+    output.append("            return false;")
+    output.append("    }")
+    output.append("}")
+    output.append("")
+
+    return "\n".join(output)
+
+
+def generate_estimate_cost_impl(structs: List[StructInfo]) -> str:
+    """Generate GEParamsBuilder::EstimateCost() implementation."""
+    output = []
+
+    output.append("std::optional<GEEffectCost> GEParamsBuilder::EstimateCost(const GEFilterParams& params)")
+    output.append("{")
+    output.append("    switch (params.GetType()) {")
+    output.append("#define GE_ESTIMATE_COST_CASE(EnumType, Struct) \\")
+    output.append("    case GEFilterType::EnumType: { \\")
+    output.append("        auto typedParams = GEFilterParams::Unbox<Struct>(params); \\")
+    output.append("        if (typedParams == nullptr) { \\")
+    output.append("            return std::nullopt; \\")
+    output.append("        } \\")
+    output.append("        return GEEffectCostEstimator<Struct>::Estimate(*typedParams); \\")
+    output.append("    }")
+    output.append("")
+
+    for struct in structs:
+        if struct.cost:
+            output.append(f"        GE_ESTIMATE_COST_CASE({struct.enum_type}, {struct.name})")
+
+    output.append("        default:")
+    output.append("            return std::nullopt;")
+    output.append("        }")
+    output.append("}")
+    output.append("")
+    output.append("#undef GE_ESTIMATE_COST_CASE")
+    output.append("")
+
     return "\n".join(output)
 
 
@@ -901,7 +1118,7 @@ def generate_params_builder_impl(structs: List[StructInfo]) -> str:
     output.append("    switch (filterType) {")
     output.append("#define GE_BUILD_PARAMS_CASE(EnumType, Struct) \\")
     output.append("    case GEFilterType::EnumType: {\\")
-    output.append("        return GEFilterParams::Box(std::make_shared<Struct>()); \\")
+    output.append("        return GEFilterParams::Make<Struct>(); \\")
     output.append("    }")
     output.append("")
 
@@ -1010,7 +1227,7 @@ def generate_type_xmacro(structs: List[StructInfo], type_aliases: Dict[str, str]
 
     output = []
 
-    # Collect unique effective types from all tags (same logic as generate_set_params_member_overloads_impl)
+    # Collect unique effective types from all tags (same logic as get_accepted_types_for_tag)
     unique_types = collect_effective_types(structs, type_aliases, blocked_types)
     sorted_types = sorted(unique_types)
 
@@ -1458,6 +1675,7 @@ def generate_header(structs: List[StructInfo], type_aliases: Dict[str, str], blo
     output.append("#include <type_traits>")
     output.append("#include <utility>")
     output.append("")
+    output.append('#include "ge_effect_cost.h"')
     output.append('#include "ge_effects_params.h"')
     output.append('#include "ge_value_transformer_traits.h"')
     output.append('#include "ge_value_transformer.h"')
@@ -1496,6 +1714,9 @@ def generate_header(structs: List[StructInfo], type_aliases: Dict[str, str], blo
     output.append(generate_filter_params_type_info(structs))
     output.append(generate_params_builder_decl())
 
+    # Generate GEEffectCostEstimator specializations
+    output.append(generate_effect_cost_models(structs))
+
     # Generate type traits
     output.append(generate_type_traits(structs))
 
@@ -1524,6 +1745,8 @@ def generate_cpp(structs: List[StructInfo], type_aliases: Dict[str, str], blocke
     output.append('#include "ge_params_reflection.h"')
     output.append('#include "ge_filter_params.h"')
     output.append('#include "ge_log.h"')
+    output.append('#include "ge_params_hash.h"')
+    output.append("#include <iterator>")
     output.append("#include <unordered_map>")
     output.append("")
 
@@ -1538,14 +1761,17 @@ def generate_cpp(structs: List[StructInfo], type_aliases: Dict[str, str], blocke
     # Generate GEParamsBuilder::GetFilterTypeFromString() implementation
     output.append(generate_filter_type_from_string_impl(structs))
 
-    # Generate GEParamsMemberHelper::GetFilterTypeFromTag() implementation
-    output.append(generate_get_filter_type_from_tag_impl(structs))
+    # Generate GEParamsBuilder::EstimateCost() implementation
+    output.append(generate_estimate_cost_impl(structs))
+
+    # Generate the tag dispatch table and GEParamsMemberHelper::GetFilterTypeFromTag() implementation
+    output.append(generate_member_dispatch_table_impl(structs, type_aliases, blocked_types))
 
     # Generate GEParamsMemberTagFromString() implementation
     output.append(generate_string_to_enum_mapping_impl(structs))
 
     # Generate overloaded SetParamsMemberByTag implementations
-    output.append(generate_set_params_member_overloads_impl(structs, type_aliases, blocked_types))
+    output.append(generate_set_params_member_overloads_impl())
 
     output.append("} // namespace Drawing")
     output.append("} // namespace Rosen")
@@ -1612,7 +1838,7 @@ def check_cast_from_same_type(structs: List[StructInfo], type_aliases: Dict[str,
     """Check that cast_from type differs from the field type.
 
     When cast_from specifies the same type as the field (after type alias resolution),
-    the generated code produces duplicate switch cases, causing compilation failure.
+    the dispatch table would register the same value kind twice for the tag.
 
     Args:
         structs: List of struct information